@@ -0,0 +1,323 @@
+/*
+ * BSP_DMA2D.c
+ * DMA2D pixel format conversion and blending service
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "main.h"
+#include "BSP_DMA2D.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+/* ITCM 0x00000000, DTCM 0x20000000: not on the AXI matrix */
+#define DMA2D_IS_TCM(addr)            ((((addr) & 0xFF000000U) == 0x20000000U) || \
+                                       (((addr) & 0xFF000000U) == 0x00000000U))
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+extern DMA2D_HandleTypeDef hdma2d;
+
+static struct
+{
+    BSP_DMA2D_Stats_t   stats;
+    const uint32_t      *clut;        /* loaded in the foreground CLUT */
+} DMA2D_Srv;
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static uint32_t InputNibbles(uint32_t mode);
+static uint32_t InputLine(uint32_t width, uint32_t mode);
+static uint32_t OutputBytes(uint32_t mode);
+static void RestoreDefaults(void);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+HAL_StatusTypeDef BSP_DMA2D_Convert(const BSP_DMA2D_Pfc_t *pfc)
+{
+    uint32_t in_line = InputLine(pfc->width, pfc->in_mode);
+    uint32_t out_line = pfc->width * OutputBytes(pfc->out_mode);
+    HAL_StatusTypeDef ret;
+
+    if ((pfc->width == 0U) || (pfc->width > BSP_DMA2D_MAX_WIDTH) ||
+        (pfc->lines == 0U) || (pfc->lines > BSP_DMA2D_MAX_LINES) ||
+        (in_line == 0U) || (out_line == 0U) ||
+        (pfc->src_stride < in_line) || (pfc->dst_stride < out_line) ||
+        ((pfc->src_stride - in_line) > BSP_DMA2D_MAX_GAP) ||
+        ((pfc->dst_stride - out_line) > BSP_DMA2D_MAX_GAP) ||
+        (pfc->swap && (OutputBytes(pfc->out_mode) != 2U)) ||
+        !BSP_DMA2D_isReachable(pfc->src) || !BSP_DMA2D_isReachable(pfc->dst))
+    {
+        DMA2D_Srv.stats.errors++;
+        return HAL_ERROR;
+    }
+    if (BSP_DMA2D_isBusy())
+    {
+        DMA2D_Srv.stats.busy++;
+        return HAL_BUSY;
+    }
+
+    hdma2d.Init.Mode = DMA2D_M2M_PFC;
+    hdma2d.Init.ColorMode = pfc->out_mode;
+    hdma2d.Init.OutputOffset = pfc->dst_stride - out_line;
+    hdma2d.Init.AlphaInverted = DMA2D_REGULAR_ALPHA;
+    hdma2d.Init.RedBlueSwap = DMA2D_RB_REGULAR;
+    hdma2d.Init.BytesSwap = pfc->swap ? DMA2D_BYTES_SWAP : DMA2D_BYTES_REGULAR;
+    hdma2d.Init.LineOffsetMode = DMA2D_LOM_BYTES;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputOffset = pfc->src_stride - in_line;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputColorMode = pfc->in_mode;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaMode = DMA2D_NO_MODIF_ALPHA;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputAlpha = 0xFFU;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].AlphaInverted = DMA2D_REGULAR_ALPHA;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].RedBlueSwap = DMA2D_RB_REGULAR;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].ChromaSubSampling = DMA2D_NO_CSS;
+
+    ret = HAL_DMA2D_Init(&hdma2d);
+    if (ret == HAL_OK)
+    {
+        ret = HAL_DMA2D_ConfigLayer(&hdma2d, DMA2D_FOREGROUND_LAYER);
+    }
+    if (ret == HAL_OK)
+    {
+        ret = HAL_DMA2D_Start(&hdma2d, (uint32_t)pfc->src, (uint32_t)pfc->dst,
+                pfc->width, pfc->lines);
+    }
+    if (ret == HAL_OK)
+    {
+        ret = HAL_DMA2D_PollForTransfer(&hdma2d, BSP_DMA2D_TIMEOUT_MS);
+    }
+    RestoreDefaults();
+
+    if (ret == HAL_OK)
+    {
+        DMA2D_Srv.stats.jobs++;
+        DMA2D_Srv.stats.pixels += pfc->width * pfc->lines;
+    }
+    else
+    {
+        DMA2D_Srv.stats.errors++;
+    }
+    return ret;
+}
+
+HAL_StatusTypeDef BSP_DMA2D_Blend(const BSP_DMA2D_Blend_t *blend)
+{
+    uint32_t src_line = InputLine(blend->width, blend->src_mode);
+    uint32_t bg_line = InputLine(blend->width, blend->bg_mode);
+    uint32_t out_line = blend->width * OutputBytes(blend->out_mode);
+    uint8_t alpha_only = ((blend->src_mode == DMA2D_INPUT_A4) ||
+                          (blend->src_mode == DMA2D_INPUT_A8)) ? 1U : 0U;
+    DMA2D_LayerCfgTypeDef *fg = &hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER];
+    DMA2D_LayerCfgTypeDef *bg = &hdma2d.LayerCfg[DMA2D_BACKGROUND_LAYER];
+    HAL_StatusTypeDef ret;
+
+    if ((blend->width == 0U) || (blend->width > BSP_DMA2D_MAX_WIDTH) ||
+        (blend->lines == 0U) || (blend->lines > BSP_DMA2D_MAX_LINES) ||
+        (src_line == 0U) || (bg_line == 0U) || (out_line == 0U) ||
+        (blend->src_stride < src_line) || (blend->bg_stride < bg_line) ||
+        (blend->dst_stride < out_line) ||
+        ((blend->src_stride - src_line) > BSP_DMA2D_MAX_GAP) ||
+        ((blend->bg_stride - bg_line) > BSP_DMA2D_MAX_GAP) ||
+        ((blend->dst_stride - out_line) > BSP_DMA2D_MAX_GAP) ||
+        !BSP_DMA2D_isReachable(blend->src) || !BSP_DMA2D_isReachable(blend->bg) ||
+        !BSP_DMA2D_isReachable(blend->dst))
+    {
+        DMA2D_Srv.stats.errors++;
+        return HAL_ERROR;
+    }
+    if (BSP_DMA2D_isBusy())
+    {
+        DMA2D_Srv.stats.busy++;
+        return HAL_BUSY;
+    }
+
+    hdma2d.Init.Mode = DMA2D_M2M_BLEND;
+    hdma2d.Init.ColorMode = blend->out_mode;
+    hdma2d.Init.OutputOffset = blend->dst_stride - out_line;
+    hdma2d.Init.AlphaInverted = DMA2D_REGULAR_ALPHA;
+    hdma2d.Init.RedBlueSwap = DMA2D_RB_REGULAR;
+    hdma2d.Init.BytesSwap = DMA2D_BYTES_REGULAR;
+    hdma2d.Init.LineOffsetMode = DMA2D_LOM_BYTES;
+    fg->InputOffset = blend->src_stride - src_line;
+    fg->InputColorMode = blend->src_mode;
+    fg->AlphaMode = (blend->alpha == 0xFFU) ? DMA2D_NO_MODIF_ALPHA : DMA2D_COMBINE_ALPHA;
+    /* A4/A8: the HAL takes the opacity from bits 31:24, the color below */
+    fg->InputAlpha = alpha_only ? (((uint32_t)blend->alpha << 24) | (blend->color & 0x00FFFFFFU)) :
+            blend->alpha;
+    fg->AlphaInverted = DMA2D_REGULAR_ALPHA;
+    fg->RedBlueSwap = DMA2D_RB_REGULAR;
+    fg->ChromaSubSampling = DMA2D_NO_CSS;
+    bg->InputOffset = blend->bg_stride - bg_line;
+    bg->InputColorMode = blend->bg_mode;
+    bg->AlphaMode = DMA2D_NO_MODIF_ALPHA;
+    bg->InputAlpha = 0xFFU;
+    bg->AlphaInverted = DMA2D_REGULAR_ALPHA;
+    bg->RedBlueSwap = DMA2D_RB_REGULAR;
+
+    ret = HAL_DMA2D_Init(&hdma2d);
+    if (ret == HAL_OK)
+    {
+        ret = HAL_DMA2D_ConfigLayer(&hdma2d, DMA2D_FOREGROUND_LAYER);
+    }
+    if (ret == HAL_OK)
+    {
+        ret = HAL_DMA2D_ConfigLayer(&hdma2d, DMA2D_BACKGROUND_LAYER);
+    }
+    if (ret == HAL_OK)
+    {
+        ret = HAL_DMA2D_BlendingStart(&hdma2d, (uint32_t)blend->src, (uint32_t)blend->bg,
+                (uint32_t)blend->dst, blend->width, blend->lines);
+    }
+    if (ret == HAL_OK)
+    {
+        ret = HAL_DMA2D_PollForTransfer(&hdma2d, BSP_DMA2D_TIMEOUT_MS);
+    }
+    RestoreDefaults();
+
+    if (ret == HAL_OK)
+    {
+        DMA2D_Srv.stats.jobs++;
+        DMA2D_Srv.stats.pixels += blend->width * blend->lines;
+    }
+    else
+    {
+        DMA2D_Srv.stats.errors++;
+    }
+    return ret;
+}
+
+HAL_StatusTypeDef BSP_DMA2D_LoadClut(const uint32_t *clut, uint32_t entries)
+{
+    DMA2D_CLUTCfgTypeDef cfg;
+    HAL_StatusTypeDef ret;
+
+    if ((entries == 0U) || (entries > 256U) || !BSP_DMA2D_isReachable(clut))
+    {
+        return HAL_ERROR;
+    }
+    if (clut == DMA2D_Srv.clut)
+    {
+        return HAL_OK;
+    }
+    if (BSP_DMA2D_isBusy())
+    {
+        DMA2D_Srv.stats.busy++;
+        return HAL_BUSY;
+    }
+
+    cfg.pCLUT = (uint32_t*)clut;
+    cfg.CLUTColorMode = DMA2D_CCM_ARGB8888;
+    cfg.Size = entries - 1U;
+    ret = HAL_DMA2D_CLUTStartLoad(&hdma2d, &cfg, DMA2D_FOREGROUND_LAYER);
+    if (ret == HAL_OK)
+    {
+        ret = HAL_DMA2D_PollForTransfer(&hdma2d, BSP_DMA2D_TIMEOUT_MS);
+    }
+    if (ret == HAL_OK)
+    {
+        DMA2D_Srv.clut = clut;
+        DMA2D_Srv.stats.clut_loads++;
+    }
+    else
+    {
+        DMA2D_Srv.clut = NULL;
+        DMA2D_Srv.stats.errors++;
+    }
+    return ret;
+}
+
+uint8_t BSP_DMA2D_isReachable(const void *addr)
+{
+    return DMA2D_IS_TCM((uint32_t)addr) ? 0U : 1U;
+}
+
+uint8_t BSP_DMA2D_isBusy(void)
+{
+    return ((HAL_DMA2D_GetState(&hdma2d) != HAL_DMA2D_STATE_READY) ||
+            (hdma2d.Instance->CR & DMA2D_CR_START)) ? 1U : 0U;
+}
+
+const BSP_DMA2D_Stats_t* BSP_DMA2D_GetStats(void)
+{
+    return &DMA2D_Srv.stats;
+}
+
+/******************************************************************************
+ *                               LOCAL FUNCTIONS                              *
+ ******************************************************************************/
+
+/* Input bits per pixel / 4 */
+static uint32_t InputNibbles(uint32_t mode)
+{
+    switch (mode)
+    {
+        case DMA2D_INPUT_ARGB8888:
+            return 8U;
+        case DMA2D_INPUT_RGB888:
+            return 6U;
+        case DMA2D_INPUT_RGB565:
+        case DMA2D_INPUT_ARGB1555:
+        case DMA2D_INPUT_ARGB4444:
+        case DMA2D_INPUT_AL88:
+            return 4U;
+        case DMA2D_INPUT_L8:
+        case DMA2D_INPUT_AL44:
+        case DMA2D_INPUT_A8:
+            return 2U;
+        case DMA2D_INPUT_L4:
+        case DMA2D_INPUT_A4:
+            return 1U;
+        default:
+            return 0U;
+    }
+}
+
+/* Bytes per input line, 0 for an unknown mode or a L4/A4 half byte */
+static uint32_t InputLine(uint32_t width, uint32_t mode)
+{
+    uint32_t nibbles = width * InputNibbles(mode);
+
+    return ((nibbles & 1U) == 0U) ? (nibbles / 2U) : 0U;
+}
+
+static uint32_t OutputBytes(uint32_t mode)
+{
+    switch (mode)
+    {
+        case DMA2D_OUTPUT_ARGB8888:
+            return 4U;
+        case DMA2D_OUTPUT_RGB888:
+            return 3U;
+        case DMA2D_OUTPUT_RGB565:
+        case DMA2D_OUTPUT_ARGB1555:
+        case DMA2D_OUTPUT_ARGB4444:
+            return 2U;
+        default:
+            return 0U;
+    }
+}
+
+/* BSP_RGB_LCD only sets mode, color mode and offsets, the rest must be back
+ * at the values it expects (offsets in pixels, no swaps) */
+static void RestoreDefaults(void)
+{
+    hdma2d.Init.AlphaInverted = DMA2D_REGULAR_ALPHA;
+    hdma2d.Init.RedBlueSwap = DMA2D_RB_REGULAR;
+    hdma2d.Init.BytesSwap = DMA2D_BYTES_REGULAR;
+    hdma2d.Init.LineOffsetMode = DMA2D_LOM_PIXELS;
+    hdma2d.Init.OutputOffset = 0U;
+    hdma2d.LayerCfg[DMA2D_FOREGROUND_LAYER].InputOffset = 0U;
+    hdma2d.LayerCfg[DMA2D_BACKGROUND_LAYER].InputOffset = 0U;
+    MODIFY_REG(hdma2d.Instance->CR, DMA2D_CR_LOM, DMA2D_LOM_PIXELS);
+    MODIFY_REG(hdma2d.Instance->OPFCCR, DMA2D_OPFCCR_SB, DMA2D_BYTES_REGULAR);
+}
@@ -0,0 +1,129 @@
+/*
+ * BSP_DMA2D.h
+ * DMA2D pixel format conversion and blending service
+ *
+ * Runs memory to memory pixel format conversions (PFC) and blends on the
+ * shared hdma2d handle, strides in bytes. The handle is also used by
+ * BSP_RGB_LCD, every job programs the full configuration and leaves the
+ * fields the LCD driver doesn't set back at their reset values. Jobs are
+ * blocking (polled), the caller decides whether a transfer is worth it (see
+ * vision_color.h).
+ */
+
+#ifndef BSP_DMA2D_H_
+#define BSP_DMA2D_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "main.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+#define BSP_DMA2D_TIMEOUT_MS                     (50U)
+
+/* Hardware limits */
+#define BSP_DMA2D_MAX_WIDTH                      (16383U)    /* NLR.PL */
+#define BSP_DMA2D_MAX_LINES                      (65535U)    /* NLR.NL */
+#define BSP_DMA2D_MAX_GAP                        (65535U)    /* line offset in bytes */
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    const void  *src;
+    void        *dst;
+    uint32_t    src_stride;       /* bytes from line to line */
+    uint32_t    dst_stride;
+    uint32_t    width;            /* pixels per line */
+    uint32_t    lines;
+    uint32_t    in_mode;          /* DMA2D_INPUT_xxx */
+    uint32_t    out_mode;         /* DMA2D_OUTPUT_xxx */
+    uint8_t     swap;             /* 16 bit output: bytes swapped two by two */
+} BSP_DMA2D_Pfc_t;
+
+typedef struct
+{
+    const void  *src;             /* foreground */
+    const void  *bg;              /* background, may be dst */
+    void        *dst;
+    uint32_t    src_stride;       /* bytes from line to line */
+    uint32_t    bg_stride;
+    uint32_t    dst_stride;
+    uint32_t    width;            /* pixels per line */
+    uint32_t    lines;
+    uint32_t    src_mode;         /* DMA2D_INPUT_xxx */
+    uint32_t    bg_mode;
+    uint32_t    out_mode;         /* DMA2D_OUTPUT_xxx */
+    uint32_t    color;            /* A4/A8 foreground: RGB888 of every pixel */
+    uint8_t     alpha;            /* foreground opacity, 255: as stored */
+} BSP_DMA2D_Blend_t;
+
+typedef struct
+{
+    uint32_t    jobs;
+    uint32_t    pixels;
+    uint32_t    busy;             /* refused, transfer running */
+    uint32_t    errors;           /* configuration or transfer errors */
+    uint32_t    clut_loads;
+} BSP_DMA2D_Stats_t;
+
+/******************************************************************************
+ *                           GLOBAL MACRO / INLINES                           *
+ ******************************************************************************/
+
+/* RGB565 spread to 0x07E0F81F: green in the high half, room to multiply */
+#define BSP_DMA2D_SPREAD565(c)                   \
+    (((uint32_t)(c) | ((uint32_t)(c) << 16)) & 0x07E0F81FU)
+
+/* RGB565 to RGB888 by bit replication, as the DMA2D expands it (A4/A8
+ * foreground color, ARGB8888 buffers) */
+static inline uint32_t BSP_DMA2D_Rgb565To888(uint32_t c)
+{
+    return ((c & 0xF800U) << 8) | ((c & 0xE000U) << 3) |
+           ((c & 0x07E0U) << 5) | ((c & 0x0600U) >> 1) |
+           ((c & 0x001FU) << 3) | ((c & 0x001CU) >> 2);
+}
+
+/* RGB565 fg over bg on the CPU, alpha on 5 bits: 0 gives bg, 31 gives fg */
+static inline uint16_t BSP_DMA2D_Blend565(uint32_t fg, uint32_t bg, uint32_t alpha)
+{
+    uint32_t d = BSP_DMA2D_SPREAD565(bg);
+
+    if (alpha >= 31U)
+    {
+        return (uint16_t)fg;
+    }
+    d = ((((BSP_DMA2D_SPREAD565(fg) - d) * alpha) >> 5) + d) & 0x07E0F81FU;
+    return (uint16_t)(d | (d >> 16));
+}
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Blocking conversion. HAL_BUSY if the DMA2D is running, HAL_ERROR if the
+ * job exceeds the limits above or doesn't fit a line of the output. With
+ * the D-cache enabled the caller cleans the source and invalidates the
+ * destination. */
+extern HAL_StatusTypeDef BSP_DMA2D_Convert(const BSP_DMA2D_Pfc_t *pfc);
+
+/* Blocking blend of the foreground over the background, same rules. An
+ * A4 foreground line must start on a byte and hold an even count. */
+extern HAL_StatusTypeDef BSP_DMA2D_Blend(const BSP_DMA2D_Blend_t *blend);
+
+/* Foreground CLUT for DMA2D_INPUT_L8/L4 (ARGB8888 entries). The table is
+ * only transferred when it differs from the loaded one (same pointer). */
+extern HAL_StatusTypeDef BSP_DMA2D_LoadClut(const uint32_t *clut, uint32_t entries);
+
+/* 0 for memories the DMA2D (AXI master) can't reach: ITCM and DTCM */
+extern uint8_t BSP_DMA2D_isReachable(const void *addr);
+extern uint8_t BSP_DMA2D_isBusy(void);
+extern const BSP_DMA2D_Stats_t* BSP_DMA2D_GetStats(void);
+
+#endif /* BSP_DMA2D_H_ */
@@ -0,0 +1,235 @@
+/*
+ * BSP_MDMA.c
+ * MDMA strided copy service
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "main.h"
+#include "BSP_MDMA.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+/* Buffer transfer length (CTCR.TLEN + 1), max 128 bytes */
+#define MDMA_TLEN_BYTES               (128U)
+
+/* ITCM/DTCM are reached through the AHBS bus, see MDMA_SetConfig() */
+#define MDMA_IS_TCM(addr)             ((((addr) & 0xFF000000U) == 0x20000000U) || \
+                                       (((addr) & 0xFF000000U) == 0x00000000U))
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    BSP_MDMA_Stats_t    stats;
+    BSP_MDMA_Cb_t       cb;
+    void                *user;
+    uint32_t            nodes;        /* of the running job */
+    uint32_t            bytes;
+    volatile uint8_t    busy;
+} MDMA_Srv;
+
+/* Linked list, CLAR needs 8 byte aligned nodes */
+static MDMA_LinkNodeTypeDef MDMA_Nodes[BSP_MDMA_MAX_NODES] __attribute__((aligned(8)));
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static HAL_StatusTypeDef BuildNode(MDMA_LinkNodeTypeDef *node, const BSP_MDMA_Rect_t *rect);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void BSP_MDMA_Init(void)
+{
+    __HAL_RCC_MDMA_CLK_ENABLE();
+    CLEAR_BIT(BSP_MDMA_CHANNEL->CCR, MDMA_CCR_EN);
+    WRITE_REG(BSP_MDMA_CHANNEL->CIFCR, MDMA_CIFCR_CTEIF | MDMA_CIFCR_CCTCIF |
+            MDMA_CIFCR_CBRTIF | MDMA_CIFCR_CBTIF | MDMA_CIFCR_CLTCIF);
+    HAL_NVIC_SetPriority(MDMA_IRQn, BSP_MDMA_IRQ_PRIORITY, 0U);
+    HAL_NVIC_EnableIRQ(MDMA_IRQn);
+}
+
+HAL_StatusTypeDef BSP_MDMA_CopyList(const BSP_MDMA_Rect_t *rects, uint32_t count,
+        BSP_MDMA_Cb_t cb, void *user)
+{
+    MDMA_Channel_TypeDef *ch = BSP_MDMA_CHANNEL;
+    uint32_t bytes = 0U;
+    uint32_t i;
+
+    if ((count == 0U) || (count > BSP_MDMA_MAX_NODES))
+    {
+        return HAL_ERROR;
+    }
+
+    __disable_irq();
+    if (MDMA_Srv.busy)
+    {
+        MDMA_Srv.stats.busy++;
+        __enable_irq();
+        return HAL_BUSY;
+    }
+    MDMA_Srv.busy = 1U;
+    __enable_irq();
+
+    for (i = 0U; i < count; i++)
+    {
+        if (BuildNode(&MDMA_Nodes[i], &rects[i]) != HAL_OK)
+        {
+            MDMA_Srv.busy = 0U;
+            return HAL_ERROR;
+        }
+        MDMA_Nodes[i].CLAR = (i + 1U < count) ? (uint32_t)&MDMA_Nodes[i + 1U] : 0U;
+        bytes += rects[i].width * rects[i].lines;
+    }
+    MDMA_Srv.cb = cb;
+    MDMA_Srv.user = user;
+    MDMA_Srv.nodes = count;
+    MDMA_Srv.bytes = bytes;
+
+    /* First node goes to the channel registers, the rest is fetched via CLAR */
+    CLEAR_BIT(ch->CCR, MDMA_CCR_EN);
+    WRITE_REG(ch->CIFCR, MDMA_CIFCR_CTEIF | MDMA_CIFCR_CCTCIF |
+            MDMA_CIFCR_CBRTIF | MDMA_CIFCR_CBTIF | MDMA_CIFCR_CLTCIF);
+    ch->CTCR = MDMA_Nodes[0].CTCR;
+    ch->CBNDTR = MDMA_Nodes[0].CBNDTR;
+    ch->CSAR = MDMA_Nodes[0].CSAR;
+    ch->CDAR = MDMA_Nodes[0].CDAR;
+    ch->CBRUR = MDMA_Nodes[0].CBRUR;
+    ch->CLAR = MDMA_Nodes[0].CLAR;
+    ch->CTBR = MDMA_Nodes[0].CTBR;
+    ch->CMAR = 0U;
+    ch->CMDR = 0U;
+    /* Nodes must be in memory before the channel fetches them */
+    __DSB();
+    WRITE_REG(ch->CCR, BSP_MDMA_PRIORITY | MDMA_CCR_CTCIE | MDMA_CCR_TEIE);
+    SET_BIT(ch->CCR, MDMA_CCR_EN);
+    SET_BIT(ch->CCR, MDMA_CCR_SWRQ);
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef BSP_MDMA_Copy2D(const BSP_MDMA_Rect_t *rect, BSP_MDMA_Cb_t cb, void *user)
+{
+    return BSP_MDMA_CopyList(rect, 1U, cb, user);
+}
+
+uint8_t BSP_MDMA_isBusy(void)
+{
+    return MDMA_Srv.busy;
+}
+
+HAL_StatusTypeDef BSP_MDMA_Wait(uint32_t timeout_ms)
+{
+    uint32_t start = HAL_GetTick();
+
+    while (MDMA_Srv.busy)
+    {
+        if ((HAL_GetTick() - start) > timeout_ms)
+        {
+            return HAL_TIMEOUT;
+        }
+    }
+    return HAL_OK;
+}
+
+const BSP_MDMA_Stats_t* BSP_MDMA_GetStats(void)
+{
+    return &MDMA_Srv.stats;
+}
+
+void BSP_MDMA_IRQHandler(void)
+{
+    MDMA_Channel_TypeDef *ch = BSP_MDMA_CHANNEL;
+    uint32_t isr = ch->CISR;
+    HAL_StatusTypeDef status;
+
+    if (isr & MDMA_CISR_TEIF)
+    {
+        MDMA_Srv.stats.errors++;
+        MDMA_Srv.stats.last_error = ch->CESR;
+        status = HAL_ERROR;
+    }
+    else if (isr & MDMA_CISR_CTCIF)
+    {
+        MDMA_Srv.stats.jobs++;
+        MDMA_Srv.stats.nodes += MDMA_Srv.nodes;
+        MDMA_Srv.stats.bytes += MDMA_Srv.bytes;
+        status = HAL_OK;
+    }
+    else
+    {
+        return;
+    }
+
+    CLEAR_BIT(ch->CCR, MDMA_CCR_EN);
+    WRITE_REG(ch->CIFCR, MDMA_CIFCR_CTEIF | MDMA_CIFCR_CCTCIF |
+            MDMA_CIFCR_CBRTIF | MDMA_CIFCR_CBTIF | MDMA_CIFCR_CLTCIF);
+    MDMA_Srv.busy = 0U;
+    if (MDMA_Srv.cb != NULL)
+    {
+        MDMA_Srv.cb(status, MDMA_Srv.user);
+    }
+}
+
+/******************************************************************************
+ *                               LOCAL FUNCTIONS                              *
+ ******************************************************************************/
+
+/* One rectangle: a block is one line, block repeat walks the lines and the
+ * address update values skip the gap between the end of a line and the
+ * start of the next one */
+static HAL_StatusTypeDef BuildNode(MDMA_LinkNodeTypeDef *node, const BSP_MDMA_Rect_t *rect)
+{
+    uint32_t src = (uint32_t)rect->src;
+    uint32_t dst = (uint32_t)rect->dst;
+    uint32_t align = src | dst | rect->width | rect->src_stride | rect->dst_stride;
+    uint32_t size;
+
+    if ((rect->width == 0U) || (rect->width > BSP_MDMA_MAX_WIDTH) ||
+        (rect->lines == 0U) || (rect->lines > BSP_MDMA_MAX_LINES) ||
+        (rect->src_stride < rect->width) || (rect->dst_stride < rect->width) ||
+        ((rect->src_stride - rect->width) > BSP_MDMA_MAX_GAP) ||
+        ((rect->dst_stride - rect->width) > BSP_MDMA_MAX_GAP))
+    {
+        return HAL_ERROR;
+    }
+
+    if ((align & 3U) == 0U)
+    {
+        size = MDMA_SRC_INC_WORD | MDMA_SRC_DATASIZE_WORD |
+                MDMA_DEST_INC_WORD | MDMA_DEST_DATASIZE_WORD;
+    }
+    else if ((align & 1U) == 0U)
+    {
+        size = MDMA_SRC_INC_HALFWORD | MDMA_SRC_DATASIZE_HALFWORD |
+                MDMA_DEST_INC_HALFWORD | MDMA_DEST_DATASIZE_HALFWORD;
+    }
+    else
+    {
+        size = MDMA_SRC_INC_BYTE | MDMA_SRC_DATASIZE_BYTE |
+                MDMA_DEST_INC_BYTE | MDMA_DEST_DATASIZE_BYTE;
+    }
+
+    /* Software request, one request runs the whole list */
+    node->CTCR = size | MDMA_CTCR_SWRM | MDMA_CTCR_BWM | MDMA_FULL_TRANSFER |
+            ((MDMA_TLEN_BYTES - 1U) << MDMA_CTCR_TLEN_Pos);
+    node->CBNDTR = rect->width | ((rect->lines - 1U) << MDMA_CBNDTR_BRC_Pos);
+    node->CSAR = src;
+    node->CDAR = dst;
+    node->CBRUR = (rect->src_stride - rect->width) |
+            ((rect->dst_stride - rect->width) << MDMA_CBRUR_DUV_Pos);
+    node->CTBR = (MDMA_IS_TCM(src) ? MDMA_CTBR_SBUS : 0U) |
+            (MDMA_IS_TCM(dst) ? MDMA_CTBR_DBUS : 0U);
+    node->Reserved = 0U;
+    node->CMAR = 0U;
+    node->CMDR = 0U;
+    return HAL_OK;
+}
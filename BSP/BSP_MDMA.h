@@ -0,0 +1,86 @@
+/*
+ * BSP_MDMA.h
+ * MDMA strided copy service
+ *
+ * Copies rectangles (lines of 'width' bytes, separate source and destination
+ * line strides) without the CPU: every rectangle is one MDMA linked list node
+ * using the block repeat address update to jump from line to line, a job is
+ * a chain of such nodes started with a single software request. Typical use:
+ * camera frame or strip into the 800 pixel wide LCD framebuffer.
+ */
+
+#ifndef BSP_MDMA_H_
+#define BSP_MDMA_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "main.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+#define BSP_MDMA_CHANNEL                         MDMA_Channel0
+#define BSP_MDMA_PRIORITY                        MDMA_PRIORITY_HIGH
+#define BSP_MDMA_IRQ_PRIORITY                    (5U)
+/* Rectangles per job */
+#define BSP_MDMA_MAX_NODES                       (16U)
+
+/* Hardware limits of one rectangle */
+#define BSP_MDMA_MAX_WIDTH                       (65535U)    /* CBNDTR.BNDT */
+#define BSP_MDMA_MAX_LINES                       (4096U)     /* CBNDTR.BRC + 1 */
+#define BSP_MDMA_MAX_GAP                         (65535U)    /* CBRUR.SUV/DUV */
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    const void  *src;
+    void        *dst;
+    uint32_t    src_stride;       /* bytes from line to line, >= width */
+    uint32_t    dst_stride;
+    uint32_t    width;            /* bytes per line */
+    uint32_t    lines;
+} BSP_MDMA_Rect_t;
+
+/* Job completion, called from the MDMA interrupt */
+typedef void (*BSP_MDMA_Cb_t)(HAL_StatusTypeDef status, void *user);
+
+typedef struct
+{
+    uint32_t    jobs;             /* jobs completed */
+    uint32_t    nodes;            /* rectangles completed */
+    uint32_t    bytes;            /* bytes copied */
+    uint32_t    busy;             /* requests refused, previous job running */
+    uint32_t    errors;           /* transfer errors */
+    uint32_t    last_error;       /* CESR of the last error */
+} BSP_MDMA_Stats_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+extern void BSP_MDMA_Init(void);
+
+/* Start a job, cb may be NULL. HAL_BUSY while the previous job runs,
+ * HAL_ERROR if a rectangle exceeds the limits above. Data size is picked per
+ * rectangle (word, half word or byte) from address/width/stride alignment.
+ * With the D-cache enabled the caller cleans the source and invalidates the
+ * destination. */
+extern HAL_StatusTypeDef BSP_MDMA_CopyList(const BSP_MDMA_Rect_t *rects, uint32_t count,
+        BSP_MDMA_Cb_t cb, void *user);
+extern HAL_StatusTypeDef BSP_MDMA_Copy2D(const BSP_MDMA_Rect_t *rect, BSP_MDMA_Cb_t cb, void *user);
+
+extern uint8_t BSP_MDMA_isBusy(void);
+/* Polls until the running job completes, HAL_TIMEOUT after timeout_ms */
+extern HAL_StatusTypeDef BSP_MDMA_Wait(uint32_t timeout_ms);
+extern const BSP_MDMA_Stats_t* BSP_MDMA_GetStats(void);
+
+/* Shall be called from MDMA_IRQHandler() */
+extern void BSP_MDMA_IRQHandler(void);
+
+#endif /* BSP_MDMA_H_ */
@@ -138,6 +138,24 @@ uint32_t BSP_LCD_GetYSize(void)
   return hLtdcHandler.LayerCfg[ActiveLayer].ImageHeight;
 }
 
+/**
+  * @brief  Gets the framebuffer address of the active layer.
+  * @retval Framebuffer start address
+  */
+uint32_t BSP_LCD_GetLayerAddress(void)
+{
+  return hLtdcHandler.LayerCfg[ActiveLayer].FBStartAdress;
+}
+
+/**
+  * @brief  Gets the pixel format of the active layer.
+  * @retval LTDC_PIXEL_FORMAT_xxx
+  */
+uint32_t BSP_LCD_GetPixelFormat(void)
+{
+  return hLtdcHandler.LayerCfg[ActiveLayer].PixelFormat;
+}
+
 
 /**
   * @brief  Selects the LCD Layer.
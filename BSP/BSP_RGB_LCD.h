@@ -118,6 +118,8 @@ uint8_t  BSP_LCD_Init(void);
 
 uint32_t BSP_LCD_GetXSize(void);
 uint32_t BSP_LCD_GetYSize(void);
+uint32_t BSP_LCD_GetLayerAddress(void);
+uint32_t BSP_LCD_GetPixelFormat(void);
 
 
 /* Functions using the LTDC controller */
@@ -14,6 +14,9 @@
 //#include "StateM.h"
 #include "dcmi.h"
 #include "i2c.h"
+#include "ov7670_sccb.h"
+#include "ov7670_tlm.h"
+#include "ov7670_roi.h"
 
 
 /******************************************************************************
@@ -33,7 +36,7 @@
 #define OV7670_FRAME_SIZE_BYTES       (OV7670_WIDTH * OV7670_HEIGHT * OV7670_RGB565_BYTES)
 #define OV7670_FRAME_SIZE_WORDS       (OV7670_FRAME_SIZE_BYTES / 4U)
 
-#if (OV7670_STREAM_MODE != OV7670_STREAM_MODE_BY_FRAME)
+#if (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_LINE)
 #define DISPLAY_BUFFER_ADDR			  (0xD0000000)
 #endif
 #define DISPLAY_WIDTH_SIZE_BYTES      (DISPLAY_WIDTH * OV7670_RGB565_BYTES)
@@ -96,6 +99,14 @@
     }while(0)
 #endif
 
+#elif (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_STRIP)
+/* Circular buffer of two strips, DMA half/full transfer ends a strip */
+#define OV7670_BUFFER_SIZE_BYTES       (OV7670_WIDTH_SIZE_BYTES * OV7670_STRIP_LINES * 2U)
+#define OV7670_DMA_DATA_LEN            (OV7670_BUFFER_SIZE_BYTES / 4U)
+
+#define OV7670_START_XLK(htim, channel)
+#define OV7670_STOP_XLK(htim, channel)
+
 #else
 /* For whole-size snapshot buffer */
 #define OV7670_BUFFER_SIZE_BYTES       (OV7670_FRAME_SIZE_BYTES)
@@ -200,6 +211,22 @@ const uint8_t OV7670_reg[][2] =
 //{OV7670_REG_COM17,            0x08},         // Test screen with color bars
   {OV7670_REG_DUMMY,            OV7670_REG_DUMMY},
 };
+
+/* Hardware reset pulse, released by the init state machine */
+static const uint8_t OV7670_reset_low[][2] =
+{
+  {OV7670_SCCB_DELAY,           100},
+  {OV7670_REG_DUMMY,            OV7670_REG_DUMMY},
+};
+
+/* Wait after reset release, then software reset */
+static const uint8_t OV7670_reset_seq[][2] =
+{
+  {OV7670_SCCB_DELAY,           100},
+  {OV7670_REG_COM7,             0x80},         // SCCB register reset
+  {OV7670_SCCB_DELAY,           30},
+  {OV7670_REG_DUMMY,            OV7670_REG_DUMMY},
+};
 /******************************************************************************
  *                           LOCAL DATA TYPES                                 *
  ******************************************************************************/
@@ -210,6 +237,9 @@ const uint8_t OV7670_reg[][2] =
  /* Draw frame callback type */
  typedef void (*drawFrame_cb_t)(const uint8_t *buffer, uint32_t buf_size);
 
+ /* Strip callback type */
+ typedef void (*drawStrip_cb_t)(const uint8_t *strip, uint32_t size, uint16_t y, uint16_t lines);
+
 enum
 {
     FALSE, TRUE
@@ -220,6 +250,25 @@ enum
     BUSY, READY
 };
 
+/* Frame mode: capture restart kept back by the frame callback */
+enum
+{
+    HOLD_NONE,
+    HOLD_REQUESTED,               /* by the running frame callback */
+    HOLD_ACTIVE,                  /* DCMI stopped until OV7670_ReleaseFrame() */
+};
+
+/* Background initialization steps */
+enum
+{
+    INIT_IDLE,
+    INIT_RESET_LOW,
+    INIT_SOFT_RESET,
+    INIT_READ_ID,
+    INIT_CONFIG,
+    INIT_DONE,
+};
+
 /******************************************************************************
  *                         LOCAL DATA PROTOTYPES                              *
  ******************************************************************************/
@@ -239,10 +288,18 @@ static struct
     volatile uint32_t   lineCnt;
     /* Driver status */
     volatile uint8_t    state;
+    volatile uint8_t    hold;
     /* Draw line callback prototype */
     drawLine_cb_t       drawLine_cb;
     /* Draw frame callback prototype */
     drawFrame_cb_t      drawFrame_cb;
+    /* Strip callback prototype and strip size of the running frame */
+    drawStrip_cb_t      drawStrip_cb;
+    uint32_t            strip_bytes;
+    /* Background initialization */
+    volatile uint8_t    init_state;
+    OV7670_FncPtr_t     initDone_cb;
+    OV7670_BootInfo_t   boot;
 } OV7670 = {
 		.hdcmi = &hdcmi,
 		.hi2c = &hi2c_dcmi,
@@ -269,58 +326,84 @@ uint32_t DCMI_IER;
 static HAL_StatusTypeDef SCCB_Write(uint8_t regAddr, uint8_t data);
 static HAL_StatusTypeDef SCCB_Read(uint8_t regAddr, uint8_t *data);
 static uint8_t isFrameCaptured(void);
+static void InitStep(HAL_StatusTypeDef status);
+static void InitEnd(HAL_StatusTypeDef status);
+#if (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_FRAME)
+static void FrameRestart(void);
+#endif
+#if (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_STRIP)
+static void StripStart(void);
+static void StripDeliver(uint32_t half, uint32_t lines);
+static void StripHalfCplt(DMA_HandleTypeDef *hdma);
+static void StripCplt(DMA_HandleTypeDef *hdma);
+static void StripError(DMA_HandleTypeDef *hdma);
+#endif
 
 /******************************************************************************
  *                              GLOBAL FUNCTIONS                              *
  ******************************************************************************/
 
 void OV7670_Init(DCMI_HandleTypeDef *hdcmi, I2C_HandleTypeDef *hi2c, TIM_HandleTypeDef *htim, uint32_t tim_ch)
+{
+    OV7670_InitAsync(hdcmi, hi2c, htim, tim_ch, NULL);
+    while (!OV7670_isInitDone())
+    {
+        OV7670_SCCB_Task();
+    }
+    DebugPrint("[OV7670] dev id = 0x%02X", OV7670.boot.dev_id);
+}
+
+void OV7670_InitAsync(DCMI_HandleTypeDef *hdcmi, I2C_HandleTypeDef *hi2c, TIM_HandleTypeDef *htim,
+        uint32_t tim_ch, OV7670_FncPtr_t initDone_cb)
 {
     OV7670.hdcmi = hdcmi;
     OV7670.hi2c = hi2c;
     OV7670.htim = htim;
     OV7670.tim_ch = tim_ch;
+    OV7670.initDone_cb = initDone_cb;
+    OV7670.boot.init_start = HAL_GetTick();
+    OV7670.boot.first_frame = 0U;
+
+    OV7670_SCCB_Init(hi2c);
+    OV7670_TLM_Init();
+    OV7670_ROI_Init();
 
     /* PWDN to LOW */
     HAL_GPIO_WritePin(OV7670_GPIO_PORT_PWDN, OV7670_GPIO_PIN_PWDN, GPIO_PIN_RESET);
     /* RET pin to LOW */
     HAL_GPIO_WritePin(OV7670_GPIO_PORT_RET, OV7670_GPIO_PIN_RET, GPIO_PIN_RESET);
-    OV7670_DELAY(100);
-    /* RET pin to HIGH */
-    HAL_GPIO_WritePin(OV7670_GPIO_PORT_RET, OV7670_GPIO_PIN_RET, GPIO_PIN_SET);
-    OV7670_DELAY(100);
 
-    /* Start camera XLK signal to be able to do initialization */
-    if (OV7670.htim!=0)
+    /* The rest runs from SCCB/SysTick interrupts, see InitStep() */
+    OV7670.init_state = INIT_RESET_LOW;
+    if (OV7670_SCCB_StartList(OV7670_reset_low, FALSE, InitStep) != HAL_OK)
     {
-        OV7670_START_XLK(OV7670.htim, OV7670.tim_ch);
+        InitEnd(HAL_BUSY);
     }
+}
 
-    /* Do camera reset */
-    SCCB_Write(OV7670_REG_COM7, 0x80);
-    OV7670_DELAY(30);
-
-    /* Get camera ID */
-    uint8_t buf[4];
-    SCCB_Read(OV7670_REG_VER, buf);
-    DebugPrint("[OV7670] dev id = 0x%02X", buf[0]);
-
-    /* Do camera reset */
-    SCCB_Write(OV7670_REG_COM7, 0x80);
-    OV7670_DELAY(30);
+uint8_t OV7670_isInitDone(void)
+{
+    return (OV7670.init_state == INIT_DONE) ? TRUE : FALSE;
+}
 
-    /* Do camera configuration */
-    for (uint32_t i = 0; OV7670_reg[i][0] != OV7670_REG_DUMMY; i++)
-    {
-        SCCB_Write(OV7670_reg[i][0], OV7670_reg[i][1]);
-        OV7670_DELAY(1);
-    }
-    /* Stop camera XLK signal */
-    if (OV7670.htim!=0)
-    {
-        OV7670_STOP_XLK(OV7670.htim, OV7670.tim_ch);
-    }
+/* Boot to first frame, from the code and the 100 kHz I2C2 timing
+ * (0x20303E5D on a 48 MHz PCLK1: 0.29 ms per register write, 0.4 ms per
+ * readback); debug command "Z8" prints the board figures.
+ *  - Before: OV7670_Init() ran after the splash and blocked for
+ *    100 + 100 + 30 + 30 ms of HAL_Delay, plus 69 registers at
+ *    0.29 ms + HAL_Delay(1) (1 to 2 ms) each: 350 to 425 ms added to the
+ *    boot, then the first VSYNC.
+ *  - After: the queue needs 100 + 100 + 30 ms of tick waits plus 69
+ *    verified registers at 0.7 ms each, about 280 ms from
+ *    OV7670_InitAsync(). That runs under BSP_LCD_Init() and the 1 s splash,
+ *    so main() finds INIT_DONE and waits 0 ms before OV7670_Start(). */
+const OV7670_BootInfo_t* OV7670_GetBootInfo(void)
+{
+    return &OV7670.boot;
+}
 
+static void OV7670_InitFinish(void)
+{
     /* Initialize buffer address */
 #ifdef	DISPLAY_BUFFER_ADDR
     OV7670.buffer_addr = (uint32_t) DISPLAY_BUFFER_ADDR;
@@ -342,7 +425,7 @@ void OV7670_Init(DCMI_HandleTypeDef *hdcmi, I2C_HandleTypeDef *hi2c, TIM_HandleT
     /* Configure DMA Stream data length */
     WRITE_REG(OV7670.hdcmi->DMA_Handle->Instance->NDTR, OV7670_DMA_DATA_LEN);
     /* Configure DMA Stream source address */
-    WRITE_REG(OV7670.hdcmi->DMA_Handle->Instance->PAR, (uint32_t) &hdcmi->Instance->DR);
+    WRITE_REG(OV7670.hdcmi->DMA_Handle->Instance->PAR, (uint32_t) &OV7670.hdcmi->Instance->DR);
     /* Configure DMA Stream destination address */
     WRITE_REG(OV7670.hdcmi->DMA_Handle->Instance->M0AR, OV7670.buffer_addr);
     /* Clear all DMA interrupt flags */
@@ -356,6 +439,84 @@ void OV7670_Init(DCMI_HandleTypeDef *hdcmi, I2C_HandleTypeDef *hi2c, TIM_HandleT
 #endif
 }
 
+/* Init sequencer, called on SCCB job completion (interrupt context).
+ * A failed step or a refused start ends the chain with that status. */
+static void InitStep(HAL_StatusTypeDef status)
+{
+    HAL_StatusTypeDef ret = HAL_OK;
+
+    if (status != HAL_OK)
+    {
+        InitEnd(status);
+        return;
+    }
+
+    switch (OV7670.init_state)
+    {
+        case INIT_RESET_LOW:
+        {
+            /* RET pin to HIGH */
+            HAL_GPIO_WritePin(OV7670_GPIO_PORT_RET, OV7670_GPIO_PIN_RET, GPIO_PIN_SET);
+            /* Start camera XLK signal to be able to do initialization */
+            if (OV7670.htim!=0)
+            {
+                OV7670_START_XLK(OV7670.htim, OV7670.tim_ch);
+            }
+            OV7670.init_state = INIT_SOFT_RESET;
+            ret = OV7670_SCCB_StartList(OV7670_reset_seq, FALSE, InitStep);
+            break;
+        }
+
+        case INIT_SOFT_RESET:
+        {
+            /* Get camera ID */
+            OV7670.init_state = INIT_READ_ID;
+            ret = OV7670_SCCB_StartRead(OV7670_REG_VER, &OV7670.boot.dev_id, InitStep);
+            break;
+        }
+
+        case INIT_READ_ID:
+        {
+            /* Do camera configuration, every register is read back */
+            OV7670.init_state = INIT_CONFIG;
+            ret = OV7670_SCCB_StartList(OV7670_reg, TRUE, InitStep);
+            break;
+        }
+
+        case INIT_CONFIG:
+        {
+            InitEnd(HAL_OK);
+            break;
+        }
+
+        default:
+            break;
+    }
+
+    if (ret != HAL_OK)
+    {
+        InitEnd(ret);
+    }
+}
+
+/* Last step, or the first one that failed */
+static void InitEnd(HAL_StatusTypeDef status)
+{
+    /* Stop camera XLK signal */
+    if (OV7670.htim!=0)
+    {
+        OV7670_STOP_XLK(OV7670.htim, OV7670.tim_ch);
+    }
+    OV7670_InitFinish();
+    OV7670.boot.init_status = status;
+    OV7670.boot.init_done = HAL_GetTick();
+    OV7670.init_state = INIT_DONE;
+    if (OV7670.initDone_cb != NULL)
+    {
+        OV7670.initDone_cb();
+    }
+}
+
 void OV7670_Start(void)
 {
     __disable_irq();
@@ -369,6 +530,7 @@ void OV7670_Start(void)
     /* Reset line counter */
     OV7670.lineCnt = 0U;
     OV7670.state = BUSY;
+    OV7670.hold = HOLD_NONE;
     __enable_irq();
     /* Start camera XLK signal to capture the image data */
     if (OV7670.htim!=0)
@@ -378,9 +540,17 @@ void OV7670_Start(void)
     /* Start DCMI capturing */
 #if (OV7670_USE_DMA_CMSIS == 1)
     OV7670_DCMI_DMA_START(OV7670.hdcmi, OV7670.buffer_addr);
+#elif (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_FRAME)
+    OV7670_ROI_Latch(OV7670.hdcmi);
+    HAL_DCMI_Start_DMA(OV7670.hdcmi, DCMI_MODE_CONTINUOUS, OV7670.buffer_addr,
+            OV7670_ROI_GetGeometry()->frame_words);
+#elif (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_STRIP)
+    OV7670_ROI_Latch(OV7670.hdcmi);
+    StripStart();
 #else
     HAL_DCMI_Start_DMA(OV7670.hdcmi, DCMI_MODE_CONTINUOUS, OV7670.buffer_addr, OV7670_DMA_DATA_LEN);
 #endif
+    OV7670_TLM_CaptureStart();
 }
 
 void OV7670_Stop(void)
@@ -416,6 +586,12 @@ void OV7670_RegisterCallback(OV7670_CB_t cb_type, OV7670_FncPtr_t fnc_ptr)
             break;
         }
 
+        case OV7670_STRIP_CBK:
+        {
+            OV7670.drawStrip_cb = (drawStrip_cb_t)fnc_ptr;
+            break;
+        }
+
         default:
             break;
     }
@@ -427,14 +603,34 @@ uint8_t OV7670_isDriverBusy(void)
 {
     uint8_t retVal;
     __disable_irq();
-    uint32_t _line_counter = line_counter;
     retVal = (OV7670.state == BUSY) ? TRUE : FALSE;
     __enable_irq();
-    DebugPrint("\r\n line_counter=%8ld %8ld %8ld %8lX %8lX",
-    		_line_counter, frame_counter, OV7670.lineCnt, buf_addr, DCMI_IER);
     return retVal;
 }
 
+#if (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_FRAME)
+
+void OV7670_HoldFrame(void)
+{
+    OV7670.hold = HOLD_REQUESTED;
+}
+
+void OV7670_ReleaseFrame(void)
+{
+    uint8_t restart;
+
+    __disable_irq();
+    restart = ((OV7670.hold == HOLD_ACTIVE) && (OV7670.state == BUSY)) ? TRUE : FALSE;
+    OV7670.hold = HOLD_NONE;
+    __enable_irq();
+    if (restart)
+    {
+        FrameRestart();
+    }
+}
+
+#endif
+
 
 /******************************************************************************
  *                               HAL CALLBACKS                                *
@@ -446,6 +642,12 @@ uint8_t OV7670_isDriverBusy(void)
 
 void HAL_DCMI_VsyncEventCallback(DCMI_HandleTypeDef *hdcmi)
 {
+    OV7670_TLM_Vsync();
+    if (OV7670.boot.first_frame == 0U)
+    {
+        OV7670.boot.first_frame = HAL_GetTick();
+    }
+
     /* Disable DCMI Camera interface */
     HAL_DCMI_Stop(OV7670.hdcmi);
 
@@ -458,19 +660,59 @@ void HAL_DCMI_VsyncEventCallback(DCMI_HandleTypeDef *hdcmi)
     /* Call Display flush function */
     if (OV7670.drawFrame_cb != NULL)
     {
-        OV7670.drawFrame_cb((uint8_t*) OV7670.buffer_addr, OV7670_FRAME_SIZE_BYTES);
+        uint32_t cb_start = OV7670_TLM_NOW();
+        OV7670.drawFrame_cb((uint8_t*) OV7670.buffer_addr, OV7670_ROI_GetGeometry()->frame_bytes);
+        OV7670_TLM_Deliver(cb_start);
     }
 
     /* Reset line counter */
     OV7670.lineCnt = 0U;
-    //TODO: check for full-size QVGA buffer mode
-    HAL_DCMI_Start_DMA(OV7670.hdcmi, DCMI_MODE_CONTINUOUS, OV7670.buffer_addr,
-            OV7670_FRAME_SIZE_WORDS);
+    /* The callback still reads the buffer: OV7670_ReleaseFrame() restarts */
+    if (OV7670.hold == HOLD_REQUESTED)
+    {
+        OV7670.hold = HOLD_ACTIVE;
+        return;
+    }
+    FrameRestart();
 }
 
 void HAL_DCMI_FrameEventCallback(DCMI_HandleTypeDef *hdcmi)
 {
     frame_counter++;
+    OV7670_TLM_FrameEnd(OV7670_ROI_GetGeometry()->out_height);
+}
+
+#elif (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_STRIP)
+
+void HAL_DCMI_VsyncEventCallback(DCMI_HandleTypeDef *hdcmi)
+{
+    uint32_t height = OV7670_ROI_GetGeometry()->out_height;
+
+    OV7670_TLM_Vsync();
+    if (OV7670.boot.first_frame == 0U)
+    {
+        OV7670.boot.first_frame = HAL_GetTick();
+    }
+
+    /* Full strips were delivered by the DMA interrupts, only a frame height
+     * that isn't a multiple of the strip leaves a partial one behind */
+    HAL_DCMI_Stop(OV7670.hdcmi);
+    frame_counter++;
+    OV7670_TLM_FrameEnd(height);
+    if ((OV7670.lineCnt < height) && ((height - OV7670.lineCnt) < OV7670_STRIP_LINES))
+    {
+        StripDeliver((OV7670.lineCnt / OV7670_STRIP_LINES) & 1U, height - OV7670.lineCnt);
+    }
+
+    /* Restart every frame: a lost line can't shift the strips for longer
+     * than one frame. A requested region takes effect here. */
+    OV7670_ROI_Latch(OV7670.hdcmi);
+    StripStart();
+    OV7670_TLM_CaptureStart();
+}
+
+void HAL_DCMI_FrameEventCallback(DCMI_HandleTypeDef *hdcmi)
+{
 }
 
 #else
@@ -593,6 +835,14 @@ void HAL_DCMI_LineEventCallback(DCMI_HandleTypeDef *hdcmi)
 
 #endif /* (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_LINE) */
 
+void HAL_DCMI_ErrorCallback(DCMI_HandleTypeDef *hdcmi)
+{
+    /* HAL only ever ORs into ErrorCode: consume it so every event counts once.
+     * Capture resumes on its own, the next VSYNC restarts the DMA. */
+    OV7670_TLM_Error(hdcmi->ErrorCode);
+    hdcmi->ErrorCode = HAL_DCMI_ERROR_NONE;
+}
+
 
 /******************************************************************************
  *                              LOCAL FUNCTIONS                               *
@@ -629,11 +879,13 @@ static HAL_StatusTypeDef SCCB_Read(uint8_t regAddr, uint8_t *data)
 
 HAL_StatusTypeDef ov7670_write(uint8_t regAddr, uint8_t data)
 {
+	if (OV7670_SCCB_isBusy()) return HAL_BUSY;
 	return SCCB_Write(regAddr, data);
 }
 
 HAL_StatusTypeDef ov7670_read(uint8_t regAddr, uint8_t *data)
 {
+	if (OV7670_SCCB_isBusy()) return HAL_BUSY;
 	return SCCB_Read(regAddr, data);
 }
 
@@ -646,4 +898,104 @@ static uint8_t isFrameCaptured(void)
     return retVal;
 }
 
+#if (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_FRAME)
+
+static void FrameRestart(void)
+{
+    /* A region requested meanwhile takes effect from this frame on */
+    OV7670_ROI_Latch(OV7670.hdcmi);
+    HAL_DCMI_Start_DMA(OV7670.hdcmi, DCMI_MODE_CONTINUOUS, OV7670.buffer_addr,
+            OV7670_ROI_GetGeometry()->frame_words);
+    OV7670_TLM_CaptureStart();
+}
+
+#endif
+
+
+
+#if (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_STRIP)
+
+/* Circular DMA over two strips; HAL_DCMI_Start_DMA() can't be used as it
+ * installs its own (frame oriented) DMA callbacks */
+static void StripStart(void)
+{
+    DCMI_HandleTypeDef *hdcmi = OV7670.hdcmi;
+    DMA_HandleTypeDef *hdma = hdcmi->DMA_Handle;
+
+    OV7670.strip_bytes = (uint32_t)OV7670_ROI_GetGeometry()->out_width *
+            OV7670_RGB565_BYTES * OV7670_STRIP_LINES;
+    OV7670.lineCnt = 0U;
+
+    if (hdma->Init.Mode != DMA_CIRCULAR)
+    {
+        hdma->Init.Mode = DMA_CIRCULAR;
+        (void)HAL_DMA_Init(hdma);
+    }
+    hdma->XferHalfCpltCallback = StripHalfCplt;
+    hdma->XferCpltCallback = StripCplt;
+    hdma->XferErrorCallback = StripError;
+    hdma->XferAbortCallback = NULL;
+
+    /* Strips are paced by the DMA, no need for an interrupt per line */
+    __HAL_DCMI_DISABLE_IT(hdcmi, DCMI_IT_LINE);
+    MODIFY_REG(hdcmi->Instance->CR, DCMI_CR_CM, DCMI_MODE_CONTINUOUS);
+    __HAL_DCMI_ENABLE(hdcmi);
+    if (HAL_DMA_Start_IT(hdma, (uint32_t)&hdcmi->Instance->DR, OV7670.buffer_addr,
+            (2U * OV7670.strip_bytes) / 4U) == HAL_OK)
+    {
+        hdcmi->State = HAL_DCMI_STATE_BUSY;
+        SET_BIT(hdcmi->Instance->CR, DCMI_CR_CAPTURE);
+    }
+}
+
+static void StripDeliver(uint32_t half, uint32_t lines)
+{
+    DMA_HandleTypeDef *hdma = OV7670.hdcmi->DMA_Handle;
+    uint32_t y = OV7670.lineCnt;
+    uint32_t overrun;
+    uint32_t cb_start;
+
+    /* More data than the frame holds: sync lost, wait for the VSYNC restart */
+    if (y + lines > OV7670_ROI_GetGeometry()->out_height)
+    {
+        return;
+    }
+    OV7670.lineCnt = y + lines;
+    if (OV7670.drawStrip_cb == NULL)
+    {
+        return;
+    }
+
+    cb_start = OV7670_TLM_NOW();
+    OV7670.drawStrip_cb((const uint8_t*)(OV7670.buffer_addr + half * OV7670.strip_bytes),
+            lines * (OV7670.strip_bytes / OV7670_STRIP_LINES), (uint16_t)y, (uint16_t)lines);
+    /* The DMA went on with the other half; once that one is complete too it
+     * writes into the strip that was just handed out */
+    if (half == 0U)
+    {
+        overrun = __HAL_DMA_GET_FLAG(hdma, __HAL_DMA_GET_TC_FLAG_INDEX(hdma));
+    }
+    else
+    {
+        overrun = __HAL_DMA_GET_FLAG(hdma, __HAL_DMA_GET_HT_FLAG_INDEX(hdma));
+    }
+    OV7670_TLM_Strip(cb_start, (overrun != 0U) ? TRUE : FALSE);
+}
+
+static void StripHalfCplt(DMA_HandleTypeDef *hdma)
+{
+    StripDeliver(0U, OV7670_STRIP_LINES);
+}
+
+static void StripCplt(DMA_HandleTypeDef *hdma)
+{
+    StripDeliver(1U, OV7670_STRIP_LINES);
+}
+
+static void StripError(DMA_HandleTypeDef *hdma)
+{
+    /* The next VSYNC restarts the DMA */
+    OV7670_TLM_Error(HAL_DCMI_ERROR_DMA);
+}
 
+#endif /* (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_STRIP) */
@@ -26,8 +26,17 @@
 
 #define OV7670_STREAM_MODE_BY_FRAME              0
 #define OV7670_STREAM_MODE_BY_LINE               1
+#define OV7670_STREAM_MODE_BY_STRIP              2
 #define OV7670_STREAM_MODE                       OV7670_STREAM_MODE_BY_FRAME
 
+/* Lines per strip in OV7670_STREAM_MODE_BY_STRIP: the circular DMA buffer
+ * holds two strips, one is processed while the other one is filled.
+ * Strip mode only supports the display path (OV7670_STRIP_CBK): no whole
+ * frame is ever in memory, so OV7670_DRAWFRAME_CBK is not called and the
+ * frame based processing (stats, motion, blob, background, recorder,
+ * snapshot) is unavailable. */
+#define OV7670_STRIP_LINES                       (8U)
+
 /* Delay API */
 #define OV7670_DELAY(ms)                         HAL_Delay(ms)
 
@@ -522,10 +531,27 @@ typedef enum
 {
     OV7670_DRAWLINE_CBK,
     OV7670_DRAWFRAME_CBK,
+    OV7670_STRIP_CBK,
 } OV7670_CB_t;
 
+/* OV7670_STRIP_CBK, called from the DMA interrupt for each completed strip:
+ * void cb(const uint8_t *strip, uint32_t size, uint16_t y, uint16_t lines);
+ * y is the first frame line of the strip, the last strip of a frame may be
+ * shorter. The data stays valid until the next strip completes. */
+
 typedef void (*OV7670_FncPtr_t)(void);
 
+/* Boot timing, all values are HAL_GetTick() milliseconds since reset */
+typedef struct
+{
+    uint32_t            init_start;     /* OV7670_InitAsync() called */
+    uint32_t            init_done;      /* last register programmed, or failure */
+    uint32_t            first_frame;    /* first VSYNC after OV7670_Start() */
+    HAL_StatusTypeDef   init_status;    /* first failure: HAL_ERROR (reset, ID read or a
+                                           register), HAL_BUSY (SCCB queue refused) */
+    uint8_t             dev_id;         /* OV7670_REG_VER */
+} OV7670_BootInfo_t;
+
 
 /******************************************************************************
  *                      GLOBAL FUNCTIONS PROTOTYPES                           *
@@ -533,10 +559,22 @@ typedef void (*OV7670_FncPtr_t)(void);
 
 extern void OV7670_Init(DCMI_HandleTypeDef *hdcmi, I2C_HandleTypeDef *hi2c,
         TIM_HandleTypeDef* htim, uint32_t tim_ch);
+extern void OV7670_InitAsync(DCMI_HandleTypeDef *hdcmi, I2C_HandleTypeDef *hi2c,
+        TIM_HandleTypeDef* htim, uint32_t tim_ch, OV7670_FncPtr_t initDone_cb);
+extern uint8_t OV7670_isInitDone(void);
+extern const OV7670_BootInfo_t* OV7670_GetBootInfo(void);
 extern void OV7670_RegisterCallback(OV7670_CB_t cb_type, OV7670_FncPtr_t fnc_ptr);
 extern uint8_t OV7670_isDriverBusy(void);
 extern void OV7670_Start(void);
 extern void OV7670_Stop(void);
+#if (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_FRAME)
+/* From the OV7670_DRAWFRAME_CBK: the capture stays stopped after the callback
+ * returns, so the buffer can still be read (e.g. by a DMA), until
+ * OV7670_ReleaseFrame(), from any context. The frames starting meanwhile are
+ * not captured. */
+extern void OV7670_HoldFrame(void);
+extern void OV7670_ReleaseFrame(void);
+#endif
 
 /******************************************************************************
  *                  HAL callbacks for DCMI_IRQHandler                         *
@@ -548,6 +586,7 @@ extern void HAL_DCMI_FrameEventCallback(DCMI_HandleTypeDef *hdcmi);
 #else  /* (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_LINE) */
 extern void HAL_DCMI_LineEventCallback(DCMI_HandleTypeDef *hdcmi);
 #endif /* (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_LINE) */
+extern void HAL_DCMI_ErrorCallback(DCMI_HandleTypeDef *hdcmi);
 
 HAL_StatusTypeDef ov7670_write(uint8_t regAddr, uint8_t data);
 HAL_StatusTypeDef ov7670_read(uint8_t regAddr, uint8_t *data);
@@ -0,0 +1,329 @@
+/*
+ * ov7670_roi.c
+ * OV7670 region of interest capture
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "main.h"
+#include "OV7670.h"
+#include "ov7670_sccb.h"
+#include "ov7670_roi.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define ROI_BYTES_PER_PIXEL           (2U)
+#define ROI_FULL_FRAME_BYTES          (OV7670_WIDTH * OV7670_HEIGHT * ROI_BYTES_PER_PIXEL)
+/* Sensor window granularity, QVGA pixels/lines (one HSTART/VSTRT step) */
+#define ROI_SENSOR_HALIGN             (4U)
+#define ROI_SENSOR_VALIGN             (2U)
+
+/******************************************************************************
+ *                          LOCAL DATA TYPES                                  *
+ ******************************************************************************/
+
+enum
+{
+    FALSE, TRUE
+};
+
+typedef enum
+{
+    ROI_IDLE,                     /* nothing to latch */
+    ROI_SENSOR,                   /* sensor window being written */
+    ROI_READY,                    /* latch at the next VSYNC */
+} ROI_State_t;
+
+typedef struct
+{
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+} ROI_Window_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    OV7670_ROI_t            active;
+    OV7670_ROI_Geometry_t   geo;
+    OV7670_ROI_t            pending;
+    OV7670_ROI_Geometry_t   pending_geo;
+    ROI_Window_t            sensor;         /* window programmed in the sensor */
+    ROI_Window_t            sensor_req;     /* window of the running SCCB job */
+    volatile ROI_State_t    state;
+} ROI;
+
+/* HSTART, HSTOP, HREF, VSTRT, VSTOP, VREF */
+static uint8_t ROI_SensorRegs[7][2];
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static uint8_t isRoiValid(const OV7670_ROI_t *roi);
+static void CalcGeometry(const OV7670_ROI_t *roi, OV7670_ROI_Geometry_t *geo, ROI_Window_t *win);
+static void BuildSensorRegs(const ROI_Window_t *win);
+static void SensorDone(HAL_StatusTypeDef status);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void OV7670_ROI_Init(void)
+{
+    ROI.sensor.x = 0U;
+    ROI.sensor.y = 0U;
+    ROI.sensor.w = OV7670_WIDTH;
+    ROI.sensor.h = OV7670_HEIGHT;
+    ROI.state = ROI_IDLE;
+    OV7670_ROI_SetFull();
+    /* Until the first latch the geometry is already the full frame one */
+    ROI.active = ROI.pending;
+    ROI.geo = ROI.pending_geo;
+}
+
+HAL_StatusTypeDef OV7670_ROI_Set(const OV7670_ROI_t *roi)
+{
+    OV7670_ROI_Geometry_t geo;
+    ROI_Window_t win;
+    HAL_StatusTypeDef status = HAL_OK;
+
+    if (!isRoiValid(roi))
+    {
+        return HAL_ERROR;
+    }
+    CalcGeometry(roi, &geo, &win);
+
+    __disable_irq();
+    if (ROI.state == ROI_SENSOR)
+    {
+        status = HAL_BUSY;
+    }
+    else
+    {
+        ROI.pending = *roi;
+        ROI.pending_geo = geo;
+        if ((win.x != ROI.sensor.x) || (win.y != ROI.sensor.y) ||
+            (win.w != ROI.sensor.w) || (win.h != ROI.sensor.h))
+        {
+            ROI.sensor_req = win;
+            ROI.state = ROI_SENSOR;
+        }
+        else
+        {
+            ROI.state = ROI_READY;
+        }
+    }
+    __enable_irq();
+
+    if ((status == HAL_OK) && (ROI.state == ROI_SENSOR))
+    {
+        BuildSensorRegs(&win);
+        status = OV7670_SCCB_StartList((const uint8_t (*)[2])ROI_SensorRegs, TRUE, SensorDone);
+        if (status != HAL_OK)
+        {
+            ROI.state = ROI_IDLE;
+        }
+    }
+    return status;
+}
+
+void OV7670_ROI_SetFull(void)
+{
+    OV7670_ROI_t roi =
+    {
+        .x = 0U,
+        .y = 0U,
+        .width = OV7670_WIDTH,
+        .height = OV7670_HEIGHT,
+        .hdec = 1U,
+        .vdec = 1U,
+        .sensor_window = FALSE,
+    };
+    (void)OV7670_ROI_Set(&roi);
+}
+
+void OV7670_ROI_Get(OV7670_ROI_t *roi)
+{
+    __disable_irq();
+    *roi = ROI.active;
+    __enable_irq();
+}
+
+const OV7670_ROI_Geometry_t* OV7670_ROI_GetGeometry(void)
+{
+    return &ROI.geo;
+}
+
+uint8_t OV7670_ROI_isPending(void)
+{
+    return (ROI.state != ROI_IDLE) ? TRUE : FALSE;
+}
+
+void OV7670_ROI_Latch(DCMI_HandleTypeDef *hdcmi)
+{
+    const OV7670_ROI_Geometry_t *geo = &ROI.pending_geo;
+    const OV7670_ROI_t *roi = &ROI.pending;
+
+    if (ROI.state != ROI_READY)
+    {
+        return;
+    }
+
+    /* Byte select keeps 2 bytes out of 4 (one RGB565 pixel out of two),
+     * line select one line out of two; both start at the first one */
+    hdcmi->Init.ByteSelectMode = (roi->hdec == 2U) ? DCMI_BSM_ALTERNATE_2 : DCMI_BSM_ALL;
+    hdcmi->Init.ByteSelectStart = DCMI_OEBS_ODD;
+    hdcmi->Init.LineSelectMode = (roi->vdec == 2U) ? DCMI_LSM_ALTERNATE_2 : DCMI_LSM_ALL;
+    hdcmi->Init.LineSelectStart = DCMI_OELS_ODD;
+    MODIFY_REG(hdcmi->Instance->CR,
+            DCMI_CR_BSM | DCMI_CR_OEBS | DCMI_CR_LSM | DCMI_CR_OELS,
+            hdcmi->Init.ByteSelectMode | hdcmi->Init.ByteSelectStart |
+            hdcmi->Init.LineSelectMode | hdcmi->Init.LineSelectStart);
+
+    /* The crop window counts pixel clocks (two per RGB565 pixel) and lines
+     * of the sensor output, i.e. before byte/line select */
+    if ((geo->crop_x == 0U) && (geo->crop_y == 0U) &&
+        (roi->width == geo->sensor_width) && (roi->height == geo->sensor_height))
+    {
+        (void)HAL_DCMI_DisableCrop(hdcmi);
+    }
+    else
+    {
+        (void)HAL_DCMI_ConfigCrop(hdcmi,
+                (uint32_t)geo->crop_x * ROI_BYTES_PER_PIXEL, geo->crop_y,
+                (uint32_t)roi->width * ROI_BYTES_PER_PIXEL - 1U, roi->height - 1U);
+        (void)HAL_DCMI_EnableCrop(hdcmi);
+    }
+
+    ROI.active = *roi;
+    ROI.geo = *geo;
+    ROI.state = ROI_IDLE;
+}
+
+uint32_t OV7670_ROI_BytesPerSec(uint32_t fps_x100)
+{
+    return (uint32_t)(((uint64_t)ROI.geo.frame_bytes * fps_x100) / 100U);
+}
+
+uint32_t OV7670_ROI_FullBytesPerSec(uint32_t fps_x100)
+{
+    return (uint32_t)(((uint64_t)ROI_FULL_FRAME_BYTES * fps_x100) / 100U);
+}
+
+/******************************************************************************
+ *                               LOCAL FUNCTIONS                              *
+ ******************************************************************************/
+
+static uint8_t isRoiValid(const OV7670_ROI_t *roi)
+{
+    if ((roi->hdec != 1U) && (roi->hdec != 2U))
+    {
+        return FALSE;
+    }
+    if ((roi->vdec != 1U) && (roi->vdec != 2U))
+    {
+        return FALSE;
+    }
+    if ((roi->width == 0U) || (roi->height == 0U) ||
+        ((uint32_t)roi->x + roi->width > OV7670_WIDTH) ||
+        ((uint32_t)roi->y + roi->height > OV7670_HEIGHT))
+    {
+        return FALSE;
+    }
+    /* Whole words per frame for the DMA: even output width */
+    if (((roi->width % (2U * roi->hdec)) != 0U) || ((roi->height % roi->vdec) != 0U))
+    {
+        return FALSE;
+    }
+    return TRUE;
+}
+
+static void CalcGeometry(const OV7670_ROI_t *roi, OV7670_ROI_Geometry_t *geo, ROI_Window_t *win)
+{
+    uint32_t x0 = 0U;
+    uint32_t y0 = 0U;
+    uint32_t x1 = OV7670_WIDTH;
+    uint32_t y1 = OV7670_HEIGHT;
+
+    if (roi->sensor_window)
+    {
+        /* Region plus margin, aligned out to the register granularity */
+        if (roi->x > OV7670_ROI_SENSOR_MARGIN)
+        {
+            x0 = (roi->x - OV7670_ROI_SENSOR_MARGIN) & ~(ROI_SENSOR_HALIGN - 1U);
+        }
+        if (roi->y > OV7670_ROI_SENSOR_MARGIN)
+        {
+            y0 = (roi->y - OV7670_ROI_SENSOR_MARGIN) & ~(ROI_SENSOR_VALIGN - 1U);
+        }
+        x1 = (roi->x + roi->width + OV7670_ROI_SENSOR_MARGIN + ROI_SENSOR_HALIGN - 1U) &
+                ~(ROI_SENSOR_HALIGN - 1U);
+        y1 = (roi->y + roi->height + OV7670_ROI_SENSOR_MARGIN + ROI_SENSOR_VALIGN - 1U) &
+                ~(ROI_SENSOR_VALIGN - 1U);
+        x1 = (x1 > OV7670_WIDTH) ? OV7670_WIDTH : x1;
+        y1 = (y1 > OV7670_HEIGHT) ? OV7670_HEIGHT : y1;
+    }
+    win->x = (uint16_t)x0;
+    win->y = (uint16_t)y0;
+    win->w = (uint16_t)(x1 - x0);
+    win->h = (uint16_t)(y1 - y0);
+
+    geo->out_width = roi->width / roi->hdec;
+    geo->out_height = roi->height / roi->vdec;
+    geo->frame_bytes = (uint32_t)geo->out_width * geo->out_height * ROI_BYTES_PER_PIXEL;
+    geo->frame_words = geo->frame_bytes / 4U;
+    geo->crop_x = roi->x - win->x;
+    geo->crop_y = roi->y - win->y;
+    geo->sensor_width = win->w;
+    geo->sensor_height = win->h;
+}
+
+/* The QVGA output is the VGA array window downscaled by 2 (COM14/DCW), so
+ * one output pixel/line is two array columns/rows */
+static void BuildSensorRegs(const ROI_Window_t *win)
+{
+    uint32_t hstart = OV7670_ROI_SENSOR_HSTART + 2U * win->x;
+    uint32_t hstop = (hstart + 2U * win->w) % OV7670_ROI_SENSOR_HWRAP;
+    uint32_t vstart = OV7670_ROI_SENSOR_VSTART + 2U * win->y;
+    uint32_t vstop = vstart + 2U * win->h;
+
+    ROI_SensorRegs[0][0] = OV7670_REG_HSTART;
+    ROI_SensorRegs[0][1] = (uint8_t)(hstart >> 3);
+    ROI_SensorRegs[1][0] = OV7670_REG_HSTOP;
+    ROI_SensorRegs[1][1] = (uint8_t)(hstop >> 3);
+    ROI_SensorRegs[2][0] = OV7670_REG_HREF;
+    ROI_SensorRegs[2][1] = (uint8_t)(0x80U | ((hstop & 7U) << 3) | (hstart & 7U));
+    ROI_SensorRegs[3][0] = OV7670_REG_VSTRT;
+    ROI_SensorRegs[3][1] = (uint8_t)(vstart >> 2);
+    ROI_SensorRegs[4][0] = OV7670_REG_VSTOP;
+    ROI_SensorRegs[4][1] = (uint8_t)(vstop >> 2);
+    ROI_SensorRegs[5][0] = OV7670_REG_VREF;
+    ROI_SensorRegs[5][1] = (uint8_t)(((vstop & 3U) << 2) | (vstart & 3U));
+    ROI_SensorRegs[6][0] = OV7670_REG_DUMMY;
+    ROI_SensorRegs[6][1] = OV7670_REG_DUMMY;
+}
+
+/* SCCB job completion, interrupt context */
+static void SensorDone(HAL_StatusTypeDef status)
+{
+    if (status == HAL_OK)
+    {
+        ROI.sensor = ROI.sensor_req;
+        ROI.state = ROI_READY;
+    }
+    else
+    {
+        /* Window state unknown: force a rewrite with the next request */
+        ROI.sensor.w = 0U;
+        ROI.state = ROI_IDLE;
+    }
+}
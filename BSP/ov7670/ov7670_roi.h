@@ -0,0 +1,88 @@
+/*
+ * ov7670_roi.h
+ * OV7670 region of interest capture
+ *
+ * Only the wanted part of the frame crosses the bus: the sensor HREF/VREF
+ * window can be narrowed around the region, the DCMI crop unit trims it to
+ * the exact size and the DCMI byte/line select drops every other pixel
+ * and/or line. The DMA length and the frame size reported to the consumer
+ * follow the active region. A new region is latched at the next VSYNC, so it
+ * can be moved from frame to frame.
+ */
+
+#ifndef OV7670_ROI_H_
+#define OV7670_ROI_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "main.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Extra pixels kept around the region by the sensor window, the DCMI crop
+ * removes them (absorbs the few pixels of HREF uncertainty of the scaler) */
+#define OV7670_ROI_SENSOR_MARGIN                 (8U)
+
+/* Sensor window of the full QVGA frame in VGA array units, see OV7670_reg[] */
+#define OV7670_ROI_SENSOR_HSTART                 (176U)
+#define OV7670_ROI_SENSOR_VSTART                 (14U)
+#define OV7670_ROI_SENSOR_HWRAP                  (784U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint16_t x;                   /* top left corner, full frame pixels */
+    uint16_t y;
+    uint16_t width;               /* region size before decimation */
+    uint16_t height;
+    uint8_t  hdec;                /* 1 or 2: keep every pixel / every other pixel */
+    uint8_t  vdec;                /* 1 or 2: keep every line / every other line */
+    uint8_t  sensor_window;       /* 1: shrink the sensor window as well */
+} OV7670_ROI_t;
+
+typedef struct
+{
+    uint16_t out_width;           /* pixels per line written to memory */
+    uint16_t out_height;          /* lines per frame written to memory */
+    uint32_t frame_bytes;
+    uint32_t frame_words;         /* DMA length */
+    uint16_t crop_x;              /* DCMI crop origin inside the sensor output */
+    uint16_t crop_y;
+    uint16_t sensor_width;        /* sensor output size, QVGA pixels */
+    uint16_t sensor_height;
+} OV7670_ROI_Geometry_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Full frame, no decimation; applied at the first OV7670_ROI_Latch() */
+extern void OV7670_ROI_Init(void);
+
+/* Request a region, returns HAL_BUSY while a previous sensor window write is
+ * still running and HAL_ERROR for a region that doesn't fit:
+ * x + width <= 320, y + height <= 240, width multiple of 2 * hdec,
+ * height multiple of vdec. */
+extern HAL_StatusTypeDef OV7670_ROI_Set(const OV7670_ROI_t *roi);
+extern void OV7670_ROI_SetFull(void);
+
+/* Active region and geometry (the pending one only after it was latched) */
+extern void OV7670_ROI_Get(OV7670_ROI_t *roi);
+extern const OV7670_ROI_Geometry_t* OV7670_ROI_GetGeometry(void);
+extern uint8_t OV7670_ROI_isPending(void);
+
+/* Driver hook: called with the DCMI stopped, before the DMA is (re)started */
+extern void OV7670_ROI_Latch(DCMI_HandleTypeDef *hdcmi);
+
+/* DCMI to memory traffic for a frame rate in 1/100 fps (OV7670_TLM_t) */
+extern uint32_t OV7670_ROI_BytesPerSec(uint32_t fps_x100);
+extern uint32_t OV7670_ROI_FullBytesPerSec(uint32_t fps_x100);
+
+#endif /* OV7670_ROI_H_ */
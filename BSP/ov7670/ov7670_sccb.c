@@ -0,0 +1,422 @@
+/*
+ * ov7670_sccb.c
+ * OV7670 interrupt driven SCCB transaction queue
+ *
+ * Streams a register list ({reg, value} pairs, same format as OV7670_reg[])
+ * to the sensor with HAL_I2C_xxx_IT transfers. Every write is optionally read
+ * back and compared; the next register is started from the completion
+ * interrupt, delays and retry back-off are counted down from SysTick, so the
+ * CPU is free while the sensor is being programmed.
+ *
+ * A transfer stuck in flight is aborted (HAL_I2C_Master_Abort_IT(), a STOP
+ * on the bus) and retried. The HAL_I2C_DeInit()/Init() pair is kept out of
+ * the interrupts: only when the abort can't be issued or doesn't complete
+ * either, OV7670_SCCB_Task() re-initialises the I2C from main context.
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "main.h"
+#include "ov7670_sccb.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define OV7670_SCCB_ADDR              (0x42U)
+
+/******************************************************************************
+ *                           LOCAL DATA TYPES                                 *
+ ******************************************************************************/
+
+typedef enum
+{
+    SCCB_IDLE,
+    SCCB_WAIT,            /* list delay or retry back-off */
+    SCCB_WRITE,           /* Mem_Write_IT {reg, value} */
+    SCCB_VERIFY_ADDR,     /* Master_Transmit_IT {reg} */
+    SCCB_VERIFY_DATA,     /* Master_Receive_IT {value} */
+    SCCB_READ_ADDR,
+    SCCB_READ_DATA,
+    SCCB_ABORT,           /* Master_Abort_IT of a stuck transfer */
+} SCCB_Phase_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    I2C_HandleTypeDef   *hi2c;
+    /* Current job */
+    const uint8_t       (*list)[2];
+    uint32_t            index;
+    uint8_t             verify;
+    uint8_t             *read_dst;
+    OV7670_SCCB_Cb_t    cb;
+    HAL_StatusTypeDef   status;
+    /* Current register */
+    volatile uint8_t    phase;
+    uint8_t             restart;      /* phase to resume after back-off */
+    uint8_t             tries;
+    uint8_t             reg;
+    uint8_t             tx;
+    uint8_t             rx;
+    /* Time keeping (1 ms ticks) */
+    volatile uint32_t   wait;
+    volatile uint32_t   inflight;
+    /* Abort failed, I2C re-initialisation for OV7670_SCCB_Task() */
+    volatile uint8_t    reinit;
+    OV7670_SCCB_Stats_t stats;
+} SCCB;
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static void SCCB_Next(void);
+static void SCCB_Transfer(uint8_t phase);
+static void SCCB_Retry(void);
+static void SCCB_Abort(void);
+static void SCCB_Finish(HAL_StatusTypeDef status);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void OV7670_SCCB_Init(I2C_HandleTypeDef *hi2c)
+{
+    __disable_irq();
+    SCCB.hi2c = hi2c;
+    SCCB.phase = SCCB_IDLE;
+    SCCB.cb = NULL;
+    SCCB.reinit = 0U;
+    __enable_irq();
+}
+
+HAL_StatusTypeDef OV7670_SCCB_StartList(const uint8_t (*list)[2], uint8_t verify, OV7670_SCCB_Cb_t cb)
+{
+    __disable_irq();
+    if (SCCB.phase != SCCB_IDLE)
+    {
+        __enable_irq();
+        return HAL_BUSY;
+    }
+    SCCB.list = list;
+    SCCB.index = 0U;
+    SCCB.verify = verify;
+    SCCB.read_dst = NULL;
+    SCCB.cb = cb;
+    SCCB.status = HAL_OK;
+    SCCB_Next();
+    __enable_irq();
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef OV7670_SCCB_StartRead(uint8_t regAddr, uint8_t *data, OV7670_SCCB_Cb_t cb)
+{
+    __disable_irq();
+    if (SCCB.phase != SCCB_IDLE)
+    {
+        __enable_irq();
+        return HAL_BUSY;
+    }
+    SCCB.list = NULL;
+    SCCB.read_dst = data;
+    SCCB.cb = cb;
+    SCCB.status = HAL_OK;
+    SCCB.reg = regAddr;
+    SCCB.tries = 0U;
+    SCCB_Transfer(SCCB_READ_ADDR);
+    __enable_irq();
+    return HAL_OK;
+}
+
+uint8_t OV7670_SCCB_isBusy(void)
+{
+    return (SCCB.phase != SCCB_IDLE) ? 1U : 0U;
+}
+
+const OV7670_SCCB_Stats_t* OV7670_SCCB_GetStats(void)
+{
+    return &SCCB.stats;
+}
+
+void OV7670_SCCB_IncTick(void)
+{
+    switch (SCCB.phase)
+    {
+        case SCCB_IDLE:
+            break;
+
+        case SCCB_WAIT:
+        {
+            if (SCCB.wait > 0U)
+            {
+                SCCB.wait--;
+            }
+            if (SCCB.wait == 0U)
+            {
+                if (SCCB.restart != SCCB_IDLE)
+                {
+                    SCCB_Transfer(SCCB.restart);
+                }
+                else
+                {
+                    SCCB_Next();
+                }
+            }
+            break;
+        }
+
+        case SCCB_ABORT:
+        {
+            /* No STOP either: the bus needs the re-initialisation */
+            if (++SCCB.inflight > OV7670_SCCB_XFER_TIMEOUT_MS)
+            {
+                SCCB.reinit = 1U;
+            }
+            break;
+        }
+
+        default:
+        {
+            /* Transfer in flight: recover from a stuck bus */
+            if (++SCCB.inflight > OV7670_SCCB_XFER_TIMEOUT_MS)
+            {
+                SCCB.stats.timeouts++;
+                SCCB_Abort();
+            }
+            break;
+        }
+    }
+}
+
+void OV7670_SCCB_Task(void)
+{
+    if (!SCCB.reinit)
+    {
+        return;
+    }
+    (void)HAL_I2C_DeInit(SCCB.hi2c);
+    (void)HAL_I2C_Init(SCCB.hi2c);
+    __disable_irq();
+    SCCB.reinit = 0U;
+    SCCB.stats.reinits++;
+    if (SCCB.phase == SCCB_ABORT)
+    {
+        SCCB_Retry();
+    }
+    __enable_irq();
+}
+
+/******************************************************************************
+ *                               HAL CALLBACKS                                *
+ ******************************************************************************/
+
+void HAL_I2C_MemTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if ((hi2c != SCCB.hi2c) || (SCCB.phase != SCCB_WRITE))
+    {
+        return;
+    }
+    SCCB.stats.writes++;
+    if (SCCB.verify)
+    {
+        SCCB_Transfer(SCCB_VERIFY_ADDR);
+    }
+    else
+    {
+        SCCB_Next();
+    }
+}
+
+void HAL_I2C_MasterTxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c != SCCB.hi2c)
+    {
+        return;
+    }
+    /* Register address is latched, SCCB needs a separate read transaction */
+    if (SCCB.phase == SCCB_VERIFY_ADDR)
+    {
+        SCCB_Transfer(SCCB_VERIFY_DATA);
+    }
+    else if (SCCB.phase == SCCB_READ_ADDR)
+    {
+        SCCB_Transfer(SCCB_READ_DATA);
+    }
+}
+
+void HAL_I2C_MasterRxCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if (hi2c != SCCB.hi2c)
+    {
+        return;
+    }
+    SCCB.stats.reads++;
+    if (SCCB.phase == SCCB_VERIFY_DATA)
+    {
+        if (SCCB.rx == SCCB.tx)
+        {
+            SCCB_Next();
+        }
+        else
+        {
+            SCCB.stats.last_bad_reg = SCCB.reg;
+            SCCB.stats.last_bad_val = SCCB.rx;
+            SCCB_Retry();
+        }
+    }
+    else if (SCCB.phase == SCCB_READ_DATA)
+    {
+        *SCCB.read_dst = SCCB.rx;
+        SCCB_Finish(HAL_OK);
+    }
+}
+
+void HAL_I2C_ErrorCallback(I2C_HandleTypeDef *hi2c)
+{
+    if ((hi2c != SCCB.hi2c) || (SCCB.phase == SCCB_IDLE) || (SCCB.phase == SCCB_WAIT) ||
+        (SCCB.phase == SCCB_ABORT))
+    {
+        return;
+    }
+    SCCB.stats.bus_errors++;
+    SCCB_Retry();
+}
+
+/* STOP sent, the peripheral is free again */
+void HAL_I2C_AbortCpltCallback(I2C_HandleTypeDef *hi2c)
+{
+    if ((hi2c != SCCB.hi2c) || (SCCB.phase != SCCB_ABORT))
+    {
+        return;
+    }
+    SCCB_Retry();
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+/* Fetch the next list entry and start it */
+static void SCCB_Next(void)
+{
+    const uint8_t *entry = SCCB.list[SCCB.index];
+
+    if (entry[0] == OV7670_REG_DUMMY)
+    {
+        SCCB_Finish(SCCB.status);
+        return;
+    }
+    SCCB.index++;
+
+    if (entry[0] == OV7670_SCCB_DELAY)
+    {
+        SCCB.restart = SCCB_IDLE;
+        SCCB.wait = entry[1];
+        SCCB.phase = SCCB_WAIT;
+        return;
+    }
+
+    SCCB.reg = entry[0];
+    SCCB.tx = entry[1];
+    SCCB.tries = 0U;
+    SCCB_Transfer(SCCB_WRITE);
+}
+
+static void SCCB_Transfer(uint8_t phase)
+{
+    HAL_StatusTypeDef ret;
+
+    SCCB.phase = phase;
+    SCCB.inflight = 0U;
+    switch (phase)
+    {
+        case SCCB_WRITE:
+            ret = HAL_I2C_Mem_Write_IT(SCCB.hi2c, OV7670_SCCB_ADDR, SCCB.reg,
+                    I2C_MEMADD_SIZE_8BIT, &SCCB.tx, 1U);
+            break;
+
+        case SCCB_VERIFY_ADDR:
+        case SCCB_READ_ADDR:
+            /* HAL_I2C_Mem_Read doesn't work because of SCCB protocol(doesn't have ACK) */
+            ret = HAL_I2C_Master_Transmit_IT(SCCB.hi2c, OV7670_SCCB_ADDR, &SCCB.reg, 1U);
+            break;
+
+        case SCCB_VERIFY_DATA:
+        case SCCB_READ_DATA:
+            ret = HAL_I2C_Master_Receive_IT(SCCB.hi2c, OV7670_SCCB_ADDR, &SCCB.rx, 1U);
+            break;
+
+        default:
+            ret = HAL_ERROR;
+            break;
+    }
+
+    if (ret != HAL_OK)
+    {
+        SCCB_Retry();
+    }
+}
+
+/* Schedule the current register again, or give up on it */
+static void SCCB_Retry(void)
+{
+    uint8_t is_read = (SCCB.list == NULL) ? 1U : 0U;
+
+    if (++SCCB.tries < OV7670_SCCB_MAX_TRIES)
+    {
+        SCCB.stats.retries++;
+        SCCB.restart = is_read ? SCCB_READ_ADDR : SCCB_WRITE;
+        SCCB.wait = OV7670_SCCB_RETRY_DELAY_MS;
+        SCCB.phase = SCCB_WAIT;
+        return;
+    }
+
+    if (SCCB.phase == SCCB_VERIFY_DATA)
+    {
+        SCCB.stats.verify_errors++;
+    }
+    else
+    {
+        SCCB.stats.last_bad_reg = SCCB.reg;
+    }
+    SCCB.status = HAL_ERROR;
+
+    if (is_read)
+    {
+        SCCB_Finish(HAL_ERROR);
+    }
+    else
+    {
+        /* Best effort, like the blocking writer: carry on with the list */
+        SCCB_Next();
+    }
+}
+
+/* Abandon the transfer in flight, SCCB_Retry() once the STOP is out */
+static void SCCB_Abort(void)
+{
+    SCCB.phase = SCCB_ABORT;
+    SCCB.inflight = 0U;
+    if (HAL_I2C_Master_Abort_IT(SCCB.hi2c, OV7670_SCCB_ADDR) != HAL_OK)
+    {
+        SCCB.reinit = 1U;
+    }
+}
+
+static void SCCB_Finish(HAL_StatusTypeDef status)
+{
+    OV7670_SCCB_Cb_t cb = SCCB.cb;
+
+    SCCB.cb = NULL;
+    SCCB.phase = SCCB_IDLE;
+    if (cb != NULL)
+    {
+        cb(status);
+    }
+}
@@ -0,0 +1,67 @@
+/*
+ * ov7670_sccb.h
+ * OV7670 interrupt driven SCCB transaction queue
+ */
+
+#ifndef OV7670_SCCB_H_
+#define OV7670_SCCB_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "main.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Number of attempts for one register (NACK, bus error or readback mismatch) */
+#define OV7670_SCCB_MAX_TRIES                    (3U)
+/* Ticks (ms) a single transfer (or its abort) may stay in flight before it
+ * is aborted (or the I2C re-initialised) */
+#define OV7670_SCCB_XFER_TIMEOUT_MS              (10U)
+/* Back-off before a failed transfer is retried */
+#define OV7670_SCCB_RETRY_DELAY_MS               (1U)
+
+/* Pseudo register used inside register lists: {OV7670_SCCB_DELAY, ms} */
+#define OV7670_SCCB_DELAY                        (0xFEU)
+/* Register lists are terminated by {OV7670_REG_DUMMY, OV7670_REG_DUMMY} */
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+/* Job completion callback, called from interrupt context */
+typedef void (*OV7670_SCCB_Cb_t)(HAL_StatusTypeDef status);
+
+typedef struct
+{
+    uint32_t writes;           /* register writes acknowledged by the sensor */
+    uint32_t reads;            /* register reads (verify and single reads) */
+    uint32_t retries;          /* transfers repeated after NACK/timeout/mismatch */
+    uint32_t verify_errors;    /* registers still wrong after all tries */
+    uint32_t bus_errors;       /* HAL_I2C_ErrorCallback hits */
+    uint32_t timeouts;         /* transfers aborted, stuck in flight */
+    uint32_t reinits;          /* aborts stuck too, I2C re-initialised */
+    uint8_t  last_bad_reg;     /* last register that failed */
+    uint8_t  last_bad_val;     /* value read back from it */
+} OV7670_SCCB_Stats_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+extern void OV7670_SCCB_Init(I2C_HandleTypeDef *hi2c);
+extern HAL_StatusTypeDef OV7670_SCCB_StartList(const uint8_t (*list)[2], uint8_t verify, OV7670_SCCB_Cb_t cb);
+extern HAL_StatusTypeDef OV7670_SCCB_StartRead(uint8_t regAddr, uint8_t *data, OV7670_SCCB_Cb_t cb);
+extern uint8_t OV7670_SCCB_isBusy(void);
+extern const OV7670_SCCB_Stats_t* OV7670_SCCB_GetStats(void);
+
+/* Shall be called every 1 ms (SysTick_Handler) */
+extern void OV7670_SCCB_IncTick(void);
+/* Main context (main loop, init wait): re-initialises the I2C when an abort
+ * didn't free it, the queue then goes on */
+extern void OV7670_SCCB_Task(void);
+
+#endif /* OV7670_SCCB_H_ */
@@ -0,0 +1,180 @@
+/*
+ * ov7670_tlm.c
+ * OV7670 capture pipeline telemetry
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "main.h"
+#include "ov7670_tlm.h"
+#include "vision_simd.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define TLM_CYCLES_TO_US(c)           ((c) / (SystemCoreClock / 1000000U))
+#define TLM_EWMA(avg, v, shift)       ((avg) = (uint32_t)((int32_t)(avg) + \
+                                       (((int32_t)(v) - (int32_t)(avg)) >> (shift))))
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    OV7670_TLM_t        tlm;
+    /* DWT stamps */
+    uint32_t            vsync;        /* last VSYNC */
+    uint32_t            capture;      /* last DMA (re)start */
+    uint32_t            delivered;    /* VSYNC of the frame handed to the consumer */
+    volatile uint8_t    pending;      /* consumer still holds a frame */
+    uint8_t             started;      /* first VSYNC seen */
+} TLM;
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void OV7670_TLM_Init(void)
+{
+    VISION_CyclesInit();
+    OV7670_TLM_Reset();
+}
+
+void OV7670_TLM_Reset(void)
+{
+    __disable_irq();
+    memset(&TLM, 0, sizeof(TLM));
+    TLM.tlm.period_min_us = UINT32_MAX;
+    __enable_irq();
+}
+
+void OV7670_TLM_Get(OV7670_TLM_t *tlm)
+{
+    __disable_irq();
+    *tlm = TLM.tlm;
+    __enable_irq();
+    if (tlm->period_min_us == UINT32_MAX)
+    {
+        tlm->period_min_us = 0U;
+    }
+}
+
+void OV7670_TLM_Vsync(void)
+{
+    uint32_t now = OV7670_TLM_NOW();
+    OV7670_TLM_t *t = &TLM.tlm;
+
+    t->frames++;
+    if (TLM.started)
+    {
+        uint32_t period = TLM_CYCLES_TO_US(now - TLM.vsync);
+        uint32_t dev;
+
+        if (period == 0U)
+        {
+            period = 1U;
+        }
+        if (t->period_us == 0U)
+        {
+            t->period_us = period;
+            t->fps_x100 = 100000000U / period;
+        }
+        dev = (period > t->period_us) ? (period - t->period_us) : (t->period_us - period);
+        TLM_EWMA(t->jitter_us, dev, OV7670_TLM_JITTER_SHIFT);
+        TLM_EWMA(t->period_us, period, OV7670_TLM_EWMA_SHIFT);
+        TLM_EWMA(t->fps_x100, 100000000U / period, OV7670_TLM_EWMA_SHIFT);
+        t->period_min_us = (period < t->period_min_us) ? period : t->period_min_us;
+        t->period_max_us = (period > t->period_max_us) ? period : t->period_max_us;
+        if ((period * 2U) > (t->period_min_us * 3U))
+        {
+            t->missed++;
+        }
+    }
+    TLM.vsync = now;
+    TLM.started = 1U;
+}
+
+void OV7670_TLM_CaptureStart(void)
+{
+    TLM.capture = OV7670_TLM_NOW();
+}
+
+void OV7670_TLM_FrameEnd(uint32_t lines)
+{
+    OV7670_TLM_t *t = &TLM.tlm;
+
+    if (TLM.capture != 0U)
+    {
+        t->capture_us = TLM_CYCLES_TO_US(OV7670_TLM_NOW() - TLM.capture);
+        t->line_ns = (lines != 0U) ? ((t->capture_us * 1000U) / lines) : 0U;
+    }
+}
+
+void OV7670_TLM_Deliver(uint32_t cb_start)
+{
+    OV7670_TLM_t *t = &TLM.tlm;
+
+    t->callback_us = TLM_CYCLES_TO_US(OV7670_TLM_NOW() - cb_start);
+    t->callback_max_us = (t->callback_us > t->callback_max_us) ?
+            t->callback_us : t->callback_max_us;
+    t->callback_pm = (t->period_us != 0U) ? ((t->callback_us * 1000U) / t->period_us) : 0U;
+    if (TLM.pending)
+    {
+        t->dropped++;
+    }
+    TLM.delivered = TLM.vsync;
+    TLM.pending = 1U;
+}
+
+void OV7670_TLM_Strip(uint32_t cb_start, uint8_t overrun)
+{
+    OV7670_TLM_t *t = &TLM.tlm;
+
+    t->strips++;
+    t->strip_us = TLM_CYCLES_TO_US(OV7670_TLM_NOW() - cb_start);
+    t->strip_max_us = (t->strip_us > t->strip_max_us) ? t->strip_us : t->strip_max_us;
+    t->strip_overrun += (overrun) ? 1U : 0U;
+}
+
+void OV7670_TLM_Error(uint32_t error_code)
+{
+    OV7670_TLM_t *t = &TLM.tlm;
+
+    /* OVR/SYNC abort the DMA, which reports again with the DMA bit set */
+    if (error_code & (HAL_DCMI_ERROR_OVR | HAL_DCMI_ERROR_SYNC))
+    {
+        t->dcmi_overrun += (error_code & HAL_DCMI_ERROR_OVR) ? 1U : 0U;
+        t->dcmi_sync += (error_code & HAL_DCMI_ERROR_SYNC) ? 1U : 0U;
+    }
+    else if (error_code & (HAL_DCMI_ERROR_DMA | HAL_DCMI_ERROR_TIMEOUT))
+    {
+        t->dma_errors++;
+    }
+}
+
+void OV7670_TLM_Consumed(void)
+{
+    OV7670_TLM_t *t = &TLM.tlm;
+    uint32_t latency;
+
+    __disable_irq();
+    if (!TLM.pending)
+    {
+        __enable_irq();
+        return;
+    }
+    latency = TLM_CYCLES_TO_US(OV7670_TLM_NOW() - TLM.delivered);
+    TLM.pending = 0U;
+    if (t->latency_us == 0U)
+    {
+        t->latency_us = latency;
+    }
+    TLM_EWMA(t->latency_us, latency, OV7670_TLM_EWMA_SHIFT);
+    t->latency_max_us = (latency > t->latency_max_us) ? latency : t->latency_max_us;
+    __enable_irq();
+}
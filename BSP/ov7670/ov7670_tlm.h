@@ -0,0 +1,82 @@
+/*
+ * ov7670_tlm.h
+ * OV7670 capture pipeline telemetry
+ *
+ * Rate, timing and error accounting fed from the DCMI/DMA callbacks of the
+ * driver and from the frame consumer. Times are taken from the DWT cycle
+ * counter and reported in microseconds.
+ */
+
+#ifndef OV7670_TLM_H_
+#define OV7670_TLM_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "main.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* EWMA weight 1/2^n for fps, period and latency */
+#define OV7670_TLM_EWMA_SHIFT                    (3U)
+/* Jitter smoothing 1/16, as RFC 3550 interarrival jitter */
+#define OV7670_TLM_JITTER_SHIFT                  (4U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint32_t frames;           /* VSYNC events */
+    uint32_t fps_x100;         /* capture rate EWMA, 1/100 fps */
+    uint32_t period_us;        /* frame period EWMA */
+    uint32_t period_min_us;
+    uint32_t period_max_us;
+    uint32_t jitter_us;        /* smoothed |period - period_us| */
+    uint32_t capture_us;       /* DMA (re)start to frame complete, last frame */
+    uint32_t line_ns;          /* capture_us per active line */
+    uint32_t callback_us;      /* time spent in the frame callback, last frame */
+    uint32_t callback_max_us;
+    uint32_t callback_pm;      /* callback_us against period_us, per mille */
+    uint32_t missed;           /* periods over 1.5 period_min_us: frames not captured,
+                                  e.g. the callback ran past the next frame start */
+    uint32_t dcmi_overrun;     /* HAL_DCMI_ERROR_OVR */
+    uint32_t dcmi_sync;        /* HAL_DCMI_ERROR_SYNC */
+    uint32_t dma_errors;       /* HAL_DCMI_ERROR_DMA / TIMEOUT on their own */
+    uint32_t dropped;          /* frames delivered before the previous one was consumed */
+    uint32_t latency_us;       /* VSYNC to frame consumed (displayed), EWMA */
+    uint32_t latency_max_us;
+    /* OV7670_STREAM_MODE_BY_STRIP */
+    uint32_t strips;           /* strips handed to the strip callback */
+    uint32_t strip_us;         /* time spent in the strip callback, last strip */
+    uint32_t strip_max_us;
+    uint32_t strip_overrun;    /* strips overwritten by the DMA while in the callback */
+} OV7670_TLM_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+extern void OV7670_TLM_Init(void);
+extern void OV7670_TLM_Reset(void);
+extern void OV7670_TLM_Get(OV7670_TLM_t *tlm);
+
+/* Driver side (interrupt context) */
+extern void OV7670_TLM_Vsync(void);
+extern void OV7670_TLM_CaptureStart(void);
+extern void OV7670_TLM_FrameEnd(uint32_t lines);
+extern void OV7670_TLM_Deliver(uint32_t cb_start);
+extern void OV7670_TLM_Strip(uint32_t cb_start, uint8_t overrun);
+extern void OV7670_TLM_Error(uint32_t error_code);
+
+/* Consumer side: the delivered frame has been used (e.g. copied to the LCD) */
+extern void OV7670_TLM_Consumed(void);
+
+/* DWT cycle counter, for OV7670_TLM_Deliver() and OV7670_TLM_Strip() */
+#define OV7670_TLM_NOW()                         (DWT->CYCCNT)
+
+#endif /* OV7670_TLM_H_ */
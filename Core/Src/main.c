@@ -32,12 +32,37 @@
 
 /* Private includes ----------------------------------------------------------*/
 /* USER CODE BEGIN Includes */
+#include <string.h>
 #include "BSP_SDRAM.h"
 #include "BSP_RGB_LCD.h"
+#include "BSP_MDMA.h"
 #include "GUI_Paint.h"
 #include "image.h"
+#include "image_asset.h"
+#include "asset_store.h"
+#include "image_dec.h"
 #include "debug_console.h"
 #include "ov7670/ov7670.h"
+#include "ov7670/ov7670_sccb.h"
+#include "ov7670/ov7670_tlm.h"
+#include "ov7670/ov7670_roi.h"
+#include "cam_stats.h"
+#include "cam_motion.h"
+#include "cam_blob.h"
+#include "cam_bg.h"
+#include "cam_rec.h"
+#include "cam_latency.h"
+#include "cam_jpeg.h"
+#include "cam_conv.h"
+#include "vision_luma.h"
+#include "vision_color.h"
+#include "vision_simd.h"
+#include "GUI_OSD.h"
+#include "GUI_Text.h"
+#include "GUI_Layout.h"
+#include "GUI_Label.h"
+#include "GUI_Readout.h"
+#include "GUI_Sprite.h"
 
 /* USER CODE END Includes */
 
@@ -48,6 +73,7 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#define SNAPSHOT_JPEG_SIZE		(128U * 1024U)
 
 /* USER CODE END PD */
 
@@ -60,15 +86,151 @@
 
 /* USER CODE BEGIN PV */
 static char IsFrameReady = 0;
+static uint32_t FrameSeq = 0;
+/* Frame being copied to the LCD, for the latency stamps */
+static uint32_t CopySeq = 0;
+/* Strips the MDMA refused (previous strip still being copied) */
+static volatile uint32_t StripRefused = 0;
+/* Geometry of the frame in img_buffer (follows the camera ROI) */
+static uint16_t FrameWidth = OV7670_WIDTH;
+static uint16_t FrameHeight = OV7670_HEIGHT;
 extern uint8_t img_buffer[];
+/* UI text: ASCII, then Latin-1 and symbols, then CJK */
+static const GUI_Text_Fonts_t UI_Fonts = { { &Font20AA, &Font20AAX, &Font24CJK }, 3 };
+
+/* Camera picture centred on LCD layer 0 (RGB565), copied by the MDMA.
+ * HAL_BUSY: the previous copy still runs, nothing queued */
+static HAL_StatusTypeDef CameraToLCD(const uint8_t *src, uint16_t w, uint16_t h,
+		uint16_t y, uint16_t lines, BSP_MDMA_Cb_t cb)
+{
+	BSP_MDMA_Rect_t rect;
+	uint32_t x0 = (DISPLAY_WIDTH - w) / 2;
+	uint32_t y0 = (DISPLAY_HEIGHT - h) / 2 + y;
+
+	rect.src = src;
+	rect.src_stride = w * 2;
+	rect.dst = (uint8_t*)hltdc.LayerCfg[0].FBStartAdress + (y0 * DISPLAY_WIDTH + x0) * 2;
+	rect.dst_stride = DISPLAY_WIDTH * 2;
+	rect.width = w * 2;
+	rect.lines = lines;
+	return BSP_MDMA_Copy2D(&rect, cb, NULL);
+}
+
+static void FrameShown_CB(HAL_StatusTypeDef status, void *user)
+{
+	UNUSED(status);
+	UNUSED(user);
+	OV7670_TLM_Consumed();
+	CAM_Lat_Stamp(CAM_LAT_EV_COPY_DONE, CopySeq);
+	/* The reload event marks the next vertical blanking: visible from there */
+	(void)HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+}
 
 void FrameTask()
 {
-	if (IsFrameReady)
+	static uint16_t shown_w = OV7670_WIDTH;
+	static uint16_t shown_h = OV7670_HEIGHT;
+	/* Replayed frame not copied yet: the recorder hands each one out once */
+	static const uint8_t *replay = NULL;
+
+	if (CAM_Rec_isFrozen())
 	{
-		BSP_LCD_FillRGBRect((DISPLAY_WIDTH-OV7670_WIDTH)/2, (DISPLAY_HEIGHT-OV7670_HEIGHT)/2,
-				img_buffer, OV7670_WIDTH, OV7670_HEIGHT);
+		/* Replay: recorded frames through the same display path */
+		CAM_RecFrame_t info;
+
 		IsFrameReady = 0;
+		if (BSP_MDMA_isBusy())
+		{
+			return;
+		}
+		if (replay == NULL)
+		{
+			if ((replay = CAM_Rec_ReplayFrame(&info)) == NULL)
+			{
+				return;
+			}
+			if ((shown_w != info.width) || (shown_h != info.height))
+			{
+				BSP_LCD_Clear(LCD_COLOR_BLACK);
+				shown_w = info.width;
+				shown_h = info.height;
+			}
+		}
+		if (CameraToLCD(replay, shown_w, shown_h, 0, shown_h, NULL) == HAL_OK)
+		{
+			replay = NULL;
+		}
+		return;
+	}
+	replay = NULL;
+	if (IsFrameReady && !BSP_MDMA_isBusy())
+	{
+		if ((shown_w != FrameWidth) || (shown_h != FrameHeight))
+		{
+			/* Smaller region: don't leave the old picture around it */
+			BSP_LCD_Clear(LCD_COLOR_BLACK);
+			shown_w = FrameWidth;
+			shown_h = FrameHeight;
+		}
+		/* Stamped before the start, recorded only once the copy is queued */
+		uint32_t t = VISION_CYCLES();
+
+		CopySeq = FrameSeq;
+		if (CameraToLCD(img_buffer, shown_w, shown_h, 0, shown_h, FrameShown_CB) == HAL_OK)
+		{
+			CAM_Lat_Event(CAM_LAT_EV_COPY_START, CopySeq, t);
+			IsFrameReady = 0;
+		}
+		/* Refused: the frame stays pending, retried on the next pass */
+	}
+}
+
+/* Frame copy and JPEG output live in SDRAM, dump them with the 'D' command */
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint8_t SnapshotFrame[OV7670_WIDTH * OV7670_HEIGHT * 2];
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint8_t SnapshotJpeg[SNAPSHOT_JPEG_SIZE];
+/* Convolution benchmark input (RGB565 + luma plane) and output */
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint8_t ConvSrc[OV7670_WIDTH * OV7670_HEIGHT * 3];
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint8_t ConvDst[OV7670_WIDTH * OV7670_HEIGHT * 2];
+/* Image asset decode benchmark output, a screen */
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint16_t AssetDst[LCD_WIDTH * LCD_HEIGHT];
+/* Streaming decoder benchmark input, a 24 bit BMP of the splash */
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint8_t DecFile[54 + LCD_WIDTH * LCD_HEIGHT * 3];
+/* Sprite benchmark sheets: 8 keyed 32x32 frames, a 48x48 ARGB glow */
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint16_t SpriteKeyed[32 * 8 * 32];
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint32_t SpriteGlow[48 * 48];
+/* 1: requested, 2: frame copied by VSync_CB */
+static volatile char SnapshotState = 0;
+static uint16_t SnapshotWidth, SnapshotHeight;
+
+void SnapshotTask()
+{
+	if (SnapshotState == 2)
+	{
+		uint32_t size = 0;
+		uint32_t tick = HAL_GetTick();
+		CAM_JpegStatus_t ret = CAM_Jpeg_EncodeFrame(SnapshotFrame, SnapshotWidth, SnapshotHeight,
+				CAM_JPEG_FMT_RGB565, CAM_JPEG_SUB_420, CAM_JPEG_DEF_QUALITY,
+				SnapshotJpeg, sizeof(SnapshotJpeg), &size);
+		tick = HAL_GetTick() - tick;
+		if (ret == CAM_JPEG_OK)
+		{
+			DebugPrint("\r\n JPEG %lu bytes in %lu ms", size, tick);
+			DebugPrint("\r\n D %08lX %08lX", (uint32_t)SnapshotJpeg,
+					(uint32_t)SnapshotJpeg + size - 1);
+		}
+		else
+		{
+			DebugPrint("\r\n JPEG error %d", ret);
+		}
+		SnapshotState = 0;
 	}
 }
 
@@ -134,9 +296,24 @@ int main(void)
 	HAL_GPIO_WritePin(DISP_GPIO_Port, DISP_Pin, GPIO_PIN_SET);
 	HAL_TIM_PWM_Start(&htim2, TIM_CHANNEL_4);
 	TIM2->CCR4 = 500;
+	/* Camera registers are programmed in background while the LCD comes up */
+	OV7670_InitAsync(&hdcmi, &hi2c_dcmi, 0, 0, NULL);
+	BSP_MDMA_Init();
+	CAM_Stats_Init();
+	CAM_Motion_Init();
+	CAM_Blob_Init();
+	CAM_BG_Init();
+	CAM_Rec_Init();
+	CAM_Lat_Init(SystemCoreClock / 1000000);
 	BSP_LCD_Init();
 	HAL_Delay(50);
 	BSP_LCD_Clear(0);
+	GUI_OSD_Init();
+	GUI_Label_Init();
+	GUI_Readout_Init();
+	GUI_Sprite_Init();
+	/* Assets in the QUADSPI flash, if the board mapped it */
+	ASSET_Store_MountQSPI();
 
 	//Pixel  800*480  RGB565
 	Paint_NewImage(800, 480, 0, 0xffff);
@@ -152,7 +329,11 @@ int main(void)
 	Paint_DrawLine(300, 230, 200, 330, MAGENTA, LINE_STYLE_SOLID,
 			DOT_PIXEL_2X2);
 	Paint_DrawCircle(250, 280, 45, GREEN, DRAW_FILL_EMPTY, DOT_PIXEL_2X2);
-	Paint_DrawImage(gImage_800X221, 0, 0, 800, 221);
+	{
+		const GUI_Text_Surface_t *lcd = GUI_Text_GetSurface();
+
+		IMAGE_Asset_Draw(gAsset_800X221, lcd->base, lcd->stride, lcd->width, lcd->height, 0, 0);
+	}
 	HAL_Delay(1000);
 
   /* USER CODE END 2 */
@@ -160,7 +341,10 @@ int main(void)
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
 	DebugInit();
-	OV7670_Init(&hdcmi, &hi2c_dcmi, 0, 0);
+	while (!OV7670_isInitDone())
+	{
+		OV7670_SCCB_Task();
+	}
 	OV7670_Start();
 
 	while (1)
@@ -170,13 +354,20 @@ int main(void)
     /* USER CODE BEGIN 3 */
 #if 1
 		FrameTask();
+		SnapshotTask();
+		CAM_Rec_Task();
 		DebugTask();
+		GUI_OSD_Task();
+		OV7670_SCCB_Task();
 		HAL_GPIO_WritePin(LED1_GPIO_Port, LED1_Pin, GPIO_PIN_SET);
-		HAL_Delay(100);
+		GUI_OSD_Idle(100);
 		FrameTask();
+		SnapshotTask();
+		CAM_Rec_Task();
 		DebugTask();
+		GUI_OSD_Task();
 		HAL_GPIO_WritePin(LED1_GPIO_Port, LED1_Pin, GPIO_PIN_RESET);
-		HAL_Delay(100);
+		GUI_OSD_Idle(100);
 #else
 		HAL_GPIO_WritePin(LED1_GPIO_Port, LED1_Pin, GPIO_PIN_SET);
 		HAL_Delay(1000);
@@ -264,15 +455,87 @@ void SystemClock_Config(void)
 
 HAL_StatusTypeDef ov7670_write(uint8_t regAddr, uint8_t data);
 
+#if (OV7670_STREAM_MODE != OV7670_STREAM_MODE_BY_STRIP)
 void VSync_CB(const uint8_t *buffer, uint32_t buf_size)
 {
-	UNUSED(buffer); UNUSED(buf_size);
+	/* Not latched yet: still the geometry of this frame */
+	const OV7670_ROI_Geometry_t *geo = OV7670_ROI_GetGeometry();
+
+	FrameWidth = geo->out_width;
+	FrameHeight = geo->out_height;
+	/* The DMA is stopped until we return: the frame can't change under us.
+	 * In the DCMI interrupt: a frame starting before we return is not
+	 * captured, debug case 12 shows the time spent here against the frame
+	 * period and the frames missed. */
+	CAM_Lat_Stamp(CAM_LAT_EV_VSYNC, ++FrameSeq);
+	CAM_Stats_Process(buffer, FrameWidth, FrameHeight, FrameSeq);
+	CAM_Motion_Process(buffer, FrameWidth, FrameHeight, FrameSeq);
+	CAM_Blob_Process(buffer, CAM_BLOB_FMT_RGB565, FrameWidth * 2, FrameWidth, FrameHeight, FrameSeq);
+	CAM_BG_Process(buffer, FrameWidth, FrameHeight, FrameSeq);
+	if (SnapshotState == 1)
+	{
+		memcpy(SnapshotFrame, buffer, buf_size);
+		SnapshotWidth = FrameWidth;
+		SnapshotHeight = FrameHeight;
+		SnapshotState = 2;
+	}
+	if (CAM_BG_isEnabled())
+	{
+		/* Foreground shown over the picture, after the snapshot copy */
+		CAM_BG_DrawMask((uint8_t*)buffer, FrameWidth, FrameHeight, LCD_COLOR_RED);
+	}
+	/* Recorded as displayed; the capture restarts once the MDMA copied it */
+	OV7670_HoldFrame();
+	if (!CAM_Rec_Capture(buffer, FrameWidth, FrameHeight, FrameSeq, OV7670_ReleaseFrame))
+	{
+		OV7670_ReleaseFrame();
+	}
 	IsFrameReady = 1;
 }
+#endif
+
+/* Reloads requested by FrameShown_CB and the OSD: any one after the copy */
+void HAL_LTDC_ReloadEventCallback(LTDC_HandleTypeDef *hltdc)
+{
+	UNUSED(hltdc);
+	CAM_Lat_Stamp(CAM_LAT_EV_VISIBLE, 0);
+}
+
+#if (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_STRIP)
+void Strip_CB(const uint8_t *strip, uint32_t size, uint16_t y, uint16_t lines)
+{
+	UNUSED(size);
+	if (y == 0)
+	{
+		const OV7670_ROI_Geometry_t *geo = OV7670_ROI_GetGeometry();
+		FrameWidth = geo->out_width;
+		FrameHeight = geo->out_height;
+	}
+	/* Straight to the LCD while the next strip is captured */
+	if (CameraToLCD(strip, FrameWidth, FrameHeight, y, lines, NULL) != HAL_OK)
+	{
+		/* Those lines keep the previous frame */
+		StripRefused++;
+	}
+}
+#endif
 
 
 void DebugMain(uint32_t val)
 {
+#if (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_STRIP)
+	/* Strip mode only feeds the display: img_buffer holds two strips and
+	 * VSync_CB (stats, motion, blob, background, snapshot, recorder,
+	 * latency) never runs */
+	switch (val) {
+	case 3: case 4: case 5: case 9: case 10: case 11: case 16: case 17:
+	case 19: case 20: case 21: case 22: case 23: case 24:
+		DebugPrint("\r\n %lu needs whole frames, not in strip mode", val);
+		return;
+	default:
+		break;
+	}
+#endif
 	switch (val) {
 	case 0:
 	{
@@ -396,7 +659,765 @@ void DebugMain(uint32_t val)
 		break;
 	case 7:
 	{
+#if (OV7670_STREAM_MODE == OV7670_STREAM_MODE_BY_STRIP)
+		OV7670_RegisterCallback(OV7670_STRIP_CBK, (OV7670_FncPtr_t)Strip_CB);
+#else
 		OV7670_RegisterCallback(OV7670_DRAWFRAME_CBK, (OV7670_FncPtr_t)VSync_CB);
+#endif
+	}
+		break;
+	case 8:
+	{
+		const OV7670_BootInfo_t *boot = OV7670_GetBootInfo();
+		const OV7670_SCCB_Stats_t *sccb = OV7670_SCCB_GetStats();
+		DebugPrint("\r\n init %lu..%lu ms, first frame %lu ms, id %02X, %s",
+				boot->init_start, boot->init_done, boot->first_frame,
+				boot->dev_id, (boot->init_status == HAL_OK) ? "OK" : "ERR");
+		DebugPrint("\r\n sccb wr %lu rd %lu retry %lu",
+				sccb->writes, sccb->reads, sccb->retries);
+		DebugPrint("\r\n sccb verify err %lu bus err %lu last %02X=%02X",
+				sccb->verify_errors, sccb->bus_errors,
+				sccb->last_bad_reg, sccb->last_bad_val);
+		DebugPrint("\r\n sccb timeouts %lu reinit %lu", sccb->timeouts, sccb->reinits);
+	}
+		break;
+	case 9:
+	{
+		static CAM_Stats_t stats;
+		if (!CAM_Stats_isEnabled())
+		{
+			DebugPrint("\r\n frame stats enabled");
+			CAM_Stats_Enable(1);
+			break;
+		}
+		if (CAM_Stats_Get(&stats) == 0)
+		{
+			DebugPrint("\r\n no frame stats yet");
+			break;
+		}
+		DebugPrint("\r\n frame %lu, %lu px, %lu cycles",
+				stats.seq, stats.pixels, stats.cycles);
+		DebugPrint("\r\n Y %3u [%3u..%3u] R %3u [%3u..%3u]",
+				stats.mean_y, stats.min_y, stats.max_y,
+				stats.mean_r, stats.min_r, stats.max_r);
+		DebugPrint("\r\n G %3u [%3u..%3u] B %3u [%3u..%3u]",
+				stats.mean_g, stats.min_g, stats.max_g,
+				stats.mean_b, stats.min_b, stats.max_b);
+		for (uint32_t zy = 0; zy < CAM_STATS_ZONES_Y; zy++)
+		{
+			DebugPrint("\r\n");
+			for (uint32_t zx = 0; zx < CAM_STATS_ZONES_X; zx++)
+			{
+				DebugPrint(" %3u", stats.zone[zy][zx]);
+			}
+		}
+	}
+		break;
+	case 10:
+	{
+		static CAM_Motion_t motion;
+		if (!CAM_Motion_isEnabled())
+		{
+			DebugPrint("\r\n motion detection enabled");
+			CAM_Motion_Enable(1);
+			break;
+		}
+		if (CAM_Motion_Get(&motion) == 0)
+		{
+			DebugPrint("\r\n no motion result yet");
+			break;
+		}
+		DebugPrint("\r\n frame %lu, %lu cycles, score %u, %u blocks",
+				motion.seq, motion.cycles, motion.score, motion.active);
+		for (uint32_t i = 0; i < motion.nboxes; i++)
+		{
+			DebugPrint("\r\n box %lu: %3u,%3u %3ux%3u",
+					i, motion.box[i].x, motion.box[i].y,
+					motion.box[i].w, motion.box[i].h);
+		}
+	}
+		break;
+	case 11:
+	{
+		/* JPEG snapshot of the next frame */
+#if (OV7670_STREAM_MODE != OV7670_STREAM_MODE_BY_STRIP)
+		OV7670_RegisterCallback(OV7670_DRAWFRAME_CBK, (OV7670_FncPtr_t)VSync_CB);
+		SnapshotState = 1;
+#endif
+	}
+		break;
+	case 12:
+	{
+		OV7670_TLM_t tlm;
+		OV7670_TLM_Get(&tlm);
+		DebugPrint("\r\n frames %lu, %lu.%02lu fps, period %lu us [%lu..%lu]",
+				tlm.frames, tlm.fps_x100 / 100, tlm.fps_x100 % 100,
+				tlm.period_us, tlm.period_min_us, tlm.period_max_us);
+		DebugPrint("\r\n jitter %lu us, capture %lu us, line %lu ns",
+				tlm.jitter_us, tlm.capture_us, tlm.line_ns);
+		DebugPrint("\r\n frame cb %lu us (max %lu), %lu.%lu%% of the period, missed %lu",
+				tlm.callback_us, tlm.callback_max_us, tlm.callback_pm / 10,
+				tlm.callback_pm % 10, tlm.missed);
+		DebugPrint("\r\n ovr %lu sync %lu dma %lu dropped %lu",
+				tlm.dcmi_overrun, tlm.dcmi_sync, tlm.dma_errors, tlm.dropped);
+		DebugPrint("\r\n latency %lu us, max %lu us",
+				tlm.latency_us, tlm.latency_max_us);
+		DebugPrint("\r\n strips %lu, cb %lu us max %lu, overrun %lu",
+				tlm.strips, tlm.strip_us, tlm.strip_max_us, tlm.strip_overrun);
+		const BSP_MDMA_Stats_t *mdma = BSP_MDMA_GetStats();
+		DebugPrint("\r\n mdma jobs %lu, %lu bytes, busy %lu, err %lu",
+				mdma->jobs, mdma->bytes, mdma->busy, mdma->errors);
+		DebugPrint("\r\n strips refused %lu", StripRefused);
+	}
+		break;
+	case 13:
+	{
+		OV7670_TLM_Reset();
+		StripRefused = 0;
+	}
+		break;
+	case 14:
+	{
+		/* Step through some regions: full, centre crop, decimated, windowed */
+		static const OV7670_ROI_t presets[] =
+		{
+			{   0,   0, 320, 240, 1, 1, 0 },
+			{  80,  60, 160, 120, 1, 1, 0 },
+			{   0,   0, 320, 240, 2, 2, 0 },
+			{  96,  72, 128,  96, 1, 1, 1 },
+			{  32,  24, 256, 192, 2, 2, 1 },
+		};
+		static uint32_t preset = 0;
+		const OV7670_ROI_t *roi;
+
+		preset = (preset + 1) % (sizeof(presets) / sizeof(presets[0]));
+		roi = &presets[preset];
+		DebugPrint("\r\n ROI %u,%u %ux%u /%u /%u sensor %u: %d",
+				roi->x, roi->y, roi->width, roi->height,
+				roi->hdec, roi->vdec, roi->sensor_window,
+				OV7670_ROI_Set(roi));
+	}
+		break;
+	case 15:
+	{
+		OV7670_TLM_t tlm;
+		OV7670_ROI_t roi;
+		const OV7670_ROI_Geometry_t *geo = OV7670_ROI_GetGeometry();
+
+		OV7670_TLM_Get(&tlm);
+		OV7670_ROI_Get(&roi);
+		DebugPrint("\r\n ROI %u,%u %ux%u -> %ux%u, %lu bytes",
+				roi.x, roi.y, roi.width, roi.height,
+				geo->out_width, geo->out_height, geo->frame_bytes);
+		DebugPrint("\r\n bus %lu B/s, full frame %lu B/s",
+				OV7670_ROI_BytesPerSec(tlm.fps_x100),
+				OV7670_ROI_FullBytesPerSec(tlm.fps_x100));
+	}
+		break;
+	case 16:
+	{
+		/* Convolution cost per kernel on the current frame, cycles per pixel */
+		static const struct { const char *name; const CAM_ConvKernel_t *k; } kernels[] =
+		{
+			{ "box3", &CAM_ConvBox3 }, { "gauss3", &CAM_ConvGauss3 },
+			{ "gauss5", &CAM_ConvGauss5 }, { "sharpen3", &CAM_ConvSharpen3 },
+			{ "laplace3", &CAM_ConvLaplace3 }, { "sobelx", &CAM_ConvSobelX },
+		};
+		uint16_t w = FrameWidth, h = FrameHeight;
+		uint32_t px = (uint32_t)w * h;
+		uint8_t *luma = &ConvSrc[px * 2];
+
+		memcpy(ConvSrc, img_buffer, px * 2);
+		for (uint32_t i = 0; i < px; i++)
+		{
+			luma[i] = (uint8_t)VISION_LUMA(((uint16_t*)ConvSrc)[i]);
+		}
+		for (uint32_t i = 0; i < sizeof(kernels) / sizeof(kernels[0]); i++)
+		{
+			uint32_t y8, rgb;
+			CAM_Conv_Frame(kernels[i].k, CAM_CONV_FMT_Y8, luma, w, ConvDst, w, w, h);
+			y8 = CAM_Conv_LastCycles();
+			CAM_Conv_Frame(kernels[i].k, CAM_CONV_FMT_RGB565, ConvSrc, w * 2,
+					ConvDst, w * 2, w, h);
+			rgb = CAM_Conv_LastCycles();
+			DebugPrint("\r\n %-8s y8 %3lu.%02lu rgb565 %3lu.%02lu cyc/px", kernels[i].name,
+					y8 / px, (y8 % px) * 100 / px, rgb / px, (rgb % px) * 100 / px);
+		}
+	}
+		break;
+	case 17:
+	{
+		/* Pixel format conversion, CPU against DMA2D by image size (cycles) */
+		static const uint16_t sizes[] = { 16, 32, 48, 64, 128, 240 };
+
+		memcpy(ConvSrc, img_buffer, OV7670_WIDTH * OV7670_HEIGHT * 2);
+		for (uint32_t i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+		{
+			uint16_t n = sizes[i];
+			uint32_t t[4];
+
+			for (uint32_t e = 0; e < 2; e++)
+			{
+				VISION_ColorEngine_t engine = e ? VISION_COLOR_DMA2D : VISION_COLOR_CPU;
+				uint32_t start = VISION_CYCLES();
+				VISION_Color_Convert(ConvSrc, VISION_COLOR_RGB565, n * 2,
+						ConvDst, VISION_COLOR_RGB565_SWAP, n * 2, n, n, engine);
+				t[e] = VISION_CYCLES() - start;
+				start = VISION_CYCLES();
+				VISION_Color_Convert(ConvSrc, VISION_COLOR_GRAY8, n,
+						ConvDst, VISION_COLOR_RGB565, n * 2, n, n, engine);
+				t[2 + e] = VISION_CYCLES() - start;
+			}
+			DebugPrint("\r\n %3ux%3u swap %7lu/%7lu gray %7lu/%7lu",
+					n, n, t[0], t[1], t[2], t[3]);
+		}
+	}
+		break;
+	case 18:
+	{
+		/* Performance overlay on/off, cost of the last period */
+		GUI_OSD_Stats_t osd;
+
+		GUI_OSD_Enable(!GUI_OSD_isEnabled());
+		GUI_OSD_GetStats(&osd);
+		DebugPrint("\r\n OSD %s cpu %lu.%lu%% dma2d %lu.%lu%%",
+				GUI_OSD_isEnabled() ? "on" : "off", osd.cpu_load_x10 / 10,
+				osd.cpu_load_x10 % 10, osd.dma2d_busy_x10 / 10, osd.dma2d_busy_x10 % 10);
+		DebugPrint("\r\n OSD redraws %lu, %lu us (max %lu us)",
+				osd.renders, osd.render_us, osd.render_max_us);
+	}
+		break;
+	case 19:
+	{
+		static CAM_Blob_t blob;
+		if (!CAM_Blob_isEnabled())
+		{
+			DebugPrint("\r\n blob labeling enabled");
+			CAM_Blob_Enable(1);
+			break;
+		}
+		if (CAM_Blob_Get(&blob) == 0)
+		{
+			DebugPrint("\r\n no blob result yet");
+			break;
+		}
+		DebugPrint("\r\n frame %lu, %lu cycles, %u runs, %u components%s",
+				blob.seq, blob.cycles, blob.runs, blob.components,
+				blob.overflow ? " (overflow)" : "");
+		for (uint32_t i = 0; i < blob.nblobs; i++)
+		{
+			DebugPrint("\r\n id %3u: %3u,%3u %3ux%3u c %3u,%3u area %lu",
+					blob.blob[i].id, blob.blob[i].x, blob.blob[i].y,
+					blob.blob[i].w, blob.blob[i].h, blob.blob[i].cx_q4 >> 4,
+					blob.blob[i].cy_q4 >> 4, blob.blob[i].area);
+		}
+	}
+		break;
+	case 20:
+	{
+		static CAM_BG_t bg;
+		if (!CAM_BG_isEnabled())
+		{
+			DebugPrint("\r\n background model enabled");
+			CAM_BG_Enable(1);
+			break;
+		}
+		if (CAM_BG_Get(&bg) == 0)
+		{
+			DebugPrint("\r\n no background result yet");
+			break;
+		}
+		DebugPrint("\r\n frame %lu, %lu cycles, %lu cells, %u.%u%%%s",
+				bg.seq, bg.cycles, bg.fg_cells, bg.coverage_pm / 10,
+				bg.coverage_pm % 10, bg.learning ? " (learning)" : "");
+		DebugPrint("\r\n box %3u,%3u %3ux%3u, relearns %lu",
+				bg.x, bg.y, bg.w, bg.h, bg.relearns);
+	}
+		break;
+	case 21:
+	{
+		/* Recording: freeze on the newest frame / back to live */
+		CAM_RecStats_t rec;
+
+		if (!CAM_Rec_isEnabled())
+		{
+			DebugPrint("\r\n recording enabled");
+			CAM_Rec_Enable(1);
+			break;
+		}
+		if (CAM_Rec_isFrozen())
+		{
+			CAM_Rec_Live();
+		}
+		else
+		{
+			CAM_Rec_Freeze();
+		}
+		CAM_Rec_GetStats(&rec);
+		DebugPrint("\r\n rec %s: %lu frames (%lu..%lu), %lu ms",
+				CAM_Rec_isFrozen() ? "frozen" : "live", rec.frames,
+				rec.oldest_seq, rec.newest_seq, rec.span_ms);
+		DebugPrint("\r\n %lu/%lu KB (raw %lu KB), skipped %lu, store %lu us",
+				rec.bytes / 1024, rec.cap / 1024, rec.raw_bytes / 1024,
+				rec.skipped, rec.store_us);
+	}
+		break;
+	case 22:
+	{
+		/* Replay from the oldest recorded frame */
+		if (!CAM_Rec_isFrozen())
+		{
+			CAM_Rec_Freeze();
+		}
+		CAM_Rec_Seek(-CAM_REC_MAX_FRAMES);
+		CAM_Rec_Play();
+		DebugPrint("\r\n replay");
+	}
+		break;
+	case 23:
+	{
+		/* One frame back, paused */
+		if (!CAM_Rec_isFrozen())
+		{
+			CAM_Rec_Freeze();
+		}
+		CAM_Rec_Seek(-1);
+	}
+		break;
+	case 24:
+	{
+		/* Camera to display latency since the last call */
+		static CAM_Lat_t lat;
+		static const char *name[CAM_LAT_STAGES] = { "queue", "copy", "scan", "total" };
+
+		CAM_Lat_Get(&lat);
+		CAM_Lat_Reset();
+		DebugPrint("\r\n frames %lu, shown %lu, dropped %lu, orphans %lu",
+				lat.frames, lat.shown, lat.dropped, lat.orphans);
+		for (uint32_t i = 0; i < CAM_LAT_STAGES; i++)
+		{
+			const CAM_LatHist_t *h = &lat.stage[i];
+			if (h->count == 0)
+			{
+				continue;
+			}
+			DebugPrint("\r\n %-5s %6lu %6lu p50 %6lu p99 %6lu max %6lu us",
+					name[i], h->min_us, (uint32_t)(h->sum_us / h->count),
+					CAM_Lat_Percentile(&lat, i, 500),
+					CAM_Lat_Percentile(&lat, i, 990), h->max_us);
+		}
+	}
+		break;
+	case 25:
+	{
+		/* The same text through the 1 bpp Paint path and the AA renderer, then a
+		 * two line sample */
+		static const char text[] = "Frame 1234 ABCDEFGHIJ";
+		const GUI_Text_Stats_t *st = GUI_Text_GetStats();
+		uint32_t dma2d = st->dma2d, cpu = st->cpu;
+		uint32_t t_paint, t_aa;
+
+		t_paint = VISION_CYCLES();
+		Paint_DrawString_EN(10, 400, text, &Font20, WHITE, BLACK);
+		t_paint = VISION_CYCLES() - t_paint;
+		t_aa = VISION_CYCLES();
+		GUI_Text_DrawString(10, 424, text, &Font20AA, BLACK);
+		t_aa = VISION_CYCLES() - t_aa;
+		DebugPrint("\r\n 1 bpp %lu us, AA %lu us (%lu DMA2D, %lu CPU glyphs)",
+				t_paint / (SystemCoreClock / 1000000), t_aa / (SystemCoreClock / 1000000),
+				st->dma2d - dma2d, st->cpu - cpu);
+		GUI_Text_DrawString(330, 400, "Anti-aliased text\nDejaVu Sans 20 A4", &Font20AA, BLUE);
+	}
+		break;
+	case 26:
+	{
+		/* GB2312 text from the CH_CN table and from the packed font */
+		static const char text[] = "\xCE\xA2\xD1\xA9\xB5\xE7\xD7\xD3\xC4\xE3\xBA\xC3";
+		const GUI_Text_Stats_t *st = GUI_Text_GetStats();
+		uint32_t hits = st->cache_hits, misses = st->cache_misses;
+		uint32_t t_table, t_packed;
+
+		t_table = VISION_CYCLES();
+		Paint_DrawString_CN(10, 360, text, &Font24CN, WHITE, BLACK);
+		t_table = VISION_CYCLES() - t_table;
+		t_packed = VISION_CYCLES();
+		GUI_Text_DrawStringPK(10, 400, text, &Font24CNP, BLACK);
+		t_packed = VISION_CYCLES() - t_packed;
+		DebugPrint("\r\n CH_CN %lu us, packed %lu us (cache %lu hit %lu miss)",
+				t_table / (SystemCoreClock / 1000000), t_packed / (SystemCoreClock / 1000000),
+				st->cache_hits - hits, st->cache_misses - misses);
+		GUI_Text_DrawStringPK(330, 360, "Packed \xCE\xA2\xD1\xA9\xB5\xE7\xD7\xD3", &Font24CNP, BLUE);
+	}
+		break;
+	case 27:
+	{
+		/* A label laid out once, then redrawn in another color */
+		static const char text[] = "Kerned, wrapped and centered text; cut with an ellipsis "
+				"when it doesn't fit the box";
+		static GUI_Layout_Glyph_t glyph[96];
+		static GUI_Layout_t label;
+		uint32_t t_layout, t_draw, t_redraw;
+
+		GUI_Layout_Init(&label, glyph, 96);
+		t_layout = VISION_CYCLES();
+		GUI_Layout_Text(&label, text, &Font20AA, 300, 48,
+				GUI_LAYOUT_WRAP | GUI_LAYOUT_ALIGN_CENTER | GUI_LAYOUT_ELLIPSIS);
+		t_layout = VISION_CYCLES() - t_layout;
+		t_draw = VISION_CYCLES();
+		GUI_Layout_Draw(&label, 480, 400, BLACK);
+		t_draw = VISION_CYCLES() - t_draw;
+		t_redraw = VISION_CYCLES();
+		GUI_Layout_Draw(&label, 480, 400, RED);
+		t_redraw = VISION_CYCLES() - t_redraw;
+		DebugPrint("\r\n layout %lu us, draw %lu us, redraw %lu us (%u glyphs%s)",
+				t_layout / (SystemCoreClock / 1000000), t_draw / (SystemCoreClock / 1000000),
+				t_redraw / (SystemCoreClock / 1000000), label.count, label.cut ? ", cut" : "");
+	}
+		break;
+	case 28:
+	{
+		/* The same 12 CJK glyphs: GB2312 table, UTF-8 looked up, UTF-8 laid out once */
+		static const char gb[] = "\xCE\xA2\xD1\xA9\xB5\xE7\xD7\xD3\xC4\xE3\xBA\xC3"
+				"\xCE\xA2\xD1\xA9\xB5\xE7\xD7\xD3\xC4\xE3\xBA\xC3";
+		static const char utf8[] = "\xE5\xBE\xAE\xE9\x9B\xAA\xE7\x94\xB5\xE5\xAD\x90"
+				"\xE4\xBD\xA0\xE5\xA5\xBD\xE5\xBE\xAE\xE9\x9B\xAA"
+				"\xE7\x94\xB5\xE5\xAD\x90\xE4\xBD\xA0\xE5\xA5\xBD";
+		static GUI_Layout_Glyph_t glyph[12];
+		static GUI_Layout_t label;
+		uint32_t t_gb, t_utf8, t_layout, t_cached;
+
+		t_gb = VISION_CYCLES();
+		Paint_DrawString_CN(10, 360, gb, &Font24CN, WHITE, BLACK);
+		t_gb = VISION_CYCLES() - t_gb;
+		t_utf8 = VISION_CYCLES();
+		GUI_Text_DrawUTF8(10, 410, utf8, &UI_Fonts, BLACK);
+		t_utf8 = VISION_CYCLES() - t_utf8;
+		GUI_Layout_Init(&label, glyph, 12);
+		t_layout = VISION_CYCLES();
+		GUI_Layout_TextFonts(&label, utf8, &UI_Fonts, 0, 0, GUI_LAYOUT_ALIGN_LEFT);
+		t_layout = VISION_CYCLES() - t_layout;
+		t_cached = VISION_CYCLES();
+		GUI_Layout_Draw(&label, 10, 440, RED);
+		t_cached = VISION_CYCLES() - t_cached;
+		DebugPrint("\r\n glyphs/s: GB2312 %lu, UTF-8 %lu, cached %lu",
+				(uint32_t)(12ULL * SystemCoreClock / t_gb), (uint32_t)(12ULL * SystemCoreClock / t_utf8),
+				(uint32_t)(12ULL * SystemCoreClock / t_cached));
+		DebugPrint("\r\n layout (lookups) %lu us", t_layout / (SystemCoreClock / 1000000));
+		/* Mixed scripts: Latin, degree sign, arrow and CJK from the fallbacks */
+		GUI_Text_DrawUTF8(600, 360, "UTF-8 25\xC2\xB0" "C \xE2\x86\x92 "
+				"\xE5\xBE\xAE\xE9\x9B\xAA\xE7\x94\xB5\xE5\xAD\x90", &UI_Fonts, BLUE);
+	}
+		break;
+	case 29:
+	{
+		/* Static labels: rendered glyph by glyph, then from the label cache */
+		static const char *const text[] = { "Speed", "km/h", "Temp 25\xC2\xB0" "C",
+				"\xE5\xBE\xAE\xE9\x9B\xAA\xE7\x94\xB5\xE5\xAD\x90" };
+		const GUI_Label_Stats_t *st = GUI_Label_GetStats();
+		uint32_t t_direct, t_a8, t_rgb;
+
+		t_direct = VISION_CYCLES();
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			GUI_Text_DrawUTF8(10 + i * 190, 360, text[i], &UI_Fonts, BLACK);
+		}
+		t_direct = VISION_CYCLES() - t_direct;
+		t_a8 = VISION_CYCLES();
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			GUI_Label_DrawFonts(10 + i * 190, 400, text[i], &UI_Fonts, RED, 0,
+					GUI_LABEL_A8);
+		}
+		t_a8 = VISION_CYCLES() - t_a8;
+		t_rgb = VISION_CYCLES();
+		for (uint32_t i = 0; i < 4; i++)
+		{
+			GUI_Label_DrawFonts(10 + i * 190, 440, text[i], &UI_Fonts, BLACK, CYAN,
+					GUI_LABEL_RGB565);
+		}
+		t_rgb = VISION_CYCLES() - t_rgb;
+		DebugPrint("\r\n direct %lu us, A8 %lu us, RGB565 %lu us",
+				t_direct / (SystemCoreClock / 1000000), t_a8 / (SystemCoreClock / 1000000),
+				t_rgb / (SystemCoreClock / 1000000));
+		DebugPrint("\r\n hits %lu misses %lu evict %lu bypass %lu, %lu B",
+				st->hits, st->misses, st->evictions, st->bypass, st->bytes);
+		DebugPrint("\r\n render %lu us, saved %lu us, blit errors %lu",
+				st->render_us, st->saved_us, st->blit_errors);
+	}
+		break;
+	case 30:
+	{
+		/* 100 updates of a counter and a clock: full redraw against changed cells */
+		static GUI_Readout_t num, clock;
+		PAINT_TIME time = { 0 };
+		uint32_t t_num, t_time, t_rnum, t_rtime, cells = 0;
+
+		GUI_Readout_Create(&num, 10, 440, &Font24, BLACK, WHITE, 6, 0);
+		GUI_Readout_Create(&clock, 200, 440, &Font24, BLACK, WHITE, 8, 0);
+		t_num = VISION_CYCLES();
+		for (int32_t i = 0; i < 100; i++)
+		{
+			Paint_DrawNum(10, 400, 123400 + i, &Font24, WHITE, BLACK);
+		}
+		t_num = VISION_CYCLES() - t_num;
+		t_time = VISION_CYCLES();
+		for (uint32_t i = 0; i < 100; i++)
+		{
+			time.Min = (UBYTE)(i / 60);
+			time.Sec = (UBYTE)(i % 60);
+			Paint_DrawTime(200, 400, &time, &Font24, WHITE, BLACK);
+		}
+		t_time = VISION_CYCLES() - t_time;
+		t_rnum = VISION_CYCLES();
+		for (int32_t i = 0; i < 100; i++)
+		{
+			cells += GUI_Readout_SetNumber(&num, 123400 + i);
+		}
+		t_rnum = VISION_CYCLES() - t_rnum;
+		t_rtime = VISION_CYCLES();
+		for (uint32_t i = 0; i < 100; i++)
+		{
+			cells += GUI_Readout_SetTime(&clock, 0, (uint8_t)(i / 60), (uint8_t)(i % 60));
+		}
+		t_rtime = VISION_CYCLES() - t_rtime;
+		DebugPrint("\r\n per update: DrawNum %lu cyc, readout %lu cyc",
+				t_num / 100, t_rnum / 100);
+		DebugPrint("\r\n per update: DrawTime %lu cyc, readout %lu cyc",
+				t_time / 100, t_rtime / 100);
+		DebugPrint("\r\n %lu cells drawn of 1400, strips built %lu",
+				cells, GUI_Readout_GetStats()->strip_builds);
+	}
+		break;
+	case 31:
+	{
+		/* Splash asset: ratio, decode speed into SDRAM and into the framebuffer */
+		static const struct { const char *name; const unsigned char *asset; } assets[] =
+		{
+			{ "800X221", gAsset_800X221 },
+		};
+		const GUI_Text_Surface_t *lcd = GUI_Text_GetSurface();
+
+		for (uint32_t i = 0; i < sizeof(assets) / sizeof(assets[0]); i++)
+		{
+			const IMAGE_Asset_Header_t *h = (const IMAGE_Asset_Header_t*)assets[i].asset;
+			uint32_t raw = (uint32_t)h->width * h->height * 2;
+			uint32_t t_sdram, t_lcd;
+			IMAGE_Asset_Status_t ret;
+
+			t_sdram = VISION_CYCLES();
+			ret = IMAGE_Asset_Draw(assets[i].asset, AssetDst, LCD_WIDTH, LCD_WIDTH, LCD_HEIGHT,
+					0, 0);
+			t_sdram = VISION_CYCLES() - t_sdram;
+			t_lcd = VISION_CYCLES();
+			IMAGE_Asset_Draw(assets[i].asset, lcd->base, lcd->stride, lcd->width, lcd->height,
+					0, 0);
+			t_lcd = VISION_CYCLES() - t_lcd;
+			DebugPrint("\r\n %s: %lu of %lu B (x%lu.%02lu), status %d", assets[i].name,
+					h->size + IMAGE_ASSET_HEADER_BYTES, raw,
+					raw / (h->size + IMAGE_ASSET_HEADER_BYTES),
+					raw % (h->size + IMAGE_ASSET_HEADER_BYTES) * 100
+					/ (h->size + IMAGE_ASSET_HEADER_BYTES), ret);
+			DebugPrint("\r\n  decode %lu MB/s to SDRAM, %lu MB/s to LCD",
+					(uint32_t)((uint64_t)raw * SystemCoreClock / t_sdram / 1000000),
+					(uint32_t)((uint64_t)raw * SystemCoreClock / t_lcd / 1000000));
+		}
+	}
+		break;
+	case 32:
+	{
+		/* QUADSPI asset store: index, lookup cost, the "splash" image */
+		const GUI_Text_Surface_t *lcd = GUI_Text_GetSurface();
+		const ASSET_Entry_t *e;
+		uint32_t t_find;
+
+		if (!ASSET_Store_isMounted())
+		{
+			DebugPrint("\r\n asset store: mount %d", ASSET_Store_MountQSPI());
+			break;
+		}
+		for (uint16_t i = 0; (e = ASSET_Store_Entry(i)) != NULL; i++)
+		{
+			DebugPrint("\r\n %u: %s type %u, %lu B", i, ASSET_Store_Name(e), e->type, e->size);
+		}
+		t_find = VISION_CYCLES();
+		e = ASSET_Store_Find("splash");
+		t_find = VISION_CYCLES() - t_find;
+		DebugPrint("\r\n find %lu cycles", t_find);
+		if ((e != NULL) && (e->type == ASSET_TYPE_IMAGE))
+		{
+			uint32_t t_draw = VISION_CYCLES();
+			int32_t ret = ASSET_Store_DrawImage(e, lcd->base, lcd->stride, lcd->width,
+					lcd->height, 0, 0);
+
+			t_draw = VISION_CYCLES() - t_draw;
+			DebugPrint("\r\n splash %ld, %lu us", ret, t_draw / (SystemCoreClock / 1000000));
+		}
+	}
+		break;
+	case 33:
+	{
+		/* Streaming decoders: the splash as a 24 bit BMP, bottom up then top
+		 * down, whole and in 512 B chunks; "splash.qoi" from the store if any */
+		static IMAGE_Dec_t dec;
+		const GUI_Text_Surface_t *lcd = GUI_Text_GetSurface();
+		const IMAGE_Asset_Header_t *h = (const IMAGE_Asset_Header_t*)gAsset_800X221;
+		const ASSET_Entry_t *e = ASSET_Store_Find("splash.qoi");
+		uint32_t w = h->width, rows = h->height, pitch = (w * 3 + 3) & ~3U;
+		uint32_t size = 54 + pitch * rows, raw = w * rows * 2;
+
+		IMAGE_Asset_Draw(gAsset_800X221, AssetDst, w, (uint16_t)w, (uint16_t)rows, 0, 0);
+		for (uint32_t td = 0; td < 2; td++)
+		{
+			const uint32_t fields[][2] =
+			{
+				{ 0, 0x4D42 }, { 2, size }, { 10, 54 }, { 14, 40 }, { 18, w },
+				{ 22, td ? (uint32_t)-(int32_t)rows : rows }, { 26, 1 | (24 << 16) },
+				{ 30, 0 }, { 34, pitch * rows }, { 38, 0 }, { 42, 0 }, { 46, 0 }, { 50, 0 },
+			};
+			VISION_ColorStats_t s0, s1;
+			uint32_t t_whole, t_chunk;
+			IMAGE_Dec_Status_t ret;
+
+			for (uint32_t i = 0; i < sizeof(fields) / sizeof(fields[0]); i++)
+			{
+				for (uint32_t b = 0; b < 4; b++)
+				{
+					DecFile[fields[i][0] + b] = (uint8_t)(fields[i][1] >> (b * 8));
+				}
+			}
+			for (uint32_t r = 0; r < rows; r++)
+			{
+				const uint16_t *px = &AssetDst[(td ? r : (rows - 1 - r)) * w];
+				uint8_t *out = &DecFile[54 + r * pitch];
+
+				for (uint32_t x = 0; x < w; x++)
+				{
+					*out++ = (uint8_t)(px[x] << 3);
+					*out++ = (uint8_t)((px[x] >> 3) & 0xFC);
+					*out++ = (uint8_t)((px[x] >> 8) & 0xF8);
+				}
+			}
+
+			VISION_Color_GetStats(&s0);
+			t_whole = VISION_CYCLES();
+			ret = IMAGE_Dec_Decode(&dec, DecFile, size, lcd->base, lcd->stride, lcd->width,
+					lcd->height, 0, 0);
+			t_whole = VISION_CYCLES() - t_whole;
+			VISION_Color_GetStats(&s1);
+			t_chunk = VISION_CYCLES();
+			IMAGE_Dec_Begin(&dec, IMAGE_DEC_AUTO, lcd->base, lcd->stride, lcd->width,
+					lcd->height, 0, 0);
+			for (uint32_t at = 0; at < size; at += 512)
+			{
+				if (IMAGE_Dec_Feed(&dec, &DecFile[at], (size - at < 512) ? size - at : 512)
+						!= IMAGE_DEC_NEED_MORE)
+				{
+					break;
+				}
+			}
+			t_chunk = VISION_CYCLES() - t_chunk;
+			DebugPrint("\r\n bmp24 %s: %lu B, status %d, dma2d jobs %lu",
+					td ? "top down" : "bottom up", size, ret, s1.dma2d_jobs - s0.dma2d_jobs);
+			DebugPrint("\r\n  %lu MB/s whole, %lu MB/s in 512 B chunks",
+					(uint32_t)((uint64_t)raw * SystemCoreClock / t_whole / 1000000),
+					(uint32_t)((uint64_t)raw * SystemCoreClock / t_chunk / 1000000));
+		}
+		if (e != NULL)
+		{
+			IMAGE_Dec_Info_t info;
+			uint32_t t_qoi = VISION_CYCLES();
+			IMAGE_Dec_Status_t ret = IMAGE_Dec_Decode(&dec, ASSET_Store_Data(e), e->size,
+					lcd->base, lcd->stride, lcd->width, lcd->height, 0, 0);
+
+			t_qoi = VISION_CYCLES() - t_qoi;
+			if (IMAGE_Dec_GetInfo(&dec, &info))
+			{
+				DebugPrint("\r\n qoi %lu x %lu: %lu B, status %d, %lu MB/s", info.width,
+						info.height, e->size, ret, (uint32_t)((uint64_t)info.width *
+						info.height * 2 * SystemCoreClock / t_qoi / 1000000));
+			}
+		}
+	}
+		break;
+	case 34:
+	{
+		/* Sprites over the splash: 8 keyed markers turning, a blended glow
+		 * above them, all moving for 200 renders */
+		static const int8_t dir[8][2] =
+		{
+			{ 9, 0 }, { 6, 6 }, { 0, 9 }, { -6, 6 }, { -9, 0 }, { -6, -6 }, { 0, -9 }, { 6, -6 },
+		};
+		static GUI_Sprite_Sheet_t keyed, glow;
+		static GUI_Sprite_t spr[9];
+		const GUI_Text_Surface_t *lcd = GUI_Text_GetSurface();
+		uint32_t total = 0, drawn = 0, jobs[2];
+
+		for (uint32_t f = 0; f < 8; f++)
+		{
+			for (int32_t y = 0; y < 32; y++)
+			{
+				for (int32_t x = 0; x < 32; x++)
+				{
+					int32_t dx = x - 16, dy = y - 16;
+					int32_t px = dx - dir[f][0], py = dy - dir[f][1];
+					uint16_t c = 0xF81F;
+
+					if (dx * dx + dy * dy < 14 * 14)
+					{
+						c = (px * px + py * py < 4 * 4) ? 0xFFE0 : 0x001F;
+					}
+					SpriteKeyed[y * 256 + f * 32 + x] = c;
+				}
+			}
+		}
+		for (int32_t y = 0; y < 48; y++)
+		{
+			for (int32_t x = 0; x < 48; x++)
+			{
+				int32_t d = (x - 24) * (x - 24) + (y - 24) * (y - 24);
+
+				SpriteGlow[y * 48 + x] = (d < 24 * 24) ?
+						((uint32_t)(255 - d * 255 / (24 * 24)) << 24) | 0xFFA000 : 0;
+			}
+		}
+
+		GUI_Sprite_Init();
+		GUI_Sprite_LoadSheet(&keyed, SpriteKeyed, VISION_COLOR_RGB565, 256 * 2, 256, 32,
+				32, 32, 0xF81F);
+		GUI_Sprite_LoadSheet(&glow, SpriteGlow, VISION_COLOR_ARGB8888, 48 * 4, 48, 48,
+				48, 48, GUI_SPRITE_NO_KEY);
+		IMAGE_Asset_Draw(gAsset_800X221, lcd->base, lcd->stride, lcd->width, lcd->height, 0, 0);
+		for (uint32_t i = 0; i < 8; i++)
+		{
+			GUI_Sprite_Create(&spr[i], &keyed, (int16_t)(40 + i * 90), 100, 0);
+			GUI_Sprite_Animate(&spr[i], 0, 8, (uint16_t)(40 + i * 10), 1);
+		}
+		GUI_Sprite_Create(&spr[8], &glow, 0, 90, 1);
+		GUI_Sprite_Render();
+		jobs[0] = GUI_Sprite_GetStats()->dma2d_jobs;
+		jobs[1] = GUI_Sprite_GetStats()->cpu_jobs;
+
+		for (uint32_t n = 0; n < 200; n++)
+		{
+			for (uint32_t i = 0; i < 8; i++)
+			{
+				GUI_Sprite_Move(&spr[i], spr[i].x, (int16_t)(100 + ((n + i * 8) % 64)));
+			}
+			GUI_Sprite_Move(&spr[8], (int16_t)(n * 4), 90);
+			drawn += GUI_Sprite_Render();
+			total += GUI_Sprite_GetStats()->last_us;
+			HAL_Delay(5);
+		}
+		DebugPrint("\r\n sprites: %lu drawn in 200 renders", drawn);
+		DebugPrint("\r\n  %lu us per render, max %lu us", total / 200,
+				GUI_Sprite_GetStats()->max_us);
+		DebugPrint("\r\n  dma2d jobs %lu, cpu jobs %lu, pool %lu B",
+				GUI_Sprite_GetStats()->dma2d_jobs - jobs[0],
+				GUI_Sprite_GetStats()->cpu_jobs - jobs[1], GUI_Sprite_GetStats()->pool_bytes);
+		for (uint32_t i = 0; i < 9; i++)
+		{
+			GUI_Sprite_Remove(&spr[i]);
+		}
 	}
 		break;
 	}
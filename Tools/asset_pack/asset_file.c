@@ -0,0 +1,48 @@
+/*
+ * asset_file.c
+ * Host asset store: a store file read in memory and mounted
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "asset_file.h"
+
+static uint8_t *Blob;
+
+ASSET_Store_Status_t ASSET_File_Mount(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    long size;
+
+    ASSET_File_Unmount();
+    if ((f == NULL) || (fseek(f, 0, SEEK_END) != 0) || ((size = ftell(f)) < 0))
+    {
+        if (f != NULL)
+        {
+            fclose(f);
+        }
+        return ASSET_STORE_ERR_HEADER;
+    }
+    rewind(f);
+    /* Aligned as the QUADSPI window is */
+    Blob = aligned_alloc(ASSET_STORE_ALIGN,
+            ((size_t)size + ASSET_STORE_ALIGN - 1U) & ~(size_t)(ASSET_STORE_ALIGN - 1U));
+    if ((Blob == NULL) || (fread(Blob, 1U, (size_t)size, f) != (size_t)size))
+    {
+        fclose(f);
+        ASSET_File_Unmount();
+        return ASSET_STORE_ERR_HEADER;
+    }
+    fclose(f);
+    return ASSET_Store_Mount(Blob, (uint32_t)size);
+}
+
+void ASSET_File_Unmount(void)
+{
+    /* Leaves the store unmounted */
+    static const uint8_t none[sizeof(ASSET_Store_Header_t)];
+
+    (void)ASSET_Store_Mount(none, sizeof(none));
+    free(Blob);
+    Blob = NULL;
+}
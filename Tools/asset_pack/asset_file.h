@@ -0,0 +1,16 @@
+/*
+ * asset_file.h
+ * Host asset store: a store file read in memory and mounted
+ * (User/image/asset_store.h), for the tools and host tests
+ */
+
+#ifndef ASSET_FILE_H_
+#define ASSET_FILE_H_
+
+#include "asset_store.h"
+
+/* Reads the file and mounts it; the memory is kept until the next call */
+extern ASSET_Store_Status_t ASSET_File_Mount(const char *path);
+extern void ASSET_File_Unmount(void);
+
+#endif /* ASSET_FILE_H_ */
@@ -0,0 +1,493 @@
+/*
+ * asset_pack.c
+ * Host packer of the asset store (User/image/asset_store.h)
+ *
+ * Builds one store blob from a manifest, one asset per line:
+ *   image   name  source    image asset: gAsset_* linked in, or a file
+ *                           written by img_pack -b
+ *   font    name  source    packed font: Font12CNP / Font24CNP linked in
+ *   strings name  file      one UTF-8 string per line
+ *   blob    name  file      bytes as they are
+ * ('#' starts a comment). The blob is mounted back from the file through
+ * the host store (asset_file.c) and every asset is found by name and
+ * compared: fonts glyph by glyph through fonts_pk.c, images decoded.
+ * Sizes and the QUADSPI use are reported on stderr. -l lists a store.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -IUser/image -IUser/Fonts -ITools/asset_pack -o asset_pack \
+ *       Tools/asset_pack/asset_pack.c Tools/asset_pack/asset_file.c \
+ *       User/image/asset_store.c User/image/image_asset.c \
+ *       User/image/asset_800X221.c User/Fonts/fonts_pk.c \
+ *       User/Fonts/font12CNP.c User/Fonts/font24CNP.c
+ * Run:
+ *   ./asset_pack -m assets.txt -o assets.bin
+ *   ./asset_pack -l assets.bin
+ * then program assets.bin at 0x90000000 with the board's external loader.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "asset_store.h"
+#include "asset_file.h"
+#include "image_asset.h"
+#include "fonts_pk.h"
+
+#define PACK_MAX_ASSETS               (1024U)
+#define PACK_LINE                     (1024U)
+#define PACK_BENCH_ROUNDS             (100000U)
+
+extern const unsigned char gAsset_800X221[];
+
+typedef struct
+{
+    char        name[128];
+    uint8_t     type;
+    uint8_t     format;
+    uint8_t     *data;
+    uint32_t    size;
+    uint32_t    hash;
+    const pFONT *font;            /* linked font, for the check */
+    uint32_t    name_at;
+    uint32_t    offset;
+} Pack_Asset_t;
+
+static const struct
+{
+    const char          *name;
+    const unsigned char *asset;
+} Images[] =
+{
+    { "gAsset_800X221", gAsset_800X221 },
+};
+
+static const struct
+{
+    const char  *name;
+    const pFONT *font;
+} Fonts[] =
+{
+    { "Font12CNP", &Font12CNP },
+    { "Font24CNP", &Font24CNP },
+};
+
+static Pack_Asset_t Asset[PACK_MAX_ASSETS];
+static uint32_t Count;
+
+static const char* const TypeName[] = { "blob", "image", "font", "strings" };
+
+static void Usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s -m manifest -o store.bin | -l store.bin\n", prog);
+    exit(1);
+}
+
+static uint8_t* ReadFile(const char *path, uint32_t *size)
+{
+    FILE *f = fopen(path, "rb");
+    uint8_t *d;
+    long n;
+
+    if ((f == NULL) || (fseek(f, 0, SEEK_END) != 0) || ((n = ftell(f)) < 0))
+    {
+        fprintf(stderr, "can't read %s\n", path);
+        exit(1);
+    }
+    rewind(f);
+    d = malloc((size_t)n + 1U);
+    if (fread(d, 1U, (size_t)n, f) != (size_t)n)
+    {
+        fprintf(stderr, "can't read %s\n", path);
+        exit(1);
+    }
+    fclose(f);
+    d[n] = 0U;
+    *size = (uint32_t)n;
+    return d;
+}
+
+static void Put32(uint8_t *p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+}
+
+static void LoadImage(Pack_Asset_t *a, const char *source)
+{
+    const IMAGE_Asset_Header_t *h;
+
+    for (uint32_t i = 0U; i < sizeof(Images) / sizeof(Images[0]); i++)
+    {
+        if (strcmp(Images[i].name, source) == 0)
+        {
+            h = (const IMAGE_Asset_Header_t*)Images[i].asset;
+            a->size = IMAGE_ASSET_HEADER_BYTES + h->size;
+            a->data = malloc(a->size);
+            memcpy(a->data, Images[i].asset, a->size);
+            a->format = h->compression;
+            return;
+        }
+    }
+    a->data = ReadFile(source, &a->size);
+    h = (const IMAGE_Asset_Header_t*)a->data;
+    if ((a->size < IMAGE_ASSET_HEADER_BYTES) || (h->magic != IMAGE_ASSET_MAGIC) ||
+        (a->size != (IMAGE_ASSET_HEADER_BYTES + h->size)))
+    {
+        fprintf(stderr, "%s: not an image asset\n", source);
+        exit(1);
+    }
+    a->format = h->compression;
+}
+
+/* pFONT without pointers, as asset_store.h lays it out */
+static void LoadFont(Pack_Asset_t *a, const char *source)
+{
+    const pFONT *f = NULL;
+    uint32_t codes, data;
+    uint8_t *p;
+
+    for (uint32_t i = 0U; i < sizeof(Fonts) / sizeof(Fonts[0]); i++)
+    {
+        if (strcmp(Fonts[i].name, source) == 0)
+        {
+            f = Fonts[i].font;
+        }
+    }
+    if (f == NULL)
+    {
+        fprintf(stderr, "no font %s\n", source);
+        exit(1);
+    }
+    codes = ((uint32_t)f->count * 2U + 3U) & ~3U;
+    data = f->offset[f->count];
+    a->size = 8U + codes + ((uint32_t)f->count + 1U) * 4U + data;
+    a->data = p = calloc(a->size, 1U);
+    p[0] = (uint8_t)f->count;
+    p[1] = (uint8_t)(f->count >> 8);
+    p[2] = f->width;
+    p[3] = f->ascii_width;
+    p[4] = f->height;
+    p[5] = f->run0_bits;
+    p[6] = f->run1_bits;
+    p += 8;
+    for (uint32_t i = 0U; i < f->count; i++)
+    {
+        p[i * 2U] = (uint8_t)f->code[i];
+        p[i * 2U + 1U] = (uint8_t)(f->code[i] >> 8);
+    }
+    p += codes;
+    for (uint32_t i = 0U; i <= f->count; i++)
+    {
+        Put32(p + i * 4U, f->offset[i]);
+    }
+    p += ((uint32_t)f->count + 1U) * 4U;
+    memcpy(p, f->data, data);
+    a->font = f;
+}
+
+/* Line i of the file is string i, empty lines included */
+static void LoadStrings(Pack_Asset_t *a, const char *path)
+{
+    uint32_t size, n = 0U, at;
+    uint8_t *text = ReadFile(path, &size);
+
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        n += (text[i] == '\n') ? 1U : 0U;
+    }
+    n += ((size != 0U) && (text[size - 1U] != '\n')) ? 1U : 0U;
+    a->data = calloc(4U + n * 4U + size + 1U, 1U);
+    Put32(a->data, n);
+    at = 4U + n * 4U;
+    for (uint32_t i = 0U, s = 0U; i < n; i++)
+    {
+        uint32_t e = s, len;
+
+        while ((e < size) && (text[e] != '\n'))
+        {
+            e++;
+        }
+        len = ((e > s) && (text[e - 1U] == '\r')) ? (e - s - 1U) : (e - s);
+        Put32(a->data + 4U + i * 4U, at);
+        memcpy(a->data + at, &text[s], len);
+        at += len + 1U;
+        s = e + 1U;
+    }
+    a->size = at;
+    free(text);
+}
+
+static void LoadManifest(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[PACK_LINE];
+    uint32_t n = 0U;
+
+    if (f == NULL)
+    {
+        fprintf(stderr, "can't read %s\n", path);
+        exit(1);
+    }
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        char type[16], name[128], source[PACK_LINE];
+        Pack_Asset_t *a = &Asset[Count];
+        int fields;
+
+        n++;
+        line[strcspn(line, "#\r\n")] = '\0';
+        fields = sscanf(line, "%15s %127s %1023s", type, name, source);
+        if (fields <= 0)
+        {
+            continue;
+        }
+        if ((fields != 3) || (Count == PACK_MAX_ASSETS))
+        {
+            fprintf(stderr, "%s:%u: type name source\n", path, n);
+            exit(1);
+        }
+        for (uint32_t i = 0U; i < Count; i++)
+        {
+            if (strcmp(Asset[i].name, name) == 0)
+            {
+                fprintf(stderr, "%s:%u: %s twice\n", path, n, name);
+                exit(1);
+            }
+        }
+        strcpy(a->name, name);
+        if (!strcmp(type, "image"))
+        {
+            a->type = ASSET_TYPE_IMAGE;
+            LoadImage(a, source);
+        }
+        else if (!strcmp(type, "font"))
+        {
+            a->type = ASSET_TYPE_FONT_PK;
+            LoadFont(a, source);
+        }
+        else if (!strcmp(type, "strings"))
+        {
+            a->type = ASSET_TYPE_STRINGS;
+            LoadStrings(a, source);
+        }
+        else if (!strcmp(type, "blob"))
+        {
+            a->type = ASSET_TYPE_BLOB;
+            a->data = ReadFile(source, &a->size);
+        }
+        else
+        {
+            fprintf(stderr, "%s:%u: unknown type %s\n", path, n, type);
+            exit(1);
+        }
+        a->hash = ASSET_Store_Hash(a->name);
+        Count++;
+    }
+    fclose(f);
+}
+
+static int ByHash(const void *l, const void *r)
+{
+    const Pack_Asset_t *a = l, *b = r;
+
+    if (a->hash != b->hash)
+    {
+        return (a->hash < b->hash) ? -1 : 1;
+    }
+    return strcmp(a->name, b->name);
+}
+
+static uint32_t Fnv(const uint8_t *p, uint32_t len)
+{
+    uint32_t hash = 2166136261U;
+
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        hash = (hash ^ p[i]) * 16777619U;
+    }
+    return hash;
+}
+
+static uint8_t* Build(uint32_t *size)
+{
+    uint32_t at = (uint32_t)(sizeof(ASSET_Store_Header_t) + Count * sizeof(ASSET_Entry_t));
+    ASSET_Store_Header_t h;
+    uint8_t *blob;
+
+    qsort(Asset, Count, sizeof(Asset[0]), ByHash);
+    for (uint32_t i = 0U; i < Count; i++)
+    {
+        Asset[i].name_at = at;
+        at += (uint32_t)strlen(Asset[i].name) + 1U;
+    }
+    for (uint32_t i = 0U; i < Count; i++)
+    {
+        at = (at + ASSET_STORE_ALIGN - 1U) & ~(ASSET_STORE_ALIGN - 1U);
+        Asset[i].offset = at;
+        at += Asset[i].size;
+    }
+    blob = calloc(at, 1U);
+    for (uint32_t i = 0U; i < Count; i++)
+    {
+        ASSET_Entry_t e;
+
+        e.hash = Asset[i].hash;
+        e.offset = Asset[i].offset;
+        e.size = Asset[i].size;
+        e.name = Asset[i].name_at;
+        e.type = Asset[i].type;
+        e.format = Asset[i].format;
+        e.reserved = 0U;
+        memcpy(blob + sizeof(h) + i * sizeof(e), &e, sizeof(e));
+        strcpy((char*)blob + Asset[i].name_at, Asset[i].name);
+        memcpy(blob + Asset[i].offset, Asset[i].data, Asset[i].size);
+    }
+    h.magic = ASSET_STORE_MAGIC;
+    h.version = ASSET_STORE_VERSION;
+    h.count = (uint16_t)Count;
+    h.size = at;
+    h.check = Fnv(blob + sizeof(h), (uint32_t)(Count * sizeof(ASSET_Entry_t)));
+    memcpy(blob, &h, sizeof(h));
+    *size = at;
+    return blob;
+}
+
+/* Every asset found by name in the mounted store and compared */
+static uint32_t Verify(void)
+{
+    static uint16_t line[2][IMAGE_ASSET_MAX_WIDTH * 4U];
+    static uint8_t cell_a[64U * 64U], cell_b[64U * 64U];
+    uint32_t bad = 0U;
+
+    for (uint32_t i = 0U; i < Count; i++)
+    {
+        const Pack_Asset_t *a = &Asset[i];
+        const ASSET_Entry_t *e = ASSET_Store_Find(a->name);
+        uint8_t ok = (e != NULL) && (e->type == a->type) && (e->size == a->size) &&
+                     !memcmp(ASSET_Store_Data(e), a->data, a->size);
+
+        if (ok && (a->type == ASSET_TYPE_IMAGE))
+        {
+            IMAGE_Asset_Decoder_t dec;
+
+            ok = (IMAGE_Asset_Open(&dec, ASSET_Store_Data(e)) == IMAGE_ASSET_OK) &&
+                 (dec.header->width <= IMAGE_ASSET_MAX_WIDTH * 4U);
+            for (uint32_t l = 0U; ok && (l < dec.header->height); l++)
+            {
+                ok = (IMAGE_Asset_NextLine(&dec, line[l & 1U]) == IMAGE_ASSET_OK);
+            }
+        }
+        if (ok && (a->type == ASSET_TYPE_FONT_PK))
+        {
+            pFONT f;
+            uint32_t pitch = (a->font->width + 1U) / 2U;
+
+            ok = ASSET_Store_FontPK(e, &f) && (f.count == a->font->count) &&
+                 ((pitch * a->font->height) <= sizeof(cell_a));
+            for (uint32_t g = 0U; ok && (g < f.count); g++)
+            {
+                const uint8_t *ga = FONT_PK_Find(&f, a->font->code[g]);
+
+                ok = (ga != NULL);
+                if (ok)
+                {
+                    FONT_PK_ExpandA4(&f, ga, cell_a, pitch);
+                    FONT_PK_ExpandA4(a->font, FONT_PK_Find(a->font, a->font->code[g]), cell_b,
+                            pitch);
+                    ok = !memcmp(cell_a, cell_b, pitch * a->font->height);
+                }
+            }
+        }
+        if (ok && (a->type == ASSET_TYPE_STRINGS))
+        {
+            uint32_t n;
+
+            memcpy(&n, a->data, 4U);
+            for (uint32_t s = 0U; ok && (s < n); s++)
+            {
+                uint32_t off;
+
+                memcpy(&off, a->data + 4U + s * 4U, 4U);
+                ok = (ASSET_Store_String(e, s) != NULL) &&
+                     !strcmp(ASSET_Store_String(e, s), (const char*)a->data + off);
+            }
+            ok = ok && (ASSET_Store_String(e, n) == NULL);
+        }
+        if (!ok)
+        {
+            fprintf(stderr, "%s: differs in the store\n", a->name);
+            bad++;
+        }
+    }
+    return bad;
+}
+
+static int List(const char *path)
+{
+    ASSET_Store_Status_t ret = ASSET_File_Mount(path);
+
+    if (ret != ASSET_STORE_OK)
+    {
+        fprintf(stderr, "%s: not a store (%d)\n", path, ret);
+        return 1;
+    }
+    for (uint16_t i = 0U; i < ASSET_Store_Count(); i++)
+    {
+        const ASSET_Entry_t *e = ASSET_Store_Entry(i);
+
+        printf("%08X %-8s %10u @ 0x%08X  %s\n", e->hash,
+                (e->type < 4U) ? TypeName[e->type] : "?", e->size,
+                ASSET_STORE_QSPI_BASE + e->offset, ASSET_Store_Name(e));
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    const char *manifest = NULL, *out = NULL;
+    uint32_t size, bad;
+    uint8_t *blob;
+    FILE *f;
+    clock_t t;
+
+    for (int i = 1; i + 1 < argc; i += 2)
+    {
+        if (!strcmp(argv[i], "-m"))      manifest = argv[i + 1];
+        else if (!strcmp(argv[i], "-o")) out = argv[i + 1];
+        else if (!strcmp(argv[i], "-l")) return List(argv[i + 1]);
+        else Usage(argv[0]);
+    }
+    if ((manifest == NULL) || (out == NULL))
+    {
+        Usage(argv[0]);
+    }
+    LoadManifest(manifest);
+    blob = Build(&size);
+    f = fopen(out, "wb");
+    if ((f == NULL) || (fwrite(blob, 1U, size, f) != size) || (fclose(f) != 0))
+    {
+        fprintf(stderr, "can't write %s\n", out);
+        return 1;
+    }
+
+    if (ASSET_File_Mount(out) != ASSET_STORE_OK)
+    {
+        fprintf(stderr, "%s doesn't mount\n", out);
+        return 1;
+    }
+    bad = Verify();
+    t = clock();
+    for (uint32_t r = 0U; (r < PACK_BENCH_ROUNDS) && (Count != 0U); r++)
+    {
+        (void)ASSET_Store_Find(Asset[r % Count].name);
+    }
+    t = clock() - t;
+    fprintf(stderr, "%u assets, %u bytes, %.3f%% of the QUADSPI window, %s\n", Count, size,
+            100.0 * size / ASSET_STORE_QSPI_SIZE, bad ? "CHECK FAILED" : "checked");
+    fprintf(stderr, "host lookup %.0f ns\n", 1e9 * t / CLOCKS_PER_SEC / PACK_BENCH_ROUNDS);
+    return bad ? 1 : 0;
+}
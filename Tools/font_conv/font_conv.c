@@ -0,0 +1,685 @@
+/*
+ * font_conv.c
+ * Host converter of TTF/BDF fonts to anti-aliased font tables (fonts_aa.h)
+ *
+ * Renders a set of characters with FreeType (any format it reads:
+ * TrueType/OpenType outlines are anti-aliased, BDF/PCF bitmap strikes come
+ * out with full or no coverage) and writes the aFONT tables as C: 4 or 8
+ * bit coverage per pixel, bitmaps cropped to the ink box, A4 lines padded
+ * to whole bytes with the left pixel in the low nibble. Pairs the font
+ * kerns by a pixel or more go to the kerning table (sets up to
+ * CONV_MAX_KERN_RANGE codes, the search is over all pairs).
+ *
+ * The set is made of Unicode ranges (-r, repeated) and of the characters
+ * of UTF-8 text files (-u, e.g. the UI strings of a language), 0x20-0x7E
+ * if none. Codes the font doesn't have are left out; a set that isn't one
+ * range gets the codepoint index (aFONT code). -t 12|24 takes the glyphs
+ * of the CH_CN font linked in instead of a font file (GB2312 codes mapped
+ * with iconv), all of them if no set is given.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -IUser/Fonts -o font_conv Tools/font_conv/font_conv.c \
+ *       User/Fonts/font12CN.c User/Fonts/font24CN.c \
+ *       $(pkg-config --cflags --libs freetype2)
+ * Run:
+ *   ./font_conv -s 20 -n Font20AA [-b 4|8] [-r 0x20-0x7E] [-u text] font.ttf > font20AA.c
+ *   ./font_conv -t 24 -n Font24CJK [-u text] > font24CJK.c
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <iconv.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include "fonts.h"
+
+#define CONV_MAX_GLYPHS               (0x10000U)
+#define CONV_MAX_KERN_RANGE           (512U)
+#define CONV_MAX_KERNS                (4096U)
+
+typedef struct
+{
+    uint32_t offset;
+    uint32_t width;
+    uint32_t height;
+    int32_t  left;
+    int32_t  top;
+    uint32_t advance;
+} Conv_Glyph_t;
+
+typedef struct
+{
+    uint32_t left;
+    uint32_t right;
+    int32_t  dx;
+} Conv_Kern_t;
+
+/* Coverage source of a glyph being stored */
+typedef struct
+{
+    const FT_Bitmap *bm;          /* FreeType, or */
+    const CH_CN *cn;              /* CH_CN cell */
+    uint32_t cn_pitch;
+    uint32_t x0;                  /* ink box in the cell */
+    uint32_t y0;
+} Conv_Source_t;
+
+static uint8_t Want[CONV_MAX_GLYPHS];
+static uint32_t Code[CONV_MAX_GLYPHS];
+static uint32_t CodeCount;
+static Conv_Glyph_t Glyph[CONV_MAX_GLYPHS];
+static Conv_Kern_t Kern[CONV_MAX_KERNS];
+static uint32_t KernCount;
+static uint8_t *Bitmap;
+static uint32_t BitmapSize;
+
+static void Usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s -n name [-b 4|8] [-r first-last]... [-u text]... "
+            "(-s px font | -t 12|24)\n", prog);
+    exit(1);
+}
+
+/* Coverage of pixel x of a FreeType bitmap line, 0..255 */
+static uint32_t Coverage(const FT_Bitmap *bm, const uint8_t *line, uint32_t x)
+{
+    switch (bm->pixel_mode)
+    {
+        case FT_PIXEL_MODE_MONO:
+            return (line[x >> 3] & (0x80U >> (x & 7U))) ? 255U : 0U;
+        case FT_PIXEL_MODE_GRAY:
+            return (bm->num_grays == 256) ? line[x] :
+                    (line[x] * 255U + (bm->num_grays - 2U) / 2U) / (bm->num_grays - 1U);
+        default:
+            return 0U;
+    }
+}
+
+static uint32_t SourceCoverage(const Conv_Source_t *src, uint32_t x, uint32_t y)
+{
+    if (src->bm != NULL)
+    {
+        return Coverage(src->bm, src->bm->buffer + (int32_t)y * src->bm->pitch, x);
+    }
+    x += src->x0;
+    y += src->y0;
+    return ((uint8_t)src->cn->matrix[y * src->cn_pitch + x / 8U] & (0x80U >> (x & 7U))) ? 255U : 0U;
+}
+
+static void Append(uint8_t byte)
+{
+    static uint32_t cap;
+
+    if (BitmapSize == cap)
+    {
+        cap = (cap == 0U) ? 4096U : cap * 2U;
+        Bitmap = realloc(Bitmap, cap);
+        if (Bitmap == NULL)
+        {
+            perror("realloc");
+            exit(1);
+        }
+    }
+    Bitmap[BitmapSize++] = byte;
+}
+
+/* Stores width x rows of coverage as the bitmap of g */
+static void Store(Conv_Glyph_t *g, uint32_t bpp, uint32_t width, uint32_t rows,
+        const Conv_Source_t *src)
+{
+    g->offset = BitmapSize;
+    g->height = rows;
+    /* A4: lines of whole bytes */
+    g->width = ((bpp == 4U) && (width & 1U)) ? (width + 1U) : width;
+    if ((width == 0U) || (rows == 0U))
+    {
+        g->width = 0U;
+        g->height = 0U;
+        return;
+    }
+
+    for (uint32_t y = 0U; y < rows; y++)
+    {
+        for (uint32_t x = 0U; x < g->width; x += (bpp == 4U) ? 2U : 1U)
+        {
+            uint32_t c0 = (x < width) ? SourceCoverage(src, x, y) : 0U;
+
+            if (bpp == 8U)
+            {
+                Append((uint8_t)c0);
+            }
+            else
+            {
+                uint32_t c1 = ((x + 1U) < width) ? SourceCoverage(src, x + 1U, y) : 0U;
+                Append((uint8_t)(((c0 * 15U + 127U) / 255U) |
+                        (((c1 * 15U + 127U) / 255U) << 4)));
+            }
+        }
+    }
+}
+
+static int Convert(FT_Face face, uint32_t code, uint32_t bpp, Conv_Glyph_t *g)
+{
+    Conv_Source_t src = { NULL, NULL, 0U, 0U, 0U };
+
+    if (FT_Load_Char(face, code, FT_LOAD_RENDER | FT_LOAD_TARGET_NORMAL) != 0)
+    {
+        return -1;
+    }
+    src.bm = &face->glyph->bitmap;
+    g->left = face->glyph->bitmap_left;
+    g->top = face->glyph->bitmap_top;
+    g->advance = (uint32_t)((face->glyph->advance.x + 32) >> 6);
+    Store(g, bpp, src.bm->width, src.bm->rows, &src);
+    return 0;
+}
+
+/* Unicode code of a CH_CN entry, 0 if iconv has none */
+static uint32_t TableCode(iconv_t cd, const CH_CN *c)
+{
+    char in[2] = { (char)c->index[0], (char)c->index[1] }, *pin = in;
+    char out[4], *pout = out;
+    size_t nin = 2U, nout = 4U;
+
+    if ((uint8_t)c->index[0] < 0x80U)
+    {
+        return (uint8_t)c->index[0];
+    }
+    if (iconv(cd, &pin, &nin, &pout, &nout) == (size_t)-1)
+    {
+        return 0U;
+    }
+    return (uint8_t)out[0] | ((uint8_t)out[1] << 8) | ((uint32_t)(uint8_t)out[2] << 16);
+}
+
+/* Ink box of a CH_CN cell: x0, y0, x1, y1 (x1 = x0: empty) */
+static void TableInk(const cFONT *font, const CH_CN *c, uint32_t box[4])
+{
+    uint32_t pitch = (font->Width + 7U) / 8U;
+
+    box[0] = font->Width;
+    box[1] = font->Height;
+    box[2] = 0U;
+    box[3] = 0U;
+    for (uint32_t y = 0U; y < font->Height; y++)
+    {
+        for (uint32_t x = 0U; x < font->Width; x++)
+        {
+            if ((uint8_t)c->matrix[y * pitch + x / 8U] & (0x80U >> (x & 7U)))
+            {
+                box[0] = (x < box[0]) ? x : box[0];
+                box[1] = (y < box[1]) ? y : box[1];
+                box[2] = (x >= box[2]) ? (x + 1U) : box[2];
+                box[3] = (y >= box[3]) ? (y + 1U) : box[3];
+            }
+        }
+    }
+    if (box[2] == 0U)
+    {
+        box[0] = box[1] = 0U;
+    }
+}
+
+/* Glyphs of a CH_CN font. The cell has no baseline: it is put an eighth of
+ * the ink height above the lowest ink line. Returns the ascent. */
+static int32_t LoadTable(const cFONT *font, uint32_t bpp, int all)
+{
+    const CH_CN *entry[CONV_MAX_GLYPHS] = { NULL };
+    uint32_t top = font->Height, bottom = 0U;
+    int32_t ascent;
+    iconv_t cd = iconv_open("UCS-4LE", "GB2312");
+
+    if (cd == (iconv_t)-1)
+    {
+        perror("iconv");
+        exit(1);
+    }
+    for (uint32_t n = 0U; n < font->size; n++)
+    {
+        uint32_t uc = TableCode(cd, &font->table[n]);
+        uint32_t box[4];
+
+        if ((uc == 0U) || (uc >= CONV_MAX_GLYPHS) || (!all && !Want[uc]) || (entry[uc] != NULL))
+        {
+            continue;
+        }
+        entry[uc] = &font->table[n];
+        TableInk(font, entry[uc], box);
+        if (box[2] != 0U)
+        {
+            top = (box[1] < top) ? box[1] : top;
+            bottom = (box[3] > bottom) ? box[3] : bottom;
+        }
+    }
+    iconv_close(cd);
+    ascent = (int32_t)bottom - (int32_t)((bottom - top + 4U) / 8U);
+
+    CodeCount = 0U;
+    for (uint32_t uc = 0U; uc < CONV_MAX_GLYPHS; uc++)
+    {
+        Conv_Glyph_t *g = &Glyph[CodeCount];
+        Conv_Source_t src = { NULL, entry[uc], (font->Width + 7U) / 8U, 0U, 0U };
+        uint32_t box[4];
+
+        if (entry[uc] == NULL)
+        {
+            if (Want[uc])
+            {
+                fprintf(stderr, "U+%04X: not in the table, left out\n", uc);
+            }
+            continue;
+        }
+        TableInk(font, entry[uc], box);
+        src.x0 = box[0];
+        src.y0 = box[1];
+        g->left = (int32_t)box[0];
+        g->top = ascent - (int32_t)box[1];
+        g->advance = (uc < 0x80U) ? font->ASCII_Width : font->Width;
+        Store(g, bpp, box[2] - box[0], box[3] - box[1], &src);
+        Code[CodeCount++] = uc;
+    }
+    return ascent;
+}
+
+/* Characters of a UTF-8 file into the set */
+static void WantText(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    int c;
+
+    if (f == NULL)
+    {
+        perror(path);
+        exit(1);
+    }
+    while ((c = fgetc(f)) != EOF)
+    {
+        uint32_t cp = (uint32_t)c, more = 0U;
+
+        if (c >= 0xF0)
+        {
+            cp = (uint32_t)c & 0x07U;
+            more = 3U;
+        }
+        else if (c >= 0xE0)
+        {
+            cp = (uint32_t)c & 0x0FU;
+            more = 2U;
+        }
+        else if (c >= 0xC0)
+        {
+            cp = (uint32_t)c & 0x1FU;
+            more = 1U;
+        }
+        for (; more != 0U; more--)
+        {
+            c = fgetc(f);
+            if ((c == EOF) || ((c & 0xC0) != 0x80))
+            {
+                fprintf(stderr, "%s: not UTF-8\n", path);
+                exit(1);
+            }
+            cp = (cp << 6) | ((uint32_t)c & 0x3FU);
+        }
+        if (cp >= CONV_MAX_GLYPHS)
+        {
+            fprintf(stderr, "%s: U+%X beyond the BMP, left out\n", path, cp);
+            continue;
+        }
+        Want[cp] = (cp >= 0x20U) ? 1U : 0U;
+    }
+    fclose(f);
+}
+
+/* Pixel kerning of every pair of the set, left then right ascending */
+static void Kerning(FT_Face face)
+{
+    if (!FT_HAS_KERNING(face))
+    {
+        return;
+    }
+    if (CodeCount > CONV_MAX_KERN_RANGE)
+    {
+        fprintf(stderr, "set too large, no kerning\n");
+        return;
+    }
+    for (uint32_t l = 0U; l < CodeCount; l++)
+    {
+        for (uint32_t r = 0U; r < CodeCount; r++)
+        {
+            FT_Vector v;
+            int32_t dx;
+
+            if (FT_Get_Kerning(face, FT_Get_Char_Index(face, Code[l]), FT_Get_Char_Index(face, Code[r]),
+                    FT_KERNING_UNFITTED, &v) != 0)
+            {
+                continue;
+            }
+            dx = (int32_t)((v.x + 32) >> 6);
+            if ((dx == 0) || (dx < -128) || (dx > 127))
+            {
+                continue;
+            }
+            if (KernCount == CONV_MAX_KERNS)
+            {
+                fprintf(stderr, "too many kerning pairs, rest dropped\n");
+                return;
+            }
+            Kern[KernCount].left = Code[l];
+            Kern[KernCount].right = Code[r];
+            Kern[KernCount].dx = dx;
+            KernCount++;
+        }
+    }
+}
+
+static uint32_t Digits(uint32_t v)
+{
+    uint32_t n = 1U;
+
+    while (v >= 10U)
+    {
+        v /= 10U;
+        n++;
+    }
+    return n;
+}
+
+static void PrintCode(uint32_t code)
+{
+    if ((code >= 0x20U) && (code < 0x7FU) && (code != '\\') && (code != '*'))
+    {
+        printf("0x%02X '%c'", code, code);
+    }
+    else if (code < 0x100U)
+    {
+        printf("0x%02X", code);
+    }
+    else
+    {
+        printf("U+%04X", code);
+    }
+}
+
+/* The set as ranges, for the file header */
+static void PrintRanges(void)
+{
+    uint32_t shown = 0U;
+
+    for (uint32_t i = 0U; i < CodeCount; shown++)
+    {
+        uint32_t j = i;
+
+        while (((j + 1U) < CodeCount) && (Code[j + 1U] == (Code[j] + 1U)))
+        {
+            j++;
+        }
+        if (shown == 4U)
+        {
+            printf(", ...");
+            break;
+        }
+        printf((Code[i] == Code[j]) ? "%s0x%02X" : "%s0x%02X-0x%02X", (i != 0U) ? ", " : "",
+                Code[i], Code[j]);
+        i = j + 1U;
+    }
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t px = 0U, bpp = 4U, table = 0U, sets = 0U;
+    int32_t ascent = 0, descent = 0;
+    const char *name = NULL, *path = NULL;
+    const cFONT *cn = NULL;
+    FT_Library lib = NULL;
+    FT_Face face = NULL;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((argv[i][0] != '-') && (path == NULL))
+        {
+            path = argv[i];
+            continue;
+        }
+        if ((argv[i][0] != '-') || (i + 1 >= argc))
+        {
+            Usage(argv[0]);
+        }
+        switch (argv[i][1])
+        {
+            case 's': px = (uint32_t)strtoul(argv[++i], NULL, 0); break;
+            case 'b': bpp = (uint32_t)strtoul(argv[++i], NULL, 0); break;
+            case 'n': name = argv[++i]; break;
+            case 't': table = (uint32_t)strtoul(argv[++i], NULL, 0); break;
+            case 'u': WantText(argv[++i]); sets++; break;
+            case 'r':
+            {
+                char *end;
+                uint32_t first = (uint32_t)strtoul(argv[++i], &end, 0);
+                uint32_t last = (*end == '-') ? (uint32_t)strtoul(end + 1, NULL, 0) : first;
+
+                if ((last < first) || (last >= CONV_MAX_GLYPHS))
+                {
+                    Usage(argv[0]);
+                }
+                memset(&Want[first], 1, last - first + 1U);
+                sets++;
+            }
+                break;
+            default:
+                Usage(argv[0]);
+        }
+    }
+    cn = (table == 12U) ? &Font12CN : ((table == 24U) ? &Font24CN : NULL);
+    if ((name == NULL) || ((bpp != 4U) && (bpp != 8U)) ||
+        ((cn == NULL) && ((path == NULL) || (px == 0U))) ||
+        ((cn != NULL) && (path != NULL)) || ((table != 0U) && (cn == NULL)))
+    {
+        Usage(argv[0]);
+    }
+
+    if (cn != NULL)
+    {
+        ascent = LoadTable(cn, bpp, sets == 0U);
+        descent = 0;
+    }
+    else
+    {
+        if (sets == 0U)
+        {
+            memset(&Want[0x20], 1, 0x7FU - 0x20U);
+        }
+        if ((FT_Init_FreeType(&lib) != 0) || (FT_New_Face(lib, path, 0, &face) != 0))
+        {
+            fprintf(stderr, "%s: can't open\n", path);
+            return 1;
+        }
+        if (FT_IS_SCALABLE(face))
+        {
+            FT_Set_Pixel_Sizes(face, 0, px);
+        }
+        else
+        {
+            /* Bitmap font: the strike closest to the size */
+            int best = 0;
+            for (int i = 1; i < face->num_fixed_sizes; i++)
+            {
+                if (abs(face->available_sizes[i].height - (int)px) <
+                        abs(face->available_sizes[best].height - (int)px))
+                {
+                    best = i;
+                }
+            }
+            FT_Select_Size(face, best);
+        }
+        ascent = (int32_t)((face->size->metrics.ascender + 63) >> 6);
+        descent = (int32_t)(-face->size->metrics.descender >> 6);
+
+        for (uint32_t code = 0U; code < CONV_MAX_GLYPHS; code++)
+        {
+            if (!Want[code])
+            {
+                continue;
+            }
+            if (FT_Get_Char_Index(face, code) == 0U)
+            {
+                fprintf(stderr, "U+%04X: not in the font, left out\n", code);
+                continue;
+            }
+            if (Convert(face, code, bpp, &Glyph[CodeCount]) != 0)
+            {
+                fprintf(stderr, "U+%04X: can't render\n", code);
+                return 1;
+            }
+            Code[CodeCount++] = code;
+        }
+    }
+    if (CodeCount == 0U)
+    {
+        fprintf(stderr, "no glyphs\n");
+        return 1;
+    }
+
+    for (uint32_t i = 0U; i < CodeCount; i++)
+    {
+        const Conv_Glyph_t *g = &Glyph[i];
+
+        /* Extend the line to the ink of every glyph */
+        ascent = ((g->height != 0U) && (g->top > ascent)) ? g->top : ascent;
+        descent = (((int32_t)g->height - g->top) > descent) ? ((int32_t)g->height - g->top) : descent;
+        if ((g->width > 255U) || (g->height > 255U) || (g->advance > 255U) ||
+                (g->left < -128) || (g->left > 127) || (g->top < -128) || (g->top > 127))
+        {
+            fprintf(stderr, "U+%04X: glyph too large for the format\n", Code[i]);
+            return 1;
+        }
+    }
+    if ((ascent + descent) > 255)
+    {
+        fprintf(stderr, "line too high for the format\n");
+        return 1;
+    }
+    if (face != NULL)
+    {
+        Kerning(face);
+    }
+
+    /* Font20AA -> font20AA.c */
+    printf("/*\n * %c%s.c\n * ", tolower(name[0]), name + 1);
+    if (cn != NULL)
+    {
+        printf("Font%uCN (CH_CN), A%u, ", table, bpp);
+    }
+    else
+    {
+        printf("%s %s %u px, A%u, ", face->family_name, face->style_name, px, bpp);
+    }
+    PrintRanges();
+    printf("\n *\n * Generated by Tools/font_conv, do not edit:\n *   font_conv");
+    for (int i = 1; i < argc; i++)
+    {
+        printf(" %s", strrchr(argv[i], '/') ? strrchr(argv[i], '/') + 1 : argv[i]);
+    }
+    printf("\n */\n\n");
+    printf("#include \"fonts_aa.h\"\n\n");
+
+    printf("static const uint8_t %s_Bitmap[%u] =\n{", name, BitmapSize);
+    for (uint32_t i = 0U; i < CodeCount; i++)
+    {
+        const Conv_Glyph_t *g = &Glyph[i];
+        uint32_t pitch = (bpp == 4U) ? (g->width / 2U) : g->width;
+
+        if (g->height == 0U)
+        {
+            continue;
+        }
+        printf("\n    /* ");
+        PrintCode(Code[i]);
+        printf(" %ux%u */", g->width, g->height);
+        for (uint32_t y = 0U; y < g->height; y++)
+        {
+            printf("\n   ");
+            for (uint32_t x = 0U; x < pitch; x++)
+            {
+                printf(" 0x%02X,", Bitmap[g->offset + y * pitch + x]);
+            }
+        }
+    }
+    printf("\n};\n\n");
+
+    printf("static const aGLYPH %s_Glyph[%u] =\n{\n", name, CodeCount);
+    printf("    /* offset, width, height, left, top, advance */\n");
+    for (uint32_t i = 0U; i < CodeCount; i++)
+    {
+        const Conv_Glyph_t *g = &Glyph[i];
+
+        printf("    { %5u, %3u, %3u, %3d, %3d, %3u },  /* ", g->offset, g->width,
+                g->height, g->left, g->top, g->advance);
+        PrintCode(Code[i]);
+        printf(" */\n");
+    }
+    printf("};\n\n");
+
+    /* One range: glyph[code - first], else the codepoint index */
+    if ((Code[CodeCount - 1U] - Code[0]) != (CodeCount - 1U))
+    {
+        printf("static const uint16_t %s_Code[%u] =\n{", name, CodeCount);
+        for (uint32_t i = 0U; i < CodeCount; i++)
+        {
+            printf((i % 8U) ? " 0x%04X," : "\n    0x%04X,", Code[i]);
+        }
+        printf("\n};\n\n");
+    }
+
+    if (KernCount != 0U)
+    {
+        printf("static const aKERN %s_Kern[%u] =\n{\n", name, KernCount);
+        for (uint32_t i = 0U; i < KernCount; i++)
+        {
+            printf("    { 0x%02X, 0x%02X, %3d },  /* ", Kern[i].left, Kern[i].right, Kern[i].dx);
+            PrintCode(Kern[i].left);
+            printf(" ");
+            PrintCode(Kern[i].right);
+            printf(" */\n");
+        }
+        printf("};\n\n");
+    }
+
+    printf("const aFONT %s =\n{\n", name);
+    printf("    %s_Bitmap,\n    %s_Glyph,\n", name, name);
+    if ((Code[CodeCount - 1U] - Code[0]) != (CodeCount - 1U))
+    {
+        printf("    %s_Code,\n", name);
+    }
+    else
+    {
+        printf("    NULL,\n");
+    }
+    printf("    0x%02X,%*s/* first */\n", Code[0], (Code[0] < 0x100U) ? 9 : 7, "");
+    printf("    %u,%*s/* count */\n", CodeCount, (int)(13U - Digits(CodeCount)), "");
+    printf("    %u,%*s/* bpp */\n", bpp, (int)(13U - Digits(bpp)), "");
+    printf("    %d,%*s/* height */\n", ascent + descent, (int)(13U - Digits((uint32_t)(ascent + descent))), "");
+    printf("    %d,%*s/* ascent */\n", ascent, (int)(13U - Digits((uint32_t)ascent)), "");
+    if (KernCount != 0U)
+    {
+        printf("    %s_Kern,\n", name);
+    }
+    else
+    {
+        printf("    NULL,\n");
+    }
+    printf("    %u,%*s/* kern_count */\n", KernCount, (int)(13U - Digits(KernCount)), "");
+    printf("};\n");
+
+    fprintf(stderr, "%s: %u glyphs, %u bitmap bytes, %u kerning pairs, line %d (ascent %d)\n",
+            name, CodeCount, BitmapSize, KernCount, ascent + descent, ascent);
+    if (face != NULL)
+    {
+        FT_Done_Face(face);
+        FT_Done_FreeType(lib);
+    }
+    return 0;
+}
@@ -0,0 +1,568 @@
+/*
+ * font_pack.c
+ * Host generator of the packed GB2312 fonts (User/Fonts/fonts_pk.h)
+ *
+ * Takes the glyphs of one of the CH_CN fonts linked in (-t 12 / -t 24) or
+ * renders ASCII and the GB2312 set with FreeType from any TTF/BDF font
+ * that has them (-f, codes mapped with iconv). Every glyph is cropped to
+ * its ink box; the run lengths bits are chosen for the smallest table and
+ * each glyph is stored raw or RLE, whichever is smaller. All glyphs are
+ * decoded back with fonts_pk.c and compared, then the flash used (CH_CN
+ * against packed) and the decode time per glyph are reported on stderr.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -IUser/Fonts -o font_pack Tools/font_pack/font_pack.c \
+ *       User/Fonts/fonts_pk.c User/Fonts/font12CN.c User/Fonts/font24CN.c \
+ *       $(pkg-config --cflags --libs freetype2)
+ * Run:
+ *   ./font_pack -t 24 -n Font24CNP > User/Fonts/font24CNP.c
+ *   ./font_pack -f font.ttf -s 24 [-w 24] [-a 12] [-g 1|2] -n Font24GB > font24GB.c
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <time.h>
+#include <iconv.h>
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include "fonts.h"
+#include "fonts_pk.h"
+
+#define PACK_MAX_GLYPHS               (8192U)
+#define PACK_MAX_CELL                 (255U)
+#define PACK_BENCH_ROUNDS             (200U)
+
+typedef struct
+{
+    uint16_t code;
+    uint8_t  *pix;                /* cell, one byte per pixel */
+    uint32_t offset;
+    uint32_t size;
+} Pack_Glyph_t;
+
+static Pack_Glyph_t Glyph[PACK_MAX_GLYPHS];
+static uint32_t Count;
+static uint32_t CellW, CellH, AsciiW;
+
+static uint8_t *Data;
+static uint32_t DataSize, DataCap;
+
+static void Usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s -n name (-t 12|24 | -f font -s px [-w cell] [-a ascii] [-g 1|2])\n",
+            prog);
+    exit(1);
+}
+
+static Pack_Glyph_t* NewGlyph(uint16_t code)
+{
+    for (uint32_t i = 0U; i < Count; i++)
+    {
+        if (Glyph[i].code == code)
+        {
+            return NULL;              /* first one wins, like Paint_DrawString_CN */
+        }
+    }
+    if (Count == PACK_MAX_GLYPHS)
+    {
+        fprintf(stderr, "too many glyphs\n");
+        exit(1);
+    }
+    Glyph[Count].code = code;
+    Glyph[Count].pix = calloc(CellW * CellH, 1U);
+    return &Glyph[Count++];
+}
+
+/* Glyphs of a CH_CN font */
+static void LoadTable(const cFONT *font)
+{
+    uint32_t pitch = (font->Width + 7U) / 8U;
+
+    CellW = font->Width;
+    CellH = font->Height;
+    AsciiW = font->ASCII_Width;
+    for (uint32_t n = 0U; n < font->size; n++)
+    {
+        const CH_CN *c = &font->table[n];
+        uint8_t b0 = (uint8_t)c->index[0], b1 = (uint8_t)c->index[1];
+        Pack_Glyph_t *g = NewGlyph((b0 < 0x80U) ? b0 : (uint16_t)((b0 << 8) | b1));
+
+        if (g == NULL)
+        {
+            continue;
+        }
+        for (uint32_t y = 0U; y < CellH; y++)
+        {
+            for (uint32_t x = 0U; x < CellW; x++)
+            {
+                g->pix[y * CellW + x] = ((uint8_t)c->matrix[y * pitch + x / 8U] >> (7U - (x & 7U))) & 1U;
+            }
+        }
+    }
+}
+
+/* ASCII, GB2312 symbols and level 1 (or both levels) rendered by FreeType */
+static void LoadFont(const char *path, uint32_t px, uint32_t levels)
+{
+    FT_Library lib;
+    FT_Face face;
+    iconv_t cd = iconv_open("UCS-4LE", "GB2312");
+    int32_t ascent;
+    uint32_t last = (levels == 2U) ? 0xF7U : 0xD7U;
+
+    if ((FT_Init_FreeType(&lib) != 0) || (FT_New_Face(lib, path, 0, &face) != 0) ||
+            (cd == (iconv_t)-1))
+    {
+        fprintf(stderr, "%s: can't open\n", path);
+        exit(1);
+    }
+    if (FT_IS_SCALABLE(face))
+    {
+        FT_Set_Pixel_Sizes(face, 0, px);
+    }
+    else
+    {
+        FT_Select_Size(face, 0);
+    }
+    ascent = (int32_t)((face->size->metrics.ascender + 63) >> 6);
+    CellH = (uint32_t)(ascent - (face->size->metrics.descender >> 6));
+    if ((CellW > PACK_MAX_CELL) || (CellH > PACK_MAX_CELL))
+    {
+        fprintf(stderr, "cell too large\n");
+        exit(1);
+    }
+
+    for (uint32_t code = 0x20U; code <= (last << 8 | 0xFEU); code++)
+    {
+        uint32_t uc = code;
+        const FT_Bitmap *bm;
+        Pack_Glyph_t *g;
+
+        if (code == 0x7FU)
+        {
+            code = 0xA1A0U;
+            continue;
+        }
+        if (code >= 0x100U)
+        {
+            char in[2] = { (char)(code >> 8), (char)code }, *pin = in;
+            char out[4], *pout = out;
+            size_t nin = 2U, nout = 4U;
+
+            if (((code & 0xFFU) < 0xA1U) || ((code & 0xFFU) == 0xFFU) ||
+                    (iconv(cd, &pin, &nin, &pout, &nout) == (size_t)-1))
+            {
+                continue;
+            }
+            uc = (uint8_t)out[0] | ((uint8_t)out[1] << 8) | ((uint32_t)(uint8_t)out[2] << 16);
+        }
+        if ((FT_Get_Char_Index(face, uc) == 0U) ||
+                (FT_Load_Char(face, uc, FT_LOAD_RENDER | FT_LOAD_TARGET_MONO) != 0))
+        {
+            continue;
+        }
+        bm = &face->glyph->bitmap;
+        g = NewGlyph((uint16_t)code);
+        for (uint32_t y = 0U; y < bm->rows; y++)
+        {
+            int32_t cy = ascent - face->glyph->bitmap_top + (int32_t)y;
+
+            for (uint32_t x = 0U; x < bm->width; x++)
+            {
+                int32_t cx = face->glyph->bitmap_left + (int32_t)x;
+
+                if ((cx >= 0) && (cx < (int32_t)CellW) && (cy >= 0) && (cy < (int32_t)CellH) &&
+                        (bm->buffer[(int32_t)y * bm->pitch + (int32_t)(x >> 3)] & (0x80U >> (x & 7U))))
+                {
+                    g->pix[cy * (int32_t)CellW + cx] = 1U;
+                }
+            }
+        }
+    }
+    iconv_close(cd);
+    FT_Done_Face(face);
+    FT_Done_FreeType(lib);
+}
+
+static int ByCode(const void *a, const void *b)
+{
+    return (int)((const Pack_Glyph_t*)a)->code - (int)((const Pack_Glyph_t*)b)->code;
+}
+
+static void InkBox(const Pack_Glyph_t *g, uint32_t box[4])
+{
+    uint32_t x0 = CellW, y0 = CellH, x1 = 0U, y1 = 0U;
+
+    for (uint32_t y = 0U; y < CellH; y++)
+    {
+        for (uint32_t x = 0U; x < CellW; x++)
+        {
+            if (g->pix[y * CellW + x])
+            {
+                x0 = (x < x0) ? x : x0;
+                y0 = (y < y0) ? y : y0;
+                x1 = (x > x1) ? x : x1;
+                y1 = (y > y1) ? y : y1;
+            }
+        }
+    }
+    if (x0 == CellW)
+    {
+        box[0] = box[1] = box[2] = box[3] = 0U;
+        return;
+    }
+    box[0] = x0;
+    box[1] = y0;
+    box[2] = x1 - x0 + 1U;
+    box[3] = y1 - y0 + 1U;
+}
+
+/* Bit writer over Data */
+static uint32_t Acc, AccBits;
+
+static void PutByte(uint8_t v)
+{
+    if (DataSize == DataCap)
+    {
+        DataCap = (DataCap == 0U) ? 65536U : DataCap * 2U;
+        Data = realloc(Data, DataCap);
+        if (Data == NULL)
+        {
+            perror("realloc");
+            exit(1);
+        }
+    }
+    Data[DataSize++] = v;
+}
+
+static void PutBits(uint32_t v, uint32_t n)
+{
+    Acc = (Acc << n) | v;
+    AccBits += n;
+    while (AccBits >= 8U)
+    {
+        AccBits -= 8U;
+        PutByte((uint8_t)(Acc >> AccBits));
+    }
+}
+
+static void FlushBits(void)
+{
+    if (AccBits != 0U)
+    {
+        PutBits(0U, 8U - AccBits);
+    }
+}
+
+/* RLE of the ink box, bits if out == 0, else written */
+static uint32_t Rle(const Pack_Glyph_t *g, const uint32_t box[4], uint32_t b0, uint32_t b1,
+        int out)
+{
+    uint32_t total = box[2] * box[3], max0 = (1U << b0) - 1U, max1 = (1U << b1) - 1U;
+    uint32_t pos = 0U, bits = 0U;
+
+#define PIX(p)  (g->pix[(box[1] + (p) / box[2]) * CellW + box[0] + (p) % box[2]])
+    while (pos < total)
+    {
+        uint32_t zeros = 0U, ones = 0U;
+
+        while ((pos < total) && !PIX(pos) && (zeros < max0))
+        {
+            zeros++;
+            pos++;
+        }
+        /* A longer background run goes on in the next pair */
+        if ((pos < total) && !PIX(pos))
+        {
+            ones = 0U;
+        }
+        else
+        {
+            while ((pos < total) && PIX(pos) && (ones < max1))
+            {
+                ones++;
+                pos++;
+            }
+        }
+        if (out)
+        {
+            PutBits(zeros, b0);
+            PutBits(ones, b1);
+        }
+        bits += b0 + b1;
+    }
+#undef PIX
+    return bits;
+}
+
+static uint32_t PackedBytes(const Pack_Glyph_t *g, uint32_t b0, uint32_t b1)
+{
+    uint32_t box[4], raw, rle;
+
+    InkBox(g, box);
+    raw = (box[2] * box[3] + 7U) / 8U;
+    rle = (Rle(g, box, b0, b1, 0) + 7U) / 8U;
+    return FONT_PK_HEADER_BYTES + ((rle < raw) ? rle : raw);
+}
+
+static void Pack(uint32_t b0, uint32_t b1)
+{
+    for (uint32_t i = 0U; i < Count; i++)
+    {
+        Pack_Glyph_t *g = &Glyph[i];
+        uint32_t box[4], raw, rle;
+
+        InkBox(g, box);
+        raw = (box[2] * box[3] + 7U) / 8U;
+        rle = (Rle(g, box, b0, b1, 0) + 7U) / 8U;
+        g->offset = DataSize;
+        PutByte((rle < raw) ? FONT_PK_FLAG_RLE : 0U);
+        for (uint32_t k = 0U; k < 4U; k++)
+        {
+            PutByte((uint8_t)box[k]);
+        }
+        if (rle < raw)
+        {
+            (void)Rle(g, box, b0, b1, 1);
+        }
+        else
+        {
+            for (uint32_t y = 0U; y < box[3]; y++)
+            {
+                for (uint32_t x = 0U; x < box[2]; x++)
+                {
+                    PutBits(g->pix[(box[1] + y) * CellW + box[0] + x], 1U);
+                }
+            }
+        }
+        FlushBits();
+        g->size = DataSize - g->offset;
+    }
+}
+
+/* Decode check and benchmark */
+static uint8_t *Check;
+
+static void CheckSpan(uint16_t x, uint16_t y, uint16_t len, void *user)
+{
+    (void)user;
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        Check[y * CellW + x + i]++;
+    }
+}
+
+static void CountSpan(uint16_t x, uint16_t y, uint16_t len, void *user)
+{
+    (void)x;
+    (void)y;
+    *(uint32_t*)user += len;
+}
+
+static void PrintField(uint32_t v, const char *comment)
+{
+    char num[16];
+
+    snprintf(num, sizeof(num), "%u,", v);
+    printf("    %-7s/* %s */\n", num, comment);
+}
+
+static void PrintCode(uint16_t code)
+{
+    if (code < 0x80U)
+    {
+        printf("0x%02X '%c'", code, ((code == '\\') || (code == '*')) ? '.' : code);
+    }
+    else
+    {
+        printf("0x%04X", code);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const char *name = NULL, *path = NULL;
+    uint32_t table = 0U, px = 0U, levels = 1U, w = 0U, a = 0U;
+    uint32_t best0 = 1U, best1 = 1U, best = UINT32_MAX, errors = 0U;
+    uint32_t flash_cn, flash_pk, sink = 0U, rle_glyphs = 0U;
+    uint16_t *codes;
+    uint32_t *offsets;
+    pFONT font;
+    clock_t t;
+    double ns_spans, ns_a4;
+    uint8_t *cell;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((argv[i][0] != '-') || (i + 1 >= argc))
+        {
+            Usage(argv[0]);
+        }
+        switch (argv[i][1])
+        {
+            case 'n': name = argv[++i]; break;
+            case 't': table = (uint32_t)strtoul(argv[++i], NULL, 0); break;
+            case 'f': path = argv[++i]; break;
+            case 's': px = (uint32_t)strtoul(argv[++i], NULL, 0); break;
+            case 'w': w = (uint32_t)strtoul(argv[++i], NULL, 0); break;
+            case 'a': a = (uint32_t)strtoul(argv[++i], NULL, 0); break;
+            case 'g': levels = (uint32_t)strtoul(argv[++i], NULL, 0); break;
+            default: Usage(argv[0]);
+        }
+    }
+    if ((name == NULL) || ((path == NULL) && (table != 12U) && (table != 24U)) ||
+            ((path != NULL) && (px == 0U)))
+    {
+        Usage(argv[0]);
+    }
+
+    if (path != NULL)
+    {
+        CellW = (w != 0U) ? w : px;
+        AsciiW = (a != 0U) ? a : (CellW + 1U) / 2U;
+        LoadFont(path, px, levels);
+    }
+    else
+    {
+        LoadTable((table == 12U) ? &Font12CN : &Font24CN);
+    }
+    if (Count == 0U)
+    {
+        fprintf(stderr, "no glyphs\n");
+        return 1;
+    }
+    qsort(Glyph, Count, sizeof(Glyph[0]), ByCode);
+
+    /* Run lengths bits for the smallest table */
+    for (uint32_t b0 = 1U; b0 <= 8U; b0++)
+    {
+        for (uint32_t b1 = 1U; b1 <= 8U; b1++)
+        {
+            uint32_t size = 0U;
+
+            for (uint32_t i = 0U; i < Count; i++)
+            {
+                size += PackedBytes(&Glyph[i], b0, b1);
+            }
+            if (size < best)
+            {
+                best = size;
+                best0 = b0;
+                best1 = b1;
+            }
+        }
+    }
+    Pack(best0, best1);
+
+    codes = malloc(Count * sizeof(uint16_t));
+    offsets = malloc((Count + 1U) * sizeof(uint32_t));
+    for (uint32_t i = 0U; i < Count; i++)
+    {
+        codes[i] = Glyph[i].code;
+        offsets[i] = Glyph[i].offset;
+        rle_glyphs += Data[Glyph[i].offset] & FONT_PK_FLAG_RLE;
+    }
+    offsets[Count] = DataSize;
+    font.data = Data;
+    font.code = codes;
+    font.offset = offsets;
+    font.count = (uint16_t)Count;
+    font.width = (uint8_t)CellW;
+    font.ascii_width = (uint8_t)AsciiW;
+    font.height = (uint8_t)CellH;
+    font.run0_bits = (uint8_t)best0;
+    font.run1_bits = (uint8_t)best1;
+
+    /* Every glyph back through the decoder */
+    Check = malloc(CellW * CellH);
+    for (uint32_t i = 0U; i < Count; i++)
+    {
+        const uint8_t *rec = FONT_PK_Find(&font, Glyph[i].code);
+
+        memset(Check, 0, CellW * CellH);
+        if ((rec == NULL) || (rec != Data + Glyph[i].offset))
+        {
+            errors++;
+            continue;
+        }
+        (void)FONT_PK_Spans(&font, rec, CheckSpan, NULL);
+        errors += (memcmp(Check, Glyph[i].pix, CellW * CellH) != 0) ? 1U : 0U;
+    }
+
+    cell = malloc(((CellW + 1U) / 2U) * CellH);
+    t = clock();
+    for (uint32_t r = 0U; r < PACK_BENCH_ROUNDS; r++)
+    {
+        for (uint32_t i = 0U; i < Count; i++)
+        {
+            (void)FONT_PK_Spans(&font, FONT_PK_Find(&font, Glyph[i].code), CountSpan, &sink);
+        }
+    }
+    ns_spans = (double)(clock() - t) * 1e9 / CLOCKS_PER_SEC / (PACK_BENCH_ROUNDS * Count);
+    t = clock();
+    for (uint32_t r = 0U; r < PACK_BENCH_ROUNDS; r++)
+    {
+        for (uint32_t i = 0U; i < Count; i++)
+        {
+            FONT_PK_ExpandA4(&font, FONT_PK_Find(&font, Glyph[i].code), cell, (CellW + 1U) / 2U);
+        }
+    }
+    ns_a4 = (double)(clock() - t) * 1e9 / CLOCKS_PER_SEC / (PACK_BENCH_ROUNDS * Count);
+
+    /* The table */
+    printf("/*\n * %c%s.c\n * Packed %ux%u font, %u glyphs, ", tolower(name[0]), name + 1,
+            CellW, CellH, Count);
+    if (path != NULL)
+    {
+        printf("%s %u px\n", strrchr(path, '/') ? strrchr(path, '/') + 1 : path, px);
+    }
+    else
+    {
+        printf("from Font%uCN\n", table);
+    }
+    printf(" *\n * Generated by Tools/font_pack, do not edit\n */\n\n");
+    printf("#include \"fonts_pk.h\"\n\n");
+    printf("static const uint8_t %s_Data[%u] =\n{", name, DataSize);
+    for (uint32_t i = 0U; i < Count; i++)
+    {
+        printf("\n    /* ");
+        PrintCode(Glyph[i].code);
+        printf(" */");
+        for (uint32_t k = 0U; k < Glyph[i].size; k++)
+        {
+            printf("%s 0x%02X,", ((k % 16U) == 0U) ? "\n   " : "", Data[Glyph[i].offset + k]);
+        }
+    }
+    printf("\n};\n\nstatic const uint16_t %s_Code[%u] =\n{", name, Count);
+    for (uint32_t i = 0U; i < Count; i++)
+    {
+        printf("%s 0x%04X,", ((i % 10U) == 0U) ? "\n   " : "", codes[i]);
+    }
+    printf("\n};\n\nstatic const uint32_t %s_Offset[%u] =\n{", name, Count + 1U);
+    for (uint32_t i = 0U; i <= Count; i++)
+    {
+        printf("%s %6u,", ((i % 10U) == 0U) ? "\n   " : "", offsets[i]);
+    }
+    printf("\n};\n\nconst pFONT %s =\n{\n", name);
+    printf("    %s_Data,\n    %s_Code,\n    %s_Offset,\n", name, name, name);
+    PrintField(Count, "count");
+    PrintField(CellW, "width");
+    PrintField(AsciiW, "ascii_width");
+    PrintField(CellH, "height");
+    PrintField(best0, "run0_bits");
+    PrintField(best1, "run1_bits");
+    printf("};\n");
+
+    flash_cn = Count * (uint32_t)sizeof(CH_CN);
+    flash_pk = DataSize + Count * 2U + (Count + 1U) * 4U + (uint32_t)sizeof(pFONT);
+    fprintf(stderr, "%s: %u glyphs %ux%u, %u RLE, runs %u/%u bits, %u decode errors\n",
+            name, Count, CellW, CellH, rle_glyphs, best0, best1, errors);
+    fprintf(stderr, "flash: CH_CN %u bytes, packed %u bytes (%u data), saved %.1f%%\n",
+            flash_cn, flash_pk, DataSize, 100.0 * (flash_cn - flash_pk) / flash_cn);
+    fprintf(stderr, "decode (host): spans %.0f ns/glyph, A4 cell %.0f ns/glyph\n",
+            ns_spans, ns_a4);
+    return (errors != 0U) ? 1 : 0;
+}
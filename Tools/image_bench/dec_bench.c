@@ -0,0 +1,555 @@
+/*
+ * dec_bench.c
+ * Host benchmark and robustness test of the QOI / BMP decoders
+ * (User/image/image_dec.c)
+ *
+ * Two pictures: the splash (gAsset_800X221 decoded, widened to 8 bit
+ * channels) and a synthetic 317x203 one with gradients, noise and an alpha
+ * channel. Each is encoded as QOI (RGB and RGBA) and as BMP in every
+ * supported flavour, then:
+ *  - decoded whole and at clipped positions on a surface with guard bands,
+ *    compared pixel for pixel with a reduction of the source;
+ *  - fed in random chunk sizes, down to one byte, and compared with the
+ *    whole decode;
+ *  - mutated (flipped bytes, header fields, truncation) and decoded again,
+ *    only the guard bands are checked - run it under the sanitizers;
+ *  - timed, whole and in 512 byte chunks.
+ * The on-target figures come from DebugMain case 33.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -IUser/image -IUser/Vision -o dec_bench Tools/image_bench/dec_bench.c \
+ *       User/image/image_dec.c User/image/image_asset.c User/image/asset_800X221.c \
+ *       User/Vision/vision_color.c User/Vision/vision_luma.c
+ * With -fsanitize=address,undefined -g for the robustness part.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "image.h"
+#include "image_asset.h"
+#include "image_dec.h"
+
+#define BENCH_SURFACE_W               (800U)
+#define BENCH_SURFACE_H               (480U)
+#define BENCH_GUARD                   (64U)       /* rows of guard above and below */
+#define BENCH_GUARD_PX                (0xA5C3U)
+#define BENCH_RUNS                    (20U)
+#define BENCH_CHUNK                   (512U)
+#define BENCH_CHUNK_TRIES             (20U)
+#define BENCH_FUZZ                    (3000U)
+
+typedef enum
+{
+    ENC_QOI3 = 0,
+    ENC_QOI4,
+    ENC_BMP24,                    /* bottom up */
+    ENC_BMP24_TD,                 /* top down */
+    ENC_BMP32,
+    ENC_BMP32_BF,                 /* bit fields, V4 header, top down */
+    ENC_BMP565,
+    ENC_BMP555,
+    ENC_COUNT
+} Bench_Enc_t;
+
+static const char *EncName[ENC_COUNT] =
+{
+    "qoi rgb", "qoi rgba", "bmp24", "bmp24 td", "bmp32", "bmp32 bf", "bmp565", "bmp555"
+};
+
+typedef struct
+{
+    uint32_t width, height;
+    uint8_t *rgba;                /* r, g, b, a */
+} Bench_Picture_t;
+
+typedef struct
+{
+    uint8_t *data;
+    uint32_t size, cap;
+} Bench_Buf_t;
+
+static uint16_t SurfaceMem[(BENCH_SURFACE_H + 2U * BENCH_GUARD) * BENCH_SURFACE_W];
+static uint16_t * const Surface = &SurfaceMem[BENCH_GUARD * BENCH_SURFACE_W];
+static uint16_t Expect[BENCH_SURFACE_H * BENCH_SURFACE_W];
+static uint16_t Whole[BENCH_SURFACE_H * BENCH_SURFACE_W];
+static IMAGE_Dec_t Dec;
+static uint32_t Seed = 12345U;
+
+static uint32_t Rand(void)
+{
+    Seed = Seed * 1664525U + 1013904223U;
+    return Seed >> 8;
+}
+
+static void Put(Bench_Buf_t *b, const void *p, uint32_t n)
+{
+    if (b->size + n > b->cap)
+    {
+        b->cap = (b->size + n) * 2U;
+        b->data = realloc(b->data, b->cap);
+    }
+    memcpy(b->data + b->size, p, n);
+    b->size += n;
+}
+
+static void Put8(Bench_Buf_t *b, uint32_t v)
+{
+    uint8_t c = (uint8_t)v;
+    Put(b, &c, 1U);
+}
+
+static void Put16(Bench_Buf_t *b, uint32_t v)
+{
+    Put8(b, v);
+    Put8(b, v >> 8);
+}
+
+static void Put32(Bench_Buf_t *b, uint32_t v)
+{
+    Put16(b, v);
+    Put16(b, v >> 16);
+}
+
+static void Put32Be(Bench_Buf_t *b, uint32_t v)
+{
+    Put8(b, v >> 24);
+    Put8(b, v >> 16);
+    Put8(b, v >> 8);
+    Put8(b, v);
+}
+
+/* Reference QOI encoder (qoiformat.org) */
+static void EncodeQoi(const Bench_Picture_t *pic, uint32_t channels, Bench_Buf_t *b)
+{
+    uint8_t index[64][4] = { { 0 } };
+    uint8_t prev[4] = { 0, 0, 0, 255 };
+    uint32_t run = 0U, n = pic->width * pic->height;
+
+    Put32Be(b, IMAGE_DEC_QOI_MAGIC);
+    Put32Be(b, pic->width);
+    Put32Be(b, pic->height);
+    Put8(b, channels);
+    Put8(b, 0U);
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        uint8_t px[4];
+
+        memcpy(px, &pic->rgba[i * 4U], 4U);
+        if (channels == 3U)
+        {
+            px[3] = 255U;
+        }
+        if (!memcmp(px, prev, 4U))
+        {
+            run++;
+            if ((run == 62U) || (i + 1U == n))
+            {
+                Put8(b, 0xC0U | (run - 1U));
+                run = 0U;
+            }
+            continue;
+        }
+        if (run != 0U)
+        {
+            Put8(b, 0xC0U | (run - 1U));
+            run = 0U;
+        }
+        {
+            uint32_t h = (px[0] * 3U + px[1] * 5U + px[2] * 7U + px[3] * 11U) & 63U;
+
+            if (!memcmp(index[h], px, 4U))
+            {
+                Put8(b, h);
+            }
+            else if (px[3] == prev[3])
+            {
+                int vr = (int8_t)(px[0] - prev[0]), vg = (int8_t)(px[1] - prev[1]);
+                int vb = (int8_t)(px[2] - prev[2]);
+                int vgr = vr - vg, vgb = vb - vg;
+
+                if ((vr > -3) && (vr < 2) && (vg > -3) && (vg < 2) && (vb > -3) && (vb < 2))
+                {
+                    Put8(b, 0x40U | ((vr + 2) << 4) | ((vg + 2) << 2) | (vb + 2));
+                }
+                else if ((vgr > -9) && (vgr < 8) && (vg > -33) && (vg < 32) &&
+                         (vgb > -9) && (vgb < 8))
+                {
+                    Put8(b, 0x80U | (vg + 32));
+                    Put8(b, ((vgr + 8) << 4) | (vgb + 8));
+                }
+                else
+                {
+                    Put8(b, 0xFEU);
+                    Put(b, px, 3U);
+                }
+                memcpy(index[h], px, 4U);
+            }
+            else
+            {
+                Put8(b, 0xFFU);
+                Put(b, px, 4U);
+                memcpy(index[h], px, 4U);
+            }
+        }
+        memcpy(prev, px, 4U);
+    }
+    Put32(b, 0U);
+    Put32Be(b, 1U);
+}
+
+static void EncodeBmp(const Bench_Picture_t *pic, Bench_Enc_t enc, Bench_Buf_t *b)
+{
+    uint32_t bits = (enc <= ENC_BMP24_TD) ? 24U : ((enc <= ENC_BMP32_BF) ? 32U : 16U);
+    uint32_t dib = (enc == ENC_BMP32_BF) ? 108U : 40U;
+    uint32_t masks = (enc == ENC_BMP565) ? 12U : 0U;
+    uint32_t row = (pic->width * bits + 31U) / 32U * 4U;
+    uint32_t data = 14U + dib + masks + ((enc == ENC_BMP24) ? 6U : 0U);  /* a gap too */
+    int top_down = (enc == ENC_BMP24_TD) || (enc == ENC_BMP32_BF);
+
+    Put16(b, IMAGE_DEC_BMP_MAGIC);
+    Put32(b, data + row * pic->height);
+    Put32(b, 0U);
+    Put32(b, data);
+    Put32(b, dib);
+    Put32(b, pic->width);
+    Put32(b, top_down ? (uint32_t)-(int32_t)pic->height : pic->height);
+    Put16(b, 1U);
+    Put16(b, bits);
+    Put32(b, ((enc == ENC_BMP32_BF) || (enc == ENC_BMP565)) ? 3U : 0U);
+    Put32(b, row * pic->height);
+    Put32(b, 2835U);
+    Put32(b, 2835U);
+    Put32(b, 0U);
+    Put32(b, 0U);
+    if (enc == ENC_BMP32_BF)
+    {
+        Put32(b, 0x00FF0000U);
+        Put32(b, 0x0000FF00U);
+        Put32(b, 0x000000FFU);
+        Put32(b, 0xFF000000U);
+        for (uint32_t i = 56U; i < dib; i++)
+        {
+            Put8(b, 0U);
+        }
+    }
+    if (enc == ENC_BMP565)
+    {
+        Put32(b, 0xF800U);
+        Put32(b, 0x07E0U);
+        Put32(b, 0x001FU);
+    }
+    while (b->size < data)
+    {
+        Put8(b, 0xEEU);
+    }
+    for (uint32_t r = 0U; r < pic->height; r++)
+    {
+        uint32_t y = top_down ? r : (pic->height - 1U - r);
+        uint32_t start = b->size;
+
+        for (uint32_t x = 0U; x < pic->width; x++)
+        {
+            const uint8_t *p = &pic->rgba[(y * pic->width + x) * 4U];
+
+            if (bits == 24U)
+            {
+                Put8(b, p[2]);
+                Put8(b, p[1]);
+                Put8(b, p[0]);
+            }
+            else if (bits == 32U)
+            {
+                Put8(b, p[2]);
+                Put8(b, p[1]);
+                Put8(b, p[0]);
+                Put8(b, p[3]);
+            }
+            else if (enc == ENC_BMP565)
+            {
+                Put16(b, ((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3));
+            }
+            else
+            {
+                Put16(b, ((p[0] >> 3) << 10) | ((p[1] >> 3) << 5) | (p[2] >> 3));
+            }
+        }
+        while ((b->size - start) < row)
+        {
+            Put8(b, 0U);
+        }
+    }
+}
+
+static uint16_t Reduce(const uint8_t *p, Bench_Enc_t enc)
+{
+    if (enc == ENC_BMP555)
+    {
+        uint32_t g5 = p[1] >> 3;
+        return (uint16_t)(((p[0] >> 3) << 11) | (((g5 << 1) | (g5 >> 4)) << 5) | (p[2] >> 3));
+    }
+    return (uint16_t)(((p[0] >> 3) << 11) | ((p[1] >> 2) << 5) | (p[2] >> 3));
+}
+
+/* What the surface must hold after a decode at (x, y) on a cleared one */
+static void Reference(const Bench_Picture_t *pic, Bench_Enc_t enc, int x, int y)
+{
+    memset(Expect, 0, sizeof(Expect));
+    for (uint32_t j = 0U; j < pic->height; j++)
+    {
+        for (uint32_t i = 0U; i < pic->width; i++)
+        {
+            int sx = x + (int)i, sy = y + (int)j;
+            const uint8_t *p = &pic->rgba[(j * pic->width + i) * 4U];
+
+            if ((sx < 0) || (sy < 0) || (sx >= (int)BENCH_SURFACE_W) ||
+                (sy >= (int)BENCH_SURFACE_H) || ((enc == ENC_QOI4) && (p[3] == 0U)))
+            {
+                continue;
+            }
+            Expect[sy * BENCH_SURFACE_W + sx] = Reduce(p, enc);
+        }
+    }
+}
+
+static void ClearSurface(void)
+{
+    for (uint32_t i = 0U; i < sizeof(SurfaceMem) / 2U; i++)
+    {
+        SurfaceMem[i] = BENCH_GUARD_PX;
+    }
+    memset(Surface, 0, BENCH_SURFACE_W * BENCH_SURFACE_H * 2U);
+}
+
+static int GuardsIntact(void)
+{
+    const uint16_t *below = Surface + BENCH_SURFACE_W * BENCH_SURFACE_H;
+
+    for (uint32_t i = 0U; i < BENCH_GUARD * BENCH_SURFACE_W; i++)
+    {
+        if ((SurfaceMem[i] != BENCH_GUARD_PX) || (below[i] != BENCH_GUARD_PX))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Feed in chunks of 1..max bytes (max 0: all at once) */
+static IMAGE_Dec_Status_t Decode(const Bench_Buf_t *b, uint32_t max, int x, int y)
+{
+    IMAGE_Dec_Status_t ret = IMAGE_DEC_NEED_MORE;
+    uint32_t at = 0U;
+
+    IMAGE_Dec_Begin(&Dec, IMAGE_DEC_AUTO, Surface, BENCH_SURFACE_W, BENCH_SURFACE_W,
+            BENCH_SURFACE_H, (int16_t)x, (int16_t)y);
+    while ((ret == IMAGE_DEC_NEED_MORE) && (at < b->size))
+    {
+        uint32_t n = (max == 0U) ? b->size : (1U + Rand() % max);
+
+        n = (n > (b->size - at)) ? (b->size - at) : n;
+        ret = IMAGE_Dec_Feed(&Dec, b->data + at, n);
+        at += n;
+    }
+    return ret;
+}
+
+static void Encode(const Bench_Picture_t *pic, Bench_Enc_t enc, Bench_Buf_t *b)
+{
+    b->size = 0U;
+    if (enc <= ENC_QOI4)
+    {
+        EncodeQoi(pic, (enc == ENC_QOI3) ? 3U : 4U, b);
+    }
+    else
+    {
+        EncodeBmp(pic, enc, b);
+    }
+}
+
+static int Check(const Bench_Picture_t *pic, Bench_Enc_t enc, const Bench_Buf_t *b)
+{
+    static const int pos[][2] = { { 0, 0 }, { -37, -11 }, { 500, 300 }, { -5, 400 },
+                                  { 790, -200 }, { 0, 479 }, { -2000, 0 } };
+    int ok = 1;
+
+    for (uint32_t k = 0U; k < sizeof(pos) / sizeof(pos[0]); k++)
+    {
+        IMAGE_Dec_Status_t ret;
+
+        Reference(pic, enc, pos[k][0], pos[k][1]);
+        ClearSurface();
+        ret = Decode(b, 0U, pos[k][0], pos[k][1]);
+        if ((ret != IMAGE_DEC_DONE) || memcmp(Surface, Expect, sizeof(Expect)) ||
+            !GuardsIntact())
+        {
+            fprintf(stderr, "%s at %d,%d: status %d, %s\n", EncName[enc], pos[k][0],
+                    pos[k][1], ret, GuardsIntact() ? "pixels differ" : "guard hit");
+            ok = 0;
+        }
+        memcpy(Whole, Surface, sizeof(Whole));
+        for (uint32_t t = 0U; t < BENCH_CHUNK_TRIES; t++)
+        {
+            uint32_t max = (t < 4U) ? (t + 1U) : (1U + Rand() % 4096U);
+
+            ClearSurface();
+            ret = Decode(b, max, pos[k][0], pos[k][1]);
+            if ((ret != IMAGE_DEC_DONE) || memcmp(Surface, Whole, sizeof(Whole)))
+            {
+                fprintf(stderr, "%s at %d,%d: chunks of %u: status %d\n", EncName[enc],
+                        pos[k][0], pos[k][1], max, ret);
+                ok = 0;
+                break;
+            }
+        }
+    }
+    return ok;
+}
+
+static int Fuzz(const Bench_Buf_t *b, uint32_t *errors)
+{
+    Bench_Buf_t m = { NULL, 0U, 0U };
+    int ok = 1;
+
+    for (uint32_t i = 0U; i < BENCH_FUZZ; i++)
+    {
+        uint32_t flips = 1U + Rand() % 8U;
+
+        m.size = 0U;
+        Put(&m, b->data, b->size);
+        for (uint32_t f = 0U; f < flips; f++)
+        {
+            /* Mostly in the headers, where the geometry is */
+            uint32_t at = (Rand() & 1U) ? (Rand() % 160U) : Rand();
+
+            m.data[at % m.size] ^= (uint8_t)(1U + Rand() % 255U);
+        }
+        if ((i % 4U) == 0U)
+        {
+            m.size = Rand() % m.size;
+        }
+        ClearSurface();
+        if (Decode(&m, (i & 1U) ? (1U + Rand() % 700U) : 0U,
+                (int)(Rand() % 1200U) - 200, (int)(Rand() % 800U) - 200) != IMAGE_DEC_DONE)
+        {
+            (*errors)++;
+        }
+        if (!GuardsIntact())
+        {
+            fprintf(stderr, "fuzz %u: guard hit\n", i);
+            ok = 0;
+            break;
+        }
+    }
+    free(m.data);
+    return ok;
+}
+
+/* ns per decode, whole file in one feed (chunk 0) or in fixed chunks */
+static double Time(const Bench_Buf_t *b, uint32_t chunk)
+{
+    struct timespec t0, t1;
+
+    chunk = (chunk == 0U) ? b->size : chunk;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (uint32_t r = 0U; r < BENCH_RUNS; r++)
+    {
+        IMAGE_Dec_Status_t ret = IMAGE_DEC_NEED_MORE;
+
+        IMAGE_Dec_Begin(&Dec, IMAGE_DEC_AUTO, Surface, BENCH_SURFACE_W, BENCH_SURFACE_W,
+                BENCH_SURFACE_H, 0, 0);
+        for (uint32_t at = 0U; (ret == IMAGE_DEC_NEED_MORE) && (at < b->size); at += chunk)
+        {
+            ret = IMAGE_Dec_Feed(&Dec, b->data + at,
+                    ((b->size - at) < chunk) ? (b->size - at) : chunk);
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / BENCH_RUNS;
+}
+
+static void MakeSplash(Bench_Picture_t *pic)
+{
+    const IMAGE_Asset_Header_t *h = (const IMAGE_Asset_Header_t*)gAsset_800X221;
+    uint16_t *px;
+
+    pic->width = h->width;
+    pic->height = h->height;
+    px = malloc(pic->width * pic->height * 2U);
+    pic->rgba = malloc(pic->width * pic->height * 4U);
+    IMAGE_Asset_Draw(gAsset_800X221, px, pic->width, (uint16_t)pic->width,
+            (uint16_t)pic->height, 0, 0);
+    for (uint32_t i = 0U; i < pic->width * pic->height; i++)
+    {
+        uint32_t r = px[i] >> 11, g = (px[i] >> 5) & 63U, b = px[i] & 31U;
+
+        pic->rgba[i * 4U] = (uint8_t)((r << 3) | (r >> 2));
+        pic->rgba[i * 4U + 1U] = (uint8_t)((g << 2) | (g >> 4));
+        pic->rgba[i * 4U + 2U] = (uint8_t)((b << 3) | (b >> 2));
+        pic->rgba[i * 4U + 3U] = 255U;
+    }
+    free(px);
+}
+
+/* Gradients (DIFF, LUMA), flat areas (RUN, INDEX), noise (RGB) and alpha */
+static void MakeSynthetic(Bench_Picture_t *pic)
+{
+    pic->width = 317U;
+    pic->height = 203U;
+    pic->rgba = malloc(pic->width * pic->height * 4U);
+    for (uint32_t y = 0U; y < pic->height; y++)
+    {
+        for (uint32_t x = 0U; x < pic->width; x++)
+        {
+            uint8_t *p = &pic->rgba[(y * pic->width + x) * 4U];
+            uint32_t zone = (x / 64U + y / 50U) % 4U;
+
+            p[0] = (uint8_t)((zone == 0U) ? x : ((zone == 1U) ? 200U : Rand()));
+            p[1] = (uint8_t)((zone == 0U) ? (y + x / 3U) : ((zone == 1U) ? 40U : Rand()));
+            p[2] = (uint8_t)((zone == 3U) ? ((x * y) >> 4) : (255U - y));
+            p[3] = (uint8_t)(((x / 8U + y / 8U) % 5U == 0U) ? 0U :
+                    (((x + y) % 7U == 0U) ? Rand() : 255U));
+        }
+    }
+}
+
+int main(void)
+{
+    Bench_Picture_t pics[2];
+    const char *names[2] = { "splash", "synthetic" };
+    Bench_Buf_t b = { NULL, 0U, 0U };
+    int fail = 0;
+
+    MakeSplash(&pics[0]);
+    MakeSynthetic(&pics[1]);
+    printf("%-10s %-9s %9s %7s %9s %9s %7s %s\n", "picture", "format", "bytes", "ratio",
+            "MB/s", "MB/s 512", "fuzz", "check");
+    for (uint32_t p = 0U; p < 2U; p++)
+    {
+        double raw = pics[p].width * pics[p].height * 2.0;
+
+        for (uint32_t e = 0U; e < ENC_COUNT; e++)
+        {
+            uint32_t errors = 0U;
+            double whole, chunked;
+            int ok;
+
+            Encode(&pics[p], (Bench_Enc_t)e, &b);
+            ok = Check(&pics[p], (Bench_Enc_t)e, &b);
+            ok &= Fuzz(&b, &errors);
+            Encode(&pics[p], (Bench_Enc_t)e, &b);
+            whole = Time(&b, 0U);
+            chunked = Time(&b, BENCH_CHUNK);
+            printf("%-10s %-9s %9u %6.2f:1 %9.1f %9.1f %6.1f%% %s\n", names[p], EncName[e],
+                    b.size, raw / b.size, raw / whole * 1e3, raw / chunked * 1e3,
+                    errors * 100.0 / BENCH_FUZZ, ok ? "ok" : "FAIL");
+            fail |= !ok;
+        }
+    }
+    free(pics[0].rgba);
+    free(pics[1].rgba);
+    free(b.data);
+    return fail;
+}
@@ -0,0 +1,345 @@
+/*
+ * img_pack.c
+ * Host encoder of the compressed image assets (User/image/image_asset.h)
+ *
+ * Takes a gImage_* table linked in (-g, Image2Lcd RGB565, low byte first,
+ * -s bytes of header to skip), a raw RGB565 little endian file (-r) or a
+ * binary PPM (-p, converted to RGB565) and writes the asset as a C array.
+ * Every line is coded with the cheapest token at each column (longest of
+ * UP, REPEAT and FILL, else literal); the asset is stored RLE or raw,
+ * whichever is smaller. The asset is decoded back with image_asset.c and
+ * compared, then the sizes, the ratio and the decode speed are reported
+ * on stderr. With -b the asset is also written as a binary file, for the
+ * asset store (Tools/asset_pack).
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -IUser/image -o img_pack Tools/img_pack/img_pack.c \
+ *       User/image/image_asset.c User/image/image.c User/image/image1.c
+ * Run:
+ *   ./img_pack -g gImage_800X221 -w 800 -h 221 -s 8 -n gAsset_800X221 \
+ *       > User/image/asset_800X221.c
+ *   ./img_pack -p splash.ppm -n gAsset_splash > asset_splash.c
+ *   ./img_pack -p splash.ppm -n gAsset_splash -b splash.img > /dev/null
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "image.h"
+#include "image_asset.h"
+
+#define PACK_BENCH_ROUNDS             (50U)
+#define PACK_MIN_FILL                 (3U)    /* token and pixel: 3 bytes */
+#define PACK_MIN_RUN                  (2U)    /* UP, REPEAT: 1 byte */
+
+static const struct
+{
+    const char          *name;
+    const unsigned char *data;
+} Tables[] =
+{
+    { "gImage_800X221", gImage_800X221 },
+    { "gImage_wu",      gImage_wu },
+};
+
+static uint16_t *Pix;
+static uint32_t Width, Height;
+
+static uint8_t *Out;
+static uint32_t OutSize, OutCap;
+
+static void Usage(const char *prog)
+{
+    fprintf(stderr, "usage: %s -n name (-g table -w w -h h [-s skip] | -r file -w w -h h |"
+            " -p file.ppm) [-b file.img]\n", prog);
+    exit(1);
+}
+
+static void Put(uint8_t b)
+{
+    if (OutSize == OutCap)
+    {
+        OutCap = OutCap ? OutCap * 2U : 65536U;
+        Out = realloc(Out, OutCap);
+    }
+    Out[OutSize++] = b;
+}
+
+static void PutPixel(uint16_t p)
+{
+    Put((uint8_t)p);
+    Put((uint8_t)(p >> 8));
+}
+
+static void PutToken(uint8_t op, uint32_t n)
+{
+    n--;
+    if (n < IMAGE_ASSET_COUNT_MASK)
+    {
+        Put((uint8_t)(op | n));
+        return;
+    }
+    Put((uint8_t)(op | IMAGE_ASSET_COUNT_MASK));
+    n -= IMAGE_ASSET_COUNT_MASK;
+    while (n >= 255U)
+    {
+        Put(255U);
+        n -= 255U;
+    }
+    Put((uint8_t)n);
+}
+
+static void FlushLiteral(const uint16_t *line, uint32_t from, uint32_t to)
+{
+    if (to > from)
+    {
+        PutToken(IMAGE_ASSET_OP_LITERAL, to - from);
+        for (uint32_t i = from; i < to; i++)
+        {
+            PutPixel(line[i]);
+        }
+    }
+}
+
+static void EncodeLine(const uint16_t *line, const uint16_t *prev)
+{
+    uint32_t x = 0U, lit = 0U;
+
+    while (x < Width)
+    {
+        uint32_t up = 0U, rep = 0U, fill = 1U;
+
+        while ((prev != NULL) && ((x + up) < Width) && (line[x + up] == prev[x + up]))
+        {
+            up++;
+        }
+        while ((x > 0U) && ((x + rep) < Width) && (line[x + rep] == line[x - 1U]))
+        {
+            rep++;
+        }
+        while (((x + fill) < Width) && (line[x + fill] == line[x]))
+        {
+            fill++;
+        }
+
+        if ((up >= PACK_MIN_RUN) && (up >= rep) && (up >= fill))
+        {
+            FlushLiteral(line, lit, x);
+            PutToken(IMAGE_ASSET_OP_UP, up);
+            x += up;
+            lit = x;
+        }
+        else if ((rep >= PACK_MIN_RUN) && (rep >= fill))
+        {
+            FlushLiteral(line, lit, x);
+            PutToken(IMAGE_ASSET_OP_REPEAT, rep);
+            x += rep;
+            lit = x;
+        }
+        else if (fill >= PACK_MIN_FILL)
+        {
+            FlushLiteral(line, lit, x);
+            PutToken(IMAGE_ASSET_OP_FILL, fill);
+            PutPixel(line[x]);
+            x += fill;
+            lit = x;
+        }
+        else
+        {
+            x++;
+        }
+    }
+    FlushLiteral(line, lit, Width);
+}
+
+static void LoadTable(const char *name, uint32_t skip)
+{
+    for (uint32_t i = 0U; i < sizeof(Tables) / sizeof(Tables[0]); i++)
+    {
+        if (strcmp(Tables[i].name, name) == 0)
+        {
+            const unsigned char *d = Tables[i].data + skip;
+
+            Pix = malloc(Width * Height * 2U);
+            for (uint32_t p = 0U; p < Width * Height; p++)
+            {
+                Pix[p] = (uint16_t)(d[p * 2U] | (d[p * 2U + 1U] << 8));
+            }
+            return;
+        }
+    }
+    fprintf(stderr, "no table %s\n", name);
+    exit(1);
+}
+
+static void LoadRaw(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+
+    Pix = malloc(Width * Height * 2U);
+    if ((f == NULL) || (fread(Pix, 2U, Width * Height, f) != (Width * Height)))
+    {
+        fprintf(stderr, "can't read %u x %u pixels from %s\n", Width, Height, path);
+        exit(1);
+    }
+    fclose(f);
+}
+
+static void LoadPPM(const char *path)
+{
+    FILE *f = fopen(path, "rb");
+    unsigned w, h, max;
+
+    if ((f == NULL) || (fscanf(f, "P6 %u %u %u", &w, &h, &max) != 3) || (max != 255U) ||
+        (fgetc(f) == EOF))
+    {
+        fprintf(stderr, "%s: not an 8 bit binary PPM\n", path);
+        exit(1);
+    }
+    Width = w;
+    Height = h;
+    Pix = malloc(Width * Height * 2U);
+    for (uint32_t p = 0U; p < Width * Height; p++)
+    {
+        int r = fgetc(f), g = fgetc(f), b = fgetc(f);
+
+        if (b == EOF)
+        {
+            fprintf(stderr, "%s: short\n", path);
+            exit(1);
+        }
+        Pix[p] = (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+    }
+    fclose(f);
+}
+
+int main(int argc, char **argv)
+{
+    const char *name = NULL, *table = NULL, *raw = NULL, *ppm = NULL, *bin = NULL;
+    uint32_t skip = 0U, rle_size;
+    IMAGE_Asset_Header_t h;
+    uint8_t *asset;
+    uint16_t *back;
+    clock_t t;
+    double s;
+
+    for (int i = 1; i < argc; i++)
+    {
+        const char *v = (i + 1 < argc) ? argv[i + 1] : NULL;
+
+        if (v == NULL)
+        {
+            Usage(argv[0]);
+        }
+        if (!strcmp(argv[i], "-n"))      name = v;
+        else if (!strcmp(argv[i], "-g")) table = v;
+        else if (!strcmp(argv[i], "-r")) raw = v;
+        else if (!strcmp(argv[i], "-p")) ppm = v;
+        else if (!strcmp(argv[i], "-w")) Width = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(argv[i], "-h")) Height = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(argv[i], "-s")) skip = (uint32_t)strtoul(v, NULL, 0);
+        else if (!strcmp(argv[i], "-b")) bin = v;
+        else Usage(argv[0]);
+        i++;
+    }
+    if ((name == NULL) || ((table == NULL) + (raw == NULL) + (ppm == NULL) != 2) ||
+        ((ppm == NULL) && ((Width == 0U) || (Height == 0U))))
+    {
+        Usage(argv[0]);
+    }
+    if (table != NULL)
+    {
+        LoadTable(table, skip);
+    }
+    else if (raw != NULL)
+    {
+        LoadRaw(raw);
+    }
+    else
+    {
+        LoadPPM(ppm);
+    }
+    if ((Width > 0xFFFFU) || (Height > 0xFFFFU))
+    {
+        fprintf(stderr, "too large\n");
+        exit(1);
+    }
+
+    /* Header room, then the lines */
+    for (uint32_t i = 0U; i < IMAGE_ASSET_HEADER_BYTES; i++)
+    {
+        Put(0U);
+    }
+    for (uint32_t y = 0U; y < Height; y++)
+    {
+        EncodeLine(&Pix[y * Width], (y != 0U) ? &Pix[(y - 1U) * Width] : NULL);
+    }
+    rle_size = OutSize - IMAGE_ASSET_HEADER_BYTES;
+    h.magic = IMAGE_ASSET_MAGIC;
+    h.width = (uint16_t)Width;
+    h.height = (uint16_t)Height;
+    h.format = IMAGE_ASSET_RGB565;
+    h.compression = IMAGE_ASSET_RLE;
+    h.reserved = 0U;
+    h.size = rle_size;
+    if (rle_size >= (Width * Height * 2U))
+    {
+        OutSize = IMAGE_ASSET_HEADER_BYTES;
+        for (uint32_t p = 0U; p < Width * Height; p++)
+        {
+            PutPixel(Pix[p]);
+        }
+        h.compression = IMAGE_ASSET_RAW;
+        h.size = Width * Height * 2U;
+    }
+    memcpy(Out, &h, sizeof(h));
+
+    /* Decoded back, as the target does it */
+    asset = aligned_alloc(4U, (OutSize + 3U) & ~3U);
+    memcpy(asset, Out, OutSize);
+    back = calloc(Width * Height, 2U);
+    if ((IMAGE_Asset_Draw(asset, back, Width, (uint16_t)Width, (uint16_t)Height, 0, 0) !=
+         IMAGE_ASSET_OK) || memcmp(back, Pix, Width * Height * 2U))
+    {
+        fprintf(stderr, "decoded asset differs\n");
+        return 1;
+    }
+    if (bin != NULL)
+    {
+        FILE *f = fopen(bin, "wb");
+
+        if ((f == NULL) || (fwrite(Out, 1U, OutSize, f) != OutSize) || (fclose(f) != 0))
+        {
+            fprintf(stderr, "can't write %s\n", bin);
+            return 1;
+        }
+    }
+    t = clock();
+    for (uint32_t r = 0U; r < PACK_BENCH_ROUNDS; r++)
+    {
+        IMAGE_Asset_Draw(asset, back, Width, (uint16_t)Width, (uint16_t)Height, 0, 0);
+    }
+    s = (double)(clock() - t) / CLOCKS_PER_SEC;
+
+    printf("/*\n * %s: %u x %u RGB565, %s, %u bytes (raw %u, %.2f:1)\n",
+            name, Width, Height, (h.compression == IMAGE_ASSET_RLE) ? "RLE" : "raw",
+            OutSize, Width * Height * 2U, (double)(Width * Height * 2U) / OutSize);
+    printf(" * Generated by Tools/img_pack, do not edit\n */\n\n#include \"image.h\"\n\n");
+    printf("const unsigned char %s[%u] __attribute__((aligned(4))) =\n{\n", name, OutSize);
+    for (uint32_t i = 0U; i < OutSize; i++)
+    {
+        printf("%s0x%02X,%s", ((i % 16U) == 0U) ? "    " : "", Out[i],
+                (((i % 16U) == 15U) || (i + 1U == OutSize)) ? "\n" : "");
+    }
+    printf("};\n");
+
+    fprintf(stderr, "%s: %u x %u, raw %u bytes, asset %u bytes (%s), %.2f:1\n", name, Width,
+            Height, Width * Height * 2U, OutSize,
+            (h.compression == IMAGE_ASSET_RLE) ? "RLE" : "raw",
+            (double)(Width * Height * 2U) / OutSize);
+    fprintf(stderr, "host decode %.1f MB/s of pixels\n",
+            (s > 0.0) ? (PACK_BENCH_ROUNDS * Width * Height * 2.0 / s / 1e6) : 0.0);
+    return 0;
+}
@@ -0,0 +1,273 @@
+/*
+ * latency_sim.c
+ * Host simulation of the camera to display latency (User/Vision/cam_latency.c)
+ *
+ * Plays a synthetic timeline of the display pipeline through the latency
+ * harness (time unit: 1 us) and prints the stage histograms, the same
+ * figures as DebugMain case 24 on the target. The timeline is either
+ * generated from a pipeline configuration:
+ *   - the camera completes a frame every -c us (VSYNC), +- -j us of jitter
+ *   - the main loop polls FrameTask() every -l us and starts the copy when
+ *     a frame is ready and the MDMA is free
+ *   - the copy takes -m us, the LTDC reloads on the next of the -v us
+ *     vertical blankings
+ * or read from a file (-f) of "t_us event frame" lines, event being one of
+ * vsync, start, done, visible (e.g. stamps dumped from the target).
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -IUser/Vision -o latency_sim Tools/latency_sim/latency_sim.c \
+ *       User/Vision/cam_latency.c
+ * Run: ./latency_sim [-c us] [-l us] [-m us] [-v us] [-j us] [-t s] [-f file]
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cam_latency.h"
+
+#define SIM_HIST_WIDTH                (50U)
+
+typedef struct
+{
+    uint32_t cam_us;
+    uint32_t loop_us;
+    uint32_t copy_us;
+    uint32_t vblank_us;
+    uint32_t jitter_us;
+    uint32_t seconds;
+} Sim_Config_t;
+
+static const char *StageName[CAM_LAT_STAGES] = { "queue", "copy", "scanout", "total" };
+static const char *EventName[CAM_LAT_EVENTS] = { "vsync", "start", "done", "visible" };
+
+static uint32_t Sim_Rand(void)
+{
+    static uint32_t x = 0x12345678U;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return x;
+}
+
+static void Sim_Generate(const Sim_Config_t *cfg)
+{
+    uint64_t end = (uint64_t)cfg->seconds * 1000000U;
+    uint64_t t_cam = cfg->cam_us;
+    uint64_t t_loop = cfg->loop_us;
+    uint64_t t_vblank = cfg->vblank_us;
+    uint64_t t_done = UINT64_MAX;
+    uint32_t frame = 0U, ready = 0U, copying = 0U, reload = 0U;
+
+    while (1)
+    {
+        /* Next event in time; ties: capture, copy end, loop, blanking */
+        uint64_t t = t_cam;
+        t = (t_done < t) ? t_done : t;
+        t = (t_loop < t) ? t_loop : t;
+        t = (t_vblank < t) ? t_vblank : t;
+        if (t >= end)
+        {
+            break;
+        }
+        if (t == t_cam)
+        {
+            CAM_Lat_Event(CAM_LAT_EV_VSYNC, ++frame, (uint32_t)t);
+            ready = frame;
+            t_cam += cfg->cam_us;
+            if (cfg->jitter_us != 0U)
+            {
+                t_cam += Sim_Rand() % (2U * cfg->jitter_us + 1U);
+                t_cam -= cfg->jitter_us;
+            }
+        }
+        else if (t == t_done)
+        {
+            CAM_Lat_Event(CAM_LAT_EV_COPY_DONE, copying, (uint32_t)t);
+            t_done = UINT64_MAX;
+            reload = 1U;
+        }
+        else if (t == t_loop)
+        {
+            if ((ready != 0U) && (t_done == UINT64_MAX))
+            {
+                copying = ready;
+                ready = 0U;
+                CAM_Lat_Event(CAM_LAT_EV_COPY_START, copying, (uint32_t)t);
+                t_done = t + cfg->copy_us;
+            }
+            t_loop += cfg->loop_us;
+        }
+        else
+        {
+            if (reload)
+            {
+                CAM_Lat_Event(CAM_LAT_EV_VISIBLE, 0U, (uint32_t)t);
+                reload = 0U;
+            }
+            t_vblank += cfg->vblank_us;
+        }
+    }
+}
+
+static int Sim_ReadFile(const char *path)
+{
+    FILE *f = fopen(path, "r");
+    char line[128], name[16];
+    unsigned long t, frame;
+    uint32_t n = 0U;
+
+    if (f == NULL)
+    {
+        perror(path);
+        return -1;
+    }
+    while (fgets(line, sizeof(line), f) != NULL)
+    {
+        uint32_t ev;
+
+        n++;
+        if ((line[0] == '#') || (line[0] == '\n'))
+        {
+            continue;
+        }
+        if (sscanf(line, "%lu %15s %lu", &t, name, &frame) != 3)
+        {
+            fprintf(stderr, "%s:%u: expected \"t_us event frame\"\n", path, n);
+            continue;
+        }
+        for (ev = 0U; ev < CAM_LAT_EVENTS; ev++)
+        {
+            if (strcmp(name, EventName[ev]) == 0)
+            {
+                break;
+            }
+        }
+        if (ev == CAM_LAT_EVENTS)
+        {
+            fprintf(stderr, "%s:%u: unknown event %s\n", path, n, name);
+            continue;
+        }
+        CAM_Lat_Event((CAM_LatEvent_t)ev, (uint32_t)frame, (uint32_t)t);
+    }
+    fclose(f);
+    return 0;
+}
+
+static void Sim_Print(const CAM_Lat_t *lat)
+{
+    const CAM_LatHist_t *h = &lat->stage[CAM_LAT_TOTAL];
+    uint32_t first = CAM_LAT_BINS, last = 0U, peak = 0U;
+
+    printf("frames %u, shown %u, dropped %u, orphans %u\n\n",
+            lat->frames, lat->shown, lat->dropped, lat->orphans);
+    printf("%-8s %8s %8s %8s %8s %8s  (us)\n", "stage", "min", "mean", "p50", "p99", "max");
+    for (uint32_t i = 0U; i < CAM_LAT_STAGES; i++)
+    {
+        const CAM_LatHist_t *s = &lat->stage[i];
+
+        if (s->count == 0U)
+        {
+            printf("%-8s %8s\n", StageName[i], "-");
+            continue;
+        }
+        printf("%-8s %8u %8u %8u %8u %8u\n", StageName[i], s->min_us,
+                (uint32_t)(s->sum_us / s->count),
+                CAM_Lat_Percentile(lat, (CAM_LatStage_t)i, 500U),
+                CAM_Lat_Percentile(lat, (CAM_LatStage_t)i, 990U), s->max_us);
+    }
+
+    /* Histogram of the total, bins that are used */
+    for (uint32_t i = 0U; i < CAM_LAT_BINS; i++)
+    {
+        if (h->hist[i] != 0U)
+        {
+            first = (first == CAM_LAT_BINS) ? i : first;
+            last = i;
+            peak = (h->hist[i] > peak) ? h->hist[i] : peak;
+        }
+    }
+    if (peak == 0U)
+    {
+        return;
+    }
+    printf("\ntotal\n");
+    for (uint32_t i = first; i <= last; i++)
+    {
+        uint32_t bar = (uint32_t)(((uint64_t)h->hist[i] * SIM_HIST_WIDTH + peak - 1U) / peak);
+
+        printf("%6u%s %6u |", i * CAM_LAT_BIN_US, (i == (CAM_LAT_BINS - 1U)) ? "+" : " ",
+                h->hist[i]);
+        for (uint32_t b = 0U; b < bar; b++)
+        {
+            putchar('#');
+        }
+        putchar('\n');
+    }
+}
+
+int main(int argc, char **argv)
+{
+    Sim_Config_t cfg = { 33333U, 100000U, 1500U, 16667U, 0U, 60U };
+    const char *file = NULL;
+    CAM_Lat_t lat;
+
+    for (int i = 1; i < argc; i++)
+    {
+        uint32_t *opt = NULL;
+
+        if ((argv[i][0] != '-') || (argv[i][1] == '\0') || (argv[i][2] != '\0') || (i + 1 >= argc))
+        {
+            fprintf(stderr, "usage: %s [-c us] [-l us] [-m us] [-v us] [-j us] [-t s] [-f file]\n",
+                    argv[0]);
+            return 1;
+        }
+        switch (argv[i][1])
+        {
+            case 'c': opt = &cfg.cam_us; break;
+            case 'l': opt = &cfg.loop_us; break;
+            case 'm': opt = &cfg.copy_us; break;
+            case 'v': opt = &cfg.vblank_us; break;
+            case 'j': opt = &cfg.jitter_us; break;
+            case 't': opt = &cfg.seconds; break;
+            case 'f': file = argv[i + 1]; break;
+            default:
+                fprintf(stderr, "unknown option %s\n", argv[i]);
+                return 1;
+        }
+        if (opt != NULL)
+        {
+            *opt = (uint32_t)strtoul(argv[i + 1], NULL, 0);
+            if ((*opt == 0U) && (opt != &cfg.jitter_us))
+            {
+                fprintf(stderr, "%s must be > 0\n", argv[i]);
+                return 1;
+            }
+        }
+        i++;
+    }
+    if ((cfg.jitter_us * 2U) >= cfg.cam_us)
+    {
+        fprintf(stderr, "jitter must be below half the camera period\n");
+        return 1;
+    }
+
+    CAM_Lat_Init(1U);
+    if (file != NULL)
+    {
+        if (Sim_ReadFile(file) != 0)
+        {
+            return 1;
+        }
+    }
+    else
+    {
+        printf("camera %u us, loop %u us, copy %u us, vblank %u us, jitter %u us, %u s\n\n",
+                cfg.cam_us, cfg.loop_us, cfg.copy_us, cfg.vblank_us, cfg.jitter_us, cfg.seconds);
+        Sim_Generate(&cfg);
+    }
+    CAM_Lat_Get(&lat);
+    Sim_Print(&lat);
+    return 0;
+}
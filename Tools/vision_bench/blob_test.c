@@ -0,0 +1,706 @@
+/*
+ * blob_test.c
+ * Host test of the connected component labeling (User/Vision/cam_blob.c)
+ *
+ * Every frame goes through CAM_Blob_Process() and the published result
+ * (run and component counts, overflow flag, every blob box, centroid and
+ * area, in order) is compared with a reference written from the
+ * description: threshold of the sampled pixels, 8-connected flood fill in
+ * raster order, area filter, largest first with the earlier component
+ * first on equal areas. The budget is modelled too: past CAM_BLOB_MAX_RUNS
+ * runs the rest of the mask is ignored, past CAM_BLOB_MAX_COMPONENTS the
+ * later components are counted but not measured.
+ *
+ * Frames:
+ *  - random masks of every density, Y8 and RGB565, decimation 1, 2 and 4,
+ *    random thresholds (edges of the range included) and area filters
+ *  - blobs on large frames, mask widths that end inside a flag word with
+ *    foreground up to the right edge and in the unused pixels after it
+ *  - diagonal joins: checkerboards, staircases and corner contacts on the
+ *    flag word boundaries
+ *  - exactly CAM_BLOB_MAX_RUNS runs and one more, exactly
+ *    CAM_BLOB_MAX_COMPONENTS components and one more
+ * then a few moving boxes for the track IDs.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -IUser/Vision -o blob_test Tools/vision_bench/blob_test.c \
+ *       User/Vision/cam_blob.c User/Vision/vision_luma.c
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cam_blob.h"
+#include "vision_luma.h"
+
+#define MASK_W                        CAM_BLOB_MAX_WIDTH
+#define MASK_H                        CAM_BLOB_MAX_HEIGHT
+/* Largest frame: the largest mask at decimation 4, plus a ragged edge */
+#define FRAME_W                       (MASK_W * 4U + 3U)
+#define FRAME_H                       (MASK_H * 4U + 3U)
+#define FRAME_PAD                     (8U)
+#define FRAME_STRIDE                  ((FRAME_W + FRAME_PAD) * 2U)
+
+#define TEST_RANDOM_FRAMES            (3000U)
+#define TEST_LARGE_FRAMES             (300U)
+
+typedef struct
+{
+    uint32_t area;                /* mask pixels */
+    uint64_t sum_x2;
+    uint64_t sum_y;
+    uint32_t x0;
+    uint32_t x1;                  /* excluded */
+    uint32_t y0;
+    uint32_t y1;                  /* included */
+    uint32_t first;               /* raster index of the first pixel */
+} Ref_Comp_t;
+
+typedef struct
+{
+    uint8_t  format;
+    uint8_t  low;
+    uint8_t  high;
+    uint8_t  d;
+    uint32_t min_area;
+    uint32_t width;               /* frame pixels */
+    uint32_t height;
+    uint32_t stride;              /* bytes */
+} Test_Frame_t;
+
+static uint8_t Frame[FRAME_STRIDE * FRAME_H];
+/* Wanted mask for the generators, mask pixels */
+static uint8_t Want[MASK_W * MASK_H];
+static uint8_t Mask[MASK_W * MASK_H];
+static int32_t Label[MASK_W * MASK_H];
+static uint32_t Stack[MASK_W * MASK_H];
+static Ref_Comp_t Comp[MASK_W * MASK_H];
+static CAM_BlobBox_t RefBlob[CAM_BLOB_MAX_BLOBS];
+static CAM_Blob_t Out;
+/* All RGB565 values sorted by luma, LumaStart[l] = first one of luma l */
+static uint16_t ByLuma[65536];
+static uint32_t LumaStart[257];
+static uint32_t Seed = 12345U;
+static uint32_t Seq;
+
+static uint32_t Rand(void)
+{
+    Seed = Seed * 1664525U + 1013904223U;
+    return Seed >> 8;
+}
+
+/******************************************************************************
+ *                                 REFERENCE                                  *
+ ******************************************************************************/
+
+/* BT.601 on the 8 bit expansion, as vision_luma.h defines it */
+static uint32_t RefLuma(uint16_t px)
+{
+    uint32_t r = VISION_EXPAND5((px >> 11) & 0x1FU);
+    uint32_t g = VISION_EXPAND6((px >> 5) & 0x3FU);
+    uint32_t b = VISION_EXPAND5(px & 0x1FU);
+
+    return (77U * r + 150U * g + 29U * b + 128U) >> 8;
+}
+
+static uint32_t RefSample(const Test_Frame_t *t, uint32_t x, uint32_t y)
+{
+    const uint8_t *p = Frame + y * t->d * t->stride;
+
+    if (t->format == CAM_BLOB_FMT_Y8)
+    {
+        return p[x * t->d];
+    }
+    return RefLuma((uint16_t)(p[x * t->d * 2U] | (p[x * t->d * 2U + 1U] << 8)));
+}
+
+/* Mask, then the runs past the budget cleared; returns the runs kept */
+static uint32_t RefMask(const Test_Frame_t *t, uint32_t mw, uint32_t mh, uint8_t *overflow)
+{
+    uint32_t runs = 0U;
+
+    *overflow = 0U;
+    for (uint32_t y = 0U; y < mh; y++)
+    {
+        for (uint32_t x = 0U; x < mw; x++)
+        {
+            uint32_t v = RefSample(t, x, y);
+            uint8_t *m = &Mask[y * mw + x];
+
+            *m = ((v >= t->low) && (v <= t->high)) ? 1U : 0U;
+            if (*m && ((x == 0U) || !m[-1]) && (++runs > CAM_BLOB_MAX_RUNS))
+            {
+                *overflow = 1U;
+            }
+            if (*overflow)
+            {
+                *m = 0U;
+            }
+        }
+    }
+    return *overflow ? CAM_BLOB_MAX_RUNS : runs;
+}
+
+/* 8-connected flood fill, components numbered in raster order of their first pixel */
+static uint32_t RefLabel(uint32_t mw, uint32_t mh)
+{
+    uint32_t n = 0U;
+
+    for (uint32_t i = 0U; i < mw * mh; i++)
+    {
+        Label[i] = -1;
+    }
+    for (uint32_t i = 0U; i < mw * mh; i++)
+    {
+        Ref_Comp_t *c = &Comp[n];
+        uint32_t sp = 0U;
+
+        if (!Mask[i] || (Label[i] >= 0))
+        {
+            continue;
+        }
+        memset(c, 0, sizeof(*c));
+        c->x0 = mw;
+        c->y0 = mh;
+        c->first = i;
+        Label[i] = (int32_t)n;
+        Stack[sp++] = i;
+        while (sp > 0U)
+        {
+            uint32_t j = Stack[--sp];
+            uint32_t x = j % mw, y = j / mw;
+
+            c->area++;
+            c->sum_x2 += 2U * x;
+            c->sum_y += y;
+            c->x0 = (x < c->x0) ? x : c->x0;
+            c->x1 = (x + 1U > c->x1) ? x + 1U : c->x1;
+            c->y0 = (y < c->y0) ? y : c->y0;
+            c->y1 = (y > c->y1) ? y : c->y1;
+            for (int32_t dy = -1; dy <= 1; dy++)
+            {
+                for (int32_t dx = -1; dx <= 1; dx++)
+                {
+                    int32_t nx = (int32_t)x + dx, ny = (int32_t)y + dy;
+                    uint32_t k = (uint32_t)ny * mw + (uint32_t)nx;
+
+                    if ((nx >= 0) && (ny >= 0) && (nx < (int32_t)mw) && (ny < (int32_t)mh) &&
+                            Mask[k] && (Label[k] < 0))
+                    {
+                        Label[k] = (int32_t)n;
+                        Stack[sp++] = k;
+                    }
+                }
+            }
+        }
+        n++;
+    }
+    return n;
+}
+
+/* Largest first, the earlier component first on equal areas */
+static int RefCompare(const void *a, const void *b)
+{
+    const Ref_Comp_t *p = &Comp[*(const uint32_t*)a], *q = &Comp[*(const uint32_t*)b];
+
+    if (p->area != q->area)
+    {
+        return (p->area > q->area) ? -1 : 1;
+    }
+    return (p->first < q->first) ? -1 : 1;
+}
+
+/* Measured components through the area filter, the largest ones */
+static uint32_t RefBlobs(const Test_Frame_t *t, uint32_t ncomp)
+{
+    uint32_t d = t->d;
+    uint32_t n = 0U;
+
+    for (uint32_t i = 0U; i < ncomp; i++)
+    {
+        if (Comp[i].area * d * d >= t->min_area)
+        {
+            Stack[n++] = i;
+        }
+    }
+    qsort(Stack, n, sizeof(Stack[0]), RefCompare);
+    n = (n > CAM_BLOB_MAX_BLOBS) ? CAM_BLOB_MAX_BLOBS : n;
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        const Ref_Comp_t *c = &Comp[Stack[i]];
+        CAM_BlobBox_t *b = &RefBlob[i];
+
+        memset(b, 0, sizeof(*b));
+        b->x = (uint16_t)(c->x0 * d);
+        b->y = (uint16_t)(c->y0 * d);
+        b->w = (uint16_t)((c->x1 - c->x0) * d);
+        b->h = (uint16_t)((c->y1 - c->y0 + 1U) * d);
+        /* Centre of mask pixel x at frame pixel x * d, in 1/16, rounded */
+        b->cx_q4 = (uint16_t)((c->sum_x2 * d * 8U + c->area / 2U) / c->area);
+        b->cy_q4 = (uint16_t)((c->sum_y * d * 16U + c->area / 2U) / c->area);
+        b->area = c->area * d * d;
+    }
+    return n;
+}
+
+/******************************************************************************
+ *                                  FRAMES                                    *
+ ******************************************************************************/
+
+static void LumaTable(void)
+{
+    uint32_t count[257] = {0};
+
+    for (uint32_t v = 0U; v < 65536U; v++)
+    {
+        count[RefLuma((uint16_t)v) + 1U]++;
+    }
+    for (uint32_t l = 1U; l <= 256U; l++)
+    {
+        count[l] += count[l - 1U];
+    }
+    memcpy(LumaStart, count, sizeof(LumaStart));
+    for (uint32_t v = 0U; v < 65536U; v++)
+    {
+        ByLuma[count[RefLuma((uint16_t)v)]++] = (uint16_t)v;
+    }
+}
+
+/* A luma inside (fg) or outside the range, any if there is none */
+static uint32_t PickLuma(const Test_Frame_t *t, uint8_t fg)
+{
+    uint32_t below = t->low, above = 255U - t->high;
+
+    if (fg || ((below + above) == 0U))
+    {
+        /* The limits themselves half of the time */
+        switch (Rand() & 3U)
+        {
+            case 0U:  return t->low;
+            case 1U:  return t->high;
+            default:  return t->low + Rand() % (t->high - t->low + 1U);
+        }
+    }
+    if ((Rand() & 1U) && below)
+    {
+        return (Rand() & 1U) ? t->low - 1U : Rand() % below;
+    }
+    if (above == 0U)
+    {
+        return Rand() % below;
+    }
+    return (Rand() & 1U) ? t->high + 1U : t->high + 1U + Rand() % above;
+}
+
+static void PutPixel(const Test_Frame_t *t, uint32_t x, uint32_t y, uint32_t luma)
+{
+    uint8_t *p = Frame + y * t->stride;
+
+    if (t->format == CAM_BLOB_FMT_Y8)
+    {
+        p[x] = (uint8_t)luma;
+        return;
+    }
+    /* Some luma levels have no RGB565 value: the next one up (or down) */
+    while ((LumaStart[luma] == LumaStart[luma + 1U]) && (luma < 255U))
+    {
+        luma++;
+    }
+    while (LumaStart[luma] == LumaStart[luma + 1U])
+    {
+        luma--;
+    }
+    uint16_t v = ByLuma[LumaStart[luma] + Rand() % (LumaStart[luma + 1U] - LumaStart[luma])];
+    p[x * 2U] = (uint8_t)v;
+    p[x * 2U + 1U] = (uint8_t)(v >> 8);
+}
+
+/* Want[] on the sampled pixels, random values on the skipped ones, the
+ * unused right and bottom edges and the stride padding */
+static void Render(const Test_Frame_t *t)
+{
+    uint32_t mw = t->width / t->d, mh = t->height / t->d;
+    uint32_t bpp = (t->format == CAM_BLOB_FMT_Y8) ? 1U : 2U;
+
+    for (uint32_t i = 0U; i < t->stride * t->height; i++)
+    {
+        Frame[i] = (uint8_t)Rand();
+    }
+    for (uint32_t y = 0U; y < mh; y++)
+    {
+        for (uint32_t x = 0U; x < mw; x++)
+        {
+            PutPixel(t, x * t->d, y * t->d, PickLuma(t, Want[y * mw + x]));
+        }
+    }
+    /* Foreground right after the mask width and in the padding, where the
+     * last partial flag word must read background */
+    for (uint32_t y = 0U; y < t->height; y++)
+    {
+        for (uint32_t x = mw * t->d; x < t->stride / bpp; x++)
+        {
+            if (Rand() & 1U)
+            {
+                PutPixel(t, x, y, PickLuma(t, 1U));
+            }
+        }
+    }
+}
+
+static void RandomSetup(Test_Frame_t *t, uint32_t max_w, uint32_t max_h)
+{
+    static const uint8_t Limits[] = { 0U, 1U, 64U, 127U, 128U, 200U, 254U, 255U };
+
+    t->format = (Rand() & 1U) ? CAM_BLOB_FMT_RGB565 : CAM_BLOB_FMT_Y8;
+    t->d = (uint8_t)(1U << (Rand() % 3U));
+    t->low = (Rand() & 1U) ? Limits[Rand() % sizeof(Limits)] : (uint8_t)Rand();
+    t->high = (Rand() & 1U) ? Limits[Rand() % sizeof(Limits)] : (uint8_t)Rand();
+    if (t->high < t->low)
+    {
+        uint8_t s = t->low;
+        t->low = t->high;
+        t->high = s;
+    }
+    t->min_area = (Rand() & 1U) ? 0U : Rand() % 64U;
+    t->width = (1U + Rand() % max_w) * t->d + Rand() % t->d;
+    t->height = (1U + Rand() % max_h) * t->d + Rand() % t->d;
+    t->stride = t->width * ((t->format == CAM_BLOB_FMT_Y8) ? 1U : 2U) + (Rand() % FRAME_PAD) * 2U;
+}
+
+/******************************************************************************
+ *                                  CHECKS                                    *
+ ******************************************************************************/
+
+static int Run(const Test_Frame_t *t, const char *what)
+{
+    uint32_t mw = t->width / t->d, mh = t->height / t->d;
+    uint32_t runs, total, measured, nblobs;
+    uint8_t overflow;
+
+    CAM_Blob_Config(t->low, t->high, t->d, t->min_area);
+    CAM_Blob_Process(Frame, (CAM_BlobFormat_t)t->format, t->stride, (uint16_t)t->width,
+            (uint16_t)t->height, ++Seq);
+    if (CAM_Blob_Get(&Out) != Seq)
+    {
+        printf("%s: frame %u not published\n", what, Seq);
+        return 0;
+    }
+
+    runs = RefMask(t, mw, mh, &overflow);
+    total = RefLabel(mw, mh);
+    measured = (total > CAM_BLOB_MAX_COMPONENTS) ? CAM_BLOB_MAX_COMPONENTS : total;
+    overflow |= (total > CAM_BLOB_MAX_COMPONENTS) ? 1U : 0U;
+    nblobs = RefBlobs(t, measured);
+
+    if ((Out.mask_w != mw) || (Out.mask_h != mh) || (Out.decimation != t->d) ||
+            (Out.runs != runs) || (Out.components != total) || (Out.overflow != overflow) ||
+            (Out.nblobs != nblobs))
+    {
+        printf("%s: %ux%u /%u %s [%u..%u]: mask %ux%u runs %u/%u comps %u/%u ovf %u/%u "
+                "blobs %u/%u MISMATCH\n", what, t->width, t->height, t->d,
+                (t->format == CAM_BLOB_FMT_Y8) ? "y8" : "565", t->low, t->high,
+                Out.mask_w, Out.mask_h, Out.runs, runs, Out.components, total,
+                Out.overflow, overflow, Out.nblobs, nblobs);
+        return 0;
+    }
+    for (uint32_t i = 0U; i < nblobs; i++)
+    {
+        const CAM_BlobBox_t *a = &Out.blob[i], *b = &RefBlob[i];
+
+        if ((a->x != b->x) || (a->y != b->y) || (a->w != b->w) || (a->h != b->h) ||
+                (a->cx_q4 != b->cx_q4) || (a->cy_q4 != b->cy_q4) || (a->area != b->area))
+        {
+            printf("%s: blob %u at %u,%u %ux%u c %u,%u area %u, expected %u,%u %ux%u c %u,%u "
+                    "area %u MISMATCH\n", what, i, a->x, a->y, a->w, a->h, a->cx_q4, a->cy_q4,
+                    a->area, b->x, b->y, b->w, b->h, b->cx_q4, b->cy_q4, b->area);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+/* Noise masks of every density, small enough to stay mostly in budget */
+static int TestRandom(void)
+{
+    int ok = 1;
+
+    for (uint32_t f = 0U; (f < TEST_RANDOM_FRAMES) && ok; f++)
+    {
+        Test_Frame_t t;
+        uint32_t density = Rand() % 101U;
+
+        RandomSetup(&t, (f & 1U) ? 80U : 24U, (f & 1U) ? 60U : 24U);
+        for (uint32_t i = 0U; i < (t.width / t.d) * (t.height / t.d); i++)
+        {
+            Want[i] = ((Rand() % 100U) < density) ? 1U : 0U;
+        }
+        Render(&t);
+        ok &= Run(&t, "random");
+    }
+    printf("random masks %u frames %s\n", TEST_RANDOM_FRAMES, ok ? "ok" : "MISMATCH");
+    return ok;
+}
+
+/* Disks and bars on full size frames, ragged mask widths */
+static int TestLarge(void)
+{
+    int ok = 1;
+
+    for (uint32_t f = 0U; (f < TEST_LARGE_FRAMES) && ok; f++)
+    {
+        Test_Frame_t t;
+        uint32_t mw, mh, shapes = 1U + Rand() % 24U;
+
+        RandomSetup(&t, MASK_W, MASK_H);
+        /* Mostly the largest masks, with widths ending inside a flag word */
+        if (f & 1U)
+        {
+            t.width = (MASK_W - Rand() % 4U) * t.d + Rand() % t.d;
+            t.height = (MASK_H - Rand() % 4U) * t.d;
+            t.stride = t.width * ((t.format == CAM_BLOB_FMT_Y8) ? 1U : 2U) + FRAME_PAD;
+        }
+        mw = t.width / t.d;
+        mh = t.height / t.d;
+        memset(Want, 0, mw * mh);
+        for (uint32_t s = 0U; s < shapes; s++)
+        {
+            int32_t cx = (int32_t)(Rand() % mw), cy = (int32_t)(Rand() % mh);
+            int32_t r = (int32_t)(1U + Rand() % 30U);
+
+            /* Some touching the right edge */
+            if ((s & 3U) == 0U)
+            {
+                cx = (int32_t)mw - 1;
+            }
+            for (int32_t y = cy - r; y <= cy + r; y++)
+            {
+                for (int32_t x = cx - r; x <= cx + r; x++)
+                {
+                    if ((x >= 0) && (y >= 0) && (x < (int32_t)mw) && (y < (int32_t)mh) &&
+                            ((s & 1U) || ((x - cx) * (x - cx) + (y - cy) * (y - cy) <= r * r)))
+                    {
+                        Want[(uint32_t)y * mw + (uint32_t)x] = 1U;
+                    }
+                }
+            }
+        }
+        /* Specks */
+        for (uint32_t i = Rand() % 200U; i > 0U; i--)
+        {
+            Want[Rand() % (mw * mh)] = 1U;
+        }
+        Render(&t);
+        ok &= Run(&t, "large");
+    }
+    printf("large frames %u %s\n", TEST_LARGE_FRAMES, ok ? "ok" : "MISMATCH");
+    return ok;
+}
+
+static void FixedSetup(Test_Frame_t *t, uint8_t format, uint8_t d, uint32_t mw, uint32_t mh)
+{
+    t->format = format;
+    t->d = d;
+    t->low = 100U;
+    t->high = 200U;
+    t->min_area = 0U;
+    t->width = mw * d;
+    t->height = mh * d;
+    t->stride = t->width * ((format == CAM_BLOB_FMT_Y8) ? 1U : 2U) + FRAME_PAD;
+}
+
+/* Components joined only through corners */
+static int TestDiagonal(void)
+{
+    int ok = 1;
+
+    for (uint32_t pattern = 0U; pattern < 5U; pattern++)
+    {
+        for (uint32_t d = 1U; d <= 4U; d *= 2U)
+        {
+            for (uint32_t format = 0U; format < 2U; format++)
+            {
+                Test_Frame_t t;
+                uint32_t mw = 37U + pattern, mh = 29U;
+
+                FixedSetup(&t, (uint8_t)format, (uint8_t)d, mw, mh);
+                memset(Want, 0, mw * mh);
+                for (uint32_t y = 0U; y < mh; y++)
+                {
+                    for (uint32_t x = 0U; x < mw; x++)
+                    {
+                        uint8_t on = 0U;
+
+                        switch (pattern)
+                        {
+                            case 0U:  on = ((x + y) & 1U) == 0U; break;        /* checkerboard */
+                            case 1U:  on = (x == y) || (x + y == mw - 1U); break; /* X */
+                            case 2U:  on = ((x + y) % 4U) == 0U; break;        /* anti-diagonals */
+                            case 3U:  on = ((x / 4U + y) & 1U) == 0U; break;   /* word corners */
+                            default:  on = ((y & 1U) == 0U) && ((x % 8U) < 4U) == ((y & 2U) == 0U);
+                                      break;                                   /* bricks */
+                        }
+                        Want[y * mw + x] = on;
+                    }
+                }
+                Render(&t);
+                ok &= Run(&t, "diagonal");
+            }
+        }
+    }
+    /* Two pixels on the flag word boundary, one line apart */
+    for (uint32_t x = 0U; x < 12U; x++)
+    {
+        for (int32_t dx = -2; dx <= 2; dx++)
+        {
+            Test_Frame_t t;
+
+            if (((int32_t)x + dx < 0) || ((int32_t)x + dx >= 13))
+            {
+                continue;
+            }
+            FixedSetup(&t, CAM_BLOB_FMT_Y8, 1U, 13U, 3U);
+            memset(Want, 0, 13U * 3U);
+            Want[x] = 1U;
+            Want[13U + (uint32_t)((int32_t)x + dx)] = 1U;
+            Render(&t);
+            ok &= Run(&t, "corner");
+        }
+    }
+    printf("diagonal joins %s\n", ok ? "ok" : "MISMATCH");
+    return ok;
+}
+
+/* Exactly the budget, then one over */
+static int TestBudget(void)
+{
+    int ok = 1;
+
+    for (uint32_t extra = 0U; extra < 2U; extra++)
+    {
+        for (uint32_t d = 1U; d <= 4U; d *= 2U)
+        {
+            Test_Frame_t t;
+            /* Checkerboard 128 wide: 64 runs a line, one component */
+            uint32_t mw = 128U, mh = CAM_BLOB_MAX_RUNS / 64U;
+
+            FixedSetup(&t, CAM_BLOB_FMT_Y8, (uint8_t)d, mw, mh + extra);
+            for (uint32_t y = 0U; y < mh + extra; y++)
+            {
+                for (uint32_t x = 0U; x < mw; x++)
+                {
+                    Want[y * mw + x] = ((x + y) & 1U) == 0U;
+                }
+            }
+            if (extra)
+            {
+                /* Only the first run of the line past the budget */
+                memset(&Want[mh * mw + 2U], 0, mw - 2U);
+            }
+            Render(&t);
+            ok &= Run(&t, "runs");
+
+            /* Isolated pixels, 16 per line */
+            mw = 32U;
+            mh = CAM_BLOB_MAX_COMPONENTS / 16U;
+            FixedSetup(&t, CAM_BLOB_FMT_RGB565, (uint8_t)d, mw, 2U * mh + 1U);
+            t.min_area = 2U * d * d;
+            memset(Want, 0, mw * (2U * mh + 1U));
+            for (uint32_t y = 0U; y < mh; y++)
+            {
+                for (uint32_t x = 0U; x < mw; x += 2U)
+                {
+                    Want[2U * y * mw + x] = 1U;
+                }
+            }
+            /* The first and the last measured ones pass the filter, the
+             * one past the budget would too */
+            Want[mw] = 1U;
+            Want[(2U * mh - 1U) * mw + mw - 2U] = 1U;
+            if (extra)
+            {
+                Want[2U * mh * mw + 4U] = 1U;
+                Want[2U * mh * mw + 5U] = 1U;
+            }
+            Render(&t);
+            ok &= Run(&t, "components");
+        }
+    }
+    /* Far over both budgets */
+    for (uint32_t f = 0U; f < 20U; f++)
+    {
+        Test_Frame_t t;
+
+        FixedSetup(&t, (uint8_t)(f & 1U), (uint8_t)(1U << (f % 3U)), MASK_W - f, MASK_H);
+        for (uint32_t i = 0U; i < (MASK_W - f) * MASK_H; i++)
+        {
+            Want[i] = (Rand() % 3U) == 0U;
+        }
+        Render(&t);
+        ok &= Run(&t, "overflow");
+    }
+    printf("run and component budget %s\n", ok ? "ok" : "MISMATCH");
+    return ok;
+}
+
+/* Boxes moving a few pixels a frame keep their IDs, a new one gets the next */
+static int TestTracking(void)
+{
+    Test_Frame_t t;
+    uint16_t id[2] = {0};
+    int ok = 1;
+
+    FixedSetup(&t, CAM_BLOB_FMT_RGB565, 2U, 160U, 120U);
+    CAM_Blob_Reset();
+    for (uint32_t f = 0U; f < 12U; f++)
+    {
+        memset(Want, 0, 160U * 120U);
+        for (uint32_t y = 20U; y < 40U; y++)
+        {
+            memset(&Want[y * 160U + 10U + 3U * f], 1, 24U);
+        }
+        for (uint32_t y = 70U + 2U * f; y < 80U + 2U * f; y++)
+        {
+            memset(&Want[y * 160U + 100U], 1, 12U);
+        }
+        if (f >= 8U)
+        {
+            memset(&Want[110U * 160U + 140U], 1, 4U);
+        }
+        Render(&t);
+        ok &= Run(&t, "tracking");
+        if (!ok || (Out.nblobs != ((f >= 8U) ? 3U : 2U)))
+        {
+            return 0;
+        }
+        if (f == 0U)
+        {
+            id[0] = Out.blob[0].id;
+            id[1] = Out.blob[1].id;
+        }
+        ok &= (Out.blob[0].id == id[0]) && (Out.blob[1].id == id[1]) &&
+                (Out.blob[0].age == f + 1U) && (Out.blob[1].age == f + 1U);
+        if (f >= 8U)
+        {
+            ok &= (Out.blob[2].id == 3U) && (Out.blob[2].age == f - 7U);
+        }
+    }
+    printf("tracking %s\n", ok ? "ok" : "MISMATCH");
+    return ok;
+}
+
+int main(void)
+{
+    int ok = 1;
+
+    LumaTable();
+    CAM_Blob_Init();
+    CAM_Blob_Enable(1U);
+    ok &= TestRandom();
+    ok &= TestLarge();
+    ok &= TestDiagonal();
+    ok &= TestBudget();
+    ok &= TestTracking();
+    printf(ok ? "all ok\n" : "FAIL\n");
+    return !ok;
+}
@@ -0,0 +1,215 @@
+/*
+ * color_test.c
+ * Host test of the pixel format conversions (User/Vision/vision_color.c)
+ *
+ * Every source/destination format pair goes through VISION_Color_Convert()
+ * (the packed CPU kernels and the ARGB8888 chunk path) and is compared byte
+ * for byte with VISION_Color_ConvertRef(), on every input value of the
+ * source format:
+ *  - RGB565 and swapped RGB565: all 65536 words
+ *  - RGB888 and ARGB8888: all 2^24 colors (alpha varies with the pixel)
+ *  - YUV422: every Y, U, V combination, the second Y of the pair equal to
+ *    the first, then an unrelated one (chroma of the pair average)
+ *  - gray: all 256 levels
+ * The images are converted with padded strides at the four byte alignments,
+ * both outputs start from the same fill so a write outside the picture is a
+ * mismatch too. Short widths cover the tails of the packed kernels, odd
+ * widths with YUV422 must be refused by both. VISION_Color_ConvertLine() is
+ * checked on the same lines. The DMA2D path is target only (DebugMain).
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -IUser/Vision -o color_test Tools/vision_bench/color_test.c \
+ *       User/Vision/vision_color.c User/Vision/vision_luma.c
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "vision_color.h"
+
+/* One image: 256 lines of 256 pixels (256 pairs for YUV422) */
+#define TEST_LINES                    (256U)
+#define TEST_PIXELS                   (512U)
+#define TEST_PAD                      (12U)
+#define TEST_ALIGN                    (4U)
+#define TEST_MAX_BPP                  (4U)
+#define TEST_SHORT_WIDTH              (9U)
+
+#define TEST_STRIDE                   (TEST_PIXELS * TEST_MAX_BPP + TEST_PAD)
+#define TEST_SIZE                     (TEST_LINES * TEST_STRIDE + TEST_ALIGN)
+
+static uint8_t Src[TEST_SIZE];
+static uint8_t Out[TEST_SIZE];
+static uint8_t Ref[TEST_SIZE];
+static uint8_t Line[TEST_STRIDE + TEST_ALIGN];
+static uint32_t Seed = 12345U;
+
+static const char *const Names[VISION_COLOR_FORMATS] =
+{
+    "565", "565s", "888", "argb", "yuv", "gray"
+};
+
+static uint32_t Rand(void)
+{
+    Seed = Seed * 1664525U + 1013904223U;
+    return Seed >> 8;
+}
+
+/* Converts the image in Src (offset align) with both paths, 1 if equal */
+static int Check(VISION_ColorFormat_t sf, VISION_ColorFormat_t df, uint32_t align,
+        uint16_t width, uint16_t height)
+{
+    uint32_t sstride = width * VISION_Color_BytesPerPixel(sf) + TEST_PAD;
+    uint32_t dstride = width * VISION_Color_BytesPerPixel(df) + TEST_PAD;
+    uint32_t size = height * dstride + TEST_ALIGN;
+    VISION_ColorStatus_t st_out, st_ref, st_line;
+
+    memset(Out, 0xA5, size);
+    memset(Ref, 0xA5, size);
+    st_out = VISION_Color_Convert(Src + align, sf, sstride, Out + align, df, dstride,
+            width, height, VISION_COLOR_AUTO);
+    st_ref = VISION_Color_ConvertRef(Src + align, sf, sstride, Ref + align, df, dstride,
+            width, height);
+    if ((st_out != st_ref) || memcmp(Out, Ref, size))
+    {
+        return 0;
+    }
+
+    /* Line entry point on every line, same fill around it */
+    for (uint32_t y = 0U; y < height; y++)
+    {
+        uint32_t n = width * VISION_Color_BytesPerPixel(df);
+
+        memset(Line, 0xA5, n + TEST_ALIGN + TEST_PAD);
+        st_line = VISION_Color_ConvertLine(Src + align + y * sstride, sf, Line + align, df, width);
+        if (st_line != st_ref)
+        {
+            return 0;
+        }
+        if ((st_ref == VISION_COLOR_OK) &&
+            (memcmp(Line + align, Ref + align + y * dstride, n) ||
+             (Line[align + n] != 0xA5U) || ((align > 0U) && (Line[align - 1U] != 0xA5U))))
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void Put(VISION_ColorFormat_t sf, uint32_t align, uint16_t width, uint32_t x,
+        uint32_t y, uint32_t value)
+{
+    uint32_t bpp = VISION_Color_BytesPerPixel(sf);
+    uint8_t *p = Src + align + y * (width * bpp + TEST_PAD) + x * bpp;
+
+    for (uint32_t i = 0U; i < bpp; i++)
+    {
+        p[i] = (uint8_t)(value >> (8U * i));
+    }
+}
+
+/* All values of the source format, in as many images as it takes */
+static int Exhaustive(VISION_ColorFormat_t sf, VISION_ColorFormat_t df, uint32_t align,
+        uint32_t *pixels)
+{
+    int ok = 1;
+
+    switch (sf)
+    {
+        case VISION_COLOR_RGB565:
+        case VISION_COLOR_RGB565_SWAP:
+            for (uint32_t i = 0U; i < 65536U; i++)
+            {
+                Put(sf, align, 256U, i & 0xFFU, i >> 8, i);
+            }
+            ok &= Check(sf, df, align, 256U, 256U);
+            *pixels += 65536U;
+            break;
+        case VISION_COLOR_RGB888:
+        case VISION_COLOR_ARGB8888:
+            for (uint32_t r = 0U; r < 256U; r++)
+            {
+                for (uint32_t i = 0U; i < 65536U; i++)
+                {
+                    Put(sf, align, 256U, i & 0xFFU, i >> 8, (Rand() << 24) | (r << 16) | i);
+                }
+                ok &= Check(sf, df, align, 256U, 256U);
+                *pixels += 65536U;
+            }
+            break;
+        case VISION_COLOR_YUV422:
+            for (uint32_t pass = 0U; pass < 2U; pass++)
+            {
+                for (uint32_t y0 = 0U; y0 < 256U; y0++)
+                {
+                    for (uint32_t i = 0U; i < 65536U; i++)
+                    {
+                        uint32_t y1 = (pass == 0U) ? y0 : (Rand() & 0xFFU);
+
+                        /* Pixel pair Y0 U Y1 V: U along the line, V down */
+                        Put(VISION_COLOR_ARGB8888, align, 256U, i & 0xFFU, i >> 8,
+                                ((i >> 8) << 24) | (y1 << 16) | ((i & 0xFFU) << 8) | y0);
+                    }
+                    ok &= Check(sf, df, align, 512U, 256U);
+                    *pixels += 131072U;
+                }
+            }
+            break;
+        case VISION_COLOR_GRAY8:
+        default:
+            for (uint32_t i = 0U; i < 256U; i++)
+            {
+                Put(sf, align, 256U, i, 0U, i);
+            }
+            ok &= Check(sf, df, align, 256U, 1U);
+            *pixels += 256U;
+            break;
+    }
+    return ok;
+}
+
+/* Widths 1..TEST_SHORT_WIDTH on random bytes: kernel tails, odd YUV422 refused */
+static int Short(VISION_ColorFormat_t sf, VISION_ColorFormat_t df, uint32_t align)
+{
+    int ok = 1;
+
+    for (uint16_t w = 1U; w <= TEST_SHORT_WIDTH; w++)
+    {
+        for (uint32_t i = 0U; i < 3U * (w * TEST_MAX_BPP + TEST_PAD); i++)
+        {
+            Src[align + i] = (uint8_t)Rand();
+        }
+        ok &= Check(sf, df, align, w, 3U);
+    }
+    return ok;
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    for (uint32_t sf = 0U; sf < VISION_COLOR_FORMATS; sf++)
+    {
+        for (uint32_t df = 0U; df < VISION_COLOR_FORMATS; df++)
+        {
+            uint32_t pixels = 0U;
+            int ok = 1;
+
+            for (uint32_t align = 0U; align < TEST_ALIGN; align++)
+            {
+                /* The 2^24 sets once, the other alignments by the short widths */
+                if ((align == 0U) || (sf == VISION_COLOR_RGB565) ||
+                    (sf == VISION_COLOR_RGB565_SWAP) || (sf == VISION_COLOR_GRAY8))
+                {
+                    ok &= Exhaustive(sf, df, align, &pixels);
+                }
+                ok &= Short(sf, df, align);
+            }
+            printf("%-4s -> %-4s %10u px %s\n", Names[sf], Names[df], pixels,
+                    ok ? "ok" : "MISMATCH");
+            fail |= !ok;
+        }
+    }
+    printf(fail ? "FAIL\n" : "all ok\n");
+    return fail;
+}
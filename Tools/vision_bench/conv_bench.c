@@ -0,0 +1,124 @@
+/*
+ * conv_bench.c
+ * Host benchmark of the convolution engine (User/Vision/cam_conv.c)
+ *
+ * Runs every predefined kernel on synthetic 320x240 Y8 and RGB565 frames,
+ * checks CAM_Conv_Frame() against CAM_Conv_FrameRef() bit for bit and prints
+ * the time per pixel of both (cycles from the time stamp counter on x86).
+ * The on-target figures come from DebugMain case 16.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -IUser/Vision -o conv_bench Tools/vision_bench/conv_bench.c \
+ *       User/Vision/cam_conv.c User/Vision/vision_luma.c
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "cam_conv.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#define BENCH_TSC()                   __rdtsc()
+#else
+#define BENCH_TSC()                   (0ULL)
+#endif
+
+#define BENCH_WIDTH                   (320U)
+#define BENCH_HEIGHT                  (240U)
+#define BENCH_RUNS                    (20U)
+
+typedef struct
+{
+    const char              *name;
+    const CAM_ConvKernel_t  *kernel;
+} Bench_Kernel_t;
+
+static const Bench_Kernel_t Kernels[] =
+{
+    { "box3",     &CAM_ConvBox3 },
+    { "gauss3",   &CAM_ConvGauss3 },
+    { "gauss5",   &CAM_ConvGauss5 },
+    { "sharpen3", &CAM_ConvSharpen3 },
+    { "laplace3", &CAM_ConvLaplace3 },
+    { "sobelx",   &CAM_ConvSobelX },
+    { "sobely",   &CAM_ConvSobelY },
+};
+
+static uint8_t Src[BENCH_WIDTH * BENCH_HEIGHT * 2U];
+static uint8_t Fast[BENCH_WIDTH * BENCH_HEIGHT * 2U];
+static uint8_t Ref[BENCH_WIDTH * BENCH_HEIGHT * 2U];
+
+typedef CAM_ConvStatus_t (*Bench_Fn_t)(const CAM_ConvKernel_t*, CAM_ConvFormat_t,
+        const uint8_t*, uint32_t, uint8_t*, uint32_t, uint16_t, uint16_t);
+
+/* Gradients, edges and noise so every clamp and border case is hit */
+static void MakeFrame(uint32_t seed)
+{
+    for (uint32_t y = 0U; y < BENCH_HEIGHT; y++)
+    {
+        for (uint32_t x = 0U; x < BENCH_WIDTH; x++)
+        {
+            uint32_t i = y * BENCH_WIDTH + x;
+            seed = seed * 1664525U + 1013904223U;
+            uint32_t v = ((x * 255U) / BENCH_WIDTH) ^ (((x / 16U + y / 16U) & 1U) ? 0xFFU : 0U);
+            v = (seed >> 28 == 0U) ? (seed >> 8) & 0xFFU : v;
+            Src[i * 2U] = (uint8_t)v;
+            Src[i * 2U + 1U] = (uint8_t)(seed >> 24);
+        }
+    }
+}
+
+static double Run(Bench_Fn_t fn, const CAM_ConvKernel_t *k, CAM_ConvFormat_t fmt,
+        uint8_t *dst, uint32_t runs, double *cycles)
+{
+    uint32_t bpp = (fmt == CAM_CONV_FMT_RGB565) ? 2U : 1U;
+    struct timespec t0, t1;
+    uint64_t c0 = BENCH_TSC();
+
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (uint32_t r = 0U; r < runs; r++)
+    {
+        fn(k, fmt, Src, BENCH_WIDTH * bpp, dst, BENCH_WIDTH * bpp, BENCH_WIDTH, BENCH_HEIGHT);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    *cycles = (double)(BENCH_TSC() - c0) / ((double)runs * BENCH_WIDTH * BENCH_HEIGHT);
+    return ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) /
+            ((double)runs * BENCH_WIDTH * BENCH_HEIGHT);
+}
+
+int main(void)
+{
+    int fail = 0;
+
+    printf("%-9s %-6s %10s %10s %10s %10s %s\n", "kernel", "format",
+            "ns/px", "cyc/px", "ref ns/px", "ref cyc/px", "check");
+    for (uint32_t f = 0U; f < 2U; f++)
+    {
+        CAM_ConvFormat_t fmt = (f == 0U) ? CAM_CONV_FMT_Y8 : CAM_CONV_FMT_RGB565;
+        uint32_t bytes = BENCH_WIDTH * BENCH_HEIGHT * ((f == 0U) ? 1U : 2U);
+
+        for (uint32_t i = 0U; i < sizeof(Kernels) / sizeof(Kernels[0]); i++)
+        {
+            double fc, rc, fns, rns;
+            int ok = 1;
+
+            for (uint32_t seed = 1U; seed <= 4U; seed++)
+            {
+                MakeFrame(seed);
+                CAM_Conv_Frame(Kernels[i].kernel, fmt, Src, bytes / BENCH_HEIGHT, Fast,
+                        bytes / BENCH_HEIGHT, BENCH_WIDTH, BENCH_HEIGHT);
+                CAM_Conv_FrameRef(Kernels[i].kernel, fmt, Src, bytes / BENCH_HEIGHT, Ref,
+                        bytes / BENCH_HEIGHT, BENCH_WIDTH, BENCH_HEIGHT);
+                ok &= (memcmp(Fast, Ref, bytes) == 0);
+            }
+            fns = Run(CAM_Conv_Frame, Kernels[i].kernel, fmt, Fast, BENCH_RUNS, &fc);
+            rns = Run(CAM_Conv_FrameRef, Kernels[i].kernel, fmt, Ref, 2U, &rc);
+            printf("%-9s %-6s %10.2f %10.1f %10.2f %10.1f %s\n", Kernels[i].name,
+                    (f == 0U) ? "y8" : "rgb565", fns, fc, rns, rc, ok ? "ok" : "MISMATCH");
+            fail |= !ok;
+        }
+    }
+    return fail;
+}
@@ -0,0 +1,14 @@
+/*
+ * BSP_RGB_LCD.h
+ * Host stand-in for BSP/BSP_RGB_LCD.h: the panel size, defined by the test
+ */
+
+#ifndef __STM32746G_LCD_H
+#define __STM32746G_LCD_H
+
+#include <stdint.h>
+
+extern uint32_t BSP_LCD_GetXSize(void);
+extern uint32_t BSP_LCD_GetYSize(void);
+
+#endif /* __STM32746G_LCD_H */
@@ -0,0 +1,25 @@
+/*
+ * ltdc.h
+ * Host stand-in for Core/Inc/ltdc.h: the layer 0 frame buffer address
+ * GUI_Text.c starts on, the test defines hltdc. The address is a
+ * uintptr_t here so a host pointer fits.
+ */
+
+#ifndef __LTDC_H__
+#define __LTDC_H__
+
+#include "main.h"
+
+typedef struct
+{
+    uintptr_t FBStartAdress;
+} LTDC_LayerCfgTypeDef;
+
+typedef struct
+{
+    LTDC_LayerCfgTypeDef LayerCfg[2];
+} LTDC_HandleTypeDef;
+
+extern LTDC_HandleTypeDef hltdc;
+
+#endif /* __LTDC_H__ */
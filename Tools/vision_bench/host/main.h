@@ -0,0 +1,43 @@
+/*
+ * main.h
+ * Host stand-in for Core/Inc/main.h, for the host tests of the modules
+ * that include it
+ *
+ * Only the HAL types, macros and DMA2D modes these modules use, with the
+ * values of the STM32H7 HAL. The test defines SystemCoreClock,
+ * HAL_GetTick() and the BSP functions it links against (BSP_DMA2D.h,
+ * BSP_MDMA.h), emulating the peripherals.
+ */
+
+#ifndef __MAIN_H
+#define __MAIN_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef enum
+{
+    HAL_OK = 0x00U,
+    HAL_ERROR = 0x01U,
+    HAL_BUSY = 0x02U,
+    HAL_TIMEOUT = 0x03U
+} HAL_StatusTypeDef;
+
+#define UNUSED(x)                                ((void)(x))
+
+#define DMA2D_INPUT_ARGB8888                     (0x00000000U)
+#define DMA2D_INPUT_RGB888                       (0x00000001U)
+#define DMA2D_INPUT_RGB565                       (0x00000002U)
+#define DMA2D_INPUT_L8                           (0x00000005U)
+#define DMA2D_INPUT_L4                           (0x00000008U)
+#define DMA2D_INPUT_A8                           (0x00000009U)
+#define DMA2D_INPUT_A4                           (0x0000000AU)
+#define DMA2D_OUTPUT_ARGB8888                    (0x00000000U)
+#define DMA2D_OUTPUT_RGB888                      (0x00000001U)
+#define DMA2D_OUTPUT_RGB565                      (0x00000002U)
+
+extern uint32_t SystemCoreClock;
+
+extern uint32_t HAL_GetTick(void);
+
+#endif /* __MAIN_H */
@@ -0,0 +1,351 @@
+/*
+ * jpeg_test.c
+ * Host validation of the JPEG encoder (User/Vision/cam_jpeg.c) against libjpeg
+ *
+ * Every picture is encoded by CAM_Jpeg and by libjpeg's own baseline
+ * encoder (islow DCT, same quality and sampling factors); both files are
+ * decoded by libjpeg and compared with the source:
+ *  - RGB565: the splash (gAsset_800X221) cropped to several sizes, odd ones
+ *    included, and a synthetic picture with hard edges; 4:2:2 and 4:2:0,
+ *    qualities 30 to 95. The PSNR must stay within JPEG_TEST_MAX_DB_LOSS
+ *    of libjpeg's and the size within JPEG_TEST_MAX_SIZE_PCT of it. Tiny
+ *    pictures get JPEG_TEST_MAX_DB_LOSS_TINY: over a few hundred pixels the
+ *    8 bit color weights (the shared luma tables) show at high quality.
+ *  - YUV422 (Y0 U Y1 V): decoded as YCbCr and compared over the three
+ *    planes with the same bounds, against libjpeg fed the same samples.
+ *  - Streaming: strips through CAM_Jpeg_EncodeStrip() into a small buffer
+ *    drained by the flush callback give the same bytes as one
+ *    CAM_Jpeg_EncodeFrame(); a short buffer without flush reports
+ *    CAM_JPEG_OVERFLOW.
+ * On the target DebugMain case 11 ("Z11") encodes a camera frame.
+ *
+ * Build (from the repository root, libjpeg development files installed):
+ *   gcc -O2 -IUser/Vision -IUser/image -o jpeg_test Tools/vision_bench/jpeg_test.c \
+ *       User/Vision/cam_jpeg.c User/Vision/vision_luma.c User/image/image_asset.c \
+ *       User/image/asset_800X221.c -ljpeg -lm
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <jpeglib.h>
+#include "cam_jpeg.h"
+#include "image.h"
+#include "image_asset.h"
+
+#define TEST_SPLASH_W                 (800U)
+#define TEST_SPLASH_H                 (221U)
+#define TEST_MAX_W                    (800U)
+#define TEST_MAX_H                    (240U)
+#define TEST_OUT_BYTES                (1024U * 1024U)
+#define TEST_CHUNK                    (333U)
+
+/* Pass bounds against libjpeg at the same settings */
+#define JPEG_TEST_MAX_DB_LOSS         (0.25)
+#define JPEG_TEST_MAX_DB_LOSS_TINY    (1.0)
+#define JPEG_TEST_TINY_PIXELS         (4096U)
+#define JPEG_TEST_MAX_SIZE_PCT        (5.0)
+
+typedef struct
+{
+    double   psnr;                /* dB over the compared planes */
+    uint32_t size;
+} Result_t;
+
+static uint16_t Splash[TEST_SPLASH_W * TEST_SPLASH_H];
+static uint16_t Rgb[TEST_MAX_W * TEST_MAX_H];
+static uint8_t Yuv[TEST_MAX_W * TEST_MAX_H * 2U];
+static uint8_t Out[TEST_OUT_BYTES];
+static uint8_t Ref[TEST_OUT_BYTES];
+static uint8_t Chunked[TEST_OUT_BYTES];
+static uint32_t ChunkedLen;
+
+/* Source samples of pixel x, y: RGB888 expansion or Y Cb Cr */
+static void Sample(CAM_JpegFormat_t fmt, uint32_t width, uint32_t x, uint32_t y, uint8_t s[3])
+{
+    if (fmt == CAM_JPEG_FMT_RGB565)
+    {
+        uint16_t p = Rgb[y * width + x];
+
+        s[0] = (uint8_t)(((p >> 11) << 3) | (p >> 13));
+        s[1] = (uint8_t)((((p >> 5) & 0x3FU) << 2) | ((p >> 9) & 0x03U));
+        s[2] = (uint8_t)(((p & 0x1FU) << 3) | ((p >> 2) & 0x07U));
+    }
+    else
+    {
+        const uint8_t *pair = &Yuv[(y * width + (x & ~1U)) * 2U];
+
+        s[0] = pair[(x & 1U) * 2U];
+        s[1] = pair[1];
+        s[2] = pair[3];
+    }
+}
+
+/* Decodes a JPEG and measures it against the source */
+static int Measure(const uint8_t *jpeg, uint32_t size, CAM_JpegFormat_t fmt, uint32_t width,
+        uint32_t height, Result_t *res)
+{
+    struct jpeg_decompress_struct d;
+    struct jpeg_error_mgr err;
+    static uint8_t row[TEST_MAX_W * 3U];
+    double se = 0.0;
+
+    d.err = jpeg_std_error(&err);
+    jpeg_create_decompress(&d);
+    jpeg_mem_src(&d, jpeg, size);
+    if ((jpeg_read_header(&d, TRUE) != JPEG_HEADER_OK) || (d.image_width != width) ||
+            (d.image_height != height))
+    {
+        jpeg_destroy_decompress(&d);
+        return 0;
+    }
+    d.out_color_space = (fmt == CAM_JPEG_FMT_RGB565) ? JCS_RGB : JCS_YCbCr;
+    d.dct_method = JDCT_ISLOW;
+    jpeg_start_decompress(&d);
+    while (d.output_scanline < height)
+    {
+        uint8_t *r = row;
+        uint32_t y = d.output_scanline;
+
+        jpeg_read_scanlines(&d, &r, 1);
+        for (uint32_t x = 0U; x < width; x++)
+        {
+            uint8_t s[3];
+
+            Sample(fmt, width, x, y, s);
+            for (uint32_t c = 0U; c < 3U; c++)
+            {
+                double e = (double)row[x * 3U + c] - s[c];
+                se += e * e;
+            }
+        }
+    }
+    jpeg_finish_decompress(&d);
+    jpeg_destroy_decompress(&d);
+    res->size = size;
+    res->psnr = (se == 0.0) ? 99.0 : 10.0 * log10(255.0 * 255.0 * width * height * 3.0 / se);
+    return 1;
+}
+
+/* libjpeg's baseline encoder on the same samples */
+static uint32_t Reference(CAM_JpegFormat_t fmt, CAM_JpegSub_t sub, uint8_t quality,
+        uint32_t width, uint32_t height)
+{
+    struct jpeg_compress_struct c;
+    struct jpeg_error_mgr err;
+    static uint8_t row[TEST_MAX_W * 3U];
+    unsigned char *mem = NULL;
+    unsigned long len = 0;
+
+    c.err = jpeg_std_error(&err);
+    jpeg_create_compress(&c);
+    jpeg_mem_dest(&c, &mem, &len);
+    c.image_width = width;
+    c.image_height = height;
+    c.input_components = 3;
+    c.in_color_space = (fmt == CAM_JPEG_FMT_RGB565) ? JCS_RGB : JCS_YCbCr;
+    jpeg_set_defaults(&c);
+    jpeg_set_quality(&c, quality, TRUE);
+    c.dct_method = JDCT_ISLOW;
+    c.optimize_coding = FALSE;
+    c.comp_info[0].h_samp_factor = 2;
+    c.comp_info[0].v_samp_factor = (sub == CAM_JPEG_SUB_420) ? 2 : 1;
+    jpeg_start_compress(&c, TRUE);
+    while (c.next_scanline < height)
+    {
+        uint8_t *r = row;
+
+        for (uint32_t x = 0U; x < width; x++)
+        {
+            Sample(fmt, width, x, c.next_scanline, &row[x * 3U]);
+        }
+        jpeg_write_scanlines(&c, &r, 1);
+    }
+    jpeg_finish_compress(&c);
+    jpeg_destroy_compress(&c);
+    memcpy(Ref, mem, len);
+    free(mem);
+    return (uint32_t)len;
+}
+
+static int Flush(void *user, const uint8_t *data, uint32_t len)
+{
+    (void)user;
+    if (ChunkedLen + len > sizeof(Chunked))
+    {
+        return 1;
+    }
+    memcpy(&Chunked[ChunkedLen], data, len);
+    ChunkedLen += len;
+    return 0;
+}
+
+/* Strips into a TEST_CHUNK byte buffer, drained by Flush() */
+static int Streamed(CAM_JpegFormat_t fmt, CAM_JpegSub_t sub, uint8_t quality, uint32_t width,
+        uint32_t height, uint32_t size)
+{
+    static uint8_t chunk[TEST_CHUNK];
+    const uint8_t *src = (fmt == CAM_JPEG_FMT_RGB565) ? (const uint8_t*)Rgb : Yuv;
+    CAM_Jpeg_t jpg;
+    uint32_t total = 0U;
+
+    ChunkedLen = 0U;
+    if (CAM_Jpeg_Begin(&jpg, (uint16_t)width, (uint16_t)height, fmt, sub, quality, chunk,
+            sizeof(chunk), Flush, NULL) != CAM_JPEG_OK)
+    {
+        return 0;
+    }
+    for (uint32_t y = 0U; y < height; y += CAM_Jpeg_StripLines(&jpg))
+    {
+        uint32_t lines = height - y;
+
+        lines = (lines > CAM_Jpeg_StripLines(&jpg)) ? CAM_Jpeg_StripLines(&jpg) : lines;
+        if (CAM_Jpeg_EncodeStrip(&jpg, &src[y * width * 2U], width * 2U, (uint16_t)lines)
+                != CAM_JPEG_OK)
+        {
+            return 0;
+        }
+    }
+    return (CAM_Jpeg_End(&jpg, &total) == CAM_JPEG_OK) && (total == size) &&
+            (ChunkedLen == size) && !memcmp(Chunked, Out, size);
+}
+
+/* One picture at every setting; 0 on a failure */
+static int Run(const char *name, CAM_JpegFormat_t fmt, uint32_t width, uint32_t height)
+{
+    static const uint8_t qualities[] = { 30U, 50U, 75U, 90U, 95U };
+    double loss = (width * height < JPEG_TEST_TINY_PIXELS) ?
+            JPEG_TEST_MAX_DB_LOSS_TINY : JPEG_TEST_MAX_DB_LOSS;
+    int ok = 1;
+
+    for (uint32_t s = 0U; s < 2U; s++)
+    {
+        CAM_JpegSub_t sub = (s == 0U) ? CAM_JPEG_SUB_422 : CAM_JPEG_SUB_420;
+
+        for (uint32_t q = 0U; q < sizeof(qualities); q++)
+        {
+            const uint8_t *src = (fmt == CAM_JPEG_FMT_RGB565) ? (const uint8_t*)Rgb : Yuv;
+            Result_t mine = { 0.0, 0U }, ref = { 0.0, 0U };
+            uint32_t size = 0U;
+            int pass;
+
+            pass = (CAM_Jpeg_EncodeFrame(src, (uint16_t)width, (uint16_t)height, fmt, sub,
+                    qualities[q], Out, sizeof(Out), &size) == CAM_JPEG_OK) &&
+                    Measure(Out, size, fmt, width, height, &mine);
+            pass = pass && Measure(Ref, Reference(fmt, sub, qualities[q], width, height), fmt,
+                    width, height, &ref);
+            pass = pass && (mine.psnr >= ref.psnr - loss) &&
+                    (mine.size <= ref.size * (1.0 + JPEG_TEST_MAX_SIZE_PCT / 100.0));
+            pass = pass && Streamed(fmt, sub, qualities[q], width, height, size);
+            printf("%-8s %3ux%-3u %s q%-3u %7u B %6.2f dB | libjpeg %7u B %6.2f dB %s\n", name,
+                    width, height, (s == 0U) ? "422" : "420", qualities[q], mine.size, mine.psnr,
+                    ref.size, ref.psnr, pass ? "ok" : "FAIL");
+            ok &= pass;
+        }
+    }
+    return ok;
+}
+
+/* Centered splash window, rows past the splash repeat its last one */
+static void CropSplash(uint32_t width, uint32_t height)
+{
+    uint32_t x0 = (TEST_SPLASH_W - width) / 2U;
+    uint32_t y0 = (height < TEST_SPLASH_H) ? (TEST_SPLASH_H - height) / 2U : 0U;
+
+    for (uint32_t y = 0U; y < height; y++)
+    {
+        uint32_t sy = (y0 + y < TEST_SPLASH_H) ? y0 + y : TEST_SPLASH_H - 1U;
+
+        memcpy(&Rgb[y * width], &Splash[sy * TEST_SPLASH_W + x0], width * 2U);
+    }
+}
+
+/* Hard edges, gradients and a little noise */
+static void MakeSynthetic(uint32_t width, uint32_t height)
+{
+    uint32_t seed = 7U;
+
+    for (uint32_t y = 0U; y < height; y++)
+    {
+        for (uint32_t x = 0U; x < width; x++)
+        {
+            uint32_t r = x * 31U / width, g = y * 63U / height, b = ((x + y) / 8U) & 31U;
+
+            seed = seed * 1664525U + 1013904223U;
+            r = ((x / 20U + y / 20U) & 1U) ? 31U - r : r;
+            g = (g + (seed >> 30)) & 63U;
+            Rgb[y * width + x] = (uint16_t)((r << 11) | (g << 5) | b);
+        }
+    }
+}
+
+/* YUV422 of the splash window: BT.601 full range, chroma of the pair */
+static void MakeYuv(uint32_t width, uint32_t height)
+{
+    for (uint32_t y = 0U; y < height; y++)
+    {
+        for (uint32_t x = 0U; x < width; x += 2U)
+        {
+            int32_t cb = 0, cr = 0;
+
+            for (uint32_t k = 0U; k < 2U; k++)
+            {
+                uint8_t s[3];
+                int32_t l;
+
+                Sample(CAM_JPEG_FMT_RGB565, width, x + k, y, s);
+                l = (77 * s[0] + 150 * s[1] + 29 * s[2] + 128) >> 8;
+                Yuv[(y * width + x) * 2U + k * 2U] = (uint8_t)l;
+                cb += ((-43 * s[0] - 85 * s[1] + 128 * s[2]) >> 8) + 128;
+                cr += ((128 * s[0] - 107 * s[1] - 21 * s[2]) >> 8) + 128;
+            }
+            Yuv[(y * width + x) * 2U + 1U] = (uint8_t)(cb / 2);
+            Yuv[(y * width + x) * 2U + 3U] = (uint8_t)(cr / 2);
+        }
+    }
+}
+
+int main(void)
+{
+    static const uint32_t sizes[][2] =
+    {
+        { 320U, 240U }, { 800U, 221U }, { 322U, 237U }, { 64U, 8U }, { 17U, 5U },
+    };
+    uint32_t size = 0U;
+    int ok = 1;
+
+    if (IMAGE_Asset_Draw(gAsset_800X221, Splash, TEST_SPLASH_W, TEST_SPLASH_W, TEST_SPLASH_H,
+            0, 0) != IMAGE_ASSET_OK)
+    {
+        printf("splash asset: decode failed\n");
+        return 1;
+    }
+    for (uint32_t i = 0U; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+    {
+        CropSplash(sizes[i][0], sizes[i][1]);
+        ok &= Run("splash", CAM_JPEG_FMT_RGB565, sizes[i][0], sizes[i][1]);
+    }
+    MakeSynthetic(320U, 240U);
+    ok &= Run("edges", CAM_JPEG_FMT_RGB565, 320U, 240U);
+    MakeSynthetic(322U, 237U);
+    ok &= Run("edges", CAM_JPEG_FMT_RGB565, 322U, 237U);
+
+    CropSplash(320U, 240U);
+    MakeYuv(320U, 240U);
+    ok &= Run("yuv422", CAM_JPEG_FMT_YUV422, 320U, 240U);
+    CropSplash(66U, 21U);
+    MakeYuv(66U, 21U);
+    ok &= Run("yuv422", CAM_JPEG_FMT_YUV422, 66U, 21U);
+
+    MakeSynthetic(320U, 240U);
+    if (CAM_Jpeg_EncodeFrame((const uint8_t*)Rgb, 320U, 240U, CAM_JPEG_FMT_RGB565,
+            CAM_JPEG_SUB_420, 75U, Out, 1000U, &size) != CAM_JPEG_OVERFLOW)
+    {
+        printf("short buffer without flush: no overflow reported FAIL\n");
+        ok = 0;
+    }
+    printf("%s\n", ok ? "all ok" : "FAILED");
+    return !ok;
+}
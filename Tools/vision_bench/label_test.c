@@ -0,0 +1,500 @@
+/*
+ * label_test.c
+ * Host test of the label cache (User/GUI/GUI_Label.c)
+ *
+ * Every label draw is compared pixel for pixel with the same text drawn
+ * directly by GUI_Text on a second surface over the same background: A8
+ * labels blended over it, RGB565 labels over their box filled with the
+ * background color (the line box and the ink out of it). The DMA2D is
+ * emulated with the CPU blend of GUI_Text (5 bit alpha), the result the
+ * fallbacks promise, and can refuse the jobs.
+ *
+ * Covered:
+ *  - ASCII with kerning, fallback to the Latin-1 and CJK fonts, blank and
+ *    empty texts, both formats, drawn inside the surface, cut by each edge
+ *    and outside it, on a miss and on a hit, DMA2D working and refusing
+ *    (CPU copy counted as a blit error)
+ *  - keys: a hit on the same label, A8 recolored still a hit, RGB565 with
+ *    other colors, another font set or format a miss; the longest text
+ *    that is a key, and texts one byte longer drawn directly and counted
+ *    as bypass; Invalidate() of one text and of all; one blit error per
+ *    draw while the DMA2D refuses, on a miss and on a hit
+ *  - first fit: 32 and 64 byte labels placed exactly at the start of the
+ *    pool and after a buffer, without overwriting their neighbours
+ *  - LRU pool: 200 labels drawn at random, mostly the recent ones, in both
+ *    formats and of very different sizes, so entries are evicted both for
+ *    the entry table and for the pool space: a label drawn every few churn
+ *    draws is never evicted, the last few labels drawn are all still
+ *    hits, every hit draws the same pixels as the direct text (a buffer
+ *    overwritten by another entry shows), the counters add up and the
+ *    pool bytes drop to 0 when everything is invalidated.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ITools/vision_bench/host -IUser/GUI -IUser/Fonts -IUser/Vision -IBSP \
+ *       -o label_test Tools/vision_bench/label_test.c User/GUI/GUI_Label.c \
+ *       User/GUI/GUI_Layout.c User/GUI/GUI_Text.c User/Fonts/fonts_pk.c \
+ *       User/Fonts/font20AA.c User/Fonts/font20AAX.c User/Fonts/font24CJK.c
+ * With -fsanitize=address,undefined -g to catch accesses out of the pool.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "main.h"
+#include "ltdc.h"
+#include "BSP_DMA2D.h"
+#include "GUI_Label.h"
+#include "GUI_Layout.h"
+#include "GUI_Text.h"
+
+#define TEST_WIDTH                    (800U)
+#define TEST_HEIGHT                   (480U)
+#define TEST_LABELS                   (200U)
+#define TEST_CHURN                    (1500U)
+#define TEST_HOT_EVERY                (4U)
+#define TEST_RECENT                   (4U)
+
+LTDC_HandleTypeDef hltdc;
+uint32_t SystemCoreClock = 480000000U;
+
+static uint8_t Dma = 1U;
+static uint32_t Seed = 12345U;
+
+static uint16_t Screen[TEST_WIDTH * TEST_HEIGHT];
+static uint16_t Direct[TEST_WIDTH * TEST_HEIGHT];
+static const GUI_Text_Surface_t ScreenSurface = { Screen, TEST_WIDTH, TEST_WIDTH, TEST_HEIGHT };
+static const GUI_Text_Surface_t DirectSurface = { Direct, TEST_WIDTH, TEST_WIDTH, TEST_HEIGHT };
+static GUI_Layout_Glyph_t Glyph[GUI_LABEL_GLYPHS];
+
+static const GUI_Text_Fonts_t Latin = { { &Font20AA, &Font20AAX }, 2U };
+static const GUI_Text_Fonts_t All = { { &Font20AA, &Font20AAX, &Font24CJK }, 3U };
+static const GUI_Text_Fonts_t Cjk = { { &Font24CJK, &Font20AA }, 2U };
+
+static const char *const Texts[] =
+{
+    "Speed", "AVATAR Type", "km/h", "Temp 25\xC2\xB0" "C \xC2\xB1" "1",
+    "\xE5\xBE\xAE\xE9\x9B\xAA\xE7\x94\xB5\xE5\xAD\x90", " ", "", "Wj.", "1\n22\n333"
+};
+
+/******************************************************************************
+ *                               EMULATION                                    *
+ ******************************************************************************/
+
+uint32_t HAL_GetTick(void)
+{
+    return 0U;
+}
+
+uint32_t BSP_LCD_GetXSize(void)
+{
+    return TEST_WIDTH;
+}
+
+uint32_t BSP_LCD_GetYSize(void)
+{
+    return TEST_HEIGHT;
+}
+
+static uint16_t Rgb888To565(uint32_t c)
+{
+    return (uint16_t)(((c >> 8) & 0xF800U) | ((c >> 5) & 0x07E0U) | ((c >> 3) & 0x001FU));
+}
+
+/* A4/A8 in a fixed color over RGB565, in place */
+HAL_StatusTypeDef BSP_DMA2D_Blend(const BSP_DMA2D_Blend_t *blend)
+{
+    if (!Dma)
+    {
+        return HAL_BUSY;
+    }
+    if (((blend->src_mode != DMA2D_INPUT_A4) && (blend->src_mode != DMA2D_INPUT_A8)) ||
+        (blend->bg_mode != DMA2D_INPUT_RGB565) || (blend->out_mode != DMA2D_OUTPUT_RGB565) ||
+        (blend->bg != blend->dst) || (blend->bg_stride != blend->dst_stride))
+    {
+        return HAL_ERROR;
+    }
+    for (uint32_t y = 0U; y < blend->lines; y++)
+    {
+        const uint8_t *src = (const uint8_t*)blend->src + y * blend->src_stride;
+        uint16_t *dst = (uint16_t*)((uint8_t*)blend->dst + y * blend->dst_stride);
+
+        for (uint32_t x = 0U; x < blend->width; x++)
+        {
+            uint32_t a = (blend->src_mode == DMA2D_INPUT_A4) ?
+                    (((src[x >> 1] >> ((x & 1U) * 4U)) & 0x0FU) * 17U) : src[x];
+
+            dst[x] = BSP_DMA2D_Blend565(Rgb888To565(blend->color), dst[x], a >> 3);
+        }
+    }
+    return HAL_OK;
+}
+
+/* RGB565 copy */
+HAL_StatusTypeDef BSP_DMA2D_Convert(const BSP_DMA2D_Pfc_t *pfc)
+{
+    if (!Dma)
+    {
+        return HAL_BUSY;
+    }
+    if ((pfc->in_mode != DMA2D_INPUT_RGB565) || (pfc->out_mode != DMA2D_OUTPUT_RGB565) ||
+        pfc->swap)
+    {
+        return HAL_ERROR;
+    }
+    for (uint32_t y = 0U; y < pfc->lines; y++)
+    {
+        memcpy((uint8_t*)pfc->dst + y * pfc->dst_stride,
+                (const uint8_t*)pfc->src + y * pfc->src_stride, pfc->width * 2U);
+    }
+    return HAL_OK;
+}
+
+/******************************************************************************
+ *                                 DRAWING                                    *
+ ******************************************************************************/
+
+static uint32_t Rand(void)
+{
+    Seed = Seed * 1664525U + 1013904223U;
+    return Seed >> 8;
+}
+
+static void Background(void)
+{
+    for (uint32_t i = 0U; i < TEST_WIDTH * TEST_HEIGHT; i++)
+    {
+        Screen[i] = (uint16_t)Rand();
+    }
+    memcpy(Direct, Screen, sizeof(Direct));
+}
+
+/* Box of a cached label from its line box origin, as the cache sizes it:
+ * the ink, and the line box too for RGB565. Returns its pool bytes. */
+static uint32_t Box(const char *text, const GUI_Text_Fonts_t *fonts, GUI_Label_Format_t format,
+        int32_t *box)
+{
+    const aFONT *line = fonts->font[0];
+    GUI_Layout_t layout;
+    int32_t x0 = INT16_MAX, y0 = INT16_MAX, x1 = INT16_MIN, y1 = INT16_MIN;
+
+    GUI_Layout_Init(&layout, Glyph, GUI_LABEL_GLYPHS);
+    (void)GUI_Layout_TextFonts(&layout, text, fonts, 0U, 0U, GUI_LAYOUT_ALIGN_LEFT);
+    if (format == GUI_LABEL_RGB565)
+    {
+        x0 = 0;
+        y0 = 0;
+        x1 = layout.width;
+        y1 = layout.height;
+    }
+    for (uint32_t i = 0U; i < layout.count; i++)
+    {
+        const GUI_Layout_Glyph_t *lg = &layout.glyph[i];
+        const aGLYPH *g = &fonts->font[lg->font]->glyph[lg->index];
+        int32_t gx = lg->x + g->left;
+        int32_t gy = lg->y + line->ascent - g->top;
+
+        if (g->height != 0U)
+        {
+            x0 = (gx < x0) ? gx : x0;
+            y0 = (gy < y0) ? gy : y0;
+            x1 = ((gx + g->width) > x1) ? (gx + g->width) : x1;
+            y1 = ((gy + g->height) > y1) ? (gy + g->height) : y1;
+        }
+    }
+    if (x1 <= x0)
+    {
+        x0 = y0 = x1 = y1 = 0;
+    }
+    box[0] = x0;
+    box[1] = y0;
+    box[2] = x1;
+    box[3] = y1;
+    return ((uint32_t)((x1 - x0) * (y1 - y0)) * ((format == GUI_LABEL_RGB565) ? 2U : 1U) +
+            31U) & ~31U;
+}
+
+/* The label through the cache on Screen, the text directly on Direct:
+ * 1 if both surfaces are still the same */
+static int Draw(int16_t x, int16_t y, const char *text, const GUI_Text_Fonts_t *fonts,
+        uint16_t fg, uint16_t bg, GUI_Label_Format_t format)
+{
+    GUI_Text_SetSurface(&ScreenSurface);
+    GUI_Label_DrawFonts(x, y, text, fonts, fg, bg, format);
+
+    GUI_Text_SetSurface(&DirectSurface);
+    if (format == GUI_LABEL_RGB565)
+    {
+        int32_t box[4];
+
+        /* Not cacheable: the box of the first font's metrics */
+        if (strlen(text) >= GUI_LABEL_TEXT_MAX)
+        {
+            uint16_t lines;
+
+            box[0] = 0;
+            box[1] = 0;
+            box[2] = GUI_Layout_Measure(text, fonts->font[0], &lines);
+            box[3] = lines * fonts->font[0]->height;
+        }
+        else
+        {
+            (void)Box(text, fonts, format, box);
+        }
+        for (int32_t l = y + box[1]; l < y + box[3]; l++)
+        {
+            for (int32_t i = x + box[0]; i < x + box[2]; i++)
+            {
+                if ((l >= 0) && (l < (int32_t)TEST_HEIGHT) && (i >= 0) &&
+                    (i < (int32_t)TEST_WIDTH))
+                {
+                    Direct[(uint32_t)l * TEST_WIDTH + (uint32_t)i] = bg;
+                }
+            }
+        }
+    }
+    (void)GUI_Text_DrawUTF8(x, y, text, fonts, fg);
+    return !memcmp(Screen, Direct, sizeof(Screen));
+}
+
+/******************************************************************************
+ *                                 CHECKS                                     *
+ ******************************************************************************/
+
+/* Every text, both formats, at every kind of position, missed then hit */
+static int Pixels(uint8_t dma)
+{
+    static const int16_t Pos[][2] =
+    {
+        { 100, 100 }, { -7, 50 }, { 40, -9 }, { 760, 200 }, { 300, 465 }, { -30, -20 },
+        { 795, 470 }, { 900, 100 }, { 100, -100 }
+    };
+    const GUI_Label_Stats_t *st = GUI_Label_GetStats();
+    uint32_t errors = st->blit_errors;
+    int ok = 1;
+
+    Dma = dma;
+    Background();
+    GUI_Label_Init();
+    for (uint32_t f = 0U; f < 2U; f++)
+    {
+        for (uint32_t t = 0U; t < sizeof(Texts) / sizeof(Texts[0]); t++)
+        {
+            for (uint32_t p = 0U; p < sizeof(Pos) / sizeof(Pos[0]); p++)
+            {
+                const GUI_Text_Fonts_t *fonts = (t == 4U) ? ((p & 1U) ? &Cjk : &All) : &Latin;
+
+                ok &= Draw(Pos[p][0], Pos[p][1], Texts[t], fonts, 0xF81FU, 0x0010U,
+                        (GUI_Label_Format_t)f);
+                ok &= Draw((int16_t)(Pos[p][0] + 3), (int16_t)(Pos[p][1] + 2), Texts[t], fonts,
+                        (uint16_t)Rand(), 0x0010U, (GUI_Label_Format_t)f);
+            }
+        }
+    }
+    ok &= (st->hits != 0U) && (st->misses != 0U);
+    ok &= dma ? (st->blit_errors == 0U) : (st->blit_errors > errors);
+    return ok;
+}
+
+/* First fit to the byte: a 32 byte label at the start of the pool, then a
+ * 64 byte one in a hole too small for it, each drawn back as a hit */
+static int Pool(void)
+{
+    static const char *const Small[] = { "-", ".", ",", "'", ":", "_", "i", "l", "--" };
+    const GUI_Label_Stats_t *st = GUI_Label_GetStats();
+    const char *s32 = NULL;
+    const char *s64 = NULL;
+    uint32_t hits;
+    int32_t box[4];
+    int ok = 1;
+
+    for (uint32_t i = 0U; i < sizeof(Small) / sizeof(Small[0]); i++)
+    {
+        uint32_t size = Box(Small[i], &Latin, GUI_LABEL_A8, box);
+
+        s32 = ((s32 == NULL) && (size == 32U)) ? Small[i] : s32;
+        s64 = ((s64 == NULL) && (size == 64U)) ? Small[i] : s64;
+    }
+    if ((s32 == NULL) || (s64 == NULL))
+    {
+        return 0;
+    }
+
+    Dma = 1U;
+    Background();
+    GUI_Label_Init();
+    ok &= Draw(10, 10, s32, &Latin, 0xFFFFU, 0U, GUI_LABEL_A8);
+    ok &= Draw(10, 40, "Speed", &Latin, 0xFFFFU, 0U, GUI_LABEL_A8);
+    hits = st->hits;
+    ok &= Draw(200, 10, s32, &Latin, 0x07E0U, 0U, GUI_LABEL_A8);
+    ok &= (st->hits == hits + 1U);
+
+    GUI_Label_Invalidate(s32);
+    ok &= Draw(10, 70, s64, &Latin, 0xFFFFU, 0U, GUI_LABEL_A8);
+    hits = st->hits;
+    ok &= Draw(200, 40, "Speed", &Latin, 0x07E0U, 0U, GUI_LABEL_A8);
+    ok &= Draw(200, 70, s64, &Latin, 0x07E0U, 0U, GUI_LABEL_A8);
+    ok &= (st->hits == hits + 2U) && (st->evictions == 0U);
+    return ok;
+}
+
+/* What is a hit, a miss, a bypass; Invalidate() */
+static int Keys(void)
+{
+    static const char Long[] = "This text is far too long to be a key of the label cache";
+    const GUI_Label_Stats_t *st = GUI_Label_GetStats();
+    GUI_Label_Stats_t last;
+    char text[GUI_LABEL_TEXT_MAX + 1U];
+    uint32_t errors;
+    int ok = 1;
+
+#define KEYS_EXPECT(draw, h, m, b)    do { last = *st; ok &= (draw); \
+        ok &= (st->hits == last.hits + (h)) && (st->misses == last.misses + (m)) && \
+              (st->bypass == last.bypass + (b)); } while (0)
+
+    Dma = 1U;
+    Background();
+    GUI_Label_Init();
+    KEYS_EXPECT(Draw(10, 10, "Speed", &Latin, 0xFFFFU, 0U, GUI_LABEL_A8), 0U, 1U, 0U);
+    KEYS_EXPECT(Draw(200, 10, "Speed", &Latin, 0xFFFFU, 0U, GUI_LABEL_A8), 1U, 0U, 0U);
+    KEYS_EXPECT(Draw(200, 40, "Speed", &Latin, 0x07E0U, 0x1234U, GUI_LABEL_A8), 1U, 0U, 0U);
+    KEYS_EXPECT(Draw(10, 70, "Speed", &All, 0x07E0U, 0U, GUI_LABEL_A8), 0U, 1U, 0U);
+    KEYS_EXPECT(Draw(10, 100, "Speed", &Latin, 0x07E0U, 0U, GUI_LABEL_RGB565), 0U, 1U, 0U);
+    KEYS_EXPECT(Draw(200, 100, "Speed", &Latin, 0x07E0U, 0U, GUI_LABEL_RGB565), 1U, 0U, 0U);
+    KEYS_EXPECT(Draw(10, 130, "Speed", &Latin, 0xFFE0U, 0U, GUI_LABEL_RGB565), 0U, 1U, 0U);
+    KEYS_EXPECT(Draw(10, 160, "Speed", &Latin, 0xFFE0U, 0x0001U, GUI_LABEL_RGB565), 0U, 1U, 0U);
+    KEYS_EXPECT(Draw(10, 190, "Speed.", &Latin, 0xFFFFU, 0U, GUI_LABEL_A8), 0U, 1U, 0U);
+    KEYS_EXPECT(Draw(10, 220, Long, &Latin, 0xFFFFU, 0x001FU, GUI_LABEL_RGB565), 0U, 0U, 1U);
+    KEYS_EXPECT(Draw(10, 250, Long, &Latin, 0xFFFFU, 0U, GUI_LABEL_A8), 0U, 0U, 1U);
+
+    /* Only the entries of that text go */
+    GUI_Label_Invalidate("Speed");
+    KEYS_EXPECT(Draw(300, 10, "Speed", &Latin, 0xFFFFU, 0U, GUI_LABEL_A8), 0U, 1U, 0U);
+    KEYS_EXPECT(Draw(300, 190, "Speed.", &Latin, 0xFFFFU, 0U, GUI_LABEL_A8), 1U, 0U, 0U);
+    GUI_Label_Invalidate(NULL);
+    ok &= (st->bytes == 0U);
+    KEYS_EXPECT(Draw(300, 190, "Speed.", &Latin, 0xFFFFU, 0U, GUI_LABEL_A8), 0U, 1U, 0U);
+    ok &= (st->evictions == 0U) && (st->bytes != 0U);
+
+    /* The longest key and one byte more */
+    memset(text, 'x', GUI_LABEL_TEXT_MAX);
+    text[GUI_LABEL_TEXT_MAX] = '\0';
+    KEYS_EXPECT(Draw(10, 280, &text[1], &Latin, 0xFFFFU, 0U, GUI_LABEL_A8), 0U, 1U, 0U);
+    KEYS_EXPECT(Draw(10, 310, text, &Latin, 0xFFFFU, 0U, GUI_LABEL_A8), 0U, 0U, 1U);
+
+    /* DMA2D refusing: one CPU copy per draw, on a miss as on a hit */
+    Dma = 0U;
+    errors = st->blit_errors;
+    KEYS_EXPECT(Draw(10, 340, "Speed", &Latin, 0xFFFFU, 0U, GUI_LABEL_A8), 0U, 1U, 0U);
+    KEYS_EXPECT(Draw(300, 340, "Speed", &Latin, 0xFFFFU, 0U, GUI_LABEL_A8), 1U, 0U, 0U);
+    ok &= (st->blit_errors == errors + 2U);
+    KEYS_EXPECT(Draw(10, 370, "Speed", &Latin, 0xFFFFU, 0x001FU, GUI_LABEL_RGB565), 0U, 1U, 0U);
+    KEYS_EXPECT(Draw(300, 370, "Speed", &Latin, 0xFFFFU, 0x001FU, GUI_LABEL_RGB565), 1U, 0U, 0U);
+    ok &= (st->blit_errors == errors + 4U);
+
+#undef KEYS_EXPECT
+
+    return ok;
+}
+
+/* Label n of the churn: short, long or 3 lines, so of very different sizes
+ * in the pool and small enough for the entry table to fill first */
+static void Name(char *text, uint32_t n)
+{
+    static const char *const Formats[] =
+    {
+        "Value %u\n%u\n%u", "Value %u, a longer label to fill the pool", "#%u"
+    };
+
+    snprintf(text, GUI_LABEL_TEXT_MAX, Formats[n % 3U], n, n * 7U, n * 13U);
+}
+
+/* 200 labels through the pool, LRU order kept */
+static int Churn(void)
+{
+    static const uint16_t Colors[][2] = { { 0xFFFFU, 0x0000U }, { 0x07E0U, 0x0010U } };
+    const GUI_Label_Stats_t *st = GUI_Label_GetStats();
+    uint32_t recent[TEST_RECENT] = { 0U };
+    uint32_t draws = 0U;
+    int ok = 1;
+
+    Dma = 1U;
+    Background();
+    GUI_Label_Init();
+    (void)Draw(0, 0, "Speed", &Latin, 0xFFFFU, 0U, GUI_LABEL_A8);
+    draws++;
+
+    for (uint32_t k = 0U; k < TEST_CHURN; k++)
+    {
+        char text[GUI_LABEL_TEXT_MAX];
+        uint32_t n = ((Rand() & 1U) != 0U) ? recent[Rand() % TEST_RECENT] :
+                (Rand() % TEST_LABELS);
+        GUI_Label_Format_t format = (GUI_Label_Format_t)(n & 1U);
+        const uint16_t *c = Colors[(n >> 1) & 1U];
+        uint32_t hits;
+
+        Name(text, n);
+        ok &= Draw((int16_t)(Rand() % TEST_WIDTH) - 100, (int16_t)(Rand() % TEST_HEIGHT) - 20,
+                text, &Latin, c[0], c[1], format);
+        draws++;
+        memmove(&recent[1], &recent[0], (TEST_RECENT - 1U) * sizeof(recent[0]));
+        recent[0] = n;
+
+        if ((k % TEST_HOT_EVERY) == 0U)
+        {
+            hits = st->hits;
+            ok &= Draw((int16_t)(Rand() % TEST_WIDTH), (int16_t)(Rand() % TEST_HEIGHT), "Speed",
+                    &Latin, (uint16_t)Rand(), 0U, GUI_LABEL_A8);
+            ok &= (st->hits == hits + 1U);
+            draws++;
+        }
+        ok &= (st->bytes <= GUI_LABEL_POOL_BYTES);
+    }
+
+    /* The last labels drawn, oldest first: all still there */
+    for (uint32_t i = TEST_RECENT; i-- > 0U;)
+    {
+        char text[GUI_LABEL_TEXT_MAX];
+        uint32_t n = recent[i];
+        uint32_t hits = st->hits;
+
+        Name(text, n);
+        ok &= Draw(100, 100, text, &Latin, Colors[(n >> 1) & 1U][0], Colors[(n >> 1) & 1U][1],
+                (GUI_Label_Format_t)(n & 1U));
+        ok &= (st->hits == hits + 1U);
+        draws++;
+    }
+
+    ok &= (st->hits + st->misses + st->bypass == draws) && (st->bypass == 0U) &&
+            (st->evictions != 0U) && (st->misses > st->evictions) &&
+            (st->misses - st->evictions <= GUI_LABEL_ENTRIES);
+    GUI_Label_Invalidate(NULL);
+    ok &= (st->bytes == 0U);
+    printf("churn: %u draws, %u hits, %u misses, %u evictions\n", draws, st->hits, st->misses,
+            st->evictions);
+    return ok;
+}
+
+int main(void)
+{
+    int fail = 0;
+    int ok;
+
+    ok = Pixels(1U);
+    printf("pixels, DMA2D %s\n", ok ? "ok" : "MISMATCH");
+    fail |= !ok;
+    ok = Pixels(0U);
+    printf("pixels, CPU copies %s\n", ok ? "ok" : "MISMATCH");
+    fail |= !ok;
+    ok = Keys();
+    printf("keys %s\n", ok ? "ok" : "MISMATCH");
+    fail |= !ok;
+    ok = Pool();
+    printf("pool first fit %s\n", ok ? "ok" : "MISMATCH");
+    fail |= !ok;
+    ok = Churn();
+    printf("LRU pool %s\n", ok ? "ok" : "MISMATCH");
+    fail |= !ok;
+
+    printf(fail ? "FAIL\n" : "all ok\n");
+    return fail;
+}
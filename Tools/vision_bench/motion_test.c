@@ -0,0 +1,635 @@
+/*
+ * motion_test.c
+ * Host test of the motion detector (User/Vision/cam_motion.c) and of the
+ * plain C lanes of User/Vision/vision_simd.h
+ *
+ * A recorded RGB565 frame sequence is replayed through CAM_Motion_Process()
+ * and every published result (mask, active blocks, score, SAD total, boxes)
+ * is compared with a scalar model written from the description: luma per
+ * pixel, 4x4 cell means, block SAD, flood fill grouping, Q8 background.
+ * The sequence is a raw file of back to back little endian RGB565 frames
+ * (as the recording ring replays them, or a dump of the camera buffer), or
+ * without arguments a synthetic recording: textured scene with sensor
+ * noise, objects entering and leaving, a lighting step, more blobs than
+ * CAM_MOTION_MAX_BOXES, a reset and two changes of frame size: 160x120
+ * (40x30 cells, a short last block row) and 150x94 (37x23 cells, a narrow
+ * last block column too, pixels past the last cell).
+ *
+ * The packed helpers the host build uses instead of the DSP instructions
+ * are checked bit for bit against the per lane definitions of the Armv7E-M
+ * instructions they stand for, on edge values and random words.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -IUser/Vision -o motion_test Tools/vision_bench/motion_test.c \
+ *       User/Vision/cam_motion.c User/Vision/vision_luma.c
+ *   ./motion_test [frames.raw width height]
+ * With -fsanitize=address,undefined -g to catch lane overflows.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include "cam_motion.h"
+#include "vision_simd.h"
+#include "vision_luma.h"
+
+#define TEST_WIDTH                    (320U)
+#define TEST_HEIGHT                   (240U)
+#define TEST_FRAMES                   (90U)
+#define TEST_SMALL_WIDTH              (160U)
+#define TEST_SMALL_HEIGHT             (120U)
+#define TEST_ODD_WIDTH                (150U)
+#define TEST_ODD_HEIGHT               (94U)
+#define TEST_LANE_RUNS                (2000000U)
+
+#define GRID_W                        CAM_MOTION_GRID_W
+#define GRID_H                        CAM_MOTION_GRID_H
+
+/* Scalar model of the detector */
+typedef struct
+{
+    uint8_t  threshold;
+    uint8_t  bg_shift;
+    uint8_t  learnt;
+    uint32_t grid_w;
+    uint32_t grid_h;
+    uint8_t  cell[GRID_H][GRID_W];
+    uint16_t bg16[GRID_H][GRID_W];
+    uint8_t  bg8[GRID_H][GRID_W];
+    uint8_t  mask[CAM_MOTION_BLOCKS];
+    int32_t  label[CAM_MOTION_BLOCKS];
+    /* Every group of the frame, largest first */
+    CAM_MotionBox_t all[CAM_MOTION_BLOCKS];
+    uint32_t nall;
+} Model_t;
+
+static uint32_t Frame[TEST_WIDTH * TEST_HEIGHT / 2U];
+static Model_t Model;
+static uint32_t Seed = 12345U;
+
+static uint32_t Rand(void)
+{
+    Seed = Seed * 1664525U + 1013904223U;
+    return Seed >> 8;
+}
+
+/******************************************************************************
+ *                               SCALAR MODEL                                 *
+ ******************************************************************************/
+
+/* BT.601 on the 8 bit expansion, as vision_luma.h defines it */
+static uint32_t ModelLuma(uint16_t px)
+{
+    uint32_t r = VISION_EXPAND5((px >> 11) & 0x1FU);
+    uint32_t g = VISION_EXPAND6((px >> 5) & 0x3FU);
+    uint32_t b = VISION_EXPAND5(px & 0x1FU);
+
+    return (77U * r + 150U * g + 29U * b + 128U) >> 8;
+}
+
+static void ModelFill(uint32_t i, uint32_t bx_n, uint32_t by_n, int32_t id, uint32_t *n,
+        uint32_t *x0, uint32_t *y0, uint32_t *x1, uint32_t *y1)
+{
+    uint32_t x = i % bx_n, y = i / bx_n;
+
+    if (!Model.mask[i] || (Model.label[i] >= 0))
+    {
+        return;
+    }
+    Model.label[i] = id;
+    (*n)++;
+    *x0 = (x < *x0) ? x : *x0;
+    *x1 = (x > *x1) ? x : *x1;
+    *y0 = (y < *y0) ? y : *y0;
+    *y1 = (y > *y1) ? y : *y1;
+    for (int32_t dy = -1; dy <= 1; dy++)
+    {
+        for (int32_t dx = -1; dx <= 1; dx++)
+        {
+            int32_t nx = (int32_t)x + dx, ny = (int32_t)y + dy;
+
+            if ((nx >= 0) && (ny >= 0) && (nx < (int32_t)bx_n) && (ny < (int32_t)by_n))
+            {
+                ModelFill((uint32_t)ny * bx_n + (uint32_t)nx, bx_n, by_n, id, n, x0, y0, x1, y1);
+            }
+        }
+    }
+}
+
+/* Largest first, then top to bottom, left to right */
+static int BoxCompare(const void *a, const void *b)
+{
+    const CAM_MotionBox_t *p = a, *q = b;
+
+    if (p->blocks != q->blocks)
+    {
+        return (int)q->blocks - (int)p->blocks;
+    }
+    if (p->y != q->y)
+    {
+        return (int)p->y - (int)q->y;
+    }
+    return (int)p->x - (int)q->x;
+}
+
+static void ModelProcess(const uint16_t *frame, uint32_t width, uint32_t height, CAM_Motion_t *out)
+{
+    uint32_t gw = width / CAM_MOTION_CELL, gh = height / CAM_MOTION_CELL;
+    uint32_t bx_n = (gw + CAM_MOTION_BLOCK - 1U) / CAM_MOTION_BLOCK;
+    uint32_t by_n = (gh + CAM_MOTION_BLOCK - 1U) / CAM_MOTION_BLOCK;
+    uint32_t cell = CAM_MOTION_CELL * CAM_MOTION_BLOCK;
+    CAM_MotionBox_t *all = Model.all;
+    uint32_t nall = 0U;
+
+    memset(out, 0, sizeof(*out));
+    if ((gw != Model.grid_w) || (gh != Model.grid_h))
+    {
+        Model.grid_w = gw;
+        Model.grid_h = gh;
+        Model.learnt = 0U;
+    }
+    for (uint32_t gy = 0U; gy < gh; gy++)
+    {
+        for (uint32_t gx = 0U; gx < gw; gx++)
+        {
+            uint32_t sum = 0U;
+
+            for (uint32_t y = 0U; y < CAM_MOTION_CELL; y++)
+            {
+                for (uint32_t x = 0U; x < CAM_MOTION_CELL; x++)
+                {
+                    sum += ModelLuma(frame[(gy * CAM_MOTION_CELL + y) * width +
+                            gx * CAM_MOTION_CELL + x]);
+                }
+            }
+            Model.cell[gy][gx] = (uint8_t)((sum + 8U) >> 4);
+        }
+    }
+
+    out->blocks_x = (uint16_t)bx_n;
+    out->blocks_y = (uint16_t)by_n;
+    memset(Model.mask, 0, sizeof(Model.mask));
+    if (Model.learnt)
+    {
+        for (uint32_t by = 0U; by < by_n; by++)
+        {
+            for (uint32_t bx = 0U; bx < bx_n; bx++)
+            {
+                uint32_t sad = 0U, cells = 0U;
+
+                /* Only the cells of the grid, the last blocks may be cut */
+                for (uint32_t y = by * 4U; (y < by * 4U + CAM_MOTION_BLOCK) && (y < gh); y++)
+                {
+                    for (uint32_t x = bx * 4U; (x < bx * 4U + CAM_MOTION_BLOCK) && (x < gw); x++)
+                    {
+                        int32_t d = (int32_t)Model.cell[y][x] - (int32_t)Model.bg8[y][x];
+                        sad += (uint32_t)((d < 0) ? -d : d);
+                        cells++;
+                    }
+                }
+                if (sad > Model.threshold * cells)
+                {
+                    Model.mask[by * bx_n + bx] = 1U;
+                    out->mask[(by * bx_n + bx) / 32U] |= 1UL << ((by * bx_n + bx) % 32U);
+                    out->active++;
+                    out->sad_total += sad;
+                }
+            }
+        }
+        out->score = (uint16_t)(out->active * 1000U / (bx_n * by_n));
+    }
+
+    for (uint32_t i = 0U; i < bx_n * by_n; i++)
+    {
+        Model.label[i] = -1;
+    }
+    for (uint32_t i = 0U; i < bx_n * by_n; i++)
+    {
+        if (Model.mask[i] && (Model.label[i] < 0))
+        {
+            uint32_t n = 0U, x0 = bx_n, y0 = by_n, x1 = 0U, y1 = 0U;
+
+            ModelFill(i, bx_n, by_n, (int32_t)nall, &n, &x0, &y0, &x1, &y1);
+            all[nall].x = (uint16_t)(x0 * cell);
+            all[nall].y = (uint16_t)(y0 * cell);
+            all[nall].w = (uint16_t)(((x1 + 1U) * cell > gw * 4U) ?
+                    gw * 4U - x0 * cell : (x1 - x0 + 1U) * cell);
+            all[nall].h = (uint16_t)(((y1 + 1U) * cell > gh * 4U) ?
+                    gh * 4U - y0 * cell : (y1 - y0 + 1U) * cell);
+            all[nall].blocks = (uint16_t)n;
+            nall++;
+        }
+    }
+    /* Stable: equal sizes stay in discovery order */
+    for (uint32_t i = 1U; i < nall; i++)
+    {
+        CAM_MotionBox_t b = all[i];
+        uint32_t j = i;
+
+        for (; (j > 0U) && (all[j - 1U].blocks < b.blocks); j--)
+        {
+            all[j] = all[j - 1U];
+        }
+        all[j] = b;
+    }
+    Model.nall = nall;
+    out->nboxes = (uint8_t)((nall < CAM_MOTION_MAX_BOXES) ? nall : CAM_MOTION_MAX_BOXES);
+    memcpy(out->box, all, out->nboxes * sizeof(all[0]));
+
+    for (uint32_t gy = 0U; gy < gh; gy++)
+    {
+        for (uint32_t gx = 0U; gx < gw; gx++)
+        {
+            int32_t v = (int32_t)Model.cell[gy][gx] << 8;
+            int32_t q = Model.bg16[gy][gx];
+            int32_t d = v - q;
+            uint32_t shift = Model.bg_shift;
+
+            if (!Model.learnt)
+            {
+                Model.bg16[gy][gx] = (uint16_t)v;
+                Model.bg8[gy][gx] = Model.cell[gy][gx];
+                continue;
+            }
+            if (Model.mask[(gy / 4U) * bx_n + gx / 4U])
+            {
+                shift += 2U;
+            }
+            /* Floor division, what the arithmetic shift does */
+            q += (d >= 0) ? (d >> shift) : -((-d + (1 << shift) - 1) >> shift);
+            Model.bg16[gy][gx] = (uint16_t)q;
+            Model.bg8[gy][gx] = (uint8_t)(((uint32_t)q + 128U) >> 8);
+        }
+    }
+    Model.learnt = 1U;
+}
+
+/* The boxes kept must be groups of the frame with the model's sizes;
+ * which of several groups of the same size is kept is not specified */
+static int CompareBoxes(CAM_Motion_t *got, const CAM_Motion_t *want)
+{
+    qsort(got->box, got->nboxes, sizeof(got->box[0]), BoxCompare);
+    if (got->nboxes != want->nboxes)
+    {
+        return 0;
+    }
+    for (uint32_t i = 0U; i < got->nboxes; i++)
+    {
+        uint32_t j = 0U;
+
+        if ((got->box[i].blocks != want->box[i].blocks) ||
+                ((i > 0U) && !memcmp(&got->box[i], &got->box[i - 1U], sizeof(got->box[0]))))
+        {
+            return 0;
+        }
+        for (; (j < Model.nall) && memcmp(&got->box[i], &Model.all[j], sizeof(got->box[0])); j++)
+        {
+        }
+        if (j == Model.nall)
+        {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int Compare(const CAM_Motion_t *got, const CAM_Motion_t *want, uint32_t n)
+{
+    CAM_Motion_t g = *got;
+    uint32_t blocks = want->blocks_x * want->blocks_y;
+
+    if ((g.blocks_x != want->blocks_x) || (g.blocks_y != want->blocks_y) ||
+            (g.active != want->active) || (g.score != want->score) ||
+            (g.sad_total != want->sad_total) ||
+            memcmp(g.mask, want->mask, ((blocks + 31U) / 32U) * 4U) ||
+            !CompareBoxes(&g, want))
+    {
+        printf("frame %u: active %u/%u sad %u/%u score %u/%u boxes %u/%u\n", n,
+                g.active, want->active, g.sad_total, want->sad_total, g.score, want->score,
+                g.nboxes, want->nboxes);
+        return 0;
+    }
+    return 1;
+}
+
+/******************************************************************************
+ *                           SYNTHETIC RECORDING                              *
+ ******************************************************************************/
+
+static uint16_t Rgb(uint32_t r, uint32_t g, uint32_t b)
+{
+    r = (r > 255U) ? 255U : r;
+    g = (g > 255U) ? 255U : g;
+    b = (b > 255U) ? 255U : b;
+    return (uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+static void Disk(uint16_t *px, uint32_t width, uint32_t height, int32_t cx, int32_t cy,
+        int32_t rad, uint16_t color)
+{
+    for (int32_t y = cy - rad; y <= cy + rad; y++)
+    {
+        for (int32_t x = cx - rad; x <= cx + rad; x++)
+        {
+            if ((x >= 0) && (y >= 0) && (x < (int32_t)width) && (y < (int32_t)height) &&
+                    ((x - cx) * (x - cx) + (y - cy) * (y - cy) <= rad * rad))
+            {
+                px[y * width + x] = color;
+            }
+        }
+    }
+}
+
+/* Frame n of the recording, scene lit by gain / 16 */
+static void MakeFrame(uint32_t n, uint32_t width, uint32_t height)
+{
+    uint16_t *px = (uint16_t*)Frame;
+    uint32_t gain = (n >= 50U) ? 22U : 16U;
+
+    for (uint32_t y = 0U; y < height; y++)
+    {
+        for (uint32_t x = 0U; x < width; x++)
+        {
+            uint32_t t = ((x / 8U + y / 8U) & 1U) ? 40U : 0U;
+            uint32_t noise = Rand() % 9U;
+
+            px[y * width + x] = Rgb((x * 200U / width + t + noise) * gain / 16U,
+                    (y * 180U / height + 30U + noise) * gain / 16U,
+                    (120U + t / 2U + noise) * gain / 16U);
+        }
+    }
+    /* One crosses the frame, one bounces, one leaves */
+    Disk(px, width, height, (int32_t)(n * 5U) - 40, (int32_t)height / 3, 22, Rgb(250, 40, 40));
+    Disk(px, width, height, (int32_t)width / 2, 30 + (int32_t)((n * 7U) % (height - 60U)), 14,
+            Rgb(20, 240, 60));
+    if (n < 40U)
+    {
+        Disk(px, width, height, (int32_t)width - 20 - (int32_t)(n * 6U), (int32_t)height - 30,
+                18, Rgb(250, 250, 250));
+    }
+    /* Faint blinking in the bottom right corner: near the thresholds of the
+     * cut blocks of the small sizes */
+    if (n & 1U)
+    {
+        Disk(px, width, height, (int32_t)width - 6, (int32_t)height - 5, 6, Rgb(150, 150, 100));
+    }
+    /* Scattered specks: more separate blobs than boxes */
+    if ((n >= 60U) && (n < 75U))
+    {
+        for (uint32_t i = 0U; i < 14U; i++)
+        {
+            Disk(px, width, height, (int32_t)(16U + (i % 7U) * 44U + (n & 3U)),
+                    (int32_t)(40U + (i / 7U) * 100U), (int32_t)(3U + i % 5U * 2U),
+                    ((n + i) & 1U) ? Rgb(0, 0, 0) : Rgb(255, 255, 0));
+        }
+    }
+}
+
+/******************************************************************************
+ *                                  LANES                                     *
+ ******************************************************************************/
+
+static uint32_t Byte(uint32_t v, uint32_t i)
+{
+    return (v >> (i * 8U)) & 0xFFU;
+}
+
+static uint32_t Half(uint32_t v, uint32_t i)
+{
+    return (v >> (i * 16U)) & 0xFFFFU;
+}
+
+static int32_t SHalf(uint32_t v, uint32_t i)
+{
+    return (int32_t)Half(v, i) - ((Half(v, i) & 0x8000U) ? 0x10000 : 0);
+}
+
+/* Every emulated helper against its instruction, lane by lane */
+static uint32_t LaneCheck(uint32_t a, uint32_t b, uint32_t acc)
+{
+    uint32_t bad = 0U, r;
+    int64_t dot = (int64_t)SHalf(a, 0) * SHalf(b, 0) + (int64_t)SHalf(a, 1) * SHalf(b, 1);
+
+    r = 0U;
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        r += (Byte(a, i) > Byte(b, i)) ? Byte(a, i) - Byte(b, i) : Byte(b, i) - Byte(a, i);
+    }
+    bad |= (VISION_USAD8(a, b) != r) << 0;
+    bad |= (VISION_USADA8(a, b, acc) != acc + r) << 1;
+
+    r = ((a + b) & 0xFFFFU) | (((Half(a, 1) + Half(b, 1)) & 0xFFFFU) << 16);
+    bad |= (VISION_UADD16(a, b) != r) << 2;
+    bad |= (VISION_SADD16(a, b) != r) << 3;
+    r = ((a - b) & 0xFFFFU) | (((Half(a, 1) - Half(b, 1)) & 0xFFFFU) << 16);
+    bad |= (VISION_SSUB16(a, b) != r) << 4;
+
+    r = 0U;
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        r |= ((Byte(a, i) + Byte(b, i)) & 0xFFU) << (i * 8U);
+    }
+    bad |= (VISION_UADD8(a, b) != r) << 5;
+    r = 0U;
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        r |= ((Byte(a, i) + Byte(b, i)) >> 1) << (i * 8U);
+    }
+    bad |= (VISION_UHADD8(a, b) != r) << 6;
+    r = 0U;
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        r |= ((Byte(a, i) > Byte(b, i)) ? Byte(a, i) - Byte(b, i) : 0U) << (i * 8U);
+    }
+    bad |= (VISION_UQSUB8(a, b) != r) << 7;
+
+    /* The sum wraps, the Q flag isn't modelled */
+    bad |= ((uint32_t)VISION_SMUAD(a, b) != (uint32_t)dot) << 8;
+    bad |= ((uint32_t)VISION_SMLAD(a, b, (int32_t)acc) != (uint32_t)(dot + acc)) << 9;
+
+    bad |= (VISION_PKLO(a, b) != (Half(a, 0) | (Half(b, 0) << 16))) << 10;
+    bad |= (VISION_PKHI(a, b) != (Half(a, 1) | (Half(b, 1) << 16))) << 11;
+    bad |= (VISION_REV16(a) != ((Byte(a, 1)) | (Byte(a, 0) << 8) | (Byte(a, 3) << 16) |
+            (Byte(a, 2) << 24))) << 12;
+    bad |= (VISION_UXTB16(a) != (Byte(a, 0) | (Byte(a, 2) << 16))) << 13;
+    r = ((int32_t)a < 0) ? 0U : (((int32_t)a > 255) ? 255U : a);
+    bad |= (VISION_USAT8((int32_t)a) != r) << 14;
+
+    r = 0U;
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        r |= ((Byte(a, i) >= Byte(b, i)) ? Byte(a, i) : Byte(b, i)) << (i * 8U);
+    }
+    bad |= (VISION_UMAX8(a, b) != r) << 15;
+    r = 0U;
+    for (uint32_t i = 0U; i < 4U; i++)
+    {
+        r |= ((Byte(a, i) >= Byte(b, i)) ? Byte(b, i) : Byte(a, i)) << (i * 8U);
+    }
+    bad |= (VISION_UMIN8(a, b) != r) << 16;
+
+    /* Luma of four pixels against one at a time */
+    bad |= (VISION_Luma4(a, b) != (ModelLuma((uint16_t)a) | (ModelLuma((uint16_t)(a >> 16)) << 8) |
+            (ModelLuma((uint16_t)b) << 16) | (ModelLuma((uint16_t)(b >> 16)) << 24))) << 17;
+    return bad;
+}
+
+static int TestLanes(void)
+{
+    static const char *const names[] =
+    {
+        "usad8", "usada8", "uadd16", "sadd16", "ssub16", "uadd8", "uhadd8", "uqsub8",
+        "smuad", "smlad", "pklo", "pkhi", "rev16", "uxtb16", "usat8", "umax8", "umin8",
+        "luma4",
+    };
+    static const uint32_t edge[] =
+    {
+        0x00000000U, 0xFFFFFFFFU, 0x80808080U, 0x7F7F7F7FU, 0x80008000U, 0x7FFF7FFFU,
+        0x00FF00FFU, 0xFF00FF00U, 0x00000100U, 0x000000FFU, 0x8000FFFFU, 0x01010101U,
+    };
+    const uint32_t nedge = sizeof(edge) / sizeof(edge[0]);
+    uint32_t bad = 0U;
+
+    for (uint32_t i = 0U; i < nedge; i++)
+    {
+        for (uint32_t j = 0U; j < nedge; j++)
+        {
+            for (uint32_t k = 0U; k < nedge; k++)
+            {
+                bad |= LaneCheck(edge[i], edge[j], edge[k]);
+            }
+        }
+    }
+    for (uint32_t n = 0U; n < TEST_LANE_RUNS; n++)
+    {
+        uint32_t a = (Rand() << 8) ^ Rand();
+        uint32_t b = (Rand() << 8) ^ Rand();
+
+        bad |= LaneCheck(a, b, (Rand() << 8) ^ Rand());
+    }
+    for (uint32_t i = 0U; i < sizeof(names) / sizeof(names[0]); i++)
+    {
+        if (bad & (1UL << i))
+        {
+            printf("lane %-7s MISMATCH\n", names[i]);
+        }
+    }
+    printf("lanes: %u helpers, %u random words: %s\n", (uint32_t)(sizeof(names) / sizeof(names[0])),
+            TEST_LANE_RUNS, bad ? "MISMATCH" : "ok");
+    return bad == 0U;
+}
+
+/******************************************************************************
+ *                                  REPLAY                                    *
+ ******************************************************************************/
+
+/* Frame n into Frame[], 0 at the end of the recording */
+static int NextFrame(FILE *f, uint32_t n, uint32_t *width, uint32_t *height)
+{
+    if (f != NULL)
+    {
+        return fread(Frame, 2U, *width * *height, f) == *width * *height;
+    }
+    if (n >= TEST_FRAMES)
+    {
+        return 0;
+    }
+    /* The last frames at smaller sizes: the detector learns again */
+    *width = (n >= TEST_FRAMES - 8U) ? TEST_SMALL_WIDTH : TEST_WIDTH;
+    *height = (n >= TEST_FRAMES - 8U) ? TEST_SMALL_HEIGHT : TEST_HEIGHT;
+    if (n >= TEST_FRAMES - 4U)
+    {
+        *width = TEST_ODD_WIDTH;
+        *height = TEST_ODD_HEIGHT;
+    }
+    MakeFrame(n, *width, *height);
+    return 1;
+}
+
+static int Replay(const char *path, uint32_t width, uint32_t height, uint8_t threshold,
+        uint8_t bg_shift)
+{
+    FILE *f = NULL;
+    uint32_t frames = 0U, moving = 0U, boxes = 0U;
+    int ok = 1;
+
+    if (path != NULL)
+    {
+        f = fopen(path, "rb");
+        if (f == NULL)
+        {
+            perror(path);
+            return 0;
+        }
+    }
+    Seed = 12345U;
+    memset(&Model, 0, sizeof(Model));
+    Model.threshold = threshold;
+    Model.bg_shift = bg_shift;
+    CAM_Motion_Init();
+    CAM_Motion_Config(threshold, bg_shift);
+    CAM_Motion_Enable(1U);
+
+    while (ok && NextFrame(f, frames, &width, &height))
+    {
+        CAM_Motion_t got, want;
+
+        if (frames == 30U)
+        {
+            CAM_Motion_Reset();
+            Model.learnt = 0U;
+        }
+        CAM_Motion_Process((const uint8_t*)Frame, (uint16_t)width, (uint16_t)height, frames + 1U);
+        ModelProcess((const uint16_t*)Frame, width, height, &want);
+        if (CAM_Motion_Get(&got) != frames + 1U)
+        {
+            printf("frame %u: not published\n", frames);
+            ok = 0;
+            break;
+        }
+        ok = Compare(&got, &want, frames);
+        moving += (got.active != 0U);
+        boxes = (got.nboxes > boxes) ? got.nboxes : boxes;
+        frames++;
+    }
+    if (f != NULL)
+    {
+        fclose(f);
+    }
+    printf("replay threshold %u shift %u: %u frames, %u with motion, up to %u boxes: %s\n",
+            threshold, bg_shift, frames, moving, boxes, ok ? "ok" : "MISMATCH");
+    return ok && (frames > 0U);
+}
+
+int main(int argc, char **argv)
+{
+    const char *path = NULL;
+    uint32_t width = TEST_WIDTH, height = TEST_HEIGHT;
+    int ok = 1;
+
+    if (argc == 4)
+    {
+        path = argv[1];
+        width = (uint32_t)strtoul(argv[2], NULL, 0);
+        height = (uint32_t)strtoul(argv[3], NULL, 0);
+        if ((width > TEST_WIDTH) || (height > TEST_HEIGHT) || (width % 2U) ||
+                (width < CAM_MOTION_CELL) || (height < CAM_MOTION_CELL))
+        {
+            printf("frames up to %ux%u, even width, at least one cell\n", TEST_WIDTH, TEST_HEIGHT);
+            return 2;
+        }
+    }
+    else if (argc != 1)
+    {
+        printf("usage: %s [frames.raw width height]\n", argv[0]);
+        return 2;
+    }
+
+    VISION_LumaInit();
+    ok &= TestLanes();
+    ok &= Replay(path, width, height, CAM_MOTION_DEF_THRESHOLD, CAM_MOTION_DEF_BG_SHIFT);
+    ok &= Replay(path, width, height, 4U, 1U);
+    ok &= Replay(path, width, height, 30U, 8U);
+    return !ok;
+}
@@ -0,0 +1,586 @@
+/*
+ * rec_test.c
+ * Host test of the recording ring (User/Vision/cam_rec.c)
+ *
+ * Every frame is generated from its sequence number, so whatever the ring
+ * hands back can be regenerated and compared word for word: mostly a scene
+ * changing a little from frame to frame (the delta case), some flat frames
+ * and some noise frames no coding shrinks (stored raw). The MDMA copy is
+ * emulated: done at once with the completion callback inside
+ * BSP_MDMA_Copy2D() as the interrupt would run it, refused, failed, or
+ * completed later (at the next HAL_GetTick(), as during a wait).
+ *
+ * For raw, RLE and delta with key intervals 1, 4 and 16, caps of one raw
+ * frame, a few frames, 1 MB and the whole pool, one frame size and sizes
+ * changing every few frames:
+ *  - recording: after every frame the ring holds a contiguous run of the
+ *    newest frames ending at the last capture, the payload within the cap,
+ *    the raw bytes and the span matching the frames held, no more bytes
+ *    than raw (exactly raw in raw mode)
+ *  - eviction and wrap: long recordings in small caps with payloads of very
+ *    different sizes, tiny frames up to CAM_REC_MAX_FRAMES, payloads a
+ *    word too large for the end of the pool or for a wrapped gap
+ *  - key frames: every frame in raw and RLE, at least one per key interval
+ *    with delta, and deltas stored
+ *  - replay: every position decoded going forwards (from the previous
+ *    frame), going backwards and at random seeks (from the key frame), the
+ *    playback at the recorded pace up to the newest frame, then back to
+ *    live with the ring kept
+ *  - capture: the release callback called once per accepted frame and
+ *    never for a refused one; frames refused when disabled, frozen, while
+ *    the previous one is staged, with an odd width, larger than the cap or
+ *    than CAM_REC_MAX_FRAME_BYTES, when the MDMA is busy; a failed copy
+ *    stores nothing; Freeze keeps a frame still being copied.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ITools/vision_bench/host -IUser/Vision -IBSP -o rec_test \
+ *       Tools/vision_bench/rec_test.c User/Vision/cam_rec.c
+ * With -fsanitize=address,undefined -g to catch accesses out of the pool.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "main.h"
+#include "BSP_MDMA.h"
+#include "cam_rec.h"
+
+#define TEST_WIDTH                    (320U)
+#define TEST_HEIGHT                   (240U)
+#define TEST_RAW_BYTES                (TEST_WIDTH * TEST_HEIGHT * 2U)
+#define TEST_MAX_SEQ                  (2048U)
+#define TEST_FRAMES                   (300U)
+#define TEST_TINY_FRAMES              (1500U)
+#define TEST_PERIOD_MS                (33U)
+#define TEST_SEEKS                    (300U)
+/* 2 * 146 * 505: the pool left after 40 QVGA frames, plus a word */
+#define TEST_FIT_WIDTH                (146U)
+#define TEST_FIT_HEIGHT               (505U)
+/* 2 * 94 * 817: a QVGA frame less a word */
+#define TEST_SHORT_WIDTH              (94U)
+#define TEST_SHORT_HEIGHT             (817U)
+
+typedef enum
+{
+    MDMA_DONE = 0,                /* copied, callback at once */
+    MDMA_BUSY,                    /* refused */
+    MDMA_FAIL,                    /* callback with an error */
+    MDMA_LATER,                   /* copied at the next HAL_GetTick() */
+} Mdma_Mode_t;
+
+uint32_t SystemCoreClock = 480000000U;
+
+static uint32_t Tick;
+static Mdma_Mode_t Mdma;
+static BSP_MDMA_Rect_t Job;
+static BSP_MDMA_Cb_t JobCb;
+static void *JobUser;
+static uint32_t Released;
+static uint32_t Seed = 12345U;
+
+static uint16_t Frame[TEST_WIDTH * TEST_HEIGHT];
+static uint16_t Expect[TEST_WIDTH * TEST_HEIGHT];
+/* Size of every frame recorded in a run, by sequence number */
+static uint16_t Width[TEST_MAX_SEQ];
+static uint16_t Height[TEST_MAX_SEQ];
+
+static const uint16_t Sizes[][2] =
+{
+    { 320U, 240U }, { 160U, 120U }, { 64U, 48U }, { 2U, 1U }, { 318U, 3U }, { 320U, 239U }
+};
+
+/******************************************************************************
+ *                               EMULATION                                    *
+ ******************************************************************************/
+
+static void Mdma_Run(void)
+{
+    BSP_MDMA_Cb_t cb = JobCb;
+
+    for (uint32_t l = 0U; l < Job.lines; l++)
+    {
+        memcpy((uint8_t*)Job.dst + l * Job.dst_stride,
+                (const uint8_t*)Job.src + l * Job.src_stride, Job.width);
+    }
+    JobCb = NULL;
+    if (cb != NULL)
+    {
+        cb(HAL_OK, JobUser);
+    }
+}
+
+uint32_t HAL_GetTick(void)
+{
+    if (JobCb != NULL)
+    {
+        Mdma_Run();
+    }
+    return Tick;
+}
+
+HAL_StatusTypeDef BSP_MDMA_Copy2D(const BSP_MDMA_Rect_t *rect, BSP_MDMA_Cb_t cb, void *user)
+{
+    if ((Mdma == MDMA_BUSY) || (JobCb != NULL))
+    {
+        return HAL_BUSY;
+    }
+    Job = *rect;
+    JobUser = user;
+    if (Mdma == MDMA_FAIL)
+    {
+        cb(HAL_ERROR, user);
+        return HAL_OK;
+    }
+    JobCb = cb;
+    if (Mdma == MDMA_DONE)
+    {
+        Mdma_Run();
+    }
+    return HAL_OK;
+}
+
+HAL_StatusTypeDef BSP_MDMA_Wait(uint32_t timeout_ms)
+{
+    (void)timeout_ms;
+    if (JobCb != NULL)
+    {
+        Mdma_Run();
+    }
+    return HAL_OK;
+}
+
+static void Release(void)
+{
+    Released++;
+}
+
+/******************************************************************************
+ *                                 FRAMES                                     *
+ ******************************************************************************/
+
+static uint32_t Rand(void)
+{
+    Seed = Seed * 1664525U + 1013904223U;
+    return Seed >> 8;
+}
+
+static uint32_t Hash(uint32_t x)
+{
+    x ^= x >> 16;
+    x *= 0x7FEB352DU;
+    x ^= x >> 15;
+    x *= 0x846CA68BU;
+    x ^= x >> 16;
+    return x;
+}
+
+/* Frame seq: one in eight noise, one in eight flat, the others a checker
+ * scrolling every 4 frames with a moving square and a few noisy pixels */
+static void Gen(uint32_t seq, uint16_t w, uint16_t h, uint16_t *p)
+{
+    uint32_t kind = Hash(seq) % 8U;
+
+    for (uint32_t y = 0U; y < h; y++)
+    {
+        for (uint32_t x = 0U; x < w; x++)
+        {
+            uint32_t i = y * w + x;
+            uint16_t v;
+
+            if (kind == 0U)
+            {
+                v = (uint16_t)Hash(seq * 131071U + i);
+            }
+            else if (kind == 1U)
+            {
+                v = (uint16_t)Hash(seq + 7U);
+            }
+            else
+            {
+                v = ((((x + seq / 4U) / 16U) + (y / 16U)) & 1U) ? 0xFFFFU : 0x001FU;
+                if (((x - (seq * 5U) % w) < 12U) && ((y - (seq * 3U) % h) < 12U))
+                {
+                    v = 0xF800U;
+                }
+                if ((Hash(seq ^ (i * 977U)) % 211U) == 0U)
+                {
+                    v = (uint16_t)Hash(i + seq);
+                }
+            }
+            p[i] = v;
+        }
+    }
+}
+
+/* The replayed frame against the capture it comes from */
+static int Same(const uint8_t *p, const CAM_RecFrame_t *info, uint32_t oldest)
+{
+    uint32_t seq = info->seq;
+
+    if ((p == NULL) || (seq >= TEST_MAX_SEQ) || (seq != oldest + info->pos) ||
+        (info->width != Width[seq]) || (info->height != Height[seq]) ||
+        (info->time_ms != seq * TEST_PERIOD_MS))
+    {
+        return 0;
+    }
+    Gen(seq, Width[seq], Height[seq], Expect);
+    return !memcmp(p, Expect, (uint32_t)Width[seq] * Height[seq] * 2U);
+}
+
+/******************************************************************************
+ *                                 CHECKS                                     *
+ ******************************************************************************/
+
+/* Captures frame seq and stores it, checks the ring after it */
+static int Record(uint32_t seq, uint32_t cap, uint16_t w, uint16_t h)
+{
+    CAM_RecStats_t st;
+    CAM_RecFrame_t info;
+    uint32_t released = Released;
+    uint32_t raw = 0U;
+    int ok;
+
+    Width[seq] = w;
+    Height[seq] = h;
+    Gen(seq, w, h, Frame);
+    Tick = seq * TEST_PERIOD_MS;
+
+    if (!CAM_Rec_Capture((const uint8_t*)Frame, w, h, seq, Release) ||
+        (Released != released + 1U))
+    {
+        return 0;
+    }
+    CAM_Rec_Task();
+
+    CAM_Rec_GetStats(&st);
+    if ((st.frames == 0U) || (st.newest_seq != seq) || (st.oldest_seq > seq) ||
+        (st.frames != seq - st.oldest_seq + 1U) || (st.frames > CAM_REC_MAX_FRAMES) ||
+        (st.bytes > cap) || (st.bytes > st.raw_bytes) ||
+        (st.span_ms != (seq - st.oldest_seq) * TEST_PERIOD_MS))
+    {
+        return 0;
+    }
+    for (uint32_t s = st.oldest_seq; s <= seq; s++)
+    {
+        raw += (uint32_t)Width[s] * Height[s] * 2U;
+    }
+    if (raw != st.raw_bytes)
+    {
+        return 0;
+    }
+
+    /* The oldest frame, the first one a new payload would overwrite */
+    CAM_Rec_Freeze();
+    CAM_Rec_Seek(-(int32_t)TEST_MAX_SEQ);
+    ok = Same(CAM_Rec_ReplayFrame(&info), &info, st.oldest_seq);
+    CAM_Rec_Live();
+    return ok;
+}
+
+/* Freezes, replays every way, back to live */
+static int Replay(void)
+{
+    CAM_RecStats_t st;
+    CAM_RecFrame_t info;
+    const uint8_t *p;
+    uint32_t start;
+    uint32_t last;
+    int ok = 1;
+
+    CAM_Rec_Freeze();
+    CAM_Rec_GetStats(&st);
+    if (!CAM_Rec_isFrozen())
+    {
+        return 0;
+    }
+
+    /* Newest first, then not again until the cursor moves */
+    p = CAM_Rec_ReplayFrame(&info);
+    ok &= Same(p, &info, st.oldest_seq) && (info.pos == st.frames - 1U) &&
+            (info.count == st.frames);
+    CAM_Rec_Seek(0);
+    ok &= (CAM_Rec_ReplayFrame(&info) == NULL);
+
+    /* Forwards from the oldest, backwards from the newest */
+    CAM_Rec_Seek(-(int32_t)TEST_MAX_SEQ);
+    p = CAM_Rec_ReplayFrame(&info);
+    ok &= (st.frames == 1U) ? (p == NULL) : (Same(p, &info, st.oldest_seq) && (info.pos == 0U));
+    for (uint32_t pos = 1U; pos < st.frames; pos++)
+    {
+        CAM_Rec_Seek(1);
+        p = CAM_Rec_ReplayFrame(&info);
+        ok &= Same(p, &info, st.oldest_seq) && (info.pos == pos);
+    }
+    for (uint32_t pos = st.frames - 1U; pos-- > 0U;)
+    {
+        CAM_Rec_Seek(-1);
+        p = CAM_Rec_ReplayFrame(&info);
+        ok &= Same(p, &info, st.oldest_seq) && (info.pos == pos);
+    }
+    for (uint32_t k = 0U; k < TEST_SEEKS; k++)
+    {
+        CAM_Rec_Seek((int32_t)(Rand() % 41U) - 20);
+        p = CAM_Rec_ReplayFrame(&info);
+        if (p != NULL)
+        {
+            ok &= Same(p, &info, st.oldest_seq);
+        }
+    }
+
+    /* Playback from the oldest: the latest frame due at every call */
+    CAM_Rec_Seek(-(int32_t)TEST_MAX_SEQ);
+    (void)CAM_Rec_ReplayFrame(&info);
+    start = Tick;
+    last = st.oldest_seq;
+    CAM_Rec_Play();
+    for (uint32_t k = 0U; k < st.frames * 5U; k++)
+    {
+        uint32_t due = st.oldest_seq * TEST_PERIOD_MS + (Tick - start);
+
+        p = CAM_Rec_ReplayFrame(&info);
+        if (p != NULL)
+        {
+            ok &= Same(p, &info, st.oldest_seq) && (info.seq > last);
+            last = info.seq;
+        }
+        ok &= (last * TEST_PERIOD_MS <= due) &&
+                ((last == st.newest_seq) || ((last + 1U) * TEST_PERIOD_MS > due));
+        Tick += 10U;
+    }
+    ok &= (last == st.newest_seq);
+
+    CAM_Rec_Live();
+    return ok && !CAM_Rec_isFrozen();
+}
+
+/* One recording of frames frames, replayed in the middle and at the end */
+static int Session(CAM_RecMode_t mode, uint8_t key_interval, uint32_t cap, uint32_t frames,
+        uint8_t mixed, uint8_t tiny)
+{
+    CAM_RecStats_t before;
+    CAM_RecStats_t st;
+    int ok = 1;
+
+    CAM_Rec_GetStats(&before);
+    CAM_Rec_Config(mode, cap, key_interval);
+    CAM_Rec_Enable(1U);
+    for (uint32_t seq = 1U; seq <= frames; seq++)
+    {
+        uint32_t size = (seq / 5U) % (sizeof(Sizes) / sizeof(Sizes[0]));
+
+        if (tiny)
+        {
+            ok &= Record(seq, cap, 4U, 2U);
+        }
+        else if (mixed)
+        {
+            ok &= Record(seq, cap, Sizes[size][0], Sizes[size][1]);
+        }
+        else
+        {
+            ok &= Record(seq, cap, TEST_WIDTH, TEST_HEIGHT);
+        }
+        if (seq == frames / 2U)
+        {
+            ok &= Replay();
+        }
+    }
+    ok &= Replay();
+
+    CAM_Rec_GetStats(&st);
+    st.recorded -= before.recorded;
+    st.keys -= before.keys;
+    ok &= (st.recorded == frames) && (st.errors == before.errors) &&
+            (st.skipped == before.skipped);
+    if (mode == CAM_REC_DELTA)
+    {
+        ok &= (st.keys * key_interval >= frames);
+        /* Room for one raw QVGA frame: each one evicts the last, all keys */
+        ok &= ((key_interval == 1U) || ((cap <= TEST_RAW_BYTES) && !mixed)) ?
+                (st.keys == frames) : (st.keys < frames);
+    }
+    else
+    {
+        ok &= (st.keys == frames);
+    }
+    if (mode == CAM_REC_RAW)
+    {
+        ok &= (st.bytes == st.raw_bytes);
+    }
+    else if (!tiny)
+    {
+        ok &= (st.bytes < st.raw_bytes);
+    }
+    if (tiny)
+    {
+        /* Full index, less the deltas evicted with their key frame */
+        ok &= (st.frames + ((mode == CAM_REC_DELTA) ? key_interval : 1U) > CAM_REC_MAX_FRAMES);
+    }
+    else if (cap < CAM_REC_POOL_BYTES)
+    {
+        /* The ring must have wrapped */
+        ok &= (st.oldest_seq > 1U);
+    }
+    return ok;
+}
+
+/* Raw payloads ending one word before the cap and wrapped gaps one word
+ * short of the next frame: whether it fits is decided to the byte */
+static int Fit(void)
+{
+    CAM_RecStats_t st;
+    uint32_t seq = 1U;
+    int ok = 1;
+
+    /* 40 QVGA frames, then one of the rest of the pool and a word more */
+    CAM_Rec_Config(CAM_REC_RAW, CAM_REC_POOL_BYTES, 1U);
+    CAM_Rec_Enable(1U);
+    for (; seq <= CAM_REC_POOL_BYTES / TEST_RAW_BYTES; seq++)
+    {
+        ok &= Record(seq, CAM_REC_POOL_BYTES, TEST_WIDTH, TEST_HEIGHT);
+    }
+    ok &= (TEST_FIT_WIDTH * TEST_FIT_HEIGHT * 2U ==
+            CAM_REC_POOL_BYTES % TEST_RAW_BYTES + 4U);
+    ok &= Record(seq++, CAM_REC_POOL_BYTES, TEST_FIT_WIDTH, TEST_FIT_HEIGHT);
+    CAM_Rec_GetStats(&st);
+    ok &= (st.oldest_seq == 2U);
+    ok &= Record(seq++, CAM_REC_POOL_BYTES, TEST_WIDTH, TEST_HEIGHT);
+
+    /* Two QVGA frames, one a word smaller wraps before the second: a gap
+     * of 4 bytes, too small for the next 8 */
+    CAM_Rec_Config(CAM_REC_RAW, TEST_RAW_BYTES * 5U / 2U, 1U);
+    seq = 1U;
+    ok &= Record(seq++, TEST_RAW_BYTES * 5U / 2U, TEST_WIDTH, TEST_HEIGHT);
+    ok &= Record(seq++, TEST_RAW_BYTES * 5U / 2U, TEST_WIDTH, TEST_HEIGHT);
+    ok &= (TEST_SHORT_WIDTH * TEST_SHORT_HEIGHT * 2U == TEST_RAW_BYTES - 4U);
+    ok &= Record(seq++, TEST_RAW_BYTES * 5U / 2U, TEST_SHORT_WIDTH, TEST_SHORT_HEIGHT);
+    ok &= Record(seq++, TEST_RAW_BYTES * 5U / 2U, 2U, 2U);
+    ok &= Record(seq++, TEST_RAW_BYTES * 5U / 2U, TEST_WIDTH, TEST_HEIGHT);
+    ok &= Replay();
+    return ok;
+}
+
+/* Capture protocol: refusals, busy and failing MDMA, Freeze while copying */
+static int Protocol(void)
+{
+    CAM_RecStats_t before;
+    CAM_RecStats_t st;
+    uint32_t released;
+    int ok = 1;
+
+    CAM_Rec_Config(CAM_REC_DELTA, CAM_REC_POOL_BYTES, 4U);
+    CAM_Rec_Enable(0U);
+    Gen(1U, TEST_WIDTH, TEST_HEIGHT, Frame);
+    Width[1] = TEST_WIDTH;
+    Height[1] = TEST_HEIGHT;
+    Tick = TEST_PERIOD_MS;
+    CAM_Rec_GetStats(&before);
+    released = Released;
+
+    /* Disabled, then refused before any copy */
+    ok &= !CAM_Rec_Capture((const uint8_t*)Frame, TEST_WIDTH, TEST_HEIGHT, 1U, Release);
+    CAM_Rec_Enable(1U);
+    ok &= !CAM_Rec_Capture((const uint8_t*)Frame, 3U, 2U, 1U, Release);
+    ok &= !CAM_Rec_Capture((const uint8_t*)Frame, TEST_WIDTH, TEST_HEIGHT + 1U, 1U, Release);
+    ok &= !CAM_Rec_Capture(NULL, TEST_WIDTH, TEST_HEIGHT, 1U, Release);
+    CAM_Rec_Config(CAM_REC_DELTA, TEST_RAW_BYTES / 2U, 4U);
+    ok &= !CAM_Rec_Capture((const uint8_t*)Frame, TEST_WIDTH, TEST_HEIGHT, 1U, Release);
+    CAM_Rec_GetStats(&st);
+    ok &= (st.errors == before.errors + 3U) && (Released == released);
+
+    /* MDMA busy: skipped, nothing pending */
+    CAM_Rec_Config(CAM_REC_DELTA, CAM_REC_POOL_BYTES, 4U);
+    Mdma = MDMA_BUSY;
+    ok &= !CAM_Rec_Capture((const uint8_t*)Frame, TEST_WIDTH, TEST_HEIGHT, 1U, Release);
+    CAM_Rec_GetStats(&st);
+    ok &= (st.skipped == before.skipped + 1U) && (Released == released);
+
+    /* Copy failing: released, counted, nothing stored */
+    Mdma = MDMA_FAIL;
+    ok &= CAM_Rec_Capture((const uint8_t*)Frame, TEST_WIDTH, TEST_HEIGHT, 1U, Release);
+    CAM_Rec_Task();
+    CAM_Rec_GetStats(&st);
+    ok &= (st.errors == before.errors + 4U) && (Released == released + 1U) && (st.frames == 0U);
+
+    /* Staged and not stored yet: the next frame is skipped */
+    Mdma = MDMA_DONE;
+    ok &= CAM_Rec_Capture((const uint8_t*)Frame, TEST_WIDTH, TEST_HEIGHT, 1U, Release);
+    ok &= !CAM_Rec_Capture((const uint8_t*)Frame, TEST_WIDTH, TEST_HEIGHT, 2U, Release);
+    CAM_Rec_Task();
+    CAM_Rec_GetStats(&st);
+    ok &= (st.skipped == before.skipped + 2U) && (Released == released + 2U) &&
+            (st.frames == 1U) && (st.newest_seq == 1U);
+
+    /* Frozen while the copy runs: Freeze waits for it and keeps it */
+    Mdma = MDMA_LATER;
+    Gen(2U, TEST_WIDTH, TEST_HEIGHT, Frame);
+    Width[2] = TEST_WIDTH;
+    Height[2] = TEST_HEIGHT;
+    Tick = 2U * TEST_PERIOD_MS;
+    ok &= CAM_Rec_Capture((const uint8_t*)Frame, TEST_WIDTH, TEST_HEIGHT, 2U, Release);
+    ok &= (Released == released + 2U);
+    CAM_Rec_Freeze();
+    CAM_Rec_GetStats(&st);
+    ok &= (Released == released + 3U) && (st.frames == 2U) && (st.newest_seq == 2U);
+    Mdma = MDMA_DONE;
+    ok &= !CAM_Rec_Capture((const uint8_t*)Frame, TEST_WIDTH, TEST_HEIGHT, 3U, Release);
+    ok &= (Released == released + 3U);
+    CAM_Rec_Live();
+    ok &= Replay();
+    return ok;
+}
+
+int main(void)
+{
+    static const uint32_t Caps[] =
+    {
+        TEST_RAW_BYTES, TEST_RAW_BYTES * 7U / 2U, 1024U * 1024U, CAM_REC_POOL_BYTES
+    };
+    static const char *const Modes[] = { "raw", "rle", "delta" };
+    static const uint8_t Intervals[] = { 1U, 4U, 16U };
+    int fail = 0;
+    int ok;
+
+    CAM_Rec_Init();
+    if (CAM_Rec_isEnabled())
+    {
+        printf("enabled after the init\n");
+        fail = 1;
+    }
+
+    for (uint32_t mode = CAM_REC_RAW; mode <= CAM_REC_DELTA; mode++)
+    {
+        for (uint32_t k = 0U; k < sizeof(Intervals); k++)
+        {
+            if ((mode != CAM_REC_DELTA) && (k > 0U))
+            {
+                break;
+            }
+            for (uint32_t c = 0U; c < sizeof(Caps) / sizeof(Caps[0]); c++)
+            {
+                for (uint8_t mixed = 0U; mixed < 2U; mixed++)
+                {
+                    ok = Session((CAM_RecMode_t)mode, Intervals[k], Caps[c], TEST_FRAMES,
+                            mixed, 0U);
+                    printf("%-5s key %2u cap %7u %-5s %s\n", Modes[mode], Intervals[k],
+                            Caps[c], mixed ? "mixed" : "qvga", ok ? "ok" : "MISMATCH");
+                    fail |= !ok;
+                }
+            }
+        }
+        ok = Session((CAM_RecMode_t)mode, 4U, CAM_REC_POOL_BYTES, TEST_TINY_FRAMES, 0U, 1U);
+        printf("%-5s %u tiny frames %s\n", Modes[mode], TEST_TINY_FRAMES, ok ? "ok" : "MISMATCH");
+        fail |= !ok;
+    }
+
+    ok = Fit();
+    printf("exact fits %s\n", ok ? "ok" : "MISMATCH");
+    fail |= !ok;
+
+    ok = Protocol();
+    printf("capture protocol %s\n", ok ? "ok" : "MISMATCH");
+    fail |= !ok;
+
+    printf(fail ? "FAIL\n" : "all ok\n");
+    return fail;
+}
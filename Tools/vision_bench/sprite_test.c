@@ -0,0 +1,651 @@
+/*
+ * sprite_test.c
+ * Host test of the sprites (User/GUI/GUI_Sprite.c)
+ *
+ * A model keeps what every sprite should look like (place, depth, stacking
+ * order, frame, opacity, animation) from the calls made, and after every
+ * render the whole surface is compared with a composite of the model drawn
+ * from scratch over the background, bottom up, from the source images of
+ * the sheets. Any ordering fault of the save-under shows: a background put
+ * back in the wrong order, a sprite above a change not redrawn, a stale
+ * save. The DMA2D is emulated with the CPU blend (5 bit alpha), the result
+ * the fallback promises, and refuses the jobs in turns of 100 operations.
+ *
+ * Covered:
+ *  - sheets: RGB565 with a color key and a padded stride, ARGB8888 with
+ *    every alpha, opaque RGB565, RGB888 converted; frames smaller than
+ *    GUI_SPRITE_DMA2D_MIN_PIXELS too
+ *  - 3000 random operations on 12 sprites, a render after most of them:
+ *    moves (short, and across the surface edges), show and hide, depth
+ *    changes (on top of the same depth), opacity, frames, looping and
+ *    one-shot animations, remove and create again, the background redrawn
+ *    then GUI_Sprite_Invalidate()
+ *  - a chain of three overlapping sprites where the one raised uncovers
+ *    the second, and the third over the second must come off first; a
+ *    sprite moved clear of the others redrawn alone, nothing left to do
+ *  - the surface stride wider than its width, the padding left as it is
+ *  - every sprite removed: the background back, pixel for pixel
+ *  - GUI_SPRITE_MAX sprites and no more; a sheet that can't be converted
+ *    gives its pool space back.
+ *
+ * Build (from the repository root):
+ *   gcc -O2 -ITools/vision_bench/host -IUser/GUI -IUser/Fonts -IUser/Vision -IBSP \
+ *       -o sprite_test Tools/vision_bench/sprite_test.c User/GUI/GUI_Sprite.c \
+ *       User/Vision/vision_color.c User/Vision/vision_luma.c
+ * With -fsanitize=address,undefined -g to catch accesses out of the pool.
+ */
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include "main.h"
+#include "BSP_DMA2D.h"
+#include "GUI_Sprite.h"
+#include "GUI_Text.h"
+#include "vision_color.h"
+
+#define TEST_WIDTH                    (800U)
+#define TEST_HEIGHT                   (480U)
+#define TEST_STRIDE                   (816U)
+#define TEST_SPRITES                  (12U)
+#define TEST_OPS                      (3000U)
+#define TEST_DMA_TURN                 (100U)
+#define TEST_KEY                      (0xF81FU)
+
+/* Source images of the sheets */
+#define KEYED_WIDTH                   (64U)
+#define KEYED_HEIGHT                  (96U)
+#define KEYED_STRIDE                  (70U)          /* pixels */
+#define ARGB_SIZE                     (96U)
+#define OPAQUE_WIDTH                  (120U)
+#define OPAQUE_HEIGHT                 (30U)
+#define RGB888_SIZE                   (20U)
+#define SHEETS                        (4U)
+
+typedef struct
+{
+    int16_t     x;
+    int16_t     y;
+    int16_t     z;
+    uint32_t    order;            /* stacking among the same z */
+    uint16_t    frame;
+    uint8_t     alpha;
+    uint8_t     visible;
+    uint16_t    anim_first;
+    uint16_t    anim_count;
+    uint16_t    anim_period;
+    uint8_t     anim_loop;
+    uint32_t    anim_start;
+    uint8_t     sheet;
+    uint8_t     live;
+} Model_t;
+
+uint32_t SystemCoreClock = 480000000U;
+
+static uint32_t Tick;
+static uint8_t Dma = 1U;
+static uint32_t Blends;
+static uint32_t Seed = 12345U;
+
+static uint16_t Screen[TEST_STRIDE * TEST_HEIGHT];
+static uint16_t Back[TEST_STRIDE * TEST_HEIGHT];
+static uint16_t Expect[TEST_STRIDE * TEST_HEIGHT];
+static const GUI_Text_Surface_t Surface = { Screen, TEST_STRIDE, TEST_WIDTH, TEST_HEIGHT };
+
+static uint16_t Keyed[KEYED_STRIDE * KEYED_HEIGHT];
+static uint32_t Argb[ARGB_SIZE * ARGB_SIZE];
+static uint16_t Opaque[OPAQUE_WIDTH * OPAQUE_HEIGHT];
+static uint8_t Rgb888[RGB888_SIZE * RGB888_SIZE * 3U];
+static uint16_t Rgb888As565[RGB888_SIZE * RGB888_SIZE];
+
+static GUI_Sprite_Sheet_t Sheet[SHEETS];
+static GUI_Sprite_t Sprites[GUI_SPRITE_MAX];
+static Model_t Model[TEST_SPRITES];
+static uint32_t Stamp;
+
+/******************************************************************************
+ *                               EMULATION                                    *
+ ******************************************************************************/
+
+uint32_t HAL_GetTick(void)
+{
+    return Tick;
+}
+
+const GUI_Text_Surface_t* GUI_Text_GetSurface(void)
+{
+    return &Surface;
+}
+
+/* RGB565 copy */
+HAL_StatusTypeDef BSP_DMA2D_Convert(const BSP_DMA2D_Pfc_t *pfc)
+{
+    if (!Dma)
+    {
+        return HAL_BUSY;
+    }
+    if ((pfc->in_mode != DMA2D_INPUT_RGB565) || (pfc->out_mode != DMA2D_OUTPUT_RGB565) ||
+        pfc->swap)
+    {
+        return HAL_ERROR;
+    }
+    for (uint32_t y = 0U; y < pfc->lines; y++)
+    {
+        memcpy((uint8_t*)pfc->dst + y * pfc->dst_stride,
+                (const uint8_t*)pfc->src + y * pfc->src_stride, pfc->width * 2U);
+    }
+    return HAL_OK;
+}
+
+/* ARGB8888 or RGB565 with a constant alpha over RGB565, in place */
+HAL_StatusTypeDef BSP_DMA2D_Blend(const BSP_DMA2D_Blend_t *blend)
+{
+    uint8_t argb = (blend->src_mode == DMA2D_INPUT_ARGB8888) ? 1U : 0U;
+
+    if (!Dma)
+    {
+        return HAL_BUSY;
+    }
+    if ((!argb && (blend->src_mode != DMA2D_INPUT_RGB565)) ||
+        (blend->bg_mode != DMA2D_INPUT_RGB565) || (blend->out_mode != DMA2D_OUTPUT_RGB565) ||
+        (blend->bg != blend->dst) || (blend->bg_stride != blend->dst_stride))
+    {
+        return HAL_ERROR;
+    }
+    Blends++;
+    for (uint32_t y = 0U; y < blend->lines; y++)
+    {
+        const uint8_t *src = (const uint8_t*)blend->src + y * blend->src_stride;
+        uint16_t *dst = (uint16_t*)((uint8_t*)blend->dst + y * blend->dst_stride);
+
+        for (uint32_t x = 0U; x < blend->width; x++)
+        {
+            uint32_t c, a;
+
+            if (argb)
+            {
+                uint32_t v;
+
+                memcpy(&v, src + x * 4U, 4U);
+                a = ((v >> 24) * blend->alpha + 127U) / 255U;
+                c = ((v >> 8) & 0xF800U) | ((v >> 5) & 0x07E0U) | ((v >> 3) & 0x001FU);
+            }
+            else
+            {
+                a = blend->alpha;
+                c = (uint32_t)src[x * 2U] | ((uint32_t)src[x * 2U + 1U] << 8);
+            }
+            if ((a >> 3) != 0U)
+            {
+                dst[x] = BSP_DMA2D_Blend565(c, dst[x], a >> 3);
+            }
+        }
+    }
+    return HAL_OK;
+}
+
+/******************************************************************************
+ *                                 MODEL                                      *
+ ******************************************************************************/
+
+static uint32_t Rand(void)
+{
+    Seed = Seed * 1664525U + 1013904223U;
+    return Seed >> 8;
+}
+
+/* Pixel (x, y) of a source image: RGB565 and its alpha (0 to 255), opaque
+ * set for the sheets stored as RGB565 */
+static void Source(uint32_t sheet, uint32_t x, uint32_t y, uint32_t *c, uint32_t *a,
+        uint8_t *opaque)
+{
+    uint32_t v;
+
+    *a = 255U;
+    *opaque = 1U;
+    switch (sheet)
+    {
+        case 0U:
+            *c = Keyed[y * KEYED_STRIDE + x];
+            *a = (*c == TEST_KEY) ? 0U : 255U;
+            *opaque = 0U;
+            break;
+        case 1U:
+            v = Argb[y * ARGB_SIZE + x];
+            *c = ((v >> 8) & 0xF800U) | ((v >> 5) & 0x07E0U) | ((v >> 3) & 0x001FU);
+            *a = v >> 24;
+            *opaque = 0U;
+            break;
+        case 2U:
+            *c = Opaque[y * OPAQUE_WIDTH + x];
+            break;
+        default:
+            *c = Rgb888As565[y * RGB888_SIZE + x];
+            break;
+    }
+}
+
+/* The frame a sprite shows now */
+static uint16_t Frame(const Model_t *m)
+{
+    uint32_t step;
+
+    if (m->anim_count == 0U)
+    {
+        return m->frame;
+    }
+    step = (Tick - m->anim_start) / m->anim_period;
+    step = m->anim_loop ? (step % m->anim_count) :
+            ((step < m->anim_count) ? step : (m->anim_count - 1U));
+    return (uint16_t)(m->anim_first + step);
+}
+
+/* Background, then the visible sprites by z and stacking order */
+static void Composite(void)
+{
+    uint32_t idx[TEST_SPRITES];
+    uint32_t n = 0U;
+
+    memcpy(Expect, Back, sizeof(Expect));
+    for (uint32_t i = 0U; i < TEST_SPRITES; i++)
+    {
+        uint32_t j = n++;
+
+        if (!Model[i].live)
+        {
+            n--;
+            continue;
+        }
+        for (; (j > 0U) && ((Model[idx[j - 1U]].z > Model[i].z) ||
+                ((Model[idx[j - 1U]].z == Model[i].z) &&
+                 (Model[idx[j - 1U]].order > Model[i].order))); j--)
+        {
+            idx[j] = idx[j - 1U];
+        }
+        idx[j] = i;
+    }
+
+    for (uint32_t k = 0U; k < n; k++)
+    {
+        const Model_t *m = &Model[idx[k]];
+        const GUI_Sprite_Sheet_t *sh = &Sheet[m->sheet];
+        uint16_t frame = Frame(m);
+
+        if (!m->visible)
+        {
+            continue;
+        }
+        for (int32_t y = 0; y < sh->frame_height; y++)
+        {
+            for (int32_t x = 0; x < sh->frame_width; x++)
+            {
+                int32_t sx = m->x + x, sy = m->y + y;
+                uint32_t c, a;
+                uint8_t opaque;
+                uint16_t *d;
+
+                if ((sx < 0) || (sy < 0) || (sx >= (int32_t)TEST_WIDTH) ||
+                    (sy >= (int32_t)TEST_HEIGHT))
+                {
+                    continue;
+                }
+                Source(m->sheet, (frame % sh->columns) * sh->frame_width + (uint32_t)x,
+                        (frame / sh->columns) * sh->frame_height + (uint32_t)y, &c, &a, &opaque);
+                d = &Expect[(uint32_t)sy * TEST_STRIDE + (uint32_t)sx];
+                if (opaque && (m->alpha == 0xFFU))
+                {
+                    *d = (uint16_t)c;
+                    continue;
+                }
+                a = opaque ? m->alpha : ((a * m->alpha + 127U) / 255U);
+                if ((a >> 3) != 0U)
+                {
+                    *d = BSP_DMA2D_Blend565(c, *d, a >> 3);
+                }
+            }
+        }
+    }
+}
+
+static void Background(uint16_t *p)
+{
+    for (uint32_t i = 0U; i < TEST_STRIDE * TEST_HEIGHT; i++)
+    {
+        p[i] = (uint16_t)Rand();
+    }
+}
+
+/******************************************************************************
+ *                                 CHECKS                                     *
+ ******************************************************************************/
+
+static int Sheets(void)
+{
+    int ok = 1;
+
+    for (uint32_t y = 0U; y < KEYED_HEIGHT; y++)
+    {
+        for (uint32_t x = 0U; x < KEYED_STRIDE; x++)
+        {
+            int32_t dx = (int32_t)(x % 32U) - 16, dy = (int32_t)(y % 32U) - 16;
+
+            /* Discs growing frame to frame, the rest keyed out */
+            Keyed[y * KEYED_STRIDE + x] = ((dx * dx + dy * dy) < (int32_t)(60U + y * 2U)) ?
+                    (uint16_t)(Rand() & ~0x0020U) : TEST_KEY;
+        }
+    }
+    for (uint32_t i = 0U; i < ARGB_SIZE * ARGB_SIZE; i++)
+    {
+        uint32_t a = ((i % 7U) == 0U) ? 0U : ((i % 5U) == 0U) ? 255U : (Rand() & 0xFFU);
+
+        Argb[i] = (Rand() & 0x00FFFFFFU) | (a << 24);
+    }
+    for (uint32_t i = 0U; i < OPAQUE_WIDTH * OPAQUE_HEIGHT; i++)
+    {
+        Opaque[i] = (uint16_t)Rand();
+    }
+    for (uint32_t i = 0U; i < sizeof(Rgb888); i++)
+    {
+        Rgb888[i] = (uint8_t)Rand();
+    }
+    (void)VISION_Color_ConvertRef(Rgb888, VISION_COLOR_RGB888, RGB888_SIZE * 3U, Rgb888As565,
+            VISION_COLOR_RGB565, RGB888_SIZE * 2U, RGB888_SIZE, RGB888_SIZE);
+
+    ok &= GUI_Sprite_LoadSheet(&Sheet[0], Keyed, VISION_COLOR_RGB565, KEYED_STRIDE * 2U,
+            KEYED_WIDTH, KEYED_HEIGHT, 32U, 32U, TEST_KEY);
+    ok &= GUI_Sprite_LoadSheet(&Sheet[1], Argb, VISION_COLOR_ARGB8888, ARGB_SIZE * 4U,
+            ARGB_SIZE, ARGB_SIZE, 48U, 48U, GUI_SPRITE_NO_KEY);
+    ok &= GUI_Sprite_LoadSheet(&Sheet[2], Opaque, VISION_COLOR_RGB565, OPAQUE_WIDTH * 2U,
+            OPAQUE_WIDTH, OPAQUE_HEIGHT, 40U, 30U, GUI_SPRITE_NO_KEY);
+    ok &= GUI_Sprite_LoadSheet(&Sheet[3], Rgb888, VISION_COLOR_RGB888, RGB888_SIZE * 3U,
+            RGB888_SIZE, RGB888_SIZE, 5U, 5U, GUI_SPRITE_NO_KEY);
+    ok &= (Sheet[0].format == GUI_SPRITE_ARGB8888) && (Sheet[0].frames == 6U) &&
+            (Sheet[1].format == GUI_SPRITE_ARGB8888) && (Sheet[1].frames == 4U) &&
+            (Sheet[2].format == GUI_SPRITE_RGB565) && (Sheet[2].frames == 3U) &&
+            (Sheet[3].format == GUI_SPRITE_RGB565) && (Sheet[3].frames == 16U);
+    return ok;
+}
+
+static int Create(uint32_t i, uint8_t sheet)
+{
+    Model_t *m = &Model[i];
+
+    memset(m, 0, sizeof(*m));
+    m->x = (int16_t)((int32_t)(Rand() % 900U) - 50);
+    m->y = (int16_t)((int32_t)(Rand() % 560U) - 40);
+    m->z = (int16_t)(Rand() % 5U);
+    m->order = ++Stamp;
+    m->alpha = 0xFFU;
+    m->visible = 1U;
+    m->sheet = sheet;
+    m->live = 1U;
+    return GUI_Sprite_Create(&Sprites[i], &Sheet[sheet], m->x, m->y, m->z);
+}
+
+/* One random change to sprite i, to the module and to the model */
+static int Operate(uint32_t i)
+{
+    GUI_Sprite_t *sp = &Sprites[i];
+    Model_t *m = &Model[i];
+    uint16_t frames = Sheet[m->sheet].frames;
+    int ok = 1;
+
+    switch (Rand() % 12U)
+    {
+        case 0U:
+        case 1U:
+        case 2U:
+            m->x = (int16_t)(m->x + (int16_t)(Rand() % 41U) - 20);
+            m->y = (int16_t)(m->y + (int16_t)(Rand() % 41U) - 20);
+            m->x = ((m->x < -100) || (m->x > 900)) ? 100 : m->x;
+            m->y = ((m->y < -100) || (m->y > 580)) ? 100 : m->y;
+            GUI_Sprite_Move(sp, m->x, m->y);
+            break;
+        case 3U:
+            m->x = (int16_t)((int32_t)(Rand() % 900U) - 50);
+            m->y = (int16_t)((int32_t)(Rand() % 560U) - 40);
+            GUI_Sprite_Move(sp, m->x, m->y);
+            break;
+        case 4U:
+            m->visible = ((Rand() & 3U) != 0U) ? 1U : 0U;
+            GUI_Sprite_Show(sp, m->visible ? (uint8_t)(1U + (Rand() & 7U)) : 0U);
+            break;
+        case 5U:
+        {
+            int16_t z = (int16_t)(Rand() % 5U);
+
+            /* On top of its depth only when the depth changes */
+            if (z != m->z)
+            {
+                m->z = z;
+                m->order = ++Stamp;
+            }
+            GUI_Sprite_SetZ(sp, z);
+            break;
+        }
+        case 6U:
+            m->alpha = ((Rand() & 1U) != 0U) ? 0xFFU : (uint8_t)Rand();
+            GUI_Sprite_SetAlpha(sp, m->alpha);
+            break;
+        case 7U:
+        {
+            uint16_t frame = (uint16_t)(Rand() % 20U);
+
+            m->anim_count = 0U;
+            m->frame = (frame < frames) ? frame : (uint16_t)(frames - 1U);
+            GUI_Sprite_SetFrame(sp, frame);
+            break;
+        }
+        case 8U:
+        {
+            uint16_t first = (uint16_t)(Rand() % 8U);
+            uint16_t count = (uint16_t)(Rand() % 8U);
+            uint16_t period = (uint16_t)(Rand() % 40U);
+
+            m->anim_first = (first < frames) ? first : (uint16_t)(frames - 1U);
+            m->anim_count = (count > (frames - m->anim_first)) ?
+                    (uint16_t)(frames - m->anim_first) : count;
+            m->anim_period = (period != 0U) ? period : 1U;
+            m->anim_loop = (uint8_t)(Rand() & 1U);
+            m->anim_start = Tick;
+            m->frame = m->anim_first;
+            GUI_Sprite_Animate(sp, first, count, period, m->anim_loop);
+            break;
+        }
+        case 9U:
+            /* Removed at once, created again at the next render; rarely, the
+             * new save-under takes pool space for good */
+            if ((Rand() % 4U) != 0U)
+            {
+                break;
+            }
+            GUI_Sprite_Remove(sp);
+            m->live = 0U;
+            Composite();
+            ok &= !memcmp(Screen, Expect, sizeof(Screen));
+            ok &= Create(i, (uint8_t)(Rand() % SHEETS));
+            break;
+        case 10U:
+            if ((Rand() % 16U) == 0U)
+            {
+                /* Surface redrawn under the sprites */
+                Background(Back);
+                memcpy(Screen, Back, sizeof(Screen));
+                GUI_Sprite_Invalidate();
+            }
+            break;
+        default:
+            break;
+    }
+    return ok;
+}
+
+static int Random(void)
+{
+    const GUI_Sprite_Stats_t *st = GUI_Sprite_GetStats();
+    uint32_t renders = 0U;
+    int ok = 1;
+
+    for (uint32_t i = 0U; i < TEST_SPRITES; i++)
+    {
+        ok &= Create(i, (uint8_t)(i % SHEETS));
+    }
+    GUI_Sprite_Animate(&Sprites[0], 1U, 5U, 30U, 1U);
+    Model[0].anim_first = 1U;
+    Model[0].anim_count = 5U;
+    Model[0].anim_period = 30U;
+    Model[0].anim_loop = 1U;
+    Model[0].frame = 1U;
+
+    for (uint32_t k = 0U; (k < TEST_OPS) && ok; k++)
+    {
+        Dma = (uint8_t)(((k / TEST_DMA_TURN) & 1U) ^ 1U);
+        ok &= Operate(Rand() % TEST_SPRITES);
+        Tick += 7U;
+        /* Some changes are batched */
+        if ((Rand() % 3U) == 0U)
+        {
+            continue;
+        }
+        (void)GUI_Sprite_Render();
+        renders++;
+        Composite();
+        if (memcmp(Screen, Expect, sizeof(Screen)))
+        {
+            printf("operation %u: the surface differs\n", k);
+            ok = 0;
+        }
+    }
+
+    /* Every sprite removed, the background back */
+    for (uint32_t i = 0U; i < TEST_SPRITES; i++)
+    {
+        GUI_Sprite_Remove(&Sprites[i]);
+        Model[i].live = 0U;
+    }
+    ok &= !memcmp(Screen, Back, sizeof(Screen));
+    ok &= (GUI_Sprite_Render() == 0U);
+    printf("%u renders, %u drawn, %u restored, %u DMA2D jobs, %u CPU jobs, %u pool bytes\n",
+            renders, st->drawn, st->restored, st->dma2d_jobs, st->cpu_jobs, st->pool_bytes);
+    ok &= (st->dma2d_jobs != 0U) && (st->cpu_jobs != 0U) && (Blends != 0U);
+    return ok;
+}
+
+/* Three opaque sprites in a row, each overlapping the next: raising the
+ * first over the others takes the second off, and the third that covers
+ * the second has to go first. Then only what changed is touched. */
+static int Chain(void)
+{
+    static const int16_t X[3] = { 100, 130, 160 };
+    const GUI_Sprite_Stats_t *st = GUI_Sprite_GetStats();
+    int ok = 1;
+
+    Dma = 1U;
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        memset(&Model[i], 0, sizeof(Model[i]));
+        Model[i].x = X[i];
+        Model[i].y = 100;
+        Model[i].z = (int16_t)i;
+        Model[i].order = ++Stamp;
+        Model[i].alpha = 0xFFU;
+        Model[i].visible = 1U;
+        Model[i].sheet = 2U;
+        Model[i].live = 1U;
+        ok &= GUI_Sprite_Create(&Sprites[i], &Sheet[2], X[i], 100, (int16_t)i);
+    }
+    ok &= (GUI_Sprite_Render() == 3U);
+    Composite();
+    ok &= !memcmp(Screen, Expect, sizeof(Screen));
+
+    Model[0].z = 3;
+    Model[0].order = ++Stamp;
+    GUI_Sprite_SetZ(&Sprites[0], 3);
+    ok &= (GUI_Sprite_Render() == 3U) && (st->last_restored == 3U);
+    Composite();
+    ok &= !memcmp(Screen, Expect, sizeof(Screen));
+
+    /* Drawn last, so moved out of the way alone; then nothing to do */
+    Model[0].y = 300;
+    GUI_Sprite_Move(&Sprites[0], X[0], 300);
+    ok &= (GUI_Sprite_Render() == 1U) && (st->last_restored == 1U);
+    Model[0].x = 400;
+    GUI_Sprite_Move(&Sprites[0], 400, 300);
+    ok &= (GUI_Sprite_Render() == 1U) && (st->last_restored == 1U);
+    ok &= (GUI_Sprite_Render() == 0U);
+    Composite();
+    ok &= !memcmp(Screen, Expect, sizeof(Screen));
+
+    for (uint32_t i = 0U; i < 3U; i++)
+    {
+        GUI_Sprite_Remove(&Sprites[i]);
+        Model[i].live = 0U;
+    }
+    ok &= !memcmp(Screen, Back, sizeof(Screen));
+    return ok;
+}
+
+/* GUI_SPRITE_MAX sprites; a failed sheet load keeps the pool */
+static int Limits(void)
+{
+    static const uint8_t Odd[3U * 2U * 2U] = { 0U };
+    const GUI_Sprite_Stats_t *st = GUI_Sprite_GetStats();
+    GUI_Sprite_Sheet_t sheet;
+    GUI_Sprite_t extra;
+    uint32_t pool = st->pool_bytes;
+    int ok = 1;
+
+    /* YUV422 of an odd width can't be converted */
+    ok &= !GUI_Sprite_LoadSheet(&sheet, Odd, VISION_COLOR_YUV422, 6U, 3U, 2U, 3U, 2U,
+            GUI_SPRITE_NO_KEY);
+    ok &= (st->pool_bytes == pool);
+    ok &= !GUI_Sprite_LoadSheet(&sheet, Odd, VISION_COLOR_RGB565, 6U, 3U, 2U, 4U, 2U,
+            GUI_SPRITE_NO_KEY);
+    ok &= !GUI_Sprite_LoadSheet(&sheet, Opaque, VISION_COLOR_RGB565, 0U, 1024U, 1024U, 8U, 8U,
+            GUI_SPRITE_NO_KEY);
+    ok &= (st->pool_bytes == pool);
+
+    for (uint32_t i = 0U; i < GUI_SPRITE_MAX; i++)
+    {
+        ok &= GUI_Sprite_Create(&Sprites[i], &Sheet[3], (int16_t)(i * 7U), 10, 0);
+    }
+    ok &= !GUI_Sprite_Create(&extra, &Sheet[3], 0, 0, 0);
+    ok &= (GUI_Sprite_Render() == GUI_SPRITE_MAX);
+    for (uint32_t i = 0U; i < GUI_SPRITE_MAX; i++)
+    {
+        GUI_Sprite_Remove(&Sprites[i]);
+    }
+    ok &= !memcmp(Screen, Back, sizeof(Screen));
+    return ok;
+}
+
+int main(void)
+{
+    int fail = 0;
+    int ok;
+
+    Background(Back);
+    memcpy(Screen, Back, sizeof(Screen));
+    GUI_Sprite_Init();
+
+    ok = Sheets();
+    printf("sheets %s\n", ok ? "ok" : "MISMATCH");
+    fail |= !ok;
+    if (!ok)
+    {
+        printf("FAIL\n");
+        return 1;
+    }
+    ok = Random();
+    printf("%u random operations %s\n", TEST_OPS, ok ? "ok" : "MISMATCH");
+    fail |= !ok;
+    ok = Chain();
+    printf("overlap chain %s\n", ok ? "ok" : "MISMATCH");
+    fail |= !ok;
+    ok = Limits();
+    printf("limits %s\n", ok ? "ok" : "MISMATCH");
+    fail |= !ok;
+
+    printf(fail ? "FAIL\n" : "all ok\n");
+    return fail;
+}
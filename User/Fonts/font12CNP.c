@@ -0,0 +1,64 @@
+/*
+ * font12CNP.c
+ * Packed 16x21 font, 9 glyphs, from Font12CN
+ *
+ * Generated by Tools/font_pack, do not edit
+ */
+
+#include "fonts_pk.h"
+
+static const uint8_t Font12CNP_Data[232] =
+{
+    /* 0x41 'A' */
+    0x01, 0x00, 0x05, 0x0B, 0x0C, 0x8F, 0xDD, 0x75, 0xAC, 0xB8, 0xCB, 0x6D, 0xA7, 0xC2, 0x4D, 0xB2,
+    0xEE, 0xBA, 0xB0,
+    /* 0x61 'a' */
+    0x01, 0x00, 0x08, 0x09, 0x09, 0x55, 0xA4, 0xF4, 0x94, 0xF1, 0x1E, 0x5D, 0x43, 0xC1,
+    /* 0x62 'b' */
+    0x01, 0x01, 0x04, 0x09, 0x0D, 0x0F, 0x3C, 0xF3, 0xDD, 0x42, 0xCB, 0x79, 0xE7, 0x9E, 0x7C, 0xB3,
+    0xD0,
+    /* 0x63 'c' */
+    0x01, 0x00, 0x08, 0x08, 0x09, 0x58, 0xB5, 0xA3, 0xAE, 0xBB, 0x2B, 0x49, 0x60,
+    /* 0xBAC3 */
+    0x01, 0x00, 0x04, 0x10, 0x0F, 0x4B, 0x8C, 0xD7, 0x0C, 0xBE, 0x0F, 0x12, 0x45, 0x9C, 0x68, 0xB6,
+    0xDB, 0x2D, 0xA8, 0xCF, 0x1C, 0x48, 0xAD, 0x8B, 0x3A, 0xB5, 0x6A, 0xE6, 0xA3, 0xEA, 0x2B, 0x60,
+    /* 0xC4E3 */
+    0x00, 0x00, 0x04, 0x10, 0x0F, 0x1D, 0xC0, 0x1D, 0x80, 0x3B, 0xFF, 0x3B, 0x07, 0x3F, 0x77, 0x7E,
+    0x76, 0xF8, 0x70, 0xFB, 0xFE, 0xFB, 0xFE, 0x3F, 0x77, 0x3F, 0x77, 0x3E, 0x73, 0x38, 0x70, 0x38,
+    0x70, 0x3B, 0xE0,
+    /* 0xC5C9 */
+    0x00, 0x00, 0x04, 0x10, 0x0E, 0xE0, 0x1F, 0xFF, 0xF0, 0x3E, 0x00, 0x0E, 0x1F, 0xCF, 0xFB, 0xFF,
+    0xF8, 0x3F, 0xFF, 0x0F, 0xFF, 0x7F, 0xD8, 0x7F, 0xDC, 0x6F, 0xCE, 0xED, 0xFF, 0xFD, 0xF7, 0xF9,
+    0xC0,
+    /* 0xCAF7 */
+    0x00, 0x00, 0x04, 0x10, 0x0F, 0x30, 0x0E, 0x30, 0x0E, 0x3F, 0xEE, 0x30, 0xEE, 0xFC, 0xFF, 0x76,
+    0xCE, 0x77, 0xFE, 0x7B, 0xFE, 0xFF, 0xFE, 0xF3, 0xDE, 0xF3, 0xCE, 0x37, 0xEE, 0x3E, 0x6E, 0x3C,
+    0x0E, 0x30, 0x3E,
+    /* 0xDDAE */
+    0x01, 0x00, 0x04, 0x10, 0x0F, 0xA9, 0x39, 0xC7, 0x09, 0x54, 0xF3, 0xE2, 0xF1, 0xC4, 0xE3, 0x71,
+    0xE3, 0x2D, 0xA8, 0xD3, 0x49, 0x71, 0xC2, 0x2D, 0x34, 0xDB, 0x6C, 0xB7, 0xC7, 0x07, 0x88, 0xF8,
+    0x59, 0x80,
+};
+
+static const uint16_t Font12CNP_Code[9] =
+{
+    0x0041, 0x0061, 0x0062, 0x0063, 0xBAC3, 0xC4E3, 0xC5C9, 0xCAF7, 0xDDAE,
+};
+
+static const uint32_t Font12CNP_Offset[10] =
+{
+         0,     19,     33,     50,     63,     95,    130,    163,    198,    232,
+};
+
+const pFONT Font12CNP =
+{
+    Font12CNP_Data,
+    Font12CNP_Code,
+    Font12CNP_Offset,
+    9,     /* count */
+    16,    /* width */
+    11,    /* ascii_width */
+    21,    /* height */
+    3,     /* run0_bits */
+    3,     /* run1_bits */
+};
@@ -0,0 +1,1638 @@
+/*
+ * font20AA.c
+ * DejaVu Sans Book 20 px, A4, 0x20-0x7E
+ *
+ * Generated by Tools/font_conv, do not edit:
+ *   font_conv -s 20 -b 4 -r 0x20-0x7E -n Font20AA DejaVuSans.ttf
+ */
+
+#include "fonts_aa.h"
+
+static const uint8_t Font20AA_Bitmap[6917] =
+{
+    /* 0x21 '!' 2x15 */
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xEE,
+    0xDD,
+    0xDC,
+    0x00,
+    0x00,
+    0xFF,
+    0xFF,
+    /* 0x22 '"' 8x5 */
+    0xF1, 0x09, 0xF6, 0x04,
+    0xF1, 0x09, 0xF6, 0x04,
+    0xF1, 0x09, 0xF6, 0x04,
+    0xF1, 0x09, 0xF6, 0x04,
+    0xF1, 0x09, 0xF6, 0x04,
+    /* 0x23 '#' 16x15 */
+    0x00, 0x00, 0x00, 0xAE, 0x00, 0xF8, 0x01, 0x00,
+    0x00, 0x00, 0x30, 0x6F, 0x00, 0xCC, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x2F, 0x10, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0x0D, 0x40, 0x4F, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0xF5, 0x04, 0xE0, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x00, 0xF3, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0xBD, 0x00, 0xF7, 0x02, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0x00, 0x80, 0x1F, 0x10, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0xB0, 0x0C, 0x50, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0xF1, 0x08, 0x90, 0x0E, 0x00, 0x00, 0x00,
+    0x00, 0xF4, 0x04, 0xD0, 0x0B, 0x00, 0x00, 0x00,
+    /* 0x24 '$' 12x18 */
+    0x00, 0x00, 0xC3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC3, 0x00, 0x00, 0x00,
+    0x00, 0xB5, 0xFE, 0xAD, 0x04, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0x3F, 0x00,
+    0xF2, 0x5E, 0xC4, 0x52, 0x2B, 0x00,
+    0xF5, 0x08, 0xC3, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0xC3, 0x00, 0x00, 0x00,
+    0xB0, 0xAF, 0xC8, 0x00, 0x00, 0x00,
+    0x10, 0xE8, 0xFF, 0xBE, 0x04, 0x00,
+    0x00, 0x00, 0xD5, 0xE8, 0x6F, 0x00,
+    0x00, 0x00, 0xC3, 0x10, 0xEE, 0x00,
+    0x00, 0x00, 0xC3, 0x00, 0xFC, 0x01,
+    0xA5, 0x14, 0xC3, 0x92, 0xDF, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0x5F, 0x00,
+    0x50, 0xDA, 0xFE, 0xAD, 0x03, 0x00,
+    0x00, 0x00, 0xC4, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC3, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC3, 0x00, 0x00, 0x00,
+    /* 0x25 '%' 18x15 */
+    0x50, 0xFD, 0x4C, 0x00, 0x00, 0x10, 0x8E, 0x00, 0x00,
+    0xF3, 0x17, 0xF8, 0x02, 0x00, 0xA0, 0x1D, 0x00, 0x00,
+    0xDA, 0x00, 0xE0, 0x09, 0x00, 0xF4, 0x05, 0x00, 0x00,
+    0xBC, 0x00, 0xC0, 0x0C, 0x00, 0xBC, 0x00, 0x00, 0x00,
+    0xBC, 0x00, 0xC0, 0x0C, 0x70, 0x2F, 0x00, 0x00, 0x00,
+    0xDA, 0x00, 0xE0, 0x09, 0xE2, 0x07, 0x00, 0x00, 0x00,
+    0xF3, 0x17, 0xF8, 0x03, 0xDA, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFD, 0x5D, 0x40, 0x4F, 0x50, 0xFC, 0x5D, 0x00,
+    0x00, 0x00, 0x00, 0xD0, 0x0A, 0xF3, 0x18, 0xF7, 0x03,
+    0x00, 0x00, 0x00, 0xE8, 0x02, 0xE9, 0x00, 0xD0, 0x0A,
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0xCC, 0x00, 0xB0, 0x0D,
+    0x00, 0x00, 0xB0, 0x0C, 0x00, 0xBC, 0x00, 0xB0, 0x0D,
+    0x00, 0x00, 0xF5, 0x04, 0x00, 0xE9, 0x00, 0xD0, 0x0A,
+    0x00, 0x10, 0x9D, 0x00, 0x00, 0xF3, 0x18, 0xF7, 0x03,
+    0x00, 0x80, 0x1E, 0x00, 0x00, 0x50, 0xFD, 0x5D, 0x00,
+    /* 0x26 '&' 14x15 */
+    0x00, 0x50, 0xEC, 0xBE, 0x04, 0x00, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0x2F, 0x00, 0x00,
+    0x00, 0xFE, 0x18, 0x41, 0x2B, 0x00, 0x00,
+    0x10, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xED, 0x01, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF6, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0xBF, 0x01, 0x00, 0x00, 0x00,
+    0xA0, 0x5F, 0xF9, 0x1B, 0x00, 0x90, 0x3F,
+    0xF4, 0x08, 0x80, 0xCF, 0x01, 0xC0, 0x0E,
+    0xF9, 0x03, 0x00, 0xF7, 0x2D, 0xF2, 0x08,
+    0xFB, 0x03, 0x00, 0x60, 0xDF, 0xEB, 0x01,
+    0xF9, 0x09, 0x00, 0x00, 0xF5, 0x7F, 0x00,
+    0xF3, 0xAF, 0x13, 0x41, 0xFC, 0xDF, 0x01,
+    0x60, 0xFF, 0xFF, 0xFF, 0x7F, 0xF7, 0x0B,
+    0x00, 0xA3, 0xFE, 0xAE, 0x03, 0xC0, 0x9F,
+    /* 0x27 ''' 4x5 */
+    0xF1, 0x09,
+    0xF1, 0x09,
+    0xF1, 0x09,
+    0xF1, 0x09,
+    0xF1, 0x09,
+    /* 0x28 '(' 6x18 */
+    0x00, 0xA0, 0x1E,
+    0x00, 0xF3, 0x07,
+    0x00, 0xEB, 0x01,
+    0x20, 0x9F, 0x00,
+    0x80, 0x4F, 0x00,
+    0xC0, 0x1F, 0x00,
+    0xF1, 0x0C, 0x00,
+    0xF2, 0x0B, 0x00,
+    0xF4, 0x0A, 0x00,
+    0xF4, 0x0A, 0x00,
+    0xF2, 0x0B, 0x00,
+    0xF1, 0x0D, 0x00,
+    0xC0, 0x1F, 0x00,
+    0x80, 0x4F, 0x00,
+    0x20, 0x9F, 0x00,
+    0x00, 0xEB, 0x01,
+    0x00, 0xF3, 0x07,
+    0x00, 0xA0, 0x1E,
+    /* 0x29 ')' 6x18 */
+    0xF2, 0x07, 0x00,
+    0xA0, 0x1E, 0x00,
+    0x30, 0x8F, 0x00,
+    0x00, 0xEC, 0x00,
+    0x00, 0xF7, 0x05,
+    0x00, 0xF4, 0x09,
+    0x00, 0xF1, 0x0C,
+    0x00, 0xE0, 0x0E,
+    0x00, 0xD0, 0x1F,
+    0x00, 0xD0, 0x0F,
+    0x00, 0xE0, 0x0E,
+    0x00, 0xF1, 0x0C,
+    0x00, 0xF4, 0x09,
+    0x00, 0xF7, 0x05,
+    0x00, 0xEC, 0x00,
+    0x30, 0x8F, 0x00,
+    0xA0, 0x1E, 0x00,
+    0xF2, 0x07, 0x00,
+    /* 0x2A 10x10 */
+    0x00, 0x00, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x88, 0x00, 0x00,
+    0xB2, 0x03, 0x88, 0x30, 0x2B,
+    0x81, 0x8E, 0x99, 0xE8, 0x18,
+    0x00, 0xA2, 0xFF, 0x2A, 0x00,
+    0x00, 0xA2, 0xFF, 0x2A, 0x00,
+    0x81, 0x8E, 0x99, 0xE8, 0x18,
+    0xB2, 0x03, 0x88, 0x30, 0x2B,
+    0x00, 0x00, 0x88, 0x00, 0x00,
+    0x00, 0x00, 0x88, 0x00, 0x00,
+    /* 0x2B '+' 14x12 */
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    /* 0x2C ',' 4x5 */
+    0xA0, 0x6F,
+    0xA0, 0x6F,
+    0xD0, 0x1E,
+    0xF1, 0x08,
+    0xE5, 0x01,
+    /* 0x2D '-' 8x2 */
+    0xF0, 0xFF, 0xFF, 0x04,
+    0xF0, 0xFF, 0xFF, 0x04,
+    /* 0x2E '.' 4x2 */
+    0xFD, 0x03,
+    0xFD, 0x03,
+    /* 0x2F '/' 8x16 */
+    0x00, 0x00, 0xF1, 0x09,
+    0x00, 0x00, 0xF6, 0x04,
+    0x00, 0x00, 0xEB, 0x00,
+    0x00, 0x10, 0x9F, 0x00,
+    0x00, 0x50, 0x5F, 0x00,
+    0x00, 0xA0, 0x0E, 0x00,
+    0x00, 0xE0, 0x0A, 0x00,
+    0x00, 0xF5, 0x05, 0x00,
+    0x00, 0xF9, 0x01, 0x00,
+    0x00, 0xBE, 0x00, 0x00,
+    0x40, 0x6F, 0x00, 0x00,
+    0x90, 0x1F, 0x00, 0x00,
+    0xD0, 0x0B, 0x00, 0x00,
+    0xF3, 0x07, 0x00, 0x00,
+    0xF8, 0x02, 0x00, 0x00,
+    0xCD, 0x00, 0x00, 0x00,
+    /* 0x30 '0' 12x15 */
+    0x00, 0x92, 0xFE, 0x7D, 0x00, 0x00,
+    0x20, 0xFE, 0xFF, 0xFF, 0x0B, 0x00,
+    0xB0, 0xBF, 0x02, 0xE4, 0x6F, 0x00,
+    0xF2, 0x1E, 0x00, 0x50, 0xCF, 0x00,
+    0xF6, 0x0A, 0x00, 0x00, 0xFE, 0x01,
+    0xF8, 0x07, 0x00, 0x00, 0xFB, 0x04,
+    0xFA, 0x05, 0x00, 0x00, 0xF9, 0x05,
+    0xFA, 0x05, 0x00, 0x00, 0xF9, 0x06,
+    0xFA, 0x05, 0x00, 0x00, 0xF9, 0x05,
+    0xF8, 0x07, 0x00, 0x00, 0xFB, 0x04,
+    0xF6, 0x0A, 0x00, 0x00, 0xFE, 0x01,
+    0xF2, 0x1E, 0x00, 0x50, 0xCF, 0x00,
+    0xB0, 0xBF, 0x02, 0xE4, 0x6F, 0x00,
+    0x20, 0xFE, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0x92, 0xFE, 0x7D, 0x00, 0x00,
+    /* 0x31 '1' 10x15 */
+    0x61, 0xEA, 0xAF, 0x00, 0x00,
+    0xFC, 0xFF, 0xAF, 0x00, 0x00,
+    0x9B, 0x65, 0xAF, 0x00, 0x00,
+    0x00, 0x40, 0xAF, 0x00, 0x00,
+    0x00, 0x40, 0xAF, 0x00, 0x00,
+    0x00, 0x40, 0xAF, 0x00, 0x00,
+    0x00, 0x40, 0xAF, 0x00, 0x00,
+    0x00, 0x40, 0xAF, 0x00, 0x00,
+    0x00, 0x40, 0xAF, 0x00, 0x00,
+    0x00, 0x40, 0xAF, 0x00, 0x00,
+    0x00, 0x40, 0xAF, 0x00, 0x00,
+    0x00, 0x40, 0xAF, 0x00, 0x00,
+    0x00, 0x40, 0xAF, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x0D,
+    0xF8, 0xFF, 0xFF, 0xFF, 0x0D,
+    /* 0x32 '2' 10x15 */
+    0x50, 0xDA, 0xEE, 0x6B, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xA6, 0x25, 0x21, 0xF8, 0x4F,
+    0x00, 0x00, 0x00, 0x90, 0x9F,
+    0x00, 0x00, 0x00, 0x60, 0x9F,
+    0x00, 0x00, 0x00, 0x90, 0x6F,
+    0x00, 0x00, 0x00, 0xF2, 0x0D,
+    0x00, 0x00, 0x10, 0xFD, 0x03,
+    0x00, 0x00, 0xC1, 0x5F, 0x00,
+    0x00, 0x10, 0xFC, 0x05, 0x00,
+    0x00, 0xD2, 0x5F, 0x00, 0x00,
+    0x20, 0xFD, 0x05, 0x00, 0x00,
+    0xD2, 0x5F, 0x00, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xBF,
+    0xF8, 0xFF, 0xFF, 0xFF, 0xBF,
+    /* 0x33 '3' 12x15 */
+    0x30, 0xC8, 0xEE, 0x8C, 0x01, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x1D, 0x00,
+    0xC0, 0x36, 0x11, 0xD5, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x40, 0xAF, 0x00,
+    0x00, 0x00, 0x10, 0xD4, 0x4F, 0x00,
+    0x00, 0xE0, 0xFF, 0xCF, 0x04, 0x00,
+    0x00, 0xE0, 0xFF, 0xEF, 0x07, 0x00,
+    0x00, 0x00, 0x10, 0xD5, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x20, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xFE, 0x01,
+    0x00, 0x00, 0x00, 0x20, 0xFF, 0x00,
+    0x96, 0x24, 0x20, 0xD6, 0xAF, 0x00,
+    0xF7, 0xFF, 0xFF, 0xFF, 0x2D, 0x00,
+    0x61, 0xDB, 0xEF, 0x7C, 0x01, 0x00,
+    /* 0x34 '4' 12x15 */
+    0x00, 0x00, 0x00, 0xF4, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x8F, 0x00,
+    0x00, 0x00, 0x70, 0x9F, 0x8F, 0x00,
+    0x00, 0x00, 0xE2, 0x78, 0x8F, 0x00,
+    0x00, 0x00, 0xDB, 0x71, 0x8F, 0x00,
+    0x00, 0x50, 0x5F, 0x70, 0x8F, 0x00,
+    0x00, 0xD1, 0x0B, 0x70, 0x8F, 0x00,
+    0x00, 0xF8, 0x02, 0x70, 0x8F, 0x00,
+    0x20, 0x7F, 0x00, 0x70, 0x8F, 0x00,
+    0xB0, 0x0D, 0x00, 0x70, 0x8F, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0x00, 0x00, 0x00, 0x70, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x8F, 0x00,
+    0x00, 0x00, 0x00, 0x70, 0x8F, 0x00,
+    /* 0x35 '5' 10x15 */
+    0xD0, 0xFF, 0xFF, 0xFF, 0x0E,
+    0xD0, 0xFF, 0xFF, 0xFF, 0x0E,
+    0xD0, 0x0F, 0x00, 0x00, 0x00,
+    0xD0, 0x0F, 0x00, 0x00, 0x00,
+    0xD0, 0x0F, 0x00, 0x00, 0x00,
+    0xD0, 0xCF, 0xEF, 0x5B, 0x00,
+    0xD0, 0xFF, 0xFF, 0xFF, 0x09,
+    0xA0, 0x25, 0x21, 0xF8, 0x6F,
+    0x00, 0x00, 0x00, 0x70, 0xCF,
+    0x00, 0x00, 0x00, 0x10, 0xEF,
+    0x00, 0x00, 0x00, 0x10, 0xEF,
+    0x00, 0x00, 0x00, 0x70, 0xCF,
+    0x96, 0x24, 0x21, 0xF8, 0x6F,
+    0xF7, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x51, 0xDB, 0xEF, 0x5B, 0x00,
+    /* 0x36 '6' 12x15 */
+    0x00, 0x30, 0xEA, 0xCE, 0x17, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0x8F, 0x00,
+    0x40, 0xFF, 0x29, 0x20, 0x78, 0x00,
+    0xC0, 0x9F, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x1F, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x0B, 0x00, 0x00, 0x00, 0x00,
+    0xF8, 0x38, 0xEB, 0xBE, 0x04, 0x00,
+    0xF9, 0xF9, 0xFF, 0xFF, 0x6F, 0x00,
+    0xF8, 0xBF, 0x13, 0x92, 0xFF, 0x01,
+    0xF7, 0x1E, 0x00, 0x00, 0xFB, 0x05,
+    0xF5, 0x0B, 0x00, 0x00, 0xF8, 0x07,
+    0xF1, 0x1E, 0x00, 0x00, 0xFB, 0x05,
+    0x90, 0xBF, 0x13, 0x92, 0xEF, 0x01,
+    0x10, 0xFD, 0xFF, 0xFF, 0x6F, 0x00,
+    0x00, 0x81, 0xFD, 0xAE, 0x03, 0x00,
+    /* 0x37 '7' 12x15 */
+    0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xF5, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x80, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00,
+    0x00, 0x00, 0x00, 0xF5, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0xFB, 0x04, 0x00,
+    0x00, 0x00, 0x10, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0x2F, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0x06, 0x00, 0x00,
+    0x00, 0x10, 0xFE, 0x01, 0x00, 0x00,
+    0x00, 0x60, 0xAF, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0x0D, 0x00, 0x00, 0x00,
+    /* 0x38 '8' 12x15 */
+    0x00, 0xB4, 0xED, 0x9D, 0x02, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x4F, 0x00,
+    0xF2, 0x8F, 0x02, 0xB3, 0xCF, 0x00,
+    0xF4, 0x0C, 0x00, 0x10, 0xFF, 0x00,
+    0xF2, 0x0C, 0x00, 0x10, 0xDF, 0x00,
+    0xB0, 0x8F, 0x02, 0xB3, 0x7F, 0x00,
+    0x10, 0xE8, 0xFF, 0xDF, 0x06, 0x00,
+    0x20, 0xFB, 0xFF, 0xEF, 0x19, 0x00,
+    0xE1, 0x7F, 0x12, 0xA3, 0xAF, 0x00,
+    0xF7, 0x09, 0x00, 0x00, 0xFD, 0x03,
+    0xF9, 0x06, 0x00, 0x00, 0xFA, 0x05,
+    0xF8, 0x09, 0x00, 0x00, 0xFD, 0x04,
+    0xF4, 0x7F, 0x02, 0xA3, 0xEF, 0x01,
+    0xA0, 0xFF, 0xFF, 0xFF, 0x6F, 0x00,
+    0x00, 0xC6, 0xFE, 0xAE, 0x04, 0x00,
+    /* 0x39 '9' 12x15 */
+    0x00, 0xC6, 0xEE, 0x6C, 0x00, 0x00,
+    0x90, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0xF4, 0x6F, 0x11, 0xD4, 0x4F, 0x00,
+    0xF9, 0x07, 0x00, 0x40, 0xBF, 0x00,
+    0xFB, 0x04, 0x00, 0x10, 0xFF, 0x00,
+    0xFA, 0x07, 0x00, 0x40, 0xFF, 0x03,
+    0xF5, 0x6F, 0x11, 0xD4, 0xFF, 0x04,
+    0xA0, 0xFF, 0xFF, 0xDF, 0xFB, 0x04,
+    0x00, 0xC7, 0xEF, 0x1A, 0xFC, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0x02,
+    0x00, 0x00, 0x00, 0x50, 0xEF, 0x00,
+    0x00, 0x00, 0x00, 0xC1, 0x8F, 0x00,
+    0xA0, 0x25, 0x30, 0xFC, 0x1E, 0x00,
+    0xC0, 0xFF, 0xFF, 0xEF, 0x03, 0x00,
+    0x20, 0xD9, 0xDF, 0x19, 0x00, 0x00,
+    /* 0x3A ':' 4x10 */
+    0xFA, 0x06,
+    0xFA, 0x06,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xFA, 0x06,
+    0xFA, 0x06,
+    /* 0x3B ';' 4x13 */
+    0xA0, 0x6F,
+    0xA0, 0x6F,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xA0, 0x6F,
+    0xA0, 0x6F,
+    0xD0, 0x1E,
+    0xF1, 0x08,
+    0xE5, 0x01,
+    /* 0x3C '<' 14x11 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x08,
+    0x00, 0x00, 0x00, 0x10, 0xC7, 0xFF, 0x09,
+    0x00, 0x00, 0x50, 0xFB, 0xEF, 0x49, 0x00,
+    0x00, 0x93, 0xFE, 0xBF, 0x15, 0x00, 0x00,
+    0xD6, 0xFF, 0x7C, 0x01, 0x00, 0x00, 0x00,
+    0xFD, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD6, 0xFF, 0x6C, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x93, 0xFE, 0xAF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x50, 0xFB, 0xEF, 0x49, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xC7, 0xFF, 0x09,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x93, 0x08,
+    /* 0x3D '=' 14x6 */
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    /* 0x3E '>' 14x11 */
+    0x7B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xBF, 0x15, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFB, 0xEF, 0x49, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xC7, 0xFF, 0x7D, 0x02, 0x00,
+    0x00, 0x00, 0x00, 0x83, 0xFD, 0xBF, 0x04,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x82, 0xFD, 0xBF, 0x04,
+    0x00, 0x10, 0xC6, 0xFF, 0x8D, 0x02, 0x00,
+    0x50, 0xFA, 0xEF, 0x49, 0x00, 0x00, 0x00,
+    0xFD, 0xBF, 0x16, 0x00, 0x00, 0x00, 0x00,
+    0x7B, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0x3F '?' 10x15 */
+    0x61, 0xEB, 0xCF, 0x06, 0x00,
+    0xF8, 0xFF, 0xFF, 0x8F, 0x00,
+    0x97, 0x13, 0x81, 0xFF, 0x01,
+    0x00, 0x00, 0x00, 0xFD, 0x03,
+    0x00, 0x00, 0x00, 0xFE, 0x01,
+    0x00, 0x00, 0x80, 0xAF, 0x00,
+    0x00, 0x00, 0xF6, 0x1D, 0x00,
+    0x00, 0x40, 0xEF, 0x02, 0x00,
+    0x00, 0xC0, 0x4F, 0x00, 0x00,
+    0x00, 0xF1, 0x0C, 0x00, 0x00,
+    0x00, 0xF2, 0x0B, 0x00, 0x00,
+    0x00, 0xF2, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF3, 0x0C, 0x00, 0x00,
+    0x00, 0xF3, 0x0C, 0x00, 0x00,
+    /* 0x40 '@' 18x18 */
+    0x00, 0x00, 0x30, 0xC8, 0xFE, 0xBD, 0x16, 0x00, 0x00,
+    0x00, 0x10, 0xFA, 0xFF, 0xFF, 0xFF, 0xDF, 0x05, 0x00,
+    0x00, 0xD2, 0xDF, 0x37, 0x01, 0x52, 0xF9, 0x6F, 0x00,
+    0x00, 0xFC, 0x08, 0x00, 0x00, 0x00, 0x20, 0xFC, 0x05,
+    0x70, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0x0D,
+    0xE1, 0x0B, 0x00, 0xC5, 0xDF, 0x46, 0x2F, 0x40, 0x4F,
+    0xF5, 0x03, 0x50, 0xFF, 0xFF, 0x9F, 0x2F, 0x00, 0x8E,
+    0xD8, 0x00, 0xD0, 0x6F, 0x11, 0xE5, 0x2F, 0x00, 0x9C,
+    0xBA, 0x00, 0xF1, 0x08, 0x00, 0x70, 0x2F, 0x00, 0x8E,
+    0xBA, 0x00, 0xF1, 0x08, 0x00, 0x70, 0x2F, 0x60, 0x4F,
+    0xD8, 0x00, 0xD0, 0x5E, 0x11, 0xE5, 0x4F, 0xF7, 0x0C,
+    0xF5, 0x03, 0x60, 0xFF, 0xFF, 0x9F, 0xFF, 0xDF, 0x02,
+    0xE1, 0x0A, 0x00, 0xC5, 0xDF, 0x36, 0xCE, 0x17, 0x00,
+    0x80, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0xFD, 0x07, 0x00, 0x00, 0x00, 0xB1, 0x04, 0x00,
+    0x00, 0xD2, 0xDF, 0x37, 0x11, 0x73, 0xEE, 0x04, 0x00,
+    0x00, 0x10, 0xFA, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0xD9, 0xEE, 0x7C, 0x01, 0x00, 0x00,
+    /* 0x41 'A' 14x15 */
+    0x00, 0x00, 0x70, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFB, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xA6, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x51, 0x9F, 0x00, 0x00,
+    0x00, 0x50, 0xAF, 0x10, 0xEE, 0x01, 0x00,
+    0x00, 0xA0, 0x5F, 0x00, 0xFA, 0x05, 0x00,
+    0x00, 0xF1, 0x1E, 0x00, 0xF5, 0x0B, 0x00,
+    0x00, 0xF7, 0x0A, 0x00, 0xE1, 0x2F, 0x00,
+    0x00, 0xFC, 0x05, 0x00, 0xA0, 0x7F, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xE0, 0x5F, 0x00, 0x00, 0x00, 0xFA, 0x09,
+    0xF4, 0x0D, 0x00, 0x00, 0x00, 0xF3, 0x0E,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x5F,
+    /* 0x42 'B' 12x15 */
+    0xF0, 0xFF, 0xFF, 0xDF, 0x18, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x01,
+    0xF0, 0x0E, 0x00, 0x41, 0xFD, 0x08,
+    0xF0, 0x0E, 0x00, 0x00, 0xF6, 0x0A,
+    0xF0, 0x0E, 0x00, 0x00, 0xF6, 0x09,
+    0xF0, 0x0E, 0x00, 0x41, 0xFD, 0x04,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x5C, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x9E, 0x00,
+    0xF0, 0x0E, 0x00, 0x31, 0xFB, 0x09,
+    0xF0, 0x0E, 0x00, 0x00, 0xE1, 0x2F,
+    0xF0, 0x0E, 0x00, 0x00, 0xC0, 0x4F,
+    0xF0, 0x0E, 0x00, 0x00, 0xE1, 0x4F,
+    0xF0, 0x0E, 0x00, 0x31, 0xFB, 0x1E,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF0, 0xFF, 0xFF, 0xDF, 0x3A, 0x00,
+    /* 0x43 'C' 12x15 */
+    0x00, 0x20, 0xC8, 0xFE, 0xBD, 0x27,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x50, 0xFF, 0x4A, 0x01, 0x32, 0xB8,
+    0xE1, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xE1, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0x4A, 0x01, 0x32, 0xB8,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x00, 0x20, 0xC8, 0xFE, 0xBD, 0x27,
+    /* 0x44 'D' 14x15 */
+    0xF0, 0xFF, 0xFF, 0xCE, 0x39, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00,
+    0xF0, 0x0E, 0x00, 0x41, 0xF9, 0xCF, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x30, 0xFE, 0x06,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xF7, 0x0C,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xF2, 0x1F,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0x2F,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xD0, 0x3F,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xE0, 0x2F,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xF2, 0x1F,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xF7, 0x0C,
+    0xF0, 0x0E, 0x00, 0x00, 0x30, 0xFE, 0x06,
+    0xF0, 0x0E, 0x00, 0x41, 0xF9, 0xCF, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00,
+    0xF0, 0xFF, 0xFF, 0xCE, 0x39, 0x00, 0x00,
+    /* 0x45 'E' 12x15 */
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    /* 0x46 'F' 10x15 */
+    0xF0, 0xFF, 0xFF, 0xFF, 0x5F,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x5F,
+    0xF0, 0x0E, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x0B,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x0B,
+    0xF0, 0x0E, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00,
+    /* 0x47 'G' 14x15 */
+    0x00, 0x20, 0xC8, 0xFE, 0xCD, 0x59, 0x01,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0x50, 0xFF, 0x4B, 0x01, 0x31, 0xA5, 0x07,
+    0xE1, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0x03, 0x00, 0x50, 0xFF, 0xFF, 0x0D,
+    0xFC, 0x04, 0x00, 0x50, 0xFF, 0xFF, 0x0D,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xF1, 0x0D,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF1, 0x0D,
+    0xE1, 0x7F, 0x00, 0x00, 0x00, 0xF1, 0x0D,
+    0x50, 0xFF, 0x4A, 0x01, 0x31, 0xF8, 0x0D,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xDF, 0x04,
+    0x00, 0x20, 0xC8, 0xFE, 0xBE, 0x06, 0x00,
+    /* 0x48 'H' 14x15 */
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0xFD, 0x01,
+    /* 0x49 'I' 4x15 */
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    0xF0, 0x0E,
+    /* 0x4A 'J' 6x19 */
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x00, 0xEF,
+    0x00, 0x10, 0xDF,
+    0x00, 0x40, 0xCF,
+    0x00, 0xC3, 0x8F,
+    0xF0, 0xFF, 0x2E,
+    0xF0, 0xBE, 0x03,
+    /* 0x4B 'K' 14x15 */
+    0xF0, 0x0E, 0x00, 0x00, 0xD2, 0x8F, 0x00,
+    0xF0, 0x0E, 0x00, 0x20, 0xFE, 0x07, 0x00,
+    0xF0, 0x0E, 0x00, 0xE3, 0x7F, 0x00, 0x00,
+    0xF0, 0x0E, 0x30, 0xFE, 0x06, 0x00, 0x00,
+    0xF0, 0x0E, 0xE3, 0x6F, 0x00, 0x00, 0x00,
+    0xF0, 0x4E, 0xFE, 0x05, 0x00, 0x00, 0x00,
+    0xF0, 0xEF, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x6E, 0xFF, 0x04, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0xF6, 0x4E, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x60, 0xEF, 0x03, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0xF7, 0x3E, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x70, 0xEF, 0x03, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0xF8, 0x2E, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x80, 0xEF, 0x02,
+    /* 0x4C 'L' 12x15 */
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    /* 0x4D 'M' 16x15 */
+    0xF0, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0x04,
+    0xF0, 0xFF, 0x07, 0x00, 0x00, 0xF3, 0xFF, 0x04,
+    0xF0, 0xDD, 0x0C, 0x00, 0x00, 0xF9, 0xFB, 0x04,
+    0xF0, 0x8D, 0x3F, 0x00, 0x00, 0xBE, 0xF9, 0x04,
+    0xF0, 0x2D, 0x8F, 0x00, 0x50, 0x6F, 0xF9, 0x04,
+    0xF0, 0x0D, 0xEB, 0x00, 0xA0, 0x1E, 0xF9, 0x04,
+    0xF0, 0x0D, 0xF6, 0x04, 0xF1, 0x0A, 0xF9, 0x04,
+    0xF0, 0x0D, 0xF1, 0x0A, 0xF6, 0x04, 0xF9, 0x04,
+    0xF0, 0x0D, 0xA0, 0x1F, 0xEC, 0x00, 0xF9, 0x04,
+    0xF0, 0x0D, 0x40, 0x8F, 0x8F, 0x00, 0xF9, 0x04,
+    0xF0, 0x0D, 0x00, 0xFE, 0x3F, 0x00, 0xF9, 0x04,
+    0xF0, 0x0D, 0x00, 0xF8, 0x0C, 0x00, 0xF9, 0x04,
+    0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x04,
+    0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x04,
+    0xF0, 0x0D, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x04,
+    /* 0x4E 'N' 12x15 */
+    0xF0, 0xDF, 0x00, 0x00, 0x00, 0xFE,
+    0xF0, 0xFF, 0x06, 0x00, 0x00, 0xFE,
+    0xF0, 0xFE, 0x0D, 0x00, 0x00, 0xFE,
+    0xF0, 0x9D, 0x6F, 0x00, 0x00, 0xFE,
+    0xF0, 0x2D, 0xEF, 0x01, 0x00, 0xFE,
+    0xF0, 0x0D, 0xF8, 0x07, 0x00, 0xFE,
+    0xF0, 0x0D, 0xE1, 0x1E, 0x00, 0xFE,
+    0xF0, 0x0D, 0x80, 0x7F, 0x00, 0xFE,
+    0xF0, 0x0D, 0x10, 0xEE, 0x01, 0xFE,
+    0xF0, 0x0D, 0x00, 0xF7, 0x08, 0xFE,
+    0xF0, 0x0D, 0x00, 0xE1, 0x1E, 0xFE,
+    0xF0, 0x0D, 0x00, 0x70, 0x8F, 0xFE,
+    0xF0, 0x0D, 0x00, 0x10, 0xEE, 0xFE,
+    0xF0, 0x0D, 0x00, 0x00, 0xF6, 0xFF,
+    0xF0, 0x0D, 0x00, 0x00, 0xD0, 0xFF,
+    /* 0x4F 'O' 14x15 */
+    0x00, 0x20, 0xD9, 0xEE, 0x8C, 0x01, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x50, 0xFF, 0x3A, 0x11, 0xC4, 0xEF, 0x02,
+    0xE1, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFD, 0x03, 0x00, 0x00, 0x00, 0x70, 0x9F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xE1, 0x7F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0x60, 0xFF, 0x39, 0x11, 0xC4, 0xEF, 0x02,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x00, 0x20, 0xD9, 0xEF, 0x8C, 0x01, 0x00,
+    /* 0x50 'P' 12x15 */
+    0xF0, 0xFF, 0xFF, 0xBE, 0x04, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x6F, 0x00,
+    0xF0, 0x0E, 0x00, 0xA3, 0xEF, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0xFE, 0x04,
+    0xF0, 0x0E, 0x00, 0x00, 0xFB, 0x05,
+    0xF0, 0x0E, 0x00, 0x00, 0xFE, 0x04,
+    0xF0, 0x0E, 0x00, 0xA2, 0xEF, 0x01,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x6F, 0x00,
+    0xF0, 0xFF, 0xFF, 0xBE, 0x04, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    /* 0x51 'Q' 14x18 */
+    0x00, 0x20, 0xD9, 0xEE, 0x8C, 0x01, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x50, 0xFF, 0x3A, 0x11, 0xC4, 0xEF, 0x03,
+    0xE1, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x3F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFD, 0x03, 0x00, 0x00, 0x00, 0x70, 0x9F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xE1, 0x7F, 0x00, 0x00, 0x00, 0xFB, 0x0A,
+    0x60, 0xFF, 0x39, 0x11, 0xC4, 0xDF, 0x01,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x2C, 0x00,
+    0x00, 0x20, 0xD9, 0xFF, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFD, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x80, 0xDF, 0x01,
+    /* 0x52 'R' 14x15 */
+    0xF0, 0xFF, 0xFF, 0xBE, 0x06, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x82, 0xFF, 0x02, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0xFC, 0x05, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0xFC, 0x04, 0x00,
+    0xF0, 0x0E, 0x00, 0x82, 0xEF, 0x01, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00,
+    0xF0, 0x0E, 0x10, 0xE5, 0x4F, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x50, 0xDF, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0xFC, 0x05, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0xF5, 0x0C, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0xD0, 0x3F, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x70, 0xAF, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x10, 0xFE, 0x02,
+    /* 0x53 'S' 12x15 */
+    0x00, 0xB6, 0xFE, 0xBD, 0x16, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
+    0xF5, 0x7F, 0x02, 0x42, 0x99, 0x00,
+    0xF9, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0x1B, 0x00, 0x00, 0x00, 0x00,
+    0xD1, 0xEF, 0x8B, 0x15, 0x00, 0x00,
+    0x10, 0xE9, 0xFF, 0xFF, 0x19, 0x00,
+    0x00, 0x00, 0x63, 0xE9, 0xCF, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFD, 0x05,
+    0x00, 0x00, 0x00, 0x00, 0xF8, 0x08,
+    0x00, 0x00, 0x00, 0x00, 0xFB, 0x08,
+    0xA8, 0x25, 0x11, 0x93, 0xFF, 0x04,
+    0xF9, 0xFF, 0xFF, 0xFF, 0x9F, 0x00,
+    0x51, 0xDA, 0xFE, 0xAD, 0x05, 0x00,
+    /* 0x54 'T' 14x15 */
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    /* 0x55 'U' 12x15 */
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF3, 0x0B, 0x00, 0x00, 0x20, 0xDF,
+    0xF2, 0x0E, 0x00, 0x00, 0x40, 0xCF,
+    0xE0, 0x4F, 0x00, 0x00, 0xA0, 0x8F,
+    0x80, 0xEF, 0x15, 0x20, 0xF8, 0x2F,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x60, 0xEC, 0xEF, 0x3A, 0x00,
+    /* 0x56 'V' 14x15 */
+    0xFA, 0x06, 0x00, 0x00, 0x00, 0xB0, 0x5F,
+    0xF4, 0x0C, 0x00, 0x00, 0x00, 0xF1, 0x0E,
+    0xE0, 0x2F, 0x00, 0x00, 0x00, 0xF7, 0x09,
+    0x80, 0x8F, 0x00, 0x00, 0x00, 0xFC, 0x03,
+    0x30, 0xDF, 0x00, 0x00, 0x30, 0xDF, 0x00,
+    0x00, 0xFC, 0x03, 0x00, 0x80, 0x7F, 0x00,
+    0x00, 0xF7, 0x09, 0x00, 0xE0, 0x2F, 0x00,
+    0x00, 0xF1, 0x0E, 0x00, 0xF4, 0x0B, 0x00,
+    0x00, 0xA0, 0x5F, 0x00, 0xFA, 0x05, 0x00,
+    0x00, 0x50, 0xAF, 0x10, 0xEE, 0x01, 0x00,
+    0x00, 0x00, 0xFE, 0x61, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xB6, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFD, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0x02, 0x00, 0x00,
+    /* 0x57 'W' 20x15 */
+    0xF3, 0x0C, 0x00, 0x00, 0xF5, 0x2F, 0x00, 0x00, 0xF0, 0x0F,
+    0xE0, 0x1F, 0x00, 0x00, 0xF9, 0x5F, 0x00, 0x00, 0xF4, 0x0B,
+    0xB0, 0x4F, 0x00, 0x00, 0xCC, 0x9E, 0x00, 0x00, 0xF7, 0x08,
+    0x70, 0x8F, 0x00, 0x10, 0x8F, 0xDB, 0x00, 0x00, 0xFB, 0x04,
+    0x40, 0xBF, 0x00, 0x50, 0x5F, 0xF8, 0x01, 0x00, 0xFE, 0x01,
+    0x00, 0xEF, 0x00, 0x80, 0x1F, 0xF4, 0x05, 0x30, 0xCF, 0x00,
+    0x00, 0xFB, 0x03, 0xC0, 0x0C, 0xF1, 0x09, 0x70, 0x8F, 0x00,
+    0x00, 0xF8, 0x07, 0xF1, 0x09, 0xC0, 0x0C, 0xA0, 0x4F, 0x00,
+    0x00, 0xF4, 0x0B, 0xF4, 0x05, 0x80, 0x1F, 0xE0, 0x1F, 0x00,
+    0x00, 0xF1, 0x0E, 0xF8, 0x02, 0x50, 0x4F, 0xF3, 0x0C, 0x00,
+    0x00, 0xC0, 0x3F, 0xDB, 0x00, 0x10, 0x8F, 0xF6, 0x08, 0x00,
+    0x00, 0x80, 0x7F, 0x9F, 0x00, 0x00, 0xCD, 0xFA, 0x05, 0x00,
+    0x00, 0x40, 0xDF, 0x6F, 0x00, 0x00, 0xF9, 0xFE, 0x01, 0x00,
+    0x00, 0x10, 0xFF, 0x2F, 0x00, 0x00, 0xF6, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0xFC, 0x0E, 0x00, 0x00, 0xF2, 0x9F, 0x00, 0x00,
+    /* 0x58 'X' 14x15 */
+    0x60, 0xBF, 0x00, 0x00, 0x00, 0xFA, 0x06,
+    0x00, 0xFB, 0x05, 0x00, 0x50, 0xBF, 0x00,
+    0x00, 0xF2, 0x1E, 0x00, 0xE1, 0x2E, 0x00,
+    0x00, 0x70, 0xAF, 0x00, 0xFA, 0x06, 0x00,
+    0x00, 0x00, 0xFC, 0x64, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xED, 0x2E, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0x04, 0x00, 0x00,
+    0x00, 0x00, 0xE2, 0xFE, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0x96, 0x8F, 0x00, 0x00,
+    0x00, 0x60, 0xBF, 0x10, 0xFD, 0x03, 0x00,
+    0x00, 0xE2, 0x2E, 0x00, 0xF5, 0x0C, 0x00,
+    0x00, 0xFB, 0x06, 0x00, 0xA0, 0x7F, 0x00,
+    0x60, 0xBF, 0x00, 0x00, 0x10, 0xEE, 0x02,
+    0xE2, 0x2E, 0x00, 0x00, 0x00, 0xF6, 0x0B,
+    /* 0x59 'Y' 14x15 */
+    0xB0, 0x6F, 0x00, 0x00, 0x00, 0xF3, 0x1D,
+    0x20, 0xEE, 0x02, 0x00, 0x00, 0xFC, 0x04,
+    0x00, 0xF6, 0x0B, 0x00, 0x70, 0x9F, 0x00,
+    0x00, 0xB0, 0x6F, 0x00, 0xF2, 0x1D, 0x00,
+    0x00, 0x20, 0xEE, 0x01, 0xFC, 0x04, 0x00,
+    0x00, 0x00, 0xF6, 0x7A, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0x1E, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    /* 0x5A 'Z' 14x15 */
+    0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09,
+    0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07,
+    0x00, 0x00, 0x00, 0x00, 0x40, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xE2, 0x1D, 0x00,
+    0x00, 0x00, 0x00, 0x10, 0xFC, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xA0, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF7, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x40, 0xBF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE2, 0x1D, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFD, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xA0, 0x5F, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C,
+    0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C,
+    /* 0x5B '[' 6x18 */
+    0xF4, 0xFF, 0x0D,
+    0xF4, 0xFF, 0x0D,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0x08, 0x00,
+    0xF4, 0xFF, 0x0D,
+    0xF4, 0xFF, 0x0D,
+    /* 0x5C 8x16 */
+    0xCD, 0x00, 0x00, 0x00,
+    0xF8, 0x02, 0x00, 0x00,
+    0xF3, 0x07, 0x00, 0x00,
+    0xD0, 0x0B, 0x00, 0x00,
+    0x90, 0x1F, 0x00, 0x00,
+    0x40, 0x6F, 0x00, 0x00,
+    0x00, 0xBE, 0x00, 0x00,
+    0x00, 0xF9, 0x01, 0x00,
+    0x00, 0xF5, 0x05, 0x00,
+    0x00, 0xE0, 0x0A, 0x00,
+    0x00, 0xA0, 0x0E, 0x00,
+    0x00, 0x50, 0x5F, 0x00,
+    0x00, 0x10, 0x9F, 0x00,
+    0x00, 0x00, 0xEB, 0x00,
+    0x00, 0x00, 0xF6, 0x04,
+    0x00, 0x00, 0xF1, 0x09,
+    /* 0x5D ']' 6x18 */
+    0xF1, 0xFF, 0x1F,
+    0xF1, 0xFF, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0x00, 0xB0, 0x1F,
+    0xF1, 0xFF, 0x1F,
+    0xF1, 0xFF, 0x1F,
+    /* 0x5E '^' 14x5 */
+    0x00, 0x00, 0xE3, 0xCF, 0x01, 0x00, 0x00,
+    0x00, 0x30, 0xFE, 0xFA, 0x1C, 0x00, 0x00,
+    0x00, 0xE4, 0x3D, 0x60, 0xDF, 0x02, 0x00,
+    0x50, 0xCF, 0x02, 0x00, 0xE3, 0x2D, 0x00,
+    0xF5, 0x0A, 0x00, 0x00, 0x20, 0xEC, 0x03,
+    /* 0x5F '_' 12x2 */
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
+    /* 0x60 '`' 6x4 */
+    0xD1, 0x1D, 0x00,
+    0x30, 0x9E, 0x00,
+    0x00, 0xF5, 0x05,
+    0x00, 0x80, 0x1E,
+    /* 0x61 'a' 10x11 */
+    0x30, 0xC9, 0xEE, 0x5B, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x07,
+    0xC0, 0x25, 0x10, 0xE6, 0x1E,
+    0x00, 0x00, 0x00, 0x70, 0x4F,
+    0x20, 0xD9, 0xFF, 0xFF, 0x6F,
+    0xE2, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xF9, 0x3A, 0x01, 0x60, 0x7F,
+    0xFC, 0x01, 0x00, 0xB0, 0x7F,
+    0xFA, 0x28, 0x30, 0xFA, 0x7F,
+    0xF3, 0xFF, 0xFF, 0x9F, 0x7F,
+    0x40, 0xEC, 0xBE, 0x54, 0x7F,
+    /* 0x62 'b' 12x15 */
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x29, 0xEA, 0xBE, 0x04, 0x00,
+    0xF3, 0xEB, 0xFF, 0xFF, 0x5F, 0x00,
+    0xF3, 0xDF, 0x14, 0xA2, 0xEF, 0x01,
+    0xF3, 0x2F, 0x00, 0x00, 0xFC, 0x05,
+    0xF3, 0x0B, 0x00, 0x00, 0xF6, 0x08,
+    0xF3, 0x0A, 0x00, 0x00, 0xF5, 0x09,
+    0xF3, 0x0B, 0x00, 0x00, 0xF6, 0x08,
+    0xF3, 0x2F, 0x00, 0x00, 0xFB, 0x05,
+    0xF3, 0xDF, 0x14, 0x92, 0xEF, 0x01,
+    0xF3, 0xEB, 0xFF, 0xFF, 0x5F, 0x00,
+    0xF3, 0x29, 0xEA, 0xBE, 0x04, 0x00,
+    /* 0x63 'c' 10x11 */
+    0x00, 0xA3, 0xFE, 0x9D, 0x02,
+    0x60, 0xFF, 0xFF, 0xFF, 0x0B,
+    0xF3, 0x9F, 0x13, 0x62, 0x09,
+    0xF9, 0x09, 0x00, 0x00, 0x00,
+    0xFC, 0x02, 0x00, 0x00, 0x00,
+    0xFD, 0x01, 0x00, 0x00, 0x00,
+    0xFC, 0x02, 0x00, 0x00, 0x00,
+    0xF9, 0x09, 0x00, 0x00, 0x00,
+    0xF3, 0x9F, 0x13, 0x62, 0x09,
+    0x60, 0xFF, 0xFF, 0xFF, 0x0B,
+    0x00, 0xA3, 0xFE, 0x9D, 0x02,
+    /* 0x64 'd' 10x15 */
+    0x00, 0x00, 0x00, 0x00, 0xDE,
+    0x00, 0x00, 0x00, 0x00, 0xDE,
+    0x00, 0x00, 0x00, 0x00, 0xDE,
+    0x00, 0x00, 0x00, 0x00, 0xDE,
+    0x00, 0xD7, 0xDF, 0x08, 0xDE,
+    0x90, 0xFF, 0xFF, 0xBF, 0xDE,
+    0xF4, 0x6E, 0x11, 0xE6, 0xDF,
+    0xF9, 0x07, 0x00, 0x70, 0xDF,
+    0xFC, 0x01, 0x00, 0x10, 0xDF,
+    0xFD, 0x00, 0x00, 0x00, 0xDE,
+    0xFC, 0x01, 0x00, 0x10, 0xDF,
+    0xF9, 0x07, 0x00, 0x60, 0xDF,
+    0xF4, 0x6E, 0x11, 0xE6, 0xDF,
+    0x90, 0xFF, 0xFF, 0xBF, 0xDE,
+    0x00, 0xD7, 0xDF, 0x08, 0xDE,
+    /* 0x65 'e' 12x11 */
+    0x00, 0xA3, 0xFE, 0x9D, 0x02, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0x3E, 0x00,
+    0xF2, 0x6E, 0x01, 0x82, 0xBF, 0x00,
+    0xF9, 0x04, 0x00, 0x00, 0xFB, 0x01,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0xFC, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x9F, 0x13, 0x31, 0xA7, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x93, 0xFD, 0xCE, 0x28, 0x00,
+    /* 0x66 'f' 8x15 */
+    0x00, 0x70, 0xFD, 0x6F,
+    0x00, 0xF6, 0xFF, 0x6F,
+    0x00, 0xFB, 0x05, 0x00,
+    0x00, 0xFC, 0x00, 0x00,
+    0xF8, 0xFF, 0xFF, 0x0E,
+    0xF8, 0xFF, 0xFF, 0x0E,
+    0x00, 0xFC, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x00,
+    0x00, 0xFC, 0x00, 0x00,
+    /* 0x67 'g' 10x15 */
+    0x00, 0xD7, 0xDF, 0x08, 0xDE,
+    0x90, 0xFF, 0xFF, 0xBF, 0xDE,
+    0xF4, 0x6E, 0x11, 0xE6, 0xDF,
+    0xF9, 0x07, 0x00, 0x60, 0xDF,
+    0xFC, 0x01, 0x00, 0x10, 0xDF,
+    0xFD, 0x00, 0x00, 0x00, 0xDE,
+    0xFC, 0x01, 0x00, 0x10, 0xDF,
+    0xFA, 0x06, 0x00, 0x60, 0xDF,
+    0xF4, 0x6E, 0x11, 0xE6, 0xDF,
+    0x90, 0xFF, 0xFF, 0xBF, 0xDE,
+    0x00, 0xD7, 0xDF, 0x18, 0xCF,
+    0x00, 0x00, 0x00, 0x60, 0x9F,
+    0x70, 0x27, 0x21, 0xE6, 0x4F,
+    0x90, 0xFF, 0xFF, 0xFF, 0x09,
+    0x10, 0xC8, 0xEE, 0x6C, 0x00,
+    /* 0x68 'h' 10x15 */
+    0xF3, 0x09, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00,
+    0xF3, 0x19, 0xEA, 0xCF, 0x04,
+    0xF3, 0xDB, 0xFF, 0xFF, 0x4F,
+    0xF3, 0xCF, 0x14, 0xA2, 0xAF,
+    0xF3, 0x1E, 0x00, 0x10, 0xEE,
+    0xF3, 0x0B, 0x00, 0x00, 0xFD,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    /* 0x69 'i' 4x15 */
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    /* 0x6A 'j' 6x19 */
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF3, 0x0A,
+    0x10, 0xF9, 0x07,
+    0xF5, 0xFF, 0x02,
+    0xF5, 0x5D, 0x00,
+    /* 0x6B 'k' 12x15 */
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x90, 0xAF, 0x00,
+    0xF3, 0x09, 0x00, 0xFA, 0x09, 0x00,
+    0xF3, 0x09, 0xB1, 0x7F, 0x00, 0x00,
+    0xF3, 0x29, 0xFD, 0x05, 0x00, 0x00,
+    0xF3, 0xEC, 0x4E, 0x00, 0x00, 0x00,
+    0xF3, 0xFE, 0x1C, 0x00, 0x00, 0x00,
+    0xF3, 0x79, 0xCF, 0x01, 0x00, 0x00,
+    0xF3, 0x09, 0xF7, 0x1C, 0x00, 0x00,
+    0xF3, 0x09, 0x60, 0xDF, 0x02, 0x00,
+    0xF3, 0x09, 0x00, 0xF6, 0x2D, 0x00,
+    0xF3, 0x09, 0x00, 0x50, 0xDF, 0x02,
+    /* 0x6C 'l' 4x15 */
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    0xF2, 0x0A,
+    /* 0x6D 'm' 18x11 */
+    0xF3, 0x29, 0xEA, 0xBE, 0x02, 0x91, 0xFE, 0x3B, 0x00,
+    0xF3, 0xEB, 0xFF, 0xFF, 0x2D, 0xFD, 0xFF, 0xEF, 0x01,
+    0xF3, 0xCF, 0x13, 0xC3, 0xEF, 0x4C, 0x21, 0xFB, 0x07,
+    0xF3, 0x1E, 0x00, 0x40, 0xFF, 0x02, 0x00, 0xF3, 0x0A,
+    0xF3, 0x0B, 0x00, 0x20, 0xCF, 0x00, 0x00, 0xF1, 0x0B,
+    0xF3, 0x09, 0x00, 0x20, 0xBF, 0x00, 0x00, 0xF0, 0x0C,
+    0xF3, 0x09, 0x00, 0x20, 0xBF, 0x00, 0x00, 0xF0, 0x0C,
+    0xF3, 0x09, 0x00, 0x20, 0xBF, 0x00, 0x00, 0xF0, 0x0C,
+    0xF3, 0x09, 0x00, 0x20, 0xBF, 0x00, 0x00, 0xF0, 0x0C,
+    0xF3, 0x09, 0x00, 0x20, 0xBF, 0x00, 0x00, 0xF0, 0x0C,
+    0xF3, 0x09, 0x00, 0x20, 0xBF, 0x00, 0x00, 0xF0, 0x0C,
+    /* 0x6E 'n' 10x11 */
+    0xF3, 0x19, 0xEA, 0xCF, 0x04,
+    0xF3, 0xDB, 0xFF, 0xFF, 0x4F,
+    0xF3, 0xCF, 0x14, 0xA2, 0xAF,
+    0xF3, 0x1E, 0x00, 0x10, 0xEE,
+    0xF3, 0x0B, 0x00, 0x00, 0xFD,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    /* 0x6F 'o' 12x11 */
+    0x00, 0xB5, 0xFE, 0x7C, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0xF4, 0x7F, 0x12, 0xE5, 0x7F, 0x00,
+    0xF9, 0x08, 0x00, 0x40, 0xDF, 0x00,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xFD, 0x01, 0x00, 0x00, 0xFC, 0x02,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xF9, 0x08, 0x00, 0x40, 0xDF, 0x00,
+    0xF4, 0x7F, 0x12, 0xE5, 0x7F, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0xC5, 0xFE, 0x7C, 0x00, 0x00,
+    /* 0x70 'p' 12x15 */
+    0xF3, 0x29, 0xEA, 0xBE, 0x04, 0x00,
+    0xF3, 0xEB, 0xFF, 0xFF, 0x5F, 0x00,
+    0xF3, 0xDF, 0x14, 0xA2, 0xEF, 0x01,
+    0xF3, 0x2F, 0x00, 0x00, 0xFC, 0x05,
+    0xF3, 0x0B, 0x00, 0x00, 0xF6, 0x08,
+    0xF3, 0x0A, 0x00, 0x00, 0xF5, 0x09,
+    0xF3, 0x0B, 0x00, 0x00, 0xF6, 0x08,
+    0xF3, 0x2F, 0x00, 0x00, 0xFB, 0x05,
+    0xF3, 0xDF, 0x14, 0x92, 0xEF, 0x01,
+    0xF3, 0xEB, 0xFF, 0xFF, 0x5F, 0x00,
+    0xF3, 0x29, 0xEA, 0xBE, 0x04, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    /* 0x71 'q' 10x15 */
+    0x00, 0xD7, 0xDF, 0x08, 0xDE,
+    0x90, 0xFF, 0xFF, 0xBF, 0xDE,
+    0xF4, 0x6E, 0x11, 0xE6, 0xDF,
+    0xF9, 0x07, 0x00, 0x70, 0xDF,
+    0xFC, 0x01, 0x00, 0x10, 0xDF,
+    0xFD, 0x00, 0x00, 0x00, 0xDE,
+    0xFC, 0x01, 0x00, 0x10, 0xDF,
+    0xF9, 0x07, 0x00, 0x60, 0xDF,
+    0xF4, 0x6E, 0x11, 0xE6, 0xDF,
+    0x90, 0xFF, 0xFF, 0xBF, 0xDE,
+    0x00, 0xD7, 0xDF, 0x08, 0xDE,
+    0x00, 0x00, 0x00, 0x00, 0xDE,
+    0x00, 0x00, 0x00, 0x00, 0xDE,
+    0x00, 0x00, 0x00, 0x00, 0xDE,
+    0x00, 0x00, 0x00, 0x00, 0xDE,
+    /* 0x72 'r' 8x11 */
+    0xF3, 0x29, 0xEA, 0x3F,
+    0xF3, 0xEB, 0xFF, 0x3F,
+    0xF3, 0xCF, 0x14, 0x00,
+    0xF3, 0x2E, 0x00, 0x00,
+    0xF3, 0x0B, 0x00, 0x00,
+    0xF3, 0x0A, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00,
+    /* 0x73 's' 10x11 */
+    0x40, 0xEB, 0xDE, 0x39, 0x00,
+    0xF6, 0xFF, 0xFF, 0xDF, 0x00,
+    0xFC, 0x27, 0x20, 0xA6, 0x00,
+    0xFC, 0x00, 0x00, 0x00, 0x00,
+    0xF7, 0x5A, 0x01, 0x00, 0x00,
+    0x60, 0xFC, 0xDF, 0x18, 0x00,
+    0x00, 0x10, 0x74, 0xDE, 0x01,
+    0x00, 0x00, 0x00, 0xF7, 0x05,
+    0x7B, 0x13, 0x31, 0xFC, 0x05,
+    0xFE, 0xFF, 0xFF, 0xDF, 0x01,
+    0x82, 0xEC, 0xCE, 0x18, 0x00,
+    /* 0x74 't' 8x14 */
+    0x20, 0xAF, 0x00, 0x00,
+    0x20, 0xAF, 0x00, 0x00,
+    0x20, 0xAF, 0x00, 0x00,
+    0xF7, 0xFF, 0xFF, 0x5F,
+    0xF7, 0xFF, 0xFF, 0x5F,
+    0x20, 0xAF, 0x00, 0x00,
+    0x20, 0xAF, 0x00, 0x00,
+    0x20, 0xAF, 0x00, 0x00,
+    0x20, 0xAF, 0x00, 0x00,
+    0x20, 0xAF, 0x00, 0x00,
+    0x20, 0xAF, 0x00, 0x00,
+    0x10, 0xEF, 0x02, 0x00,
+    0x00, 0xFB, 0xFF, 0x5F,
+    0x00, 0xA2, 0xFE, 0x5F,
+    /* 0x75 'u' 10x11 */
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDF,
+    0xF3, 0x0A, 0x00, 0x50, 0xDF,
+    0xE1, 0x6F, 0x11, 0xE6, 0xDF,
+    0x80, 0xFF, 0xFF, 0xAF, 0xDE,
+    0x00, 0xD7, 0xDF, 0x07, 0xDE,
+    /* 0x76 'v' 12x11 */
+    0xF3, 0x0A, 0x00, 0x00, 0xD0, 0x1F,
+    0xD0, 0x1F, 0x00, 0x00, 0xF3, 0x0A,
+    0x70, 0x6F, 0x00, 0x00, 0xF9, 0x05,
+    0x20, 0xCF, 0x00, 0x00, 0xEE, 0x00,
+    0x00, 0xFB, 0x02, 0x50, 0x8F, 0x00,
+    0x00, 0xF5, 0x08, 0xA0, 0x3F, 0x00,
+    0x00, 0xE1, 0x0D, 0xF1, 0x0C, 0x00,
+    0x00, 0x90, 0x4F, 0xF7, 0x07, 0x00,
+    0x00, 0x30, 0xAF, 0xFC, 0x01, 0x00,
+    0x00, 0x00, 0xFD, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0x5F, 0x00, 0x00,
+    /* 0x77 'w' 16x11 */
+    0xF1, 0x0C, 0x00, 0xF1, 0x5F, 0x00, 0x60, 0x6F,
+    0xC0, 0x1F, 0x00, 0xF4, 0x9F, 0x00, 0xA0, 0x2F,
+    0x80, 0x4F, 0x00, 0xF8, 0xDB, 0x00, 0xE0, 0x0D,
+    0x40, 0x8F, 0x00, 0xCC, 0xF6, 0x02, 0xF3, 0x09,
+    0x00, 0xCE, 0x10, 0x8F, 0xF2, 0x06, 0xF7, 0x05,
+    0x00, 0xFB, 0x51, 0x4F, 0xD0, 0x0A, 0xFB, 0x01,
+    0x00, 0xF7, 0x95, 0x0F, 0xA0, 0x0E, 0xCE, 0x00,
+    0x00, 0xF3, 0xC9, 0x0B, 0x60, 0x7F, 0x8F, 0x00,
+    0x00, 0xE0, 0xFE, 0x07, 0x20, 0xEF, 0x5F, 0x00,
+    0x00, 0xA0, 0xFF, 0x03, 0x00, 0xFD, 0x1F, 0x00,
+    0x00, 0x60, 0xEF, 0x00, 0x00, 0xF9, 0x0C, 0x00,
+    /* 0x78 'x' 12x11 */
+    0xA0, 0x6F, 0x00, 0x00, 0xF8, 0x09,
+    0x10, 0xFD, 0x03, 0x40, 0xDF, 0x01,
+    0x00, 0xF3, 0x1D, 0xE1, 0x3E, 0x00,
+    0x00, 0x70, 0xAF, 0xFB, 0x06, 0x00,
+    0x00, 0x00, 0xFB, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0x3F, 0x00, 0x00,
+    0x00, 0x20, 0xEE, 0xCF, 0x00, 0x00,
+    0x00, 0xC0, 0x4F, 0xF8, 0x09, 0x00,
+    0x00, 0xF9, 0x08, 0xC0, 0x5F, 0x00,
+    0x50, 0xCF, 0x00, 0x20, 0xEE, 0x02,
+    0xE2, 0x2E, 0x00, 0x00, 0xF5, 0x0C,
+    /* 0x79 'y' 12x15 */
+    0xF3, 0x0A, 0x00, 0x00, 0xD0, 0x1E,
+    0xC0, 0x2F, 0x00, 0x00, 0xF4, 0x09,
+    0x60, 0x7F, 0x00, 0x00, 0xFA, 0x03,
+    0x00, 0xDE, 0x00, 0x10, 0xBF, 0x00,
+    0x00, 0xF8, 0x04, 0x70, 0x5F, 0x00,
+    0x00, 0xF2, 0x0A, 0xD0, 0x0E, 0x00,
+    0x00, 0xB0, 0x1F, 0xF4, 0x08, 0x00,
+    0x00, 0x50, 0x7F, 0xFA, 0x02, 0x00,
+    0x00, 0x00, 0xDD, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x06, 0x00, 0x00,
+    0x00, 0x30, 0xED, 0x01, 0x00, 0x00,
+    0x60, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x60, 0xEF, 0x09, 0x00, 0x00, 0x00,
+    /* 0x7A 'z' 10x11 */
+    0xD0, 0xFF, 0xFF, 0xFF, 0xAF,
+    0xD0, 0xFF, 0xFF, 0xFF, 0x8F,
+    0x00, 0x00, 0x00, 0xC1, 0x0B,
+    0x00, 0x00, 0x00, 0xCB, 0x01,
+    0x00, 0x00, 0xA0, 0x1D, 0x00,
+    0x00, 0x00, 0xE8, 0x02, 0x00,
+    0x00, 0x70, 0x3E, 0x00, 0x00,
+    0x00, 0xF6, 0x04, 0x00, 0x00,
+    0x40, 0x5F, 0x00, 0x00, 0x00,
+    0xE1, 0xFF, 0xFF, 0xFF, 0xAF,
+    0xF2, 0xFF, 0xFF, 0xFF, 0xAF,
+    /* 0x7B '{' 10x18 */
+    0x00, 0x00, 0xB4, 0xFE, 0x03,
+    0x00, 0x20, 0xFF, 0xFF, 0x03,
+    0x00, 0x50, 0xBF, 0x02, 0x00,
+    0x00, 0x70, 0x6F, 0x00, 0x00,
+    0x00, 0x70, 0x5F, 0x00, 0x00,
+    0x00, 0x70, 0x5F, 0x00, 0x00,
+    0x00, 0x80, 0x4F, 0x00, 0x00,
+    0x10, 0xE4, 0x2F, 0x00, 0x00,
+    0xF8, 0xEF, 0x07, 0x00, 0x00,
+    0xF8, 0xEF, 0x06, 0x00, 0x00,
+    0x10, 0xE4, 0x2F, 0x00, 0x00,
+    0x00, 0x90, 0x4F, 0x00, 0x00,
+    0x00, 0x70, 0x5F, 0x00, 0x00,
+    0x00, 0x70, 0x5F, 0x00, 0x00,
+    0x00, 0x70, 0x6F, 0x00, 0x00,
+    0x00, 0x50, 0xBF, 0x02, 0x00,
+    0x00, 0x20, 0xFF, 0xFF, 0x03,
+    0x00, 0x00, 0xB5, 0xFE, 0x03,
+    /* 0x7C '|' 4x20 */
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    /* 0x7D '}' 10x18 */
+    0xF8, 0xAE, 0x02, 0x00, 0x00,
+    0xF8, 0xFF, 0x0C, 0x00, 0x00,
+    0x00, 0xE3, 0x1F, 0x00, 0x00,
+    0x00, 0xA0, 0x2F, 0x00, 0x00,
+    0x00, 0x90, 0x3F, 0x00, 0x00,
+    0x00, 0x90, 0x3F, 0x00, 0x00,
+    0x00, 0x90, 0x4F, 0x00, 0x00,
+    0x00, 0x60, 0xBF, 0x02, 0x00,
+    0x00, 0x10, 0xFA, 0xFF, 0x03,
+    0x00, 0x00, 0xF9, 0xFF, 0x03,
+    0x00, 0x60, 0xCF, 0x03, 0x00,
+    0x00, 0x90, 0x4F, 0x00, 0x00,
+    0x00, 0x90, 0x3F, 0x00, 0x00,
+    0x00, 0x90, 0x3F, 0x00, 0x00,
+    0x00, 0xA0, 0x2F, 0x00, 0x00,
+    0x00, 0xE3, 0x1F, 0x00, 0x00,
+    0xF8, 0xFF, 0x0C, 0x00, 0x00,
+    0xF8, 0xAE, 0x02, 0x00, 0x00,
+    /* 0x7E '~' 14x5 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0x60, 0xFC, 0xCE, 0x48, 0x01, 0x93, 0x09,
+    0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08,
+    0x9D, 0x03, 0x52, 0xC9, 0xEE, 0x4B, 0x00,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const aGLYPH Font20AA_Glyph[95] =
+{
+    /* offset, width, height, left, top, advance */
+    {     0,   0,   0,   0,   0,   6 },  /* 0x20 ' ' */
+    {     0,   2,  15,   3,  15,   8 },  /* 0x21 '!' */
+    {    15,   8,   5,   1,  15,   9 },  /* 0x22 '"' */
+    {    35,  16,  15,   1,  15,  17 },  /* 0x23 '#' */
+    {   155,  12,  18,   1,  15,  13 },  /* 0x24 '$' */
+    {   263,  18,  15,   1,  15,  19 },  /* 0x25 '%' */
+    {   398,  14,  15,   1,  15,  16 },  /* 0x26 '&' */
+    {   503,   4,   5,   1,  15,   6 },  /* 0x27 ''' */
+    {   513,   6,  18,   1,  15,   8 },  /* 0x28 '(' */
+    {   567,   6,  18,   1,  15,   8 },  /* 0x29 ')' */
+    {   621,  10,  10,   0,  15,  10 },  /* 0x2A */
+    {   671,  14,  12,   2,  12,  17 },  /* 0x2B '+' */
+    {   755,   4,   5,   1,   2,   6 },  /* 0x2C ',' */
+    {   765,   8,   2,   0,   7,   7 },  /* 0x2D '-' */
+    {   773,   4,   2,   2,   2,   6 },  /* 0x2E '.' */
+    {   777,   8,  16,   0,  15,   7 },  /* 0x2F '/' */
+    {   841,  12,  15,   1,  15,  13 },  /* 0x30 '0' */
+    {   931,  10,  15,   2,  15,  13 },  /* 0x31 '1' */
+    {  1006,  10,  15,   1,  15,  13 },  /* 0x32 '2' */
+    {  1081,  12,  15,   1,  15,  13 },  /* 0x33 '3' */
+    {  1171,  12,  15,   0,  15,  13 },  /* 0x34 '4' */
+    {  1261,  10,  15,   1,  15,  13 },  /* 0x35 '5' */
+    {  1336,  12,  15,   1,  15,  13 },  /* 0x36 '6' */
+    {  1426,  12,  15,   1,  15,  13 },  /* 0x37 '7' */
+    {  1516,  12,  15,   1,  15,  13 },  /* 0x38 '8' */
+    {  1606,  12,  15,   1,  15,  13 },  /* 0x39 '9' */
+    {  1696,   4,  10,   2,  10,   7 },  /* 0x3A ':' */
+    {  1716,   4,  13,   1,  10,   7 },  /* 0x3B ';' */
+    {  1742,  14,  11,   2,  12,  17 },  /* 0x3C '<' */
+    {  1819,  14,   6,   2,   9,  17 },  /* 0x3D '=' */
+    {  1861,  14,  11,   2,  12,  17 },  /* 0x3E '>' */
+    {  1938,  10,  15,   1,  15,  11 },  /* 0x3F '?' */
+    {  2013,  18,  18,   1,  14,  20 },  /* 0x40 '@' */
+    {  2175,  14,  15,   0,  15,  14 },  /* 0x41 'A' */
+    {  2280,  12,  15,   1,  15,  14 },  /* 0x42 'B' */
+    {  2370,  12,  15,   1,  15,  14 },  /* 0x43 'C' */
+    {  2460,  14,  15,   1,  15,  15 },  /* 0x44 'D' */
+    {  2565,  12,  15,   1,  15,  13 },  /* 0x45 'E' */
+    {  2655,  10,  15,   1,  15,  12 },  /* 0x46 'F' */
+    {  2730,  14,  15,   1,  15,  16 },  /* 0x47 'G' */
+    {  2835,  14,  15,   1,  15,  15 },  /* 0x48 'H' */
+    {  2940,   4,  15,   1,  15,   6 },  /* 0x49 'I' */
+    {  2970,   6,  19,  -2,  15,   6 },  /* 0x4A 'J' */
+    {  3027,  14,  15,   1,  15,  13 },  /* 0x4B 'K' */
+    {  3132,  12,  15,   1,  15,  11 },  /* 0x4C 'L' */
+    {  3222,  16,  15,   1,  15,  17 },  /* 0x4D 'M' */
+    {  3342,  12,  15,   1,  15,  15 },  /* 0x4E 'N' */
+    {  3432,  14,  15,   1,  15,  16 },  /* 0x4F 'O' */
+    {  3537,  12,  15,   1,  15,  12 },  /* 0x50 'P' */
+    {  3627,  14,  18,   1,  15,  16 },  /* 0x51 'Q' */
+    {  3753,  14,  15,   1,  15,  14 },  /* 0x52 'R' */
+    {  3858,  12,  15,   1,  15,  13 },  /* 0x53 'S' */
+    {  3948,  14,  15,  -1,  15,  12 },  /* 0x54 'T' */
+    {  4053,  12,  15,   1,  15,  15 },  /* 0x55 'U' */
+    {  4143,  14,  15,   0,  15,  14 },  /* 0x56 'V' */
+    {  4248,  20,  15,   0,  15,  20 },  /* 0x57 'W' */
+    {  4398,  14,  15,   0,  15,  14 },  /* 0x58 'X' */
+    {  4503,  14,  15,  -1,  15,  12 },  /* 0x59 'Y' */
+    {  4608,  14,  15,   0,  15,  14 },  /* 0x5A 'Z' */
+    {  4713,   6,  18,   1,  15,   8 },  /* 0x5B '[' */
+    {  4767,   8,  16,   0,  15,   7 },  /* 0x5C */
+    {  4831,   6,  18,   1,  15,   8 },  /* 0x5D ']' */
+    {  4885,  14,   5,   2,  15,  17 },  /* 0x5E '^' */
+    {  4920,  12,   2,  -1,  -3,  10 },  /* 0x5F '_' */
+    {  4932,   6,   4,   1,  16,  10 },  /* 0x60 '`' */
+    {  4944,  10,  11,   1,  11,  12 },  /* 0x61 'a' */
+    {  4999,  12,  15,   1,  15,  13 },  /* 0x62 'b' */
+    {  5089,  10,  11,   1,  11,  11 },  /* 0x63 'c' */
+    {  5144,  10,  15,   1,  15,  13 },  /* 0x64 'd' */
+    {  5219,  12,  11,   1,  11,  12 },  /* 0x65 'e' */
+    {  5285,   8,  15,   0,  15,   7 },  /* 0x66 'f' */
+    {  5345,  10,  15,   1,  11,  13 },  /* 0x67 'g' */
+    {  5420,  10,  15,   1,  15,  13 },  /* 0x68 'h' */
+    {  5495,   4,  15,   1,  15,   6 },  /* 0x69 'i' */
+    {  5525,   6,  19,  -1,  15,   6 },  /* 0x6A 'j' */
+    {  5582,  12,  15,   1,  15,  12 },  /* 0x6B 'k' */
+    {  5672,   4,  15,   1,  15,   6 },  /* 0x6C 'l' */
+    {  5702,  18,  11,   1,  11,  19 },  /* 0x6D 'm' */
+    {  5801,  10,  11,   1,  11,  13 },  /* 0x6E 'n' */
+    {  5856,  12,  11,   1,  11,  12 },  /* 0x6F 'o' */
+    {  5922,  12,  15,   1,  11,  13 },  /* 0x70 'p' */
+    {  6012,  10,  15,   1,  11,  13 },  /* 0x71 'q' */
+    {  6087,   8,  11,   1,  11,   8 },  /* 0x72 'r' */
+    {  6131,  10,  11,   1,  11,  10 },  /* 0x73 's' */
+    {  6186,   8,  14,   0,  14,   8 },  /* 0x74 't' */
+    {  6242,  10,  11,   1,  11,  13 },  /* 0x75 'u' */
+    {  6297,  12,  11,   0,  11,  12 },  /* 0x76 'v' */
+    {  6363,  16,  11,   0,  11,  16 },  /* 0x77 'w' */
+    {  6451,  12,  11,   0,  11,  12 },  /* 0x78 'x' */
+    {  6517,  12,  15,   0,  11,  12 },  /* 0x79 'y' */
+    {  6607,  10,  11,   0,  11,  11 },  /* 0x7A 'z' */
+    {  6662,  10,  18,   2,  15,  13 },  /* 0x7B '{' */
+    {  6752,   4,  20,   2,  15,   7 },  /* 0x7C '|' */
+    {  6792,  10,  18,   2,  15,  13 },  /* 0x7D '}' */
+    {  6882,  14,   5,   2,   9,  17 },  /* 0x7E '~' */
+};
+
+static const aKERN Font20AA_Kern[146] =
+{
+    { 0x2D, 0x42,  -1 },  /* 0x2D '-' 0x42 'B' */
+    { 0x2D, 0x47,   1 },  /* 0x2D '-' 0x47 'G' */
+    { 0x2D, 0x4A,   1 },  /* 0x2D '-' 0x4A 'J' */
+    { 0x2D, 0x4F,   1 },  /* 0x2D '-' 0x4F 'O' */
+    { 0x2D, 0x51,   1 },  /* 0x2D '-' 0x51 'Q' */
+    { 0x2D, 0x54,  -2 },  /* 0x2D '-' 0x54 'T' */
+    { 0x2D, 0x56,  -1 },  /* 0x2D '-' 0x56 'V' */
+    { 0x2D, 0x57,  -1 },  /* 0x2D '-' 0x57 'W' */
+    { 0x2D, 0x58,  -1 },  /* 0x2D '-' 0x58 'X' */
+    { 0x2D, 0x59,  -2 },  /* 0x2D '-' 0x59 'Y' */
+    { 0x2D, 0x76,  -1 },  /* 0x2D '-' 0x76 'v' */
+    { 0x41, 0x41,   1 },  /* 0x41 'A' 0x41 'A' */
+    { 0x41, 0x54,  -2 },  /* 0x41 'A' 0x54 'T' */
+    { 0x41, 0x56,  -1 },  /* 0x41 'A' 0x56 'V' */
+    { 0x41, 0x57,  -1 },  /* 0x41 'A' 0x57 'W' */
+    { 0x41, 0x59,  -2 },  /* 0x41 'A' 0x59 'Y' */
+    { 0x41, 0x66,  -1 },  /* 0x41 'A' 0x66 'f' */
+    { 0x41, 0x76,  -1 },  /* 0x41 'A' 0x76 'v' */
+    { 0x41, 0x77,  -1 },  /* 0x41 'A' 0x77 'w' */
+    { 0x41, 0x79,  -1 },  /* 0x41 'A' 0x79 'y' */
+    { 0x42, 0x56,  -1 },  /* 0x42 'B' 0x56 'V' */
+    { 0x42, 0x57,  -1 },  /* 0x42 'B' 0x57 'W' */
+    { 0x42, 0x59,  -1 },  /* 0x42 'B' 0x59 'Y' */
+    { 0x44, 0x59,  -1 },  /* 0x44 'D' 0x59 'Y' */
+    { 0x46, 0x2E,  -3 },  /* 0x46 'F' 0x2E '.' */
+    { 0x46, 0x3A,  -2 },  /* 0x46 'F' 0x3A ':' */
+    { 0x46, 0x41,  -2 },  /* 0x46 'F' 0x41 'A' */
+    { 0x46, 0x61,  -2 },  /* 0x46 'F' 0x61 'a' */
+    { 0x46, 0x65,  -1 },  /* 0x46 'F' 0x65 'e' */
+    { 0x46, 0x69,  -1 },  /* 0x46 'F' 0x69 'i' */
+    { 0x46, 0x6F,  -1 },  /* 0x46 'F' 0x6F 'o' */
+    { 0x46, 0x72,  -1 },  /* 0x46 'F' 0x72 'r' */
+    { 0x46, 0x75,  -1 },  /* 0x46 'F' 0x75 'u' */
+    { 0x46, 0x79,  -2 },  /* 0x46 'F' 0x79 'y' */
+    { 0x47, 0x54,  -1 },  /* 0x47 'G' 0x54 'T' */
+    { 0x47, 0x59,  -1 },  /* 0x47 'G' 0x59 'Y' */
+    { 0x4A, 0x2D,  -1 },  /* 0x4A 'J' 0x2D '-' */
+    { 0x4B, 0x2D,  -2 },  /* 0x4B 'K' 0x2D '-' */
+    { 0x4B, 0x43,  -1 },  /* 0x4B 'K' 0x43 'C' */
+    { 0x4B, 0x4F,  -1 },  /* 0x4B 'K' 0x4F 'O' */
+    { 0x4B, 0x54,  -2 },  /* 0x4B 'K' 0x54 'T' */
+    { 0x4B, 0x55,  -1 },  /* 0x4B 'K' 0x55 'U' */
+    { 0x4B, 0x57,  -1 },  /* 0x4B 'K' 0x57 'W' */
+    { 0x4B, 0x59,  -1 },  /* 0x4B 'K' 0x59 'Y' */
+    { 0x4B, 0x65,  -1 },  /* 0x4B 'K' 0x65 'e' */
+    { 0x4B, 0x6F,  -1 },  /* 0x4B 'K' 0x6F 'o' */
+    { 0x4B, 0x75,  -1 },  /* 0x4B 'K' 0x75 'u' */
+    { 0x4B, 0x79,  -1 },  /* 0x4B 'K' 0x79 'y' */
+    { 0x4C, 0x4F,  -1 },  /* 0x4C 'L' 0x4F 'O' */
+    { 0x4C, 0x54,  -3 },  /* 0x4C 'L' 0x54 'T' */
+    { 0x4C, 0x55,  -1 },  /* 0x4C 'L' 0x55 'U' */
+    { 0x4C, 0x56,  -2 },  /* 0x4C 'L' 0x56 'V' */
+    { 0x4C, 0x57,  -2 },  /* 0x4C 'L' 0x57 'W' */
+    { 0x4C, 0x59,  -3 },  /* 0x4C 'L' 0x59 'Y' */
+    { 0x4C, 0x79,  -2 },  /* 0x4C 'L' 0x79 'y' */
+    { 0x4F, 0x2D,   1 },  /* 0x4F 'O' 0x2D '-' */
+    { 0x4F, 0x2E,  -1 },  /* 0x4F 'O' 0x2E '.' */
+    { 0x4F, 0x58,  -1 },  /* 0x4F 'O' 0x58 'X' */
+    { 0x4F, 0x59,  -1 },  /* 0x4F 'O' 0x59 'Y' */
+    { 0x50, 0x2E,  -3 },  /* 0x50 'P' 0x2E '.' */
+    { 0x50, 0x41,  -1 },  /* 0x50 'P' 0x41 'A' */
+    { 0x50, 0x61,  -1 },  /* 0x50 'P' 0x61 'a' */
+    { 0x50, 0x65,  -1 },  /* 0x50 'P' 0x65 'e' */
+    { 0x50, 0x6F,  -1 },  /* 0x50 'P' 0x6F 'o' */
+    { 0x51, 0x2D,   1 },  /* 0x51 'Q' 0x2D '-' */
+    { 0x52, 0x2D,  -1 },  /* 0x52 'R' 0x2D '-' */
+    { 0x52, 0x2E,  -1 },  /* 0x52 'R' 0x2E '.' */
+    { 0x52, 0x3A,  -1 },  /* 0x52 'R' 0x3A ':' */
+    { 0x52, 0x41,  -1 },  /* 0x52 'R' 0x41 'A' */
+    { 0x52, 0x43,  -1 },  /* 0x52 'R' 0x43 'C' */
+    { 0x52, 0x54,  -1 },  /* 0x52 'R' 0x54 'T' */
+    { 0x52, 0x56,  -1 },  /* 0x52 'R' 0x56 'V' */
+    { 0x52, 0x57,  -1 },  /* 0x52 'R' 0x57 'W' */
+    { 0x52, 0x59,  -1 },  /* 0x52 'R' 0x59 'Y' */
+    { 0x52, 0x65,  -1 },  /* 0x52 'R' 0x65 'e' */
+    { 0x52, 0x6F,  -1 },  /* 0x52 'R' 0x6F 'o' */
+    { 0x52, 0x75,  -1 },  /* 0x52 'R' 0x75 'u' */
+    { 0x52, 0x79,  -1 },  /* 0x52 'R' 0x79 'y' */
+    { 0x54, 0x2D,  -2 },  /* 0x54 'T' 0x2D '-' */
+    { 0x54, 0x2E,  -2 },  /* 0x54 'T' 0x2E '.' */
+    { 0x54, 0x3A,  -2 },  /* 0x54 'T' 0x3A ':' */
+    { 0x54, 0x41,  -2 },  /* 0x54 'T' 0x41 'A' */
+    { 0x54, 0x43,  -1 },  /* 0x54 'T' 0x43 'C' */
+    { 0x54, 0x61,  -3 },  /* 0x54 'T' 0x61 'a' */
+    { 0x54, 0x63,  -3 },  /* 0x54 'T' 0x63 'c' */
+    { 0x54, 0x65,  -3 },  /* 0x54 'T' 0x65 'e' */
+    { 0x54, 0x69,  -1 },  /* 0x54 'T' 0x69 'i' */
+    { 0x54, 0x6F,  -3 },  /* 0x54 'T' 0x6F 'o' */
+    { 0x54, 0x72,  -3 },  /* 0x54 'T' 0x72 'r' */
+    { 0x54, 0x73,  -3 },  /* 0x54 'T' 0x73 's' */
+    { 0x54, 0x75,  -3 },  /* 0x54 'T' 0x75 'u' */
+    { 0x54, 0x77,  -3 },  /* 0x54 'T' 0x77 'w' */
+    { 0x54, 0x79,  -3 },  /* 0x54 'T' 0x79 'y' */
+    { 0x56, 0x2D,  -1 },  /* 0x56 'V' 0x2D '-' */
+    { 0x56, 0x2E,  -3 },  /* 0x56 'V' 0x2E '.' */
+    { 0x56, 0x3A,  -2 },  /* 0x56 'V' 0x3A ':' */
+    { 0x56, 0x41,  -1 },  /* 0x56 'V' 0x41 'A' */
+    { 0x56, 0x61,  -2 },  /* 0x56 'V' 0x61 'a' */
+    { 0x56, 0x65,  -2 },  /* 0x56 'V' 0x65 'e' */
+    { 0x56, 0x6F,  -2 },  /* 0x56 'V' 0x6F 'o' */
+    { 0x56, 0x75,  -1 },  /* 0x56 'V' 0x75 'u' */
+    { 0x56, 0x79,  -1 },  /* 0x56 'V' 0x79 'y' */
+    { 0x57, 0x2D,  -1 },  /* 0x57 'W' 0x2D '-' */
+    { 0x57, 0x2E,  -2 },  /* 0x57 'W' 0x2E '.' */
+    { 0x57, 0x3A,  -1 },  /* 0x57 'W' 0x3A ':' */
+    { 0x57, 0x41,  -1 },  /* 0x57 'W' 0x41 'A' */
+    { 0x57, 0x61,  -1 },  /* 0x57 'W' 0x61 'a' */
+    { 0x57, 0x65,  -1 },  /* 0x57 'W' 0x65 'e' */
+    { 0x57, 0x6F,  -1 },  /* 0x57 'W' 0x6F 'o' */
+    { 0x57, 0x72,  -1 },  /* 0x57 'W' 0x72 'r' */
+    { 0x57, 0x75,  -1 },  /* 0x57 'W' 0x75 'u' */
+    { 0x58, 0x2D,  -1 },  /* 0x58 'X' 0x2D '-' */
+    { 0x58, 0x43,  -1 },  /* 0x58 'X' 0x43 'C' */
+    { 0x58, 0x4F,  -1 },  /* 0x58 'X' 0x4F 'O' */
+    { 0x58, 0x65,  -1 },  /* 0x58 'X' 0x65 'e' */
+    { 0x59, 0x2D,  -2 },  /* 0x59 'Y' 0x2D '-' */
+    { 0x59, 0x2E,  -4 },  /* 0x59 'Y' 0x2E '.' */
+    { 0x59, 0x3A,  -3 },  /* 0x59 'Y' 0x3A ':' */
+    { 0x59, 0x41,  -2 },  /* 0x59 'Y' 0x41 'A' */
+    { 0x59, 0x43,  -1 },  /* 0x59 'Y' 0x43 'C' */
+    { 0x59, 0x4F,  -1 },  /* 0x59 'Y' 0x4F 'O' */
+    { 0x59, 0x61,  -3 },  /* 0x59 'Y' 0x61 'a' */
+    { 0x59, 0x65,  -3 },  /* 0x59 'Y' 0x65 'e' */
+    { 0x59, 0x69,  -1 },  /* 0x59 'Y' 0x69 'i' */
+    { 0x59, 0x6F,  -3 },  /* 0x59 'Y' 0x6F 'o' */
+    { 0x59, 0x75,  -2 },  /* 0x59 'Y' 0x75 'u' */
+    { 0x66, 0x2D,  -1 },  /* 0x66 'f' 0x2D '-' */
+    { 0x66, 0x2E,  -1 },  /* 0x66 'f' 0x2E '.' */
+    { 0x66, 0x3A,  -1 },  /* 0x66 'f' 0x3A ':' */
+    { 0x6B, 0x65,  -1 },  /* 0x6B 'k' 0x65 'e' */
+    { 0x6B, 0x6F,  -1 },  /* 0x6B 'k' 0x6F 'o' */
+    { 0x6B, 0x75,  -1 },  /* 0x6B 'k' 0x75 'u' */
+    { 0x6B, 0x79,  -1 },  /* 0x6B 'k' 0x79 'y' */
+    { 0x6F, 0x78,  -1 },  /* 0x6F 'o' 0x78 'x' */
+    { 0x72, 0x2D,  -1 },  /* 0x72 'r' 0x2D '-' */
+    { 0x72, 0x2E,  -2 },  /* 0x72 'r' 0x2E '.' */
+    { 0x72, 0x78,  -1 },  /* 0x72 'r' 0x78 'x' */
+    { 0x76, 0x2D,  -1 },  /* 0x76 'v' 0x2D '-' */
+    { 0x76, 0x2E,  -2 },  /* 0x76 'v' 0x2E '.' */
+    { 0x76, 0x3A,  -1 },  /* 0x76 'v' 0x3A ':' */
+    { 0x77, 0x2E,  -2 },  /* 0x77 'w' 0x2E '.' */
+    { 0x77, 0x3A,  -1 },  /* 0x77 'w' 0x3A ':' */
+    { 0x78, 0x65,  -1 },  /* 0x78 'x' 0x65 'e' */
+    { 0x78, 0x6F,  -1 },  /* 0x78 'x' 0x6F 'o' */
+    { 0x79, 0x2E,  -3 },  /* 0x79 'y' 0x2E '.' */
+    { 0x79, 0x3A,  -1 },  /* 0x79 'y' 0x3A ':' */
+};
+
+const aFONT Font20AA =
+{
+    Font20AA_Bitmap,
+    Font20AA_Glyph,
+    NULL,
+    0x20,         /* first */
+    95,           /* count */
+    4,            /* bpp */
+    24,           /* height */
+    19,           /* ascent */
+    Font20AA_Kern,
+    146,          /* kern_count */
+};
@@ -0,0 +1,1864 @@
+/*
+ * font20AAX.c
+ * DejaVu Sans Book 20 px, A4, 0xA0-0xFF, 0x2022, 0x2026, 0x20AC, ...
+ *
+ * Generated by Tools/font_conv, do not edit:
+ *   font_conv -s 20 -b 4 -r 0xA0-0xFF -r 0x2022 -r 0x2026 -r 0x20AC -r 0x2190-0x2193 -r 0x2713 -r 0x2717 -n Font20AAX DejaVuSans.ttf
+ */
+
+#include "fonts_aa.h"
+
+static const uint8_t Font20AAX_Bitmap[8735] =
+{
+    /* 0xA1 2x15 */
+    0xFF,
+    0xFF,
+    0x00,
+    0x00,
+    0xDC,
+    0xDD,
+    0xEE,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    0xFF,
+    /* 0xA2 10x17 */
+    0x00, 0x00, 0x60, 0x09, 0x00,
+    0x00, 0x00, 0x60, 0x09, 0x00,
+    0x00, 0x00, 0x60, 0x09, 0x00,
+    0x00, 0x70, 0xFC, 0xCF, 0x07,
+    0x10, 0xFC, 0xFF, 0xFF, 0x5F,
+    0x90, 0xEF, 0x76, 0x3A, 0x59,
+    0xF1, 0x3F, 0x60, 0x09, 0x00,
+    0xF4, 0x0B, 0x60, 0x09, 0x00,
+    0xF4, 0x09, 0x60, 0x09, 0x00,
+    0xF4, 0x0B, 0x60, 0x09, 0x00,
+    0xF1, 0x2F, 0x60, 0x09, 0x00,
+    0x90, 0xEF, 0x75, 0x3A, 0x59,
+    0x10, 0xFC, 0xFF, 0xFF, 0x5F,
+    0x00, 0x70, 0xFC, 0xCF, 0x07,
+    0x00, 0x00, 0x60, 0x09, 0x00,
+    0x00, 0x00, 0x60, 0x09, 0x00,
+    0x00, 0x00, 0x60, 0x09, 0x00,
+    /* 0xA3 10x15 */
+    0x00, 0x00, 0xC7, 0xEF, 0x29,
+    0x00, 0x80, 0xFF, 0xFF, 0xCF,
+    0x00, 0xF1, 0x6F, 0x11, 0x95,
+    0x00, 0xF5, 0x0B, 0x00, 0x00,
+    0x00, 0xF6, 0x08, 0x00, 0x00,
+    0x00, 0xF7, 0x08, 0x00, 0x00,
+    0x00, 0xF7, 0x08, 0x00, 0x00,
+    0xF6, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF6, 0xFF, 0xFF, 0xFF, 0x05,
+    0x00, 0xF7, 0x08, 0x00, 0x00,
+    0x00, 0xF7, 0x08, 0x00, 0x00,
+    0x00, 0xF7, 0x08, 0x00, 0x00,
+    0x00, 0xF7, 0x08, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xFF, 0xEF,
+    0xFB, 0xFF, 0xFF, 0xFF, 0xEF,
+    /* 0xA4 12x11 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x80, 0x09, 0x00, 0x00, 0x10, 0x6B,
+    0x80, 0x9F, 0xC5, 0xBE, 0xC4, 0x4F,
+    0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0xF4, 0x2A, 0x31, 0xEC, 0x01,
+    0x00, 0xDA, 0x00, 0x00, 0xF2, 0x07,
+    0x00, 0xDA, 0x00, 0x00, 0xF2, 0x06,
+    0x00, 0xF4, 0x2A, 0x31, 0xEC, 0x01,
+    0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x06,
+    0x80, 0x9F, 0xC5, 0xBE, 0xB3, 0x4F,
+    0x90, 0x08, 0x00, 0x00, 0x10, 0x5A,
+    /* 0xA5 12x15 */
+    0xE1, 0x0D, 0x00, 0x00, 0x30, 0xAF,
+    0x70, 0x7F, 0x00, 0x00, 0xB0, 0x2F,
+    0x00, 0xED, 0x01, 0x00, 0xF4, 0x09,
+    0x00, 0xF6, 0x08, 0x00, 0xFC, 0x02,
+    0x00, 0xD0, 0x1E, 0x50, 0x9F, 0x00,
+    0x00, 0x60, 0x9F, 0xD0, 0x1E, 0x00,
+    0xA0, 0xFF, 0xFF, 0xF8, 0xFF, 0x6F,
+    0x00, 0x00, 0xF3, 0xDF, 0x00, 0x00,
+    0x00, 0x00, 0xA0, 0x6F, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x90, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x90, 0x5F, 0x00, 0x00,
+    /* 0xA6 4x17 */
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0x00, 0x00,
+    0x00, 0x00,
+    0x00, 0x00,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    0xF7, 0x03,
+    /* 0xA7 10x17 */
+    0x00, 0xB3, 0xFE, 0xFF, 0x01,
+    0x20, 0xFE, 0xFF, 0xFF, 0x01,
+    0x60, 0xBF, 0x02, 0x00, 0x00,
+    0x50, 0x7F, 0x00, 0x00, 0x00,
+    0x00, 0xFB, 0x19, 0x00, 0x00,
+    0x20, 0xDD, 0xEF, 0x07, 0x00,
+    0xB0, 0x1D, 0xC3, 0xBF, 0x01,
+    0xF1, 0x08, 0x00, 0xF8, 0x0A,
+    0xF0, 0x0C, 0x00, 0xB0, 0x0F,
+    0x80, 0xAF, 0x01, 0x90, 0x0F,
+    0x00, 0xF9, 0x6E, 0xE3, 0x09,
+    0x00, 0x40, 0xFD, 0xAF, 0x01,
+    0x00, 0x00, 0x60, 0xDE, 0x01,
+    0x00, 0x00, 0x00, 0xF7, 0x05,
+    0x00, 0x00, 0x20, 0xFB, 0x05,
+    0x50, 0xFF, 0xFF, 0xDF, 0x01,
+    0x50, 0xFF, 0xEF, 0x2A, 0x00,
+    /* 0xA8 6x2 */
+    0xFE, 0x11, 0xEF,
+    0xFE, 0x11, 0xEF,
+    /* 0xA9 16x15 */
+    0x00, 0x00, 0x81, 0xEC, 0xCE, 0x18, 0x00, 0x00,
+    0x00, 0x50, 0x8E, 0x13, 0x31, 0xE8, 0x05, 0x00,
+    0x00, 0xD5, 0x03, 0x00, 0x00, 0x30, 0x5D, 0x00,
+    0x20, 0x2E, 0x40, 0xEB, 0xBF, 0x04, 0xE2, 0x02,
+    0x90, 0x07, 0xF5, 0x2A, 0x41, 0x0A, 0x80, 0x09,
+    0xE0, 0x01, 0xCE, 0x00, 0x00, 0x00, 0x10, 0x0E,
+    0xD2, 0x30, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x2D,
+    0xB3, 0x40, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x3C,
+    0xC2, 0x30, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x2D,
+    0xE0, 0x01, 0xCE, 0x00, 0x00, 0x00, 0x10, 0x0E,
+    0xA0, 0x07, 0xF5, 0x2A, 0x31, 0x09, 0x70, 0x09,
+    0x20, 0x3E, 0x40, 0xEB, 0xBE, 0x04, 0xE2, 0x02,
+    0x00, 0xD5, 0x03, 0x00, 0x00, 0x30, 0x5D, 0x00,
+    0x00, 0x50, 0x8E, 0x13, 0x31, 0xE8, 0x05, 0x00,
+    0x00, 0x00, 0x81, 0xEC, 0xCE, 0x18, 0x00, 0x00,
+    /* 0xAA 8x10 */
+    0xF4, 0xFF, 0x8D, 0x01,
+    0x00, 0x00, 0xD3, 0x09,
+    0x00, 0x00, 0x70, 0x0E,
+    0x80, 0xED, 0xFF, 0x1F,
+    0xE9, 0x14, 0x60, 0x1F,
+    0x9C, 0x00, 0xA0, 0x1F,
+    0xDA, 0x13, 0xF6, 0x1F,
+    0xA2, 0xEE, 0x7A, 0x1F,
+    0x00, 0x00, 0x00, 0x00,
+    0xFA, 0xFF, 0xFF, 0x1F,
+    /* 0xAB 10x9 */
+    0x00, 0x00, 0x27, 0x00, 0x54,
+    0x00, 0x80, 0x2F, 0x50, 0x5F,
+    0x00, 0xFA, 0x07, 0xF7, 0x0A,
+    0xB1, 0x5F, 0x80, 0x8F, 0x00,
+    0xF7, 0x07, 0xF3, 0x0B, 0x00,
+    0xB1, 0x5F, 0x80, 0x8F, 0x00,
+    0x00, 0xFA, 0x06, 0xF7, 0x0A,
+    0x00, 0x80, 0x2F, 0x50, 0x5F,
+    0x00, 0x00, 0x27, 0x00, 0x54,
+    /* 0xAC 14x6 */
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0A,
+    /* 0xAD 8x2 */
+    0xF0, 0xFF, 0xFF, 0x04,
+    0xF0, 0xFF, 0xFF, 0x04,
+    /* 0xAE 16x15 */
+    0x00, 0x00, 0x81, 0xEC, 0xCE, 0x18, 0x00, 0x00,
+    0x00, 0x50, 0x8E, 0x13, 0x31, 0xE8, 0x05, 0x00,
+    0x00, 0xD5, 0x03, 0x00, 0x00, 0x30, 0x5D, 0x00,
+    0x20, 0x2E, 0xF0, 0xFF, 0xBE, 0x03, 0xE2, 0x02,
+    0x90, 0x07, 0xF0, 0x08, 0xB1, 0x1E, 0x80, 0x09,
+    0xE0, 0x01, 0xF0, 0x08, 0x60, 0x3F, 0x10, 0x0E,
+    0xD2, 0x00, 0xF0, 0x08, 0xA1, 0x1E, 0x00, 0x2D,
+    0xB3, 0x00, 0xF0, 0xFF, 0xCF, 0x03, 0x00, 0x3C,
+    0xC2, 0x00, 0xF0, 0x18, 0xDB, 0x01, 0x00, 0x2D,
+    0xE0, 0x01, 0xF0, 0x08, 0xF2, 0x09, 0x10, 0x0E,
+    0xA0, 0x07, 0xF0, 0x08, 0x80, 0x2F, 0x70, 0x09,
+    0x20, 0x3E, 0xF0, 0x08, 0x10, 0xAE, 0xE2, 0x02,
+    0x00, 0xD5, 0x03, 0x00, 0x00, 0x30, 0x5D, 0x00,
+    0x00, 0x50, 0x8E, 0x13, 0x31, 0xE8, 0x05, 0x00,
+    0x00, 0x00, 0x81, 0xEC, 0xCE, 0x18, 0x00, 0x00,
+    /* 0xAF 6x2 */
+    0xFE, 0xFF, 0xEF,
+    0xFE, 0xFF, 0xEF,
+    /* 0xB0 8x6 */
+    0x10, 0xE9, 0x8E, 0x01,
+    0x90, 0x2C, 0xC2, 0x09,
+    0xF0, 0x04, 0x40, 0x0F,
+    0xF0, 0x04, 0x40, 0x0F,
+    0xA0, 0x2C, 0xC2, 0x09,
+    0x10, 0xE9, 0x9E, 0x01,
+    /* 0xB1 14x13 */
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x3F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    /* 0xB2 8x8 */
+    0x40, 0xEB, 0x8D, 0x00,
+    0xB0, 0x13, 0xF5, 0x07,
+    0x00, 0x00, 0xD0, 0x09,
+    0x00, 0x00, 0xF6, 0x03,
+    0x00, 0x50, 0x6F, 0x00,
+    0x00, 0xE6, 0x06, 0x00,
+    0x70, 0x4E, 0x00, 0x00,
+    0xF1, 0xFF, 0xFF, 0x0C,
+    /* 0xB3 8x8 */
+    0xC0, 0xFF, 0xAE, 0x02,
+    0x00, 0x00, 0xD2, 0x0A,
+    0x00, 0x00, 0xD2, 0x09,
+    0x00, 0xF7, 0xBF, 0x01,
+    0x00, 0x00, 0xD3, 0x0A,
+    0x00, 0x00, 0x80, 0x0E,
+    0x00, 0x00, 0xD3, 0x0B,
+    0xF1, 0xFF, 0x9D, 0x01,
+    /* 0xB4 6x4 */
+    0x00, 0xE1, 0x1D,
+    0x00, 0xEA, 0x02,
+    0x50, 0x5F, 0x00,
+    0xE2, 0x08, 0x00,
+    /* 0xB5 12x15 */
+    0xF4, 0x08, 0x00, 0x00, 0xDE, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0xDE, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0xDE, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0xDE, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0xDE, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0xDE, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0xDF, 0x00,
+    0xF4, 0x0A, 0x00, 0x30, 0xDF, 0x00,
+    0xF4, 0x7F, 0x11, 0xD4, 0xEF, 0x01,
+    0xF4, 0xFB, 0xFF, 0xDF, 0xFB, 0x4F,
+    0xF4, 0x68, 0xED, 0x2B, 0xE4, 0x2C,
+    0xF4, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0x00, 0x00,
+    /* 0xB6 10x17 */
+    0x00, 0xB5, 0xFE, 0xFF, 0x8F,
+    0x70, 0xFF, 0xFF, 0x05, 0x8C,
+    0xF2, 0xFF, 0xFF, 0x05, 0x8C,
+    0xF6, 0xFF, 0xFF, 0x05, 0x8C,
+    0xF6, 0xFF, 0xFF, 0x05, 0x8C,
+    0xF4, 0xFF, 0xFF, 0x05, 0x8C,
+    0xC0, 0xFF, 0xFF, 0x05, 0x8C,
+    0x10, 0xF9, 0xFF, 0x05, 0x8C,
+    0x00, 0x10, 0xF5, 0x05, 0x8C,
+    0x00, 0x00, 0xF1, 0x05, 0x8C,
+    0x00, 0x00, 0xF1, 0x05, 0x8C,
+    0x00, 0x00, 0xF1, 0x05, 0x8C,
+    0x00, 0x00, 0xF1, 0x05, 0x8C,
+    0x00, 0x00, 0xF1, 0x05, 0x8C,
+    0x00, 0x00, 0xF1, 0x05, 0x8C,
+    0x00, 0x00, 0xF1, 0x05, 0x8C,
+    0x00, 0x00, 0xF1, 0x05, 0x8C,
+    /* 0xB7 4x2 */
+    0xFD, 0x03,
+    0xFD, 0x03,
+    /* 0xB8 6x4 */
+    0x00, 0xE2, 0x03,
+    0x00, 0x90, 0x0B,
+    0x00, 0xA0, 0x0C,
+    0xE2, 0xDF, 0x04,
+    /* 0xB9 6x8 */
+    0xFA, 0xEF, 0x00,
+    0x00, 0xE7, 0x00,
+    0x00, 0xE7, 0x00,
+    0x00, 0xE7, 0x00,
+    0x00, 0xE7, 0x00,
+    0x00, 0xE7, 0x00,
+    0x00, 0xE7, 0x00,
+    0xF7, 0xFF, 0xEF,
+    /* 0xBA 10x10 */
+    0x00, 0xC5, 0xEF, 0x19, 0x00,
+    0x50, 0x7F, 0x31, 0xBD, 0x00,
+    0xD0, 0x0B, 0x00, 0xF5, 0x04,
+    0xF0, 0x08, 0x00, 0xF1, 0x07,
+    0xF0, 0x08, 0x00, 0xF1, 0x07,
+    0xD0, 0x0B, 0x00, 0xF5, 0x04,
+    0x50, 0x7F, 0x31, 0xCD, 0x00,
+    0x00, 0xC5, 0xEF, 0x19, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xA0, 0xFF, 0xFF, 0xFF, 0x01,
+    /* 0xBB 10x9 */
+    0x72, 0x00, 0x80, 0x00, 0x00,
+    0xF1, 0x08, 0xD0, 0x1B, 0x00,
+    0x60, 0xAF, 0x40, 0xCE, 0x01,
+    0x00, 0xF5, 0x1B, 0xD3, 0x2D,
+    0x00, 0x70, 0x7F, 0x30, 0xAF,
+    0x00, 0xF5, 0x1B, 0xD3, 0x2D,
+    0x60, 0xAF, 0x40, 0xCE, 0x02,
+    0xF1, 0x08, 0xD0, 0x1B, 0x00,
+    0x72, 0x00, 0x80, 0x00, 0x00,
+    /* 0xBC 18x15 */
+    0xFA, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0x00, 0x70, 0x2F, 0x00, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0x00, 0xE2, 0x07, 0x00, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0x40, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0xD0, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0xE7, 0x02, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xEF, 0x20, 0x7E, 0x00, 0x00, 0xF9, 0x06,
+    0x00, 0x00, 0x00, 0xB0, 0x0D, 0x00, 0x60, 0xFB, 0x06,
+    0x00, 0x00, 0x00, 0xF5, 0x04, 0x00, 0xD3, 0xF1, 0x06,
+    0x00, 0x00, 0x10, 0xAD, 0x00, 0x10, 0x3D, 0xF0, 0x06,
+    0x00, 0x00, 0x80, 0x1E, 0x00, 0xB0, 0x06, 0xF0, 0x06,
+    0x00, 0x00, 0xF2, 0x07, 0x00, 0xF0, 0xFF, 0xFF, 0xBF,
+    0x00, 0x00, 0xCB, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x06,
+    0x00, 0x50, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x06,
+    /* 0xBD 18x15 */
+    0xFA, 0xEF, 0x00, 0x00, 0x00, 0x00, 0xBC, 0x00, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0x00, 0x70, 0x2F, 0x00, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0x00, 0xE2, 0x07, 0x00, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0x40, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0xD0, 0x0A, 0x00, 0x00, 0x00,
+    0x00, 0xE7, 0x00, 0x00, 0xE7, 0x02, 0x00, 0x00, 0x00,
+    0xF7, 0xFF, 0xEF, 0x20, 0x7E, 0x20, 0xE9, 0xBE, 0x02,
+    0x00, 0x00, 0x00, 0xB0, 0x0D, 0x80, 0x15, 0xC2, 0x0D,
+    0x00, 0x00, 0x00, 0xF5, 0x04, 0x00, 0x00, 0x80, 0x0F,
+    0x00, 0x00, 0x10, 0xAD, 0x00, 0x00, 0x00, 0xE2, 0x08,
+    0x00, 0x00, 0x80, 0x1E, 0x00, 0x00, 0x10, 0xBD, 0x00,
+    0x00, 0x00, 0xF2, 0x07, 0x00, 0x00, 0xD2, 0x0A, 0x00,
+    0x00, 0x00, 0xCB, 0x00, 0x00, 0x30, 0x8E, 0x00, 0x00,
+    0x00, 0x50, 0x3F, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x2F,
+    /* 0xBE 20x15 */
+    0xC0, 0xFF, 0xAE, 0x02, 0x00, 0x00, 0xC0, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0xD2, 0x0A, 0x00, 0x00, 0xF7, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xD2, 0x09, 0x00, 0x20, 0x7E, 0x00, 0x00, 0x00,
+    0x00, 0xF7, 0xBF, 0x01, 0x00, 0xA0, 0x0D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD3, 0x0A, 0x00, 0xF4, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x0E, 0x00, 0xAD, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xD3, 0x0B, 0x70, 0x2E, 0x00, 0x00, 0x00, 0x00,
+    0xF1, 0xFF, 0x9D, 0x01, 0xE2, 0x07, 0x00, 0x90, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xDB, 0x00, 0x00, 0xB6, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0x50, 0x4F, 0x00, 0x30, 0x1D, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0xD1, 0x0A, 0x00, 0xD1, 0x03, 0x6F, 0x00,
+    0x00, 0x00, 0x00, 0xE8, 0x01, 0x00, 0x6B, 0x00, 0x6F, 0x00,
+    0x00, 0x00, 0x20, 0x7F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0B,
+    0x00, 0x00, 0xB0, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00,
+    0x00, 0x00, 0xF5, 0x03, 0x00, 0x00, 0x00, 0x00, 0x6F, 0x00,
+    /* 0xBF 10x15 */
+    0x00, 0x30, 0xCF, 0x00, 0x00,
+    0x00, 0x30, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xBF, 0x00, 0x00,
+    0x00, 0x20, 0xBF, 0x00, 0x00,
+    0x00, 0x30, 0xAF, 0x00, 0x00,
+    0x00, 0x90, 0x7F, 0x00, 0x00,
+    0x00, 0xF6, 0x1D, 0x00, 0x00,
+    0x50, 0xEF, 0x02, 0x00, 0x00,
+    0xE2, 0x3E, 0x00, 0x00, 0x00,
+    0xF7, 0x08, 0x00, 0x00, 0x00,
+    0xF9, 0x07, 0x00, 0x00, 0x00,
+    0xF6, 0x4E, 0x21, 0xB5, 0x03,
+    0xD1, 0xFF, 0xFF, 0xFF, 0x03,
+    0x10, 0xE9, 0xDF, 0x4A, 0x00,
+    /* 0xC0 14x19 */
+    0x00, 0x00, 0xF3, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDA, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFB, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xA6, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x51, 0x9F, 0x00, 0x00,
+    0x00, 0x50, 0xAF, 0x10, 0xEE, 0x01, 0x00,
+    0x00, 0xA0, 0x5F, 0x00, 0xFA, 0x05, 0x00,
+    0x00, 0xF1, 0x1E, 0x00, 0xF5, 0x0B, 0x00,
+    0x00, 0xF7, 0x0A, 0x00, 0xE1, 0x2F, 0x00,
+    0x00, 0xFC, 0x05, 0x00, 0xA0, 0x7F, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xE0, 0x5F, 0x00, 0x00, 0x00, 0xFA, 0x09,
+    0xF4, 0x0D, 0x00, 0x00, 0x00, 0xF3, 0x0E,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x5F,
+    /* 0xC1 14x19 */
+    0x00, 0x00, 0x00, 0xD1, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE9, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFB, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xA6, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x51, 0x9F, 0x00, 0x00,
+    0x00, 0x50, 0xAF, 0x10, 0xEE, 0x01, 0x00,
+    0x00, 0xA0, 0x5F, 0x00, 0xFA, 0x05, 0x00,
+    0x00, 0xF1, 0x1E, 0x00, 0xF5, 0x0B, 0x00,
+    0x00, 0xF7, 0x0A, 0x00, 0xE1, 0x2F, 0x00,
+    0x00, 0xFC, 0x05, 0x00, 0xA0, 0x7F, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xE0, 0x5F, 0x00, 0x00, 0x00, 0xFA, 0x09,
+    0xF4, 0x0D, 0x00, 0x00, 0x00, 0xF3, 0x0E,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x5F,
+    /* 0xC2 14x19 */
+    0x00, 0x00, 0x60, 0xEF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xE2, 0xB7, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x9C, 0x10, 0x7D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFB, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xA6, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x51, 0x9F, 0x00, 0x00,
+    0x00, 0x50, 0xAF, 0x10, 0xEE, 0x01, 0x00,
+    0x00, 0xA0, 0x5F, 0x00, 0xFA, 0x05, 0x00,
+    0x00, 0xF1, 0x1E, 0x00, 0xF5, 0x0B, 0x00,
+    0x00, 0xF7, 0x0A, 0x00, 0xE1, 0x2F, 0x00,
+    0x00, 0xFC, 0x05, 0x00, 0xA0, 0x7F, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xE0, 0x5F, 0x00, 0x00, 0x00, 0xFA, 0x09,
+    0xF4, 0x0D, 0x00, 0x00, 0x00, 0xF3, 0x0E,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x5F,
+    /* 0xC3 14x18 */
+    0x00, 0x00, 0xEA, 0x3B, 0xE5, 0x00, 0x00,
+    0x00, 0x40, 0x2E, 0xD6, 0x6E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFB, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xA6, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x51, 0x9F, 0x00, 0x00,
+    0x00, 0x50, 0xAF, 0x10, 0xEE, 0x01, 0x00,
+    0x00, 0xA0, 0x5F, 0x00, 0xFA, 0x05, 0x00,
+    0x00, 0xF1, 0x1E, 0x00, 0xF5, 0x0B, 0x00,
+    0x00, 0xF7, 0x0A, 0x00, 0xE1, 0x2F, 0x00,
+    0x00, 0xFC, 0x05, 0x00, 0xA0, 0x7F, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xE0, 0x5F, 0x00, 0x00, 0x00, 0xFA, 0x09,
+    0xF4, 0x0D, 0x00, 0x00, 0x00, 0xF3, 0x0E,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x5F,
+    /* 0xC4 14x19 */
+    0x00, 0x10, 0xEF, 0x40, 0xBF, 0x00, 0x00,
+    0x00, 0x10, 0xEF, 0x40, 0xBF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0xFF, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0xFB, 0x0D, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xA6, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xFE, 0x51, 0x9F, 0x00, 0x00,
+    0x00, 0x50, 0xAF, 0x10, 0xEE, 0x01, 0x00,
+    0x00, 0xA0, 0x5F, 0x00, 0xFA, 0x05, 0x00,
+    0x00, 0xF1, 0x1E, 0x00, 0xF5, 0x0B, 0x00,
+    0x00, 0xF7, 0x0A, 0x00, 0xE1, 0x2F, 0x00,
+    0x00, 0xFC, 0x05, 0x00, 0xA0, 0x7F, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xE0, 0x5F, 0x00, 0x00, 0x00, 0xFA, 0x09,
+    0xF4, 0x0D, 0x00, 0x00, 0x00, 0xF3, 0x0E,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x5F,
+    /* 0xC5 14x19 */
+    0x00, 0x00, 0x91, 0xDE, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0xB8, 0x31, 0x3E, 0x00, 0x00,
+    0x00, 0x00, 0x6C, 0x00, 0x7B, 0x00, 0x00,
+    0x00, 0x00, 0xBA, 0x31, 0x5E, 0x00, 0x00,
+    0x00, 0x00, 0xD2, 0xFF, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0xFF, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0xEA, 0x0E, 0x00, 0x00,
+    0x00, 0x00, 0xF9, 0xA5, 0x5F, 0x00, 0x00,
+    0x00, 0x10, 0xEE, 0x51, 0xAF, 0x00, 0x00,
+    0x00, 0x50, 0xAF, 0x00, 0xFE, 0x01, 0x00,
+    0x00, 0xB0, 0x5F, 0x00, 0xFA, 0x06, 0x00,
+    0x00, 0xF1, 0x1F, 0x00, 0xF5, 0x0C, 0x00,
+    0x00, 0xF7, 0x0A, 0x00, 0xE1, 0x2F, 0x00,
+    0x00, 0xFC, 0x05, 0x00, 0xA0, 0x7F, 0x00,
+    0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xE0, 0x5F, 0x00, 0x00, 0x00, 0xFA, 0x09,
+    0xF4, 0x0D, 0x00, 0x00, 0x00, 0xF3, 0x0E,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x5F,
+    /* 0xC6 20x15 */
+    0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
+    0x00, 0x00, 0xC0, 0x5F, 0xF3, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0x0E, 0xF3, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xFA, 0x08, 0xF3, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFF, 0x02, 0xF3, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x70, 0xBF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0xD0, 0x5F, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xBF, 0x00,
+    0x00, 0xF4, 0x0E, 0x00, 0xF3, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFA, 0x08, 0x00, 0xF3, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xD0, 0x6F, 0x00, 0x00, 0xF3, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xF5, 0x0D, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xFB, 0x05, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    /* 0xC7 12x19 */
+    0x00, 0x20, 0xC8, 0xFE, 0xBD, 0x27,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x50, 0xFF, 0x4A, 0x01, 0x32, 0xB8,
+    0xE1, 0x8F, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0x03, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x00,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0x00,
+    0xE1, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0x50, 0xFF, 0x4A, 0x01, 0x32, 0xB8,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xDF,
+    0x00, 0x20, 0xC8, 0xFE, 0xBD, 0x27,
+    0x00, 0x00, 0x00, 0xE2, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0xA0, 0x0A, 0x00,
+    0x00, 0x00, 0x00, 0xB1, 0x0B, 0x00,
+    0x00, 0x00, 0xE3, 0xDF, 0x04, 0x00,
+    /* 0xC8 12x19 */
+    0x00, 0x70, 0x5F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xDB, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xD1, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    /* 0xC9 12x19 */
+    0x00, 0x00, 0x40, 0x8F, 0x00, 0x00,
+    0x00, 0x00, 0xD0, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0xE8, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    /* 0xCA 12x19 */
+    0x00, 0x00, 0xFB, 0x0C, 0x00, 0x00,
+    0x00, 0x60, 0x5E, 0x7E, 0x00, 0x00,
+    0x00, 0xE2, 0x05, 0xE4, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    /* 0xCB 12x19 */
+    0x00, 0xF5, 0x09, 0xF8, 0x07, 0x00,
+    0x00, 0xF5, 0x09, 0xF8, 0x07, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xDF, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x05,
+    /* 0xCC 6x19 */
+    0xE2, 0x0B, 0x00,
+    0x50, 0x5F, 0x00,
+    0x00, 0xE8, 0x01,
+    0x00, 0x00, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    /* 0xCD 6x19 */
+    0x00, 0xDC, 0x01,
+    0x70, 0x3F, 0x00,
+    0xE2, 0x07, 0x00,
+    0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    0xF0, 0x0E, 0x00,
+    /* 0xCE 8x19 */
+    0x00, 0xF5, 0x3F, 0x00,
+    0x10, 0x8E, 0xDA, 0x01,
+    0xA0, 0x0B, 0xC0, 0x09,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    0x00, 0xF0, 0x0E, 0x00,
+    /* 0xCF 6x19 */
+    0xFE, 0x20, 0xDF,
+    0xFE, 0x20, 0xDF,
+    0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    0x00, 0xEF, 0x00,
+    /* 0xD0 16x15 */
+    0x00, 0xFE, 0xFF, 0xEF, 0x9C, 0x04, 0x00, 0x00,
+    0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00,
+    0x00, 0xFE, 0x01, 0x10, 0x83, 0xFE, 0x1D, 0x00,
+    0x00, 0xFE, 0x01, 0x00, 0x00, 0xE2, 0x8F, 0x00,
+    0x00, 0xFE, 0x01, 0x00, 0x00, 0x50, 0xEF, 0x00,
+    0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x02,
+    0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0xFD, 0x04,
+    0xFE, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xFC, 0x04,
+    0xFE, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xFD, 0x04,
+    0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0xFF, 0x02,
+    0x00, 0xFE, 0x01, 0x00, 0x00, 0x60, 0xDF, 0x00,
+    0x00, 0xFE, 0x01, 0x00, 0x00, 0xE2, 0x8F, 0x00,
+    0x00, 0xFE, 0x01, 0x10, 0x83, 0xFE, 0x1D, 0x00,
+    0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00,
+    0x00, 0xFE, 0xFF, 0xEF, 0x9C, 0x04, 0x00, 0x00,
+    /* 0xD1 12x18 */
+    0x00, 0x30, 0xED, 0x28, 0x9A, 0x00,
+    0x00, 0xA0, 0x2A, 0xE9, 0x2D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xDF, 0x00, 0x00, 0x00, 0xFE,
+    0xF0, 0xFF, 0x06, 0x00, 0x00, 0xFE,
+    0xF0, 0xFE, 0x0D, 0x00, 0x00, 0xFE,
+    0xF0, 0x9D, 0x6F, 0x00, 0x00, 0xFE,
+    0xF0, 0x2D, 0xEF, 0x01, 0x00, 0xFE,
+    0xF0, 0x0D, 0xF8, 0x07, 0x00, 0xFE,
+    0xF0, 0x0D, 0xE1, 0x1E, 0x00, 0xFE,
+    0xF0, 0x0D, 0x80, 0x7F, 0x00, 0xFE,
+    0xF0, 0x0D, 0x10, 0xEE, 0x01, 0xFE,
+    0xF0, 0x0D, 0x00, 0xF7, 0x08, 0xFE,
+    0xF0, 0x0D, 0x00, 0xE1, 0x1E, 0xFE,
+    0xF0, 0x0D, 0x00, 0x70, 0x8F, 0xFE,
+    0xF0, 0x0D, 0x00, 0x10, 0xEE, 0xFE,
+    0xF0, 0x0D, 0x00, 0x00, 0xF6, 0xFF,
+    0xF0, 0x0D, 0x00, 0x00, 0xD0, 0xFF,
+    /* 0xD2 14x19 */
+    0x00, 0x00, 0xE3, 0x09, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x60, 0x4F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xDA, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xD9, 0xEE, 0x8C, 0x01, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x50, 0xFF, 0x3A, 0x11, 0xC4, 0xEF, 0x02,
+    0xE1, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFD, 0x03, 0x00, 0x00, 0x00, 0x70, 0x9F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xE1, 0x7F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0x60, 0xFF, 0x39, 0x11, 0xC4, 0xEF, 0x02,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x00, 0x20, 0xD9, 0xEF, 0x8C, 0x01, 0x00,
+    /* 0xD3 14x19 */
+    0x00, 0x00, 0x00, 0xD1, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xE8, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xD9, 0xEE, 0x8C, 0x01, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x50, 0xFF, 0x3A, 0x11, 0xC4, 0xEF, 0x02,
+    0xE1, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFD, 0x03, 0x00, 0x00, 0x00, 0x70, 0x9F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xE1, 0x7F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0x60, 0xFF, 0x39, 0x11, 0xC4, 0xEF, 0x02,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x00, 0x20, 0xD9, 0xEF, 0x8C, 0x01, 0x00,
+    /* 0xD4 14x19 */
+    0x00, 0x00, 0x60, 0xFF, 0x03, 0x00, 0x00,
+    0x00, 0x00, 0xE2, 0xB7, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0xAB, 0x10, 0x8D, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xD9, 0xEE, 0x8C, 0x01, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x50, 0xFF, 0x3A, 0x11, 0xC4, 0xEF, 0x02,
+    0xE1, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFD, 0x03, 0x00, 0x00, 0x00, 0x70, 0x9F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xE1, 0x7F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0x60, 0xFF, 0x39, 0x11, 0xC4, 0xEF, 0x02,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x00, 0x20, 0xD9, 0xEF, 0x8C, 0x01, 0x00,
+    /* 0xD5 14x18 */
+    0x00, 0x00, 0xEA, 0x4B, 0xF5, 0x00, 0x00,
+    0x00, 0x40, 0x2E, 0xD6, 0x6E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xD9, 0xEE, 0x8C, 0x01, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x50, 0xFF, 0x3A, 0x11, 0xC4, 0xEF, 0x02,
+    0xE1, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFD, 0x03, 0x00, 0x00, 0x00, 0x70, 0x9F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xE1, 0x7F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0x60, 0xFF, 0x39, 0x11, 0xC4, 0xEF, 0x02,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x00, 0x20, 0xD9, 0xEF, 0x8C, 0x01, 0x00,
+    /* 0xD6 14x19 */
+    0x00, 0x00, 0xEF, 0x30, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0xEF, 0x30, 0xCF, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x20, 0xD9, 0xEE, 0x8C, 0x01, 0x00,
+    0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x50, 0xFF, 0x3A, 0x11, 0xC4, 0xEF, 0x02,
+    0xE1, 0x8F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFD, 0x03, 0x00, 0x00, 0x00, 0x70, 0x9F,
+    0xFC, 0x04, 0x00, 0x00, 0x00, 0x80, 0x8F,
+    0xFA, 0x07, 0x00, 0x00, 0x00, 0xB0, 0x6F,
+    0xF6, 0x0C, 0x00, 0x00, 0x00, 0xF2, 0x2F,
+    0xE1, 0x7F, 0x00, 0x00, 0x00, 0xFB, 0x0B,
+    0x60, 0xFF, 0x39, 0x11, 0xC4, 0xEF, 0x02,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0x00, 0x20, 0xD9, 0xEF, 0x8C, 0x01, 0x00,
+    /* 0xD7 14x11 */
+    0x90, 0x06, 0x00, 0x00, 0x00, 0x69, 0x00,
+    0xC1, 0x7F, 0x00, 0x00, 0xA0, 0xAF, 0x00,
+    0x10, 0xFC, 0x07, 0x00, 0xFA, 0x0A, 0x00,
+    0x00, 0xC1, 0x7F, 0xB0, 0x9F, 0x00, 0x00,
+    0x00, 0x10, 0xFC, 0xFD, 0x09, 0x00, 0x00,
+    0x00, 0x00, 0xE1, 0xCF, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xFB, 0xFD, 0x09, 0x00, 0x00,
+    0x00, 0xC1, 0x7F, 0xB0, 0x9F, 0x00, 0x00,
+    0x10, 0xFC, 0x07, 0x00, 0xFA, 0x09, 0x00,
+    0xC1, 0x7F, 0x00, 0x00, 0xA0, 0xAF, 0x00,
+    0x90, 0x06, 0x00, 0x00, 0x00, 0x6A, 0x00,
+    /* 0xD8 14x17 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+    0x00, 0x30, 0xD9, 0xEF, 0x6B, 0x10, 0x7D,
+    0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x9B, 0x2E,
+    0x60, 0xFF, 0x3A, 0x11, 0xC5, 0xFF, 0x05,
+    0xE1, 0x8F, 0x00, 0x00, 0x50, 0xFF, 0x08,
+    0xF7, 0x0C, 0x00, 0x00, 0xF4, 0xF9, 0x1F,
+    0xFB, 0x07, 0x00, 0x30, 0x9E, 0xB0, 0x5F,
+    0xFC, 0x04, 0x00, 0xE2, 0x0A, 0x90, 0x8F,
+    0xFD, 0x03, 0x20, 0xBD, 0x00, 0x70, 0x9F,
+    0xFC, 0x05, 0xD1, 0x1C, 0x00, 0x80, 0x8F,
+    0xF9, 0x17, 0xDC, 0x01, 0x00, 0xB0, 0x7F,
+    0xF5, 0xBD, 0x2D, 0x00, 0x00, 0xF2, 0x3F,
+    0xC0, 0xEF, 0x02, 0x00, 0x00, 0xFB, 0x0C,
+    0x80, 0xFF, 0x3A, 0x10, 0xC4, 0xFF, 0x03,
+    0xF3, 0xD7, 0xFF, 0xFF, 0xFF, 0x4E, 0x00,
+    0xAC, 0x10, 0xC7, 0xEE, 0x8C, 0x01, 0x00,
+    0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0xD9 12x19 */
+    0x00, 0x00, 0xEA, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0xD1, 0x0B, 0x00, 0x00,
+    0x00, 0x00, 0x30, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF3, 0x0B, 0x00, 0x00, 0x20, 0xDF,
+    0xF2, 0x0E, 0x00, 0x00, 0x40, 0xCF,
+    0xE0, 0x4F, 0x00, 0x00, 0xA0, 0x8F,
+    0x80, 0xEF, 0x15, 0x20, 0xF8, 0x2F,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x60, 0xEC, 0xEF, 0x3A, 0x00,
+    /* 0xDA 12x19 */
+    0x00, 0x00, 0x00, 0xF7, 0x05, 0x00,
+    0x00, 0x00, 0x20, 0x8E, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF3, 0x0B, 0x00, 0x00, 0x20, 0xDF,
+    0xF2, 0x0E, 0x00, 0x00, 0x40, 0xCF,
+    0xE0, 0x4F, 0x00, 0x00, 0xA0, 0x8F,
+    0x80, 0xEF, 0x15, 0x20, 0xF8, 0x2F,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x60, 0xEC, 0xEF, 0x3A, 0x00,
+    /* 0xDB 12x19 */
+    0x00, 0x00, 0xD1, 0x9F, 0x00, 0x00,
+    0x00, 0x00, 0xD9, 0xF5, 0x04, 0x00,
+    0x00, 0x50, 0x2E, 0x70, 0x1D, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF3, 0x0B, 0x00, 0x00, 0x20, 0xDF,
+    0xF2, 0x0E, 0x00, 0x00, 0x40, 0xCF,
+    0xE0, 0x4F, 0x00, 0x00, 0xA0, 0x8F,
+    0x80, 0xEF, 0x15, 0x20, 0xF8, 0x2F,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x60, 0xEC, 0xEF, 0x3A, 0x00,
+    /* 0xDC 12x19 */
+    0x00, 0x90, 0x6F, 0xB0, 0x4F, 0x00,
+    0x00, 0x90, 0x6F, 0xB0, 0x4F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF4, 0x0B, 0x00, 0x00, 0x10, 0xEF,
+    0xF3, 0x0B, 0x00, 0x00, 0x20, 0xDF,
+    0xF2, 0x0E, 0x00, 0x00, 0x40, 0xCF,
+    0xE0, 0x4F, 0x00, 0x00, 0xA0, 0x8F,
+    0x80, 0xEF, 0x15, 0x20, 0xF8, 0x2F,
+    0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0x06,
+    0x00, 0x60, 0xEC, 0xEF, 0x3A, 0x00,
+    /* 0xDD 14x19 */
+    0x00, 0x00, 0x00, 0xA0, 0x2E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x10, 0x9D, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xB0, 0x6F, 0x00, 0x00, 0x00, 0xF3, 0x1D,
+    0x20, 0xEE, 0x02, 0x00, 0x00, 0xFC, 0x04,
+    0x00, 0xF6, 0x0B, 0x00, 0x70, 0x9F, 0x00,
+    0x00, 0xB0, 0x6F, 0x00, 0xF2, 0x1D, 0x00,
+    0x00, 0x20, 0xEE, 0x01, 0xFC, 0x04, 0x00,
+    0x00, 0x00, 0xF6, 0x7A, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xB0, 0xFF, 0x1E, 0x00, 0x00,
+    0x00, 0x00, 0x20, 0xFF, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0xFD, 0x01, 0x00, 0x00,
+    /* 0xDE 12x15 */
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0xFF, 0xFF, 0xBE, 0x04, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x6F, 0x00,
+    0xF0, 0x0E, 0x00, 0xA3, 0xEF, 0x01,
+    0xF0, 0x0E, 0x00, 0x00, 0xFE, 0x04,
+    0xF0, 0x0E, 0x00, 0x00, 0xFB, 0x05,
+    0xF0, 0x0E, 0x00, 0x00, 0xFE, 0x04,
+    0xF0, 0x0E, 0x00, 0xA3, 0xEF, 0x01,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x6F, 0x00,
+    0xF0, 0xFF, 0xFF, 0xBE, 0x04, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x0E, 0x00, 0x00, 0x00, 0x00,
+    /* 0xDF 12x15 */
+    0x00, 0xB4, 0xFE, 0x7D, 0x00, 0x00,
+    0x50, 0xFF, 0xFF, 0xFF, 0x09, 0x00,
+    0xD0, 0x8F, 0x11, 0xD4, 0x2F, 0x00,
+    0xF2, 0x0C, 0x00, 0x70, 0x6F, 0x00,
+    0xF3, 0x0A, 0x50, 0xDD, 0x49, 0x00,
+    0xF3, 0x0A, 0xF2, 0x0B, 0x00, 0x00,
+    0xF3, 0x0A, 0xF5, 0x07, 0x00, 0x00,
+    0xF3, 0x0A, 0xF2, 0x6E, 0x00, 0x00,
+    0xF3, 0x0A, 0x30, 0xFD, 0x2B, 0x00,
+    0xF3, 0x0A, 0x00, 0x60, 0xDE, 0x01,
+    0xF3, 0x0A, 0x00, 0x00, 0xF5, 0x08,
+    0xF3, 0x0A, 0x00, 0x00, 0xF3, 0x0A,
+    0xF3, 0x3A, 0x39, 0x21, 0xFB, 0x08,
+    0xF3, 0x4A, 0xFF, 0xFF, 0xEF, 0x02,
+    0xF3, 0x0A, 0xC6, 0xDE, 0x29, 0x00,
+    /* 0xE0 10x16 */
+    0x30, 0xBE, 0x00, 0x00, 0x00,
+    0x00, 0xF5, 0x06, 0x00, 0x00,
+    0x00, 0x80, 0x2E, 0x00, 0x00,
+    0x00, 0x00, 0xCB, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xC9, 0xEE, 0x5B, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x07,
+    0xC0, 0x25, 0x10, 0xE6, 0x1E,
+    0x00, 0x00, 0x00, 0x70, 0x4F,
+    0x20, 0xD9, 0xFF, 0xFF, 0x6F,
+    0xE2, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xF9, 0x3A, 0x01, 0x60, 0x7F,
+    0xFC, 0x01, 0x00, 0xB0, 0x7F,
+    0xFA, 0x28, 0x30, 0xFA, 0x7F,
+    0xF3, 0xFF, 0xFF, 0x9F, 0x7F,
+    0x40, 0xEC, 0xBE, 0x54, 0x7F,
+    /* 0xE1 10x16 */
+    0x00, 0x00, 0x30, 0xAF, 0x00,
+    0x00, 0x00, 0xD0, 0x1D, 0x00,
+    0x00, 0x00, 0xE8, 0x02, 0x00,
+    0x00, 0x40, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xC9, 0xEE, 0x5B, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x07,
+    0xC0, 0x25, 0x10, 0xE6, 0x1E,
+    0x00, 0x00, 0x00, 0x70, 0x4F,
+    0x20, 0xD9, 0xFF, 0xFF, 0x6F,
+    0xE2, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xF9, 0x3A, 0x01, 0x60, 0x7F,
+    0xFC, 0x01, 0x00, 0xB0, 0x7F,
+    0xFA, 0x28, 0x30, 0xFA, 0x7F,
+    0xF3, 0xFF, 0xFF, 0x9F, 0x7F,
+    0x40, 0xEC, 0xBE, 0x54, 0x7F,
+    /* 0xE2 10x16 */
+    0x00, 0x30, 0xCF, 0x00, 0x00,
+    0x00, 0xC0, 0xFC, 0x06, 0x00,
+    0x00, 0xE6, 0x72, 0x1E, 0x00,
+    0x10, 0x6E, 0x00, 0x9C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xC9, 0xEE, 0x5B, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x07,
+    0xC0, 0x25, 0x10, 0xE6, 0x1E,
+    0x00, 0x00, 0x00, 0x70, 0x4F,
+    0x20, 0xD9, 0xFF, 0xFF, 0x6F,
+    0xE2, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xF9, 0x3A, 0x01, 0x60, 0x7F,
+    0xFC, 0x01, 0x00, 0xB0, 0x7F,
+    0xFA, 0x28, 0x30, 0xFA, 0x7F,
+    0xF3, 0xFF, 0xFF, 0x9F, 0x7F,
+    0x40, 0xEC, 0xBE, 0x54, 0x7F,
+    /* 0xE3 10x16 */
+    0x00, 0xE9, 0x1A, 0xE4, 0x00,
+    0x30, 0x3E, 0xAF, 0xC7, 0x00,
+    0x60, 0x0C, 0xD5, 0x4E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xC9, 0xEE, 0x5B, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x07,
+    0xC0, 0x25, 0x10, 0xE6, 0x1E,
+    0x00, 0x00, 0x00, 0x70, 0x4F,
+    0x20, 0xD9, 0xFF, 0xFF, 0x6F,
+    0xE2, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xF9, 0x3A, 0x01, 0x60, 0x7F,
+    0xFC, 0x01, 0x00, 0xB0, 0x7F,
+    0xFA, 0x28, 0x30, 0xFA, 0x7F,
+    0xF3, 0xFF, 0xFF, 0x9F, 0x7F,
+    0x40, 0xEC, 0xBE, 0x54, 0x7F,
+    /* 0xE4 10x15 */
+    0x20, 0xDF, 0x40, 0xBF, 0x00,
+    0x20, 0xDF, 0x40, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xC9, 0xEE, 0x5B, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x07,
+    0xC0, 0x25, 0x10, 0xE6, 0x1E,
+    0x00, 0x00, 0x00, 0x70, 0x4F,
+    0x20, 0xD9, 0xFF, 0xFF, 0x6F,
+    0xE2, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xF9, 0x3A, 0x01, 0x60, 0x7F,
+    0xFC, 0x01, 0x00, 0xB0, 0x7F,
+    0xFA, 0x28, 0x30, 0xFA, 0x7F,
+    0xF3, 0xFF, 0xFF, 0x9F, 0x7F,
+    0x40, 0xEC, 0xBE, 0x54, 0x7F,
+    /* 0xE5 10x17 */
+    0x00, 0xA1, 0xDE, 0x05, 0x00,
+    0x00, 0xB9, 0x41, 0x3E, 0x00,
+    0x00, 0x5C, 0x00, 0x6C, 0x00,
+    0x00, 0xB9, 0x41, 0x3E, 0x00,
+    0x00, 0xA1, 0xDE, 0x06, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x30, 0xC9, 0xEE, 0x5B, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0x07,
+    0xC0, 0x25, 0x10, 0xE6, 0x1E,
+    0x00, 0x00, 0x00, 0x70, 0x4F,
+    0x20, 0xD9, 0xFF, 0xFF, 0x6F,
+    0xE2, 0xFF, 0xFF, 0xFF, 0x7F,
+    0xF9, 0x3A, 0x01, 0x60, 0x7F,
+    0xFC, 0x01, 0x00, 0xB0, 0x7F,
+    0xFA, 0x28, 0x30, 0xFA, 0x7F,
+    0xF3, 0xFF, 0xFF, 0x9F, 0x7F,
+    0x40, 0xEC, 0xBE, 0x54, 0x7F,
+    /* 0xE6 18x11 */
+    0x30, 0xC9, 0xEE, 0x3A, 0x00, 0xC7, 0xEE, 0x4B, 0x00,
+    0xF0, 0xFF, 0xFF, 0xFF, 0xC6, 0xFF, 0xFF, 0xFF, 0x05,
+    0xC0, 0x25, 0x10, 0xE6, 0xFF, 0x28, 0x11, 0xE5, 0x1E,
+    0x00, 0x00, 0x00, 0x70, 0x9F, 0x00, 0x00, 0x50, 0x6F,
+    0x20, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F,
+    0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xF9, 0x3A, 0x01, 0x70, 0x7F, 0x00, 0x00, 0x00, 0x00,
+    0xFC, 0x01, 0x00, 0xC0, 0xCF, 0x01, 0x00, 0x00, 0x00,
+    0xFA, 0x28, 0x31, 0xFA, 0xFF, 0x4C, 0x11, 0x52, 0x2B,
+    0xF4, 0xFF, 0xFF, 0xCF, 0xE4, 0xFF, 0xFF, 0xFF, 0x3F,
+    0x40, 0xEB, 0xCE, 0x07, 0x20, 0xD8, 0xEE, 0x9D, 0x04,
+    /* 0xE7 10x15 */
+    0x00, 0xA3, 0xFE, 0x9D, 0x02,
+    0x60, 0xFF, 0xFF, 0xFF, 0x0B,
+    0xF3, 0x9F, 0x13, 0x62, 0x09,
+    0xF9, 0x09, 0x00, 0x00, 0x00,
+    0xFC, 0x02, 0x00, 0x00, 0x00,
+    0xFD, 0x01, 0x00, 0x00, 0x00,
+    0xFC, 0x02, 0x00, 0x00, 0x00,
+    0xF9, 0x09, 0x00, 0x00, 0x00,
+    0xF3, 0x9F, 0x13, 0x62, 0x09,
+    0x60, 0xFF, 0xFF, 0xFF, 0x0B,
+    0x00, 0xA3, 0xFE, 0x9D, 0x02,
+    0x00, 0x00, 0xA0, 0x09, 0x00,
+    0x00, 0x00, 0x30, 0x2F, 0x00,
+    0x00, 0x00, 0x50, 0x3F, 0x00,
+    0x00, 0xA0, 0xEF, 0x09, 0x00,
+    /* 0xE8 12x16 */
+    0x00, 0xF9, 0x04, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x1E, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0xAD, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xF3, 0x05, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA3, 0xFE, 0x9D, 0x02, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0x3E, 0x00,
+    0xF2, 0x6E, 0x01, 0x82, 0xBF, 0x00,
+    0xF9, 0x04, 0x00, 0x00, 0xFB, 0x01,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0xFC, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x9F, 0x13, 0x31, 0xA7, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x93, 0xFD, 0xCE, 0x28, 0x00,
+    /* 0xE9 12x16 */
+    0x00, 0x00, 0x00, 0xF9, 0x04, 0x00,
+    0x00, 0x00, 0x50, 0x7F, 0x00, 0x00,
+    0x00, 0x00, 0xE1, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0xDA, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA3, 0xFE, 0x9D, 0x02, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0x3E, 0x00,
+    0xF2, 0x6E, 0x01, 0x82, 0xBF, 0x00,
+    0xF9, 0x04, 0x00, 0x00, 0xFB, 0x01,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0xFC, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x9F, 0x13, 0x31, 0xA7, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x93, 0xFD, 0xCE, 0x28, 0x00,
+    /* 0xEA 12x16 */
+    0x00, 0x00, 0xFA, 0x06, 0x00, 0x00,
+    0x00, 0x40, 0xBF, 0x1E, 0x00, 0x00,
+    0x00, 0xD0, 0x19, 0x9D, 0x00, 0x00,
+    0x00, 0xD7, 0x01, 0xF4, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA3, 0xFE, 0x9D, 0x02, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0x3E, 0x00,
+    0xF2, 0x6E, 0x01, 0x82, 0xBF, 0x00,
+    0xF9, 0x04, 0x00, 0x00, 0xFB, 0x01,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0xFC, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x9F, 0x13, 0x31, 0xA7, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x93, 0xFD, 0xCE, 0x28, 0x00,
+    /* 0xEB 12x15 */
+    0x00, 0xF8, 0x07, 0xFB, 0x04, 0x00,
+    0x00, 0xF8, 0x07, 0xFB, 0x04, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xA3, 0xFE, 0x9D, 0x02, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0x3E, 0x00,
+    0xF2, 0x6E, 0x01, 0x82, 0xBF, 0x00,
+    0xF9, 0x04, 0x00, 0x00, 0xFB, 0x01,
+    0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x04,
+    0xFC, 0x02, 0x00, 0x00, 0x00, 0x00,
+    0xF9, 0x08, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x9F, 0x13, 0x31, 0xA7, 0x00,
+    0x60, 0xFF, 0xFF, 0xFF, 0xCF, 0x00,
+    0x00, 0x93, 0xFD, 0xCE, 0x28, 0x00,
+    /* 0xEC 6x16 */
+    0xF3, 0x0B, 0x00,
+    0x60, 0x6F, 0x00,
+    0x00, 0xE9, 0x02,
+    0x00, 0xB0, 0x0C,
+    0x00, 0x00, 0x00,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    0x00, 0xF2, 0x0A,
+    /* 0xED 6x16 */
+    0x00, 0xF3, 0x0A,
+    0x10, 0xDD, 0x01,
+    0x90, 0x2E, 0x00,
+    0xF4, 0x05, 0x00,
+    0x00, 0x00, 0x00,
+    0xF2, 0x0A, 0x00,
+    0xF2, 0x0A, 0x00,
+    0xF2, 0x0A, 0x00,
+    0xF2, 0x0A, 0x00,
+    0xF2, 0x0A, 0x00,
+    0xF2, 0x0A, 0x00,
+    0xF2, 0x0A, 0x00,
+    0xF2, 0x0A, 0x00,
+    0xF2, 0x0A, 0x00,
+    0xF2, 0x0A, 0x00,
+    0xF2, 0x0A, 0x00,
+    /* 0xEE 8x16 */
+    0x00, 0xF4, 0x0C, 0x00,
+    0x00, 0xCC, 0x6F, 0x00,
+    0x70, 0x2E, 0xE7, 0x01,
+    0xE1, 0x05, 0xC0, 0x09,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    /* 0xEF 8x15 */
+    0xF2, 0x0D, 0xF4, 0x0A,
+    0xF2, 0x0D, 0xF4, 0x0A,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    0x00, 0xF2, 0x0A, 0x00,
+    /* 0xF0 12x15 */
+    0x00, 0xF7, 0x0B, 0x51, 0x08, 0x00,
+    0x00, 0x90, 0xDF, 0x9D, 0x05, 0x00,
+    0x70, 0xCD, 0xFA, 0x0A, 0x00, 0x00,
+    0x40, 0x02, 0x80, 0xAF, 0x00, 0x00,
+    0x00, 0xC5, 0xEE, 0xFF, 0x07, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0x2F, 0x00,
+    0xF3, 0x8F, 0x02, 0xB2, 0x9F, 0x00,
+    0xF9, 0x08, 0x00, 0x20, 0xDF, 0x00,
+    0xFC, 0x02, 0x00, 0x00, 0xFD, 0x01,
+    0xFD, 0x01, 0x00, 0x00, 0xFC, 0x02,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xF9, 0x08, 0x00, 0x50, 0xDF, 0x00,
+    0xF3, 0x7F, 0x12, 0xE5, 0x6F, 0x00,
+    0x70, 0xFF, 0xFF, 0xFF, 0x0A, 0x00,
+    0x00, 0xB4, 0xFE, 0x6C, 0x00, 0x00,
+    /* 0xF1 10x16 */
+    0x00, 0xC1, 0x8E, 0x80, 0x0A,
+    0x00, 0xB7, 0xF6, 0xB5, 0x07,
+    0x00, 0x8A, 0x80, 0xCE, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x19, 0xEA, 0xCF, 0x04,
+    0xF3, 0xDB, 0xFF, 0xFF, 0x4F,
+    0xF3, 0xCF, 0x14, 0xA2, 0xAF,
+    0xF3, 0x1E, 0x00, 0x10, 0xEE,
+    0xF3, 0x0B, 0x00, 0x00, 0xFD,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    0xF3, 0x09, 0x00, 0x00, 0xFC,
+    /* 0xF2 12x16 */
+    0x00, 0xEC, 0x02, 0x00, 0x00, 0x00,
+    0x00, 0xE2, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0x40, 0x6F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xE6, 0x02, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB5, 0xFE, 0x7C, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0xF4, 0x7F, 0x12, 0xE5, 0x7F, 0x00,
+    0xF9, 0x08, 0x00, 0x40, 0xDF, 0x00,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xFD, 0x01, 0x00, 0x00, 0xFC, 0x02,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xF9, 0x08, 0x00, 0x40, 0xDF, 0x00,
+    0xF4, 0x7F, 0x12, 0xE5, 0x7F, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0xC5, 0xFE, 0x7C, 0x00, 0x00,
+    /* 0xF3 12x16 */
+    0x00, 0x00, 0x00, 0xEC, 0x02, 0x00,
+    0x00, 0x00, 0x80, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xF4, 0x07, 0x00, 0x00,
+    0x00, 0x10, 0xAD, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB5, 0xFE, 0x7C, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0xF4, 0x7F, 0x12, 0xE5, 0x7F, 0x00,
+    0xF9, 0x08, 0x00, 0x40, 0xDF, 0x00,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xFD, 0x01, 0x00, 0x00, 0xFC, 0x02,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xF9, 0x08, 0x00, 0x40, 0xDF, 0x00,
+    0xF4, 0x7F, 0x12, 0xE5, 0x7F, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0xC5, 0xFE, 0x7C, 0x00, 0x00,
+    /* 0xF4 12x16 */
+    0x00, 0x00, 0xFD, 0x02, 0x00, 0x00,
+    0x00, 0x70, 0xCE, 0x0B, 0x00, 0x00,
+    0x00, 0xE2, 0x26, 0x5F, 0x00, 0x00,
+    0x00, 0xBA, 0x00, 0xD7, 0x01, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB5, 0xFE, 0x7C, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0xF4, 0x7F, 0x12, 0xE5, 0x7F, 0x00,
+    0xF9, 0x08, 0x00, 0x40, 0xDF, 0x00,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xFD, 0x01, 0x00, 0x00, 0xFC, 0x02,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xF9, 0x08, 0x00, 0x40, 0xDF, 0x00,
+    0xF4, 0x7F, 0x12, 0xE5, 0x7F, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0xC5, 0xFE, 0x7C, 0x00, 0x00,
+    /* 0xF5 12x16 */
+    0x00, 0xE4, 0x4D, 0xE0, 0x04, 0x00,
+    0x00, 0x6D, 0xEB, 0xF3, 0x02, 0x00,
+    0x10, 0x2F, 0xB2, 0x8E, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB5, 0xFE, 0x7C, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0xF4, 0x7F, 0x12, 0xE5, 0x7F, 0x00,
+    0xF9, 0x08, 0x00, 0x40, 0xDF, 0x00,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xFD, 0x01, 0x00, 0x00, 0xFC, 0x02,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xF9, 0x08, 0x00, 0x40, 0xDF, 0x00,
+    0xF4, 0x7F, 0x12, 0xE5, 0x7F, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0xC5, 0xFE, 0x7C, 0x00, 0x00,
+    /* 0xF6 12x15 */
+    0x00, 0xFC, 0x03, 0xFE, 0x00, 0x00,
+    0x00, 0xFC, 0x03, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xB5, 0xFE, 0x7C, 0x00, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0xF4, 0x7F, 0x12, 0xE5, 0x7F, 0x00,
+    0xF9, 0x08, 0x00, 0x40, 0xDF, 0x00,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xFD, 0x01, 0x00, 0x00, 0xFC, 0x02,
+    0xFC, 0x02, 0x00, 0x00, 0xFE, 0x01,
+    0xF9, 0x08, 0x00, 0x40, 0xDF, 0x00,
+    0xF4, 0x7F, 0x12, 0xE5, 0x7F, 0x00,
+    0x80, 0xFF, 0xFF, 0xFF, 0x0B, 0x00,
+    0x00, 0xC5, 0xFE, 0x7C, 0x00, 0x00,
+    /* 0xF7 14x10 */
+    0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0xC0, 0x9F, 0x00, 0x00, 0x00,
+    /* 0xF8 12x13 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x15,
+    0x00, 0x60, 0xEC, 0xBE, 0x34, 0x4F,
+    0x00, 0xF9, 0xFF, 0xFF, 0xEF, 0x09,
+    0x50, 0xFF, 0x27, 0x51, 0xFF, 0x04,
+    0xA0, 0x8F, 0x00, 0xA0, 0xFD, 0x0A,
+    0xD0, 0x2F, 0x00, 0xCA, 0xD1, 0x0F,
+    0xD0, 0x0F, 0xA0, 0x1C, 0xC0, 0x2F,
+    0xB0, 0x2F, 0xCA, 0x01, 0xE0, 0x1F,
+    0x70, 0xDF, 0x1C, 0x00, 0xF4, 0x0E,
+    0x10, 0xFE, 0x18, 0x51, 0xFE, 0x08,
+    0x50, 0xEE, 0xFF, 0xFF, 0xCF, 0x01,
+    0xE1, 0x26, 0xEA, 0xDF, 0x18, 0x00,
+    0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* 0xF9 10x16 */
+    0x00, 0xEB, 0x02, 0x00, 0x00,
+    0x00, 0xD1, 0x0C, 0x00, 0x00,
+    0x00, 0x30, 0x8E, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x03, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDF,
+    0xF3, 0x0A, 0x00, 0x50, 0xDF,
+    0xE1, 0x6F, 0x11, 0xE6, 0xDF,
+    0x80, 0xFF, 0xFF, 0xAF, 0xDE,
+    0x00, 0xD7, 0xDF, 0x07, 0xDE,
+    /* 0xFA 10x16 */
+    0x00, 0x00, 0x00, 0xEC, 0x02,
+    0x00, 0x00, 0x70, 0x5F, 0x00,
+    0x00, 0x00, 0xF3, 0x08, 0x00,
+    0x00, 0x00, 0xBC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDF,
+    0xF3, 0x0A, 0x00, 0x50, 0xDF,
+    0xE1, 0x6F, 0x11, 0xE6, 0xDF,
+    0x80, 0xFF, 0xFF, 0xAF, 0xDE,
+    0x00, 0xD7, 0xDF, 0x07, 0xDE,
+    /* 0xFB 10x16 */
+    0x00, 0x00, 0xFC, 0x03, 0x00,
+    0x00, 0x60, 0xCF, 0x0C, 0x00,
+    0x00, 0xE1, 0x27, 0x6E, 0x00,
+    0x00, 0xC9, 0x00, 0xE6, 0x01,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDF,
+    0xF3, 0x0A, 0x00, 0x50, 0xDF,
+    0xE1, 0x6F, 0x11, 0xE6, 0xDF,
+    0x80, 0xFF, 0xFF, 0xAF, 0xDE,
+    0x00, 0xD7, 0xDF, 0x07, 0xDE,
+    /* 0xFC 10x15 */
+    0x00, 0xFB, 0x04, 0xFD, 0x02,
+    0x00, 0xFB, 0x04, 0xFD, 0x02,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDE,
+    0xF4, 0x08, 0x00, 0x00, 0xDF,
+    0xF3, 0x0A, 0x00, 0x50, 0xDF,
+    0xE1, 0x6F, 0x11, 0xE6, 0xDF,
+    0x80, 0xFF, 0xFF, 0xAF, 0xDE,
+    0x00, 0xD7, 0xDF, 0x07, 0xDE,
+    /* 0xFD 12x20 */
+    0x00, 0x00, 0x00, 0xE2, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0xEB, 0x02, 0x00,
+    0x00, 0x00, 0x60, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xE2, 0x07, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x0A, 0x00, 0x00, 0xD0, 0x1E,
+    0xC0, 0x2F, 0x00, 0x00, 0xF4, 0x09,
+    0x60, 0x7F, 0x00, 0x00, 0xFA, 0x03,
+    0x00, 0xDE, 0x00, 0x10, 0xBF, 0x00,
+    0x00, 0xF8, 0x04, 0x70, 0x5F, 0x00,
+    0x00, 0xF2, 0x0A, 0xD0, 0x0E, 0x00,
+    0x00, 0xB0, 0x1F, 0xF4, 0x08, 0x00,
+    0x00, 0x50, 0x7F, 0xFA, 0x02, 0x00,
+    0x00, 0x00, 0xDD, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x06, 0x00, 0x00,
+    0x00, 0x30, 0xED, 0x01, 0x00, 0x00,
+    0x60, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x60, 0xEF, 0x09, 0x00, 0x00, 0x00,
+    /* 0xFE 12x19 */
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x29, 0xEA, 0xBE, 0x04, 0x00,
+    0xF3, 0xEB, 0xFF, 0xFF, 0x5F, 0x00,
+    0xF3, 0xDF, 0x14, 0xA2, 0xEF, 0x01,
+    0xF3, 0x2F, 0x00, 0x00, 0xFC, 0x05,
+    0xF3, 0x0B, 0x00, 0x00, 0xF6, 0x08,
+    0xF3, 0x0A, 0x00, 0x00, 0xF5, 0x09,
+    0xF3, 0x0B, 0x00, 0x00, 0xF6, 0x08,
+    0xF3, 0x2F, 0x00, 0x00, 0xFB, 0x05,
+    0xF3, 0xDF, 0x14, 0x92, 0xEF, 0x01,
+    0xF3, 0xEB, 0xFF, 0xFF, 0x5F, 0x00,
+    0xF3, 0x29, 0xEA, 0xBE, 0x04, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x09, 0x00, 0x00, 0x00, 0x00,
+    /* 0xFF 12x19 */
+    0x00, 0xF0, 0x0F, 0xF2, 0x0C, 0x00,
+    0x00, 0xF0, 0x0F, 0xF2, 0x0C, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF3, 0x0A, 0x00, 0x00, 0xD0, 0x1E,
+    0xC0, 0x2F, 0x00, 0x00, 0xF4, 0x09,
+    0x60, 0x7F, 0x00, 0x00, 0xFA, 0x03,
+    0x00, 0xDE, 0x00, 0x10, 0xBF, 0x00,
+    0x00, 0xF8, 0x04, 0x70, 0x5F, 0x00,
+    0x00, 0xF2, 0x0A, 0xD0, 0x0E, 0x00,
+    0x00, 0xB0, 0x1F, 0xF4, 0x08, 0x00,
+    0x00, 0x50, 0x7F, 0xFA, 0x02, 0x00,
+    0x00, 0x00, 0xDD, 0xAF, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0x4F, 0x00, 0x00,
+    0x00, 0x00, 0xF1, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0xF5, 0x06, 0x00, 0x00,
+    0x00, 0x30, 0xED, 0x01, 0x00, 0x00,
+    0x60, 0xFF, 0x8F, 0x00, 0x00, 0x00,
+    0x60, 0xEF, 0x09, 0x00, 0x00, 0x00,
+    /* U+2022 6x6 */
+    0x90, 0xDE, 0x07,
+    0xF8, 0xFF, 0x5F,
+    0xFE, 0xFF, 0xBF,
+    0xFE, 0xFF, 0xBF,
+    0xF9, 0xFF, 0x5F,
+    0x91, 0xDE, 0x07,
+    /* U+2026 16x2 */
+    0xFA, 0x06, 0x00, 0xF0, 0x0F, 0x00, 0x60, 0xBF,
+    0xFA, 0x06, 0x00, 0xF0, 0x0F, 0x00, 0x60, 0xBF,
+    /* U+20AC 12x15 */
+    0x00, 0x00, 0x71, 0xFD, 0xBE, 0x06,
+    0x00, 0x10, 0xFC, 0xFF, 0xFF, 0x6F,
+    0x00, 0xB0, 0xDF, 0x14, 0x31, 0x58,
+    0x00, 0xF4, 0x2E, 0x00, 0x00, 0x00,
+    0x00, 0xF9, 0x07, 0x00, 0x00, 0x00,
+    0x00, 0xFD, 0x03, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xFF, 0x6F, 0x00,
+    0x20, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0xFB, 0xFF, 0xFF, 0xEF, 0x01, 0x00,
+    0x00, 0xFC, 0x03, 0x00, 0x00, 0x00,
+    0x00, 0xF8, 0x0B, 0x00, 0x00, 0x00,
+    0x00, 0xE1, 0xBF, 0x13, 0x31, 0x58,
+    0x00, 0x40, 0xFE, 0xFF, 0xFF, 0x6F,
+    0x00, 0x00, 0x92, 0xFD, 0xBE, 0x06,
+    /* U+2190 16x8 */
+    0x00, 0x10, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC1, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x20, 0xFD, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F,
+    0x20, 0xED, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC1, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x10, 0x6A, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+2191 10x15 */
+    0x00, 0x80, 0x5F, 0x00, 0x00,
+    0x00, 0xF8, 0xFF, 0x04, 0x00,
+    0x70, 0xFF, 0xFF, 0x4E, 0x00,
+    0xF6, 0x8D, 0x7F, 0xEE, 0x03,
+    0xD6, 0x71, 0x3F, 0xE4, 0x03,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    /* U+2192 16x8 */
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAF, 0x00,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xAF, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0x09, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x79, 0x00, 0x00,
+    /* U+2193 10x15 */
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0x00, 0x70, 0x3F, 0x00, 0x00,
+    0xD6, 0x71, 0x3F, 0xD4, 0x03,
+    0xF6, 0x8D, 0x7F, 0xEE, 0x03,
+    0x70, 0xFF, 0xFF, 0x4E, 0x00,
+    0x00, 0xF8, 0xFF, 0x04, 0x00,
+    0x00, 0x80, 0x5F, 0x00, 0x00,
+    /* U+2713 12x12 */
+    0x00, 0x00, 0x00, 0x00, 0x84, 0x02,
+    0x00, 0x00, 0x00, 0x60, 0xBF, 0x00,
+    0x00, 0x00, 0x00, 0xF4, 0x1D, 0x00,
+    0x00, 0x00, 0x10, 0xFE, 0x03, 0x00,
+    0x00, 0x00, 0xB0, 0x6F, 0x00, 0x00,
+    0x00, 0x00, 0xF6, 0x0A, 0x00, 0x00,
+    0x41, 0x20, 0xDE, 0x01, 0x00, 0x00,
+    0xFD, 0xB2, 0x4F, 0x00, 0x00, 0x00,
+    0xFC, 0xFD, 0x08, 0x00, 0x00, 0x00,
+    0xF8, 0xDF, 0x00, 0x00, 0x00, 0x00,
+    0xE2, 0x3E, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    /* U+2717 14x16 */
+    0x00, 0x00, 0x00, 0x00, 0x10, 0x67, 0x00,
+    0x00, 0x70, 0x5D, 0x00, 0xC1, 0xCF, 0x00,
+    0x00, 0x80, 0xBF, 0x00, 0xFB, 0x2D, 0x00,
+    0x00, 0x30, 0xFF, 0x93, 0xEF, 0x03, 0x00,
+    0x00, 0x00, 0xFC, 0xFE, 0x5F, 0x00, 0x00,
+    0x00, 0x00, 0xF7, 0xFF, 0x08, 0x00, 0x00,
+    0x00, 0x00, 0xF2, 0xFF, 0x01, 0x00, 0x00,
+    0x00, 0x00, 0xFB, 0xFF, 0x06, 0x00, 0x00,
+    0x00, 0x80, 0xFF, 0xFF, 0x0D, 0x00, 0x00,
+    0x00, 0xF5, 0xAF, 0xF6, 0x6F, 0x00, 0x00,
+    0x10, 0xFE, 0x1D, 0xB0, 0xEF, 0x01, 0x00,
+    0xA0, 0xFF, 0x04, 0x20, 0xCE, 0x00, 0x00,
+    0xF5, 0x9F, 0x00, 0x00, 0x44, 0x00, 0x00,
+    0xF9, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF6, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+static const aGLYPH Font20AAX_Glyph[105] =
+{
+    /* offset, width, height, left, top, advance */
+    {     0,   0,   0,   0,   0,   6 },  /* 0xA0 */
+    {     0,   2,  15,   3,  11,   8 },  /* 0xA1 */
+    {    15,  10,  17,   1,  14,  13 },  /* 0xA2 */
+    {   100,  10,  15,   1,  15,  13 },  /* 0xA3 */
+    {   175,  12,  11,   0,  12,  13 },  /* 0xA4 */
+    {   241,  12,  15,   0,  15,  13 },  /* 0xA5 */
+    {   331,   4,  17,   2,  14,   7 },  /* 0xA6 */
+    {   365,  10,  17,   0,  15,  10 },  /* 0xA7 */
+    {   450,   6,   2,   2,  15,  10 },  /* 0xA8 */
+    {   456,  16,  15,   2,  15,  20 },  /* 0xA9 */
+    {   576,   8,  10,   1,  15,   9 },  /* 0xAA */
+    {   616,  10,   9,   1,  10,  12 },  /* 0xAB */
+    {   661,  14,   6,   2,   8,  17 },  /* 0xAC */
+    {   703,   8,   2,   0,   7,   7 },  /* 0xAD */
+    {   711,  16,  15,   2,  15,  20 },  /* 0xAE */
+    {   831,   6,   2,   2,  15,  10 },  /* 0xAF */
+    {   837,   8,   6,   1,  15,  10 },  /* 0xB0 */
+    {   861,  14,  13,   2,  13,  17 },  /* 0xB1 */
+    {   952,   8,   8,   0,  15,   8 },  /* 0xB2 */
+    {   984,   8,   8,   0,  15,   8 },  /* 0xB3 */
+    {  1016,   6,   4,   3,  16,  10 },  /* 0xB4 */
+    {  1028,  12,  15,   1,  11,  13 },  /* 0xB5 */
+    {  1118,  10,  17,   1,  15,  13 },  /* 0xB6 */
+    {  1203,   4,   2,   2,   8,   6 },  /* 0xB7 */
+    {  1207,   6,   4,   2,   0,  10 },  /* 0xB8 */
+    {  1219,   6,   8,   1,  15,   8 },  /* 0xB9 */
+    {  1243,  10,  10,   0,  15,   9 },  /* 0xBA */
+    {  1293,  10,   9,   1,  10,  12 },  /* 0xBB */
+    {  1338,  18,  15,   1,  15,  19 },  /* 0xBC */
+    {  1473,  18,  15,   1,  15,  19 },  /* 0xBD */
+    {  1608,  20,  15,   0,  15,  19 },  /* 0xBE */
+    {  1758,  10,  15,   1,  11,  11 },  /* 0xBF */
+    {  1833,  14,  19,   0,  19,  14 },  /* 0xC0 */
+    {  1966,  14,  19,   0,  19,  14 },  /* 0xC1 */
+    {  2099,  14,  19,   0,  19,  14 },  /* 0xC2 */
+    {  2232,  14,  18,   0,  18,  14 },  /* 0xC3 */
+    {  2358,  14,  19,   0,  19,  14 },  /* 0xC4 */
+    {  2491,  14,  19,   0,  19,  14 },  /* 0xC5 */
+    {  2624,  20,  15,   0,  15,  19 },  /* 0xC6 */
+    {  2774,  12,  19,   1,  15,  14 },  /* 0xC7 */
+    {  2888,  12,  19,   1,  19,  13 },  /* 0xC8 */
+    {  3002,  12,  19,   1,  19,  13 },  /* 0xC9 */
+    {  3116,  12,  19,   1,  19,  13 },  /* 0xCA */
+    {  3230,  12,  19,   1,  19,  13 },  /* 0xCB */
+    {  3344,   6,  19,   0,  19,   6 },  /* 0xCC */
+    {  3401,   6,  19,   1,  19,   6 },  /* 0xCD */
+    {  3458,   8,  19,  -1,  19,   6 },  /* 0xCE */
+    {  3534,   6,  19,   0,  19,   6 },  /* 0xCF */
+    {  3591,  16,  15,   0,  15,  16 },  /* 0xD0 */
+    {  3711,  12,  18,   1,  18,  15 },  /* 0xD1 */
+    {  3819,  14,  19,   1,  19,  16 },  /* 0xD2 */
+    {  3952,  14,  19,   1,  19,  16 },  /* 0xD3 */
+    {  4085,  14,  19,   1,  19,  16 },  /* 0xD4 */
+    {  4218,  14,  18,   1,  18,  16 },  /* 0xD5 */
+    {  4344,  14,  19,   1,  19,  16 },  /* 0xD6 */
+    {  4477,  14,  11,   2,  12,  17 },  /* 0xD7 */
+    {  4554,  14,  17,   1,  16,  16 },  /* 0xD8 */
+    {  4673,  12,  19,   1,  19,  15 },  /* 0xD9 */
+    {  4787,  12,  19,   1,  19,  15 },  /* 0xDA */
+    {  4901,  12,  19,   1,  19,  15 },  /* 0xDB */
+    {  5015,  12,  19,   1,  19,  15 },  /* 0xDC */
+    {  5129,  14,  19,  -1,  19,  12 },  /* 0xDD */
+    {  5262,  12,  15,   1,  15,  12 },  /* 0xDE */
+    {  5352,  12,  15,   1,  15,  13 },  /* 0xDF */
+    {  5442,  10,  16,   1,  16,  12 },  /* 0xE0 */
+    {  5522,  10,  16,   1,  16,  12 },  /* 0xE1 */
+    {  5602,  10,  16,   1,  16,  12 },  /* 0xE2 */
+    {  5682,  10,  16,   1,  16,  12 },  /* 0xE3 */
+    {  5762,  10,  15,   1,  15,  12 },  /* 0xE4 */
+    {  5837,  10,  17,   1,  17,  12 },  /* 0xE5 */
+    {  5922,  18,  11,   1,  11,  20 },  /* 0xE6 */
+    {  6021,  10,  15,   1,  11,  11 },  /* 0xE7 */
+    {  6096,  12,  16,   1,  16,  12 },  /* 0xE8 */
+    {  6192,  12,  16,   1,  16,  12 },  /* 0xE9 */
+    {  6288,  12,  16,   1,  16,  12 },  /* 0xEA */
+    {  6384,  12,  15,   1,  15,  12 },  /* 0xEB */
+    {  6474,   6,  16,  -1,  16,   6 },  /* 0xEC */
+    {  6522,   6,  16,   1,  16,   6 },  /* 0xED */
+    {  6570,   8,  16,  -1,  16,   6 },  /* 0xEE */
+    {  6634,   8,  15,  -1,  15,   6 },  /* 0xEF */
+    {  6694,  12,  15,   1,  15,  12 },  /* 0xF0 */
+    {  6784,  10,  16,   1,  16,  13 },  /* 0xF1 */
+    {  6864,  12,  16,   1,  16,  12 },  /* 0xF2 */
+    {  6960,  12,  16,   1,  16,  12 },  /* 0xF3 */
+    {  7056,  12,  16,   1,  16,  12 },  /* 0xF4 */
+    {  7152,  12,  16,   1,  16,  12 },  /* 0xF5 */
+    {  7248,  12,  15,   1,  15,  12 },  /* 0xF6 */
+    {  7338,  14,  10,   2,  11,  17 },  /* 0xF7 */
+    {  7408,  12,  13,   0,  12,  12 },  /* 0xF8 */
+    {  7486,  10,  16,   1,  16,  13 },  /* 0xF9 */
+    {  7566,  10,  16,   1,  16,  13 },  /* 0xFA */
+    {  7646,  10,  16,   1,  16,  13 },  /* 0xFB */
+    {  7726,  10,  15,   1,  15,  13 },  /* 0xFC */
+    {  7801,  12,  20,   0,  16,  12 },  /* 0xFD */
+    {  7921,  12,  19,   1,  15,  13 },  /* 0xFE */
+    {  8035,  12,  19,   0,  15,  12 },  /* 0xFF */
+    {  8149,   6,   6,   3,  10,  12 },  /* U+2022 */
+    {  8167,  16,   2,   2,   2,  20 },  /* U+2026 */
+    {  8183,  12,  15,   0,  15,  13 },  /* U+20AC */
+    {  8273,  16,   8,   0,  10,  17 },  /* U+2190 */
+    {  8337,  10,  15,   4,  15,  17 },  /* U+2191 */
+    {  8412,  16,   8,   1,  10,  17 },  /* U+2192 */
+    {  8476,  10,  15,   4,  15,  17 },  /* U+2193 */
+    {  8551,  12,  12,   3,  13,  17 },  /* U+2713 */
+    {  8623,  14,  16,   2,  15,  17 },  /* U+2717 */
+};
+
+static const uint16_t Font20AAX_Code[105] =
+{
+    0x00A0, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7,
+    0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7,
+    0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7,
+    0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+    0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7,
+    0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+    0x00E0, 0x00E1, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7,
+    0x00E8, 0x00E9, 0x00EA, 0x00EB, 0x00EC, 0x00ED, 0x00EE, 0x00EF,
+    0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7,
+    0x00F8, 0x00F9, 0x00FA, 0x00FB, 0x00FC, 0x00FD, 0x00FE, 0x00FF,
+    0x2022, 0x2026, 0x20AC, 0x2190, 0x2191, 0x2192, 0x2193, 0x2713,
+    0x2717,
+};
+
+static const aKERN Font20AAX_Kern[91] =
+{
+    { 0xAB, 0xC6,   1 },  /* 0xAB 0xC6 */
+    { 0xAB, 0xDD,  -1 },  /* 0xAB 0xDD */
+    { 0xBB, 0xC0,  -1 },  /* 0xBB 0xC0 */
+    { 0xBB, 0xC1,  -1 },  /* 0xBB 0xC1 */
+    { 0xBB, 0xC2,  -1 },  /* 0xBB 0xC2 */
+    { 0xBB, 0xC3,  -1 },  /* 0xBB 0xC3 */
+    { 0xBB, 0xC4,  -1 },  /* 0xBB 0xC4 */
+    { 0xBB, 0xDD,  -2 },  /* 0xBB 0xDD */
+    { 0xC0, 0xAB,  -1 },  /* 0xC0 0xAB */
+    { 0xC0, 0xC0,   1 },  /* 0xC0 0xC0 */
+    { 0xC0, 0xC1,   1 },  /* 0xC0 0xC1 */
+    { 0xC0, 0xC2,   1 },  /* 0xC0 0xC2 */
+    { 0xC0, 0xC3,   1 },  /* 0xC0 0xC3 */
+    { 0xC0, 0xC4,   1 },  /* 0xC0 0xC4 */
+    { 0xC0, 0xDD,  -2 },  /* 0xC0 0xDD */
+    { 0xC0, 0xFD,  -1 },  /* 0xC0 0xFD */
+    { 0xC0, 0xFF,  -1 },  /* 0xC0 0xFF */
+    { 0xC1, 0xAB,  -1 },  /* 0xC1 0xAB */
+    { 0xC1, 0xC0,   1 },  /* 0xC1 0xC0 */
+    { 0xC1, 0xC1,   1 },  /* 0xC1 0xC1 */
+    { 0xC1, 0xC2,   1 },  /* 0xC1 0xC2 */
+    { 0xC1, 0xC3,   1 },  /* 0xC1 0xC3 */
+    { 0xC1, 0xC4,   1 },  /* 0xC1 0xC4 */
+    { 0xC1, 0xDD,  -2 },  /* 0xC1 0xDD */
+    { 0xC1, 0xFD,  -1 },  /* 0xC1 0xFD */
+    { 0xC1, 0xFF,  -1 },  /* 0xC1 0xFF */
+    { 0xC2, 0xAB,  -1 },  /* 0xC2 0xAB */
+    { 0xC2, 0xC0,   1 },  /* 0xC2 0xC0 */
+    { 0xC2, 0xC1,   1 },  /* 0xC2 0xC1 */
+    { 0xC2, 0xC2,   1 },  /* 0xC2 0xC2 */
+    { 0xC2, 0xC3,   1 },  /* 0xC2 0xC3 */
+    { 0xC2, 0xC4,   1 },  /* 0xC2 0xC4 */
+    { 0xC2, 0xDD,  -2 },  /* 0xC2 0xDD */
+    { 0xC2, 0xFD,  -1 },  /* 0xC2 0xFD */
+    { 0xC2, 0xFF,  -1 },  /* 0xC2 0xFF */
+    { 0xC3, 0xAB,  -1 },  /* 0xC3 0xAB */
+    { 0xC3, 0xC0,   1 },  /* 0xC3 0xC0 */
+    { 0xC3, 0xC1,   1 },  /* 0xC3 0xC1 */
+    { 0xC3, 0xC2,   1 },  /* 0xC3 0xC2 */
+    { 0xC3, 0xC3,   1 },  /* 0xC3 0xC3 */
+    { 0xC3, 0xC4,   1 },  /* 0xC3 0xC4 */
+    { 0xC3, 0xDD,  -2 },  /* 0xC3 0xDD */
+    { 0xC3, 0xFD,  -1 },  /* 0xC3 0xFD */
+    { 0xC3, 0xFF,  -1 },  /* 0xC3 0xFF */
+    { 0xC4, 0xAB,  -1 },  /* 0xC4 0xAB */
+    { 0xC4, 0xC0,   1 },  /* 0xC4 0xC0 */
+    { 0xC4, 0xC1,   1 },  /* 0xC4 0xC1 */
+    { 0xC4, 0xC2,   1 },  /* 0xC4 0xC2 */
+    { 0xC4, 0xC3,   1 },  /* 0xC4 0xC3 */
+    { 0xC4, 0xC4,   1 },  /* 0xC4 0xC4 */
+    { 0xC4, 0xDD,  -2 },  /* 0xC4 0xDD */
+    { 0xC4, 0xFD,  -1 },  /* 0xC4 0xFD */
+    { 0xC4, 0xFF,  -1 },  /* 0xC4 0xFF */
+    { 0xD0, 0xDD,  -1 },  /* 0xD0 0xDD */
+    { 0xD2, 0xDD,  -1 },  /* 0xD2 0xDD */
+    { 0xD3, 0xDD,  -1 },  /* 0xD3 0xDD */
+    { 0xD4, 0xDD,  -1 },  /* 0xD4 0xDD */
+    { 0xD5, 0xDD,  -1 },  /* 0xD5 0xDD */
+    { 0xD6, 0xDD,  -1 },  /* 0xD6 0xDD */
+    { 0xDD, 0xAB,  -2 },  /* 0xDD 0xAB */
+    { 0xDD, 0xBB,  -1 },  /* 0xDD 0xBB */
+    { 0xDD, 0xC0,  -2 },  /* 0xDD 0xC0 */
+    { 0xDD, 0xC1,  -2 },  /* 0xDD 0xC1 */
+    { 0xDD, 0xC2,  -2 },  /* 0xDD 0xC2 */
+    { 0xDD, 0xC3,  -2 },  /* 0xDD 0xC3 */
+    { 0xDD, 0xC4,  -2 },  /* 0xDD 0xC4 */
+    { 0xDD, 0xC7,  -1 },  /* 0xDD 0xC7 */
+    { 0xDD, 0xD2,  -1 },  /* 0xDD 0xD2 */
+    { 0xDD, 0xD3,  -1 },  /* 0xDD 0xD3 */
+    { 0xDD, 0xD4,  -1 },  /* 0xDD 0xD4 */
+    { 0xDD, 0xD5,  -1 },  /* 0xDD 0xD5 */
+    { 0xDD, 0xD6,  -1 },  /* 0xDD 0xD6 */
+    { 0xDD, 0xE0,  -3 },  /* 0xDD 0xE0 */
+    { 0xDD, 0xE1,  -3 },  /* 0xDD 0xE1 */
+    { 0xDD, 0xE2,  -3 },  /* 0xDD 0xE2 */
+    { 0xDD, 0xE3,  -3 },  /* 0xDD 0xE3 */
+    { 0xDD, 0xE4,  -3 },  /* 0xDD 0xE4 */
+    { 0xDD, 0xE5,  -3 },  /* 0xDD 0xE5 */
+    { 0xDD, 0xE8,  -3 },  /* 0xDD 0xE8 */
+    { 0xDD, 0xE9,  -3 },  /* 0xDD 0xE9 */
+    { 0xDD, 0xEA,  -3 },  /* 0xDD 0xEA */
+    { 0xDD, 0xEB,  -3 },  /* 0xDD 0xEB */
+    { 0xDD, 0xF2,  -3 },  /* 0xDD 0xF2 */
+    { 0xDD, 0xF3,  -3 },  /* 0xDD 0xF3 */
+    { 0xDD, 0xF4,  -3 },  /* 0xDD 0xF4 */
+    { 0xDD, 0xF5,  -3 },  /* 0xDD 0xF5 */
+    { 0xDD, 0xF6,  -3 },  /* 0xDD 0xF6 */
+    { 0xDD, 0xF9,  -2 },  /* 0xDD 0xF9 */
+    { 0xDD, 0xFA,  -2 },  /* 0xDD 0xFA */
+    { 0xDD, 0xFB,  -2 },  /* 0xDD 0xFB */
+    { 0xDD, 0xFC,  -2 },  /* 0xDD 0xFC */
+};
+
+const aFONT Font20AAX =
+{
+    Font20AAX_Bitmap,
+    Font20AAX_Glyph,
+    Font20AAX_Code,
+    0xA0,         /* first */
+    105,          /* count */
+    4,            /* bpp */
+    24,           /* height */
+    19,           /* ascent */
+    Font20AAX_Kern,
+    91,           /* kern_count */
+};
@@ -0,0 +1,207 @@
+/*
+ * font24CNP.c
+ * Packed 32x41 font, 26 glyphs, from Font24CN
+ *
+ * Generated by Tools/font_pack, do not edit
+ */
+
+#include "fonts_pk.h"
+
+static const uint8_t Font24CNP_Data[2094] =
+{
+    /* 0x41 'A' */
+    0x01, 0x00, 0x08, 0x17, 0x19, 0x95, 0xF0, 0x26, 0xF0, 0x27, 0xF0, 0x17, 0xF9, 0xE9, 0xE4, 0x14,
+    0xD5, 0x15, 0xC4, 0x25, 0xB5, 0x34, 0xB5, 0x35, 0xA4, 0x45, 0x95, 0x55, 0x85, 0x55, 0x84, 0x74,
+    0x7F, 0x02, 0x6F, 0x02, 0x5F, 0x04, 0x45, 0x95, 0x44, 0xA5, 0x35, 0xB5, 0x25, 0xB5, 0x24, 0xD4,
+    0x15, 0xDA, 0xD5,
+    /* 0x61 'a' */
+    0x01, 0x01, 0x0F, 0x0F, 0x12, 0x48, 0x5C, 0x2D, 0x25, 0x36, 0x13, 0x65, 0xB4, 0xB4, 0x5A, 0x2D,
+    0x17, 0x39, 0x69, 0x68, 0x6A, 0x5B, 0x2F, 0x07, 0x1E, 0x36, 0x24,
+    /* 0x62 'b' */
+    0x01, 0x02, 0x07, 0x11, 0x1A, 0x04, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0xD4, 0x27, 0x44,
+    0x1A, 0x2F, 0x01, 0x17, 0x36, 0x16, 0x5B, 0x7A, 0x79, 0x98, 0x98, 0x98, 0x8A, 0x7A, 0x7B, 0x55,
+    0x17, 0x36, 0x1F, 0x2E, 0x34, 0x26, 0x50,
+    /* 0x63 'c' */
+    0x01, 0x01, 0x0F, 0x0E, 0x12, 0x67, 0x5A, 0x2C, 0x17, 0x42, 0x15, 0x85, 0x95, 0x95, 0x94, 0xA4,
+    0xA5, 0x95, 0x95, 0xA5, 0x97, 0x42, 0x2C, 0x3B, 0x58, 0x10,
+    /* 0xB4CB */
+    0x01, 0x00, 0x07, 0x20, 0x1C, 0x94, 0x54, 0xF0, 0x44, 0x54, 0xF0, 0x44, 0x54, 0xF0, 0x44, 0x54,
+    0xF0, 0x44, 0x54, 0xF0, 0x44, 0x54, 0x62, 0x44, 0x34, 0x54, 0x54, 0x34, 0x34, 0x54, 0x46, 0x24,
+    0x34, 0x54, 0x25, 0x54, 0x3D, 0x15, 0x64, 0x3F, 0x03, 0x74, 0x34, 0x57, 0x94, 0x34, 0x55, 0xB4,
+    0x34, 0x54, 0xC4, 0x34, 0x54, 0xC4, 0x34, 0x54, 0xC4, 0x34, 0x54, 0xC4, 0x34, 0x54, 0xC4, 0x34,
+    0x54, 0xC4, 0x34, 0x54, 0x63, 0x34, 0x34, 0x54, 0x64, 0x24, 0x34, 0x54, 0x64, 0x24, 0x34, 0x27,
+    0x64, 0x24, 0x3D, 0x64, 0x2E, 0x24, 0x64, 0x2A, 0x65, 0x44, 0x18, 0xBC, 0x14, 0xF0, 0x1A, 0x20,
+    /* 0xB5C4 */
+    0x01, 0x01, 0x06, 0x1E, 0x1E, 0x53, 0x94, 0xD5, 0x85, 0xC4, 0x94, 0xD4, 0x85, 0xC4, 0x94, 0xAE,
+    0x2F, 0x0D, 0x1F, 0x04, 0x64, 0x14, 0x78, 0x68, 0x88, 0x68, 0x88, 0x67, 0x98, 0x67, 0x98, 0x69,
+    0x78, 0x64, 0x15, 0x68, 0x64, 0x25, 0x5F, 0x03, 0x34, 0x5F, 0x03, 0x44, 0x48, 0x64, 0x45, 0x38,
+    0x64, 0x55, 0x28, 0x64, 0x64, 0x28, 0x64, 0x63, 0x38, 0x64, 0xC8, 0x64, 0xC8, 0x64, 0xB9, 0x64,
+    0xB4, 0x14, 0x64, 0xB4, 0x1E, 0xB4, 0x1E, 0xA5, 0x14, 0x64, 0x3B, 0x24, 0x64, 0x3A, 0x30,
+    /* 0xB5E3 */
+    0x01, 0x00, 0x06, 0x20, 0x1E, 0xE4, 0xF0, 0xD4, 0xF0, 0xD4, 0xF0, 0xD4, 0xF0, 0xDF, 0x03, 0xEF,
+    0x03, 0xE4, 0xF0, 0xD4, 0xF0, 0xD4, 0xF0, 0xD4, 0xF0, 0x3F, 0x0A, 0x7F, 0x0A, 0x74, 0xF0, 0x24,
+    0x74, 0xF0, 0x24, 0x74, 0xF0, 0x24, 0x74, 0xF0, 0x24, 0x74, 0xF0, 0x24, 0x74, 0xF0, 0x24, 0x7F,
+    0x0A, 0x7F, 0x0A, 0x74, 0xF0, 0x24, 0xF0, 0xF0, 0x92, 0x43, 0x53, 0x52, 0x74, 0x25, 0x34, 0x44,
+    0x55, 0x34, 0x34, 0x44, 0x54, 0x44, 0x44, 0x44, 0x35, 0x45, 0x34, 0x45, 0x15, 0x64, 0x34, 0x54,
+    0x14, 0x74, 0x44, 0x45, 0x13, 0x74, 0x43, 0x63, 0x10,
+    /* 0xB5E7 */
+    0x01, 0x01, 0x06, 0x1F, 0x1E, 0xC4, 0xF0, 0xC4, 0xF0, 0xC4, 0xF0, 0xC4, 0xFF, 0x0D, 0x3F, 0x0D,
+    0x34, 0x84, 0x75, 0x34, 0x84, 0x75, 0x34, 0x84, 0x75, 0x34, 0x84, 0x75, 0x34, 0x84, 0x75, 0x34,
+    0x84, 0x75, 0x3F, 0x0D, 0x3F, 0x0D, 0x34, 0x84, 0x75, 0x34, 0x84, 0x75, 0x34, 0x84, 0x75, 0x34,
+    0x84, 0x75, 0x34, 0x84, 0x75, 0x34, 0x84, 0x75, 0x3F, 0x0D, 0x3F, 0x0D, 0x34, 0x84, 0xB3, 0x14,
+    0x84, 0xB4, 0xC4, 0xB4, 0xC4, 0xB4, 0xC4, 0xA5, 0xC4, 0xA4, 0xEF, 0x02, 0xFF, 0x20,
+    /* 0xB6D4 */
+    0x01, 0x00, 0x07, 0x20, 0x1C, 0xF0, 0xA4, 0xF0, 0xD4, 0xF0, 0xD4, 0x4D, 0xB4, 0x4D, 0xB4, 0xD4,
+    0xB4, 0xDF, 0x07, 0x22, 0x6F, 0x07, 0x14, 0x54, 0xB4, 0x54, 0x43, 0xC4, 0x55, 0x24, 0xC4, 0x64,
+    0x24, 0x32, 0x74, 0x74, 0x14, 0x24, 0x64, 0x78, 0x44, 0x54, 0x87, 0x45, 0x44, 0x96, 0x54, 0x44,
+    0xA4, 0x74, 0x34, 0x96, 0x65, 0x24, 0x96, 0x72, 0x44, 0x88, 0xC4, 0x89, 0xB4, 0x74, 0x25, 0xA4,
+    0x65, 0x34, 0xA4, 0x55, 0x45, 0x94, 0x45, 0x63, 0x95, 0x35, 0xF0, 0x44, 0x44, 0xEA, 0x52, 0xF9,
+    0x50,
+    /* 0xBAC3 */
+    0x01, 0x00, 0x06, 0x20, 0x1E, 0x44, 0xF0, 0xD4, 0xF0, 0xD4, 0x5F, 0x03, 0x54, 0x5F, 0x03, 0x54,
+    0xF0, 0x35, 0x44, 0xF0, 0x26, 0x2D, 0xA5, 0x4D, 0x95, 0x84, 0x24, 0x85, 0x94, 0x24, 0x75, 0x94,
+    0x34, 0x74, 0xA4, 0x34, 0x74, 0xA4, 0x34, 0x74, 0xA4, 0x34, 0x74, 0xA4, 0x3F, 0x08, 0x14, 0x3F,
+    0x09, 0x14, 0x34, 0x84, 0x94, 0x34, 0x84, 0xA4, 0x14, 0x94, 0xB8, 0x94, 0xC7, 0x94, 0xD5, 0xA4,
+    0xD6, 0x94, 0xD7, 0x84, 0xC9, 0x74, 0xB4, 0x25, 0x64, 0xA4, 0x43, 0x74, 0x94, 0xF4, 0x84, 0xAA,
+    0x92, 0xC8, 0x90,
+    /* 0xBADA */
+    0x01, 0x00, 0x08, 0x20, 0x1D, 0x3F, 0x0C, 0x5F, 0x0C, 0x54, 0x74, 0x84, 0x54, 0x12, 0x44, 0x33,
+    0x24, 0x58, 0x34, 0x34, 0x14, 0x54, 0x14, 0x24, 0x24, 0x24, 0x54, 0x15, 0x14, 0x15, 0x24, 0x54,
+    0x24, 0x14, 0x14, 0x34, 0x54, 0x32, 0x24, 0x13, 0x44, 0x54, 0x74, 0x84, 0x5F, 0x0C, 0x5F, 0x0C,
+    0x54, 0x74, 0x84, 0xF0, 0x14, 0xF0, 0xD4, 0xF0, 0x1F, 0x0D, 0x4F, 0x0D, 0xF0, 0x14, 0xF0, 0xD4,
+    0xF0, 0xD4, 0xEF, 0x0F, 0x0F, 0x0F, 0x04, 0xF0, 0xF0, 0x53, 0x43, 0x43, 0x53, 0x65, 0x24, 0x35,
+    0x35, 0x54, 0x35, 0x34, 0x45, 0x35, 0x44, 0x44, 0x45, 0x15, 0x55, 0x34, 0x59, 0x73, 0x52, 0x73,
+    0x10,
+    /* 0xC4E3 */
+    0x01, 0x00, 0x07, 0x20, 0x1D, 0x73, 0x53, 0xF0, 0x64, 0x35, 0xF0, 0x45, 0x34, 0xF0, 0x54, 0x34,
+    0xF0, 0x64, 0x3F, 0x04, 0x54, 0x3F, 0x05, 0x54, 0x34, 0xC4, 0x44, 0x34, 0xC4, 0x54, 0x24, 0x54,
+    0x44, 0x45, 0x24, 0x54, 0x35, 0x45, 0x32, 0x64, 0x34, 0x46, 0xB4, 0x43, 0x37, 0xB4, 0xA7, 0x54,
+    0x24, 0x23, 0x48, 0x54, 0x24, 0x14, 0x43, 0x14, 0x45, 0x24, 0x24, 0x42, 0x14, 0x44, 0x34, 0x24,
+    0x74, 0x44, 0x34, 0x34, 0x64, 0x34, 0x44, 0x34, 0x64, 0x34, 0x44, 0x44, 0x54, 0x24, 0x54, 0x44,
+    0x54, 0x24, 0x54, 0x45, 0x44, 0x15, 0x54, 0x54, 0x44, 0x14, 0x64, 0x53, 0x54, 0xB4, 0xD4, 0xB4,
+    0xD4, 0xA4, 0xE4, 0x59, 0xE4, 0x58, 0xB0,
+    /* 0xC5C9 */
+    0x01, 0x00, 0x07, 0x20, 0x1E, 0x23, 0xF0, 0x65, 0x25, 0xCD, 0x36, 0x2F, 0x03, 0x76, 0x19, 0xF0,
+    0x34, 0x14, 0xF0, 0x92, 0x24, 0xF0, 0xD4, 0xC4, 0xC4, 0x6B, 0x23, 0x64, 0x1E, 0x35, 0x54, 0x19,
+    0x95, 0x44, 0x14, 0x24, 0x96, 0x24, 0x14, 0x24, 0xA5, 0x24, 0x14, 0x24, 0x33, 0x53, 0x34, 0x14,
+    0x24, 0x25, 0xA4, 0x14, 0x2A, 0xB3, 0x24, 0x28, 0xD3, 0x24, 0x36, 0x73, 0x43, 0x24, 0x34, 0x94,
+    0x24, 0x24, 0x34, 0x94, 0x24, 0x24, 0x44, 0x84, 0x24, 0x24, 0x44, 0x74, 0x34, 0x24, 0x54, 0x64,
+    0x34, 0x24, 0x55, 0x54, 0x24, 0x34, 0x65, 0x44, 0x24, 0x34, 0x32, 0x15, 0x35, 0x15, 0x34, 0x14,
+    0x26, 0x14, 0x24, 0x48, 0x45, 0x14, 0x15, 0x46, 0x73, 0x24, 0x14, 0x45, 0xE4, 0x22, 0x63, 0xE0,
+    /* 0xC8ED */
+    0x01, 0x00, 0x05, 0x20, 0x20, 0x64, 0x74, 0xF0, 0x14, 0x84, 0xF0, 0x14, 0x84, 0xF0, 0x14, 0x74,
+    0xF0, 0x14, 0x84, 0xCF, 0x0F, 0x0F, 0x0F, 0x04, 0x34, 0x74, 0x95, 0x34, 0x74, 0x94, 0x48, 0x24,
+    0x34, 0x25, 0x34, 0x14, 0x24, 0x34, 0x24, 0x44, 0x14, 0x14, 0x44, 0x15, 0x44, 0x14, 0x23, 0x44,
+    0x14, 0x44, 0x24, 0x94, 0x94, 0x24, 0x93, 0xAE, 0x53, 0xAE, 0x45, 0xF4, 0x85, 0xF4, 0x85, 0xF4,
+    0x86, 0xE4, 0x86, 0xE4, 0x77, 0xE9, 0x28, 0xAC, 0x14, 0x14, 0x6C, 0x54, 0x24, 0x55, 0x24, 0x54,
+    0x35, 0xB4, 0x45, 0x44, 0xB4, 0x35, 0x55, 0xA4, 0x25, 0x75, 0x9A, 0x96, 0x79, 0xB5, 0x74, 0x12,
+    0xE3, 0x10,
+    /* 0xCAF7 */
+    0x01, 0x00, 0x07, 0x20, 0x1E, 0x44, 0xF0, 0x33, 0x74, 0xF0, 0x33, 0x74, 0xF0, 0x33, 0x74, 0x2B,
+    0x53, 0x74, 0x2B, 0x53, 0x74, 0x94, 0x53, 0x3B, 0x6F, 0x0B, 0x6F, 0x44, 0x93, 0x63, 0x74, 0x32,
+    0x34, 0x63, 0x65, 0x24, 0x24, 0x63, 0x65, 0x33, 0x27, 0x33, 0x67, 0x14, 0x17, 0x33, 0x59, 0x17,
+    0x14, 0x23, 0x5F, 0x02, 0x14, 0x23, 0x5A, 0x16, 0x24, 0x13, 0x47, 0x12, 0x25, 0x34, 0x13, 0x47,
+    0x64, 0x43, 0x13, 0x38, 0x56, 0x73, 0x33, 0x14, 0x56, 0x73, 0x33, 0x14, 0x48, 0x63, 0x32, 0x24,
+    0x39, 0x63, 0x74, 0x34, 0x24, 0x53, 0x74, 0x24, 0x35, 0x43, 0x74, 0x14, 0x54, 0x43, 0x79, 0x53,
+    0x53, 0x74, 0x12, 0xE4, 0x74, 0xC9, 0x74, 0xD7, 0x84, 0xF0, 0x90,
+    /* 0xCCE5 */
+    0x01, 0x00, 0x07, 0x20, 0x1E, 0x64, 0x84, 0xF0, 0x14, 0x84, 0xF0, 0x14, 0x84, 0xF4, 0x94, 0xF4,
+    0x94, 0xF4, 0x94, 0xEF, 0x0D, 0x4F, 0x0D, 0x35, 0x78, 0xC5, 0x79, 0xA6, 0x79, 0xA6, 0x6A, 0x97,
+    0x6B, 0x87, 0x54, 0x17, 0x78, 0x54, 0x18, 0x63, 0x14, 0x44, 0x24, 0x13, 0x62, 0x24, 0x44, 0x24,
+    0x14, 0x94, 0x34, 0x34, 0x14, 0x94, 0x34, 0x34, 0x24, 0x84, 0x24, 0x44, 0x34, 0x74, 0x15, 0x44,
+    0x35, 0x69, 0x54, 0x45, 0x58, 0x1D, 0x15, 0x47, 0x2D, 0x24, 0x46, 0x84, 0x72, 0x54, 0xA4, 0xE4,
+    0xA4, 0xE4, 0xA4, 0xE4, 0xA4, 0xE4, 0xA4, 0xA0,
+    /* 0xCEA2 */
+    0x01, 0x00, 0x06, 0x20, 0x1F, 0x62, 0x53, 0x74, 0xA4, 0x43, 0x74, 0xA3, 0x53, 0x73, 0xA8, 0x13,
+    0x14, 0x23, 0x94, 0x14, 0x13, 0x14, 0x14, 0x94, 0x14, 0x13, 0x14, 0x13, 0x94, 0x24, 0x13, 0x14,
+    0x1A, 0x14, 0x34, 0x13, 0x14, 0x1F, 0x34, 0x13, 0x18, 0x24, 0x14, 0x1F, 0x05, 0x24, 0x22, 0x2F,
+    0x05, 0x24, 0x63, 0x98, 0x23, 0x64, 0xC5, 0x23, 0x54, 0xC6, 0x23, 0x54, 0x2F, 0x01, 0x14, 0x45,
+    0x2B, 0x28, 0x45, 0xF8, 0x36, 0xF0, 0x16, 0x37, 0xF0, 0x16, 0x37, 0x2A, 0x46, 0x32, 0x14, 0x2A,
+    0x46, 0x64, 0x24, 0x33, 0x54, 0x74, 0x24, 0x33, 0x13, 0x14, 0x74, 0x24, 0x3C, 0x74, 0x24, 0x36,
+    0x16, 0x64, 0x24, 0x26, 0x18, 0x54, 0x14, 0x35, 0x14, 0x14, 0x54, 0x14, 0x43, 0x15, 0x24, 0x48,
+    0x94, 0x44, 0x34, 0x12, 0x94, 0x54, 0x34, 0xD2, 0x73,
+    /* 0xCEAA */
+    0x01, 0x01, 0x07, 0x1D, 0x1E, 0xC4, 0xF0, 0x13, 0x64, 0xF5, 0x54, 0xF0, 0x15, 0x44, 0xF0, 0x25,
+    0x34, 0xF0, 0x44, 0x24, 0xF0, 0x52, 0x34, 0xF0, 0xA4, 0xDF, 0x0F, 0x0F, 0x0D, 0xC4, 0x94, 0xB5,
+    0x94, 0xB4, 0xA4, 0xB4, 0xA4, 0xB4, 0x12, 0x74, 0xA9, 0x64, 0xA4, 0x24, 0x54, 0x95, 0x34, 0x44,
+    0x94, 0x45, 0x34, 0x85, 0x55, 0x24, 0x84, 0x74, 0x24, 0x75, 0x82, 0x34, 0x65, 0xE4, 0x55, 0xE5,
+    0x45, 0xF5, 0x35, 0xF0, 0x14, 0x35, 0xF0, 0x15, 0x25, 0x9C, 0x25, 0xAB, 0x43, 0xF0, 0xA0,
+    /* 0xCFC2 */
+    0x01, 0x00, 0x08, 0x20, 0x1C, 0x0F, 0x0F, 0x0F, 0x0F, 0x04, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0,
+    0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC7, 0xF0, 0xA9, 0xF0, 0x8A, 0xF0, 0x75, 0x16, 0xF0, 0x55,
+    0x26, 0xF0, 0x45, 0x46, 0xF0, 0x25, 0x56, 0xF0, 0x15, 0x75, 0xF5, 0x85, 0xE5, 0x93, 0xF5, 0xF0,
+    0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0,
+    0xC5, 0xF0,
+    /* 0xD1A9 */
+    0x01, 0x01, 0x08, 0x1E, 0x1C, 0x2F, 0x0B, 0x4F, 0x0B, 0xF4, 0xF0, 0xB4, 0xDF, 0x0F, 0x0F, 0x0F,
+    0x04, 0x94, 0x98, 0x94, 0x9F, 0x0F, 0x0F, 0x0F, 0x04, 0xD4, 0xF0, 0xB4, 0xF0, 0x2F, 0x07, 0x8F,
+    0x07, 0xF0, 0x24, 0xF0, 0xF0, 0xFF, 0x0B, 0x4F, 0x0B, 0xF0, 0xB4, 0xF0, 0xB4, 0x4F, 0x0B, 0x4F,
+    0x0B, 0xF0, 0xB4, 0xF0, 0xB4, 0xF0, 0xB4, 0x3F, 0x0C, 0x3F, 0x0C, 0xF0, 0xB4, 0x20,
+    /* 0xD1C5 */
+    0x01, 0x00, 0x06, 0x20, 0x1F, 0xF0, 0x23, 0x13, 0xF0, 0x98, 0x9D, 0x24, 0x14, 0x8D, 0x14, 0x34,
+    0xD3, 0x54, 0x34, 0xD3, 0x44, 0x52, 0x94, 0x13, 0x3F, 0x04, 0x23, 0x23, 0x3F, 0x04, 0x23, 0x23,
+    0x25, 0x53, 0x84, 0x23, 0x16, 0x53, 0x84, 0x2A, 0x53, 0x84, 0x23, 0x16, 0x53, 0x83, 0x33, 0x43,
+    0x53, 0x8F, 0x0F, 0x2F, 0x0F, 0x74, 0x43, 0x53, 0xC5, 0x43, 0x53, 0xC5, 0x43, 0x53, 0xB6, 0x43,
+    0x53, 0xB6, 0x43, 0x53, 0xA7, 0x4F, 0x02, 0x43, 0x13, 0x4F, 0x02, 0x34, 0x13, 0x43, 0x53, 0x84,
+    0x23, 0x43, 0x53, 0x74, 0x33, 0x43, 0x53, 0x74, 0x33, 0x43, 0x53, 0x82, 0x43, 0x43, 0x53, 0xE3,
+    0x4F, 0x03, 0x64, 0x4F, 0x03, 0x37, 0x43, 0xF0, 0x36, 0x53, 0xF0,
+    /* 0xD3A6 */
+    0x01, 0x00, 0x05, 0x20, 0x20, 0xF3, 0xF0, 0xD5, 0xF0, 0xD4, 0xF0, 0xD5, 0xF0, 0xD4, 0xFF, 0x0E,
+    0x3F, 0x0E, 0x34, 0xF0, 0xD4, 0xF0, 0xD4, 0x84, 0x64, 0x64, 0x84, 0x64, 0x64, 0x13, 0x44, 0x64,
+    0x69, 0x35, 0x45, 0x64, 0x14, 0x44, 0x44, 0x74, 0x14, 0x44, 0x44, 0x74, 0x15, 0x34, 0x44, 0x74,
+    0x24, 0x34, 0x35, 0x74, 0x24, 0x35, 0x24, 0x84, 0x24, 0x44, 0x24, 0x84, 0x25, 0x34, 0x15, 0x84,
+    0x34, 0x34, 0x14, 0x94, 0x34, 0x34, 0x14, 0x94, 0x34, 0x34, 0x14, 0x84, 0x45, 0x64, 0x94, 0x53,
+    0x74, 0x94, 0xF4, 0x94, 0xE4, 0x94, 0xF4, 0x94, 0x1F, 0x0F, 0x2F, 0x0F, 0xF0, 0xE2, 0xF0, 0xE0,
+    /* 0xD5F3 */
+    0x01, 0x01, 0x06, 0x1F, 0x1F, 0xF0, 0x24, 0xF0, 0xB4, 0xBB, 0x54, 0xBB, 0x54, 0xB4, 0x2F, 0x0E,
+    0x2F, 0x0E, 0x24, 0x44, 0xD4, 0x24, 0x44, 0xD4, 0x14, 0x54, 0x15, 0x74, 0x14, 0x44, 0x25, 0x74,
+    0x14, 0x44, 0x25, 0x78, 0x45, 0x25, 0x78, 0x44, 0x35, 0x78, 0x44, 0x35, 0x74, 0x14, 0x24, 0x45,
+    0x74, 0x14, 0x2F, 0x04, 0x14, 0x24, 0x1F, 0x04, 0x14, 0x24, 0x95, 0x74, 0x33, 0x95, 0x74, 0x34,
+    0x85, 0x74, 0x34, 0x85, 0x74, 0x34, 0x85, 0x74, 0x3F, 0x0D, 0x2F, 0x0F, 0x05, 0x95, 0x79, 0xA5,
+    0x74, 0xF5, 0x74, 0xF5, 0x74, 0xF5, 0x74, 0xF5, 0x74, 0xF5, 0x70,
+    /* 0xD7D3 */
+    0x01, 0x00, 0x08, 0x20, 0x1C, 0x3F, 0x0B, 0x6F, 0x0B, 0xF0, 0xB6, 0xF0, 0x96, 0xF0, 0xA6, 0xF0,
+    0xA6, 0xF0, 0xA5, 0xF0, 0xA6, 0xF0, 0xA6, 0xF0, 0xA5, 0xF0, 0xC5, 0xF0, 0xC5, 0xDF, 0x0F, 0x0F,
+    0x0F, 0x04, 0xE5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0,
+    0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC5, 0xF0, 0xC4, 0xF0, 0x6B, 0xF0, 0x79, 0xF0,
+    /* 0xD7D6 */
+    0x01, 0x00, 0x05, 0x20, 0x1F, 0xE3, 0xF0, 0xD4, 0xF0, 0xE4, 0xF0, 0xD5, 0xF0, 0xD4, 0xEF, 0x0F,
+    0x2F, 0x0F, 0x24, 0xF0, 0x74, 0x24, 0xF0, 0x74, 0x24, 0xF0, 0x74, 0x24, 0xF0, 0x74, 0x24, 0x1F,
+    0x05, 0x14, 0x7F, 0x05, 0xF0, 0xB6, 0xF0, 0x96, 0xF0, 0xA6, 0xF0, 0x96, 0xF0, 0xB4, 0xF0, 0xD4,
+    0xDF, 0x0F, 0x0F, 0x0F, 0x04, 0xF4, 0xF0, 0xD4, 0xF0, 0xD4, 0xF0, 0xD4, 0xF0, 0xD4, 0xF0, 0xD4,
+    0xF0, 0xC5, 0xF0, 0xC4, 0xF0, 0x7A, 0xF0, 0x79, 0xF0,
+    /* 0xDDAE */
+    0x01, 0x00, 0x06, 0x20, 0x1F, 0xA4, 0x54, 0xF0, 0x44, 0x54, 0xF0, 0x44, 0x54, 0x9F, 0x0F, 0x0F,
+    0x0F, 0x04, 0xA4, 0x54, 0xE4, 0x14, 0x54, 0xE4, 0xF0, 0xCF, 0x0B, 0x6F, 0x0B, 0x54, 0xF0, 0xC4,
+    0xF0, 0xD4, 0xF0, 0xCF, 0x0C, 0x44, 0x1F, 0x08, 0x62, 0x14, 0x53, 0x74, 0x94, 0x45, 0x64, 0x94,
+    0x56, 0x44, 0x93, 0x83, 0x54, 0x4F, 0x0F, 0x0F, 0x0F, 0x04, 0x44, 0x44, 0x83, 0x94, 0x45, 0x64,
+    0x93, 0x75, 0x44, 0x84, 0x83, 0x54, 0x8F, 0x0D, 0x4F, 0x0D, 0xF0, 0x94, 0xF0, 0xC4, 0xF0, 0x7A,
+    0xF0, 0x79, 0x70,
+};
+
+static const uint16_t Font24CNP_Code[26] =
+{
+    0x0041, 0x0061, 0x0062, 0x0063, 0xB4CB, 0xB5C4, 0xB5E3, 0xB5E7, 0xB6D4, 0xBAC3,
+    0xBADA, 0xC4E3, 0xC5C9, 0xC8ED, 0xCAF7, 0xCCE5, 0xCEA2, 0xCEAA, 0xCFC2, 0xD1A9,
+    0xD1C5, 0xD3A6, 0xD5F3, 0xD7D3, 0xD7D6, 0xDDAE,
+};
+
+static const uint32_t Font24CNP_Offset[27] =
+{
+         0,     51,     78,    117,    143,    239,    318,    407,    485,    566,
+       649,    746,    849,    961,   1059,   1166,   1254,   1375,   1454,   1520,
+      1582,   1689,   1785,   1876,   1938,   2011,   2094,
+};
+
+const pFONT Font24CNP =
+{
+    Font24CNP_Data,
+    Font24CNP_Code,
+    Font24CNP_Offset,
+    26,    /* count */
+    32,    /* width */
+    24,    /* ascii_width */
+    41,    /* height */
+    4,     /* run0_bits */
+    4,     /* run1_bits */
+};
@@ -0,0 +1,75 @@
+/*
+ * fonts_aa.h
+ * Anti-aliased fonts: 4 or 8 bit coverage per pixel, metrics per glyph
+ *
+ * Generated from TTF/BDF files by Tools/font_conv. Every glyph bitmap is
+ * cropped to its ink box and stored line by line, lines of whole bytes:
+ * A4 glyphs have an even width (the converter pads them with a transparent
+ * column), two pixels per byte, the left one in the low nibble like the
+ * DMA2D A4 format. The tables are read as they are by the DMA2D (flash and
+ * SDRAM are on its bus), see GUI_Text.h.
+ *
+ * Codes are Unicode (BMP). A font of one range is indexed by code - first;
+ * any other set (Latin + symbols, the CJK characters a UI uses) has a
+ * sorted code table searched by binary search. Fonts are chained as
+ * fallbacks by GUI_Text_Fonts_t.
+ *
+ * Glyphs are proportional (advance per glyph); pairs that the font kerns
+ * by a whole pixel or more are listed in a kerning table sorted by
+ * (left, right), searched by GUI_Text_Kerning().
+ */
+
+#ifndef FONTS_AA_H_
+#define FONTS_AA_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <stdint.h>
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint32_t offset;              /* first byte in the bitmap table */
+    uint8_t  width;               /* bitmap, 0 for blank glyphs */
+    uint8_t  height;
+    int8_t   left;                /* pen position to the bitmap left edge */
+    int8_t   top;                 /* baseline to the bitmap top, up */
+    uint8_t  advance;             /* pen move to the next glyph */
+} aGLYPH;
+
+typedef struct
+{
+    uint16_t left;                /* codes of the pair */
+    uint16_t right;
+    int8_t   dx;                  /* added to the advance of left */
+} aKERN;
+
+typedef struct
+{
+    const uint8_t *bitmap;
+    const aGLYPH  *glyph;
+    const uint16_t *code;         /* sorted codes of the glyphs, NULL: one range */
+    uint16_t first;               /* code of glyph[0] */
+    uint16_t count;
+    uint8_t  bpp;                 /* 4 or 8 */
+    uint8_t  height;              /* line height */
+    uint8_t  ascent;              /* line top to baseline */
+    const aKERN *kern;            /* NULL if none */
+    uint16_t kern_count;
+} aFONT;
+
+/******************************************************************************
+ *                           GLOBAL DATA PROTOTYPES                           *
+ ******************************************************************************/
+
+extern const aFONT Font20AA;          /* ASCII */
+extern const aFONT Font20AAX;         /* Latin-1 and symbols */
+extern const aFONT Font24CJK;         /* the CH_CN 24 glyphs */
+
+#endif /* FONTS_AA_H_ */
@@ -0,0 +1,197 @@
+/*
+ * fonts_pk.c
+ * Packed 1 bpp fonts for the Chinese (GB2312) character sets, and decoder
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "fonts_pk.h"
+
+/******************************************************************************
+ *                            LOCAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    const uint8_t *p;
+    uint32_t acc;
+    uint32_t bits;                /* valid low bits of acc */
+} PK_Bits_t;
+
+typedef struct
+{
+    uint8_t  *cell;
+    uint32_t pitch;
+} PK_Cell_t;
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static uint32_t PK_Read(PK_Bits_t *b, uint32_t n);
+static void PK_SpanA4(uint16_t x, uint16_t y, uint16_t len, void *user);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+const uint8_t* FONT_PK_Find(const pFONT *font, uint16_t code)
+{
+    uint32_t lo = 0U, hi = font->count;
+
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2U;
+
+        if (font->code[mid] < code)
+        {
+            lo = mid + 1U;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    if ((lo < font->count) && (font->code[lo] == code))
+    {
+        return font->data + font->offset[lo];
+    }
+    return NULL;
+}
+
+uint16_t FONT_PK_NextCode(const char **text)
+{
+    const uint8_t *p = (const uint8_t*)*text;
+
+    if (p[0] == 0U)
+    {
+        return 0U;
+    }
+    if ((p[0] < 0x80U) || (p[1] == 0U))
+    {
+        *text += 1;
+        return p[0];
+    }
+    *text += 2;
+    return (uint16_t)((p[0] << 8) | p[1]);
+}
+
+uint8_t FONT_PK_Advance(const pFONT *font, uint16_t code)
+{
+    return (code < 0x80U) ? font->ascii_width : font->width;
+}
+
+uint32_t FONT_PK_Spans(const pFONT *font, const uint8_t *glyph, FONT_PK_Span_t span,
+        void *user)
+{
+    uint32_t x0 = glyph[1], y0 = glyph[2], w = glyph[3], h = glyph[4];
+    uint32_t spans = 0U;
+    PK_Bits_t b = { glyph + FONT_PK_HEADER_BYTES, 0U, 0U };
+
+    if ((w == 0U) || (h == 0U))
+    {
+        return 0U;
+    }
+
+    if (glyph[0] & FONT_PK_FLAG_RLE)
+    {
+        uint32_t col = 0U, row = 0U;
+
+        /* The pairs cover the box exactly */
+        while (row < h)
+        {
+            uint32_t zeros = PK_Read(&b, font->run0_bits);
+            uint32_t ones = PK_Read(&b, font->run1_bits);
+
+            col += zeros;
+            while (col >= w)
+            {
+                col -= w;
+                row++;
+            }
+            while ((ones != 0U) && (row < h))
+            {
+                uint32_t n = ((w - col) < ones) ? (w - col) : ones;
+
+                span((uint16_t)(x0 + col), (uint16_t)(y0 + row), (uint16_t)n, user);
+                spans++;
+                ones -= n;
+                col += n;
+                if (col == w)
+                {
+                    col = 0U;
+                    row++;
+                }
+            }
+        }
+    }
+    else
+    {
+        for (uint32_t row = 0U; row < h; row++)
+        {
+            uint32_t start = 0U, inside = 0U;
+
+            for (uint32_t col = 0U; col < w; col++)
+            {
+                uint32_t bit = PK_Read(&b, 1U);
+
+                if (bit && !inside)
+                {
+                    start = col;
+                    inside = 1U;
+                }
+                else if (!bit && inside)
+                {
+                    span((uint16_t)(x0 + start), (uint16_t)(y0 + row), (uint16_t)(col - start), user);
+                    spans++;
+                    inside = 0U;
+                }
+            }
+            if (inside)
+            {
+                span((uint16_t)(x0 + start), (uint16_t)(y0 + row), (uint16_t)(w - start), user);
+                spans++;
+            }
+        }
+    }
+    return spans;
+}
+
+void FONT_PK_ExpandA4(const pFONT *font, const uint8_t *glyph, uint8_t *cell,
+        uint32_t pitch)
+{
+    PK_Cell_t c = { cell, pitch };
+
+    memset(cell, 0, pitch * font->height);
+    (void)FONT_PK_Spans(font, glyph, PK_SpanA4, &c);
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+/* n bits MSB first, n <= 24 */
+static uint32_t PK_Read(PK_Bits_t *b, uint32_t n)
+{
+    while (b->bits < n)
+    {
+        b->acc = (b->acc << 8) | *b->p++;
+        b->bits += 8U;
+    }
+    b->bits -= n;
+    return (b->acc >> b->bits) & ((1U << n) - 1U);
+}
+
+static void PK_SpanA4(uint16_t x, uint16_t y, uint16_t len, void *user)
+{
+    PK_Cell_t *c = (PK_Cell_t*)user;
+    uint8_t *line = c->cell + (uint32_t)y * c->pitch;
+
+    for (uint32_t i = x; i < (uint32_t)(x + len); i++)
+    {
+        line[i >> 1] |= (i & 1U) ? 0xF0U : 0x0FU;
+    }
+}
@@ -0,0 +1,82 @@
+/*
+ * fonts_pk.h
+ * Packed 1 bpp fonts for the Chinese (GB2312) character sets, and decoder
+ *
+ * The CH_CN tables (fonts.h) reserve a 41x32 cell per glyph whatever the
+ * font size. Here every glyph is cropped to its ink box and stored at that
+ * size, raw or run length coded, whichever is smaller; an index sorted by
+ * code gives its record by binary search. Tables are generated by
+ * Tools/font_pack from the CH_CN tables or from any TTF/BDF font.
+ *
+ * Glyph record: flags, x, y, width, height (ink box in the cell), then the
+ * width * height pixels in raster order, MSB first, without line padding:
+ *  - raw: one bit per pixel
+ *  - RLE: pairs of (background run: run0_bits, ink run: run1_bits) that
+ *    cover the box exactly, runs go on over the line ends.
+ *
+ * Codes: ASCII as is, GB2312 as first byte << 8 | second byte.
+ */
+
+#ifndef FONTS_PK_H_
+#define FONTS_PK_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+#define FONT_PK_HEADER_BYTES                     (5U)
+#define FONT_PK_FLAG_RLE                         (0x01U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    const uint8_t  *data;         /* glyph records */
+    const uint16_t *code;         /* sorted */
+    const uint32_t *offset;       /* record of code[i] in data, count + 1 */
+    uint16_t count;
+    uint8_t  width;               /* cell of the GB2312 glyphs */
+    uint8_t  ascii_width;         /* cell of the ASCII glyphs */
+    uint8_t  height;
+    uint8_t  run0_bits;           /* RLE background runs */
+    uint8_t  run1_bits;           /* RLE ink runs */
+} pFONT;
+
+/* Ink span of a glyph line, in cell coordinates */
+typedef void (*FONT_PK_Span_t)(uint16_t x, uint16_t y, uint16_t len, void *user);
+
+/******************************************************************************
+ *                           GLOBAL DATA PROTOTYPES                           *
+ ******************************************************************************/
+
+extern const pFONT Font12CNP;
+extern const pFONT Font24CNP;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Glyph record of a code, NULL if the font doesn't have it */
+extern const uint8_t* FONT_PK_Find(const pFONT *font, uint16_t code);
+/* Next code of a string (ASCII or GB2312 pair), 0 at the end */
+extern uint16_t FONT_PK_NextCode(const char **text);
+/* Cell width of a code */
+extern uint8_t FONT_PK_Advance(const pFONT *font, uint16_t code);
+
+/* Decodes a glyph as ink spans, line by line; returns the span count */
+extern uint32_t FONT_PK_Spans(const pFONT *font, const uint8_t *glyph, FONT_PK_Span_t span,
+        void *user);
+/* Decodes a glyph into an A4 cell of font->height lines, cleared first
+ * (left pixel in the low nibble, pitch in bytes) */
+extern void FONT_PK_ExpandA4(const pFONT *font, const uint8_t *glyph, uint8_t *cell,
+        uint32_t pitch);
+
+#endif /* FONTS_PK_H_ */
@@ -0,0 +1,510 @@
+/*
+ * GUI_Label.c
+ * Cache of pre-rendered text labels in SDRAM, drawn by one DMA2D blit
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "main.h"
+#include "GUI_Label.h"
+#include "GUI_Layout.h"
+#include "BSP_DMA2D.h"
+#include "vision_simd.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+/* Buffers start on a cache line */
+#define LABEL_ALIGN                   (32U)
+#define LABEL_FNV_OFFSET              (2166136261U)
+#define LABEL_FNV_PRIME               (16777619U)
+
+/******************************************************************************
+ *                            LOCAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint8_t     valid;
+    uint8_t     format;           /* GUI_Label_Format_t */
+    uint16_t    fg;               /* RGB565 only */
+    uint16_t    bg;
+    int16_t     x;                /* buffer origin from the line box */
+    int16_t     y;
+    uint16_t    width;
+    uint16_t    height;
+    uint8_t     *buf;
+    uint32_t    size;             /* bytes taken in the pool */
+    uint32_t    hash;
+    uint32_t    used;             /* draw stamp, for the LRU */
+    uint32_t    render_cycles;
+    GUI_Text_Fonts_t fonts;
+    char        text[GUI_LABEL_TEXT_MAX];
+} Label_Entry_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    GUI_Label_Stats_t   stats;
+    uint32_t            uses;
+    uint32_t            saved_cycles;     /* below a microsecond */
+    Label_Entry_t       entry[GUI_LABEL_ENTRIES];
+    GUI_Layout_Glyph_t  glyph[GUI_LABEL_GLYPHS];
+} Label;
+
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint8_t Label_Pool[GUI_LABEL_POOL_BYTES];
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static uint32_t Hash(const char *text, const GUI_Text_Fonts_t *fonts, uint16_t fg, uint16_t bg,
+        GUI_Label_Format_t format);
+static Label_Entry_t* Find(uint32_t hash, const char *text, const GUI_Text_Fonts_t *fonts,
+        uint16_t fg, uint16_t bg, GUI_Label_Format_t format);
+static Label_Entry_t* Render(const char *text, const GUI_Text_Fonts_t *fonts, uint16_t fg,
+        uint16_t bg, GUI_Label_Format_t format);
+static uint8_t* Alloc(uint32_t size);
+static void Evict(Label_Entry_t *e);
+static void Blit(const GUI_Text_Surface_t *s, const Label_Entry_t *e, int32_t x, int32_t y,
+        uint16_t fg);
+static void Bypass(const GUI_Text_Surface_t *s, int16_t x, int16_t y, const char *text,
+        const GUI_Text_Fonts_t *fonts, uint16_t fg, uint16_t bg, GUI_Label_Format_t format);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void GUI_Label_Init(void)
+{
+    memset(&Label, 0, sizeof(Label));
+    VISION_CyclesInit();
+}
+
+void GUI_Label_Draw(int16_t x, int16_t y, const char *text, const aFONT *font,
+        uint16_t fg, uint16_t bg, GUI_Label_Format_t format)
+{
+    GUI_Text_Fonts_t fonts = { { font }, 1U };
+
+    GUI_Label_DrawFonts(x, y, text, &fonts, fg, bg, format);
+}
+
+void GUI_Label_DrawFonts(int16_t x, int16_t y, const char *text,
+        const GUI_Text_Fonts_t *fonts, uint16_t fg, uint16_t bg, GUI_Label_Format_t format)
+{
+    const GUI_Text_Surface_t *s = GUI_Text_GetSurface();
+    uint32_t hash, start;
+    Label_Entry_t *e;
+
+    if (strlen(text) >= GUI_LABEL_TEXT_MAX)
+    {
+        Bypass(s, x, y, text, fonts, fg, bg, format);
+        return;
+    }
+    hash = Hash(text, fonts, fg, bg, format);
+    e = Find(hash, text, fonts, fg, bg, format);
+    if (e == NULL)
+    {
+        e = Render(text, fonts, fg, bg, format);
+        if (e == NULL)
+        {
+            Bypass(s, x, y, text, fonts, fg, bg, format);
+            return;
+        }
+        e->hash = hash;
+        Label.stats.misses++;
+        e->used = ++Label.uses;
+        Blit(s, e, x, y, fg);
+        return;
+    }
+
+    start = VISION_CYCLES();
+    Blit(s, e, x, y, fg);
+    start = VISION_CYCLES() - start;
+    Label.stats.hits++;
+    e->used = ++Label.uses;
+    if (e->render_cycles > start)
+    {
+        uint32_t mhz = SystemCoreClock / 1000000U;
+
+        Label.saved_cycles += e->render_cycles - start;
+        Label.stats.saved_us += Label.saved_cycles / mhz;
+        Label.saved_cycles %= mhz;
+    }
+}
+
+void GUI_Label_Invalidate(const char *text)
+{
+    for (uint32_t i = 0U; i < GUI_LABEL_ENTRIES; i++)
+    {
+        Label_Entry_t *e = &Label.entry[i];
+
+        if (e->valid && ((text == NULL) || (strcmp(e->text, text) == 0)))
+        {
+            e->valid = 0U;
+            Label.stats.bytes -= e->size;
+        }
+    }
+}
+
+const GUI_Label_Stats_t* GUI_Label_GetStats(void)
+{
+    return &Label.stats;
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+/* FNV-1a of the key */
+static uint32_t Hash(const char *text, const GUI_Text_Fonts_t *fonts, uint16_t fg, uint16_t bg,
+        GUI_Label_Format_t format)
+{
+    uint32_t h = LABEL_FNV_OFFSET;
+
+    for (; *text != '\0'; text++)
+    {
+        h = (h ^ (uint8_t)*text) * LABEL_FNV_PRIME;
+    }
+    for (uint32_t i = 0U; i < fonts->count; i++)
+    {
+        h = (h ^ (uint32_t)(uintptr_t)fonts->font[i]) * LABEL_FNV_PRIME;
+    }
+    if (format == GUI_LABEL_RGB565)
+    {
+        h = (h ^ (((uint32_t)fg << 16) | bg)) * LABEL_FNV_PRIME;
+    }
+    return (h ^ (uint32_t)format) * LABEL_FNV_PRIME;
+}
+
+static Label_Entry_t* Find(uint32_t hash, const char *text, const GUI_Text_Fonts_t *fonts,
+        uint16_t fg, uint16_t bg, GUI_Label_Format_t format)
+{
+    for (uint32_t i = 0U; i < GUI_LABEL_ENTRIES; i++)
+    {
+        Label_Entry_t *e = &Label.entry[i];
+        uint32_t f;
+
+        if (!e->valid || (e->hash != hash) || (e->format != (uint8_t)format) ||
+            (e->fonts.count != fonts->count) ||
+            ((format == GUI_LABEL_RGB565) && ((e->fg != fg) || (e->bg != bg))))
+        {
+            continue;
+        }
+        for (f = 0U; (f < fonts->count) && (e->fonts.font[f] == fonts->font[f]); f++)
+        {
+        }
+        if ((f == fonts->count) && (strcmp(e->text, text) == 0))
+        {
+            return e;
+        }
+    }
+    return NULL;
+}
+
+/* Lays out and rasterizes a label in a new entry, NULL if it can't be */
+static Label_Entry_t* Render(const char *text, const GUI_Text_Fonts_t *fonts, uint16_t fg,
+        uint16_t bg, GUI_Label_Format_t format)
+{
+    uint32_t start = VISION_CYCLES();
+    const aFONT *line = fonts->font[0];
+    GUI_Layout_t layout;
+    Label_Entry_t *e = NULL;
+    int32_t x0 = INT16_MAX, y0 = INT16_MAX, x1 = INT16_MIN, y1 = INT16_MIN;
+    uint32_t pixels, size;
+    uint8_t *buf;
+
+    GUI_Layout_Init(&layout, Label.glyph, GUI_LABEL_GLYPHS);
+    (void)GUI_Layout_TextFonts(&layout, text, fonts, 0U, 0U, GUI_LAYOUT_ALIGN_LEFT);
+    if (layout.cut)
+    {
+        return NULL;
+    }
+
+    /* Ink box; the opaque labels cover their line boxes too */
+    if (format == GUI_LABEL_RGB565)
+    {
+        x0 = 0;
+        y0 = 0;
+        x1 = layout.width;
+        y1 = layout.height;
+    }
+    for (uint32_t i = 0U; i < layout.count; i++)
+    {
+        const GUI_Layout_Glyph_t *lg = &layout.glyph[i];
+        const aGLYPH *g = &fonts->font[lg->font]->glyph[lg->index];
+        int32_t gx = lg->x + g->left;
+        int32_t gy = lg->y + line->ascent - g->top;
+
+        if (g->height != 0U)
+        {
+            x0 = (gx < x0) ? gx : x0;
+            y0 = (gy < y0) ? gy : y0;
+            x1 = ((gx + g->width) > x1) ? (gx + g->width) : x1;
+            y1 = ((gy + g->height) > y1) ? (gy + g->height) : y1;
+        }
+    }
+    if (x1 <= x0)
+    {
+        x0 = y0 = x1 = y1 = 0;
+    }
+    pixels = (uint32_t)(x1 - x0) * (uint32_t)(y1 - y0);
+    size = pixels * ((format == GUI_LABEL_RGB565) ? 2U : 1U);
+    size = (size + LABEL_ALIGN - 1U) & ~(LABEL_ALIGN - 1U);
+    if (size > GUI_LABEL_POOL_BYTES)
+    {
+        return NULL;
+    }
+
+    /* A free entry, else the least recently drawn one */
+    for (uint32_t i = 0U; i < GUI_LABEL_ENTRIES; i++)
+    {
+        Label_Entry_t *c = &Label.entry[i];
+
+        if (!c->valid)
+        {
+            e = c;
+            break;
+        }
+        e = ((e == NULL) || (c->used < e->used)) ? c : e;
+    }
+    if (e->valid)
+    {
+        Evict(e);
+    }
+    while ((buf = Alloc(size)) == NULL)
+    {
+        Label_Entry_t *lru = NULL;
+
+        for (uint32_t i = 0U; i < GUI_LABEL_ENTRIES; i++)
+        {
+            Label_Entry_t *c = &Label.entry[i];
+
+            lru = (c->valid && ((lru == NULL) || (c->used < lru->used))) ? c : lru;
+        }
+        Evict(lru);
+    }
+
+    if (format == GUI_LABEL_RGB565)
+    {
+        uint16_t *p = (uint16_t*)buf;
+
+        for (uint32_t i = 0U; i < pixels; i++)
+        {
+            p[i] = bg;
+        }
+    }
+    else
+    {
+        memset(buf, 0, pixels);
+    }
+    for (uint32_t i = 0U; i < layout.count; i++)
+    {
+        const GUI_Layout_Glyph_t *lg = &layout.glyph[i];
+        const aFONT *font = fonts->font[lg->font];
+        const aGLYPH *g = &font->glyph[lg->index];
+        const uint8_t *src = font->bitmap + g->offset;
+        uint32_t pitch = (font->bpp == 4U) ? (g->width / 2U) : g->width;
+        uint32_t gx = (uint32_t)(lg->x + g->left - x0);
+        uint32_t gy = (uint32_t)(lg->y + line->ascent - g->top - y0);
+        uint32_t w = (uint32_t)(x1 - x0);
+
+        for (uint32_t y = 0U; y < g->height; y++, src += pitch)
+        {
+            for (uint32_t x = 0U; x < g->width; x++)
+            {
+                uint32_t a = (font->bpp == 4U) ?
+                        (((src[x >> 1] >> ((x & 1U) * 4U)) & 0x0FU) * 17U) : src[x];
+                uint32_t at = (gy + y) * w + gx + x;
+
+                if (a == 0U)
+                {
+                    continue;
+                }
+                if (format == GUI_LABEL_RGB565)
+                {
+                    uint16_t *p = (uint16_t*)buf;
+
+                    p[at] = BSP_DMA2D_Blend565(fg, p[at], a >> 3);
+                }
+                else
+                {
+                    /* Coverage over coverage, for overlapping glyphs */
+                    buf[at] = (uint8_t)(a + buf[at] - (a * buf[at] + 127U) / 255U);
+                }
+            }
+        }
+    }
+
+    e->valid = 1U;
+    e->format = (uint8_t)format;
+    e->fg = fg;
+    e->bg = bg;
+    e->x = (int16_t)x0;
+    e->y = (int16_t)y0;
+    e->width = (uint16_t)(x1 - x0);
+    e->height = (uint16_t)(y1 - y0);
+    e->buf = buf;
+    e->size = size;
+    e->fonts = *fonts;
+    strcpy(e->text, text);
+    Label.stats.bytes += size;
+    e->render_cycles = VISION_CYCLES() - start;
+    Label.stats.render_us += e->render_cycles / (SystemCoreClock / 1000000U);
+    return e;
+}
+
+/* First fit between the buffers of the valid entries */
+static uint8_t* Alloc(uint32_t size)
+{
+    uint32_t at = 0U;
+
+    for (;;)
+    {
+        uint8_t moved = 0U;
+
+        /* Pushed past every buffer it overlaps until none does */
+        for (uint32_t i = 0U; i < GUI_LABEL_ENTRIES; i++)
+        {
+            const Label_Entry_t *e = &Label.entry[i];
+            uint32_t lo, hi;
+
+            if (!e->valid || (e->size == 0U))
+            {
+                continue;
+            }
+            lo = (uint32_t)(e->buf - Label_Pool);
+            hi = lo + e->size;
+            if ((lo < (at + size)) && (hi > at))
+            {
+                at = hi;
+                moved = 1U;
+            }
+        }
+        if ((at + size) > GUI_LABEL_POOL_BYTES)
+        {
+            return NULL;
+        }
+        if (!moved)
+        {
+            return &Label_Pool[at];
+        }
+    }
+}
+
+static void Evict(Label_Entry_t *e)
+{
+    e->valid = 0U;
+    Label.stats.bytes -= e->size;
+    Label.stats.evictions++;
+}
+
+static void Blit(const GUI_Text_Surface_t *s, const Label_Entry_t *e, int32_t x, int32_t y,
+        uint16_t fg)
+{
+    int32_t dx = x + e->x, dy = y + e->y;
+    int32_t sx = (dx < 0) ? -dx : 0;
+    int32_t sy = (dy < 0) ? -dy : 0;
+    int32_t w = (((dx + e->width) > s->width) ? (s->width - dx) : e->width) - sx;
+    int32_t h = (((dy + e->height) > s->height) ? (s->height - dy) : e->height) - sy;
+    uint16_t *dst;
+    HAL_StatusTypeDef ret;
+
+    if ((w <= 0) || (h <= 0))
+    {
+        return;
+    }
+    dst = s->base + (uint32_t)(dy + sy) * s->stride + (uint32_t)(dx + sx);
+
+    if (e->format == GUI_LABEL_RGB565)
+    {
+        const uint16_t *src = (const uint16_t*)e->buf + (uint32_t)sy * e->width + (uint32_t)sx;
+        BSP_DMA2D_Pfc_t pfc;
+
+        pfc.src = src;
+        pfc.dst = dst;
+        pfc.src_stride = e->width * 2U;
+        pfc.dst_stride = s->stride * 2U;
+        pfc.width = (uint32_t)w;
+        pfc.lines = (uint32_t)h;
+        pfc.in_mode = DMA2D_INPUT_RGB565;
+        pfc.out_mode = DMA2D_OUTPUT_RGB565;
+        pfc.swap = 0U;
+        ret = BSP_DMA2D_Convert(&pfc);
+        if (ret != HAL_OK)
+        {
+            Label.stats.blit_errors++;
+            for (int32_t l = 0; l < h; l++)
+            {
+                memcpy(dst + (uint32_t)l * s->stride, src + (uint32_t)l * e->width,
+                        (uint32_t)w * 2U);
+            }
+        }
+    }
+    else
+    {
+        const uint8_t *src = e->buf + (uint32_t)sy * e->width + (uint32_t)sx;
+        BSP_DMA2D_Blend_t blend;
+
+        blend.src = src;
+        blend.bg = dst;
+        blend.dst = dst;
+        blend.src_stride = e->width;
+        blend.bg_stride = s->stride * 2U;
+        blend.dst_stride = s->stride * 2U;
+        blend.width = (uint32_t)w;
+        blend.lines = (uint32_t)h;
+        blend.src_mode = DMA2D_INPUT_A8;
+        blend.bg_mode = DMA2D_INPUT_RGB565;
+        blend.out_mode = DMA2D_OUTPUT_RGB565;
+        blend.color = BSP_DMA2D_Rgb565To888(fg);
+        blend.alpha = 0xFFU;
+        ret = BSP_DMA2D_Blend(&blend);
+        if (ret != HAL_OK)
+        {
+            Label.stats.blit_errors++;
+            for (int32_t l = 0; l < h; l++)
+            {
+                for (int32_t i = 0; i < w; i++)
+                {
+                    uint32_t a = src[(uint32_t)l * e->width + (uint32_t)i] >> 3;
+                    uint16_t *p = &dst[(uint32_t)l * s->stride + (uint32_t)i];
+
+                    *p = BSP_DMA2D_Blend565(fg, *p, a);
+                }
+            }
+        }
+    }
+}
+
+/* Not cacheable: drawn as it is, over a box of the first font's metrics */
+static void Bypass(const GUI_Text_Surface_t *s, int16_t x, int16_t y, const char *text,
+        const GUI_Text_Fonts_t *fonts, uint16_t fg, uint16_t bg, GUI_Label_Format_t format)
+{
+    Label.stats.bypass++;
+    if (format == GUI_LABEL_RGB565)
+    {
+        uint16_t lines;
+        int32_t x1 = x + GUI_Layout_Measure(text, fonts->font[0], &lines);
+        int32_t y1 = y + lines * fonts->font[0]->height;
+
+        x1 = (x1 > s->width) ? s->width : x1;
+        y1 = (y1 > s->height) ? s->height : y1;
+        for (int32_t l = (y < 0) ? 0 : y; l < y1; l++)
+        {
+            for (int32_t i = (x < 0) ? 0 : x; i < x1; i++)
+            {
+                s->base[(uint32_t)l * s->stride + (uint32_t)i] = bg;
+            }
+        }
+    }
+    (void)GUI_Text_DrawUTF8(x, y, text, fonts, fg);
+}
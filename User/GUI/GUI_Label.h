@@ -0,0 +1,81 @@
+/*
+ * GUI_Label.h
+ * Cache of pre-rendered text labels in SDRAM, drawn by one DMA2D blit
+ *
+ * A label (a string in a font set) is laid out and rasterized once into
+ * an off-screen buffer from a GUI_LABEL_POOL_BYTES pool in SDRAM; every
+ * later draw of the same label is a single DMA2D job:
+ *  - A8: coverage only, blended over the surface in any color; recoloring
+ *    is still a hit.
+ *  - RGB565: text on an opaque background, copied as it is (no read of the
+ *    surface); the colors are part of the key.
+ *
+ * Entries are keyed by the text, the fonts and, for RGB565, the colors, so
+ * a label whose text changes is just another entry and the stale one ages
+ * out: the least recently drawn entries are evicted when the pool or the
+ * entry table is full. Texts longer than GUI_LABEL_TEXT_MAX - 1 bytes or
+ * of more than GUI_LABEL_GLYPHS glyphs are drawn directly (counted as
+ * bypass). Labels are drawn on the GUI_Text surface.
+ */
+
+#ifndef GUI_LABEL_H_
+#define GUI_LABEL_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "GUI_Text.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+#define GUI_LABEL_POOL_BYTES                     (256U * 1024U)
+#define GUI_LABEL_ENTRIES                        (32U)
+#define GUI_LABEL_TEXT_MAX                       (48U)       /* key, with the NUL */
+#define GUI_LABEL_GLYPHS                         (48U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef enum
+{
+    GUI_LABEL_A8 = 0,
+    GUI_LABEL_RGB565
+} GUI_Label_Format_t;
+
+typedef struct
+{
+    uint32_t hits;
+    uint32_t misses;              /* rendered */
+    uint32_t evictions;
+    uint32_t bypass;              /* not cacheable, drawn directly */
+    uint32_t blit_errors;         /* DMA2D refused, copied by the CPU */
+    uint32_t bytes;               /* pool in use */
+    uint32_t render_us;           /* spent rendering the misses */
+    uint32_t saved_us;            /* rendering the hits would have cost, less the blits */
+} GUI_Label_Stats_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Empties the cache */
+extern void GUI_Label_Init(void);
+
+/* Draws the label with its line box at (x, y); bg is only used by RGB565 */
+extern void GUI_Label_Draw(int16_t x, int16_t y, const char *text, const aFONT *font,
+        uint16_t fg, uint16_t bg, GUI_Label_Format_t format);
+/* The same with fallback fonts */
+extern void GUI_Label_DrawFonts(int16_t x, int16_t y, const char *text,
+        const GUI_Text_Fonts_t *fonts, uint16_t fg, uint16_t bg, GUI_Label_Format_t format);
+
+/* Drops the entries of a text, NULL: all of them */
+extern void GUI_Label_Invalidate(const char *text);
+
+extern const GUI_Label_Stats_t* GUI_Label_GetStats(void);
+
+#endif /* GUI_LABEL_H_ */
@@ -0,0 +1,314 @@
+/*
+ * GUI_Layout.c
+ * Text layout in a box for the anti-aliased fonts (fonts_aa.h)
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "GUI_Layout.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define LAYOUT_NO_BREAK               (0xFFFFFFFFU)
+#define LAYOUT_ELLIPSIS_DOTS          (3U)
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static int32_t Advance(const GUI_Layout_t *l, const GUI_Layout_Glyph_t *g);
+static int32_t LineEnd(const GUI_Layout_t *l, uint32_t first);
+static void CloseLine(GUI_Layout_t *l, uint32_t first, uint32_t end, int32_t width,
+        int32_t box, uint8_t flags);
+static int32_t Ellipsis(GUI_Layout_t *l, uint32_t first, int32_t box, uint8_t flags);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void GUI_Layout_Init(GUI_Layout_t *layout, GUI_Layout_Glyph_t *glyph, uint16_t max)
+{
+    layout->fonts.count = 0U;
+    layout->glyph = glyph;
+    layout->max = max;
+    layout->count = 0U;
+    layout->width = 0U;
+    layout->height = 0U;
+    layout->lines = 0U;
+    layout->cut = 0U;
+}
+
+uint16_t GUI_Layout_Measure(const char *text, const aFONT *font, uint16_t *lines)
+{
+    GUI_Text_Fonts_t fonts = { { font }, 1U };
+    int32_t pen = 0, ink = 0, widest = 0;
+    uint16_t code, prev = 0U;
+    uint16_t n = (*text != '\0') ? 1U : 0U;
+
+    while ((code = GUI_Text_NextUTF8(&text)) != 0U)
+    {
+        const aGLYPH *g;
+        uint8_t f;
+
+        if (code == '\n')
+        {
+            pen = 0;
+            ink = 0;
+            prev = 0U;
+            n++;
+            continue;
+        }
+        g = GUI_Text_Resolve(&fonts, code, &f);
+        pen += GUI_Text_Kerning(font, prev, code) + ((g != NULL) ? g->advance : 0);
+        ink = (code != ' ') ? pen : ink;
+        widest = (ink > widest) ? ink : widest;
+        prev = code;
+    }
+    if (lines != NULL)
+    {
+        *lines = n;
+    }
+    return (uint16_t)widest;
+}
+
+uint16_t GUI_Layout_Text(GUI_Layout_t *layout, const char *text, const aFONT *font,
+        uint16_t width, uint16_t height, uint8_t flags)
+{
+    GUI_Text_Fonts_t fonts = { { font }, 1U };
+
+    return GUI_Layout_TextFonts(layout, text, &fonts, width, height, flags);
+}
+
+uint16_t GUI_Layout_TextFonts(GUI_Layout_t *layout, const char *text,
+        const GUI_Text_Fonts_t *fonts, uint16_t width, uint16_t height, uint8_t flags)
+{
+    GUI_Layout_t *l = layout;
+    const aFONT *line = fonts->font[0];
+    int32_t box = (width != 0U) ? (int32_t)width : INT16_MAX;
+    uint32_t max_lines = (height != 0U) ? (height / line->height) : UINT16_MAX;
+    uint32_t first = 0U;              /* first glyph of the line */
+    uint32_t brk = LAYOUT_NO_BREAK;   /* first glyph after the last space */
+    int32_t brk_ink = 0;              /* line width up to that space */
+    int32_t brk_pen = 0;              /* pen after the spaces */
+    int32_t pen = 0;
+    int32_t ink = 0;                  /* line width, trailing spaces out */
+    uint16_t prev = 0U;
+    uint8_t prev_font = 0U;
+    uint8_t skip = 0U;                /* line cut, up to the next '\n' */
+
+    l->fonts = *fonts;
+    l->count = 0U;
+    l->width = 0U;
+    l->height = 0U;
+    l->lines = 0U;
+    l->cut = 0U;
+    if (*text == '\0')
+    {
+        return 0U;
+    }
+    if (max_lines == 0U)
+    {
+        l->cut = 1U;
+        return 0U;
+    }
+
+    for (;;)
+    {
+        uint16_t code = GUI_Text_NextUTF8(&text);
+        const aGLYPH *g;
+        int32_t adv, x;
+        uint8_t f;
+
+        if ((code == 0U) || (code == '\n'))
+        {
+            if ((code == '\n') && ((l->lines + 1U) == max_lines))
+            {
+                /* More lines than the box holds */
+                l->cut = 1U;
+                ink = skip ? ink : Ellipsis(l, first, box, flags);
+                code = 0U;
+            }
+            CloseLine(l, first, l->count, ink, box, flags);
+            if (code == 0U)
+            {
+                break;
+            }
+            first = l->count;
+            brk = LAYOUT_NO_BREAK;
+            pen = 0;
+            ink = 0;
+            prev = 0U;
+            skip = 0U;
+            continue;
+        }
+        if (skip)
+        {
+            continue;
+        }
+
+        g = GUI_Text_Resolve(fonts, code, &f);
+        if (g == NULL)
+        {
+            continue;
+        }
+        adv = g->advance;
+        x = pen + ((f == prev_font) ? GUI_Text_Kerning(fonts->font[f], prev, code) : 0);
+        prev = code;
+        prev_font = f;
+        if (code == ' ')
+        {
+            pen = x + adv;
+            if (l->count != first)
+            {
+                brk = l->count;
+                brk_ink = ink;
+                brk_pen = pen;
+            }
+            continue;
+        }
+
+        while (((x + adv) > box) && (l->count != first) && (flags & GUI_LAYOUT_WRAP) &&
+               ((l->lines + 1U) < max_lines))
+        {
+            uint32_t end = (brk != LAYOUT_NO_BREAK) ? brk : l->count;
+
+            /* The word after the last space goes down, else the line breaks here */
+            CloseLine(l, first, end, (end == brk) ? brk_ink : ink, box, flags);
+            for (uint32_t i = end; i < l->count; i++)
+            {
+                l->glyph[i].x = (int16_t)(l->glyph[i].x - brk_pen);
+                l->glyph[i].y = (int16_t)(l->glyph[i].y + line->height);
+            }
+            if (end == brk)
+            {
+                pen -= brk_pen;
+                ink -= brk_pen;
+                x -= brk_pen;
+            }
+            else
+            {
+                pen = 0;
+                ink = 0;
+                x = 0;
+            }
+            first = end;
+            brk = LAYOUT_NO_BREAK;
+        }
+        if ((((x + adv) > box) && (l->count != first)) || (l->count == l->max))
+        {
+            /* Cut: the box or the glyph memory is full */
+            l->cut = 1U;
+            ink = Ellipsis(l, first, box, flags);
+            if ((flags & GUI_LAYOUT_WRAP) || (l->count == l->max))
+            {
+                CloseLine(l, first, l->count, ink, box, flags);
+                break;
+            }
+            skip = 1U;
+            continue;
+        }
+
+        l->glyph[l->count].x = (int16_t)x;
+        l->glyph[l->count].y = (int16_t)(l->lines * line->height);
+        l->glyph[l->count].index = (uint16_t)(g - fonts->font[f]->glyph);
+        l->glyph[l->count].font = f;
+        l->count++;
+        pen = x + adv;
+        ink = pen;
+    }
+    return l->count;
+}
+
+void GUI_Layout_Draw(const GUI_Layout_t *layout, int16_t x, int16_t y, uint16_t color)
+{
+    int32_t base = y + layout->fonts.font[0]->ascent;
+
+    for (uint32_t i = 0U; i < layout->count; i++)
+    {
+        const GUI_Layout_Glyph_t *g = &layout->glyph[i];
+        const aFONT *font = layout->fonts.font[g->font];
+
+        GUI_Text_DrawGlyph((int16_t)(x + g->x), (int16_t)(base + g->y), font,
+                &font->glyph[g->index], color);
+    }
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+static int32_t Advance(const GUI_Layout_t *l, const GUI_Layout_Glyph_t *g)
+{
+    return l->fonts.font[g->font]->glyph[g->index].advance;
+}
+
+/* Pen after the last glyph of the line from first */
+static int32_t LineEnd(const GUI_Layout_t *l, uint32_t first)
+{
+    return (l->count != first) ?
+            (l->glyph[l->count - 1U].x + Advance(l, &l->glyph[l->count - 1U])) : 0;
+}
+
+/* Aligns glyphs [first, end) in the box and counts the line */
+static void CloseLine(GUI_Layout_t *l, uint32_t first, uint32_t end, int32_t width,
+        int32_t box, uint8_t flags)
+{
+    int32_t shift = 0;
+
+    if ((box != INT16_MAX) && (width < box))
+    {
+        switch (flags & GUI_LAYOUT_ALIGN_MASK)
+        {
+            case GUI_LAYOUT_ALIGN_CENTER: shift = (box - width) / 2; break;
+            case GUI_LAYOUT_ALIGN_RIGHT:  shift = box - width; break;
+            default: break;
+        }
+    }
+    for (uint32_t i = first; i < end; i++)
+    {
+        l->glyph[i].x = (int16_t)(l->glyph[i].x + shift);
+    }
+    l->width = (width > l->width) ? (uint16_t)width : l->width;
+    l->lines++;
+    l->height = (uint16_t)(l->lines * l->fonts.font[0]->height);
+}
+
+/* Ends the line from first at the last glyph that leaves room for "...";
+ * returns the line width */
+static int32_t Ellipsis(GUI_Layout_t *l, uint32_t first, int32_t box, uint8_t flags)
+{
+    uint8_t f;
+    const aGLYPH *dot = GUI_Text_Resolve(&l->fonts, '.', &f);
+    int32_t end;
+
+    if (!(flags & GUI_LAYOUT_ELLIPSIS) || (dot == NULL))
+    {
+        return LineEnd(l, first);
+    }
+    for (;;)
+    {
+        end = LineEnd(l, first);
+        if ((l->count == first) ||
+            (((end + (int32_t)LAYOUT_ELLIPSIS_DOTS * dot->advance) <= box) &&
+             ((l->count + LAYOUT_ELLIPSIS_DOTS) <= l->max)))
+        {
+            break;
+        }
+        l->count--;
+    }
+    for (uint32_t i = 0U; (i < LAYOUT_ELLIPSIS_DOTS) && (l->count < l->max) &&
+         ((end + dot->advance) <= box); i++)
+    {
+        l->glyph[l->count].x = (int16_t)end;
+        l->glyph[l->count].y = (int16_t)(l->lines * l->fonts.font[0]->height);
+        l->glyph[l->count].index = (uint16_t)(dot - l->fonts.font[f]->glyph);
+        l->glyph[l->count].font = f;
+        l->count++;
+        end += dot->advance;
+    }
+    return end;
+}
@@ -0,0 +1,84 @@
+/*
+ * GUI_Layout.h
+ * Text layout in a box for the anti-aliased fonts (fonts_aa.h)
+ *
+ * GUI_Layout_Text() places a string in one pass without drawing: kerned
+ * pen positions, '\n', word wrap at spaces (a word wider than the box is
+ * broken), left/center/right alignment per line and "..." at the end of
+ * text cut by the box. The result is a list of resolved glyphs (font of
+ * the set and glyph index) and positions in caller memory, so a label
+ * laid out once is redrawn by GUI_Layout_Draw() in any color with no
+ * decoding, font lookup or measuring at all. Spaces take no entry.
+ *
+ * Text is UTF-8; with a font set, codes fall back as in GUI_Text.h.
+ *
+ * Box width or height 0: unbounded in that direction.
+ */
+
+#ifndef GUI_LAYOUT_H_
+#define GUI_LAYOUT_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "fonts_aa.h"
+#include "GUI_Text.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Flags of GUI_Layout_Text() */
+#define GUI_LAYOUT_ALIGN_LEFT                    (0x00U)
+#define GUI_LAYOUT_ALIGN_CENTER                  (0x01U)
+#define GUI_LAYOUT_ALIGN_RIGHT                   (0x02U)
+#define GUI_LAYOUT_ALIGN_MASK                    (0x03U)
+#define GUI_LAYOUT_WRAP                          (0x04U)
+#define GUI_LAYOUT_ELLIPSIS                      (0x08U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    int16_t x;                    /* pen position in the box */
+    int16_t y;                    /* line top in the box */
+    uint16_t index;               /* in font->glyph */
+    uint8_t  font;                /* in the set */
+} GUI_Layout_Glyph_t;
+
+typedef struct
+{
+    GUI_Text_Fonts_t fonts;       /* line box: fonts.font[0] */
+    GUI_Layout_Glyph_t *glyph;    /* caller memory */
+    uint16_t max;                 /* entries of glyph */
+    uint16_t count;               /* entries used */
+    uint16_t width;               /* widest line */
+    uint16_t height;              /* lines * line height */
+    uint16_t lines;
+    uint8_t  cut;                 /* the text didn't all fit */
+} GUI_Layout_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+extern void GUI_Layout_Init(GUI_Layout_t *layout, GUI_Layout_Glyph_t *glyph, uint16_t max);
+
+/* Size of the text without a box: widest line and line count */
+extern uint16_t GUI_Layout_Measure(const char *text, const aFONT *font, uint16_t *lines);
+
+/* Lays the text out in a box of width x height; returns the glyph count */
+extern uint16_t GUI_Layout_Text(GUI_Layout_t *layout, const char *text, const aFONT *font,
+        uint16_t width, uint16_t height, uint8_t flags);
+/* The same with fallback fonts */
+extern uint16_t GUI_Layout_TextFonts(GUI_Layout_t *layout, const char *text,
+        const GUI_Text_Fonts_t *fonts, uint16_t width, uint16_t height, uint8_t flags);
+
+/* Draws a laid out text with the box at (x, y) */
+extern void GUI_Layout_Draw(const GUI_Layout_t *layout, int16_t x, int16_t y, uint16_t color);
+
+#endif /* GUI_LAYOUT_H_ */
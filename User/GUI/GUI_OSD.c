@@ -0,0 +1,277 @@
+/*
+ * GUI_OSD.c
+ * Performance overlay on LTDC layer 1
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdio.h>
+#include "main.h"
+#include "ltdc.h"
+#include "GUI_OSD.h"
+#include "BSP_RGB_LCD.h"
+#include "vision_simd.h"
+#include "ov7670/ov7670_tlm.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define OSD_LAYER                     (1U)
+/* Line buffer size, the narrowest font is 7 pixels wide */
+#define OSD_COLS                      ((GUI_OSD_WIDTH - 2U * GUI_OSD_MARGIN) / 7U)
+
+/* CPU load above this is shown in the warning color, 1/10 % */
+#define OSD_LOAD_WARN_X10             (800U)
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    GUI_OSD_Stats_t     stats;
+    uint8_t             ready;
+    uint8_t             enabled;
+    uint8_t             front;            /* surface shown by the layer */
+    uint32_t            last_tick;
+    uint32_t            last_dropped;
+    uint32_t            window_start;     /* cycle counter at the period start */
+    uint32_t            idle_cycles;
+    volatile uint32_t   dma2d_samples;
+    volatile uint32_t   dma2d_busy;
+} OSD;
+
+/* Two surfaces: one shown, one drawn */
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint16_t OSD_Surface[2][GUI_OSD_WIDTH * GUI_OSD_HEIGHT];
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static void ResetWindow(void);
+static void Render(uint16_t *surface);
+static void DrawText(uint16_t *surface, uint32_t x, uint32_t y, const char *text, uint16_t color);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void GUI_OSD_Init(void)
+{
+    LTDC_LayerCfgTypeDef cfg = {0};
+
+    VISION_CyclesInit();
+    Render(OSD_Surface[0]);
+    OSD.front = 0U;
+
+    cfg.WindowX0 = GUI_OSD_X;
+    cfg.WindowX1 = GUI_OSD_X + GUI_OSD_WIDTH;
+    cfg.WindowY0 = GUI_OSD_Y;
+    cfg.WindowY1 = GUI_OSD_Y + GUI_OSD_HEIGHT;
+    cfg.PixelFormat = LTDC_PIXEL_FORMAT_ARGB4444;
+    cfg.Alpha = 0xFFU;
+    cfg.Alpha0 = 0U;
+    /* Per pixel alpha over layer 0 */
+    cfg.BlendingFactor1 = LTDC_BLENDING_FACTOR1_PAxCA;
+    cfg.BlendingFactor2 = LTDC_BLENDING_FACTOR2_PAxCA;
+    cfg.FBStartAdress = (uint32_t)OSD_Surface[0];
+    cfg.ImageWidth = GUI_OSD_WIDTH;
+    cfg.ImageHeight = GUI_OSD_HEIGHT;
+    if (HAL_LTDC_ConfigLayer(&hltdc, &cfg, OSD_LAYER) != HAL_OK)
+    {
+        return;
+    }
+    OSD.ready = 1U;
+    /* Configuring the layer shows it: hidden until enabled */
+    GUI_OSD_Enable(0U);
+}
+
+void GUI_OSD_Enable(uint8_t enable)
+{
+    if (!OSD.ready)
+    {
+        return;
+    }
+    ResetWindow();
+    OSD.last_tick = HAL_GetTick();
+    OSD.enabled = enable ? 1U : 0U;
+    BSP_LCD_SetLayerVisible(OSD_LAYER, enable ? ENABLE : DISABLE);
+}
+
+uint8_t GUI_OSD_isEnabled(void)
+{
+    return OSD.enabled;
+}
+
+void GUI_OSD_Task(void)
+{
+    uint32_t now = HAL_GetTick();
+    uint32_t start, total, samples, busy;
+    uint8_t back;
+
+    if (!OSD.enabled || ((now - OSD.last_tick) < GUI_OSD_PERIOD_MS))
+    {
+        return;
+    }
+    /* Previous swap still waiting for the vertical blanking */
+    if (hltdc.Instance->SRCR & LTDC_SRCR_VBR)
+    {
+        return;
+    }
+    OSD.last_tick = now;
+
+    start = VISION_CYCLES();
+    total = start - OSD.window_start;
+    __disable_irq();
+    samples = OSD.dma2d_samples;
+    busy = OSD.dma2d_busy;
+    __enable_irq();
+    OSD.stats.cpu_load_x10 = (total > OSD.idle_cycles) ?
+            (uint32_t)(((uint64_t)(total - OSD.idle_cycles) * 1000U) / total) : 0U;
+    OSD.stats.dma2d_busy_x10 = samples ? (busy * 1000U / samples) : 0U;
+
+    back = OSD.front ^ 1U;
+    Render(OSD_Surface[back]);
+    HAL_LTDC_SetAddress_NoReload(&hltdc, (uint32_t)OSD_Surface[back], OSD_LAYER);
+    HAL_LTDC_Reload(&hltdc, LTDC_RELOAD_VERTICAL_BLANKING);
+    OSD.front = back;
+
+    OSD.stats.renders++;
+    OSD.stats.render_us = (VISION_CYCLES() - start) / (SystemCoreClock / 1000000U);
+    if (OSD.stats.render_us > OSD.stats.render_max_us)
+    {
+        OSD.stats.render_max_us = OSD.stats.render_us;
+    }
+    /* The redraw itself is busy time of the next period */
+    ResetWindow();
+    OSD.window_start = start;
+}
+
+void GUI_OSD_Idle(uint32_t ms)
+{
+    uint32_t tick = HAL_GetTick();
+    uint32_t last = VISION_CYCLES();
+    uint32_t wait = ms;
+
+    /* Same minimum wait as HAL_Delay() */
+    if (wait < HAL_MAX_DELAY)
+    {
+        wait += (uint32_t)uwTickFreq;
+    }
+    while ((HAL_GetTick() - tick) < wait)
+    {
+        uint32_t now = VISION_CYCLES();
+
+        if ((now - last) < GUI_OSD_IDLE_PASS_CYCLES)
+        {
+            OSD.idle_cycles += now - last;
+        }
+        last = now;
+    }
+}
+
+void GUI_OSD_Tick(void)
+{
+    if (OSD.enabled)
+    {
+        OSD.dma2d_samples++;
+        if (DMA2D->CR & DMA2D_CR_START)
+        {
+            OSD.dma2d_busy++;
+        }
+    }
+}
+
+void GUI_OSD_GetStats(GUI_OSD_Stats_t *stats)
+{
+    *stats = OSD.stats;
+}
+
+/******************************************************************************
+ *                               LOCAL FUNCTIONS                              *
+ ******************************************************************************/
+
+static void ResetWindow(void)
+{
+    __disable_irq();
+    OSD.dma2d_samples = 0U;
+    OSD.dma2d_busy = 0U;
+    __enable_irq();
+    OSD.idle_cycles = 0U;
+    OSD.window_start = VISION_CYCLES();
+}
+
+static void Render(uint16_t *surface)
+{
+    uint32_t *p = (uint32_t*)surface;
+    uint32_t fill = GUI_OSD_COLOR_BACK | (GUI_OSD_COLOR_BACK << 16);
+    uint32_t step = GUI_OSD_FONT.Height;
+    uint32_t x = GUI_OSD_MARGIN;
+    uint32_t y = GUI_OSD_MARGIN;
+    char line[OSD_COLS + 1U];
+    OV7670_TLM_t tlm;
+    uint32_t frame_x100;
+
+    for (uint32_t i = 0U; i < (GUI_OSD_WIDTH * GUI_OSD_HEIGHT) / 2U; i++)
+    {
+        p[i] = fill;
+    }
+
+    OV7670_TLM_Get(&tlm);
+    frame_x100 = tlm.period_us / 10U;
+    snprintf(line, sizeof(line), "%3lu.%02lu fps %3lu.%02lu ms",
+            tlm.fps_x100 / 100U, tlm.fps_x100 % 100U, frame_x100 / 100U, frame_x100 % 100U);
+    DrawText(surface, x, y, line, GUI_OSD_COLOR_TEXT);
+    y += step;
+
+    snprintf(line, sizeof(line), "cpu   %3lu.%lu %%",
+            OSD.stats.cpu_load_x10 / 10U, OSD.stats.cpu_load_x10 % 10U);
+    DrawText(surface, x, y, line, (OSD.stats.cpu_load_x10 > OSD_LOAD_WARN_X10) ?
+            GUI_OSD_COLOR_WARN : GUI_OSD_COLOR_TEXT);
+    y += step;
+
+    snprintf(line, sizeof(line), "dma2d %3lu.%lu %%",
+            OSD.stats.dma2d_busy_x10 / 10U, OSD.stats.dma2d_busy_x10 % 10U);
+    DrawText(surface, x, y, line, GUI_OSD_COLOR_TEXT);
+    y += step;
+
+    snprintf(line, sizeof(line), "dropped %lu", tlm.dropped);
+    DrawText(surface, x, y, line, (tlm.dropped != OSD.last_dropped) ?
+            GUI_OSD_COLOR_WARN : GUI_OSD_COLOR_TEXT);
+    OSD.last_dropped = tlm.dropped;
+}
+
+/* sFONT glyphs: rows of (Width + 7) / 8 bytes, MSB first, from ' ' */
+static void DrawText(uint16_t *surface, uint32_t x, uint32_t y, const char *text, uint16_t color)
+{
+    const sFONT *font = &GUI_OSD_FONT;
+    uint32_t row_bytes = (font->Width + 7U) / 8U;
+
+    for (; (*text != '\0') && ((x + font->Width) <= GUI_OSD_WIDTH); text++, x += font->Width)
+    {
+        const uint8_t *glyph;
+
+        if ((*text < ' ') || (*text > '~'))
+        {
+            continue;
+        }
+        glyph = &font->table[(uint32_t)(*text - ' ') * font->Height * row_bytes];
+        for (uint32_t r = 0U; (r < font->Height) && ((y + r) < GUI_OSD_HEIGHT); r++)
+        {
+            uint16_t *px = &surface[(y + r) * GUI_OSD_WIDTH + x];
+
+            for (uint32_t c = 0U; c < font->Width; c++)
+            {
+                if (glyph[c / 8U] & (0x80U >> (c % 8U)))
+                {
+                    px[c] = color;
+                }
+            }
+            glyph += row_bytes;
+        }
+    }
+}
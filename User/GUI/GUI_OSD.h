@@ -0,0 +1,80 @@
+/*
+ * GUI_OSD.h
+ * Performance overlay on LTDC layer 1
+ *
+ * A small ARGB4444 surface in SDRAM is shown by LTDC layer 1 on top of the
+ * camera/GUI layer, the LTDC blends it with its per pixel alpha: no DMA2D or
+ * CPU work on the framebuffer. The text (capture rate, frame time, CPU load,
+ * DMA2D busy time, dropped frames) is redrawn every GUI_OSD_PERIOD_MS into
+ * the hidden one of two surfaces, which is then swapped in at the next
+ * vertical blanking.
+ *
+ * CPU load: the main loop waits in GUI_OSD_Idle() instead of HAL_Delay(),
+ * spin passes stretched by an interrupt count as busy. DMA2D busy time is
+ * sampled from the SysTick interrupt.
+ */
+
+#ifndef GUI_OSD_H_
+#define GUI_OSD_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "main.h"
+#include "fonts.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+#define GUI_OSD_FONT                             Font12
+#define GUI_OSD_X                                (8U)
+#define GUI_OSD_Y                                (8U)
+/* Surface size in pixels, 4 lines of 24 Font12 characters plus margin */
+#define GUI_OSD_WIDTH                            (176U)
+#define GUI_OSD_HEIGHT                           (56U)
+#define GUI_OSD_MARGIN                           (4U)
+
+#define GUI_OSD_PERIOD_MS                        (500U)
+/* Spin passes of GUI_OSD_Idle() longer than this were interrupted */
+#define GUI_OSD_IDLE_PASS_CYCLES                 (1000U)
+
+/* ARGB4444 */
+#define GUI_OSD_COLOR_BACK                       (0xA000U)
+#define GUI_OSD_COLOR_TEXT                       (0xFFFFU)
+#define GUI_OSD_COLOR_WARN                       (0xFF80U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint32_t cpu_load_x10;        /* 1/10 %, last period */
+    uint32_t dma2d_busy_x10;      /* 1/10 % of SysTick samples, last period */
+    uint32_t renders;
+    uint32_t render_us;           /* last redraw */
+    uint32_t render_max_us;
+} GUI_OSD_Stats_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Configures layer 1 (window, ARGB4444, per pixel alpha), hidden until
+ * GUI_OSD_Enable(); needs the LTDC */
+extern void GUI_OSD_Init(void);
+extern void GUI_OSD_Enable(uint8_t enable);
+extern uint8_t GUI_OSD_isEnabled(void);
+
+/* Main loop: redraws when the period elapsed */
+extern void GUI_OSD_Task(void);
+/* HAL_Delay() replacement of the main loop, accounts the wait as idle time */
+extern void GUI_OSD_Idle(uint32_t ms);
+/* Shall be called from SysTick_Handler() */
+extern void GUI_OSD_Tick(void);
+
+extern void GUI_OSD_GetStats(GUI_OSD_Stats_t *stats);
+
+#endif /* GUI_OSD_H_ */
@@ -52,6 +52,7 @@
 #include <stdlib.h>
 #include <string.h> //memset()
 #include <math.h>
+#include "vision_color.h"
 
 volatile PAINT Paint;
 
@@ -479,10 +480,10 @@ void Paint_DrawString_EN(UWORD Xstart, UWORD Ystart, const char * pString,
             Ypoint += Font->Height;
         }
 
-        // If the Y direction is full, reposition to(Xstart, Ystart)
+        // If the Y direction is full, stop: the rest doesn't fit
         if ((Ypoint  + Font->Height ) > Paint.Height ) {
-            Xpoint = Xstart;
-            Ypoint = Ystart;
+            Debug("Paint_DrawString_EN Text exceeds the display height\r\n");
+            break;
         }
         Paint_DrawChar(Xpoint, Ypoint, * pString, Font, Color_Background, Color_Foreground);
 
@@ -600,36 +601,31 @@ parameter:
     Color_Background : Select the background color of the English character
     Color_Foreground : Select the foreground color of the English character
 ******************************************************************************/
-#define  ARRAY_LEN 255
 void Paint_DrawNum(UWORD Xpoint, UWORD Ypoint, int32_t Nummber,
                    sFONT* Font, UWORD Color_Background, UWORD Color_Foreground )
 {
-
-    int16_t Num_Bit = 0, Str_Bit = 0;
-    uint8_t Str_Array[ARRAY_LEN] = {0}, Num_Array[ARRAY_LEN] = {0};
-    uint8_t *pStr = Str_Array;
+    //Sign and the 10 digits of a 32 bit number
+    char Str_Array[12];
+    char *pStr = &Str_Array[sizeof(Str_Array) - 1];
+    //Magnitude as unsigned: -2147483648 has no positive int32_t
+    uint32_t Magnitude = (Nummber < 0) ? (0U - (uint32_t)Nummber) : (uint32_t)Nummber;
 
     if (Xpoint > Paint.Width || Ypoint > Paint.Height) {
         Debug("Paint_DisNum Input exceeds the normal display range\r\n");
         return;
     }
 
-    //Converts a number to a string
-    while (Nummber) {
-        Num_Array[Num_Bit] = Nummber % 10 + '0';
-        Num_Bit++;
-        Nummber /= 10;
-    }
-
-    //The string is inverted
-    while (Num_Bit > 0) {
-        Str_Array[Str_Bit] = Num_Array[Num_Bit - 1];
-        Str_Bit ++;
-        Num_Bit --;
-    }
+    //Converts a number to a string, from the last digit; 0 gives "0"
+    *pStr = '\0';
+    do {
+        *--pStr = (char)(Magnitude % 10 + '0');
+        Magnitude /= 10;
+    } while (Magnitude);
+    if (Nummber < 0)
+        *--pStr = '-';
 
     //show
-    Paint_DrawString_EN(Xpoint, Ypoint, (const char*)pStr, Font, Color_Background, Color_Foreground);
+    Paint_DrawString_EN(Xpoint, Ypoint, pStr, Font, Color_Background, Color_Foreground);
 }
 
 /******************************************************************************
@@ -671,6 +667,24 @@ parameter:
 void Paint_DrawImage(const unsigned char *image, UWORD xStart, UWORD yStart, UWORD W_Image, UWORD H_Image) 
 {
     int i,j; 
+    if(xStart >= LCD_WIDTH || yStart >= LCD_HEIGHT)
+        return;
+    //Unrotated: the image is a rectangle of the framebuffer, convert/copy it in one go
+    //(the images are native RGB565, two bytes per pixel, low byte first)
+    if(Paint.Rotate == ROTATE_0 && Paint.Mirror == MIRROR_NONE){
+        UWORD W = (xStart + W_Image > LCD_WIDTH) ? (LCD_WIDTH - xStart) : W_Image;
+        UWORD H = (yStart + H_Image > LCD_HEIGHT) ? (LCD_HEIGHT - yStart) : H_Image;
+        VISION_ColorFormat_t Format = (BSP_LCD_GetPixelFormat() == LTDC_PIXEL_FORMAT_RGB565) ?
+                VISION_COLOR_RGB565 : VISION_COLOR_ARGB8888;
+        UDOUBLE Bpp = VISION_Color_BytesPerPixel(Format);
+        uint8_t *Dst = (uint8_t *)BSP_LCD_GetLayerAddress() + (yStart * BSP_LCD_GetXSize() + xStart) * Bpp;
+
+        if(W == 0 || H == 0)
+            return;
+        if(VISION_Color_Convert(image, VISION_COLOR_RGB565, W_Image * 2, Dst, Format,
+                BSP_LCD_GetXSize() * Bpp, W, H, VISION_COLOR_AUTO) == VISION_COLOR_OK)
+            return;
+    }
 		for(j = 0; j < H_Image; j++){
 			for(i = 0; i < W_Image; i++){
 				if(xStart+i < LCD_WIDTH  &&  yStart+j < LCD_HEIGHT)//Exceeded part does not display
@@ -0,0 +1,366 @@
+/*
+ * GUI_Readout.c
+ * Numeric and clock readouts that redraw only the characters that changed
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "main.h"
+#include "GUI_Readout.h"
+#include "GUI_Text.h"
+#include "BSP_DMA2D.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define READOUT_GLYPHS                (sizeof(GUI_READOUT_CHARSET) - 1U)
+#define READOUT_STRIP_PIXELS          (READOUT_GLYPHS * GUI_READOUT_CELL_BYTES / 2U)
+#define READOUT_BLANK                 (0U)        /* ' ' in the strip */
+
+/******************************************************************************
+ *                            LOCAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    sFONT       *font;            /* NULL: free */
+    uint16_t    fg;
+    uint16_t    bg;
+    uint32_t    used;             /* update stamp, for the LRU */
+} Readout_Strip_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    GUI_Readout_Stats_t stats;
+    uint32_t            uses;
+    Readout_Strip_t     strip[GUI_READOUT_STRIPS];
+} Readout;
+
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint16_t Readout_Pixels[GUI_READOUT_STRIPS][READOUT_STRIP_PIXELS];
+
+/* "00" to "99": two digits per division */
+static const char Readout_Pairs[] =
+    "00010203040506070809" "10111213141516171819" "20212223242526272829"
+    "30313233343536373839" "40414243444546474849" "50515253545556575859"
+    "60616263646566676869" "70717273747576777879" "80818283848586878889"
+    "90919293949596979899";
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static uint32_t Glyph(char c);
+static const uint16_t* Strip(const GUI_Readout_t *r);
+static void Render(uint16_t *pixels, const sFONT *font, uint16_t fg, uint16_t bg);
+static uint8_t Update(GUI_Readout_t *r, const char *text);
+static void Copy(const GUI_Text_Surface_t *s, int32_t x, int32_t y, const uint16_t *cell,
+        const sFONT *font);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void GUI_Readout_Init(void)
+{
+    memset(&Readout, 0, sizeof(Readout));
+}
+
+void GUI_Readout_Create(GUI_Readout_t *readout, int16_t x, int16_t y, sFONT *font,
+        uint16_t fg, uint16_t bg, uint8_t cells, uint8_t decimals)
+{
+    GUI_Readout_t *r = readout;
+
+    r->font = font;
+    r->x = x;
+    r->y = y;
+    r->fg = fg;
+    r->bg = bg;
+    r->cells = (cells > GUI_READOUT_CELLS_MAX) ? (uint8_t)GUI_READOUT_CELLS_MAX : cells;
+    r->decimals = decimals;
+    if (((uint32_t)font->Width * font->Height * 2U) > GUI_READOUT_CELL_BYTES)
+    {
+        /* Doesn't fit a strip cell */
+        r->cells = 0U;
+    }
+    GUI_Readout_Invalidate(r);
+}
+
+uint8_t GUI_Readout_SetNumber(GUI_Readout_t *readout, int32_t value)
+{
+    char num[GUI_READOUT_NUMBER_CHARS];
+    char text[GUI_READOUT_CELLS_MAX + 1U];
+    uint32_t len = GUI_Readout_FormatNumber(num, value, readout->decimals);
+    uint32_t pad;
+
+    if (len > readout->cells)
+    {
+        memset(text, '-', readout->cells);
+    }
+    else
+    {
+        pad = readout->cells - len;
+        memset(text, ' ', pad);
+        memcpy(&text[pad], num, len);
+    }
+    text[readout->cells] = '\0';
+    return Update(readout, text);
+}
+
+uint8_t GUI_Readout_SetTime(GUI_Readout_t *readout, uint8_t hour, uint8_t min, uint8_t sec)
+{
+    char text[9];
+
+    memcpy(&text[0], &Readout_Pairs[(hour % 100U) * 2U], 2U);
+    text[2] = ':';
+    memcpy(&text[3], &Readout_Pairs[(min % 100U) * 2U], 2U);
+    text[5] = ':';
+    memcpy(&text[6], &Readout_Pairs[(sec % 100U) * 2U], 2U);
+    text[8] = '\0';
+    return Update(readout, text);
+}
+
+uint8_t GUI_Readout_SetText(GUI_Readout_t *readout, const char *text)
+{
+    char line[GUI_READOUT_CELLS_MAX + 1U];
+    uint32_t i;
+
+    for (i = 0U; (i < readout->cells) && (text[i] != '\0'); i++)
+    {
+        line[i] = text[i];
+    }
+    for (; i < readout->cells; i++)
+    {
+        line[i] = ' ';
+    }
+    line[i] = '\0';
+    return Update(readout, line);
+}
+
+void GUI_Readout_Invalidate(GUI_Readout_t *readout)
+{
+    memset(readout->shown, 0, sizeof(readout->shown));
+}
+
+uint8_t GUI_Readout_FormatNumber(char *buf, int32_t value, uint8_t decimals)
+{
+    char digits[10];
+    char *p = &digits[sizeof(digits)];
+    uint32_t u = (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+    uint32_t n, len = 0U;
+
+    decimals = (decimals > 9U) ? 9U : decimals;
+    while (u >= 100U)
+    {
+        uint32_t q = u / 100U;
+
+        p -= 2;
+        memcpy(p, &Readout_Pairs[(u - q * 100U) * 2U], 2U);
+        u = q;
+    }
+    if (u >= 10U)
+    {
+        p -= 2;
+        memcpy(p, &Readout_Pairs[u * 2U], 2U);
+    }
+    else
+    {
+        *--p = (char)('0' + u);
+    }
+    n = (uint32_t)(&digits[sizeof(digits)] - p);
+
+    if (value < 0)
+    {
+        buf[len++] = '-';
+    }
+    if (n <= decimals)
+    {
+        /* 0.0ddd */
+        buf[len++] = '0';
+        buf[len++] = '.';
+        memset(&buf[len], '0', decimals - n);
+        len += decimals - n;
+        memcpy(&buf[len], p, n);
+        len += n;
+    }
+    else
+    {
+        memcpy(&buf[len], p, n - decimals);
+        len += n - decimals;
+        if (decimals != 0U)
+        {
+            buf[len++] = '.';
+            memcpy(&buf[len], p + n - decimals, decimals);
+            len += decimals;
+        }
+    }
+    buf[len] = '\0';
+    return (uint8_t)len;
+}
+
+const GUI_Readout_Stats_t* GUI_Readout_GetStats(void)
+{
+    return &Readout.stats;
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+/* Index of a character in the strip */
+static uint32_t Glyph(char c)
+{
+    if ((c >= '0') && (c <= '9'))
+    {
+        return 5U + (uint32_t)(c - '0');
+    }
+    switch (c)
+    {
+        case '+': return 1U;
+        case '-': return 2U;
+        case '.': return 3U;
+        case ':': return 4U;
+        default:  return READOUT_BLANK;
+    }
+}
+
+/* Strip of the readout's font and colors, built if no slot holds it */
+static const uint16_t* Strip(const GUI_Readout_t *r)
+{
+    uint32_t lru = 0U;
+
+    for (uint32_t i = 0U; i < GUI_READOUT_STRIPS; i++)
+    {
+        Readout_Strip_t *st = &Readout.strip[i];
+
+        if ((st->font == r->font) && (st->fg == r->fg) && (st->bg == r->bg))
+        {
+            st->used = Readout.uses;
+            return Readout_Pixels[i];
+        }
+        if ((st->font == NULL) ||
+            ((Readout.strip[lru].font != NULL) && (st->used < Readout.strip[lru].used)))
+        {
+            lru = i;
+        }
+    }
+
+    Render(Readout_Pixels[lru], r->font, r->fg, r->bg);
+    Readout.strip[lru].font = r->font;
+    Readout.strip[lru].fg = r->fg;
+    Readout.strip[lru].bg = r->bg;
+    Readout.strip[lru].used = Readout.uses;
+    Readout.stats.strip_builds++;
+    return Readout_Pixels[lru];
+}
+
+/* The charset, one cell after the other, as Paint_DrawChar draws it */
+static void Render(uint16_t *pixels, const sFONT *font, uint16_t fg, uint16_t bg)
+{
+    uint32_t pitch = (font->Width + 7U) / 8U;
+    uint16_t *p = pixels;
+
+    for (uint32_t i = 0U; i < READOUT_GLYPHS; i++)
+    {
+        const uint8_t *bits = &font->table[(uint32_t)(GUI_READOUT_CHARSET[i] - ' ') *
+                font->Height * pitch];
+
+        for (uint32_t l = 0U; l < font->Height; l++, bits += pitch)
+        {
+            for (uint32_t c = 0U; c < font->Width; c++)
+            {
+                *p++ = (bits[c / 8U] & (0x80U >> (c % 8U))) ? fg : bg;
+            }
+        }
+    }
+}
+
+static uint8_t Update(GUI_Readout_t *r, const char *text)
+{
+    const GUI_Text_Surface_t *s;
+    const uint16_t *strip;
+    uint32_t cell = (uint32_t)r->font->Width * r->font->Height;
+    uint8_t drawn = 0U;
+
+    Readout.uses++;
+    Readout.stats.updates++;
+    if (r->cells == 0U)
+    {
+        return 0U;
+    }
+    s = GUI_Text_GetSurface();
+    strip = Strip(r);
+    for (uint32_t i = 0U; i < r->cells; i++)
+    {
+        /* Blanks after the end of the text */
+        uint32_t g = Glyph(*text);
+        char c = GUI_READOUT_CHARSET[g];
+
+        text += (*text != '\0') ? 1 : 0;
+
+        if (r->shown[i] == c)
+        {
+            Readout.stats.skipped++;
+            continue;
+        }
+        Copy(s, r->x + (int32_t)(i * r->font->Width), r->y, &strip[g * cell], r->font);
+        r->shown[i] = c;
+        drawn++;
+    }
+    Readout.stats.drawn += drawn;
+    return drawn;
+}
+
+/* One cell, clipped to the surface */
+static void Copy(const GUI_Text_Surface_t *s, int32_t x, int32_t y, const uint16_t *cell,
+        const sFONT *font)
+{
+    int32_t x0 = (x < 0) ? -x : 0;
+    int32_t y0 = (y < 0) ? -y : 0;
+    int32_t x1 = ((x + font->Width) > s->width) ? (s->width - x) : font->Width;
+    int32_t y1 = ((y + font->Height) > s->height) ? (s->height - y) : font->Height;
+    const uint16_t *src;
+    uint16_t *dst;
+    uint32_t w, h;
+
+    if ((x0 >= x1) || (y0 >= y1))
+    {
+        return;
+    }
+    w = (uint32_t)(x1 - x0);
+    h = (uint32_t)(y1 - y0);
+    src = cell + (uint32_t)y0 * font->Width + (uint32_t)x0;
+    dst = s->base + (uint32_t)(y + y0) * s->stride + (uint32_t)(x + x0);
+
+    if ((w * h) >= GUI_READOUT_DMA2D_MIN_PIXELS)
+    {
+        BSP_DMA2D_Pfc_t pfc;
+
+        pfc.src = src;
+        pfc.dst = dst;
+        pfc.src_stride = font->Width * 2U;
+        pfc.dst_stride = s->stride * 2U;
+        pfc.width = w;
+        pfc.lines = h;
+        pfc.in_mode = DMA2D_INPUT_RGB565;
+        pfc.out_mode = DMA2D_OUTPUT_RGB565;
+        pfc.swap = 0U;
+        if (BSP_DMA2D_Convert(&pfc) == HAL_OK)
+        {
+            return;
+        }
+        Readout.stats.blit_errors++;
+    }
+    for (uint32_t l = 0U; l < h; l++)
+    {
+        memcpy(dst + l * s->stride, src + l * font->Width, w * 2U);
+    }
+}
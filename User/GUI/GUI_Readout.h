@@ -0,0 +1,106 @@
+/*
+ * GUI_Readout.h
+ * Numeric and clock readouts that redraw only the characters that changed
+ *
+ * A readout is a row of fixed width cells of a bitmap font (fonts.h) at a
+ * place on the GUI_Text surface. It keeps the characters on screen, so an
+ * update formats the new value and copies only the cells that differ: a
+ * clock ticking seconds copies one cell, a speed going from 118 to 119 one.
+ *
+ * Cells are copied from a digit strip: the characters " +-.:0123456789"
+ * rendered once per font and color pair into SDRAM, one after the other,
+ * so a cell is a single DMA2D copy (CPU copy below
+ * GUI_READOUT_DMA2D_MIN_PIXELS). Strips are shared by the readouts of the
+ * same font and colors; GUI_READOUT_STRIPS of them are kept, the least
+ * recently used is rebuilt for a new pair.
+ *
+ * Numbers are fixed point: value 1234 with 2 decimals shows "12.34". They
+ * are right aligned in the cells, blank padded; a value that doesn't fit
+ * shows dashes. Characters outside the strip show as blanks.
+ *
+ * Drawing the surface over a readout (clear, image) leaves it stale: call
+ * GUI_Readout_Invalidate() so the next update redraws every cell.
+ */
+
+#ifndef GUI_READOUT_H_
+#define GUI_READOUT_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "fonts.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+#define GUI_READOUT_CELLS_MAX                    (12U)
+#define GUI_READOUT_STRIPS                       (8U)
+/* Largest cell of a strip: Font24, 17 x 24 RGB565 */
+#define GUI_READOUT_CELL_BYTES                   (17U * 24U * 2U)
+/* Smaller cells are copied by the CPU */
+#define GUI_READOUT_DMA2D_MIN_PIXELS             (64U)
+
+/* Characters of a strip, in order */
+#define GUI_READOUT_CHARSET                      " +-.:0123456789"
+
+/* Cells of GUI_Readout_FormatNumber() output, with the NUL */
+#define GUI_READOUT_NUMBER_CHARS                 (13U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    sFONT       *font;
+    int16_t     x;
+    int16_t     y;
+    uint16_t    fg;
+    uint16_t    bg;
+    uint8_t     cells;
+    uint8_t     decimals;         /* numbers only */
+    char        shown[GUI_READOUT_CELLS_MAX];    /* on screen, 0: not drawn */
+} GUI_Readout_t;
+
+typedef struct
+{
+    uint32_t updates;
+    uint32_t drawn;               /* cells copied */
+    uint32_t skipped;             /* cells unchanged */
+    uint32_t strip_builds;
+    uint32_t blit_errors;         /* DMA2D refused, copied by the CPU */
+} GUI_Readout_Stats_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Drops every strip */
+extern void GUI_Readout_Init(void);
+
+/* Places a readout of cells (up to GUI_READOUT_CELLS_MAX) characters;
+ * nothing is drawn before the first update */
+extern void GUI_Readout_Create(GUI_Readout_t *readout, int16_t x, int16_t y, sFONT *font,
+        uint16_t fg, uint16_t bg, uint8_t cells, uint8_t decimals);
+
+/* Each returns the count of cells drawn */
+extern uint8_t GUI_Readout_SetNumber(GUI_Readout_t *readout, int32_t value);
+/* "HH:MM:SS", 8 cells */
+extern uint8_t GUI_Readout_SetTime(GUI_Readout_t *readout, uint8_t hour, uint8_t min,
+        uint8_t sec);
+/* Left aligned, blank padded */
+extern uint8_t GUI_Readout_SetText(GUI_Readout_t *readout, const char *text);
+
+/* The next update redraws every cell */
+extern void GUI_Readout_Invalidate(GUI_Readout_t *readout);
+
+/* Fixed point value with decimals (up to 9) to text, no division by a
+ * variable; returns the length */
+extern uint8_t GUI_Readout_FormatNumber(char *buf, int32_t value, uint8_t decimals);
+
+extern const GUI_Readout_Stats_t* GUI_Readout_GetStats(void);
+
+#endif /* GUI_READOUT_H_ */
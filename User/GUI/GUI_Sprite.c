@@ -0,0 +1,559 @@
+/*
+ * GUI_Sprite.c
+ * Animated sprites over the GUI_Text surface, with save-under and DMA2D
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "main.h"
+#include "GUI_Sprite.h"
+#include "GUI_Text.h"
+#include "BSP_DMA2D.h"
+#include "vision_simd.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+/* Buffers start on a cache line */
+#define SPRITE_ALIGN                  (32U)
+
+/******************************************************************************
+ *                            LOCAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    int32_t x;
+    int32_t y;
+    int32_t w;                    /* 0: empty */
+    int32_t h;
+} Sprite_Rect_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    GUI_Sprite_Stats_t  stats;
+    uint32_t            used;             /* pool bytes */
+    uint32_t            seq;              /* sprites drawn, stacking stamp */
+    uint32_t            count;
+    GUI_Sprite_t        *list[GUI_SPRITE_MAX];    /* by z, bottom first */
+} Sprite;
+
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint8_t Sprite_Pool[GUI_SPRITE_POOL_BYTES];
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static void* Alloc(uint32_t size);
+static void Insert(GUI_Sprite_t *sp);
+static void Unlink(const GUI_Sprite_t *sp);
+static void Target(const GUI_Text_Surface_t *s, const GUI_Sprite_t *sp, Sprite_Rect_t *r);
+static void Shown(const GUI_Sprite_t *sp, Sprite_Rect_t *r);
+static uint8_t Overlap(const Sprite_Rect_t *a, const Sprite_Rect_t *b);
+static void Copy(uint16_t *dst, uint32_t dst_stride, const uint16_t *src, uint32_t src_stride,
+        uint32_t w, uint32_t h);
+static void Draw(const GUI_Text_Surface_t *s, const GUI_Sprite_t *sp);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void GUI_Sprite_Init(void)
+{
+    memset(&Sprite, 0, sizeof(Sprite));
+    VISION_CyclesInit();
+}
+
+uint8_t GUI_Sprite_LoadSheet(GUI_Sprite_Sheet_t *sheet, const void *pixels,
+        VISION_ColorFormat_t format, uint32_t stride, uint16_t width, uint16_t height,
+        uint16_t frame_width, uint16_t frame_height, uint32_t key)
+{
+    uint8_t alpha = ((format == VISION_COLOR_ARGB8888) ||
+                     ((format == VISION_COLOR_RGB565) && (key != GUI_SPRITE_NO_KEY))) ? 1U : 0U;
+    uint32_t bpp = alpha ? 4U : 2U;
+    uint8_t *buf;
+
+    if ((frame_width == 0U) || (frame_height == 0U) || (frame_width > width) ||
+        (frame_height > height) || (format >= VISION_COLOR_FORMATS) ||
+        ((buf = Alloc((uint32_t)width * height * bpp)) == NULL))
+    {
+        return 0U;
+    }
+
+    if ((format == VISION_COLOR_RGB565) && alpha)
+    {
+        /* Key pixels transparent, the others opaque and widened */
+        for (uint32_t y = 0U; y < height; y++)
+        {
+            const uint16_t *src = (const uint16_t*)(const void*)((const uint8_t*)pixels +
+                    y * stride);
+            uint32_t *dst = (uint32_t*)(void*)buf + y * width;
+
+            for (uint32_t x = 0U; x < width; x++)
+            {
+                uint32_t c = src[x];
+
+                dst[x] = (c == key) ? 0U : (0xFF000000U | BSP_DMA2D_Rgb565To888(c));
+            }
+        }
+    }
+    else if (VISION_Color_Convert(pixels, format, stride, buf,
+            alpha ? VISION_COLOR_ARGB8888 : VISION_COLOR_RGB565, width * bpp, width, height,
+            VISION_COLOR_AUTO) != VISION_COLOR_OK)
+    {
+        Sprite.used -= ((uint32_t)width * height * bpp + SPRITE_ALIGN - 1U) & ~(SPRITE_ALIGN - 1U);
+        Sprite.stats.pool_bytes = Sprite.used;
+        return 0U;
+    }
+
+    sheet->pixels = buf;
+    sheet->width = width;
+    sheet->height = height;
+    sheet->frame_width = frame_width;
+    sheet->frame_height = frame_height;
+    sheet->columns = width / frame_width;
+    sheet->frames = (uint16_t)(sheet->columns * (height / frame_height));
+    sheet->format = alpha ? (uint8_t)GUI_SPRITE_ARGB8888 : (uint8_t)GUI_SPRITE_RGB565;
+    return 1U;
+}
+
+uint8_t GUI_Sprite_Create(GUI_Sprite_t *sprite, const GUI_Sprite_Sheet_t *sheet,
+        int16_t x, int16_t y, int16_t z)
+{
+    if (Sprite.count >= GUI_SPRITE_MAX)
+    {
+        return 0U;
+    }
+    memset(sprite, 0, sizeof(*sprite));
+    sprite->save = Alloc((uint32_t)sheet->frame_width * sheet->frame_height * 2U);
+    if (sprite->save == NULL)
+    {
+        return 0U;
+    }
+    sprite->sheet = sheet;
+    sprite->x = x;
+    sprite->y = y;
+    sprite->z = z;
+    sprite->alpha = 0xFFU;
+    sprite->visible = 1U;
+    sprite->dirty = 1U;
+    Insert(sprite);
+    return 1U;
+}
+
+void GUI_Sprite_Remove(GUI_Sprite_t *sprite)
+{
+    GUI_Sprite_Show(sprite, 0U);
+    (void)GUI_Sprite_Render();
+    Unlink(sprite);
+}
+
+void GUI_Sprite_Move(GUI_Sprite_t *sprite, int16_t x, int16_t y)
+{
+    if ((sprite->x != x) || (sprite->y != y))
+    {
+        sprite->x = x;
+        sprite->y = y;
+        sprite->dirty = 1U;
+    }
+}
+
+void GUI_Sprite_Show(GUI_Sprite_t *sprite, uint8_t visible)
+{
+    visible = visible ? 1U : 0U;
+    if (sprite->visible != visible)
+    {
+        sprite->visible = visible;
+        sprite->dirty = 1U;
+    }
+}
+
+void GUI_Sprite_SetZ(GUI_Sprite_t *sprite, int16_t z)
+{
+    if (sprite->z != z)
+    {
+        Unlink(sprite);
+        sprite->z = z;
+        sprite->dirty = 1U;
+        Insert(sprite);
+    }
+}
+
+void GUI_Sprite_SetAlpha(GUI_Sprite_t *sprite, uint8_t alpha)
+{
+    if (sprite->alpha != alpha)
+    {
+        sprite->alpha = alpha;
+        sprite->dirty = 1U;
+    }
+}
+
+void GUI_Sprite_SetFrame(GUI_Sprite_t *sprite, uint16_t frame)
+{
+    sprite->anim_count = 0U;
+    frame = (frame < sprite->sheet->frames) ? frame : (uint16_t)(sprite->sheet->frames - 1U);
+    if (sprite->frame != frame)
+    {
+        sprite->frame = frame;
+        sprite->dirty = 1U;
+    }
+}
+
+void GUI_Sprite_Animate(GUI_Sprite_t *sprite, uint16_t first, uint16_t count,
+        uint16_t period_ms, uint8_t loop)
+{
+    uint16_t frames = sprite->sheet->frames;
+
+    first = (first < frames) ? first : (uint16_t)(frames - 1U);
+    count = (count > (frames - first)) ? (uint16_t)(frames - first) : count;
+    sprite->anim_first = first;
+    sprite->anim_count = count;
+    sprite->anim_period_ms = (period_ms != 0U) ? period_ms : 1U;
+    sprite->anim_loop = loop;
+    sprite->anim_start = HAL_GetTick();
+    if (sprite->frame != first)
+    {
+        sprite->frame = first;
+        sprite->dirty = 1U;
+    }
+}
+
+uint32_t GUI_Sprite_Render(void)
+{
+    const GUI_Text_Surface_t *s = GUI_Text_GetSurface();
+    uint32_t start = VISION_CYCLES();
+    uint32_t now = HAL_GetTick();
+    uint32_t drawn = 0U, restored = 0U, pixels = 0U, changed = 0U;
+
+    /* Animation steps */
+    for (uint32_t i = 0U; i < Sprite.count; i++)
+    {
+        GUI_Sprite_t *sp = Sprite.list[i];
+
+        if (sp->anim_count != 0U)
+        {
+            uint32_t step = (now - sp->anim_start) / sp->anim_period_ms;
+            uint16_t frame;
+
+            step = sp->anim_loop ? (step % sp->anim_count) :
+                    ((step < sp->anim_count) ? step : (sp->anim_count - 1U));
+            frame = (uint16_t)(sp->anim_first + step);
+            if (sp->frame != frame)
+            {
+                sp->frame = frame;
+                sp->dirty = 1U;
+            }
+        }
+    }
+
+    /* A change spreads to the sprites on top of it on screen (they go before
+     * it is restored) and to those above its new place (they go back after
+     * it), until none is left */
+    do
+    {
+        changed = 0U;
+        for (uint32_t i = 0U; i < Sprite.count; i++)
+        {
+            const GUI_Sprite_t *sp = Sprite.list[i];
+            Sprite_Rect_t old, cur;
+
+            if (!sp->dirty)
+            {
+                continue;
+            }
+            Shown(sp, &old);
+            Target(s, sp, &cur);
+            for (uint32_t j = 0U; j < Sprite.count; j++)
+            {
+                GUI_Sprite_t *up = Sprite.list[j];
+                Sprite_Rect_t at;
+
+                if (up->dirty || !up->drawn)
+                {
+                    continue;
+                }
+                Shown(up, &at);
+                if (((up->seq > sp->seq) && Overlap(&at, &old)) ||
+                    ((j > i) && Overlap(&at, &cur)))
+                {
+                    up->dirty = 1U;
+                    changed = 1U;
+                }
+            }
+        }
+    } while (changed);
+    for (uint32_t i = 0U; i < Sprite.count; i++)
+    {
+        changed |= Sprite.list[i]->dirty;
+    }
+    if (changed == 0U)
+    {
+        return 0U;
+    }
+
+    /* Backgrounds back, last drawn first */
+    for (;;)
+    {
+        GUI_Sprite_t *top = NULL;
+
+        for (uint32_t i = 0U; i < Sprite.count; i++)
+        {
+            GUI_Sprite_t *sp = Sprite.list[i];
+
+            top = (sp->dirty && sp->drawn && ((top == NULL) || (sp->seq > top->seq))) ? sp : top;
+        }
+        if (top == NULL)
+        {
+            break;
+        }
+        Copy(s->base + (uint32_t)top->shown_y * s->stride + (uint32_t)top->shown_x, s->stride,
+                top->save, top->shown_width, top->shown_width, top->shown_height);
+        top->drawn = 0U;
+        restored++;
+        pixels += (uint32_t)top->shown_width * top->shown_height;
+    }
+
+    /* Save-under and draw, bottom up */
+    for (uint32_t i = 0U; i < Sprite.count; i++)
+    {
+        GUI_Sprite_t *sp = Sprite.list[i];
+        Sprite_Rect_t r;
+
+        if (!sp->dirty)
+        {
+            continue;
+        }
+        sp->dirty = 0U;
+        Target(s, sp, &r);
+        if (!sp->visible || (r.w == 0))
+        {
+            continue;
+        }
+        sp->shown_x = (int16_t)r.x;
+        sp->shown_y = (int16_t)r.y;
+        sp->shown_width = (uint16_t)r.w;
+        sp->shown_height = (uint16_t)r.h;
+        Copy(sp->save, (uint32_t)r.w, s->base + (uint32_t)r.y * s->stride + (uint32_t)r.x,
+                s->stride, (uint32_t)r.w, (uint32_t)r.h);
+        Draw(s, sp);
+        sp->drawn = 1U;
+        sp->seq = ++Sprite.seq;
+        drawn++;
+        pixels += (uint32_t)r.w * (uint32_t)r.h * 2U;
+    }
+
+    start = (VISION_CYCLES() - start) / (SystemCoreClock / 1000000U);
+    Sprite.stats.renders++;
+    Sprite.stats.drawn += drawn;
+    Sprite.stats.restored += restored;
+    Sprite.stats.last_us = start;
+    Sprite.stats.last_drawn = drawn;
+    Sprite.stats.last_restored = restored;
+    Sprite.stats.last_pixels = pixels;
+    Sprite.stats.max_us = (start > Sprite.stats.max_us) ? start : Sprite.stats.max_us;
+    return drawn;
+}
+
+void GUI_Sprite_Invalidate(void)
+{
+    for (uint32_t i = 0U; i < Sprite.count; i++)
+    {
+        Sprite.list[i]->drawn = 0U;
+        Sprite.list[i]->dirty = 1U;
+    }
+}
+
+const GUI_Sprite_Stats_t* GUI_Sprite_GetStats(void)
+{
+    return &Sprite.stats;
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+/* Next size bytes of the pool, NULL when it is used up */
+static void* Alloc(uint32_t size)
+{
+    uint8_t *p;
+
+    size = (size + SPRITE_ALIGN - 1U) & ~(SPRITE_ALIGN - 1U);
+    if ((size == 0U) || (size > (GUI_SPRITE_POOL_BYTES - Sprite.used)))
+    {
+        return NULL;
+    }
+    p = &Sprite_Pool[Sprite.used];
+    Sprite.used += size;
+    Sprite.stats.pool_bytes = Sprite.used;
+    return p;
+}
+
+/* Into the list by z, on top of the sprites of the same z */
+static void Insert(GUI_Sprite_t *sp)
+{
+    uint32_t i = Sprite.count;
+
+    for (; (i > 0U) && (Sprite.list[i - 1U]->z > sp->z); i--)
+    {
+        Sprite.list[i] = Sprite.list[i - 1U];
+    }
+    Sprite.list[i] = sp;
+    Sprite.count++;
+}
+
+static void Unlink(const GUI_Sprite_t *sp)
+{
+    uint32_t i;
+
+    for (i = 0U; (i < Sprite.count) && (Sprite.list[i] != sp); i++)
+    {
+    }
+    if (i < Sprite.count)
+    {
+        Sprite.count--;
+        memmove(&Sprite.list[i], &Sprite.list[i + 1U], (Sprite.count - i) * sizeof(Sprite.list[0]));
+    }
+}
+
+/* Where the sprite goes, clipped to the surface; empty if hidden */
+static void Target(const GUI_Text_Surface_t *s, const GUI_Sprite_t *sp, Sprite_Rect_t *r)
+{
+    int32_t x0 = (sp->x < 0) ? 0 : sp->x;
+    int32_t y0 = (sp->y < 0) ? 0 : sp->y;
+    int32_t x1 = sp->x + sp->sheet->frame_width;
+    int32_t y1 = sp->y + sp->sheet->frame_height;
+
+    x1 = (x1 > s->width) ? s->width : x1;
+    y1 = (y1 > s->height) ? s->height : y1;
+    r->x = x0;
+    r->y = y0;
+    r->w = ((x1 > x0) && (y1 > y0) && sp->visible) ? (x1 - x0) : 0;
+    r->h = y1 - y0;
+}
+
+/* Where it is on screen, empty if it isn't */
+static void Shown(const GUI_Sprite_t *sp, Sprite_Rect_t *r)
+{
+    r->x = sp->shown_x;
+    r->y = sp->shown_y;
+    r->w = sp->drawn ? sp->shown_width : 0;
+    r->h = sp->shown_height;
+}
+
+static uint8_t Overlap(const Sprite_Rect_t *a, const Sprite_Rect_t *b)
+{
+    return ((a->w != 0) && (b->w != 0) && (a->x < (b->x + b->w)) && (b->x < (a->x + a->w)) &&
+            (a->y < (b->y + b->h)) && (b->y < (a->y + a->h))) ? 1U : 0U;
+}
+
+/* RGB565 rectangle, strides in pixels */
+static void Copy(uint16_t *dst, uint32_t dst_stride, const uint16_t *src, uint32_t src_stride,
+        uint32_t w, uint32_t h)
+{
+    if ((w * h) >= GUI_SPRITE_DMA2D_MIN_PIXELS)
+    {
+        BSP_DMA2D_Pfc_t pfc;
+
+        pfc.src = src;
+        pfc.dst = dst;
+        pfc.src_stride = src_stride * 2U;
+        pfc.dst_stride = dst_stride * 2U;
+        pfc.width = w;
+        pfc.lines = h;
+        pfc.in_mode = DMA2D_INPUT_RGB565;
+        pfc.out_mode = DMA2D_OUTPUT_RGB565;
+        pfc.swap = 0U;
+        if (BSP_DMA2D_Convert(&pfc) == HAL_OK)
+        {
+            Sprite.stats.dma2d_jobs++;
+            return;
+        }
+    }
+    Sprite.stats.cpu_jobs++;
+    for (uint32_t l = 0U; l < h; l++)
+    {
+        memcpy(dst + l * dst_stride, src + l * src_stride, w * 2U);
+    }
+}
+
+/* The frame over the saved place: copied if opaque, else blended */
+static void Draw(const GUI_Text_Surface_t *s, const GUI_Sprite_t *sp)
+{
+    const GUI_Sprite_Sheet_t *sh = sp->sheet;
+    uint32_t bpp = (sh->format == GUI_SPRITE_ARGB8888) ? 4U : 2U;
+    uint32_t fx = (uint32_t)(sp->frame % sh->columns) * sh->frame_width +
+            (uint32_t)(sp->shown_x - sp->x);
+    uint32_t fy = (uint32_t)(sp->frame / sh->columns) * sh->frame_height +
+            (uint32_t)(sp->shown_y - sp->y);
+    const uint8_t *src = sh->pixels + (fy * sh->width + fx) * bpp;
+    uint16_t *dst = s->base + (uint32_t)sp->shown_y * s->stride + (uint32_t)sp->shown_x;
+    uint32_t w = sp->shown_width, h = sp->shown_height;
+
+    if ((bpp == 2U) && (sp->alpha == 0xFFU))
+    {
+        Copy(dst, s->stride, (const uint16_t*)(const void*)src, sh->width, w, h);
+        return;
+    }
+    if ((w * h) >= GUI_SPRITE_DMA2D_MIN_PIXELS)
+    {
+        BSP_DMA2D_Blend_t blend;
+
+        blend.src = src;
+        blend.bg = dst;
+        blend.dst = dst;
+        blend.src_stride = sh->width * bpp;
+        blend.bg_stride = s->stride * 2U;
+        blend.dst_stride = s->stride * 2U;
+        blend.width = w;
+        blend.lines = h;
+        blend.src_mode = (bpp == 4U) ? DMA2D_INPUT_ARGB8888 : DMA2D_INPUT_RGB565;
+        blend.bg_mode = DMA2D_INPUT_RGB565;
+        blend.out_mode = DMA2D_OUTPUT_RGB565;
+        blend.color = 0U;
+        blend.alpha = sp->alpha;
+        if (BSP_DMA2D_Blend(&blend) == HAL_OK)
+        {
+            Sprite.stats.dma2d_jobs++;
+            return;
+        }
+    }
+
+    Sprite.stats.cpu_jobs++;
+    for (uint32_t l = 0U; l < h; l++)
+    {
+        const uint8_t *p = src + l * sh->width * bpp;
+        uint16_t *d = dst + l * s->stride;
+
+        for (uint32_t i = 0U; i < w; i++)
+        {
+            uint32_t c, a;
+
+            if (bpp == 4U)
+            {
+                uint32_t px = VISION_LOAD32(p + i * 4U);
+
+                a = ((px >> 24) * sp->alpha + 127U) / 255U;
+                c = ((px >> 8) & 0xF800U) | ((px >> 5) & 0x07E0U) | ((px >> 3) & 0x001FU);
+            }
+            else
+            {
+                a = sp->alpha;
+                c = (uint32_t)p[i * 2U] | ((uint32_t)p[i * 2U + 1U] << 8);
+            }
+            a >>= 3;
+            if (a != 0U)
+            {
+                d[i] = BSP_DMA2D_Blend565(c, d[i], a);
+            }
+        }
+    }
+}
@@ -0,0 +1,159 @@
+/*
+ * GUI_Sprite.h
+ * Animated sprites over the GUI_Text surface, with save-under and DMA2D
+ *
+ * A sheet is a grid of equal frames, left to right then top to bottom,
+ * copied once into a GUI_SPRITE_POOL_BYTES pool in SDRAM:
+ *  - ARGB8888 when it has transparency: an RGB565 source with a color key
+ *    (key pixels get alpha 0) or an ARGB8888 source. Frames are blended
+ *    over the surface by the DMA2D.
+ *  - RGB565 otherwise (any other VISION_Color source), copied as it is.
+ *
+ * A sprite shows a frame of a sheet at a place and a depth (z, the higher
+ * on top). Before it is drawn, the surface under it is saved to a buffer
+ * of the pool; moving, hiding or changing its frame puts that back first,
+ * so nothing has to redraw the background.
+ *
+ * Setters only record the change; GUI_Sprite_Render() applies all of them
+ * at once (after the VSync, or before a layer swap): the changed sprites
+ * and those above them that they touch are restored from the top down,
+ * then drawn again from the bottom up, each job a single DMA2D transfer
+ * (CPU below GUI_SPRITE_DMA2D_MIN_PIXELS). Sprites that don't overlap a
+ * change are not touched. The cost of every render is in the stats.
+ *
+ * Drawing the surface under the sprites by other means (clear, image)
+ * leaves the saved backgrounds stale: call GUI_Sprite_Invalidate().
+ * The pool is never freed piece by piece, GUI_Sprite_Init() starts over.
+ */
+
+#ifndef GUI_SPRITE_H_
+#define GUI_SPRITE_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "vision_color.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Sheets and save-under buffers */
+#define GUI_SPRITE_POOL_BYTES                    (512U * 1024U)
+#define GUI_SPRITE_MAX                           (32U)
+/* Smaller jobs are done by the CPU */
+#define GUI_SPRITE_DMA2D_MIN_PIXELS              (64U)
+
+/* GUI_Sprite_LoadSheet() key: none, the source is opaque */
+#define GUI_SPRITE_NO_KEY                        (0xFFFFFFFFU)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef enum
+{
+    GUI_SPRITE_RGB565 = 0,        /* opaque, copied */
+    GUI_SPRITE_ARGB8888           /* per pixel alpha, blended */
+} GUI_Sprite_Format_t;
+
+typedef struct
+{
+    const uint8_t *pixels;        /* in the pool */
+    uint16_t    width;            /* whole sheet */
+    uint16_t    height;
+    uint16_t    frame_width;
+    uint16_t    frame_height;
+    uint16_t    columns;
+    uint16_t    frames;
+    uint8_t     format;           /* GUI_Sprite_Format_t */
+} GUI_Sprite_Sheet_t;
+
+typedef struct
+{
+    const GUI_Sprite_Sheet_t *sheet;
+    uint16_t    *save;            /* save-under, a frame of RGB565 */
+    int16_t     x;
+    int16_t     y;
+    int16_t     z;
+    uint16_t    frame;
+    uint8_t     alpha;            /* opacity, 255: as the sheet is */
+    uint8_t     visible;
+    uint8_t     dirty;
+
+    /* Animation, frames first to first + count - 1 */
+    uint16_t    anim_first;
+    uint16_t    anim_count;       /* 0: none */
+    uint16_t    anim_period_ms;
+    uint8_t     anim_loop;
+    uint32_t    anim_start;
+
+    /* On screen: the part of the surface saved, then drawn */
+    uint8_t     drawn;
+    uint32_t    seq;              /* drawn after the sprites of lower seq */
+    int16_t     shown_x;
+    int16_t     shown_y;
+    uint16_t    shown_width;
+    uint16_t    shown_height;
+} GUI_Sprite_t;
+
+typedef struct
+{
+    uint32_t renders;             /* with something to do */
+    uint32_t drawn;               /* sprites drawn */
+    uint32_t restored;            /* backgrounds put back */
+    uint32_t dma2d_jobs;
+    uint32_t cpu_jobs;            /* small, or the DMA2D refused */
+    uint32_t pool_bytes;
+    uint32_t last_us;             /* last render */
+    uint32_t last_drawn;
+    uint32_t last_restored;
+    uint32_t last_pixels;         /* saved, restored and drawn */
+    uint32_t max_us;
+} GUI_Sprite_Stats_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Drops every sheet and sprite, empties the pool */
+extern void GUI_Sprite_Init(void);
+
+/* Copies a width x height sheet of frame_width x frame_height frames
+ * (stride in bytes) to the pool. key is the RGB565 value drawn
+ * transparent for an RGB565 source, or GUI_SPRITE_NO_KEY. 0 if the pool
+ * is full or the geometry is wrong. */
+extern uint8_t GUI_Sprite_LoadSheet(GUI_Sprite_Sheet_t *sheet, const void *pixels,
+        VISION_ColorFormat_t format, uint32_t stride, uint16_t width, uint16_t height,
+        uint16_t frame_width, uint16_t frame_height, uint32_t key);
+
+/* Adds a sprite showing frame 0 at (x, y), drawn by the next render; 0 if
+ * there are GUI_SPRITE_MAX of them or no room for its save-under */
+extern uint8_t GUI_Sprite_Create(GUI_Sprite_t *sprite, const GUI_Sprite_Sheet_t *sheet,
+        int16_t x, int16_t y, int16_t z);
+/* Puts the background back at once and forgets the sprite */
+extern void GUI_Sprite_Remove(GUI_Sprite_t *sprite);
+
+extern void GUI_Sprite_Move(GUI_Sprite_t *sprite, int16_t x, int16_t y);
+extern void GUI_Sprite_Show(GUI_Sprite_t *sprite, uint8_t visible);
+/* Goes on top of the sprites of the same z, as a new sprite does */
+extern void GUI_Sprite_SetZ(GUI_Sprite_t *sprite, int16_t z);
+extern void GUI_Sprite_SetAlpha(GUI_Sprite_t *sprite, uint8_t alpha);
+/* Shows a frame, stops the animation */
+extern void GUI_Sprite_SetFrame(GUI_Sprite_t *sprite, uint16_t frame);
+/* Steps through count frames from first, one every period_ms, from now;
+ * without loop it stays on the last one */
+extern void GUI_Sprite_Animate(GUI_Sprite_t *sprite, uint16_t first, uint16_t count,
+        uint16_t period_ms, uint8_t loop);
+
+/* Applies every change since the last render; returns the sprites drawn */
+extern uint32_t GUI_Sprite_Render(void);
+/* The surface was redrawn under the sprites: the next render saves and
+ * draws every one without restoring */
+extern void GUI_Sprite_Invalidate(void);
+
+extern const GUI_Sprite_Stats_t* GUI_Sprite_GetStats(void);
+
+#endif /* GUI_SPRITE_H_ */
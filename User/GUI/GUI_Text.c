@@ -0,0 +1,526 @@
+/*
+ * GUI_Text.c
+ * Anti-aliased text renderer (fonts_aa.h) on RGB565 surfaces
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "main.h"
+#include "ltdc.h"
+#include "GUI_Text.h"
+#include "BSP_DMA2D.h"
+#include "BSP_RGB_LCD.h"
+
+/******************************************************************************
+ *                            LOCAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    const pFONT *font;            /* NULL: free */
+    uint16_t    code;
+    uint8_t     x, y, w, h;       /* ink box, x and w even */
+    uint32_t    used;             /* last use, for the LRU */
+} Text_CacheSlot_t;
+
+typedef struct
+{
+    const GUI_Text_Surface_t *s;
+    int32_t     x;
+    int32_t     y;
+    uint16_t    color;
+} Text_SpanCtx_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    GUI_Text_Stats_t    stats;
+    GUI_Text_Surface_t  surface;
+    uint8_t             custom;           /* surface set, else layer 0 */
+    uint32_t            uses;
+    Text_CacheSlot_t    slot[GUI_TEXT_CACHE_SLOTS];
+} Text;
+
+/* Decoded packed glyphs, A4 cells (AXI SRAM: the DMA2D reads them) */
+static uint8_t Text_Cell[GUI_TEXT_CACHE_SLOTS][GUI_TEXT_CACHE_CELL_BYTES];
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static const GUI_Text_Surface_t* Surface(void);
+static const aGLYPH* FindGlyph(const aFONT *font, uint16_t code);
+static void DrawGlyph(const GUI_Text_Surface_t *s, int32_t x, int32_t y, const aFONT *font,
+        const aGLYPH *g, uint16_t color);
+static void DrawPK(const GUI_Text_Surface_t *s, int32_t x, int32_t y, const pFONT *font,
+        uint16_t code, const uint8_t *glyph, uint16_t color);
+static void DrawBitmap(const GUI_Text_Surface_t *s, int32_t gx, int32_t gy, const uint8_t *bitmap,
+        uint32_t pitch, uint32_t width, uint32_t height, uint32_t bpp, uint16_t color);
+static void SpanFill(uint16_t x, uint16_t y, uint16_t len, void *user);
+static void BlendCPU(uint16_t *dst, uint32_t stride, const uint8_t *src, uint32_t pitch,
+        uint32_t x0, uint32_t width, uint32_t lines, uint32_t bpp, uint16_t color);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void GUI_Text_SetSurface(const GUI_Text_Surface_t *surface)
+{
+    if (surface != NULL)
+    {
+        Text.surface = *surface;
+        Text.custom = 1U;
+    }
+    else
+    {
+        Text.custom = 0U;
+    }
+}
+
+const GUI_Text_Surface_t* GUI_Text_GetSurface(void)
+{
+    return Surface();
+}
+
+uint16_t GUI_Text_NextUTF8(const char **text)
+{
+    const uint8_t *p = (const uint8_t*)*text;
+    uint32_t code = p[0], more, min;
+
+    if (code < 0x80U)
+    {
+        *text += (code != 0U) ? 1 : 0;
+        return (uint16_t)code;
+    }
+    if ((code & 0xE0U) == 0xC0U)
+    {
+        code &= 0x1FU;
+        more = 1U;
+        min = 0x80U;
+    }
+    else if ((code & 0xF0U) == 0xE0U)
+    {
+        code &= 0x0FU;
+        more = 2U;
+        min = 0x800U;
+    }
+    else if ((code & 0xF8U) == 0xF0U)
+    {
+        code &= 0x07U;
+        more = 3U;
+        min = 0x10000U;
+    }
+    else
+    {
+        /* Stray continuation byte */
+        *text += 1;
+        return GUI_TEXT_INVALID_CODE;
+    }
+    for (uint32_t i = 1U; i <= more; i++)
+    {
+        if ((p[i] & 0xC0U) != 0x80U)
+        {
+            /* Cut sequence: the next byte starts over */
+            *text += i;
+            return GUI_TEXT_INVALID_CODE;
+        }
+        code = (code << 6) | (p[i] & 0x3FU);
+    }
+    *text += more + 1U;
+    /* Overlong forms, surrogates and codes beyond the BMP (no glyphs) */
+    if ((code < min) || ((code >= 0xD800U) && (code < 0xE000U)) || (code > 0xFFFFU))
+    {
+        return GUI_TEXT_INVALID_CODE;
+    }
+    return (uint16_t)code;
+}
+
+const aGLYPH* GUI_Text_Lookup(const aFONT *font, uint16_t code)
+{
+    uint32_t lo = 0U, hi = font->count;
+
+    if (font->code == NULL)
+    {
+        return ((uint16_t)(code - font->first) < font->count) ?
+                &font->glyph[code - font->first] : NULL;
+    }
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2U;
+
+        if (font->code[mid] < code)
+        {
+            lo = mid + 1U;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return ((lo < font->count) && (font->code[lo] == code)) ? &font->glyph[lo] : NULL;
+}
+
+const aGLYPH* GUI_Text_Resolve(const GUI_Text_Fonts_t *fonts, uint16_t code, uint8_t *font)
+{
+    for (uint32_t i = 0U; i < fonts->count; i++)
+    {
+        const aGLYPH *g = GUI_Text_Lookup(fonts->font[i], code);
+
+        if (g != NULL)
+        {
+            *font = (uint8_t)i;
+            return g;
+        }
+    }
+    Text.stats.missing++;
+    *font = 0U;
+    return GUI_Text_Lookup(fonts->font[0], '?');
+}
+
+uint16_t GUI_Text_DrawChar(int16_t x, int16_t y, uint16_t code, const aFONT *font,
+        uint16_t color)
+{
+    const aGLYPH *g = FindGlyph(font, code);
+
+    if (g == NULL)
+    {
+        return 0U;
+    }
+    DrawGlyph(Surface(), x, y + font->ascent, font, g, color);
+    return g->advance;
+}
+
+int16_t GUI_Text_DrawString(int16_t x, int16_t y, const char *text, const aFONT *font,
+        uint16_t color)
+{
+    GUI_Text_Fonts_t fonts = { { font }, 1U };
+
+    return GUI_Text_DrawUTF8(x, y, text, &fonts, color);
+}
+
+int16_t GUI_Text_DrawUTF8(int16_t x, int16_t y, const char *text,
+        const GUI_Text_Fonts_t *fonts, uint16_t color)
+{
+    const GUI_Text_Surface_t *s = Surface();
+    const aFONT *line = fonts->font[0];
+    int32_t pen = x;
+    int32_t base = y + line->ascent;
+    uint16_t code, prev = 0U;
+    uint8_t prev_font = 0U;
+
+    while ((code = GUI_Text_NextUTF8(&text)) != 0U)
+    {
+        const aGLYPH *g;
+        uint8_t f;
+
+        if (code == '\n')
+        {
+            pen = x;
+            base += line->height;
+            prev = 0U;
+            continue;
+        }
+        g = GUI_Text_Resolve(fonts, code, &f);
+        if (g != NULL)
+        {
+            /* Pairs are kerned inside a font */
+            pen += (f == prev_font) ? GUI_Text_Kerning(fonts->font[f], prev, code) : 0;
+            DrawGlyph(s, pen, base, fonts->font[f], g, color);
+            pen += g->advance;
+        }
+        prev = code;
+        prev_font = f;
+    }
+    return (int16_t)pen;
+}
+
+void GUI_Text_DrawGlyph(int16_t x, int16_t baseline, const aFONT *font, const aGLYPH *g,
+        uint16_t color)
+{
+    DrawGlyph(Surface(), x, baseline, font, g, color);
+}
+
+int16_t GUI_Text_DrawStringPK(int16_t x, int16_t y, const char *text, const pFONT *font,
+        uint16_t color)
+{
+    const GUI_Text_Surface_t *s = Surface();
+    int32_t pen = x;
+    int32_t line = y;
+    uint16_t code;
+
+    while ((code = FONT_PK_NextCode(&text)) != 0U)
+    {
+        const uint8_t *glyph;
+
+        if (code == '\n')
+        {
+            pen = x;
+            line += font->height;
+            continue;
+        }
+        glyph = FONT_PK_Find(font, code);
+        if (glyph != NULL)
+        {
+            DrawPK(s, pen, line, font, code, glyph, color);
+        }
+        else
+        {
+            Text.stats.missing++;
+        }
+        pen += FONT_PK_Advance(font, code);
+    }
+    return (int16_t)pen;
+}
+
+uint16_t GUI_Text_Width(const char *text, const aFONT *font)
+{
+    int32_t width = 0;
+    uint16_t code, prev = 0U;
+
+    while (((code = GUI_Text_NextUTF8(&text)) != 0U) && (code != '\n'))
+    {
+        const aGLYPH *g = FindGlyph(font, code);
+
+        if (g != NULL)
+        {
+            width += GUI_Text_Kerning(font, prev, code) + g->advance;
+        }
+        prev = code;
+    }
+    return (width > 0) ? (uint16_t)width : 0U;
+}
+
+int8_t GUI_Text_Kerning(const aFONT *font, uint16_t left, uint16_t right)
+{
+    uint32_t key = ((uint32_t)left << 16) | right;
+    uint32_t lo = 0U, hi = font->kern_count;
+
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2U;
+        uint32_t k = ((uint32_t)font->kern[mid].left << 16) | font->kern[mid].right;
+
+        if (k == key)
+        {
+            return font->kern[mid].dx;
+        }
+        if (k < key)
+        {
+            lo = mid + 1U;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    return 0;
+}
+
+const GUI_Text_Stats_t* GUI_Text_GetStats(void)
+{
+    return &Text.stats;
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+static const GUI_Text_Surface_t* Surface(void)
+{
+    if (!Text.custom)
+    {
+        /* Read at every call: the LCD may come up after the first text */
+        Text.surface.base = (uint16_t*)hltdc.LayerCfg[0].FBStartAdress;
+        Text.surface.stride = (uint16_t)BSP_LCD_GetXSize();
+        Text.surface.width = (uint16_t)BSP_LCD_GetXSize();
+        Text.surface.height = (uint16_t)BSP_LCD_GetYSize();
+    }
+    return &Text.surface;
+}
+
+static const aGLYPH* FindGlyph(const aFONT *font, uint16_t code)
+{
+    const aGLYPH *g = GUI_Text_Lookup(font, code);
+
+    if (g != NULL)
+    {
+        return g;
+    }
+    Text.stats.missing++;
+    return GUI_Text_Lookup(font, '?');
+}
+
+static void DrawGlyph(const GUI_Text_Surface_t *s, int32_t x, int32_t y, const aFONT *font,
+        const aGLYPH *g, uint16_t color)
+{
+    uint32_t pitch = (font->bpp == 4U) ? (g->width / 2U) : g->width;
+
+    DrawBitmap(s, x + g->left, y - g->top, font->bitmap + g->offset, pitch, g->width, g->height,
+            font->bpp, color);
+}
+
+static void DrawPK(const GUI_Text_Surface_t *s, int32_t x, int32_t y, const pFONT *font,
+        uint16_t code, const uint8_t *glyph, uint16_t color)
+{
+    /* Even cell width: A4 lines of whole bytes */
+    uint32_t pitch = (font->width + 1U) / 2U;
+    Text_CacheSlot_t *slot = NULL;
+    uint32_t n;
+
+    if ((pitch * font->height) > GUI_TEXT_CACHE_CELL_BYTES)
+    {
+        /* No room in the cache: decoded straight to the surface */
+        Text_SpanCtx_t ctx = { s, x, y, color };
+
+        (void)FONT_PK_Spans(font, glyph, SpanFill, &ctx);
+        Text.stats.cpu++;
+        return;
+    }
+
+    for (n = 0U; n < GUI_TEXT_CACHE_SLOTS; n++)
+    {
+        if ((Text.slot[n].font == font) && (Text.slot[n].code == code))
+        {
+            slot = &Text.slot[n];
+            Text.stats.cache_hits++;
+            break;
+        }
+    }
+    if (slot == NULL)
+    {
+        /* Least recently used slot, free ones first */
+        n = 0U;
+        for (uint32_t i = 1U; i < GUI_TEXT_CACHE_SLOTS; i++)
+        {
+            if ((Text.slot[n].font != NULL) &&
+                ((Text.slot[i].font == NULL) || (Text.slot[i].used < Text.slot[n].used)))
+            {
+                n = i;
+            }
+        }
+        slot = &Text.slot[n];
+        FONT_PK_ExpandA4(font, glyph, Text_Cell[n], pitch);
+        slot->font = font;
+        slot->code = code;
+        slot->x = glyph[1] & 0xFEU;
+        slot->y = glyph[2];
+        slot->w = (uint8_t)(((glyph[1] + glyph[3] + 1U) & 0x1FEU) - slot->x);
+        slot->h = glyph[4];
+        Text.stats.cache_misses++;
+    }
+    slot->used = ++Text.uses;
+    if (slot->h != 0U)
+    {
+        /* Only the ink box of the cell */
+        DrawBitmap(s, x + slot->x, y + slot->y, Text_Cell[n] + slot->y * pitch + slot->x / 2U,
+                pitch, slot->w, slot->h, 4U, color);
+    }
+}
+
+static void DrawBitmap(const GUI_Text_Surface_t *s, int32_t gx, int32_t gy, const uint8_t *bitmap,
+        uint32_t pitch, uint32_t width, uint32_t height, uint32_t bpp, uint16_t color)
+{
+    /* Visible part of the bitmap */
+    int32_t x0 = (gx < 0) ? -gx : 0;
+    int32_t y0 = (gy < 0) ? -gy : 0;
+    int32_t x1 = ((gx + (int32_t)width) > s->width) ? ((int32_t)s->width - gx) : (int32_t)width;
+    int32_t y1 = ((gy + (int32_t)height) > s->height) ? ((int32_t)s->height - gy) : (int32_t)height;
+    const uint8_t *src;
+    uint16_t *dst;
+    uint32_t w, h;
+
+    if ((width == 0U) || (x0 >= x1) || (y0 >= y1))
+    {
+        return;
+    }
+    if ((x0 != 0) || (y0 != 0) || (x1 != (int32_t)width) || (y1 != (int32_t)height))
+    {
+        Text.stats.clipped++;
+    }
+    w = (uint32_t)(x1 - x0);
+    h = (uint32_t)(y1 - y0);
+    src = bitmap + (uint32_t)y0 * pitch;
+    dst = s->base + (uint32_t)(gy + y0) * s->stride + (uint32_t)(gx + x0);
+
+    /* A4 lines for the DMA2D start on a byte and hold whole bytes */
+    if (((w * h) >= GUI_TEXT_DMA2D_MIN_PIXELS) &&
+        ((bpp == 8U) || (((x0 | (int32_t)w) & 1) == 0)))
+    {
+        BSP_DMA2D_Blend_t blend;
+
+        blend.src = src + ((bpp == 4U) ? ((uint32_t)x0 / 2U) : (uint32_t)x0);
+        blend.bg = dst;
+        blend.dst = dst;
+        blend.src_stride = pitch;
+        blend.bg_stride = s->stride * 2U;
+        blend.dst_stride = s->stride * 2U;
+        blend.width = w;
+        blend.lines = h;
+        blend.src_mode = (bpp == 4U) ? DMA2D_INPUT_A4 : DMA2D_INPUT_A8;
+        blend.bg_mode = DMA2D_INPUT_RGB565;
+        blend.out_mode = DMA2D_OUTPUT_RGB565;
+        blend.color = BSP_DMA2D_Rgb565To888(color);
+        blend.alpha = 0xFFU;
+        if (BSP_DMA2D_Blend(&blend) == HAL_OK)
+        {
+            Text.stats.dma2d++;
+            return;
+        }
+    }
+    BlendCPU(dst, s->stride, src, pitch, (uint32_t)x0, w, h, bpp, color);
+    Text.stats.cpu++;
+}
+
+/* Ink span of a packed glyph, solid color */
+static void SpanFill(uint16_t x, uint16_t y, uint16_t len, void *user)
+{
+    const Text_SpanCtx_t *ctx = (const Text_SpanCtx_t*)user;
+    int32_t px = ctx->x + x;
+    int32_t py = ctx->y + y;
+    int32_t end = px + len;
+    uint16_t *dst;
+
+    if ((py < 0) || (py >= ctx->s->height))
+    {
+        return;
+    }
+    px = (px < 0) ? 0 : px;
+    end = (end > ctx->s->width) ? ctx->s->width : end;
+    dst = ctx->s->base + (uint32_t)py * ctx->s->stride;
+    for (; px < end; px++)
+    {
+        dst[px] = ctx->color;
+    }
+}
+
+static void BlendCPU(uint16_t *dst, uint32_t stride, const uint8_t *src, uint32_t pitch,
+        uint32_t x0, uint32_t width, uint32_t lines, uint32_t bpp, uint16_t color)
+{
+    for (uint32_t y = 0U; y < lines; y++, dst += stride, src += pitch)
+    {
+        for (uint32_t x = 0U; x < width; x++)
+        {
+            uint32_t sx = x0 + x;
+            uint32_t a;
+
+            if (bpp == 4U)
+            {
+                a = (src[sx >> 1] >> ((sx & 1U) * 4U)) & 0x0FU;
+                a = (a << 1) | (a >> 3);
+            }
+            else
+            {
+                a = src[sx] >> 3;
+            }
+            if (a != 0U)
+            {
+                dst[x] = BSP_DMA2D_Blend565(color, dst[x], a);
+            }
+        }
+    }
+}
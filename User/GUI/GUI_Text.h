@@ -0,0 +1,123 @@
+/*
+ * GUI_Text.h
+ * Anti-aliased text renderer (fonts_aa.h) on RGB565 surfaces
+ *
+ * Every glyph is one DMA2D blend: the A4/A8 coverage table is the
+ * foreground, read straight from flash with the text color as the fixed
+ * foreground color, over the surface pixels as the background, so the text
+ * is blended over whatever is drawn there. Small glyphs, glyphs cut by the
+ * surface edge on an odd column and a busy DMA2D fall back to a CPU blend
+ * with the same result (5 bit alpha).
+ *
+ * Packed 1 bpp fonts (fonts_pk.h) are decoded into a small cache of A4
+ * cells, least recently used out, and blended the same way from there;
+ * cells too large for the cache are decoded as spans straight into the
+ * surface.
+ *
+ * Text is UTF-8 (ASCII as is). A code is looked up in a set of fonts in
+ * order, the first one that has it draws it, so a Latin font can fall
+ * back on a symbol font and a CJK font; the line box is the first font's.
+ * Every glyph is looked up at every draw: GUI_Layout.h resolves a string
+ * once for labels redrawn often.
+ *
+ * Positions are the top left corner of the line box, the baseline is
+ * font->ascent below. The default surface is LTDC layer 0.
+ */
+
+#ifndef GUI_TEXT_H_
+#define GUI_TEXT_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "fonts_aa.h"
+#include "fonts_pk.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Smaller glyphs are blended by the CPU, faster than programming the DMA2D */
+#define GUI_TEXT_DMA2D_MIN_PIXELS                (32U)
+
+/* Packed glyph cache: slots of a 32x41 A4 cell, the largest CH_CN one */
+#define GUI_TEXT_CACHE_SLOTS                     (16U)
+#define GUI_TEXT_CACHE_CELL_BYTES                (16U * 41U)
+
+/* Fallback fonts of a set */
+#define GUI_TEXT_FONTS_MAX                       (4U)
+
+/* Code of malformed UTF-8 and of codes beyond the BMP */
+#define GUI_TEXT_INVALID_CODE                    (0xFFFDU)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint16_t *base;               /* RGB565 */
+    uint16_t stride;              /* pixels from line to line */
+    uint16_t width;
+    uint16_t height;
+} GUI_Text_Surface_t;
+
+typedef struct
+{
+    uint32_t dma2d;               /* glyphs blended by the DMA2D */
+    uint32_t cpu;                 /* by the CPU */
+    uint32_t clipped;             /* cut by the surface edge */
+    uint32_t missing;             /* codes not in the font */
+    uint32_t cache_hits;          /* packed glyphs */
+    uint32_t cache_misses;
+} GUI_Text_Stats_t;
+
+/* Fonts looked up in order for every code */
+typedef struct
+{
+    const aFONT *font[GUI_TEXT_FONTS_MAX];
+    uint8_t count;
+} GUI_Text_Fonts_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Target of the next calls, NULL: LTDC layer 0 */
+extern void GUI_Text_SetSurface(const GUI_Text_Surface_t *surface);
+extern const GUI_Text_Surface_t* GUI_Text_GetSurface(void);
+
+/* Next code of a UTF-8 string, 0 at the end */
+extern uint16_t GUI_Text_NextUTF8(const char **text);
+/* Glyph of a code in a font, NULL if it has none */
+extern const aGLYPH* GUI_Text_Lookup(const aFONT *font, uint16_t code);
+/* Glyph of a code in the first font of the set that has it, else '?' of
+ * the first font; *font: index of the font in the set */
+extern const aGLYPH* GUI_Text_Resolve(const GUI_Text_Fonts_t *fonts, uint16_t code, uint8_t *font);
+
+/* Returns the advance; a code missing from the font is drawn as '?' */
+extern uint16_t GUI_Text_DrawChar(int16_t x, int16_t y, uint16_t code, const aFONT *font,
+        uint16_t color);
+/* '\n' starts a line below x. Returns the pen position after the text.
+ * Pairs are kerned; GUI_Layout.h places text in a box. */
+extern int16_t GUI_Text_DrawString(int16_t x, int16_t y, const char *text, const aFONT *font,
+        uint16_t color);
+/* The same with fallback fonts */
+extern int16_t GUI_Text_DrawUTF8(int16_t x, int16_t y, const char *text,
+        const GUI_Text_Fonts_t *fonts, uint16_t color);
+/* One resolved glyph, pen x on a baseline */
+extern void GUI_Text_DrawGlyph(int16_t x, int16_t baseline, const aFONT *font, const aGLYPH *g,
+        uint16_t color);
+/* Packed font: ASCII and GB2312 text, a missing code leaves its cell blank */
+extern int16_t GUI_Text_DrawStringPK(int16_t x, int16_t y, const char *text, const pFONT *font,
+        uint16_t color);
+/* Advance of the text (first line), kerned */
+extern uint16_t GUI_Text_Width(const char *text, const aFONT *font);
+/* Kerning of a pair, 0 if the font doesn't kern it (left 0: line start) */
+extern int8_t GUI_Text_Kerning(const aFONT *font, uint16_t left, uint16_t right);
+
+extern const GUI_Text_Stats_t* GUI_Text_GetStats(void);
+
+#endif /* GUI_TEXT_H_ */
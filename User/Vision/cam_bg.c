@@ -0,0 +1,319 @@
+/*
+ * cam_bg.c
+ * Running average background model with foreground mask on RGB565 frames
+ *
+ * Per pair of cells (one 4x2 pixel block, two words on each line):
+ *  1. downsample: VISION_Luma4() of both lines, UHADD8 averages them
+ *     vertically, UHADD8 with itself shifted by a byte horizontally; the two
+ *     cell values land in bytes 0 and 2, i.e. already in 16 bit lanes;
+ *  2. model: mean (luma Q7) and variance (luma^2 Q4) of the two cells are
+ *     packed in one word each. The mean difference is one SSUB16, the
+ *     mean += diff >> rate update is a biased word shift and an SADD16;
+ *     the squares and the variance update are per cell;
+ *  3. decision: diff^2 > k^2 * max(var, floor), two mask bits per pair.
+ *
+ * The model (76.8 KB at QVGA) lives in DTCM, it is read and written once
+ * per frame.
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "cam_bg.h"
+#include "vision_simd.h"
+#include "vision_luma.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define BG_PAIRS                      (CAM_BG_CELLS / 2U)
+#define BG_MAX_SHIFT                  (15U)
+
+#define BG_BARRIER()                  __asm volatile ("" ::: "memory")
+
+/******************************************************************************
+ *                            LOCAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint32_t mean;                /* two cells, luma Q7 */
+    uint32_t var;                 /* two cells, luma^2 Q4 */
+} BG_Pair_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    volatile uint8_t enabled;
+    volatile uint8_t front;       /* index of the published result */
+    uint8_t     rate_shift;
+    uint8_t     k2_q2;
+    uint16_t    relearn_pm;
+    uint8_t     learnt;           /* model holds a frame */
+    uint16_t    cells_x;
+    uint16_t    cells_y;
+    uint32_t    relearns;
+    CAM_BG_t    result[2];
+} BG;
+
+static BG_Pair_t BG_Model[BG_PAIRS] VISION_DTCM;
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static void BG_Update(const uint8_t *frame, CAM_BG_t *out);
+static inline uint32_t BG_Shift16(uint32_t d, uint32_t shift);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void CAM_BG_Init(void)
+{
+    VISION_LumaInit();
+    VISION_CyclesInit();
+    memset(BG.result, 0, sizeof(BG.result));
+    BG.front = 0U;
+    BG.learnt = 0U;
+    BG.relearns = 0U;
+    CAM_BG_Config(CAM_BG_DEF_RATE_SHIFT, CAM_BG_DEF_K2_Q2, CAM_BG_DEF_RELEARN_PM);
+}
+
+void CAM_BG_Config(uint8_t rate_shift, uint8_t k2_q2, uint16_t relearn_pm)
+{
+    BG.rate_shift = (rate_shift < 1U) ? 1U : ((rate_shift > 8U) ? 8U : rate_shift);
+    BG.k2_q2 = k2_q2;
+    BG.relearn_pm = relearn_pm;
+}
+
+void CAM_BG_Enable(uint8_t enable)
+{
+    if (enable && !BG.enabled)
+    {
+        BG.learnt = 0U;
+    }
+    BG.enabled = enable ? 1U : 0U;
+}
+
+uint8_t CAM_BG_isEnabled(void)
+{
+    return BG.enabled;
+}
+
+void CAM_BG_Reset(void)
+{
+    BG.learnt = 0U;
+}
+
+void CAM_BG_Process(const uint8_t *frame, uint16_t width, uint16_t height, uint32_t seq)
+{
+    uint32_t start = VISION_CYCLES();
+    uint16_t cells_x = width / CAM_BG_CELL;
+    uint16_t cells_y = height / CAM_BG_CELL;
+    CAM_BG_t *out;
+
+    if (!BG.enabled || (frame == NULL) ||
+            (width > CAM_BG_MAX_WIDTH) || (height > CAM_BG_MAX_HEIGHT) ||
+            (width % 4U) || (height % CAM_BG_CELL) || (width == 0U) || (height == 0U))
+    {
+        return;
+    }
+    if ((cells_x != BG.cells_x) || (cells_y != BG.cells_y))
+    {
+        BG.cells_x = cells_x;
+        BG.cells_y = cells_y;
+        BG.learnt = 0U;
+    }
+
+    out = &BG.result[BG.front ^ 1U];
+    out->seq = 0U;
+    BG_BARRIER();
+
+    out->cells_x = cells_x;
+    out->cells_y = cells_y;
+    out->learning = !BG.learnt;
+    BG_Update(frame, out);
+    BG.learnt = 1U;
+
+    out->coverage_pm = (uint16_t)((out->fg_cells * 1000U) / ((uint32_t)cells_x * cells_y));
+    if (BG.relearn_pm && (out->coverage_pm > BG.relearn_pm))
+    {
+        /* Lights switched, camera moved: start over on the next frame */
+        BG.learnt = 0U;
+        BG.relearns++;
+    }
+    out->relearns = BG.relearns;
+    out->cycles = VISION_CYCLES() - start;
+
+    BG_BARRIER();
+    out->seq = seq;
+    BG_BARRIER();
+    BG.front ^= 1U;
+}
+
+uint32_t CAM_BG_Get(CAM_BG_t *bg)
+{
+    uint8_t front;
+
+    /* Same protocol as CAM_Stats_Get() */
+    do
+    {
+        front = BG.front;
+        BG_BARRIER();
+        memcpy(bg, &BG.result[front], sizeof(CAM_BG_t));
+        BG_BARRIER();
+    } while ((*(volatile uint32_t*)&BG.result[front].seq) != bg->seq);
+
+    return bg->seq;
+}
+
+void CAM_BG_DrawMask(uint8_t *frame, uint16_t width, uint16_t height, uint16_t color)
+{
+    const CAM_BG_t *m = &BG.result[BG.front];
+    uint32_t words = ((uint32_t)m->cells_x * m->cells_y + 31U) / 32U;
+    /* Half of the color in both pixels of a word, half of the frame added below */
+    uint32_t half = ((uint32_t)(color & 0xF7DEU) >> 1) * 0x00010001U;
+
+    if ((m->seq == 0U) || (frame == NULL) ||
+            (width != m->cells_x * CAM_BG_CELL) || (height != m->cells_y * CAM_BG_CELL))
+    {
+        return;
+    }
+    for (uint32_t i = 0U; i < words; i++)
+    {
+        uint32_t bits = m->mask[i];
+
+        while (bits)
+        {
+            uint32_t cell = i * 32U + (uint32_t)__builtin_ctz(bits);
+            uint32_t cx = cell % m->cells_x;
+            uint32_t cy = cell / m->cells_x;
+            /* One cell is one word on two lines */
+            uint32_t *p = (uint32_t*)(frame + ((cy * CAM_BG_CELL * width) + cx * CAM_BG_CELL) * 2U);
+
+            p[0] = ((p[0] & 0xF7DEF7DEU) >> 1) + half;
+            p[width / 2U] = ((p[width / 2U] & 0xF7DEF7DEU) >> 1) + half;
+            bits &= bits - 1U;
+        }
+    }
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+/* Downsample, test and learn in one pass */
+static void BG_Update(const uint8_t *frame, CAM_BG_t *out)
+{
+    uint32_t pairs_x = BG.cells_x / 2U;
+    uint32_t line_words = BG.cells_x;     /* 2 pixels per word, 2 pixels per cell */
+    uint32_t s_bg = BG.rate_shift;
+    uint32_t s_fg = (s_bg + CAM_BG_FG_HOLD > BG_MAX_SHIFT) ? BG_MAX_SHIFT : (s_bg + CAM_BG_FG_HOLD);
+    uint32_t k2 = BG.k2_q2;
+    uint32_t x0 = 0xFFFFU, y0 = 0xFFFFU, x1 = 0U, y1 = 0U;
+    uint32_t fg_cells = 0U;
+    uint32_t bits = 0U;
+    uint32_t nbits = 0U;
+    uint32_t *mask = out->mask;
+    BG_Pair_t *m = BG_Model;
+
+    for (uint32_t cy = 0U; cy < BG.cells_y; cy++)
+    {
+        const uint32_t *r0 = (const uint32_t*)(frame + cy * CAM_BG_CELL * line_words * 4U);
+        const uint32_t *r1 = r0 + line_words;
+
+        for (uint32_t px = 0U; px < pairs_x; px++, m++, r0 += 2, r1 += 2)
+        {
+            uint32_t v = VISION_UHADD8(VISION_Luma4(r0[0], r0[1]), VISION_Luma4(r1[0], r1[1]));
+            uint32_t cur, d, sel, fg0, fg1, sq0, sq1, v0, v1;
+            int32_t d0, d1;
+
+            v = VISION_UHADD8(v, v >> 8);
+            cur = (v & 0x00FF00FFU) << 7;
+
+            if (!BG.learnt)
+            {
+                m->mean = cur;
+                m->var = CAM_BG_VAR_INIT_Q4 * 0x00010001U;
+                fg0 = fg1 = 0U;
+            }
+            else
+            {
+                d = VISION_SSUB16(cur, m->mean);
+                d0 = (int16_t)d;
+                d1 = (int16_t)(d >> 16);
+                sq0 = (uint32_t)(d0 * d0) >> 10;
+                sq1 = (uint32_t)(d1 * d1) >> 10;
+                sq0 = (sq0 > 0xFFFFU) ? 0xFFFFU : sq0;
+                sq1 = (sq1 > 0xFFFFU) ? 0xFFFFU : sq1;
+                v0 = m->var & 0xFFFFU;
+                v1 = m->var >> 16;
+
+                fg0 = ((sq0 * 4U) > (k2 * ((v0 > CAM_BG_VAR_MIN_Q4) ? v0 : CAM_BG_VAR_MIN_Q4))) ? 1U : 0U;
+                fg1 = ((sq1 * 4U) > (k2 * ((v1 > CAM_BG_VAR_MIN_Q4) ? v1 : CAM_BG_VAR_MIN_Q4))) ? 1U : 0U;
+
+                /* Mean: both rates computed, lanes picked by the decision */
+                sel = (fg0 ? 0x0000FFFFU : 0U) | (fg1 ? 0xFFFF0000U : 0U);
+                m->mean = VISION_SADD16(m->mean,
+                        (BG_Shift16(d, s_bg) & ~sel) | (BG_Shift16(d, s_fg) & sel));
+
+                v0 = (uint32_t)((int32_t)v0 + (((int32_t)sq0 - (int32_t)v0) >> (fg0 ? s_fg : s_bg)));
+                v1 = (uint32_t)((int32_t)v1 + (((int32_t)sq1 - (int32_t)v1) >> (fg1 ? s_fg : s_bg)));
+                m->var = VISION_PACK16(v0, v1);
+            }
+
+            if (fg0 | fg1)
+            {
+                uint32_t cx = px * 2U + (fg0 ? 0U : 1U);
+
+                fg_cells += fg0 + fg1;
+                x0 = (cx < x0) ? cx : x0;
+                x1 = (px * 2U + fg1 > x1) ? (px * 2U + fg1) : x1;
+                y0 = (cy < y0) ? cy : y0;
+                y1 = cy;
+            }
+            /* Cell pairs never straddle a mask word */
+            bits |= (fg0 | (fg1 << 1)) << nbits;
+            nbits += 2U;
+            if (nbits == 32U)
+            {
+                *mask++ = bits;
+                bits = 0U;
+                nbits = 0U;
+            }
+        }
+    }
+    if (nbits)
+    {
+        *mask = bits;
+    }
+
+    out->fg_cells = fg_cells;
+    if (fg_cells)
+    {
+        out->x = (uint16_t)(x0 * CAM_BG_CELL);
+        out->y = (uint16_t)(y0 * CAM_BG_CELL);
+        out->w = (uint16_t)((x1 - x0 + 1U) * CAM_BG_CELL);
+        out->h = (uint16_t)((y1 - y0 + 1U) * CAM_BG_CELL);
+    }
+    else
+    {
+        out->x = out->y = out->w = out->h = 0U;
+    }
+}
+
+/* Arithmetic shift of both signed 16 bit lanes: bias to unsigned, shift the
+ * word, cut what came over from the upper lane, remove the bias */
+static inline uint32_t BG_Shift16(uint32_t d, uint32_t shift)
+{
+    uint32_t u = ((d ^ 0x80008000U) >> shift) & ((0xFFFFU >> shift) * 0x00010001U);
+
+    return VISION_SSUB16(u, (0x8000U >> shift) * 0x00010001U);
+}
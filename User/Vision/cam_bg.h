@@ -0,0 +1,98 @@
+/*
+ * cam_bg.h
+ * Running average background model with foreground mask on RGB565 frames
+ *
+ * The frame is reduced to a luma grid (one cell per 2x2 pixels). Every cell
+ * keeps an exponential running average of its luma and of its squared
+ * deviation; a cell is foreground when its deviation from the average is
+ * above k standard deviations. The model follows slow lighting changes
+ * through the learning rate and learns the scene again when a sudden change
+ * turns most of the frame into foreground.
+ *
+ * The result is a 1 bpp mask (bit per cell, row major) with its coverage,
+ * double buffered and tagged with the frame sequence number.
+ */
+
+#ifndef CAM_BG_H_
+#define CAM_BG_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Pixels per grid cell side (fixed: two cells per word) */
+#define CAM_BG_CELL                              (2U)
+/* Largest frame handled */
+#define CAM_BG_MAX_WIDTH                         (320U)
+#define CAM_BG_MAX_HEIGHT                        (240U)
+
+/* Defaults for CAM_BG_Config() */
+#define CAM_BG_DEF_RATE_SHIFT                    (5U)     /* learning rate 1/32 */
+#define CAM_BG_DEF_K2_Q2                         (36U)    /* k = 3 sigma, k^2 in Q2 */
+#define CAM_BG_DEF_RELEARN_PM                    (800U)   /* coverage that means "lights changed" */
+
+/* Foreground cells learn 2^CAM_BG_FG_HOLD slower, so a stopped object is
+ * absorbed eventually */
+#define CAM_BG_FG_HOLD                           (3U)
+/* Variance floor and start value, luma^2 in Q4 (sigma 3 and 8) */
+#define CAM_BG_VAR_MIN_Q4                        (9U * 16U)
+#define CAM_BG_VAR_INIT_Q4                       (64U * 16U)
+
+#define CAM_BG_CELLS_X                           (CAM_BG_MAX_WIDTH / CAM_BG_CELL)
+#define CAM_BG_CELLS_Y                           (CAM_BG_MAX_HEIGHT / CAM_BG_CELL)
+#define CAM_BG_CELLS                             (CAM_BG_CELLS_X * CAM_BG_CELLS_Y)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint32_t seq;                 /* frame sequence number, 0 = nothing yet */
+    uint32_t cycles;              /* CPU cycles spent on this frame */
+    uint16_t cells_x;             /* mask geometry for this frame */
+    uint16_t cells_y;
+    uint32_t fg_cells;
+    uint16_t coverage_pm;         /* foreground cells, per mille */
+    uint8_t  learning;            /* model (re)started on this frame, mask empty */
+    uint32_t relearns;            /* sudden changes since the init */
+    uint16_t x;                   /* foreground bounding box, frame pixels */
+    uint16_t y;
+    uint16_t w;                   /* 0 = no foreground */
+    uint16_t h;
+    uint32_t mask[(CAM_BG_CELLS + 31U) / 32U];
+} CAM_BG_t;
+
+#define CAM_BG_IS_SET(m, cx, cy)                 \
+    (((m)->mask[((cy) * (m)->cells_x + (cx)) >> 5] >> (((cy) * (m)->cells_x + (cx)) & 31U)) & 1U)
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+extern void CAM_BG_Init(void);
+/* Learning rate 1/2^rate_shift (1..8); foreground when diff^2 > k2_q2 / 4 * var;
+ * relearn_pm 0 never relearns */
+extern void CAM_BG_Config(uint8_t rate_shift, uint8_t k2_q2, uint16_t relearn_pm);
+extern void CAM_BG_Enable(uint8_t enable);
+extern uint8_t CAM_BG_isEnabled(void);
+/* Drop the model, the next frame is learnt again */
+extern void CAM_BG_Reset(void);
+
+/* Call from the frame ready callback; width multiple of 4, height even */
+extern void CAM_BG_Process(const uint8_t *frame, uint16_t width, uint16_t height, uint32_t seq);
+
+/* Copy of the last published result, returns its sequence number (0 = none) */
+extern uint32_t CAM_BG_Get(CAM_BG_t *bg);
+
+/* Blend the last mask at 50 % over an RGB565 frame of the same geometry;
+ * same context as CAM_BG_Process() */
+extern void CAM_BG_DrawMask(uint8_t *frame, uint16_t width, uint16_t height, uint16_t color);
+
+#endif /* CAM_BG_H_ */
@@ -0,0 +1,563 @@
+/*
+ * cam_blob.c
+ * Connected component labeling and blob tracking on thresholded frames
+ *
+ * Per frame:
+ *  1. threshold: four mask pixels at a time, their luma bytes packed in a
+ *     word; UQSUB8 against the low and high limits is zero in the bytes
+ *     inside the range, UQSUB8 from 0x01010101 turns that into 0/1 flags;
+ *  2. runs: the flag words are scanned for 0/1 edges (words without an edge
+ *     are skipped whole) and every run is linked to the overlapping runs of
+ *     the previous line with a union-find (path halving, the lower run index
+ *     becomes the root, so a component's root is its first run);
+ *  3. components: one pass over the runs in order accumulates area, bounding
+ *     box and coordinate sums on the root's slot;
+ *  4. tracking: blobs are matched to tracks greedily, closest centroids
+ *     first, inside CAM_BLOB_TRACK_GATE.
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "cam_blob.h"
+#include "vision_simd.h"
+#include "vision_luma.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define BLOB_FLAG_WORDS               ((CAM_BLOB_MAX_WIDTH + 3U) / 4U)
+#define BLOB_NO_SLOT                  (0xFFFFU)
+#define BLOB_NONE                     (0xFFU)
+
+#define BLOB_BARRIER()                __asm volatile ("" ::: "memory")
+
+/******************************************************************************
+ *                            LOCAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint16_t x0;                  /* mask pixels, x1 excluded */
+    uint16_t x1;
+    uint16_t y;
+    uint16_t parent;              /* union-find */
+} Blob_Run_t;
+
+typedef struct
+{
+    uint32_t area;                /* mask pixels */
+    uint32_t sum_x2;              /* sum of 2 * x */
+    uint32_t sum_y;
+    uint16_t x0;
+    uint16_t x1;                  /* excluded */
+    uint16_t y0;
+    uint16_t y1;                  /* included */
+} Blob_Component_t;
+
+typedef struct
+{
+    uint16_t id;                  /* 0 = free */
+    uint16_t age;
+    uint16_t missed;
+    uint16_t cx_q4;
+    uint16_t cy_q4;
+} Blob_Track_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    volatile uint8_t enabled;
+    volatile uint8_t front;       /* index of the published result */
+    uint8_t     low;
+    uint8_t     high;
+    uint8_t     decimation;
+    uint32_t    min_area;
+    uint16_t    mask_w;
+    uint16_t    mask_h;
+    uint16_t    next_id;
+    uint16_t    nruns;
+    uint8_t     overflow;
+    uint32_t    flags[BLOB_FLAG_WORDS];
+    Blob_Run_t  run[CAM_BLOB_MAX_RUNS];
+    uint16_t    slot[CAM_BLOB_MAX_RUNS];
+    Blob_Component_t comp[CAM_BLOB_MAX_COMPONENTS];
+    Blob_Track_t track[CAM_BLOB_MAX_TRACKS];
+    CAM_Blob_t  result[2];
+} Blob;
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static void Blob_Threshold(const uint8_t *line, CAM_BlobFormat_t format);
+static void Blob_Runs(uint32_t y);
+static void Blob_Link(uint32_t prev, uint32_t cur, uint32_t end);
+static uint32_t Blob_Find(uint32_t i);
+static uint32_t Blob_Components(CAM_Blob_t *out);
+static void Blob_Publish(CAM_Blob_t *out, uint32_t ncomp);
+static void Blob_Tracking(CAM_Blob_t *out);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void CAM_Blob_Init(void)
+{
+    VISION_LumaInit();
+    VISION_CyclesInit();
+    memset(Blob.result, 0, sizeof(Blob.result));
+    Blob.front = 0U;
+    CAM_Blob_Config(CAM_BLOB_DEF_LOW, CAM_BLOB_DEF_HIGH, CAM_BLOB_DEF_DECIMATION,
+            CAM_BLOB_DEF_MIN_AREA);
+    CAM_Blob_Reset();
+}
+
+void CAM_Blob_Config(uint8_t low, uint8_t high, uint8_t decimation, uint32_t min_area)
+{
+    Blob.low = low;
+    Blob.high = high;
+    Blob.decimation = ((decimation == 2U) || (decimation == 4U)) ? decimation : 1U;
+    Blob.min_area = min_area;
+}
+
+void CAM_Blob_Enable(uint8_t enable)
+{
+    if (enable && !Blob.enabled)
+    {
+        CAM_Blob_Reset();
+    }
+    Blob.enabled = enable ? 1U : 0U;
+}
+
+uint8_t CAM_Blob_isEnabled(void)
+{
+    return Blob.enabled;
+}
+
+void CAM_Blob_Reset(void)
+{
+    memset(Blob.track, 0, sizeof(Blob.track));
+    Blob.next_id = 1U;
+}
+
+void CAM_Blob_Process(const uint8_t *frame, CAM_BlobFormat_t format, uint32_t stride,
+        uint16_t width, uint16_t height, uint32_t seq)
+{
+    uint32_t start = VISION_CYCLES();
+    uint32_t d = Blob.decimation;
+    uint16_t mask_w = width / d;
+    uint16_t mask_h = height / d;
+    uint32_t prev = 0U;
+    uint32_t ncomp;
+    CAM_Blob_t *out;
+
+    if (!Blob.enabled || (frame == NULL) || (mask_w == 0U) || (mask_h == 0U) ||
+            (mask_w > CAM_BLOB_MAX_WIDTH) || (mask_h > CAM_BLOB_MAX_HEIGHT))
+    {
+        return;
+    }
+    if ((mask_w != Blob.mask_w) || (mask_h != Blob.mask_h))
+    {
+        Blob.mask_w = mask_w;
+        Blob.mask_h = mask_h;
+        CAM_Blob_Reset();
+    }
+
+    out = &Blob.result[Blob.front ^ 1U];
+    out->seq = 0U;
+    BLOB_BARRIER();
+
+    Blob.nruns = 0U;
+    Blob.overflow = 0U;
+    for (uint32_t y = 0U; (y < mask_h) && !Blob.overflow; y++)
+    {
+        uint32_t cur = Blob.nruns;
+
+        Blob_Threshold(frame + y * d * stride, format);
+        Blob_Runs(y);
+        /* Runs of line y - 1 are [prev, cur) */
+        if ((prev < cur) && (Blob.run[prev].y + 1U == y))
+        {
+            Blob_Link(prev, cur, Blob.nruns);
+        }
+        prev = cur;
+    }
+
+    ncomp = Blob_Components(out);
+    out->mask_w = mask_w;
+    out->mask_h = mask_h;
+    out->decimation = (uint8_t)d;
+    out->runs = Blob.nruns;
+    Blob_Publish(out, ncomp);
+    Blob_Tracking(out);
+    out->overflow = Blob.overflow;
+    out->cycles = VISION_CYCLES() - start;
+
+    BLOB_BARRIER();
+    out->seq = seq;
+    BLOB_BARRIER();
+    Blob.front ^= 1U;
+}
+
+uint32_t CAM_Blob_Get(CAM_Blob_t *blob)
+{
+    uint8_t front;
+
+    /* Same protocol as CAM_Stats_Get() */
+    do
+    {
+        front = Blob.front;
+        BLOB_BARRIER();
+        memcpy(blob, &Blob.result[front], sizeof(CAM_Blob_t));
+        BLOB_BARRIER();
+    } while ((*(volatile uint32_t*)&Blob.result[front].seq) != blob->seq);
+
+    return blob->seq;
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+/* One mask line -> flags[]: one byte per pixel, 1 = foreground */
+static void Blob_Threshold(const uint8_t *line, CAM_BlobFormat_t format)
+{
+    uint32_t d = Blob.decimation;
+    uint32_t w = Blob.mask_w;
+    uint32_t low = Blob.low * 0x01010101U;
+    uint32_t high = Blob.high * 0x01010101U;
+    uint32_t x = 0U;
+    uint32_t i = 0U;
+
+    for (; (x + 4U) <= w; x += 4U, i++)
+    {
+        uint32_t y4;
+
+        if (format == CAM_BLOB_FMT_Y8)
+        {
+            y4 = (d == 1U) ? VISION_LOAD32(&line[x]) :
+                    (line[x * d] | ((uint32_t)line[(x + 1U) * d] << 8) |
+                    ((uint32_t)line[(x + 2U) * d] << 16) | ((uint32_t)line[(x + 3U) * d] << 24));
+        }
+        else if (d == 1U)
+        {
+            y4 = VISION_Luma4(VISION_LOAD32(&line[x * 2U]), VISION_LOAD32(&line[x * 2U + 4U]));
+        }
+        else
+        {
+            const uint16_t *px = (const uint16_t*)line;
+            y4 = VISION_LUMA(px[x * d]) | (VISION_LUMA(px[(x + 1U) * d]) << 8) |
+                    (VISION_LUMA(px[(x + 2U) * d]) << 16) | (VISION_LUMA(px[(x + 3U) * d]) << 24);
+        }
+        Blob.flags[i] = VISION_UQSUB8(0x01010101U, VISION_UQSUB8(low, y4) | VISION_UQSUB8(y4, high));
+    }
+
+    /* Last partial word, the missing pixels are background */
+    if (x < w)
+    {
+        uint32_t y4 = 0U;
+        uint32_t valid = 0U;
+
+        for (uint32_t k = 0U; (x + k) < w; k++)
+        {
+            uint32_t v = (format == CAM_BLOB_FMT_Y8) ? line[(x + k) * d] :
+                    VISION_LUMA(((const uint16_t*)line)[(x + k) * d]);
+            y4 |= v << (k * 8U);
+            valid |= 0x01U << (k * 8U);
+        }
+        Blob.flags[i] = valid &
+                VISION_UQSUB8(0x01010101U, VISION_UQSUB8(low, y4) | VISION_UQSUB8(y4, high));
+    }
+}
+
+/* flags[] -> runs of line y */
+static void Blob_Runs(uint32_t y)
+{
+    uint32_t words = (Blob.mask_w + 3U) / 4U;
+    uint32_t inside = 0U;
+    uint32_t x0 = 0U;
+
+    for (uint32_t i = 0U; i < words; i++)
+    {
+        uint32_t f = Blob.flags[i];
+
+        /* No edge in this word */
+        if (f == (inside ? 0x01010101U : 0U))
+        {
+            continue;
+        }
+        for (uint32_t k = 0U; k < 4U; k++)
+        {
+            uint32_t bit = (f >> (k * 8U)) & 1U;
+
+            if (bit == inside)
+            {
+                continue;
+            }
+            inside = bit;
+            if (bit)
+            {
+                x0 = i * 4U + k;
+                continue;
+            }
+            if (Blob.nruns == CAM_BLOB_MAX_RUNS)
+            {
+                Blob.overflow = 1U;
+                return;
+            }
+            Blob.run[Blob.nruns].x0 = (uint16_t)x0;
+            Blob.run[Blob.nruns].x1 = (uint16_t)(i * 4U + k);
+            Blob.run[Blob.nruns].y = (uint16_t)y;
+            Blob.run[Blob.nruns].parent = Blob.nruns;
+            Blob.nruns++;
+        }
+    }
+    if (inside)
+    {
+        if (Blob.nruns == CAM_BLOB_MAX_RUNS)
+        {
+            Blob.overflow = 1U;
+            return;
+        }
+        Blob.run[Blob.nruns].x0 = (uint16_t)x0;
+        Blob.run[Blob.nruns].x1 = Blob.mask_w;
+        Blob.run[Blob.nruns].y = (uint16_t)y;
+        Blob.run[Blob.nruns].parent = Blob.nruns;
+        Blob.nruns++;
+    }
+}
+
+/* Union the runs [cur, end) with the 8-connected runs of [prev, cur) */
+static void Blob_Link(uint32_t prev, uint32_t cur, uint32_t end)
+{
+    uint32_t p = prev;
+
+    for (uint32_t c = cur; c < end; c++)
+    {
+        const Blob_Run_t *r = &Blob.run[c];
+
+        /* Previous line runs ending left of this one can't touch the next ones */
+        while ((p < cur) && (Blob.run[p].x1 < r->x0))
+        {
+            p++;
+        }
+        for (uint32_t q = p; (q < cur) && (Blob.run[q].x0 <= r->x1); q++)
+        {
+            uint32_t a = Blob_Find(q);
+            uint32_t b = Blob_Find(c);
+
+            if (a < b)
+            {
+                Blob.run[b].parent = (uint16_t)a;
+            }
+            else if (b < a)
+            {
+                Blob.run[a].parent = (uint16_t)b;
+            }
+        }
+    }
+}
+
+static uint32_t Blob_Find(uint32_t i)
+{
+    while (Blob.run[i].parent != i)
+    {
+        Blob.run[i].parent = Blob.run[Blob.run[i].parent].parent;
+        i = Blob.run[i].parent;
+    }
+    return i;
+}
+
+/* Roots come first in their component: one pass in run order */
+static uint32_t Blob_Components(CAM_Blob_t *out)
+{
+    uint32_t ncomp = 0U;
+    uint32_t total = 0U;
+
+    for (uint32_t i = 0U; i < Blob.nruns; i++)
+    {
+        const Blob_Run_t *r = &Blob.run[i];
+        uint32_t root = Blob_Find(i);
+        uint32_t len = r->x1 - r->x0;
+        Blob_Component_t *c;
+
+        if (root == i)
+        {
+            total++;
+            if (ncomp == CAM_BLOB_MAX_COMPONENTS)
+            {
+                Blob.slot[i] = BLOB_NO_SLOT;
+                Blob.overflow = 1U;
+                continue;
+            }
+            Blob.slot[i] = (uint16_t)ncomp;
+            c = &Blob.comp[ncomp++];
+            c->area = 0U;
+            c->sum_x2 = 0U;
+            c->sum_y = 0U;
+            c->x0 = r->x0;
+            c->x1 = r->x1;
+            c->y0 = r->y;
+            c->y1 = r->y;
+        }
+        if (Blob.slot[root] == BLOB_NO_SLOT)
+        {
+            continue;
+        }
+        c = &Blob.comp[Blob.slot[root]];
+        c->area += len;
+        c->sum_x2 += len * (r->x0 + r->x1 - 1U);
+        c->sum_y += len * r->y;
+        c->x0 = (r->x0 < c->x0) ? r->x0 : c->x0;
+        c->x1 = (r->x1 > c->x1) ? r->x1 : c->x1;
+        c->y1 = r->y;
+    }
+    out->components = (uint16_t)total;
+    return ncomp;
+}
+
+/* Area filter, keep the CAM_BLOB_MAX_BLOBS largest, largest first */
+static void Blob_Publish(CAM_Blob_t *out, uint32_t ncomp)
+{
+    uint32_t d = Blob.decimation;
+
+    out->nblobs = 0U;
+    for (uint32_t i = 0U; i < ncomp; i++)
+    {
+        const Blob_Component_t *c = &Blob.comp[i];
+        uint32_t area = c->area * d * d;
+        uint32_t pos = out->nblobs;
+        CAM_BlobBox_t *b;
+
+        if (area < Blob.min_area)
+        {
+            continue;
+        }
+        while ((pos > 0U) && (out->blob[pos - 1U].area < area))
+        {
+            pos--;
+        }
+        if (pos == CAM_BLOB_MAX_BLOBS)
+        {
+            continue;
+        }
+        if (out->nblobs < CAM_BLOB_MAX_BLOBS)
+        {
+            out->nblobs++;
+        }
+        memmove(&out->blob[pos + 1U], &out->blob[pos],
+                (out->nblobs - 1U - pos) * sizeof(CAM_BlobBox_t));
+
+        b = &out->blob[pos];
+        b->id = 0U;
+        b->age = 0U;
+        b->x = (uint16_t)(c->x0 * d);
+        b->y = (uint16_t)(c->y0 * d);
+        b->w = (uint16_t)((c->x1 - c->x0) * d);
+        b->h = (uint16_t)((c->y1 - c->y0 + 1U) * d);
+        /* Mask pixel x sits on frame pixel x * d */
+        b->cx_q4 = (uint16_t)(((uint64_t)c->sum_x2 * d * 8U + c->area / 2U) / c->area);
+        b->cy_q4 = (uint16_t)(((uint64_t)c->sum_y * d * 16U + c->area / 2U) / c->area);
+        b->area = area;
+    }
+}
+
+/* Greedy nearest centroid matching against the live tracks */
+static void Blob_Tracking(CAM_Blob_t *out)
+{
+    uint8_t track_of[CAM_BLOB_MAX_BLOBS];
+    uint8_t taken[CAM_BLOB_MAX_TRACKS] = {0};
+
+    memset(track_of, BLOB_NONE, sizeof(track_of));
+    for (;;)
+    {
+        uint32_t best = CAM_BLOB_TRACK_GATE * 16U + 1U;
+        uint32_t bb = BLOB_NONE;
+        uint32_t bt = BLOB_NONE;
+
+        for (uint32_t b = 0U; b < out->nblobs; b++)
+        {
+            if (track_of[b] != BLOB_NONE)
+            {
+                continue;
+            }
+            for (uint32_t t = 0U; t < CAM_BLOB_MAX_TRACKS; t++)
+            {
+                const Blob_Track_t *tr = &Blob.track[t];
+                int32_t dx = (int32_t)out->blob[b].cx_q4 - tr->cx_q4;
+                int32_t dy = (int32_t)out->blob[b].cy_q4 - tr->cy_q4;
+                uint32_t dist = (uint32_t)(((dx < 0) ? -dx : dx) + ((dy < 0) ? -dy : dy));
+
+                if ((tr->id != 0U) && !taken[t] && (dist < best))
+                {
+                    best = dist;
+                    bb = b;
+                    bt = t;
+                }
+            }
+        }
+        if (bb == BLOB_NONE)
+        {
+            break;
+        }
+        track_of[bb] = (uint8_t)bt;
+        taken[bt] = 1U;
+    }
+
+    /* Tracks without a blob age out */
+    for (uint32_t t = 0U; t < CAM_BLOB_MAX_TRACKS; t++)
+    {
+        if ((Blob.track[t].id != 0U) && !taken[t] && (++Blob.track[t].missed > CAM_BLOB_TRACK_LOST))
+        {
+            Blob.track[t].id = 0U;
+        }
+    }
+
+    for (uint32_t b = 0U; b < out->nblobs; b++)
+    {
+        CAM_BlobBox_t *box = &out->blob[b];
+        Blob_Track_t *tr;
+
+        if (track_of[b] == BLOB_NONE)
+        {
+            /* New blob: first free track, none left = untracked (ID 0) */
+            uint32_t t = 0U;
+
+            while ((t < CAM_BLOB_MAX_TRACKS) && (Blob.track[t].id != 0U))
+            {
+                t++;
+            }
+            if (t == CAM_BLOB_MAX_TRACKS)
+            {
+                continue;
+            }
+            tr = &Blob.track[t];
+            tr->id = Blob.next_id++;
+            tr->age = 0U;
+            if (Blob.next_id == 0U)
+            {
+                Blob.next_id = 1U;
+            }
+        }
+        else
+        {
+            tr = &Blob.track[track_of[b]];
+        }
+        if (tr->age < 0xFFFFU)
+        {
+            tr->age++;
+        }
+        tr->missed = 0U;
+        tr->cx_q4 = box->cx_q4;
+        tr->cy_q4 = box->cy_q4;
+        box->id = tr->id;
+        box->age = tr->age;
+    }
+}
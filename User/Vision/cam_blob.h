@@ -0,0 +1,107 @@
+/*
+ * cam_blob.h
+ * Connected component labeling and blob tracking on thresholded frames
+ *
+ * A luma or RGB565 frame (optionally point decimated by 2 or 4) is
+ * thresholded line by line into a run length encoded mask. Runs touching
+ * runs of the previous line (8-connected) are merged with a union-find, so
+ * one pass over the runs gives every component's area, bounding box and
+ * centroid. Blobs are matched to the tracks of the previous frames by
+ * nearest centroid and keep their ID while they stay in view.
+ *
+ * All the working memory is static (CAM_BLOB_MAX_RUNS runs, about 46 KB with
+ * the defaults, in RAM_D1): a frame with more runs or components than the
+ * budget is labelled up to the limit and flagged in the result.
+ */
+
+#ifndef CAM_BLOB_H_
+#define CAM_BLOB_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Largest mask (after decimation) */
+#define CAM_BLOB_MAX_WIDTH                       (320U)
+#define CAM_BLOB_MAX_HEIGHT                      (240U)
+/* Working memory budget */
+#define CAM_BLOB_MAX_RUNS                        (4096U)
+#define CAM_BLOB_MAX_COMPONENTS                  (256U)
+/* Reported blobs (the largest ones) and tracks */
+#define CAM_BLOB_MAX_BLOBS                       (16U)
+#define CAM_BLOB_MAX_TRACKS                      (16U)
+
+/* Defaults for CAM_Blob_Config() */
+#define CAM_BLOB_DEF_LOW                         (160U)   /* luma range of the foreground */
+#define CAM_BLOB_DEF_HIGH                        (255U)
+#define CAM_BLOB_DEF_DECIMATION                  (2U)
+#define CAM_BLOB_DEF_MIN_AREA                    (16U)    /* frame pixels */
+
+/* Largest centroid move (frame pixels, |dx| + |dy|) between two frames */
+#define CAM_BLOB_TRACK_GATE                      (48U)
+/* A track is dropped after this many frames without a blob */
+#define CAM_BLOB_TRACK_LOST                      (5U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef enum
+{
+    CAM_BLOB_FMT_Y8 = 0,          /* one luma byte per pixel */
+    CAM_BLOB_FMT_RGB565,          /* native 16 bit words */
+} CAM_BlobFormat_t;
+
+typedef struct
+{
+    uint16_t id;                  /* stable across frames, 0 = no free track */
+    uint16_t age;                 /* frames since the track started */
+    uint16_t x;                   /* bounding box, frame pixels */
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    uint16_t cx_q4;               /* centroid, 1/16 frame pixel */
+    uint16_t cy_q4;
+    uint32_t area;                /* frame pixels */
+} CAM_BlobBox_t;
+
+typedef struct
+{
+    uint32_t seq;                 /* frame sequence number, 0 = nothing yet */
+    uint32_t cycles;              /* CPU cycles spent on this frame */
+    uint16_t mask_w;              /* mask geometry for this frame */
+    uint16_t mask_h;
+    uint8_t  decimation;
+    uint8_t  overflow;            /* run or component budget exceeded */
+    uint16_t runs;
+    uint16_t components;          /* before the area filter */
+    uint8_t  nblobs;              /* largest first */
+    CAM_BlobBox_t blob[CAM_BLOB_MAX_BLOBS];
+} CAM_Blob_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+extern void CAM_Blob_Init(void);
+/* Foreground is low <= luma <= high; decimation 1, 2 or 4 */
+extern void CAM_Blob_Config(uint8_t low, uint8_t high, uint8_t decimation, uint32_t min_area);
+extern void CAM_Blob_Enable(uint8_t enable);
+extern uint8_t CAM_Blob_isEnabled(void);
+/* Forget the tracks, IDs start over */
+extern void CAM_Blob_Reset(void);
+
+/* Call from the frame ready callback; stride in bytes */
+extern void CAM_Blob_Process(const uint8_t *frame, CAM_BlobFormat_t format, uint32_t stride,
+        uint16_t width, uint16_t height, uint32_t seq);
+
+/* Copy of the last published result, returns its sequence number (0 = none) */
+extern uint32_t CAM_Blob_Get(CAM_Blob_t *blob);
+
+#endif /* CAM_BLOB_H_ */
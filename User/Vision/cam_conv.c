@@ -0,0 +1,537 @@
+/*
+ * cam_conv.c
+ * 3x3 / 5x5 convolution of camera frames in fixed point
+ *
+ * Rows are streamed through small rolling buffers, the frame is read once:
+ *  - every source row is expanded to 16 bit per channel into a padded line
+ *    (edge pixels replicated), so any tap pair is one (unaligned) word load;
+ *  - separable: the horizontal pass runs once per source row into a ring of
+ *    'size' intermediate lines, the vertical pass combines the ring two lines
+ *    at a time: PKHBT/PKHTB interleave the lines, so two adjacent output
+ *    pixels take one SMLAD each per tap pair;
+ *  - general: a ring of 'size' padded source lines, SMLAD per tap pair.
+ * Rows above/below the frame are the first/last row, which are always still
+ * in the ring.
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stddef.h>
+#include "cam_conv.h"
+#include "vision_simd.h"
+#include "vision_luma.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define CONV_PAD                      (CAM_CONV_MAX_SIZE / 2U)
+#define CONV_LINE                     (CAM_CONV_MAX_WIDTH + 2U * CONV_PAD)
+#define CONV_PLANES                   (3U)
+
+/* Keep some headroom below 2^31 for the rounding term */
+#define CONV_ACC_LIMIT                (1L << 30)
+
+#define CONV_INLINE                   static inline __attribute__((always_inline))
+
+/******************************************************************************
+ *                           LOCAL DATA TYPES                                 *
+ ******************************************************************************/
+
+/* Per call constants of the output stage */
+typedef struct
+{
+    int32_t  shift;               /* total fraction bits of the accumulator */
+    int32_t  offset;
+    uint8_t  absolute;
+} Conv_Post_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+/* Rolling buffers, ~20 KB */
+static struct
+{
+    int16_t in[CONV_PLANES][CAM_CONV_MAX_SIZE][CONV_LINE];            /* padded source rows */
+    int16_t mid[CONV_PLANES][CAM_CONV_MAX_SIZE][CAM_CONV_MAX_WIDTH];  /* horizontal pass */
+    uint8_t out[CONV_PLANES][CAM_CONV_MAX_WIDTH];                     /* one output row */
+} Conv VISION_DTCM;
+
+static uint32_t ConvCycles;
+
+/******************************************************************************
+ *                           PREDEFINED KERNELS                               *
+ ******************************************************************************/
+
+const CAM_ConvKernel_t CAM_ConvBox3 =
+{
+    .size = 3U, .separable = 1U, .shift = 15U,
+    .h = { 10923, 10923, 10923 },
+    .v = { 10923, 10923, 10923 },
+};
+
+const CAM_ConvKernel_t CAM_ConvGauss3 =
+{
+    .size = 3U, .separable = 1U, .shift = 15U,
+    .h = { 8192, 16384, 8192 },
+    .v = { 8192, 16384, 8192 },
+};
+
+const CAM_ConvKernel_t CAM_ConvGauss5 =
+{
+    .size = 5U, .separable = 1U, .shift = 15U,
+    .h = { 2048, 8192, 12288, 8192, 2048 },
+    .v = { 2048, 8192, 12288, 8192, 2048 },
+};
+
+/* 5 at the centre: Q3.12 */
+const CAM_ConvKernel_t CAM_ConvSharpen3 =
+{
+    .size = 3U, .separable = 0U, .shift = 12U,
+    .k = {     0, -4096,     0,
+           -4096, 20480, -4096,
+               0, -4096,     0 },
+};
+
+const CAM_ConvKernel_t CAM_ConvLaplace3 =
+{
+    .size = 3U, .separable = 0U, .shift = 12U, .absolute = 1U,
+    .k = {    0,   4096,    0,
+           4096, -16384, 4096,
+              0,   4096,    0 },
+};
+
+/* [-1 0 1] x [1 2 1]/4: |Gx| / 4 covers 0..255 */
+const CAM_ConvKernel_t CAM_ConvSobelX =
+{
+    .size = 3U, .separable = 1U, .shift = 15U, .absolute = 1U,
+    .h = { -32767, 0, 32767 },
+    .v = { 8192, 16384, 8192 },
+};
+
+const CAM_ConvKernel_t CAM_ConvSobelY =
+{
+    .size = 3U, .separable = 1U, .shift = 15U, .absolute = 1U,
+    .h = { 8192, 16384, 8192 },
+    .v = { -32767, 0, 32767 },
+};
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static void LoadRow(CAM_ConvFormat_t format, const uint8_t *row, uint16_t width, uint32_t slot);
+static int32_t RefSample(CAM_ConvFormat_t format, const uint8_t *src, uint32_t stride,
+        int32_t x, int32_t y, uint16_t width, uint16_t height, uint32_t plane);
+
+/******************************************************************************
+ *                            INLINE HELPERS                                  *
+ ******************************************************************************/
+
+/* Rounded a / 2^n, or a * 2^-n for negative n */
+CONV_INLINE int32_t RoundShift(int32_t a, int32_t n)
+{
+    return (n > 0) ? ((a + (1L << (n - 1))) >> n) : (a * (1L << -n));
+}
+
+CONV_INLINE uint8_t Post(int32_t acc, const Conv_Post_t *post)
+{
+    int32_t v = RoundShift(acc, post->shift);
+
+    if (post->absolute && (v < 0))
+    {
+        v = -v;
+    }
+    v += post->offset;
+    return (uint8_t)((v < 0) ? 0 : ((v > 255) ? 255 : v));
+}
+
+/* Horizontal pass of one padded row into an intermediate line */
+CONV_INLINE void HPass(uint32_t size, const int16_t *line, int16_t *mid, uint16_t width,
+        const int16_t *h, int32_t shift)
+{
+    const int16_t *p = line + CONV_PAD - size / 2U;
+    uint32_t h01 = VISION_PACK16(h[0], h[1]);
+    uint32_t h23 = VISION_PACK16(h[2], h[3]);
+    int32_t hl = h[size - 1U];
+
+    for (uint32_t x = 0U; x < width; x++)
+    {
+        int32_t acc = p[x + size - 1U] * hl;
+
+        acc = VISION_SMLAD(VISION_LOAD32(&p[x]), h01, acc);
+        if (size == 5U)
+        {
+            acc = VISION_SMLAD(VISION_LOAD32(&p[x + 2U]), h23, acc);
+        }
+        mid[x] = (int16_t)RoundShift(acc, shift);
+    }
+}
+
+/* Vertical pass over the ring, two output pixels per iteration */
+CONV_INLINE void VPass(uint32_t size, int16_t *const *rows, uint8_t *out, uint16_t width,
+        const int16_t *v, const Conv_Post_t *post)
+{
+    uint32_t v01 = VISION_PACK16(v[0], v[1]);
+    uint32_t v23 = VISION_PACK16(v[2], v[3]);
+    int32_t vl = v[size - 1U];
+    const int16_t *rl = rows[size - 1U];
+    uint32_t x;
+
+    for (x = 0U; x + 1U < width; x += 2U)
+    {
+        uint32_t a = VISION_LOAD32(&rows[0][x]);
+        uint32_t b = VISION_LOAD32(&rows[1][x]);
+        int32_t acc0 = rl[x] * vl;
+        int32_t acc1 = rl[x + 1U] * vl;
+
+        acc0 = VISION_SMLAD(VISION_PKLO(a, b), v01, acc0);
+        acc1 = VISION_SMLAD(VISION_PKHI(a, b), v01, acc1);
+        if (size == 5U)
+        {
+            a = VISION_LOAD32(&rows[2][x]);
+            b = VISION_LOAD32(&rows[3][x]);
+            acc0 = VISION_SMLAD(VISION_PKLO(a, b), v23, acc0);
+            acc1 = VISION_SMLAD(VISION_PKHI(a, b), v23, acc1);
+        }
+        out[x] = Post(acc0, post);
+        out[x + 1U] = Post(acc1, post);
+    }
+    if (x < width)
+    {
+        int32_t acc = rl[x] * vl + rows[0][x] * v[0] + rows[1][x] * v[1];
+        if (size == 5U)
+        {
+            acc += rows[2][x] * v[2] + rows[3][x] * v[3];
+        }
+        out[x] = Post(acc, post);
+    }
+}
+
+/* General kernel over the ring of padded source rows */
+CONV_INLINE void GPass(uint32_t size, int16_t *const *rows, uint8_t *out, uint16_t width,
+        const int16_t *k, const Conv_Post_t *post)
+{
+    const int16_t *p[CAM_CONV_MAX_SIZE];
+    uint32_t k01[CAM_CONV_MAX_SIZE];
+    uint32_t k23[CAM_CONV_MAX_SIZE];
+    int32_t kl[CAM_CONV_MAX_SIZE];
+
+    for (uint32_t i = 0U; i < size; i++)
+    {
+        const int16_t *kr = &k[i * size];
+        p[i] = rows[i] + CONV_PAD - size / 2U;
+        k01[i] = VISION_PACK16(kr[0], kr[1]);
+        k23[i] = (size == 5U) ? VISION_PACK16(kr[2], kr[3]) : 0U;
+        kl[i] = kr[size - 1U];
+    }
+
+    for (uint32_t x = 0U; x < width; x++)
+    {
+        int32_t acc = 0;
+
+        for (uint32_t i = 0U; i < size; i++)
+        {
+            acc += p[i][x + size - 1U] * kl[i];
+            acc = VISION_SMLAD(VISION_LOAD32(&p[i][x]), k01[i], acc);
+            if (size == 5U)
+            {
+                acc = VISION_SMLAD(VISION_LOAD32(&p[i][x + 2U]), k23[i], acc);
+            }
+        }
+        out[x] = Post(acc, post);
+    }
+}
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+CAM_ConvStatus_t CAM_Conv_Check(const CAM_ConvKernel_t *kernel)
+{
+    uint32_t n = kernel->size;
+    int64_t sum = 0;
+
+    if (((n != 3U) && (n != 5U)) || (kernel->shift > 15U))
+    {
+        return CAM_CONV_ERROR;
+    }
+    if (kernel->separable)
+    {
+        int64_t sum_v = 0;
+        int64_t t_max;
+
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            sum += (kernel->h[i] < 0) ? -kernel->h[i] : kernel->h[i];
+            sum_v += (kernel->v[i] < 0) ? -kernel->v[i] : kernel->v[i];
+        }
+        /* Intermediate line is int16, the vertical sum int32 */
+        if (sum * 255 >= CONV_ACC_LIMIT)
+        {
+            return CAM_CONV_ERROR;
+        }
+        t_max = RoundShift((int32_t)(sum * 255), (int32_t)kernel->shift - (int32_t)CAM_CONV_INTER_FRAC);
+        if ((t_max > INT16_MAX) || (sum_v * t_max >= CONV_ACC_LIMIT))
+        {
+            return CAM_CONV_ERROR;
+        }
+    }
+    else
+    {
+        for (uint32_t i = 0U; i < n * n; i++)
+        {
+            sum += (kernel->k[i] < 0) ? -kernel->k[i] : kernel->k[i];
+        }
+        if (sum * 255 >= CONV_ACC_LIMIT)
+        {
+            return CAM_CONV_ERROR;
+        }
+    }
+    return CAM_CONV_OK;
+}
+
+CAM_ConvStatus_t CAM_Conv_Frame(const CAM_ConvKernel_t *kernel, CAM_ConvFormat_t format,
+        const uint8_t *src, uint32_t src_stride, uint8_t *dst, uint32_t dst_stride,
+        uint16_t width, uint16_t height)
+{
+    uint32_t start = VISION_CYCLES();
+    uint32_t size = kernel->size;
+    int32_t radius = (int32_t)size / 2;
+    uint32_t planes = (format == CAM_CONV_FMT_RGB565) ? CONV_PLANES : 1U;
+    int32_t hshift = (int32_t)kernel->shift - (int32_t)CAM_CONV_INTER_FRAC;
+    int32_t loaded = -1;
+    Conv_Post_t post;
+
+    if ((CAM_Conv_Check(kernel) != CAM_CONV_OK) || (width == 0U) || (height == 0U) ||
+        (width > CAM_CONV_MAX_WIDTH))
+    {
+        return CAM_CONV_ERROR;
+    }
+    post.shift = (int32_t)kernel->shift + (kernel->separable ? (int32_t)CAM_CONV_INTER_FRAC : 0);
+    post.offset = kernel->offset;
+    post.absolute = kernel->absolute;
+
+    for (int32_t y = 0; y < (int32_t)height; y++)
+    {
+        int32_t need = (y + radius < (int32_t)height) ? (y + radius) : ((int32_t)height - 1);
+        int16_t *rows[CAM_CONV_MAX_SIZE];
+        uint8_t *drow = dst + (uint32_t)y * dst_stride;
+
+        /* Pull in the source rows this output row needs */
+        while (loaded < need)
+        {
+            uint32_t slot;
+
+            loaded++;
+            slot = (uint32_t)loaded % size;
+            if (kernel->separable)
+            {
+                LoadRow(format, src + (uint32_t)loaded * src_stride, width, 0U);
+                for (uint32_t c = 0U; c < planes; c++)
+                {
+                    if (size == 3U)
+                    {
+                        HPass(3U, Conv.in[c][0], Conv.mid[c][slot], width, kernel->h, hshift);
+                    }
+                    else
+                    {
+                        HPass(5U, Conv.in[c][0], Conv.mid[c][slot], width, kernel->h, hshift);
+                    }
+                }
+            }
+            else
+            {
+                LoadRow(format, src + (uint32_t)loaded * src_stride, width, slot);
+            }
+        }
+
+        for (uint32_t c = 0U; c < planes; c++)
+        {
+            uint8_t *out = (planes == 1U) ? drow : Conv.out[c];
+
+            for (int32_t i = 0; i < (int32_t)size; i++)
+            {
+                int32_t r = y + i - radius;
+                r = (r < 0) ? 0 : ((r >= (int32_t)height) ? ((int32_t)height - 1) : r);
+                rows[i] = kernel->separable ? Conv.mid[c][(uint32_t)r % size] :
+                                              Conv.in[c][(uint32_t)r % size];
+            }
+            if (kernel->separable)
+            {
+                if (size == 3U)
+                {
+                    VPass(3U, rows, out, width, kernel->v, &post);
+                }
+                else
+                {
+                    VPass(5U, rows, out, width, kernel->v, &post);
+                }
+            }
+            else
+            {
+                if (size == 3U)
+                {
+                    GPass(3U, rows, out, width, kernel->k, &post);
+                }
+                else
+                {
+                    GPass(5U, rows, out, width, kernel->k, &post);
+                }
+            }
+        }
+
+        if (planes != 1U)
+        {
+            uint16_t *d = (uint16_t*)drow;
+            for (uint32_t x = 0U; x < width; x++)
+            {
+                d[x] = (uint16_t)(((Conv.out[0][x] >> 3) << 11) |
+                                  ((Conv.out[1][x] >> 2) << 5) |
+                                  (Conv.out[2][x] >> 3));
+            }
+        }
+    }
+
+    ConvCycles = VISION_CYCLES() - start;
+    return CAM_CONV_OK;
+}
+
+CAM_ConvStatus_t CAM_Conv_FrameRef(const CAM_ConvKernel_t *kernel, CAM_ConvFormat_t format,
+        const uint8_t *src, uint32_t src_stride, uint8_t *dst, uint32_t dst_stride,
+        uint16_t width, uint16_t height)
+{
+    int32_t n = kernel->size;
+    int32_t radius = n / 2;
+    uint32_t planes = (format == CAM_CONV_FMT_RGB565) ? CONV_PLANES : 1U;
+    int32_t hshift = (int32_t)kernel->shift - (int32_t)CAM_CONV_INTER_FRAC;
+    Conv_Post_t post;
+
+    if ((CAM_Conv_Check(kernel) != CAM_CONV_OK) || (width == 0U) || (height == 0U))
+    {
+        return CAM_CONV_ERROR;
+    }
+    post.shift = (int32_t)kernel->shift + (kernel->separable ? (int32_t)CAM_CONV_INTER_FRAC : 0);
+    post.offset = kernel->offset;
+    post.absolute = kernel->absolute;
+
+    for (int32_t y = 0; y < (int32_t)height; y++)
+    {
+        for (int32_t x = 0; x < (int32_t)width; x++)
+        {
+            uint8_t o[CONV_PLANES];
+
+            for (uint32_t c = 0U; c < planes; c++)
+            {
+                int32_t acc = 0;
+
+                for (int32_t i = 0; i < n; i++)
+                {
+                    if (kernel->separable)
+                    {
+                        int32_t t = 0;
+                        for (int32_t j = 0; j < n; j++)
+                        {
+                            t += kernel->h[j] * RefSample(format, src, src_stride,
+                                    x + j - radius, y + i - radius, width, height, c);
+                        }
+                        acc += kernel->v[i] * RoundShift(t, hshift);
+                    }
+                    else
+                    {
+                        for (int32_t j = 0; j < n; j++)
+                        {
+                            acc += kernel->k[i * n + j] * RefSample(format, src, src_stride,
+                                    x + j - radius, y + i - radius, width, height, c);
+                        }
+                    }
+                }
+                o[c] = Post(acc, &post);
+            }
+
+            if (planes == 1U)
+            {
+                dst[(uint32_t)y * dst_stride + (uint32_t)x] = o[0];
+            }
+            else
+            {
+                ((uint16_t*)(dst + (uint32_t)y * dst_stride))[x] =
+                        (uint16_t)(((o[0] >> 3) << 11) | ((o[1] >> 2) << 5) | (o[2] >> 3));
+            }
+        }
+    }
+    return CAM_CONV_OK;
+}
+
+uint32_t CAM_Conv_LastCycles(void)
+{
+    return ConvCycles;
+}
+
+/******************************************************************************
+ *                               LOCAL FUNCTIONS                              *
+ ******************************************************************************/
+
+/* Source row to 16 bit padded lines (one per plane), edges replicated */
+static void LoadRow(CAM_ConvFormat_t format, const uint8_t *row, uint16_t width, uint32_t slot)
+{
+    if (format == CAM_CONV_FMT_Y8)
+    {
+        int16_t *l = &Conv.in[0][slot][CONV_PAD];
+        for (uint32_t x = 0U; x < width; x++)
+        {
+            l[x] = row[x];
+        }
+    }
+    else
+    {
+        const uint16_t *px = (const uint16_t*)row;
+        int16_t *r = &Conv.in[0][slot][CONV_PAD];
+        int16_t *g = &Conv.in[1][slot][CONV_PAD];
+        int16_t *b = &Conv.in[2][slot][CONV_PAD];
+        for (uint32_t x = 0U; x < width; x++)
+        {
+            uint32_t p = px[x];
+            r[x] = VISION_EXPAND5(p >> 11);
+            g[x] = VISION_EXPAND6((p >> 5) & 0x3FU);
+            b[x] = VISION_EXPAND5(p & 0x1FU);
+        }
+    }
+
+    for (uint32_t c = 0U; c < ((format == CAM_CONV_FMT_Y8) ? 1U : CONV_PLANES); c++)
+    {
+        int16_t *l = Conv.in[c][slot];
+        for (uint32_t i = 0U; i < CONV_PAD; i++)
+        {
+            l[i] = l[CONV_PAD];
+            l[CONV_PAD + width + i] = l[CONV_PAD + width - 1U];
+        }
+    }
+}
+
+static int32_t RefSample(CAM_ConvFormat_t format, const uint8_t *src, uint32_t stride,
+        int32_t x, int32_t y, uint16_t width, uint16_t height, uint32_t plane)
+{
+    x = (x < 0) ? 0 : ((x >= (int32_t)width) ? ((int32_t)width - 1) : x);
+    y = (y < 0) ? 0 : ((y >= (int32_t)height) ? ((int32_t)height - 1) : y);
+    if (format == CAM_CONV_FMT_Y8)
+    {
+        return src[(uint32_t)y * stride + (uint32_t)x];
+    }
+    else
+    {
+        uint32_t p = ((const uint16_t*)(src + (uint32_t)y * stride))[x];
+        switch (plane)
+        {
+            case 0U:
+                return VISION_EXPAND5(p >> 11);
+            case 1U:
+                return VISION_EXPAND6((p >> 5) & 0x3FU);
+            default:
+                return VISION_EXPAND5(p & 0x1FU);
+        }
+    }
+}
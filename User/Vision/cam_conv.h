@@ -0,0 +1,98 @@
+/*
+ * cam_conv.h
+ * 3x3 / 5x5 convolution of camera frames in fixed point
+ *
+ * Kernels are either separable (one horizontal and one vertical tap vector)
+ * or general (size x size taps). Taps are signed 16 bit fixed point with
+ * 'shift' fraction bits (15 = Q15); kernels with taps beyond +-1.0 (sharpen,
+ * Laplace) use fewer fraction bits. Input and output are 8 bit luma planes
+ * or RGB565 frames (each channel filtered on its own). Borders replicate the
+ * edge pixels.
+ *
+ * Lines are expanded to 16 bit into rolling line buffers in DTCM and the taps
+ * are applied two at a time with the dual 16 bit MAC (SMLAD). The separable
+ * path keeps the horizontal result with CAM_CONV_INTER_FRAC extra fraction
+ * bits. CAM_Conv_FrameRef() computes the same arithmetic per pixel, results
+ * of both are bit identical.
+ */
+
+#ifndef CAM_CONV_H_
+#define CAM_CONV_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Widest line handled (line buffers are sized for it) */
+#define CAM_CONV_MAX_WIDTH                       (320U)
+#define CAM_CONV_MAX_SIZE                        (5U)
+/* Fraction bits kept between the horizontal and vertical pass */
+#define CAM_CONV_INTER_FRAC                      (4U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef enum
+{
+    CAM_CONV_OK = 0,
+    CAM_CONV_ERROR,               /* bad geometry, or kernel could overflow */
+} CAM_ConvStatus_t;
+
+typedef enum
+{
+    CAM_CONV_FMT_Y8 = 0,          /* one byte per pixel */
+    CAM_CONV_FMT_RGB565,          /* native endian 16 bit pixels */
+} CAM_ConvFormat_t;
+
+typedef struct
+{
+    uint8_t  size;                /* 3 or 5 */
+    uint8_t  separable;           /* h[]/v[] used, else k[] */
+    uint8_t  shift;               /* tap fraction bits (0..15) */
+    uint8_t  absolute;            /* |result| before offset (edge magnitude) */
+    int16_t  offset;              /* added to the result */
+    int16_t  h[CAM_CONV_MAX_SIZE];
+    int16_t  v[CAM_CONV_MAX_SIZE];
+    int16_t  k[CAM_CONV_MAX_SIZE * CAM_CONV_MAX_SIZE];    /* row major */
+} CAM_ConvKernel_t;
+
+/******************************************************************************
+ *                            PREDEFINED KERNELS                              *
+ ******************************************************************************/
+
+extern const CAM_ConvKernel_t CAM_ConvBox3;
+extern const CAM_ConvKernel_t CAM_ConvGauss3;
+extern const CAM_ConvKernel_t CAM_ConvGauss5;
+extern const CAM_ConvKernel_t CAM_ConvSharpen3;       /* general */
+extern const CAM_ConvKernel_t CAM_ConvLaplace3;       /* general, |result| */
+extern const CAM_ConvKernel_t CAM_ConvSobelX;         /* |Gx| / 4 */
+extern const CAM_ConvKernel_t CAM_ConvSobelY;         /* |Gy| / 4 */
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* CAM_CONV_ERROR if the worst case sums don't fit the 16/32 bit stages */
+extern CAM_ConvStatus_t CAM_Conv_Check(const CAM_ConvKernel_t *kernel);
+
+/* Strides in bytes; src and dst must not overlap. width <= CAM_CONV_MAX_WIDTH */
+extern CAM_ConvStatus_t CAM_Conv_Frame(const CAM_ConvKernel_t *kernel, CAM_ConvFormat_t format,
+        const uint8_t *src, uint32_t src_stride, uint8_t *dst, uint32_t dst_stride,
+        uint16_t width, uint16_t height);
+
+/* Scalar reference, same results as CAM_Conv_Frame() */
+extern CAM_ConvStatus_t CAM_Conv_FrameRef(const CAM_ConvKernel_t *kernel, CAM_ConvFormat_t format,
+        const uint8_t *src, uint32_t src_stride, uint8_t *dst, uint32_t dst_stride,
+        uint16_t width, uint16_t height);
+
+/* CPU cycles of the last CAM_Conv_Frame() call (0 off target) */
+extern uint32_t CAM_Conv_LastCycles(void);
+
+#endif /* CAM_CONV_H_ */
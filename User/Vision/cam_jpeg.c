@@ -0,0 +1,732 @@
+/*
+ * cam_jpeg.c
+ * Streaming baseline JPEG encoder for camera frames
+ *
+ * Baseline sequential JFIF, 3 components, standard (Annex K) Huffman tables.
+ * Forward DCT is the 13 bit fixed-point LLM integer transform (as IJG
+ * "islow"), whose output is 8x the true coefficient; quantization multiplies
+ * by a Q18 reciprocal of 8*q instead of dividing.
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "cam_jpeg.h"
+#include "vision_luma.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define DCT_CONST_BITS                (13)
+#define DCT_PASS1_BITS                (2)
+#define DCT_DESCALE(x, n)             (((x) + (1 << ((n) - 1))) >> (n))
+
+#define FIX_0_298631336               (2446)
+#define FIX_0_390180644               (3196)
+#define FIX_0_541196100               (4433)
+#define FIX_0_765366865               (6270)
+#define FIX_0_899976223               (7373)
+#define FIX_1_175875602               (9633)
+#define FIX_1_501321110               (12299)
+#define FIX_1_847759065               (15137)
+#define FIX_1_961570560               (16069)
+#define FIX_2_053119869               (16819)
+#define FIX_2_562915447               (20995)
+#define FIX_3_072711026               (25172)
+
+#define QUANT_SHIFT                   (18)
+
+/* Huffman table index */
+#define HUFF_DC_Y                     (0U)
+#define HUFF_AC_Y                     (1U)
+#define HUFF_DC_C                     (2U)
+#define HUFF_AC_C                     (3U)
+
+/******************************************************************************
+ *                           LOCAL DATA TYPES                                 *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint8_t         id;           /* DHT Tc/Th */
+    const uint8_t   *bits;        /* code count per length 1..16 */
+    const uint8_t   *vals;
+} Jpeg_HuffSpec_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+/* Zig-zag index -> natural (row major) index */
+static const uint8_t Jpeg_ZigZag[64] =
+{
+     0,  1,  8, 16,  9,  2,  3, 10, 17, 24, 32, 25, 18, 11,  4,  5,
+    12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13,  6,  7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,
+};
+
+/* Annex K.1 quantization tables, natural order */
+static const uint8_t Jpeg_QuantBase[2][64] =
+{
+    {
+        16, 11, 10, 16,  24,  40,  51,  61,
+        12, 12, 14, 19,  26,  58,  60,  55,
+        14, 13, 16, 24,  40,  57,  69,  56,
+        14, 17, 22, 29,  51,  87,  80,  62,
+        18, 22, 37, 56,  68, 109, 103,  77,
+        24, 35, 55, 64,  81, 104, 113,  92,
+        49, 64, 78, 87, 103, 121, 120, 101,
+        72, 92, 95, 98, 112, 100, 103,  99,
+    },
+    {
+        17, 18, 24, 47, 99, 99, 99, 99,
+        18, 21, 26, 66, 99, 99, 99, 99,
+        24, 26, 56, 99, 99, 99, 99, 99,
+        47, 66, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+        99, 99, 99, 99, 99, 99, 99, 99,
+    },
+};
+
+/* Annex K.3 Huffman tables */
+static const uint8_t Jpeg_DcYBits[16] = { 0, 1, 5, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0 };
+static const uint8_t Jpeg_DcCBits[16] = { 0, 3, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0 };
+static const uint8_t Jpeg_DcVals[12] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+
+static const uint8_t Jpeg_AcYBits[16] = { 0, 2, 1, 3, 3, 2, 4, 3, 5, 5, 4, 4, 0, 0, 1, 0x7D };
+static const uint8_t Jpeg_AcYVals[162] =
+{
+    0x01, 0x02, 0x03, 0x00, 0x04, 0x11, 0x05, 0x12, 0x21, 0x31, 0x41, 0x06, 0x13, 0x51, 0x61, 0x07,
+    0x22, 0x71, 0x14, 0x32, 0x81, 0x91, 0xA1, 0x08, 0x23, 0x42, 0xB1, 0xC1, 0x15, 0x52, 0xD1, 0xF0,
+    0x24, 0x33, 0x62, 0x72, 0x82, 0x09, 0x0A, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x25, 0x26, 0x27, 0x28,
+    0x29, 0x2A, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49,
+    0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69,
+    0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x83, 0x84, 0x85, 0x86, 0x87, 0x88, 0x89,
+    0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5, 0xA6, 0xA7,
+    0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3, 0xC4, 0xC5,
+    0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA, 0xE1, 0xE2,
+    0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF1, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+    0xF9, 0xFA,
+};
+
+static const uint8_t Jpeg_AcCBits[16] = { 0, 2, 1, 2, 4, 4, 3, 4, 7, 5, 4, 4, 0, 1, 2, 0x77 };
+static const uint8_t Jpeg_AcCVals[162] =
+{
+    0x00, 0x01, 0x02, 0x03, 0x11, 0x04, 0x05, 0x21, 0x31, 0x06, 0x12, 0x41, 0x51, 0x07, 0x61, 0x71,
+    0x13, 0x22, 0x32, 0x81, 0x08, 0x14, 0x42, 0x91, 0xA1, 0xB1, 0xC1, 0x09, 0x23, 0x33, 0x52, 0xF0,
+    0x15, 0x62, 0x72, 0xD1, 0x0A, 0x16, 0x24, 0x34, 0xE1, 0x25, 0xF1, 0x17, 0x18, 0x19, 0x1A, 0x26,
+    0x27, 0x28, 0x29, 0x2A, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48,
+    0x49, 0x4A, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68,
+    0x69, 0x6A, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79, 0x7A, 0x82, 0x83, 0x84, 0x85, 0x86, 0x87,
+    0x88, 0x89, 0x8A, 0x92, 0x93, 0x94, 0x95, 0x96, 0x97, 0x98, 0x99, 0x9A, 0xA2, 0xA3, 0xA4, 0xA5,
+    0xA6, 0xA7, 0xA8, 0xA9, 0xAA, 0xB2, 0xB3, 0xB4, 0xB5, 0xB6, 0xB7, 0xB8, 0xB9, 0xBA, 0xC2, 0xC3,
+    0xC4, 0xC5, 0xC6, 0xC7, 0xC8, 0xC9, 0xCA, 0xD2, 0xD3, 0xD4, 0xD5, 0xD6, 0xD7, 0xD8, 0xD9, 0xDA,
+    0xE2, 0xE3, 0xE4, 0xE5, 0xE6, 0xE7, 0xE8, 0xE9, 0xEA, 0xF2, 0xF3, 0xF4, 0xF5, 0xF6, 0xF7, 0xF8,
+    0xF9, 0xFA,
+};
+
+/* Same order as HUFF_xxx */
+static const Jpeg_HuffSpec_t Jpeg_HuffSpec[4] =
+{
+    { 0x00, Jpeg_DcYBits, Jpeg_DcVals },
+    { 0x10, Jpeg_AcYBits, Jpeg_AcYVals },
+    { 0x01, Jpeg_DcCBits, Jpeg_DcVals },
+    { 0x11, Jpeg_AcCBits, Jpeg_AcCVals },
+};
+
+/* Code and length per symbol, derived from the specs once */
+static struct
+{
+    uint8_t     ready;
+    uint16_t    code[4][256];
+    uint8_t     size[4][256];
+} Huff;
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static void Jpeg_HuffInit(void);
+static void Jpeg_QuantInit(CAM_Jpeg_t *jpg, uint8_t quality);
+static void Jpeg_WriteHeaders(CAM_Jpeg_t *jpg);
+static void Jpeg_PutByte(CAM_Jpeg_t *jpg, uint8_t byte);
+static void Jpeg_PutWord(CAM_Jpeg_t *jpg, uint16_t word);
+static void Jpeg_PutBits(CAM_Jpeg_t *jpg, uint32_t code, uint32_t size);
+static void Jpeg_FlushBits(CAM_Jpeg_t *jpg);
+static void Jpeg_Drain(CAM_Jpeg_t *jpg);
+static void Jpeg_LoadMCU(const CAM_Jpeg_t *jpg, const uint8_t *strip, uint32_t stride,
+        uint16_t lines, uint32_t x0, int16_t blk[6][64]);
+static void Jpeg_FDCT(int16_t *data);
+static void Jpeg_EncodeBlock(CAM_Jpeg_t *jpg, int16_t *blk, uint32_t comp);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+CAM_JpegStatus_t CAM_Jpeg_Begin(CAM_Jpeg_t *jpg, uint16_t width, uint16_t height,
+        CAM_JpegFormat_t format, CAM_JpegSub_t sub, uint8_t quality,
+        uint8_t *out, uint32_t out_size, CAM_JpegFlush_t flush, void *user)
+{
+    if ((jpg == NULL) || (width == 0U) || (height == 0U) || (out == NULL) || (out_size == 0U) ||
+            (format > CAM_JPEG_FMT_YUV422) || (sub > CAM_JPEG_SUB_420))
+    {
+        return CAM_JPEG_ERROR;
+    }
+
+    VISION_LumaInit();
+    if (!Huff.ready)
+    {
+        Jpeg_HuffInit();
+    }
+
+    memset(jpg, 0, sizeof(CAM_Jpeg_t));
+    jpg->width = width;
+    jpg->height = height;
+    jpg->format = (uint8_t)format;
+    jpg->sub = (uint8_t)sub;
+    jpg->out = out;
+    jpg->out_size = out_size;
+    jpg->flush = flush;
+    jpg->user = user;
+    jpg->status = CAM_JPEG_OK;
+    Jpeg_QuantInit(jpg, quality);
+    Jpeg_WriteHeaders(jpg);
+
+    return jpg->status;
+}
+
+uint16_t CAM_Jpeg_StripLines(const CAM_Jpeg_t *jpg)
+{
+    return (jpg->sub == CAM_JPEG_SUB_420) ? 16U : 8U;
+}
+
+CAM_JpegStatus_t CAM_Jpeg_EncodeStrip(CAM_Jpeg_t *jpg, const uint8_t *strip,
+        uint32_t stride, uint16_t lines)
+{
+    int16_t blk[6][64];
+    uint32_t nY = (jpg->sub == CAM_JPEG_SUB_420) ? 4U : 2U;
+    uint16_t mcu_h = CAM_Jpeg_StripLines(jpg);
+
+    if (jpg->status != CAM_JPEG_OK)
+    {
+        return jpg->status;
+    }
+    if ((strip == NULL) || (lines == 0U) || (lines > mcu_h) || (jpg->lines >= jpg->height) ||
+            ((lines < mcu_h) && ((jpg->lines + lines) != jpg->height)))
+    {
+        return CAM_JPEG_ERROR;
+    }
+
+    for (uint32_t x0 = 0U; x0 < jpg->width; x0 += 16U)
+    {
+        Jpeg_LoadMCU(jpg, strip, stride, lines, x0, blk);
+        for (uint32_t b = 0U; b < nY; b++)
+        {
+            Jpeg_EncodeBlock(jpg, blk[b], 0U);
+        }
+        Jpeg_EncodeBlock(jpg, blk[4], 1U);
+        Jpeg_EncodeBlock(jpg, blk[5], 2U);
+    }
+
+    jpg->lines = (uint16_t)(((uint32_t)jpg->lines + mcu_h > jpg->height) ?
+            jpg->height : (jpg->lines + mcu_h));
+    return jpg->status;
+}
+
+CAM_JpegStatus_t CAM_Jpeg_End(CAM_Jpeg_t *jpg, uint32_t *size)
+{
+    if ((jpg->status == CAM_JPEG_OK) && (jpg->lines != jpg->height))
+    {
+        return CAM_JPEG_ERROR;
+    }
+    Jpeg_FlushBits(jpg);
+    Jpeg_PutWord(jpg, 0xFFD9U);                 /* EOI */
+    if ((jpg->flush != NULL) && (jpg->out_len > 0U))
+    {
+        Jpeg_Drain(jpg);
+    }
+    if (size != NULL)
+    {
+        *size = jpg->total;
+    }
+    return jpg->status;
+}
+
+CAM_JpegStatus_t CAM_Jpeg_EncodeFrame(const uint8_t *frame, uint16_t width, uint16_t height,
+        CAM_JpegFormat_t format, CAM_JpegSub_t sub, uint8_t quality,
+        uint8_t *out, uint32_t out_size, uint32_t *size)
+{
+    CAM_Jpeg_t jpg;
+    uint32_t stride = (uint32_t)width * 2U;
+    CAM_JpegStatus_t ret;
+
+    ret = CAM_Jpeg_Begin(&jpg, width, height, format, sub, quality, out, out_size, NULL, NULL);
+    for (uint32_t y = 0U; (ret == CAM_JPEG_OK) && (y < height); y += CAM_Jpeg_StripLines(&jpg))
+    {
+        uint32_t lines = height - y;
+        if (lines > CAM_Jpeg_StripLines(&jpg))
+        {
+            lines = CAM_Jpeg_StripLines(&jpg);
+        }
+        ret = CAM_Jpeg_EncodeStrip(&jpg, frame + (y * stride), stride, (uint16_t)lines);
+    }
+    if (ret == CAM_JPEG_OK)
+    {
+        ret = CAM_Jpeg_End(&jpg, size);
+    }
+    return ret;
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+/* Annex C: canonical codes from the length counts */
+static void Jpeg_HuffInit(void)
+{
+    for (uint32_t t = 0U; t < 4U; t++)
+    {
+        const Jpeg_HuffSpec_t *spec = &Jpeg_HuffSpec[t];
+        uint32_t code = 0U;
+        uint32_t k = 0U;
+
+        for (uint32_t len = 1U; len <= 16U; len++)
+        {
+            for (uint32_t i = 0U; i < spec->bits[len - 1U]; i++)
+            {
+                Huff.code[t][spec->vals[k]] = (uint16_t)code;
+                Huff.size[t][spec->vals[k]] = (uint8_t)len;
+                code++;
+                k++;
+            }
+            code <<= 1;
+        }
+    }
+    Huff.ready = 1U;
+}
+
+/* IJG quality scaling, then reciprocals for the DCT output (8x scale) */
+static void Jpeg_QuantInit(CAM_Jpeg_t *jpg, uint8_t quality)
+{
+    uint32_t scale;
+
+    if (quality == 0U)
+    {
+        quality = 1U;
+    }
+    if (quality > 100U)
+    {
+        quality = 100U;
+    }
+    scale = (quality < 50U) ? (5000U / quality) : (200U - (quality * 2U));
+
+    for (uint32_t t = 0U; t < 2U; t++)
+    {
+        for (uint32_t k = 0U; k < 64U; k++)
+        {
+            uint32_t n = Jpeg_ZigZag[k];
+            uint32_t q = ((Jpeg_QuantBase[t][n] * scale) + 50U) / 100U;
+
+            q = (q < 1U) ? 1U : ((q > 255U) ? 255U : q);
+            jpg->qtab[t][k] = (uint8_t)q;
+            jpg->qrecip[t][n] = (uint16_t)(((1UL << QUANT_SHIFT) + (4U * q)) / (8U * q));
+        }
+    }
+}
+
+static void Jpeg_WriteHeaders(CAM_Jpeg_t *jpg)
+{
+    static const uint8_t jfif[14] =
+    {
+        'J', 'F', 'I', 'F', 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00
+    };
+    uint32_t dht_len = 2U;
+
+    Jpeg_PutWord(jpg, 0xFFD8U);                 /* SOI */
+
+    Jpeg_PutWord(jpg, 0xFFE0U);                 /* APP0 JFIF 1.01, no density */
+    Jpeg_PutWord(jpg, 2U + sizeof(jfif));
+    for (uint32_t i = 0U; i < sizeof(jfif); i++)
+    {
+        Jpeg_PutByte(jpg, jfif[i]);
+    }
+
+    Jpeg_PutWord(jpg, 0xFFDBU);                 /* DQT, 8 bit, both tables */
+    Jpeg_PutWord(jpg, 2U + (2U * 65U));
+    for (uint32_t t = 0U; t < 2U; t++)
+    {
+        Jpeg_PutByte(jpg, (uint8_t)t);
+        for (uint32_t k = 0U; k < 64U; k++)
+        {
+            Jpeg_PutByte(jpg, jpg->qtab[t][k]);
+        }
+    }
+
+    Jpeg_PutWord(jpg, 0xFFC0U);                 /* SOF0 */
+    Jpeg_PutWord(jpg, 17U);
+    Jpeg_PutByte(jpg, 8U);
+    Jpeg_PutWord(jpg, jpg->height);
+    Jpeg_PutWord(jpg, jpg->width);
+    Jpeg_PutByte(jpg, 3U);
+    Jpeg_PutByte(jpg, 1U);                      /* Y: 2x2 or 2x1, table 0 */
+    Jpeg_PutByte(jpg, (jpg->sub == CAM_JPEG_SUB_420) ? 0x22U : 0x21U);
+    Jpeg_PutByte(jpg, 0U);
+    Jpeg_PutByte(jpg, 2U);                      /* Cb */
+    Jpeg_PutByte(jpg, 0x11U);
+    Jpeg_PutByte(jpg, 1U);
+    Jpeg_PutByte(jpg, 3U);                      /* Cr */
+    Jpeg_PutByte(jpg, 0x11U);
+    Jpeg_PutByte(jpg, 1U);
+
+    for (uint32_t t = 0U; t < 4U; t++)
+    {
+        dht_len += 17U;
+        for (uint32_t i = 0U; i < 16U; i++)
+        {
+            dht_len += Jpeg_HuffSpec[t].bits[i];
+        }
+    }
+    Jpeg_PutWord(jpg, 0xFFC4U);                 /* DHT, all four tables */
+    Jpeg_PutWord(jpg, (uint16_t)dht_len);
+    for (uint32_t t = 0U; t < 4U; t++)
+    {
+        const Jpeg_HuffSpec_t *spec = &Jpeg_HuffSpec[t];
+        uint32_t n = 0U;
+
+        Jpeg_PutByte(jpg, spec->id);
+        for (uint32_t i = 0U; i < 16U; i++)
+        {
+            Jpeg_PutByte(jpg, spec->bits[i]);
+            n += spec->bits[i];
+        }
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            Jpeg_PutByte(jpg, spec->vals[i]);
+        }
+    }
+
+    Jpeg_PutWord(jpg, 0xFFDAU);                 /* SOS, all components */
+    Jpeg_PutWord(jpg, 12U);
+    Jpeg_PutByte(jpg, 3U);
+    Jpeg_PutByte(jpg, 1U);
+    Jpeg_PutByte(jpg, 0x00U);
+    Jpeg_PutByte(jpg, 2U);
+    Jpeg_PutByte(jpg, 0x11U);
+    Jpeg_PutByte(jpg, 3U);
+    Jpeg_PutByte(jpg, 0x11U);
+    Jpeg_PutByte(jpg, 0U);                      /* Ss, Se, Ah/Al */
+    Jpeg_PutByte(jpg, 63U);
+    Jpeg_PutByte(jpg, 0U);
+}
+
+static void Jpeg_PutByte(CAM_Jpeg_t *jpg, uint8_t byte)
+{
+    if (jpg->out_len == jpg->out_size)
+    {
+        if ((jpg->flush == NULL) || (jpg->status != CAM_JPEG_OK))
+        {
+            jpg->status = CAM_JPEG_OVERFLOW;
+            return;
+        }
+        Jpeg_Drain(jpg);
+        if (jpg->status != CAM_JPEG_OK)
+        {
+            return;
+        }
+    }
+    jpg->out[jpg->out_len++] = byte;
+    jpg->total++;
+}
+
+static void Jpeg_PutWord(CAM_Jpeg_t *jpg, uint16_t word)
+{
+    Jpeg_PutByte(jpg, (uint8_t)(word >> 8));
+    Jpeg_PutByte(jpg, (uint8_t)word);
+}
+
+/* MSB first, size <= 16; 0xFF data bytes are stuffed with 0x00 */
+static void Jpeg_PutBits(CAM_Jpeg_t *jpg, uint32_t code, uint32_t size)
+{
+    jpg->bitbuf = (jpg->bitbuf << size) | (code & ((1UL << size) - 1U));
+    jpg->bitcnt += size;
+    while (jpg->bitcnt >= 8U)
+    {
+        uint8_t byte = (uint8_t)(jpg->bitbuf >> (jpg->bitcnt - 8U));
+
+        jpg->bitcnt -= 8U;
+        Jpeg_PutByte(jpg, byte);
+        if (byte == 0xFFU)
+        {
+            Jpeg_PutByte(jpg, 0x00U);
+        }
+    }
+}
+
+/* Pad the last byte with 1s */
+static void Jpeg_FlushBits(CAM_Jpeg_t *jpg)
+{
+    if (jpg->bitcnt > 0U)
+    {
+        Jpeg_PutBits(jpg, 0x7FU, 8U - jpg->bitcnt);
+    }
+    jpg->bitbuf = 0U;
+}
+
+static void Jpeg_Drain(CAM_Jpeg_t *jpg)
+{
+    if (jpg->flush(jpg->user, jpg->out, jpg->out_len) != 0)
+    {
+        jpg->status = CAM_JPEG_OVERFLOW;
+        return;
+    }
+    jpg->out_len = 0U;
+}
+
+/*
+ * One MCU into six 8x8 blocks of centered samples:
+ * blk[0..3] Y (4:2:2 uses blk[0..1]), blk[4] Cb, blk[5] Cr.
+ * Pixels past the right/bottom edge repeat the last column/line.
+ */
+static void Jpeg_LoadMCU(const CAM_Jpeg_t *jpg, const uint8_t *strip, uint32_t stride,
+        uint16_t lines, uint32_t x0, int16_t blk[6][64])
+{
+    uint32_t vshift = (jpg->sub == CAM_JPEG_SUB_420) ? 1U : 0U;
+    uint32_t mcu_h = 8U << vshift;
+    /* Chroma sums over 2 (4:2:2) or 4 (4:2:0) pixels */
+    int32_t s0[64];
+    int32_t s1[64];
+    int32_t s2[64];
+
+    memset(s0, 0, sizeof(s0));
+    memset(s1, 0, sizeof(s1));
+    memset(s2, 0, sizeof(s2));
+
+    for (uint32_t r = 0U; r < mcu_h; r++)
+    {
+        const uint8_t *line = strip + (((r < lines) ? r : (lines - 1U)) * stride);
+        int16_t *yb = blk[((r >> 3) << 1)] + ((r & 7U) << 3);
+        uint32_t ci = (r >> vshift) << 3;
+
+        for (uint32_t c = 0U; c < 16U; c++)
+        {
+            uint32_t x = x0 + c;
+            int16_t *y = (c < 8U) ? &yb[c] : &blk[((r >> 3) << 1) + 1U][((r & 7U) << 3) + (c - 8U)];
+
+            if (x >= jpg->width)
+            {
+                x = jpg->width - 1U;
+            }
+            if (jpg->format == CAM_JPEG_FMT_RGB565)
+            {
+                uint32_t px = ((const uint16_t*)line)[x];
+                uint32_t r5 = px >> 11;
+                uint32_t g6 = (px >> 5) & 0x3FU;
+                uint32_t b5 = px & 0x1FU;
+
+                *y = (int16_t)((int32_t)VISION_LUMA(px) - 128);
+                s0[ci + (c >> 1)] += VISION_EXPAND5(r5);
+                s1[ci + (c >> 1)] += VISION_EXPAND6(g6);
+                s2[ci + (c >> 1)] += VISION_EXPAND5(b5);
+            }
+            else
+            {
+                const uint8_t *p = &line[(x >> 1) << 2];
+
+                *y = (int16_t)((int32_t)line[x << 1] - 128);
+                s0[ci + (c >> 1)] += p[1];
+                s1[ci + (c >> 1)] += p[3];
+            }
+        }
+    }
+
+    /* 4:2:2 sums 2 pixels, 4:2:0 sums 4 */
+    for (uint32_t i = 0U; i < 64U; i++)
+    {
+        uint32_t shift = 1U + vshift;
+
+        if (jpg->format == CAM_JPEG_FMT_RGB565)
+        {
+            int32_t r = s0[i];
+            int32_t g = s1[i];
+            int32_t b = s2[i];
+
+            shift += 8U;
+            blk[4][i] = (int16_t)(((-43 * r) - (85 * g) + (128 * b) + (1 << (shift - 1U))) >> shift);
+            blk[5][i] = (int16_t)(((128 * r) - (107 * g) - (21 * b) + (1 << (shift - 1U))) >> shift);
+        }
+        else
+        {
+            blk[4][i] = (int16_t)(((s0[i] + (1 << (shift - 1U))) >> shift) - 128);
+            blk[5][i] = (int16_t)(((s1[i] + (1 << (shift - 1U))) >> shift) - 128);
+        }
+    }
+}
+
+/* Integer forward DCT in place, output scaled by 8 */
+static void Jpeg_FDCT(int16_t *data)
+{
+    int32_t tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;
+    int32_t tmp10, tmp11, tmp12, tmp13;
+    int32_t z1, z2, z3, z4, z5;
+    int16_t *p;
+
+    /* Pass 1: rows, results scaled up by 2^PASS1_BITS */
+    p = data;
+    for (uint32_t i = 0U; i < 8U; i++, p += 8)
+    {
+        tmp0 = p[0] + p[7];
+        tmp7 = p[0] - p[7];
+        tmp1 = p[1] + p[6];
+        tmp6 = p[1] - p[6];
+        tmp2 = p[2] + p[5];
+        tmp5 = p[2] - p[5];
+        tmp3 = p[3] + p[4];
+        tmp4 = p[3] - p[4];
+
+        tmp10 = tmp0 + tmp3;
+        tmp13 = tmp0 - tmp3;
+        tmp11 = tmp1 + tmp2;
+        tmp12 = tmp1 - tmp2;
+
+        p[0] = (int16_t)((tmp10 + tmp11) * (1 << DCT_PASS1_BITS));
+        p[4] = (int16_t)((tmp10 - tmp11) * (1 << DCT_PASS1_BITS));
+
+        z1 = (tmp12 + tmp13) * FIX_0_541196100;
+        p[2] = (int16_t)DCT_DESCALE(z1 + (tmp13 * FIX_0_765366865), DCT_CONST_BITS - DCT_PASS1_BITS);
+        p[6] = (int16_t)DCT_DESCALE(z1 - (tmp12 * FIX_1_847759065), DCT_CONST_BITS - DCT_PASS1_BITS);
+
+        z1 = tmp4 + tmp7;
+        z2 = tmp5 + tmp6;
+        z3 = tmp4 + tmp6;
+        z4 = tmp5 + tmp7;
+        z5 = (z3 + z4) * FIX_1_175875602;
+
+        tmp4 *= FIX_0_298631336;
+        tmp5 *= FIX_2_053119869;
+        tmp6 *= FIX_3_072711026;
+        tmp7 *= FIX_1_501321110;
+        z1 *= -FIX_0_899976223;
+        z2 *= -FIX_2_562915447;
+        z3 = (z3 * -FIX_1_961570560) + z5;
+        z4 = (z4 * -FIX_0_390180644) + z5;
+
+        p[7] = (int16_t)DCT_DESCALE(tmp4 + z1 + z3, DCT_CONST_BITS - DCT_PASS1_BITS);
+        p[5] = (int16_t)DCT_DESCALE(tmp5 + z2 + z4, DCT_CONST_BITS - DCT_PASS1_BITS);
+        p[3] = (int16_t)DCT_DESCALE(tmp6 + z2 + z3, DCT_CONST_BITS - DCT_PASS1_BITS);
+        p[1] = (int16_t)DCT_DESCALE(tmp7 + z1 + z4, DCT_CONST_BITS - DCT_PASS1_BITS);
+    }
+
+    /* Pass 2: columns, remove PASS1_BITS and leave the 8x scale */
+    p = data;
+    for (uint32_t i = 0U; i < 8U; i++, p++)
+    {
+        tmp0 = p[8 * 0] + p[8 * 7];
+        tmp7 = p[8 * 0] - p[8 * 7];
+        tmp1 = p[8 * 1] + p[8 * 6];
+        tmp6 = p[8 * 1] - p[8 * 6];
+        tmp2 = p[8 * 2] + p[8 * 5];
+        tmp5 = p[8 * 2] - p[8 * 5];
+        tmp3 = p[8 * 3] + p[8 * 4];
+        tmp4 = p[8 * 3] - p[8 * 4];
+
+        tmp10 = tmp0 + tmp3;
+        tmp13 = tmp0 - tmp3;
+        tmp11 = tmp1 + tmp2;
+        tmp12 = tmp1 - tmp2;
+
+        p[8 * 0] = (int16_t)DCT_DESCALE(tmp10 + tmp11, DCT_PASS1_BITS);
+        p[8 * 4] = (int16_t)DCT_DESCALE(tmp10 - tmp11, DCT_PASS1_BITS);
+
+        z1 = (tmp12 + tmp13) * FIX_0_541196100;
+        p[8 * 2] = (int16_t)DCT_DESCALE(z1 + (tmp13 * FIX_0_765366865), DCT_CONST_BITS + DCT_PASS1_BITS);
+        p[8 * 6] = (int16_t)DCT_DESCALE(z1 - (tmp12 * FIX_1_847759065), DCT_CONST_BITS + DCT_PASS1_BITS);
+
+        z1 = tmp4 + tmp7;
+        z2 = tmp5 + tmp6;
+        z3 = tmp4 + tmp6;
+        z4 = tmp5 + tmp7;
+        z5 = (z3 + z4) * FIX_1_175875602;
+
+        tmp4 *= FIX_0_298631336;
+        tmp5 *= FIX_2_053119869;
+        tmp6 *= FIX_3_072711026;
+        tmp7 *= FIX_1_501321110;
+        z1 *= -FIX_0_899976223;
+        z2 *= -FIX_2_562915447;
+        z3 = (z3 * -FIX_1_961570560) + z5;
+        z4 = (z4 * -FIX_0_390180644) + z5;
+
+        p[8 * 7] = (int16_t)DCT_DESCALE(tmp4 + z1 + z3, DCT_CONST_BITS + DCT_PASS1_BITS);
+        p[8 * 5] = (int16_t)DCT_DESCALE(tmp5 + z2 + z4, DCT_CONST_BITS + DCT_PASS1_BITS);
+        p[8 * 3] = (int16_t)DCT_DESCALE(tmp6 + z2 + z3, DCT_CONST_BITS + DCT_PASS1_BITS);
+        p[8 * 1] = (int16_t)DCT_DESCALE(tmp7 + z1 + z4, DCT_CONST_BITS + DCT_PASS1_BITS);
+    }
+}
+
+/* DCT, quantize and Huffman code one block of component comp (0 Y, 1 Cb, 2 Cr) */
+static void Jpeg_EncodeBlock(CAM_Jpeg_t *jpg, int16_t *blk, uint32_t comp)
+{
+    uint32_t t = (comp == 0U) ? 0U : 1U;
+    uint32_t hdc = (t == 0U) ? HUFF_DC_Y : HUFF_DC_C;
+    uint32_t hac = (t == 0U) ? HUFF_AC_Y : HUFF_AC_C;
+    const uint16_t *recip = jpg->qrecip[t];
+    uint32_t run = 0U;
+    int32_t diff;
+
+    Jpeg_FDCT(blk);
+    for (uint32_t i = 0U; i < 64U; i++)
+    {
+        int32_t v = blk[i];
+        int32_t q = (int32_t)((((uint32_t)((v < 0) ? -v : v) * recip[i]) +
+                (1UL << (QUANT_SHIFT - 1))) >> QUANT_SHIFT);
+
+        blk[i] = (int16_t)((v < 0) ? -q : q);
+    }
+
+    /* DC: difference to the previous block of the component */
+    diff = blk[0] - jpg->dc_pred[comp];
+    jpg->dc_pred[comp] = blk[0];
+    {
+        uint32_t mag = (uint32_t)((diff < 0) ? -diff : diff);
+        uint32_t nbits = (mag != 0U) ? (32U - (uint32_t)__builtin_clz(mag)) : 0U;
+
+        Jpeg_PutBits(jpg, Huff.code[hdc][nbits], Huff.size[hdc][nbits]);
+        if (nbits != 0U)
+        {
+            Jpeg_PutBits(jpg, (uint32_t)((diff < 0) ? (diff - 1) : diff), nbits);
+        }
+    }
+
+    /* AC: (run, size) symbols in zig-zag order */
+    for (uint32_t k = 1U; k < 64U; k++)
+    {
+        int32_t v = blk[Jpeg_ZigZag[k]];
+        uint32_t mag, nbits;
+
+        if (v == 0)
+        {
+            run++;
+            continue;
+        }
+        while (run > 15U)
+        {
+            Jpeg_PutBits(jpg, Huff.code[hac][0xF0], Huff.size[hac][0xF0]);
+            run -= 16U;
+        }
+        mag = (uint32_t)((v < 0) ? -v : v);
+        nbits = 32U - (uint32_t)__builtin_clz(mag);
+        Jpeg_PutBits(jpg, Huff.code[hac][(run << 4) | nbits], Huff.size[hac][(run << 4) | nbits]);
+        Jpeg_PutBits(jpg, (uint32_t)((v < 0) ? (v - 1) : v), nbits);
+        run = 0U;
+    }
+    if (run > 0U)
+    {
+        Jpeg_PutBits(jpg, Huff.code[hac][0x00], Huff.size[hac][0x00]);
+    }
+}
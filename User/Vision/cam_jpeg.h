@@ -0,0 +1,101 @@
+/*
+ * cam_jpeg.h
+ * Streaming baseline JPEG encoder for camera frames
+ *
+ * The image is fed in strips of one MCU row (8 lines for 4:2:2, 16 lines for
+ * 4:2:0) straight from the RGB565 or YUV422 capture buffer. Output goes to a
+ * caller supplied bounded buffer; with a flush callback the buffer is drained
+ * whenever it fills, so the encoder can feed storage or a stream as well.
+ */
+
+#ifndef CAM_JPEG_H_
+#define CAM_JPEG_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+#define CAM_JPEG_DEF_QUALITY                     (75U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef enum
+{
+    CAM_JPEG_OK = 0,
+    CAM_JPEG_ERROR,               /* bad parameters or call sequence */
+    CAM_JPEG_OVERFLOW,            /* output buffer full, no (working) flush */
+} CAM_JpegStatus_t;
+
+typedef enum
+{
+    CAM_JPEG_FMT_RGB565 = 0,      /* native endian 16 bit pixels */
+    CAM_JPEG_FMT_YUV422,          /* bytes Y0 U Y1 V */
+} CAM_JpegFormat_t;
+
+typedef enum
+{
+    CAM_JPEG_SUB_422 = 0,         /* MCU 16x8, 8 line strips */
+    CAM_JPEG_SUB_420,             /* MCU 16x16, 16 line strips */
+} CAM_JpegSub_t;
+
+/* Drain the output buffer; return 0 when all len bytes were taken */
+typedef int (*CAM_JpegFlush_t)(void *user, const uint8_t *data, uint32_t len);
+
+typedef struct
+{
+    /* Image */
+    uint16_t         width;
+    uint16_t         height;
+    uint16_t         lines;       /* lines encoded so far */
+    uint8_t          format;
+    uint8_t          sub;
+    /* Output */
+    uint8_t          *out;
+    uint32_t         out_size;
+    uint32_t         out_len;     /* bytes waiting in out[] */
+    uint32_t         total;       /* bytes produced since CAM_Jpeg_Begin() */
+    CAM_JpegFlush_t  flush;
+    void             *user;
+    CAM_JpegStatus_t status;
+    /* Entropy coder */
+    uint32_t         bitbuf;
+    uint32_t         bitcnt;
+    int16_t          dc_pred[3];
+    /* Quantization: table in zig-zag order and Q18 reciprocals of 8*q */
+    uint8_t          qtab[2][64];
+    uint16_t         qrecip[2][64];
+} CAM_Jpeg_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Writes the headers; quality 1..100 (IJG scaling) */
+extern CAM_JpegStatus_t CAM_Jpeg_Begin(CAM_Jpeg_t *jpg, uint16_t width, uint16_t height,
+        CAM_JpegFormat_t format, CAM_JpegSub_t sub, uint8_t quality,
+        uint8_t *out, uint32_t out_size, CAM_JpegFlush_t flush, void *user);
+
+/* Lines per strip for this encoder (8 or 16) */
+extern uint16_t CAM_Jpeg_StripLines(const CAM_Jpeg_t *jpg);
+
+/* One MCU row; only the last strip of the image may hold fewer lines */
+extern CAM_JpegStatus_t CAM_Jpeg_EncodeStrip(CAM_Jpeg_t *jpg, const uint8_t *strip,
+        uint32_t stride, uint16_t lines);
+
+/* Writes EOI and flushes; *size gets the total JPEG size */
+extern CAM_JpegStatus_t CAM_Jpeg_End(CAM_Jpeg_t *jpg, uint32_t *size);
+
+/* Whole frame in one call (Begin, all strips, End) */
+extern CAM_JpegStatus_t CAM_Jpeg_EncodeFrame(const uint8_t *frame, uint16_t width, uint16_t height,
+        CAM_JpegFormat_t format, CAM_JpegSub_t sub, uint8_t quality,
+        uint8_t *out, uint32_t out_size, uint32_t *size);
+
+#endif /* CAM_JPEG_H_ */
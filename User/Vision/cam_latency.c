@@ -0,0 +1,236 @@
+/*
+ * cam_latency.c
+ * Camera to display latency harness
+ *
+ * VSYNC opens a slot in a small ring of frames in flight (reusing the
+ * oldest one, a frame still in it was never shown); the copy events fill
+ * in their stamp by frame number. VISIBLE completes the newest copied
+ * frame; the frames older than it were overwritten in the framebuffer or
+ * can't be shown any more and are closed as dropped.
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "cam_latency.h"
+#include "vision_simd.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define LAT_BIT(ev)                   (1U << (ev))
+
+/* Events come from the DCMI, MDMA and LTDC interrupts and the main loop */
+#if VISION_HAVE_DSP
+#define LAT_LOCK()                    uint32_t primask = __get_PRIMASK(); __disable_irq()
+#define LAT_UNLOCK()                  __set_PRIMASK(primask)
+#else
+#define LAT_LOCK()
+#define LAT_UNLOCK()
+#endif
+
+/******************************************************************************
+ *                            LOCAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint32_t frame;
+    uint32_t t[CAM_LAT_EVENTS];
+    uint8_t  mask;                /* events stamped, 0 = free */
+} Lat_Slot_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    uint32_t    ticks_per_us;
+    uint32_t    next;             /* slot for the next VSYNC */
+    Lat_Slot_t  slot[CAM_LAT_INFLIGHT];
+    CAM_Lat_t   lat;
+} Lat;
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static Lat_Slot_t* Lat_Find(uint32_t frame);
+static void Lat_Complete(Lat_Slot_t *s, uint32_t time);
+static void Lat_Add(CAM_LatStage_t stage, uint32_t ticks);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void CAM_Lat_Init(uint32_t ticks_per_us)
+{
+    VISION_CyclesInit();
+    Lat.ticks_per_us = (ticks_per_us == 0U) ? 1U : ticks_per_us;
+    CAM_Lat_Reset();
+}
+
+void CAM_Lat_Reset(void)
+{
+    LAT_LOCK();
+    memset(Lat.slot, 0, sizeof(Lat.slot));
+    memset(&Lat.lat, 0, sizeof(Lat.lat));
+    for (uint32_t i = 0U; i < CAM_LAT_STAGES; i++)
+    {
+        Lat.lat.stage[i].min_us = 0xFFFFFFFFU;
+    }
+    Lat.next = 0U;
+    LAT_UNLOCK();
+}
+
+void CAM_Lat_Event(CAM_LatEvent_t event, uint32_t frame, uint32_t time)
+{
+    Lat_Slot_t *s;
+
+    LAT_LOCK();
+    switch (event)
+    {
+        case CAM_LAT_EV_VSYNC:
+            s = &Lat.slot[Lat.next];
+            Lat.next = (Lat.next + 1U) % CAM_LAT_INFLIGHT;
+            if (s->mask != 0U)
+            {
+                Lat.lat.dropped++;
+            }
+            s->frame = frame;
+            s->t[CAM_LAT_EV_VSYNC] = time;
+            s->mask = LAT_BIT(CAM_LAT_EV_VSYNC);
+            Lat.lat.frames++;
+            break;
+
+        case CAM_LAT_EV_COPY_START:
+        case CAM_LAT_EV_COPY_DONE:
+            s = Lat_Find(frame);
+            if (s == NULL)
+            {
+                Lat.lat.orphans++;
+                break;
+            }
+            s->t[event] = time;
+            s->mask |= LAT_BIT(event);
+            break;
+
+        case CAM_LAT_EV_VISIBLE:
+        {
+            Lat_Slot_t *shown = NULL;
+
+            /* The scan out shows the newest copied frame ... */
+            for (uint32_t i = 0U; i < CAM_LAT_INFLIGHT; i++)
+            {
+                s = &Lat.slot[i];
+                if ((s->mask & LAT_BIT(CAM_LAT_EV_COPY_DONE)) &&
+                        ((shown == NULL) || ((int32_t)(s->frame - shown->frame) > 0)))
+                {
+                    shown = s;
+                }
+            }
+            if (shown == NULL)
+            {
+                break;
+            }
+            /* ... the older ones were overwritten or will never be shown */
+            for (uint32_t i = 0U; i < CAM_LAT_INFLIGHT; i++)
+            {
+                s = &Lat.slot[i];
+                if ((s->mask != 0U) && ((int32_t)(s->frame - shown->frame) < 0))
+                {
+                    s->mask = 0U;
+                    Lat.lat.dropped++;
+                }
+            }
+            Lat_Complete(shown, time);
+        }
+            break;
+
+        default:
+            break;
+    }
+    LAT_UNLOCK();
+}
+
+void CAM_Lat_Stamp(CAM_LatEvent_t event, uint32_t frame)
+{
+    CAM_Lat_Event(event, frame, VISION_CYCLES());
+}
+
+void CAM_Lat_Get(CAM_Lat_t *lat)
+{
+    LAT_LOCK();
+    *lat = Lat.lat;
+    LAT_UNLOCK();
+}
+
+uint32_t CAM_Lat_Percentile(const CAM_Lat_t *lat, CAM_LatStage_t stage, uint32_t per_mille)
+{
+    const CAM_LatHist_t *h = &lat->stage[stage];
+    uint32_t target = (uint32_t)(((uint64_t)h->count * per_mille + 999U) / 1000U);
+    uint32_t sum = 0U;
+
+    if (h->count == 0U)
+    {
+        return 0U;
+    }
+    for (uint32_t i = 0U; i < (CAM_LAT_BINS - 1U); i++)
+    {
+        sum += h->hist[i];
+        if (sum >= target)
+        {
+            /* Not above what was seen */
+            uint32_t edge = (i + 1U) * CAM_LAT_BIN_US;
+            return (edge < h->max_us) ? edge : h->max_us;
+        }
+    }
+    return h->max_us;
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+static Lat_Slot_t* Lat_Find(uint32_t frame)
+{
+    for (uint32_t i = 0U; i < CAM_LAT_INFLIGHT; i++)
+    {
+        if ((Lat.slot[i].mask != 0U) && (Lat.slot[i].frame == frame))
+        {
+            return &Lat.slot[i];
+        }
+    }
+    return NULL;
+}
+
+static void Lat_Complete(Lat_Slot_t *s, uint32_t time)
+{
+    /* An address swap has no copy: start = done */
+    uint32_t start = (s->mask & LAT_BIT(CAM_LAT_EV_COPY_START)) ?
+            s->t[CAM_LAT_EV_COPY_START] : s->t[CAM_LAT_EV_COPY_DONE];
+
+    Lat_Add(CAM_LAT_QUEUE, start - s->t[CAM_LAT_EV_VSYNC]);
+    Lat_Add(CAM_LAT_COPY, s->t[CAM_LAT_EV_COPY_DONE] - start);
+    Lat_Add(CAM_LAT_SCANOUT, time - s->t[CAM_LAT_EV_COPY_DONE]);
+    Lat_Add(CAM_LAT_TOTAL, time - s->t[CAM_LAT_EV_VSYNC]);
+    s->mask = 0U;
+    Lat.lat.shown++;
+}
+
+static void Lat_Add(CAM_LatStage_t stage, uint32_t ticks)
+{
+    CAM_LatHist_t *h = &Lat.lat.stage[stage];
+    uint32_t us = ticks / Lat.ticks_per_us;
+    uint32_t bin = us / CAM_LAT_BIN_US;
+
+    h->hist[(bin < CAM_LAT_BINS) ? bin : (CAM_LAT_BINS - 1U)]++;
+    h->count++;
+    h->sum_us += us;
+    h->min_us = (us < h->min_us) ? us : h->min_us;
+    h->max_us = (us > h->max_us) ? us : h->max_us;
+}
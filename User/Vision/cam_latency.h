@@ -0,0 +1,97 @@
+/*
+ * cam_latency.h
+ * Camera to display latency harness
+ *
+ * Every frame is stamped at four points of the display pipeline:
+ *  - VSYNC:      the frame is complete in the capture buffer (DCMI VSYNC)
+ *  - COPY_START: the display path picked it up
+ *  - COPY_DONE:  it is in the framebuffer (MDMA copy done, or address swap)
+ *  - VISIBLE:    the next LTDC reload at vertical blanking, the scan out
+ *                from there on shows it
+ * and the stage durations (queue, copy, scan out) and the total go into
+ * histograms. Frames overtaken by a newer one before they were shown are
+ * counted as dropped.
+ *
+ * The harness only sees (event, frame, time) triples: on the target
+ * CAM_Lat_Stamp() reads the cycle counter, a host build feeds synthetic
+ * timelines through CAM_Lat_Event() (Tools/latency_sim) to study the worst
+ * case of a pipeline configuration without hardware.
+ */
+
+#ifndef CAM_LATENCY_H_
+#define CAM_LATENCY_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Histogram: CAM_LAT_BINS bins of CAM_LAT_BIN_US, the last one is open */
+#define CAM_LAT_BINS                             (128U)
+#define CAM_LAT_BIN_US                           (2000U)
+/* Frames tracked between VSYNC and VISIBLE */
+#define CAM_LAT_INFLIGHT                         (8U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef enum
+{
+    CAM_LAT_EV_VSYNC = 0,
+    CAM_LAT_EV_COPY_START,
+    CAM_LAT_EV_COPY_DONE,
+    CAM_LAT_EV_VISIBLE,           /* frame ignored: newest copied frame */
+    CAM_LAT_EVENTS
+} CAM_LatEvent_t;
+
+typedef enum
+{
+    CAM_LAT_QUEUE = 0,            /* VSYNC -> COPY_START */
+    CAM_LAT_COPY,                 /* COPY_START -> COPY_DONE */
+    CAM_LAT_SCANOUT,              /* COPY_DONE -> VISIBLE */
+    CAM_LAT_TOTAL,                /* VSYNC -> VISIBLE */
+    CAM_LAT_STAGES
+} CAM_LatStage_t;
+
+typedef struct
+{
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+    uint32_t hist[CAM_LAT_BINS];
+} CAM_LatHist_t;
+
+typedef struct
+{
+    CAM_LatHist_t stage[CAM_LAT_STAGES];
+    uint32_t frames;              /* VSYNC seen */
+    uint32_t shown;               /* reached VISIBLE */
+    uint32_t dropped;             /* overtaken before being shown */
+    uint32_t orphans;             /* events for a frame not tracked */
+} CAM_Lat_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Time unit of CAM_Lat_Event(): ticks per microsecond (1 on the host) */
+extern void CAM_Lat_Init(uint32_t ticks_per_us);
+extern void CAM_Lat_Reset(void);
+
+/* Any context; time in ticks, wrapping at 32 bits */
+extern void CAM_Lat_Event(CAM_LatEvent_t event, uint32_t frame, uint32_t time);
+/* Same with the cycle counter as the time */
+extern void CAM_Lat_Stamp(CAM_LatEvent_t event, uint32_t frame);
+
+extern void CAM_Lat_Get(CAM_Lat_t *lat);
+/* Upper bound (bin edge) of the given per mille of a stage, 0 if empty */
+extern uint32_t CAM_Lat_Percentile(const CAM_Lat_t *lat, CAM_LatStage_t stage, uint32_t per_mille);
+
+#endif /* CAM_LATENCY_H_ */
@@ -0,0 +1,403 @@
+/*
+ * cam_motion.c
+ * Block based motion detection on RGB565 frames
+ *
+ * Per frame:
+ *  1. downsample: four pixels (two words) give four luma bytes, USAD8 against
+ *     zero sums them, four lines of that make one grid cell;
+ *  2. block SAD: a block row of four cells is exactly one packed word, so a
+ *     4x4 cell block is four USADA8 against the background; the grid rows
+ *     are padded to whole words with zero cells on both sides, a last
+ *     block row adds only the grid rows it has, the threshold scales with
+ *     the cells of the block;
+ *  3. blocks above the threshold set their mask bit and are grouped into
+ *     bounding boxes (8-connected);
+ *  4. background update: running average in Q8, slower on moving blocks so a
+ *     stopped object is absorbed instead of frozen.
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "cam_motion.h"
+#include "vision_simd.h"
+#include "vision_luma.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define GRID_WORDS                    (CAM_MOTION_GRID_W / 4U)
+/* Extra background shift applied on moving blocks */
+#define MOTION_BG_HOLD                (2U)
+
+#define MOTION_BARRIER()              __asm volatile ("" ::: "memory")
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    volatile uint8_t enabled;
+    volatile uint8_t front;       /* index of the published result */
+    uint8_t     threshold;
+    uint8_t     bg_shift;
+    uint8_t     learnt;           /* background holds a frame */
+    uint16_t    grid_w;
+    uint16_t    grid_h;
+    uint16_t    words;            /* per grid row, the last one padded */
+    /* Luma grids, four cells per word */
+    uint32_t    cur[CAM_MOTION_GRID_H][GRID_WORDS];
+    uint32_t    bg8[CAM_MOTION_GRID_H][GRID_WORDS];
+    uint16_t    bg16[CAM_MOTION_GRID_H][CAM_MOTION_GRID_W];    /* Q8 */
+    uint16_t    colsum[CAM_MOTION_GRID_W];
+    /* Bounding box search */
+    uint8_t     seen[CAM_MOTION_BLOCKS];
+    uint16_t    stack[CAM_MOTION_BLOCKS];
+    CAM_Motion_t result[2];
+} Motion;
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static void Motion_Downsample(const uint8_t *frame, uint16_t width);
+static void Motion_Detect(CAM_Motion_t *out);
+static void Motion_Boxes(CAM_Motion_t *out);
+static void Motion_AddBox(CAM_Motion_t *out, const CAM_MotionBox_t *box);
+static void Motion_Learn(const CAM_Motion_t *out);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void CAM_Motion_Init(void)
+{
+    VISION_LumaInit();
+    VISION_CyclesInit();
+    memset(Motion.result, 0, sizeof(Motion.result));
+    Motion.front = 0U;
+    Motion.learnt = 0U;
+    CAM_Motion_Config(CAM_MOTION_DEF_THRESHOLD, CAM_MOTION_DEF_BG_SHIFT);
+}
+
+void CAM_Motion_Config(uint8_t threshold, uint8_t bg_shift)
+{
+    Motion.threshold = threshold;
+    Motion.bg_shift = (bg_shift > 8U) ? 8U : bg_shift;
+}
+
+void CAM_Motion_Enable(uint8_t enable)
+{
+    if (enable && !Motion.enabled)
+    {
+        Motion.learnt = 0U;
+    }
+    Motion.enabled = enable ? 1U : 0U;
+}
+
+uint8_t CAM_Motion_isEnabled(void)
+{
+    return Motion.enabled;
+}
+
+void CAM_Motion_Reset(void)
+{
+    Motion.learnt = 0U;
+}
+
+void CAM_Motion_Process(const uint8_t *frame, uint16_t width, uint16_t height, uint32_t seq)
+{
+    uint32_t start = VISION_CYCLES();
+    uint16_t grid_w = width / CAM_MOTION_CELL;
+    uint16_t grid_h = height / CAM_MOTION_CELL;
+    CAM_Motion_t *out;
+
+    if (!Motion.enabled || (frame == NULL) ||
+            (width > CAM_MOTION_MAX_WIDTH) || (height > CAM_MOTION_MAX_HEIGHT) ||
+            (width & 1U) || (grid_w == 0U) || (grid_h == 0U))
+    {
+        return;
+    }
+    if ((grid_w != Motion.grid_w) || (grid_h != Motion.grid_h))
+    {
+        Motion.grid_w = grid_w;
+        Motion.grid_h = grid_h;
+        Motion.words = (uint16_t)((grid_w + 3U) / 4U);
+        Motion.learnt = 0U;
+    }
+
+    out = &Motion.result[Motion.front ^ 1U];
+    out->seq = 0U;
+    MOTION_BARRIER();
+
+    Motion_Downsample(frame, width);
+    Motion_Detect(out);
+    Motion_Boxes(out);
+    Motion_Learn(out);
+    out->cycles = VISION_CYCLES() - start;
+
+    MOTION_BARRIER();
+    out->seq = seq;
+    MOTION_BARRIER();
+    Motion.front ^= 1U;
+}
+
+uint32_t CAM_Motion_Get(CAM_Motion_t *motion)
+{
+    uint8_t front;
+
+    /* Same protocol as CAM_Stats_Get() */
+    do
+    {
+        front = Motion.front;
+        MOTION_BARRIER();
+        memcpy(motion, &Motion.result[front], sizeof(CAM_Motion_t));
+        MOTION_BARRIER();
+    } while ((*(volatile uint32_t*)&Motion.result[front].seq) != motion->seq);
+
+    return motion->seq;
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+/* Frame -> cur[][]: mean luma of every 4x4 pixel cell */
+static void Motion_Downsample(const uint8_t *frame, uint16_t width)
+{
+    for (uint32_t gy = 0U; gy < Motion.grid_h; gy++)
+    {
+        /* Cells past grid_w stay 0 */
+        memset(Motion.colsum, 0, Motion.words * 4U * sizeof(Motion.colsum[0]));
+
+        for (uint32_t r = 0U; r < CAM_MOTION_CELL; r++)
+        {
+            const uint32_t *line = (const uint32_t*)(frame +
+                    ((gy * CAM_MOTION_CELL + r) * width * 2U));
+
+            for (uint32_t gx = 0U; gx < Motion.grid_w; gx++)
+            {
+                Motion.colsum[gx] += (uint16_t)VISION_USAD8(VISION_Luma4(line[0], line[1]), 0U);
+                line += 2;
+            }
+        }
+
+        for (uint32_t gw = 0U; gw < Motion.words; gw++)
+        {
+            const uint16_t *s = &Motion.colsum[gw * 4U];
+            Motion.cur[gy][gw] = ((uint32_t)(s[0] + 8U) >> 4) |
+                    (((uint32_t)(s[1] + 8U) >> 4) << 8) |
+                    (((uint32_t)(s[2] + 8U) >> 4) << 16) |
+                    (((uint32_t)(s[3] + 8U) >> 4) << 24);
+        }
+    }
+}
+
+/* Block SAD against the background, fills the mask */
+static void Motion_Detect(CAM_Motion_t *out)
+{
+    uint32_t bx_n = Motion.words;
+    uint32_t by_n = (Motion.grid_h + CAM_MOTION_BLOCK - 1U) / CAM_MOTION_BLOCK;
+    uint32_t last_w = Motion.grid_w - (bx_n - 1U) * CAM_MOTION_BLOCK;
+
+    memset(out->mask, 0, sizeof(out->mask));
+    out->blocks_x = (uint16_t)bx_n;
+    out->blocks_y = (uint16_t)by_n;
+    out->active = 0U;
+    out->score = 0U;
+    out->sad_total = 0U;
+    if (!Motion.learnt)
+    {
+        return;
+    }
+
+    for (uint32_t by = 0U; by < by_n; by++)
+    {
+        const uint32_t (*c)[GRID_WORDS] = &Motion.cur[by * CAM_MOTION_BLOCK];
+        const uint32_t (*b)[GRID_WORDS] = &Motion.bg8[by * CAM_MOTION_BLOCK];
+        uint32_t rows = Motion.grid_h - by * CAM_MOTION_BLOCK;
+
+        rows = (rows > CAM_MOTION_BLOCK) ? CAM_MOTION_BLOCK : rows;
+        for (uint32_t bx = 0U; bx < bx_n; bx++)
+        {
+            uint32_t cols = ((bx + 1U) == bx_n) ? last_w : CAM_MOTION_BLOCK;
+            uint32_t limit = (uint32_t)Motion.threshold * cols * rows;
+            uint32_t sad;
+
+            if (rows == CAM_MOTION_BLOCK)
+            {
+                sad = VISION_USAD8(c[0][bx], b[0][bx]);
+                sad = VISION_USADA8(c[1][bx], b[1][bx], sad);
+                sad = VISION_USADA8(c[2][bx], b[2][bx], sad);
+                sad = VISION_USADA8(c[3][bx], b[3][bx], sad);
+            }
+            else
+            {
+                sad = 0U;
+                for (uint32_t r = 0U; r < rows; r++)
+                {
+                    sad = VISION_USADA8(c[r][bx], b[r][bx], sad);
+                }
+            }
+
+            if (sad > limit)
+            {
+                uint32_t i = by * bx_n + bx;
+                out->mask[i >> 5] |= 1UL << (i & 31U);
+                out->active++;
+                out->sad_total += sad;
+            }
+        }
+    }
+    out->score = (uint16_t)((out->active * 1000U) / (bx_n * by_n));
+}
+
+/* Group 8-connected moving blocks */
+static void Motion_Boxes(CAM_Motion_t *out)
+{
+    uint32_t bx_n = out->blocks_x;
+    uint32_t by_n = out->blocks_y;
+    uint32_t cell = CAM_MOTION_CELL * CAM_MOTION_BLOCK;
+    uint32_t grid_x = (uint32_t)Motion.grid_w * CAM_MOTION_CELL;
+    uint32_t grid_y = (uint32_t)Motion.grid_h * CAM_MOTION_CELL;
+
+    out->nboxes = 0U;
+    if (out->active == 0U)
+    {
+        return;
+    }
+    memset(Motion.seen, 0, bx_n * by_n);
+
+    for (uint32_t i = 0U; i < (bx_n * by_n); i++)
+    {
+        uint32_t sp = 0U;
+        uint32_t x0, y0, x1, y1, n = 0U;
+        CAM_MotionBox_t box;
+
+        if (Motion.seen[i] || !((out->mask[i >> 5] >> (i & 31U)) & 1U))
+        {
+            continue;
+        }
+        x0 = x1 = i % bx_n;
+        y0 = y1 = i / bx_n;
+        Motion.seen[i] = 1U;
+        Motion.stack[sp++] = (uint16_t)i;
+
+        while (sp > 0U)
+        {
+            uint32_t j = Motion.stack[--sp];
+            uint32_t jx = j % bx_n;
+            uint32_t jy = j / bx_n;
+
+            n++;
+            x0 = (jx < x0) ? jx : x0;
+            x1 = (jx > x1) ? jx : x1;
+            y0 = (jy < y0) ? jy : y0;
+            y1 = (jy > y1) ? jy : y1;
+
+            for (int32_t dy = -1; dy <= 1; dy++)
+            {
+                for (int32_t dx = -1; dx <= 1; dx++)
+                {
+                    int32_t nx = (int32_t)jx + dx;
+                    int32_t ny = (int32_t)jy + dy;
+                    uint32_t k;
+
+                    if ((nx < 0) || (ny < 0) || (nx >= (int32_t)bx_n) || (ny >= (int32_t)by_n))
+                    {
+                        continue;
+                    }
+                    k = (uint32_t)ny * bx_n + (uint32_t)nx;
+                    if (!Motion.seen[k] && ((out->mask[k >> 5] >> (k & 31U)) & 1U))
+                    {
+                        Motion.seen[k] = 1U;
+                        Motion.stack[sp++] = (uint16_t)k;
+                    }
+                }
+            }
+        }
+
+        /* A box on the last block row/column ends with the grid */
+        x1 = ((x1 + 1U) * cell > grid_x) ? grid_x : (x1 + 1U) * cell;
+        y1 = ((y1 + 1U) * cell > grid_y) ? grid_y : (y1 + 1U) * cell;
+        box.x = (uint16_t)(x0 * cell);
+        box.y = (uint16_t)(y0 * cell);
+        box.w = (uint16_t)(x1 - x0 * cell);
+        box.h = (uint16_t)(y1 - y0 * cell);
+        box.blocks = (uint16_t)n;
+        Motion_AddBox(out, &box);
+    }
+}
+
+/* Keep the CAM_MOTION_MAX_BOXES biggest boxes */
+static void Motion_AddBox(CAM_Motion_t *out, const CAM_MotionBox_t *box)
+{
+    uint32_t smallest = 0U;
+
+    if (out->nboxes < CAM_MOTION_MAX_BOXES)
+    {
+        out->box[out->nboxes++] = *box;
+        return;
+    }
+    for (uint32_t i = 1U; i < CAM_MOTION_MAX_BOXES; i++)
+    {
+        if (out->box[i].blocks < out->box[smallest].blocks)
+        {
+            smallest = i;
+        }
+    }
+    if (box->blocks > out->box[smallest].blocks)
+    {
+        out->box[smallest] = *box;
+    }
+}
+
+/* Running average background, Q8 */
+static void Motion_Learn(const CAM_Motion_t *out)
+{
+    uint32_t bx_n = out->blocks_x;
+
+    for (uint32_t gy = 0U; gy < Motion.grid_h; gy++)
+    {
+        uint16_t *bg = Motion.bg16[gy];
+        uint32_t by = gy / CAM_MOTION_BLOCK;
+
+        for (uint32_t gw = 0U; gw < Motion.words; gw++)
+        {
+            uint32_t c = Motion.cur[gy][gw];
+            uint32_t b8 = 0U;
+            uint32_t shift = Motion.bg_shift;
+            uint32_t i = by * bx_n + gw;
+
+            if (!Motion.learnt)
+            {
+                /* First frame: take it as is */
+                for (uint32_t k = 0U; k < 4U; k++)
+                {
+                    bg[gw * 4U + k] = (uint16_t)(((c >> (k * 8U)) & 0xFFU) << 8);
+                }
+                Motion.bg8[gy][gw] = c;
+                continue;
+            }
+            if ((out->mask[i >> 5] >> (i & 31U)) & 1U)
+            {
+                shift += MOTION_BG_HOLD;
+            }
+            for (uint32_t k = 0U; k < 4U; k++)
+            {
+                int32_t v = (int32_t)(((c >> (k * 8U)) & 0xFFU) << 8);
+                int32_t q = bg[gw * 4U + k];
+
+                q += (v - q) >> shift;
+                bg[gw * 4U + k] = (uint16_t)q;
+                b8 |= (((uint32_t)q + 128U) >> 8) << (k * 8U);
+            }
+            Motion.bg8[gy][gw] = b8;
+        }
+    }
+    Motion.learnt = 1U;
+}
@@ -0,0 +1,93 @@
+/*
+ * cam_motion.h
+ * Block based motion detection on RGB565 frames
+ *
+ * The frame is reduced to a luma grid (one cell per 4x4 pixels), compared
+ * block by block (4x4 cells) against a running average background and the
+ * blocks whose SAD crosses the threshold form the motion mask. Touching
+ * blocks are grouped into bounding boxes. A grid that isn't a whole number
+ * of blocks (160x120: 40x30 cells) ends with a narrower block column or a
+ * shorter block row, compared on the cells it has.
+ */
+
+#ifndef CAM_MOTION_H_
+#define CAM_MOTION_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Pixels per grid cell side and grid cells per block side (fixed: one word) */
+#define CAM_MOTION_CELL                          (4U)
+#define CAM_MOTION_BLOCK                         (4U)
+/* Largest frame handled */
+#define CAM_MOTION_MAX_WIDTH                     (320U)
+#define CAM_MOTION_MAX_HEIGHT                    (240U)
+/* Reported bounding boxes, the largest ones are kept */
+#define CAM_MOTION_MAX_BOXES                     (8U)
+
+/* Defaults for CAM_Motion_Config() */
+#define CAM_MOTION_DEF_THRESHOLD                 (12U)    /* mean |diff| per cell */
+#define CAM_MOTION_DEF_BG_SHIFT                  (4U)     /* background alpha 1/16 */
+
+#define CAM_MOTION_GRID_W                        (CAM_MOTION_MAX_WIDTH / CAM_MOTION_CELL)
+#define CAM_MOTION_GRID_H                        (CAM_MOTION_MAX_HEIGHT / CAM_MOTION_CELL)
+#define CAM_MOTION_BLOCKS_X                      (CAM_MOTION_GRID_W / CAM_MOTION_BLOCK)
+#define CAM_MOTION_BLOCKS_Y                      (CAM_MOTION_GRID_H / CAM_MOTION_BLOCK)
+#define CAM_MOTION_BLOCKS                        (CAM_MOTION_BLOCKS_X * CAM_MOTION_BLOCKS_Y)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint16_t x;                   /* frame pixels */
+    uint16_t y;
+    uint16_t w;
+    uint16_t h;
+    uint16_t blocks;              /* moving blocks inside the box */
+} CAM_MotionBox_t;
+
+typedef struct
+{
+    uint32_t seq;                 /* frame sequence number, 0 = nothing yet */
+    uint32_t cycles;              /* CPU cycles spent on this frame */
+    uint32_t sad_total;           /* SAD of the moving blocks */
+    uint16_t blocks_x;            /* mask geometry for this frame */
+    uint16_t blocks_y;
+    uint16_t active;              /* moving blocks */
+    uint16_t score;               /* moving blocks, per mille */
+    uint8_t  nboxes;
+    CAM_MotionBox_t box[CAM_MOTION_MAX_BOXES];
+    uint32_t mask[(CAM_MOTION_BLOCKS + 31U) / 32U];   /* bit per block, row major */
+} CAM_Motion_t;
+
+#define CAM_MOTION_IS_SET(m, bx, by)             \
+    (((m)->mask[((by) * (m)->blocks_x + (bx)) >> 5] >> (((by) * (m)->blocks_x + (bx)) & 31U)) & 1U)
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+extern void CAM_Motion_Init(void);
+extern void CAM_Motion_Config(uint8_t threshold, uint8_t bg_shift);
+extern void CAM_Motion_Enable(uint8_t enable);
+extern uint8_t CAM_Motion_isEnabled(void);
+/* Drop the background, the next frame is learnt again */
+extern void CAM_Motion_Reset(void);
+
+/* Call from the frame ready callback; width even, pixels past the last
+ * whole cell are left out */
+extern void CAM_Motion_Process(const uint8_t *frame, uint16_t width, uint16_t height, uint32_t seq);
+
+/* Copy of the last published result, returns its sequence number (0 = none) */
+extern uint32_t CAM_Motion_Get(CAM_Motion_t *motion);
+
+#endif /* CAM_MOTION_H_ */
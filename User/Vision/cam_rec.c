@@ -0,0 +1,626 @@
+/*
+ * cam_rec.c
+ * Recording ring of the last captured frames in SDRAM, with replay
+ *
+ * Storage:
+ *  - the payloads are packed one after the other in the pool, wrapping to
+ *    the start when the next one doesn't fit before the cap (the end of the
+ *    pool is then left unused until the ring wraps again); the metadata is
+ *    in a separate circular index;
+ *  - space is reserved for a raw frame and trimmed to the coded size;
+ *  - coded payload: 32 bit tokens, REC_RUN | n followed by one word
+ *    repeated n times, or n followed by n literal words. Delta frames code
+ *    the XOR with the previous recorded frame, so the decoder skips the
+ *    runs of zeros and applies the literals in place.
+ *
+ * Two frame buffers alternate as staging (MDMA target) and reference (the
+ * last recorded frame, for the next delta); a third one holds the replay.
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "main.h"
+#include "cam_rec.h"
+#include "BSP_MDMA.h"
+#include "vision_simd.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define REC_RUN                       (0x80000000U)
+#define REC_NO_SPACE                  (0xFFFFFFFFU)
+#define REC_NONE                      (0xFFFFU)
+#define REC_FRAME_WORDS               (CAM_REC_MAX_FRAME_BYTES / 4U)
+/* Freeze waits this long for a frame being copied */
+#define REC_FREEZE_TIMEOUT_MS         (100U)
+
+/******************************************************************************
+ *                            LOCAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef enum
+{
+    REC_IDLE = 0,
+    REC_STAGING,                  /* MDMA copy */
+    REC_STAGED,                   /* copied, stored by CAM_Rec_Task() */
+} Rec_State_t;
+
+typedef enum
+{
+    REC_CODEC_RAW = 0,
+    REC_CODEC_RLE,
+    REC_CODEC_DELTA,
+} Rec_Codec_t;
+
+typedef struct
+{
+    uint32_t offset;              /* in the pool */
+    uint32_t size;                /* payload bytes */
+    uint32_t seq;
+    uint32_t time_ms;
+    uint16_t width;
+    uint16_t height;
+    uint8_t  codec;
+    uint8_t  key;                 /* decodable on its own */
+} Rec_Entry_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    volatile uint8_t enabled;
+    volatile uint8_t frozen;
+    volatile uint8_t state;
+    uint8_t     mode;
+    uint8_t     key_interval;
+    uint8_t     since_key;
+    uint8_t     ref;              /* buffer holding the last recorded frame */
+    uint8_t     ref_valid;
+    uint32_t    cap;
+    /* Ring */
+    uint32_t    first;
+    uint32_t    count;
+    uint32_t    tail;             /* end of the newest payload */
+    Rec_Entry_t entry[CAM_REC_MAX_FRAMES];
+    /* Frame being staged */
+    Rec_Entry_t pending;
+    CAM_RecRelease_t release;
+    /* Replay */
+    uint8_t     playing;
+    uint16_t    cursor;
+    uint16_t    decoded;          /* position in the replay buffer */
+    uint32_t    play_tick;        /* HAL_GetTick() at Play() */
+    uint32_t    play_time;        /* recorded time of the frame at Play() */
+    CAM_RecStats_t stats;
+} Rec;
+
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint32_t Rec_Pool[CAM_REC_POOL_BYTES / 4U];
+/* Staging / reference pair, replay */
+__attribute__((section(".SDRAMSection"))) __attribute__((aligned(32)))
+static uint32_t Rec_Frame[3][REC_FRAME_WORDS];
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static void Rec_Clear(void);
+static void Rec_Staged(HAL_StatusTypeDef status, void *user);
+static void Rec_Store(void);
+static uint32_t Rec_Alloc(uint32_t size);
+static void Rec_Evict(void);
+static uint32_t Rec_Encode(const uint32_t *src, const uint32_t *ref, uint32_t words,
+        uint32_t *out, uint32_t limit);
+static void Rec_Decode(const uint32_t *in, uint32_t *dst, uint32_t words, uint8_t delta);
+static void Rec_DecodeTo(uint32_t pos);
+static inline Rec_Entry_t* Rec_At(uint32_t pos);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void CAM_Rec_Init(void)
+{
+    VISION_CyclesInit();
+    memset(&Rec.stats, 0, sizeof(Rec.stats));
+    Rec.frozen = 0U;
+    Rec.state = REC_IDLE;
+    CAM_Rec_Config(CAM_REC_DEF_MODE, CAM_REC_DEF_CAP_BYTES, CAM_REC_DEF_KEY_INTERVAL);
+}
+
+void CAM_Rec_Config(CAM_RecMode_t mode, uint32_t cap_bytes, uint8_t key_interval)
+{
+    uint8_t enabled = Rec.enabled;
+
+    /* Nothing may be stored meanwhile */
+    Rec.enabled = 0U;
+    (void)BSP_MDMA_Wait(REC_FREEZE_TIMEOUT_MS);
+    Rec.state = REC_IDLE;
+    Rec.mode = (uint8_t)mode;
+    Rec.cap = ((cap_bytes > CAM_REC_POOL_BYTES) ? CAM_REC_POOL_BYTES : cap_bytes) & ~3U;
+    Rec.key_interval = (key_interval == 0U) ? 1U : key_interval;
+    Rec_Clear();
+    Rec.enabled = enabled;
+}
+
+void CAM_Rec_Enable(uint8_t enable)
+{
+    Rec.enabled = enable ? 1U : 0U;
+}
+
+uint8_t CAM_Rec_isEnabled(void)
+{
+    return Rec.enabled;
+}
+
+uint8_t CAM_Rec_Capture(const uint8_t *frame, uint16_t width, uint16_t height,
+        uint32_t seq, CAM_RecRelease_t release)
+{
+    uint32_t bytes = (uint32_t)width * height * 2U;
+    BSP_MDMA_Rect_t rect;
+
+    if (!Rec.enabled || Rec.frozen || (frame == NULL))
+    {
+        return 0U;
+    }
+    if ((bytes == 0U) || (bytes > CAM_REC_MAX_FRAME_BYTES) || (width & 1U) || (bytes > Rec.cap))
+    {
+        Rec.stats.errors++;
+        return 0U;
+    }
+    if (Rec.state != REC_IDLE)
+    {
+        Rec.stats.skipped++;
+        return 0U;
+    }
+
+    Rec.pending.seq = seq;
+    Rec.pending.time_ms = HAL_GetTick();
+    Rec.pending.width = width;
+    Rec.pending.height = height;
+
+    /* Whole frame as one block, lines of up to 64 KB */
+    rect.src = frame;
+    rect.dst = Rec_Frame[Rec.ref ^ 1U];
+    rect.src_stride = (uint32_t)width * 2U;
+    rect.dst_stride = (uint32_t)width * 2U;
+    rect.width = (uint32_t)width * 2U;
+    rect.lines = height;
+    Rec.release = release;
+    Rec.state = REC_STAGING;
+    if (BSP_MDMA_Copy2D(&rect, Rec_Staged, NULL) != HAL_OK)
+    {
+        Rec.state = REC_IDLE;
+        Rec.stats.skipped++;
+        return 0U;
+    }
+    return 1U;
+}
+
+void CAM_Rec_Task(void)
+{
+    uint32_t start;
+
+    if (Rec.state != REC_STAGED)
+    {
+        return;
+    }
+    start = VISION_CYCLES();
+    Rec_Store();
+    Rec.stats.store_us = (VISION_CYCLES() - start) / (SystemCoreClock / 1000000U);
+    Rec.state = REC_IDLE;
+}
+
+void CAM_Rec_Freeze(void)
+{
+    uint32_t tick = HAL_GetTick();
+
+    Rec.frozen = 1U;
+    while ((Rec.state == REC_STAGING) && ((HAL_GetTick() - tick) < REC_FREEZE_TIMEOUT_MS))
+    {
+    }
+    /* The last frame copied is kept */
+    CAM_Rec_Task();
+    Rec.playing = 0U;
+    Rec.cursor = (Rec.count != 0U) ? (uint16_t)(Rec.count - 1U) : 0U;
+    Rec.decoded = REC_NONE;
+}
+
+void CAM_Rec_Live(void)
+{
+    Rec.playing = 0U;
+    Rec.frozen = 0U;
+}
+
+uint8_t CAM_Rec_isFrozen(void)
+{
+    return Rec.frozen;
+}
+
+void CAM_Rec_Seek(int32_t frames)
+{
+    int32_t pos = (int32_t)Rec.cursor + frames;
+
+    if (!Rec.frozen || (Rec.count == 0U))
+    {
+        return;
+    }
+    Rec.playing = 0U;
+    pos = (pos < 0) ? 0 : pos;
+    pos = (pos >= (int32_t)Rec.count) ? (int32_t)(Rec.count - 1U) : pos;
+    Rec.cursor = (uint16_t)pos;
+}
+
+void CAM_Rec_Play(void)
+{
+    if (!Rec.frozen || (Rec.count == 0U))
+    {
+        return;
+    }
+    Rec.play_tick = HAL_GetTick();
+    Rec.play_time = Rec_At(Rec.cursor)->time_ms;
+    Rec.playing = 1U;
+}
+
+const uint8_t* CAM_Rec_ReplayFrame(CAM_RecFrame_t *info)
+{
+    const Rec_Entry_t *e;
+
+    if (!Rec.frozen || (Rec.count == 0U))
+    {
+        return NULL;
+    }
+    if (Rec.playing)
+    {
+        uint32_t elapsed = HAL_GetTick() - Rec.play_tick;
+
+        /* The newest frame already due: the display may skip some, the
+         * pace stays the recorded one */
+        while (((Rec.cursor + 1U) < Rec.count) &&
+                ((Rec_At(Rec.cursor + 1U)->time_ms - Rec.play_time) <= elapsed))
+        {
+            Rec.cursor++;
+        }
+        if ((Rec.cursor + 1U) == Rec.count)
+        {
+            Rec.playing = 0U;
+        }
+    }
+    if (Rec.cursor == Rec.decoded)
+    {
+        return NULL;
+    }
+
+    Rec_DecodeTo(Rec.cursor);
+    e = Rec_At(Rec.cursor);
+    if (info != NULL)
+    {
+        info->seq = e->seq;
+        info->time_ms = e->time_ms;
+        info->width = e->width;
+        info->height = e->height;
+        info->pos = Rec.cursor;
+        info->count = (uint16_t)Rec.count;
+    }
+    return (const uint8_t*)Rec_Frame[2];
+}
+
+void CAM_Rec_GetStats(CAM_RecStats_t *stats)
+{
+    *stats = Rec.stats;
+    stats->frames = Rec.count;
+    stats->cap = Rec.cap;
+    if (Rec.count != 0U)
+    {
+        const Rec_Entry_t *oldest = Rec_At(0U);
+        const Rec_Entry_t *newest = Rec_At(Rec.count - 1U);
+
+        stats->oldest_seq = oldest->seq;
+        stats->newest_seq = newest->seq;
+        stats->span_ms = newest->time_ms - oldest->time_ms;
+    }
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+static void Rec_Clear(void)
+{
+    Rec.first = 0U;
+    Rec.count = 0U;
+    Rec.tail = 0U;
+    Rec.ref_valid = 0U;
+    Rec.since_key = 0U;
+    Rec.cursor = 0U;
+    Rec.decoded = REC_NONE;
+    Rec.playing = 0U;
+    Rec.stats.bytes = 0U;
+    Rec.stats.raw_bytes = 0U;
+}
+
+/* MDMA interrupt: the frame is in the staging buffer, the source is free */
+static void Rec_Staged(HAL_StatusTypeDef status, void *user)
+{
+    UNUSED(user);
+    if (status == HAL_OK)
+    {
+        Rec.state = REC_STAGED;
+    }
+    else
+    {
+        Rec.stats.errors++;
+        Rec.state = REC_IDLE;
+    }
+    if (Rec.release != NULL)
+    {
+        Rec.release();
+    }
+}
+
+/* Staging buffer -> ring, becomes the reference */
+static void Rec_Store(void)
+{
+    Rec_Entry_t *e = &Rec.pending;
+    const uint32_t *stage = Rec_Frame[Rec.ref ^ 1U];
+    const uint32_t *ref = Rec_Frame[Rec.ref];
+    uint32_t bytes = (uint32_t)e->width * e->height * 2U;
+    uint32_t words = bytes / 4U;
+    uint32_t coded = 0U;
+    uint32_t offset;
+    uint32_t *out;
+
+    offset = Rec_Alloc(bytes);
+    if (offset == REC_NO_SPACE)
+    {
+        Rec.stats.errors++;
+        return;
+    }
+    out = &Rec_Pool[offset / 4U];
+
+    /* After the allocation: it may have dropped the frames a delta needs */
+    e->key = ((Rec.mode != CAM_REC_DELTA) || !Rec.ref_valid || (Rec.count == 0U) ||
+            (Rec.since_key + 1U >= Rec.key_interval) ||
+            (Rec_At(Rec.count - 1U)->width != e->width) ||
+            (Rec_At(Rec.count - 1U)->height != e->height)) ? 1U : 0U;
+
+    if (Rec.mode != CAM_REC_RAW)
+    {
+        coded = Rec_Encode(stage, e->key ? NULL : ref, words, out, words);
+    }
+    if (coded != 0U)
+    {
+        e->codec = e->key ? REC_CODEC_RLE : REC_CODEC_DELTA;
+        e->size = coded * 4U;
+    }
+    else
+    {
+        /* Raw, or coding didn't pay off: a key frame either way */
+        memcpy(out, stage, bytes);
+        e->codec = REC_CODEC_RAW;
+        e->key = 1U;
+        e->size = bytes;
+    }
+    e->offset = offset;
+
+    *Rec_At(Rec.count) = *e;
+    Rec.count++;
+    Rec.tail = offset + e->size;
+    Rec.since_key = e->key ? 0U : (Rec.since_key + 1U);
+    Rec.ref ^= 1U;
+    Rec.ref_valid = 1U;
+
+    Rec.stats.bytes += e->size;
+    Rec.stats.raw_bytes += bytes;
+    Rec.stats.recorded++;
+    Rec.stats.keys += e->key;
+}
+
+/* Offset of size free bytes, dropping the oldest frames as needed */
+static uint32_t Rec_Alloc(uint32_t size)
+{
+    if (size > Rec.cap)
+    {
+        return REC_NO_SPACE;
+    }
+    for (;;)
+    {
+        uint32_t head;
+
+        if (Rec.count == 0U)
+        {
+            return 0U;
+        }
+        head = Rec_At(0U)->offset;
+        if (Rec.count < CAM_REC_MAX_FRAMES)
+        {
+            if (Rec.tail > head)
+            {
+                /* Live data in [head, tail) */
+                if ((Rec.cap - Rec.tail) >= size)
+                {
+                    return Rec.tail;
+                }
+                if (head >= size)
+                {
+                    return 0U;
+                }
+            }
+            else if ((head - Rec.tail) >= size)
+            {
+                /* Wrapped: free space in [tail, head) */
+                return Rec.tail;
+            }
+        }
+        Rec_Evict();
+    }
+}
+
+/* Drop the oldest frame and the delta frames depending on it */
+static void Rec_Evict(void)
+{
+    do
+    {
+        const Rec_Entry_t *e = Rec_At(0U);
+
+        Rec.stats.bytes -= e->size;
+        Rec.stats.raw_bytes -= (uint32_t)e->width * e->height * 2U;
+        Rec.first = (Rec.first + 1U) % CAM_REC_MAX_FRAMES;
+        Rec.count--;
+    } while ((Rec.count != 0U) && !Rec_At(0U)->key);
+
+    if (Rec.count == 0U)
+    {
+        Rec.tail = 0U;
+        /* The next frame can't be a delta on nothing */
+        Rec.ref_valid = 0U;
+    }
+}
+
+/* Words written, 0 if more than limit are needed */
+static uint32_t Rec_Encode(const uint32_t *src, const uint32_t *ref, uint32_t words,
+        uint32_t *out, uint32_t limit)
+{
+    uint32_t n = 0U;
+    uint32_t lit = 0U;            /* first word not coded yet */
+    uint32_t i = 0U;
+
+#define REC_VAL(k)                    ((ref != NULL) ? (src[k] ^ ref[k]) : src[k])
+
+    while (i < words)
+    {
+        uint32_t v = REC_VAL(i);
+        uint32_t j = i + 1U;
+
+        while ((j < words) && (REC_VAL(j) == v))
+        {
+            j++;
+        }
+        if ((j - i) >= CAM_REC_MIN_RUN)
+        {
+            if ((n + 3U + (i - lit)) > limit)
+            {
+                return 0U;
+            }
+            if (lit < i)
+            {
+                out[n++] = i - lit;
+                for (; lit < i; lit++)
+                {
+                    out[n++] = REC_VAL(lit);
+                }
+            }
+            out[n++] = REC_RUN | (j - i);
+            out[n++] = v;
+            lit = j;
+        }
+        i = j;
+    }
+    if (lit < words)
+    {
+        if ((n + 1U + (words - lit)) > limit)
+        {
+            return 0U;
+        }
+        out[n++] = words - lit;
+        for (; lit < words; lit++)
+        {
+            out[n++] = REC_VAL(lit);
+        }
+    }
+
+#undef REC_VAL
+
+    return n;
+}
+
+static void Rec_Decode(const uint32_t *in, uint32_t *dst, uint32_t words, uint8_t delta)
+{
+    uint32_t i = 0U;
+
+    while (i < words)
+    {
+        uint32_t t = *in++;
+        uint32_t n = t & ~REC_RUN;
+
+        if ((n == 0U) || (n > (words - i)))
+        {
+            break;
+        }
+        if (t & REC_RUN)
+        {
+            uint32_t v = *in++;
+
+            if (!delta)
+            {
+                for (uint32_t k = 0U; k < n; k++)
+                {
+                    dst[i + k] = v;
+                }
+            }
+            else if (v != 0U)
+            {
+                for (uint32_t k = 0U; k < n; k++)
+                {
+                    dst[i + k] ^= v;
+                }
+            }
+        }
+        else if (!delta)
+        {
+            memcpy(&dst[i], in, n * 4U);
+            in += n;
+        }
+        else
+        {
+            for (uint32_t k = 0U; k < n; k++)
+            {
+                dst[i + k] ^= *in++;
+            }
+        }
+        i += n;
+    }
+}
+
+/* Replay buffer <- frame at pos, from its key frame or from the frame
+ * decoded last when that is on the way */
+static void Rec_DecodeTo(uint32_t pos)
+{
+    uint32_t key = pos;
+    uint32_t from;
+
+    while ((key > 0U) && !Rec_At(key)->key)
+    {
+        key--;
+    }
+    from = ((Rec.decoded != REC_NONE) && (Rec.decoded >= key) && (Rec.decoded < pos)) ?
+            (Rec.decoded + 1U) : key;
+
+    for (uint32_t p = from; p <= pos; p++)
+    {
+        const Rec_Entry_t *e = Rec_At(p);
+        const uint32_t *in = &Rec_Pool[e->offset / 4U];
+        uint32_t words = (uint32_t)e->width * e->height / 2U;
+
+        if (e->codec == REC_CODEC_RAW)
+        {
+            memcpy(Rec_Frame[2], in, words * 4U);
+        }
+        else
+        {
+            Rec_Decode(in, Rec_Frame[2], words, (e->codec == REC_CODEC_DELTA) ? 1U : 0U);
+        }
+    }
+    Rec.decoded = (uint16_t)pos;
+}
+
+static inline Rec_Entry_t* Rec_At(uint32_t pos)
+{
+    return &Rec.entry[(Rec.first + pos) % CAM_REC_MAX_FRAMES];
+}
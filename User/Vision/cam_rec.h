@@ -0,0 +1,128 @@
+/*
+ * cam_rec.h
+ * Recording ring of the last captured frames in SDRAM, with replay
+ *
+ * Off until enabled. Every captured frame is copied by the MDMA into a
+ * staging buffer, started from the frame callback (a few microseconds of
+ * CPU); the caller keeps the capture stopped until the release callback,
+ * called from the MDMA completion interrupt, so the next frame can't
+ * overwrite the frame being copied. The coding into the ring runs in the
+ * main loop, CAM_Rec_Task(), and leaves the MDMA free meanwhile. A frame
+ * arriving while the previous one is still being stored is skipped and
+ * counted.
+ *
+ * Frames are stored raw, word RLE coded, or (CAM_REC_DELTA) as the RLE of
+ * their XOR with the previous recorded frame with a key frame every
+ * key_interval frames; a frame that doesn't shrink is stored raw. When the
+ * ring is full the oldest frames are dropped, a delta frame never outlives
+ * its key frame.
+ *
+ * Freeze stops the recording and hands the display over to the replay:
+ * CAM_Rec_ReplayFrame() decodes the frame at the cursor, which moves with
+ * Seek() or by itself with Play(), following the recorded timestamps.
+ */
+
+#ifndef CAM_REC_H_
+#define CAM_REC_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* SDRAM reserved for the ring, the runtime cap can only be lower */
+#define CAM_REC_POOL_BYTES                       (6U * 1024U * 1024U)
+/* Largest frame (QVGA RGB565) and frames indexed */
+#define CAM_REC_MAX_FRAME_BYTES                  (320U * 240U * 2U)
+#define CAM_REC_MAX_FRAMES                       (512U)
+
+/* Defaults for CAM_Rec_Config() */
+#define CAM_REC_DEF_MODE                         CAM_REC_DELTA
+#define CAM_REC_DEF_CAP_BYTES                    CAM_REC_POOL_BYTES
+#define CAM_REC_DEF_KEY_INTERVAL                 (16U)
+
+/* Shortest repeat worth a run token (words) */
+#define CAM_REC_MIN_RUN                          (3U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef enum
+{
+    CAM_REC_RAW = 0,
+    CAM_REC_RLE,
+    CAM_REC_DELTA,
+} CAM_RecMode_t;
+
+typedef struct
+{
+    uint32_t seq;                 /* capture sequence number */
+    uint32_t time_ms;             /* HAL_GetTick() at the capture */
+    uint16_t width;
+    uint16_t height;
+    uint16_t pos;                 /* 0 = oldest frame in the ring */
+    uint16_t count;
+} CAM_RecFrame_t;
+
+typedef struct
+{
+    uint32_t frames;              /* in the ring */
+    uint32_t bytes;               /* ring payload in use */
+    uint32_t raw_bytes;           /* the same frames uncompressed */
+    uint32_t cap;
+    uint32_t oldest_seq;
+    uint32_t newest_seq;
+    uint32_t span_ms;             /* oldest to newest capture */
+    uint32_t recorded;            /* since the init */
+    uint32_t keys;
+    uint32_t skipped;             /* recorder or MDMA busy at the capture */
+    uint32_t errors;
+    uint32_t store_us;            /* last frame, CAM_Rec_Task() */
+} CAM_RecStats_t;
+
+/* The frame buffer may be refilled, called from the MDMA interrupt */
+typedef void (*CAM_RecRelease_t)(void);
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Needs BSP_MDMA_Init() */
+extern void CAM_Rec_Init(void);
+/* Clears the ring; cap_bytes is clamped to CAM_REC_POOL_BYTES */
+extern void CAM_Rec_Config(CAM_RecMode_t mode, uint32_t cap_bytes, uint8_t key_interval);
+extern void CAM_Rec_Enable(uint8_t enable);
+extern uint8_t CAM_Rec_isEnabled(void);
+
+/* Call from the frame ready callback, width * 2 must be a multiple of 4.
+ * 1 if the frame is being copied: it must stay in place until release is
+ * called; 0 if it isn't recorded, release isn't called. */
+extern uint8_t CAM_Rec_Capture(const uint8_t *frame, uint16_t width, uint16_t height,
+        uint32_t seq, CAM_RecRelease_t release);
+/* Main loop: stores the staged frame */
+extern void CAM_Rec_Task(void);
+
+/* Stop recording, the cursor goes to the newest frame */
+extern void CAM_Rec_Freeze(void);
+/* Back to live, the recording goes on */
+extern void CAM_Rec_Live(void);
+extern uint8_t CAM_Rec_isFrozen(void);
+/* Move the cursor by frames (negative = back), stops the playback */
+extern void CAM_Rec_Seek(int32_t frames);
+/* Play from the cursor at the recorded pace, stops at the newest frame */
+extern void CAM_Rec_Play(void);
+
+/* Main loop, while frozen and the display path is free: the frame to show
+ * when the cursor moved since the last call, NULL otherwise. The buffer
+ * stays valid until the next call. */
+extern const uint8_t* CAM_Rec_ReplayFrame(CAM_RecFrame_t *info);
+
+extern void CAM_Rec_GetStats(CAM_RecStats_t *stats);
+
+#endif /* CAM_REC_H_ */
@@ -0,0 +1,309 @@
+/*
+ * cam_stats.c
+ * Single pass RGB565 frame statistics
+ *
+ * The frame is walked once, four pixels (two words) at a time:
+ *  - channel fields of both pixels of a word are extracted in parallel and
+ *    summed in 16 bit lanes (UADD16), flushed to 32 bit sums every line;
+ *  - channel min/max run on packed bytes (USUB8 + SEL);
+ *  - luma is looked up from the shared high/low byte tables, four luma
+ *    bytes are packed into one word for the zone sums (USADA8 against
+ *    zero) and the luma min/max.
+ * Only the histogram update is inherently one pixel at a time.
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "cam_stats.h"
+#include "vision_simd.h"
+#include "vision_luma.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+/* Keep the compiler from moving the published sequence number around */
+#define STATS_BARRIER()               __asm volatile ("" ::: "memory")
+
+/******************************************************************************
+ *                           LOCAL DATA TYPES                                 *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint32_t sum_r;
+    uint32_t sum_g;
+    uint32_t sum_b;
+    uint32_t max_y;               /* packed bytes, reduced at the end */
+    uint32_t min_y;
+    uint32_t max_rb;              /* bytes: r, b, r, b */
+    uint32_t min_rb;
+    uint32_t max_g;               /* bytes: g, g, g, g */
+    uint32_t min_g;
+} Stats_Acc_t;
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    volatile uint8_t enabled;
+    volatile uint8_t front;       /* index of the published result */
+    CAM_Stats_t result[2];
+} Stats;
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static void Stats_Pixel(CAM_Stats_t *out, Stats_Acc_t *acc, uint16_t px, uint32_t *zacc);
+static uint8_t Stats_ReduceMax(uint32_t packed, uint32_t mask);
+static uint8_t Stats_ReduceMin(uint32_t packed, uint32_t mask);
+static uint8_t Stats_Mean(uint32_t sum, uint32_t n, uint32_t full_scale);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void CAM_Stats_Init(void)
+{
+    VISION_LumaInit();
+    memset(Stats.result, 0, sizeof(Stats.result));
+    Stats.front = 0U;
+    VISION_CyclesInit();
+}
+
+void CAM_Stats_Enable(uint8_t enable)
+{
+    Stats.enabled = enable ? 1U : 0U;
+}
+
+uint8_t CAM_Stats_isEnabled(void)
+{
+    return Stats.enabled;
+}
+
+uint8_t CAM_Stats_Luma(uint16_t rgb565)
+{
+    return (uint8_t)VISION_LUMA(rgb565);
+}
+
+void CAM_Stats_Process(const uint8_t *frame, uint16_t width, uint16_t height, uint32_t seq)
+{
+    uint32_t start = VISION_CYCLES();
+    uint32_t xb[CAM_STATS_ZONES_X + 1U];
+    uint32_t zrow[CAM_STATS_ZONES_X];
+    uint32_t zy = 0U;
+    uint32_t zrows = 0U;
+    uint32_t sum_y = 0U;
+    Stats_Acc_t acc;
+    CAM_Stats_t *out;
+
+    /* Word access needs even line lengths */
+    if (!Stats.enabled || (frame == NULL) || (width < 4U) || (height == 0U) ||
+            (width & 1U) || (width > CAM_STATS_MAX_WIDTH))
+    {
+        return;
+    }
+
+    out = &Stats.result[Stats.front ^ 1U];
+    out->seq = 0U;
+    STATS_BARRIER();
+
+    memset(out->hist, 0, sizeof(out->hist));
+    memset(out->zone, 0, sizeof(out->zone));
+    memset(zrow, 0, sizeof(zrow));
+    memset(&acc, 0, sizeof(acc));
+    acc.min_y = 0xFFFFFFFFU;
+    acc.min_rb = 0xFFFFFFFFU;
+    acc.min_g = 0xFFFFFFFFU;
+
+    /* Zone columns start on a 4 pixel boundary, the last one takes the rest */
+    for (uint32_t zx = 0U; zx < CAM_STATS_ZONES_X; zx++)
+    {
+        xb[zx] = ((zx * width) / CAM_STATS_ZONES_X) & ~3U;
+    }
+    xb[CAM_STATS_ZONES_X] = width;
+
+    for (uint32_t y = 0U; y < height; y++)
+    {
+        const uint16_t *line = (const uint16_t*)(frame + (y * width * 2U));
+        uint32_t racc = 0U;
+        uint32_t gacc = 0U;
+        uint32_t bacc = 0U;
+
+        for (uint32_t zx = 0U; zx < CAM_STATS_ZONES_X; zx++)
+        {
+            uint32_t x = xb[zx];
+            uint32_t zacc = 0U;
+
+            for (; (x + 4U) <= xb[zx + 1U]; x += 4U)
+            {
+                uint32_t w0 = *(const uint32_t*)&line[x];
+                uint32_t w1 = *(const uint32_t*)&line[x + 2U];
+                uint32_t r0 = (w0 >> 11) & 0x001F001FU;
+                uint32_t r1 = (w1 >> 11) & 0x001F001FU;
+                uint32_t g0 = (w0 >> 5) & 0x003F003FU;
+                uint32_t g1 = (w1 >> 5) & 0x003F003FU;
+                uint32_t b0 = w0 & 0x001F001FU;
+                uint32_t b1 = w1 & 0x001F001FU;
+                uint32_t l0, l1, l2, l3, yw;
+
+                racc = VISION_UADD16(racc, VISION_UADD16(r0, r1));
+                gacc = VISION_UADD16(gacc, VISION_UADD16(g0, g1));
+                bacc = VISION_UADD16(bacc, VISION_UADD16(b0, b1));
+
+                r0 |= b0 << 8;
+                r1 |= b1 << 8;
+                g0 |= g1 << 8;
+                acc.max_rb = VISION_UMAX8(acc.max_rb, VISION_UMAX8(r0, r1));
+                acc.min_rb = VISION_UMIN8(acc.min_rb, VISION_UMIN8(r0, r1));
+                acc.max_g = VISION_UMAX8(acc.max_g, g0);
+                acc.min_g = VISION_UMIN8(acc.min_g, g0);
+
+                l0 = VISION_LUMA(w0);
+                l1 = VISION_LUMA(w0 >> 16);
+                l2 = VISION_LUMA(w1);
+                l3 = VISION_LUMA(w1 >> 16);
+                out->hist[l0]++;
+                out->hist[l1]++;
+                out->hist[l2]++;
+                out->hist[l3]++;
+
+                yw = l0 | (l1 << 8) | (l2 << 16) | (l3 << 24);
+                zacc = VISION_USADA8(yw, 0U, zacc);
+                acc.max_y = VISION_UMAX8(acc.max_y, yw);
+                acc.min_y = VISION_UMIN8(acc.min_y, yw);
+            }
+            for (; x < xb[zx + 1U]; x++)
+            {
+                Stats_Pixel(out, &acc, line[x], &zacc);
+            }
+            zrow[zx] += zacc;
+        }
+
+        acc.sum_r += (racc & 0xFFFFU) + (racc >> 16);
+        acc.sum_g += (gacc & 0xFFFFU) + (gacc >> 16);
+        acc.sum_b += (bacc & 0xFFFFU) + (bacc >> 16);
+
+        /* Close the zone row when the next line belongs to the next one */
+        zrows++;
+        if ((y + 1U == height) || ((((y + 1U) * CAM_STATS_ZONES_Y) / height) != zy))
+        {
+            for (uint32_t zx = 0U; zx < CAM_STATS_ZONES_X; zx++)
+            {
+                uint32_t n = (xb[zx + 1U] - xb[zx]) * zrows;
+                sum_y += zrow[zx];
+                out->zone[zy][zx] = (n != 0U) ? (uint8_t)((zrow[zx] + (n / 2U)) / n) : 0U;
+                zrow[zx] = 0U;
+            }
+            zrows = 0U;
+            zy = ((y + 1U) * CAM_STATS_ZONES_Y) / height;
+        }
+    }
+
+    out->pixels = (uint32_t)width * height;
+    out->mean_y = Stats_Mean(sum_y, out->pixels, 255U);
+    out->min_y = Stats_ReduceMin(acc.min_y, 0xFFFFFFFFU);
+    out->max_y = Stats_ReduceMax(acc.max_y, 0xFFFFFFFFU);
+    out->mean_r = Stats_Mean(acc.sum_r, out->pixels, 31U);
+    out->min_r = VISION_EXPAND5(Stats_ReduceMin(acc.min_rb, 0x00FF00FFU));
+    out->max_r = VISION_EXPAND5(Stats_ReduceMax(acc.max_rb, 0x00FF00FFU));
+    out->mean_g = Stats_Mean(acc.sum_g, out->pixels, 63U);
+    out->min_g = VISION_EXPAND6(Stats_ReduceMin(acc.min_g, 0xFFFFFFFFU));
+    out->max_g = VISION_EXPAND6(Stats_ReduceMax(acc.max_g, 0xFFFFFFFFU));
+    out->mean_b = Stats_Mean(acc.sum_b, out->pixels, 31U);
+    out->min_b = VISION_EXPAND5(Stats_ReduceMin(acc.min_rb, 0xFF00FF00U));
+    out->max_b = VISION_EXPAND5(Stats_ReduceMax(acc.max_rb, 0xFF00FF00U));
+    out->cycles = VISION_CYCLES() - start;
+
+    STATS_BARRIER();
+    out->seq = seq;
+    STATS_BARRIER();
+    Stats.front ^= 1U;
+}
+
+uint32_t CAM_Stats_Get(CAM_Stats_t *stats)
+{
+    uint8_t front;
+
+    /* The writer runs from the DCMI interrupt: retry if it republished
+     * into the slot being copied */
+    do
+    {
+        front = Stats.front;
+        STATS_BARRIER();
+        memcpy(stats, &Stats.result[front], sizeof(CAM_Stats_t));
+        STATS_BARRIER();
+    } while ((*(volatile uint32_t*)&Stats.result[front].seq) != stats->seq);
+
+    return stats->seq;
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+/* Leftover pixel of a zone which is not a multiple of 4 pixels wide */
+static void Stats_Pixel(CAM_Stats_t *out, Stats_Acc_t *acc, uint16_t px, uint32_t *zacc)
+{
+    uint32_t r = px >> 11;
+    uint32_t g = (px >> 5) & 0x3FU;
+    uint32_t b = px & 0x1FU;
+    uint32_t l = VISION_LUMA(px);
+    /* Replicate into every lane so the packed min/max stay valid */
+    uint32_t rb = (r | (b << 8)) * 0x00010001U;
+
+    acc->sum_r += r;
+    acc->sum_g += g;
+    acc->sum_b += b;
+    acc->max_rb = VISION_UMAX8(acc->max_rb, rb);
+    acc->min_rb = VISION_UMIN8(acc->min_rb, rb);
+    acc->max_g = VISION_UMAX8(acc->max_g, g * 0x01010101U);
+    acc->min_g = VISION_UMIN8(acc->min_g, g * 0x01010101U);
+    acc->max_y = VISION_UMAX8(acc->max_y, l * 0x01010101U);
+    acc->min_y = VISION_UMIN8(acc->min_y, l * 0x01010101U);
+    out->hist[l]++;
+    *zacc += l;
+}
+
+/* Largest byte of the lanes selected by mask */
+static uint8_t Stats_ReduceMax(uint32_t packed, uint32_t mask)
+{
+    uint8_t m = 0U;
+
+    for (uint32_t s = 0U; s < 32U; s += 8U)
+    {
+        if (((mask >> s) & 0xFFU) && (((packed >> s) & 0xFFU) > m))
+        {
+            m = (uint8_t)(packed >> s);
+        }
+    }
+    return m;
+}
+
+static uint8_t Stats_ReduceMin(uint32_t packed, uint32_t mask)
+{
+    uint8_t m = 0xFFU;
+
+    for (uint32_t s = 0U; s < 32U; s += 8U)
+    {
+        if (((mask >> s) & 0xFFU) && (((packed >> s) & 0xFFU) < m))
+        {
+            m = (uint8_t)(packed >> s);
+        }
+    }
+    return m;
+}
+
+/* Mean rescaled from 0..full_scale to 0..255 */
+static uint8_t Stats_Mean(uint32_t sum, uint32_t n, uint32_t full_scale)
+{
+    uint64_t den = (uint64_t)n * full_scale;
+
+    return (uint8_t)((((uint64_t)sum * 255U) + (den / 2U)) / den);
+}
@@ -0,0 +1,71 @@
+/*
+ * cam_stats.h
+ * Single pass RGB565 frame statistics
+ *
+ * One walk over the frame produces the 256 bin luma histogram, per channel
+ * means and min/max and a grid of zone luma means. Results are double
+ * buffered and tagged with the frame sequence number they belong to.
+ */
+
+#ifndef CAM_STATS_H_
+#define CAM_STATS_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Zone grid (columns x rows) */
+#define CAM_STATS_ZONES_X                        (8U)
+#define CAM_STATS_ZONES_Y                        (6U)
+/* Packed per line channel sums stay in 16 bit lanes up to this width */
+#define CAM_STATS_MAX_WIDTH                      (2048U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef struct
+{
+    uint32_t seq;                 /* frame sequence number, 0 = nothing yet */
+    uint32_t pixels;              /* pixels accounted in the histogram */
+    uint32_t cycles;              /* CPU cycles spent on this frame */
+    uint32_t hist[256];           /* luma histogram */
+    uint8_t  mean_y;              /* all values are 8 bit (RGB565 expanded) */
+    uint8_t  min_y;
+    uint8_t  max_y;
+    uint8_t  mean_r;
+    uint8_t  min_r;
+    uint8_t  max_r;
+    uint8_t  mean_g;
+    uint8_t  min_g;
+    uint8_t  max_g;
+    uint8_t  mean_b;
+    uint8_t  min_b;
+    uint8_t  max_b;
+    uint8_t  zone[CAM_STATS_ZONES_Y][CAM_STATS_ZONES_X];   /* mean luma */
+} CAM_Stats_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+extern void CAM_Stats_Init(void);
+extern void CAM_Stats_Enable(uint8_t enable);
+extern uint8_t CAM_Stats_isEnabled(void);
+
+/* Call from the frame ready callback while the frame is still untouched */
+extern void CAM_Stats_Process(const uint8_t *frame, uint16_t width, uint16_t height, uint32_t seq);
+
+/* Copy of the last published result, returns its sequence number (0 = none) */
+extern uint32_t CAM_Stats_Get(CAM_Stats_t *stats);
+
+/* 8 bit luma of one RGB565 pixel, same rounding as the histogram */
+extern uint8_t CAM_Stats_Luma(uint16_t rgb565);
+
+#endif /* CAM_STATS_H_ */
@@ -0,0 +1,966 @@
+/*
+ * vision_color.c
+ * Pixel format conversion: RGB565, byte swapped RGB565, RGB888, ARGB8888,
+ * YUV422 and 8 bit gray
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+#include "vision_color.h"
+#include "vision_simd.h"
+#include "vision_luma.h"
+
+#if VISION_HAVE_DSP && defined(DMA2D)
+#include "BSP_DMA2D.h"
+#define COLOR_HAVE_DMA2D              (1)
+#else
+#define COLOR_HAVE_DMA2D              (0)
+#endif
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+/* Pixels per ARGB8888 chunk of the two step path (even: YUV pairs) */
+#define COLOR_CHUNK                   (64U)
+
+#define COLOR_OPAQUE                  (0xFF000000U)
+
+#define COLOR_INLINE                  static inline __attribute__((always_inline))
+
+/******************************************************************************
+ *                           LOCAL DATA TYPES                                 *
+ ******************************************************************************/
+
+/* n pixels of one line */
+typedef void (*Color_Line_t)(const uint8_t *src, uint8_t *dst, uint32_t n);
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static const uint8_t ColorBpp[VISION_COLOR_FORMATS] = { 2U, 2U, 3U, 4U, 2U, 1U };
+
+static VISION_ColorStats_t ColorStats;
+static uint8_t ColorReady;
+
+#if COLOR_HAVE_DMA2D
+/* L8 to gray */
+static uint32_t ColorGrayClut[256];
+#endif
+
+/******************************************************************************
+ *                            INLINE HELPERS                                  *
+ ******************************************************************************/
+
+COLOR_INLINE uint32_t Luma8(uint32_t r, uint32_t g, uint32_t b)
+{
+    return (77U * r + 150U * g + 29U * b + 128U) >> 8;
+}
+
+COLOR_INLINE uint32_t Argb(uint32_t r, uint32_t g, uint32_t b)
+{
+    return COLOR_OPAQUE | (r << 16) | (g << 8) | b;
+}
+
+/* Two RGB565 pixels (one word) to two ARGB8888 pixels, channels expanded in
+ * both 16 bit lanes at once */
+COLOR_INLINE void Expand2(uint32_t w, uint32_t *p0, uint32_t *p1)
+{
+    uint32_t r = (w >> 11) & 0x001F001FU;
+    uint32_t g = (w >> 5) & 0x003F003FU;
+    uint32_t b = w & 0x001F001FU;
+
+    r = (r << 3) | ((r >> 2) & 0x00070007U);
+    g = (g << 2) | ((g >> 4) & 0x00030003U);
+    b = (b << 3) | ((b >> 2) & 0x00070007U);
+    *p0 = COLOR_OPAQUE | VISION_PKLO(b, r) | ((g & 0xFFU) << 8);
+    *p1 = COLOR_OPAQUE | VISION_PKHI(b, r) | ((g >> 8) & 0xFF00U);
+}
+
+COLOR_INLINE uint32_t Expand1(uint32_t px)
+{
+    return Argb(VISION_EXPAND5(px >> 11), VISION_EXPAND6((px >> 5) & 0x3FU),
+            VISION_EXPAND5(px & 0x1FU));
+}
+
+COLOR_INLINE uint32_t Reduce1(uint32_t p)
+{
+    return ((p >> 8) & 0xF800U) | ((p >> 5) & 0x07E0U) | ((p >> 3) & 0x001FU);
+}
+
+/* Gray pixels in the two lanes of 'lanes' to RGB565 in the same lanes */
+COLOR_INLINE uint32_t Gray2To565(uint32_t lanes)
+{
+    uint32_t r5 = (lanes >> 3) & 0x001F001FU;
+    uint32_t g6 = (lanes >> 2) & 0x003F003FU;
+
+    return (r5 << 11) | (g6 << 5) | r5;
+}
+
+/* Chroma terms of a YUV pair; G uses one dual MAC */
+COLOR_INLINE void Chroma(uint32_t u, uint32_t v, int32_t *rv, int32_t *gc, int32_t *bu)
+{
+    int32_t du = (int32_t)u - 128;
+    int32_t dv = (int32_t)v - 128;
+
+    *rv = (359 * dv + 128) >> 8;
+    *gc = (VISION_SMUAD(VISION_PACK16(du, dv), VISION_PACK16(88, 183)) + 128) >> 8;
+    *bu = (454 * du + 128) >> 8;
+}
+
+COLOR_INLINE uint32_t YuvArgb(uint32_t y, int32_t rv, int32_t gc, int32_t bu)
+{
+    return Argb(VISION_USAT8((int32_t)y + rv), VISION_USAT8((int32_t)y - gc),
+            VISION_USAT8((int32_t)y + bu));
+}
+
+COLOR_INLINE uint32_t Yuv565(uint32_t y, int32_t rv, int32_t gc, int32_t bu)
+{
+    return ((VISION_USAT8((int32_t)y + rv) >> 3) << 11) |
+           ((VISION_USAT8((int32_t)y - gc) >> 2) << 5) |
+           (VISION_USAT8((int32_t)y + bu) >> 3);
+}
+
+/* Y0 U Y1 V word from the luma and the summed channels of a pixel pair */
+COLOR_INLINE uint32_t YuvPack(uint32_t y0, uint32_t y1, uint32_t r2, uint32_t g2, uint32_t b2)
+{
+    uint32_t ra = (r2 + 1U) >> 1;
+    uint32_t ga = (g2 + 1U) >> 1;
+    uint32_t ba = (b2 + 1U) >> 1;
+    uint32_t rg = VISION_PACK16(ra, ga);
+    int32_t u = ((VISION_SMUAD(rg, VISION_PACK16(-43, -85)) + 128 * (int32_t)ba + 128) >> 8) + 128;
+    int32_t v = ((VISION_SMUAD(rg, VISION_PACK16(128, -107)) - 21 * (int32_t)ba + 128) >> 8) + 128;
+
+    return y0 | (VISION_USAT8(u) << 8) | (y1 << 16) | (VISION_USAT8(v) << 24);
+}
+
+COLOR_INLINE uint32_t YuvPackArgb(uint32_t p0, uint32_t p1)
+{
+    uint32_t r0 = (p0 >> 16) & 0xFFU, g0 = (p0 >> 8) & 0xFFU, b0 = p0 & 0xFFU;
+    uint32_t r1 = (p1 >> 16) & 0xFFU, g1 = (p1 >> 8) & 0xFFU, b1 = p1 & 0xFFU;
+
+    return YuvPack(Luma8(r0, g0, b0), Luma8(r1, g1, b1), r0 + r1, g0 + g1, b0 + b1);
+}
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static void ColorInit(void);
+static void RefDecode(VISION_ColorFormat_t format, const uint8_t *line, uint32_t x,
+        uint32_t *r, uint32_t *g, uint32_t *b, uint32_t *a);
+static void RefEncode(VISION_ColorFormat_t format, uint8_t *p,
+        uint32_t r, uint32_t g, uint32_t b, uint32_t a);
+static Color_Line_t GetLine(VISION_ColorFormat_t src_format, VISION_ColorFormat_t dst_format);
+static void LineChunked(const uint8_t *src, VISION_ColorFormat_t src_format,
+        uint8_t *dst, VISION_ColorFormat_t dst_format, uint32_t n);
+static uint8_t CheckGeometry(VISION_ColorFormat_t src_format, VISION_ColorFormat_t dst_format,
+        uint16_t width);
+#if COLOR_HAVE_DMA2D
+static uint8_t Dma2dModes(VISION_ColorFormat_t src_format, VISION_ColorFormat_t dst_format,
+        BSP_DMA2D_Pfc_t *pfc);
+#endif
+
+/******************************************************************************
+ *                              LINE KERNELS                                  *
+ ******************************************************************************/
+
+static void Line_Copy2(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    memcpy(d, s, n * 2U);
+}
+
+/* RGB565 <-> byte swapped RGB565, two pixels per REV16 */
+static void Line_Swap(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0U; i + 2U <= n; i += 2U)
+    {
+        VISION_STORE32(d + i * 2U, VISION_REV16(VISION_LOAD32(s + i * 2U)));
+    }
+    if (i < n)
+    {
+        d[i * 2U] = s[i * 2U + 1U];
+        d[i * 2U + 1U] = s[i * 2U];
+    }
+}
+
+static void Line_565_Argb(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    uint32_t *o = (uint32_t*)(void*)d;
+    uint32_t i, p0, p1;
+
+    for (i = 0U; i + 2U <= n; i += 2U)
+    {
+        Expand2(VISION_LOAD32(s + i * 2U), &p0, &p1);
+        VISION_STORE32(&o[i], p0);
+        VISION_STORE32(&o[i + 1U], p1);
+    }
+    if (i < n)
+    {
+        VISION_STORE32(&o[i], Expand1((uint32_t)s[i * 2U] | ((uint32_t)s[i * 2U + 1U] << 8)));
+    }
+}
+
+static void Line_565S_Argb(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    uint32_t *o = (uint32_t*)(void*)d;
+    uint32_t i, p0, p1;
+
+    for (i = 0U; i + 2U <= n; i += 2U)
+    {
+        Expand2(VISION_REV16(VISION_LOAD32(s + i * 2U)), &p0, &p1);
+        VISION_STORE32(&o[i], p0);
+        VISION_STORE32(&o[i + 1U], p1);
+    }
+    if (i < n)
+    {
+        VISION_STORE32(&o[i], Expand1(((uint32_t)s[i * 2U] << 8) | s[i * 2U + 1U]));
+    }
+}
+
+static void Line_888_Argb(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    uint32_t *o = (uint32_t*)(void*)d;
+    uint32_t i;
+
+    /* Four pixels from three words */
+    for (i = 0U; i + 4U <= n; i += 4U)
+    {
+        uint32_t w0 = VISION_LOAD32(s);
+        uint32_t w1 = VISION_LOAD32(s + 4U);
+        uint32_t w2 = VISION_LOAD32(s + 8U);
+
+        VISION_STORE32(&o[i], COLOR_OPAQUE | w0);
+        VISION_STORE32(&o[i + 1U], COLOR_OPAQUE | (w0 >> 24) | (w1 << 8));
+        VISION_STORE32(&o[i + 2U], COLOR_OPAQUE | (w1 >> 16) | (w2 << 16));
+        VISION_STORE32(&o[i + 3U], COLOR_OPAQUE | (w2 >> 8));
+        s += 12U;
+    }
+    for (; i < n; i++)
+    {
+        VISION_STORE32(&o[i], Argb(s[2], s[1], s[0]));
+        s += 3U;
+    }
+}
+
+static void Line_Copy4(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    memcpy(d, s, n * 4U);
+}
+
+static void Line_Yuv_Argb(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    uint32_t *o = (uint32_t*)(void*)d;
+
+    for (uint32_t i = 0U; i < n; i += 2U)
+    {
+        uint32_t w = VISION_LOAD32(s + i * 2U);
+        int32_t rv, gc, bu;
+
+        Chroma((w >> 8) & 0xFFU, w >> 24, &rv, &gc, &bu);
+        VISION_STORE32(&o[i], YuvArgb(w & 0xFFU, rv, gc, bu));
+        VISION_STORE32(&o[i + 1U], YuvArgb((w >> 16) & 0xFFU, rv, gc, bu));
+    }
+}
+
+static void Line_Gray_Argb(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    uint32_t *o = (uint32_t*)(void*)d;
+
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        VISION_STORE32(&o[i], COLOR_OPAQUE | (s[i] * 0x010101U));
+    }
+}
+
+static void Line_Argb_565(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    const uint32_t *p = (const uint32_t*)(const void*)s;
+    uint32_t i;
+
+    for (i = 0U; i + 2U <= n; i += 2U)
+    {
+        VISION_STORE32(d + i * 2U, Reduce1(VISION_LOAD32(&p[i])) |
+                (Reduce1(VISION_LOAD32(&p[i + 1U])) << 16));
+    }
+    if (i < n)
+    {
+        uint32_t px = Reduce1(VISION_LOAD32(&p[i]));
+        d[i * 2U] = (uint8_t)px;
+        d[i * 2U + 1U] = (uint8_t)(px >> 8);
+    }
+}
+
+static void Line_Argb_565S(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    const uint32_t *p = (const uint32_t*)(const void*)s;
+    uint32_t i;
+
+    for (i = 0U; i + 2U <= n; i += 2U)
+    {
+        VISION_STORE32(d + i * 2U, VISION_REV16(Reduce1(VISION_LOAD32(&p[i])) |
+                (Reduce1(VISION_LOAD32(&p[i + 1U])) << 16)));
+    }
+    if (i < n)
+    {
+        uint32_t px = Reduce1(VISION_LOAD32(&p[i]));
+        d[i * 2U] = (uint8_t)(px >> 8);
+        d[i * 2U + 1U] = (uint8_t)px;
+    }
+}
+
+static void Line_Argb_888(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    const uint32_t *p = (const uint32_t*)(const void*)s;
+    uint32_t i;
+
+    /* Four pixels into three words */
+    for (i = 0U; i + 4U <= n; i += 4U)
+    {
+        uint32_t p0 = VISION_LOAD32(&p[i]) & 0x00FFFFFFU;
+        uint32_t p1 = VISION_LOAD32(&p[i + 1U]) & 0x00FFFFFFU;
+        uint32_t p2 = VISION_LOAD32(&p[i + 2U]) & 0x00FFFFFFU;
+        uint32_t p3 = VISION_LOAD32(&p[i + 3U]);
+
+        VISION_STORE32(d, p0 | (p1 << 24));
+        VISION_STORE32(d + 4U, (p1 >> 8) | (p2 << 16));
+        VISION_STORE32(d + 8U, (p2 >> 16) | (p3 << 8));
+        d += 12U;
+    }
+    for (; i < n; i++)
+    {
+        uint32_t px = VISION_LOAD32(&p[i]);
+        d[0] = (uint8_t)px;
+        d[1] = (uint8_t)(px >> 8);
+        d[2] = (uint8_t)(px >> 16);
+        d += 3U;
+    }
+}
+
+static void Line_Argb_Yuv(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    const uint32_t *p = (const uint32_t*)(const void*)s;
+
+    for (uint32_t i = 0U; i < n; i += 2U)
+    {
+        VISION_STORE32(d + i * 2U, YuvPackArgb(VISION_LOAD32(&p[i]), VISION_LOAD32(&p[i + 1U])));
+    }
+}
+
+static void Line_Argb_Gray(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    const uint32_t *p = (const uint32_t*)(const void*)s;
+
+    for (uint32_t i = 0U; i < n; i++)
+    {
+        uint32_t px = VISION_LOAD32(&p[i]);
+        d[i] = (uint8_t)Luma8((px >> 16) & 0xFFU, (px >> 8) & 0xFFU, px & 0xFFU);
+    }
+}
+
+static void Line_565_888(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    uint32_t i, p[4];
+
+    for (i = 0U; i + 4U <= n; i += 4U)
+    {
+        Expand2(VISION_LOAD32(s + i * 2U), &p[0], &p[1]);
+        Expand2(VISION_LOAD32(s + i * 2U + 4U), &p[2], &p[3]);
+        Line_Argb_888((const uint8_t*)p, d + i * 3U, 4U);
+    }
+    for (; i < n; i++)
+    {
+        p[0] = Expand1((uint32_t)s[i * 2U] | ((uint32_t)s[i * 2U + 1U] << 8));
+        Line_Argb_888((const uint8_t*)p, d + i * 3U, 1U);
+    }
+}
+
+static void Line_888_565(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0U; i + 4U <= n; i += 4U)
+    {
+        uint32_t w0 = VISION_LOAD32(s);
+        uint32_t w1 = VISION_LOAD32(s + 4U);
+        uint32_t w2 = VISION_LOAD32(s + 8U);
+
+        VISION_STORE32(d + i * 2U, Reduce1(w0) | (Reduce1((w0 >> 24) | (w1 << 8)) << 16));
+        VISION_STORE32(d + i * 2U + 4U, Reduce1((w1 >> 16) | (w2 << 16)) | (Reduce1(w2 >> 8) << 16));
+        s += 12U;
+    }
+    for (; i < n; i++)
+    {
+        uint32_t px = Reduce1((uint32_t)s[0] | ((uint32_t)s[1] << 8) | ((uint32_t)s[2] << 16));
+        d[i * 2U] = (uint8_t)px;
+        d[i * 2U + 1U] = (uint8_t)(px >> 8);
+        s += 3U;
+    }
+}
+
+static void Line_565_Gray(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0U; i + 4U <= n; i += 4U)
+    {
+        VISION_STORE32(d + i, VISION_Luma4(VISION_LOAD32(s + i * 2U), VISION_LOAD32(s + i * 2U + 4U)));
+    }
+    for (; i < n; i++)
+    {
+        d[i] = (uint8_t)VISION_LUMA((uint32_t)s[i * 2U] | ((uint32_t)s[i * 2U + 1U] << 8));
+    }
+}
+
+/* Four gray bytes: UXTB16 puts pixels 0/2 and 1/3 in the lanes */
+static void Line_Gray_565(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0U; i + 4U <= n; i += 4U)
+    {
+        uint32_t w = VISION_LOAD32(s + i);
+        uint32_t p02 = Gray2To565(VISION_UXTB16(w));
+        uint32_t p13 = Gray2To565(VISION_UXTB16(w >> 8));
+
+        VISION_STORE32(d + i * 2U, VISION_PKLO(p02, p13));
+        VISION_STORE32(d + i * 2U + 4U, VISION_PKHI(p02, p13));
+    }
+    for (; i < n; i++)
+    {
+        uint32_t px = Gray2To565(s[i]);
+        d[i * 2U] = (uint8_t)px;
+        d[i * 2U + 1U] = (uint8_t)(px >> 8);
+    }
+}
+
+static void Line_565_Yuv(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    for (uint32_t i = 0U; i < n; i += 2U)
+    {
+        uint32_t w = VISION_LOAD32(s + i * 2U);
+        uint32_t r = (w >> 11) & 0x001F001FU;
+        uint32_t g = (w >> 5) & 0x003F003FU;
+        uint32_t b = w & 0x001F001FU;
+
+        /* Expanded channels of both pixels, then the lane sums */
+        r = (r << 3) | ((r >> 2) & 0x00070007U);
+        g = (g << 2) | ((g >> 4) & 0x00030003U);
+        b = (b << 3) | ((b >> 2) & 0x00070007U);
+        VISION_STORE32(d + i * 2U, YuvPack(VISION_LUMA(w), VISION_LUMA(w >> 16),
+                (r & 0xFFFFU) + (r >> 16), (g & 0xFFFFU) + (g >> 16), (b & 0xFFFFU) + (b >> 16)));
+    }
+}
+
+static void Line_Yuv_565(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    for (uint32_t i = 0U; i < n; i += 2U)
+    {
+        uint32_t w = VISION_LOAD32(s + i * 2U);
+        int32_t rv, gc, bu;
+
+        Chroma((w >> 8) & 0xFFU, w >> 24, &rv, &gc, &bu);
+        VISION_STORE32(d + i * 2U, Yuv565(w & 0xFFU, rv, gc, bu) |
+                (Yuv565((w >> 16) & 0xFFU, rv, gc, bu) << 16));
+    }
+}
+
+/* Four luma bytes out of two YUYV words */
+static void Line_Yuv_Gray(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0U; i + 4U <= n; i += 4U)
+    {
+        uint32_t a = VISION_UXTB16(VISION_LOAD32(s + i * 2U));
+        uint32_t b = VISION_UXTB16(VISION_LOAD32(s + i * 2U + 4U));
+
+        VISION_STORE32(d + i, ((a | (a >> 8)) & 0xFFFFU) | ((b | (b >> 8)) << 16));
+    }
+    for (; i < n; i++)
+    {
+        d[i] = s[i * 2U];
+    }
+}
+
+static void Line_Gray_Yuv(const uint8_t *s, uint8_t *d, uint32_t n)
+{
+    uint32_t i;
+
+    for (i = 0U; i + 4U <= n; i += 4U)
+    {
+        uint32_t w = VISION_LOAD32(s + i);
+        uint32_t y02 = VISION_UXTB16(w);
+        uint32_t y13 = VISION_UXTB16(w >> 8);
+
+        VISION_STORE32(d + i * 2U, VISION_PKLO(y02, y13) | 0x80008000U);
+        VISION_STORE32(d + i * 2U + 4U, VISION_PKHI(y02, y13) | 0x80008000U);
+    }
+    for (; i < n; i++)
+    {
+        d[i * 2U] = s[i];
+        d[i * 2U + 1U] = 0x80U;
+    }
+}
+
+/* Pairs without a dedicated kernel go through ARGB8888 */
+static const Color_Line_t ColorToArgb[VISION_COLOR_FORMATS] =
+{
+    Line_565_Argb, Line_565S_Argb, Line_888_Argb, Line_Copy4, Line_Yuv_Argb, Line_Gray_Argb,
+};
+
+static const Color_Line_t ColorFromArgb[VISION_COLOR_FORMATS] =
+{
+    Line_Argb_565, Line_Argb_565S, Line_Argb_888, Line_Copy4, Line_Argb_Yuv, Line_Argb_Gray,
+};
+
+/* [src][dst] */
+static const Color_Line_t ColorDirect[VISION_COLOR_FORMATS][VISION_COLOR_FORMATS] =
+{
+    [VISION_COLOR_RGB565] =
+    {
+        [VISION_COLOR_RGB565] = Line_Copy2, [VISION_COLOR_RGB565_SWAP] = Line_Swap,
+        [VISION_COLOR_RGB888] = Line_565_888, [VISION_COLOR_YUV422] = Line_565_Yuv,
+        [VISION_COLOR_GRAY8] = Line_565_Gray,
+    },
+    [VISION_COLOR_RGB565_SWAP] =
+    {
+        [VISION_COLOR_RGB565] = Line_Swap, [VISION_COLOR_RGB565_SWAP] = Line_Copy2,
+    },
+    [VISION_COLOR_RGB888] =
+    {
+        [VISION_COLOR_RGB565] = Line_888_565,
+    },
+    [VISION_COLOR_YUV422] =
+    {
+        [VISION_COLOR_RGB565] = Line_Yuv_565, [VISION_COLOR_YUV422] = Line_Copy2,
+        [VISION_COLOR_GRAY8] = Line_Yuv_Gray,
+    },
+    [VISION_COLOR_GRAY8] =
+    {
+        [VISION_COLOR_RGB565] = Line_Gray_565, [VISION_COLOR_YUV422] = Line_Gray_Yuv,
+    },
+};
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+uint32_t VISION_Color_BytesPerPixel(VISION_ColorFormat_t format)
+{
+    return (format < VISION_COLOR_FORMATS) ? ColorBpp[format] : 0U;
+}
+
+VISION_ColorStatus_t VISION_Color_Convert(const void *src, VISION_ColorFormat_t src_format,
+        uint32_t src_stride, void *dst, VISION_ColorFormat_t dst_format, uint32_t dst_stride,
+        uint16_t width, uint16_t height, VISION_ColorEngine_t engine)
+{
+    const uint8_t *s = (const uint8_t*)src;
+    uint8_t *d = (uint8_t*)dst;
+    uint32_t pixels = (uint32_t)width * height;
+
+    if (!CheckGeometry(src_format, dst_format, width) || (height == 0U) ||
+        (src_stride < width * ColorBpp[src_format]) || (dst_stride < width * ColorBpp[dst_format]))
+    {
+        return VISION_COLOR_ERROR;
+    }
+    ColorInit();
+
+#if COLOR_HAVE_DMA2D
+    if (engine != VISION_COLOR_CPU)
+    {
+        BSP_DMA2D_Pfc_t pfc;
+        uint8_t usable = Dma2dModes(src_format, dst_format, &pfc);
+
+        if (engine == VISION_COLOR_DMA2D)
+        {
+            if (!usable)
+            {
+                return VISION_COLOR_ERROR;
+            }
+        }
+        else if (pixels < VISION_COLOR_DMA2D_MIN_PIXELS)
+        {
+            usable = 0U;
+        }
+
+        if (usable)
+        {
+            uint32_t align = (uint32_t)src | src_stride;
+            uint32_t out_align = (uint32_t)dst | dst_stride;
+
+            /* Pixels must sit at their natural alignment */
+            align = (ColorBpp[src_format] == 4U) ? (align & 3U) : ((ColorBpp[src_format] == 2U) ? (align & 1U) : 0U);
+            out_align = (ColorBpp[dst_format] == 4U) ? (out_align & 3U) : ((ColorBpp[dst_format] == 2U) ? (out_align & 1U) : 0U);
+            if ((align == 0U) && (out_align == 0U))
+            {
+                pfc.src = src;
+                pfc.dst = dst;
+                pfc.src_stride = src_stride;
+                pfc.dst_stride = dst_stride;
+                pfc.width = width;
+                pfc.lines = height;
+                if ((src_format != VISION_COLOR_GRAY8) ||
+                    (BSP_DMA2D_LoadClut(ColorGrayClut, 256U) == HAL_OK))
+                {
+                    if (BSP_DMA2D_Convert(&pfc) == HAL_OK)
+                    {
+                        ColorStats.dma2d_jobs++;
+                        ColorStats.dma2d_pixels += pixels;
+                        return VISION_COLOR_OK;
+                    }
+                }
+            }
+            if (engine == VISION_COLOR_DMA2D)
+            {
+                return VISION_COLOR_ERROR;
+            }
+            ColorStats.fallbacks++;
+        }
+    }
+#else
+    if (engine == VISION_COLOR_DMA2D)
+    {
+        return VISION_COLOR_ERROR;
+    }
+#endif
+
+    {
+        Color_Line_t line = GetLine(src_format, dst_format);
+
+        for (uint32_t y = 0U; y < height; y++)
+        {
+            if (line != NULL)
+            {
+                line(s, d, width);
+            }
+            else
+            {
+                LineChunked(s, src_format, d, dst_format, width);
+            }
+            s += src_stride;
+            d += dst_stride;
+        }
+    }
+    ColorStats.cpu_jobs++;
+    ColorStats.cpu_pixels += pixels;
+    return VISION_COLOR_OK;
+}
+
+VISION_ColorStatus_t VISION_Color_ConvertLine(const void *src, VISION_ColorFormat_t src_format,
+        void *dst, VISION_ColorFormat_t dst_format, uint16_t width)
+{
+    Color_Line_t line;
+
+    if (!CheckGeometry(src_format, dst_format, width))
+    {
+        return VISION_COLOR_ERROR;
+    }
+    ColorInit();
+    line = GetLine(src_format, dst_format);
+    if (line != NULL)
+    {
+        line((const uint8_t*)src, (uint8_t*)dst, width);
+    }
+    else
+    {
+        LineChunked((const uint8_t*)src, src_format, (uint8_t*)dst, dst_format, width);
+    }
+    return VISION_COLOR_OK;
+}
+
+VISION_ColorStatus_t VISION_Color_ConvertRef(const void *src, VISION_ColorFormat_t src_format,
+        uint32_t src_stride, void *dst, VISION_ColorFormat_t dst_format, uint32_t dst_stride,
+        uint16_t width, uint16_t height)
+{
+    if (!CheckGeometry(src_format, dst_format, width) || (height == 0U))
+    {
+        return VISION_COLOR_ERROR;
+    }
+    ColorInit();
+
+    for (uint32_t y = 0U; y < height; y++)
+    {
+        const uint8_t *s = (const uint8_t*)src + y * src_stride;
+        uint8_t *d = (uint8_t*)dst + y * dst_stride;
+
+        if (src_format == dst_format)
+        {
+            memcpy(d, s, width * ColorBpp[src_format]);
+            continue;
+        }
+        if ((src_format == VISION_COLOR_YUV422) && (dst_format == VISION_COLOR_GRAY8))
+        {
+            for (uint32_t x = 0U; x < width; x++)
+            {
+                d[x] = s[x * 2U];
+            }
+            continue;
+        }
+
+        /* Pixel pairs: YUV422 shares the chroma of two pixels */
+        for (uint32_t x = 0U; x < width; x += 2U)
+        {
+            uint32_t n = (x + 1U < width) ? 2U : 1U;
+            uint32_t r[2], g[2], b[2], a[2];
+
+            for (uint32_t i = 0U; i < n; i++)
+            {
+                RefDecode(src_format, s, x + i, &r[i], &g[i], &b[i], &a[i]);
+            }
+            if (dst_format == VISION_COLOR_YUV422)
+            {
+                int32_t ra = (int32_t)(r[0] + r[1] + 1U) >> 1;
+                int32_t ga = (int32_t)(g[0] + g[1] + 1U) >> 1;
+                int32_t ba = (int32_t)(b[0] + b[1] + 1U) >> 1;
+                int32_t u = ((-43 * ra - 85 * ga + 128 * ba + 128) >> 8) + 128;
+                int32_t v = ((128 * ra - 107 * ga - 21 * ba + 128) >> 8) + 128;
+                uint8_t *dp = d + x * 2U;
+
+                dp[0] = (uint8_t)Luma8(r[0], g[0], b[0]);
+                dp[1] = (uint8_t)((u > 255) ? 255 : ((u < 0) ? 0 : u));
+                dp[2] = (uint8_t)Luma8(r[1], g[1], b[1]);
+                dp[3] = (uint8_t)((v > 255) ? 255 : ((v < 0) ? 0 : v));
+                continue;
+            }
+            for (uint32_t i = 0U; i < n; i++)
+            {
+                RefEncode(dst_format, d + (x + i) * ColorBpp[dst_format],
+                        r[i], g[i], b[i], (src_format == VISION_COLOR_ARGB8888) ? a[i] : 0xFFU);
+            }
+        }
+    }
+    return VISION_COLOR_OK;
+}
+
+void VISION_Color_GetStats(VISION_ColorStats_t *stats)
+{
+    *stats = ColorStats;
+}
+
+/******************************************************************************
+ *                               LOCAL FUNCTIONS                              *
+ ******************************************************************************/
+
+static void RefDecode(VISION_ColorFormat_t format, const uint8_t *line, uint32_t x,
+        uint32_t *r, uint32_t *g, uint32_t *b, uint32_t *a)
+{
+    const uint8_t *p = line + x * ColorBpp[format];
+
+    *a = 0xFFU;
+    switch (format)
+    {
+        case VISION_COLOR_RGB565:
+        case VISION_COLOR_RGB565_SWAP:
+        {
+            uint32_t px = (format == VISION_COLOR_RGB565) ?
+                    (p[0] | ((uint32_t)p[1] << 8)) : (p[1] | ((uint32_t)p[0] << 8));
+            *r = VISION_EXPAND5(px >> 11);
+            *g = VISION_EXPAND6((px >> 5) & 0x3FU);
+            *b = VISION_EXPAND5(px & 0x1FU);
+        }
+            break;
+        case VISION_COLOR_RGB888:
+        case VISION_COLOR_ARGB8888:
+            *b = p[0];
+            *g = p[1];
+            *r = p[2];
+            if (format == VISION_COLOR_ARGB8888)
+            {
+                *a = p[3];
+            }
+            break;
+        case VISION_COLOR_YUV422:
+        {
+            const uint8_t *pair = line + (x & ~1U) * 2U;
+            int32_t du = (int32_t)pair[1] - 128;
+            int32_t dv = (int32_t)pair[3] - 128;
+            int32_t c[3];
+
+            c[0] = p[0] + ((359 * dv + 128) >> 8);
+            c[1] = p[0] - ((88 * du + 183 * dv + 128) >> 8);
+            c[2] = p[0] + ((454 * du + 128) >> 8);
+            for (uint32_t i = 0U; i < 3U; i++)
+            {
+                c[i] = (c[i] < 0) ? 0 : ((c[i] > 255) ? 255 : c[i]);
+            }
+            *r = (uint32_t)c[0];
+            *g = (uint32_t)c[1];
+            *b = (uint32_t)c[2];
+        }
+            break;
+        default:
+            *r = *g = *b = p[0];
+            break;
+    }
+}
+
+/* Everything but YUV422 */
+static void RefEncode(VISION_ColorFormat_t format, uint8_t *p,
+        uint32_t r, uint32_t g, uint32_t b, uint32_t a)
+{
+    uint32_t px = ((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3);
+
+    switch (format)
+    {
+        case VISION_COLOR_RGB565:
+            p[0] = (uint8_t)px;
+            p[1] = (uint8_t)(px >> 8);
+            break;
+        case VISION_COLOR_RGB565_SWAP:
+            p[0] = (uint8_t)(px >> 8);
+            p[1] = (uint8_t)px;
+            break;
+        case VISION_COLOR_RGB888:
+        case VISION_COLOR_ARGB8888:
+            p[0] = (uint8_t)b;
+            p[1] = (uint8_t)g;
+            p[2] = (uint8_t)r;
+            if (format == VISION_COLOR_ARGB8888)
+            {
+                p[3] = (uint8_t)a;
+            }
+            break;
+        default:
+            p[0] = (uint8_t)Luma8(r, g, b);
+            break;
+    }
+}
+
+static void ColorInit(void)
+{
+    if (ColorReady)
+    {
+        return;
+    }
+    VISION_LumaInit();
+#if COLOR_HAVE_DMA2D
+    for (uint32_t i = 0U; i < 256U; i++)
+    {
+        ColorGrayClut[i] = COLOR_OPAQUE | (i * 0x010101U);
+    }
+#endif
+    ColorReady = 1U;
+}
+
+static Color_Line_t GetLine(VISION_ColorFormat_t src_format, VISION_ColorFormat_t dst_format)
+{
+    if (ColorDirect[src_format][dst_format] != NULL)
+    {
+        return ColorDirect[src_format][dst_format];
+    }
+    if (src_format == VISION_COLOR_ARGB8888)
+    {
+        return ColorFromArgb[dst_format];
+    }
+    if (dst_format == VISION_COLOR_ARGB8888)
+    {
+        return ColorToArgb[src_format];
+    }
+    if (src_format == dst_format)
+    {
+        return (ColorBpp[src_format] == 2U) ? Line_Copy2 : NULL;
+    }
+    return NULL;
+}
+
+static void LineChunked(const uint8_t *src, VISION_ColorFormat_t src_format,
+        uint8_t *dst, VISION_ColorFormat_t dst_format, uint32_t n)
+{
+    uint32_t argb[COLOR_CHUNK];
+
+    if (src_format == dst_format)
+    {
+        memcpy(dst, src, n * ColorBpp[src_format]);
+        return;
+    }
+    while (n > 0U)
+    {
+        uint32_t k = (n > COLOR_CHUNK) ? COLOR_CHUNK : n;
+
+        ColorToArgb[src_format](src, (uint8_t*)argb, k);
+        ColorFromArgb[dst_format]((const uint8_t*)argb, dst, k);
+        src += k * ColorBpp[src_format];
+        dst += k * ColorBpp[dst_format];
+        n -= k;
+    }
+}
+
+static uint8_t CheckGeometry(VISION_ColorFormat_t src_format, VISION_ColorFormat_t dst_format,
+        uint16_t width)
+{
+    if ((src_format >= VISION_COLOR_FORMATS) || (dst_format >= VISION_COLOR_FORMATS) ||
+        (width == 0U))
+    {
+        return 0U;
+    }
+    if (((src_format == VISION_COLOR_YUV422) || (dst_format == VISION_COLOR_YUV422)) &&
+        (width & 1U))
+    {
+        return 0U;
+    }
+    return 1U;
+}
+
+#if COLOR_HAVE_DMA2D
+/* DMA2D modes for the pair, 0 if the PFC can't do it (YUV, gray output,
+ * swapped RGB565 into anything but RGB565) */
+static uint8_t Dma2dModes(VISION_ColorFormat_t src_format, VISION_ColorFormat_t dst_format,
+        BSP_DMA2D_Pfc_t *pfc)
+{
+    uint8_t src_swapped = (src_format == VISION_COLOR_RGB565_SWAP) ? 1U : 0U;
+
+    switch (dst_format)
+    {
+        case VISION_COLOR_RGB565:
+        case VISION_COLOR_RGB565_SWAP:
+            pfc->out_mode = DMA2D_OUTPUT_RGB565;
+            /* The output byte swap also undoes a swapped input */
+            pfc->swap = ((dst_format == VISION_COLOR_RGB565_SWAP) != src_swapped) ? 1U : 0U;
+            break;
+        case VISION_COLOR_RGB888:
+            pfc->out_mode = DMA2D_OUTPUT_RGB888;
+            pfc->swap = 0U;
+            break;
+        case VISION_COLOR_ARGB8888:
+            pfc->out_mode = DMA2D_OUTPUT_ARGB8888;
+            pfc->swap = 0U;
+            break;
+        default:
+            return 0U;
+    }
+
+    switch (src_format)
+    {
+        case VISION_COLOR_RGB565:
+            pfc->in_mode = DMA2D_INPUT_RGB565;
+            break;
+        case VISION_COLOR_RGB565_SWAP:
+            if (pfc->out_mode != DMA2D_OUTPUT_RGB565)
+            {
+                return 0U;
+            }
+            pfc->in_mode = DMA2D_INPUT_RGB565;
+            break;
+        case VISION_COLOR_RGB888:
+            pfc->in_mode = DMA2D_INPUT_RGB888;
+            break;
+        case VISION_COLOR_ARGB8888:
+            pfc->in_mode = DMA2D_INPUT_ARGB8888;
+            break;
+        case VISION_COLOR_GRAY8:
+            pfc->in_mode = DMA2D_INPUT_L8;
+            break;
+        default:
+            return 0U;
+    }
+    return 1U;
+}
+#endif
@@ -0,0 +1,99 @@
+/*
+ * vision_color.h
+ * Pixel format conversion: RGB565, byte swapped RGB565, RGB888, ARGB8888,
+ * YUV422 and 8 bit gray
+ *
+ * One entry point for every format pair. The CPU kernels work on packed
+ * words (two to four pixels per operation: REV16 swaps two pixels, UXTB16
+ * spreads four gray bytes, SMUAD computes the chroma term of a pixel pair);
+ * pairs without a dedicated kernel go through an ARGB8888 line chunk.
+ * Pairs the DMA2D pixel format converter supports are handed to it for
+ * large enough images (VISION_COLOR_AUTO).
+ *
+ * Conversion rules, identical for the CPU, the DMA2D and the scalar
+ * reference:
+ *  - 5/6 bit channels are expanded by bit replication, reduced by truncation
+ *  - gray is the BT.601 luma of VISION_LUMA() (the Y plane for YUV422),
+ *    gray to color replicates it
+ *  - same format in and out is a plain copy
+ *  - YUV422 is YUYV (Y0 U Y1 V), full range BT.601 (JFIF); the chroma of a
+ *    pixel pair comes from the average of the two pixels
+ *  - ARGB8888 output is opaque unless the input is ARGB8888 too
+ */
+
+#ifndef VISION_COLOR_H_
+#define VISION_COLOR_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Below this many pixels the DMA2D setup costs more than the CPU kernel */
+#define VISION_COLOR_DMA2D_MIN_PIXELS            (2048U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef enum
+{
+    VISION_COLOR_OK = 0,
+    VISION_COLOR_ERROR,           /* bad geometry, or engine can't do the pair */
+} VISION_ColorStatus_t;
+
+typedef enum
+{
+    VISION_COLOR_RGB565 = 0,      /* native (little endian) 16 bit words */
+    VISION_COLOR_RGB565_SWAP,     /* high byte first */
+    VISION_COLOR_RGB888,          /* B, G, R bytes (DMA2D/LTDC order) */
+    VISION_COLOR_ARGB8888,        /* native 32 bit words */
+    VISION_COLOR_YUV422,          /* Y0 U Y1 V, width must be even */
+    VISION_COLOR_GRAY8,
+    VISION_COLOR_FORMATS
+} VISION_ColorFormat_t;
+
+typedef enum
+{
+    VISION_COLOR_AUTO = 0,        /* DMA2D when possible and worth it */
+    VISION_COLOR_CPU,
+    VISION_COLOR_DMA2D,           /* error if the DMA2D can't do it */
+} VISION_ColorEngine_t;
+
+typedef struct
+{
+    uint32_t cpu_jobs;
+    uint32_t cpu_pixels;
+    uint32_t dma2d_jobs;
+    uint32_t dma2d_pixels;
+    uint32_t fallbacks;           /* AUTO picked the DMA2D but it was busy/failed */
+} VISION_ColorStats_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+extern uint32_t VISION_Color_BytesPerPixel(VISION_ColorFormat_t format);
+
+/* Strides in bytes, src and dst must not overlap */
+extern VISION_ColorStatus_t VISION_Color_Convert(const void *src, VISION_ColorFormat_t src_format,
+        uint32_t src_stride, void *dst, VISION_ColorFormat_t dst_format, uint32_t dst_stride,
+        uint16_t width, uint16_t height, VISION_ColorEngine_t engine);
+
+/* One line on the CPU (decoders, line based producers) */
+extern VISION_ColorStatus_t VISION_Color_ConvertLine(const void *src, VISION_ColorFormat_t src_format,
+        void *dst, VISION_ColorFormat_t dst_format, uint16_t width);
+
+/* Scalar reference, pixel by pixel */
+extern VISION_ColorStatus_t VISION_Color_ConvertRef(const void *src, VISION_ColorFormat_t src_format,
+        uint32_t src_stride, void *dst, VISION_ColorFormat_t dst_format, uint32_t dst_stride,
+        uint16_t width, uint16_t height);
+
+extern void VISION_Color_GetStats(VISION_ColorStats_t *stats);
+
+#endif /* VISION_COLOR_H_ */
@@ -0,0 +1,47 @@
+/*
+ * vision_luma.c
+ * RGB565 to 8 bit luma (BT.601) shared by the vision modules
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "vision_luma.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+/* BT.601 weights, sum 256 */
+#define LUMA_WR                       (77U)
+#define LUMA_WG                       (150U)
+#define LUMA_WB                       (29U)
+
+/******************************************************************************
+ *                           GLOBAL DATA PROTOTYPES                           *
+ ******************************************************************************/
+
+uint16_t VISION_LumaHi[256];
+uint16_t VISION_LumaLo[256];
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void VISION_LumaInit(void)
+{
+    for (uint32_t v = 0U; v < 256U; v++)
+    {
+        /* High byte RRRRRGGG, low byte GGGBBBBB */
+        uint32_t r5 = v >> 3;
+        uint32_t g_hi = v & 0x07U;
+        uint32_t g_lo = v >> 5;
+        uint32_t b5 = v & 0x1FU;
+
+        VISION_LumaHi[v] = (uint16_t)(LUMA_WR * VISION_EXPAND5(r5) +
+                LUMA_WG * ((g_hi << 5) | (g_hi >> 1)));
+        VISION_LumaLo[v] = (uint16_t)(LUMA_WG * (g_lo << 2) +
+                LUMA_WB * VISION_EXPAND5(b5) + 128U);
+    }
+}
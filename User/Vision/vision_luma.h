@@ -0,0 +1,53 @@
+/*
+ * vision_luma.h
+ * RGB565 to 8 bit luma (BT.601) shared by the vision modules
+ *
+ * Luma * 256 is split over the two bytes of an RGB565 pixel: the high byte
+ * holds R and the top of G, the low byte the bottom of G and B. The 6 bit G
+ * expansion only replicates bits of the high byte, so the two 256 entry
+ * tables add up to the exact result.
+ */
+
+#ifndef VISION_LUMA_H_
+#define VISION_LUMA_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                           GLOBAL DATA PROTOTYPES                           *
+ ******************************************************************************/
+
+extern uint16_t VISION_LumaHi[256];
+extern uint16_t VISION_LumaLo[256];
+
+/******************************************************************************
+ *                           GLOBAL MACRO / INLINES                           *
+ ******************************************************************************/
+
+/* 5/6 bit channel to 8 bit, bit replication like the LTDC does */
+#define VISION_EXPAND5(v)                        ((uint8_t)(((v) << 3) | ((v) >> 2)))
+#define VISION_EXPAND6(v)                        ((uint8_t)(((v) << 2) | ((v) >> 4)))
+
+/* Luma of one RGB565 pixel */
+#define VISION_LUMA(px)                          \
+    ((uint32_t)(VISION_LumaHi[((px) >> 8) & 0xFFU] + VISION_LumaLo[(px) & 0xFFU]) >> 8)
+
+/* Luma of four consecutive pixels (two words), one per byte, pixel 0 in the LSB */
+static inline uint32_t VISION_Luma4(uint32_t w0, uint32_t w1)
+{
+    return VISION_LUMA(w0) | (VISION_LUMA(w0 >> 16) << 8) |
+           (VISION_LUMA(w1) << 16) | (VISION_LUMA(w1 >> 16) << 24);
+}
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Fill the tables, may be called more than once */
+extern void VISION_LumaInit(void);
+
+#endif /* VISION_LUMA_H_ */
@@ -0,0 +1,227 @@
+/*
+ * vision_simd.h
+ * Packed (SIMD within a register) helpers used by the vision modules
+ *
+ * On the Cortex-M7 these map straight onto the CMSIS DSP intrinsics. Any other
+ * target (host builds of the algorithms) gets plain C versions with the same
+ * lane semantics, so scalar and packed code paths give bit-identical results.
+ */
+
+#ifndef VISION_SIMD_H_
+#define VISION_SIMD_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__ARM_FEATURE_DSP) && (__ARM_FEATURE_DSP == 1)
+#include "stm32h7xx.h"
+#define VISION_HAVE_DSP                          (1)
+#else
+#define VISION_HAVE_DSP                          (0)
+#endif
+
+/******************************************************************************
+ *                           GLOBAL MACRO / INLINES                           *
+ ******************************************************************************/
+
+#if VISION_HAVE_DSP
+
+/* Sum of absolute differences of the four bytes */
+#define VISION_USAD8(a, b)                       __USAD8((a), (b))
+#define VISION_USADA8(a, b, acc)                 __USADA8((a), (b), (acc))
+/* Two 16 bit / four 8 bit lanes, modulo */
+#define VISION_UADD16(a, b)                      __UADD16((a), (b))
+#define VISION_UADD8(a, b)                       __UADD8((a), (b))
+#define VISION_SADD16(a, b)                      __SADD16((a), (b))
+#define VISION_SSUB16(a, b)                      __SSUB16((a), (b))
+/* Four 8 bit lanes, halving add / saturating subtract */
+#define VISION_UHADD8(a, b)                      __UHADD8((a), (b))
+#define VISION_UQSUB8(a, b)                      __UQSUB8((a), (b))
+/* acc + a.lo * b.lo + a.hi * b.hi (signed 16 bit lanes) */
+#define VISION_SMLAD(a, b, acc)                  ((int32_t)__SMLAD((a), (b), (uint32_t)(acc)))
+#define VISION_SMUAD(a, b)                       ((int32_t)__SMUAD((a), (b)))
+/* a.lo | b.lo << 16 and a.hi | b.hi << 16 */
+#define VISION_PKLO(a, b)                        __PKHBT((a), (b), 16)
+#define VISION_PKHI(a, b)                        __PKHTB((b), (a), 16)
+/* Bytes swapped in each 16 bit lane */
+#define VISION_REV16(a)                          __REV16(a)
+/* Bytes 0 and 2 zero extended into the two 16 bit lanes */
+#define VISION_UXTB16(a)                         __UXTB16(a)
+/* Clamp to 0..255 */
+#define VISION_USAT8(a)                          ((uint32_t)__USAT((a), 8))
+
+/* Per byte maximum / minimum (USUB8 sets GE, SEL picks) */
+static inline uint32_t VISION_UMAX8(uint32_t a, uint32_t b)
+{
+    (void)__USUB8(a, b);
+    return __SEL(a, b);
+}
+
+static inline uint32_t VISION_UMIN8(uint32_t a, uint32_t b)
+{
+    (void)__USUB8(a, b);
+    return __SEL(b, a);
+}
+
+#else /* VISION_HAVE_DSP */
+
+static inline uint32_t VISION_USAD8(uint32_t a, uint32_t b)
+{
+    uint32_t sum = 0U;
+    for (uint32_t s = 0U; s < 32U; s += 8U)
+    {
+        int32_t d = (int32_t)((a >> s) & 0xFFU) - (int32_t)((b >> s) & 0xFFU);
+        sum += (uint32_t)((d < 0) ? -d : d);
+    }
+    return sum;
+}
+
+static inline uint32_t VISION_USADA8(uint32_t a, uint32_t b, uint32_t acc)
+{
+    return acc + VISION_USAD8(a, b);
+}
+
+static inline uint32_t VISION_UADD16(uint32_t a, uint32_t b)
+{
+    return ((a + b) & 0x0000FFFFU) | (((a >> 16) + (b >> 16)) << 16);
+}
+
+static inline uint32_t VISION_UADD8(uint32_t a, uint32_t b)
+{
+    return (((a & 0x7F7F7F7FU) + (b & 0x7F7F7F7FU)) ^ ((a ^ b) & 0x80808080U));
+}
+
+static inline uint32_t VISION_SADD16(uint32_t a, uint32_t b)
+{
+    return VISION_UADD16(a, b);
+}
+
+static inline uint32_t VISION_SSUB16(uint32_t a, uint32_t b)
+{
+    return ((a - b) & 0x0000FFFFU) | (((a >> 16) - (b >> 16)) << 16);
+}
+
+static inline uint32_t VISION_UHADD8(uint32_t a, uint32_t b)
+{
+    return (a & b) + (((a ^ b) >> 1) & 0x7F7F7F7FU);
+}
+
+static inline uint32_t VISION_UQSUB8(uint32_t a, uint32_t b)
+{
+    uint32_t r = 0U;
+    for (uint32_t s = 0U; s < 32U; s += 8U)
+    {
+        uint32_t x = (a >> s) & 0xFFU;
+        uint32_t y = (b >> s) & 0xFFU;
+        r |= ((x > y) ? (x - y) : 0U) << s;
+    }
+    return r;
+}
+
+/* The sums wrap like the instructions (which only set the Q flag) */
+static inline int32_t VISION_SMUAD(uint32_t a, uint32_t b)
+{
+    return (int32_t)((uint32_t)((int32_t)(int16_t)a * (int16_t)b) +
+           (uint32_t)((int32_t)(int16_t)(a >> 16) * (int16_t)(b >> 16)));
+}
+
+static inline int32_t VISION_SMLAD(uint32_t a, uint32_t b, int32_t acc)
+{
+    return (int32_t)((uint32_t)acc + (uint32_t)VISION_SMUAD(a, b));
+}
+
+static inline uint32_t VISION_PKLO(uint32_t a, uint32_t b)
+{
+    return (a & 0x0000FFFFU) | (b << 16);
+}
+
+static inline uint32_t VISION_PKHI(uint32_t a, uint32_t b)
+{
+    return (a >> 16) | (b & 0xFFFF0000U);
+}
+
+static inline uint32_t VISION_REV16(uint32_t a)
+{
+    return ((a >> 8) & 0x00FF00FFU) | ((a << 8) & 0xFF00FF00U);
+}
+
+static inline uint32_t VISION_UXTB16(uint32_t a)
+{
+    return a & 0x00FF00FFU;
+}
+
+static inline uint32_t VISION_USAT8(int32_t a)
+{
+    return (uint32_t)((a < 0) ? 0 : ((a > 255) ? 255 : a));
+}
+
+static inline uint32_t VISION_UMAX8(uint32_t a, uint32_t b)
+{
+    uint32_t r = 0U;
+    for (uint32_t s = 0U; s < 32U; s += 8U)
+    {
+        uint32_t x = (a >> s) & 0xFFU;
+        uint32_t y = (b >> s) & 0xFFU;
+        r |= ((x >= y) ? x : y) << s;
+    }
+    return r;
+}
+
+static inline uint32_t VISION_UMIN8(uint32_t a, uint32_t b)
+{
+    uint32_t r = 0U;
+    for (uint32_t s = 0U; s < 32U; s += 8U)
+    {
+        uint32_t x = (a >> s) & 0xFFU;
+        uint32_t y = (b >> s) & 0xFFU;
+        r |= ((x >= y) ? y : x) << s;
+    }
+    return r;
+}
+
+#endif /* VISION_HAVE_DSP */
+
+/* Pack two 16 bit values into one register: lo | hi << 16 */
+#define VISION_PACK16(lo, hi)                    (((uint32_t)(uint16_t)(lo)) | ((uint32_t)(hi) << 16))
+
+/* Word load/store at any address (LDR/STR handle unaligned addresses on the M7) */
+static inline uint32_t VISION_LOAD32(const void *p)
+{
+    uint32_t v;
+    memcpy(&v, p, sizeof(v));
+    return v;
+}
+
+static inline void VISION_STORE32(void *p, uint32_t v)
+{
+    memcpy(p, &v, sizeof(v));
+}
+
+/* Tightly coupled data RAM (zero wait state, CPU and MDMA only); the
+ * section is NOLOAD, contents are undefined until written */
+#define VISION_DTCM                              __attribute__((section(".DTCMSection"))) __attribute__((aligned(4)))
+
+/******************************************************************************
+ *                              CYCLE COUNTER                                 *
+ ******************************************************************************/
+
+#if defined(DWT) && defined(CoreDebug)
+static inline void VISION_CyclesInit(void)
+{
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->LAR = 0xC5ACCE55U;     /* Cortex-M7 DWT software lock */
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+#define VISION_CYCLES()                          (DWT->CYCCNT)
+#else
+static inline void VISION_CyclesInit(void)
+{
+}
+#define VISION_CYCLES()                          (0U)
+#endif
+
+#endif /* VISION_SIMD_H_ */
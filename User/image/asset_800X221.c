@@ -0,0 +1,4936 @@
+/*
+ * gAsset_800X221: 800 x 221 RGB565, RLE, 78814 bytes (raw 353600, 4.49:1)
+ * Generated by Tools/img_pack, do not edit
+ */
+
+#include "image.h"
+
+const unsigned char gAsset_800X221[78814] __attribute__((aligned(4))) =
+{
+    0x49,0x4D,0x47,0x41,0x20,0x03,0xDD,0x00,0x00,0x01,0x00,0x00,0xCE,0x33,0x01,0x00,
+    0x7F,0xFF,0xFF,0xE2,0xFF,0xFF,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,
+    0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,
+    0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,
+    0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xC1,0x01,0xDF,0xFF,0xDF,
+    0xFF,0xBF,0xFF,0xDE,0xBF,0xB1,0x00,0xFE,0xFF,0x7F,0xFF,0xEF,0xFF,0xFF,0xBF,0xB1,
+    0x00,0xDE,0xFF,0x8D,0x01,0xDE,0xFF,0xFE,0xEF,0x8F,0x00,0xFE,0xFF,0x84,0x01,0xDE,
+    0xFF,0xDF,0xFF,0x87,0x00,0xFE,0xFF,0x84,0x00,0xFE,0xFF,0x98,0x00,0xDE,0xFF,0x8D,
+    0x01,0xDE,0xFF,0xDF,0xFF,0xA3,0x00,0xDF,0xFF,0xBF,0x32,0x00,0xFF,0xF7,0xBF,0x09,
+    0x00,0xDF,0xFF,0x8B,0x00,0xFE,0xFF,0xBF,0x0E,0x00,0xDF,0xFF,0xBF,0x35,0x01,0xFF,
+    0xF7,0xFF,0xF7,0x97,0x95,0x00,0xFE,0xFF,0xBF,0x28,0x00,0xFE,0xFF,0x81,0x00,0xFE,
+    0xFF,0xBF,0x2D,0x02,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x4F,0xFF,0xFF,0x01,0xDF,0xFF,
+    0xFE,0xFF,0x50,0xFF,0xFF,0x00,0xFF,0xF7,0x49,0xFF,0xFF,0x00,0xDF,0xFF,0x46,0xFF,
+    0xFF,0x01,0xDF,0xFF,0xFF,0xFF,0x42,0xDF,0xFF,0x8F,0x00,0xFF,0xF7,0x53,0xFF,0xFF,
+    0x00,0xFF,0xF7,0x7F,0x54,0xFF,0xFF,0x00,0xFE,0xFF,0x44,0xFF,0xFF,0x00,0xFF,0xF7,
+    0xBF,0x02,0x04,0xFF,0xF7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x50,0xFF,0xFF,
+    0x00,0xFE,0xFF,0x7F,0x0B,0xFF,0xFF,0x00,0xFE,0xFF,0xBF,0x31,0x03,0xFF,0xF7,0xFF,
+    0xF7,0xFF,0xFF,0xDF,0xFF,0x96,0x94,0x04,0xBF,0xFF,0xFF,0xFF,0x7A,0xA6,0x38,0x5D,
+    0x99,0x65,0x42,0x79,0x6D,0x02,0x79,0x65,0x59,0x65,0x59,0x6D,0x7F,0x12,0x79,0x6D,
+    0x0A,0x59,0x6D,0x7A,0x6D,0x9A,0x75,0xBA,0x75,0xFC,0x85,0x3D,0x8E,0x9D,0x9E,0xFD,
+    0xB6,0x5D,0xCF,0xBE,0xEF,0xFE,0xFF,0x47,0xFF,0xFF,0x02,0xFD,0xFF,0xFE,0xFF,0xDF,
+    0xFF,0x7F,0x29,0xFF,0xFF,0x0A,0xDE,0xF7,0xFE,0xDF,0xBE,0xF7,0xDE,0xFF,0xDE,0xFF,
+    0xFE,0xF7,0xFD,0xF7,0xFE,0xF7,0xFE,0xF7,0xDE,0xF7,0xDE,0xFF,0x42,0xDE,0xF7,0x07,
+    0xFD,0xF7,0xDE,0xFF,0xDE,0xF7,0xBF,0xDF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0x4F,0xFF,0xFF,0x13,0xBF,0xF7,0x5E,0xC7,0x3D,0xBF,0x5D,0xBF,0x3D,0xBF,0x3D,0xC7,
+    0x3D,0xC7,0x5D,0xC7,0x3D,0xC7,0x3D,0xC7,0x5E,0xBF,0x3D,0xC7,0x3D,0xC7,0x3D,0xBF,
+    0x5D,0xBF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x42,0xFF,0xFF,0x00,
+    0xDF,0xFF,0x88,0x00,0xDE,0xFF,0x45,0xFF,0xFF,0x0C,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,
+    0x7E,0xCF,0xFD,0xBE,0x3D,0xC7,0x3D,0xC7,0x5D,0xBF,0x3D,0xBF,0x5D,0xBF,0x5D,0xBF,
+    0x3D,0xC7,0x5D,0xC7,0x43,0x3D,0xC7,0x02,0x5D,0xBF,0x3C,0xB7,0x1D,0xC7,0x9C,0x00,
+    0xDF,0xFF,0xBF,0x37,0x00,0xDF,0xFF,0x83,0x02,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xBF,
+    0x01,0x06,0xFE,0xFF,0xDE,0xFF,0xDE,0xEF,0xFE,0xF7,0xFE,0xF7,0xFE,0xFF,0xDE,0xF7,
+    0x47,0xFE,0xF7,0x05,0xDE,0xFF,0xFF,0xFF,0xDE,0xF7,0xFE,0xEF,0xFF,0xEF,0xFE,0xFF,
+    0x7F,0x0A,0xFF,0xFF,0x00,0xFE,0xFF,0x7F,0x35,0xFF,0xFF,0x03,0xDF,0xFF,0xBF,0xFF,
+    0xDF,0xFF,0xFF,0xEF,0x95,0x96,0x03,0x13,0x2C,0x2E,0x01,0xF1,0x01,0x11,0x02,0x7F,
+    0x16,0xF0,0x01,0x00,0xF1,0x01,0x42,0xF0,0x01,0x0D,0x11,0x02,0x31,0x02,0x31,0x02,
+    0x52,0x02,0x72,0x02,0x91,0x02,0xD1,0x0A,0x33,0x1B,0xD4,0x23,0x97,0x3C,0x5B,0x55,
+    0x1D,0x7E,0xDB,0xB6,0x7C,0xEF,0x45,0xFF,0xFF,0x00,0xDF,0xFF,0xBF,0x26,0x07,0xFF,
+    0xF7,0x94,0x2B,0xF0,0x12,0x51,0x13,0x52,0x13,0x13,0x13,0x33,0x13,0x33,0x13,0x45,
+    0x32,0x13,0x07,0x33,0x13,0x32,0x13,0x33,0x13,0xAF,0x12,0x73,0x3C,0xFF,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0x4E,0xFF,0xFF,0x08,0xFE,0xFF,0xFF,0xFF,0x7E,0xDF,0xD3,0x12,0x30,
+    0x02,0x91,0x02,0x91,0x02,0x71,0x02,0x71,0x0A,0x44,0x91,0x02,0x07,0x92,0x02,0x30,
+    0x02,0xB1,0x0A,0x7E,0xD7,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFE,0xFF,0x50,0xFF,0xFF,
+    0x16,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xD7,0xF3,0x0A,0x0F,
+    0x02,0x72,0x0A,0x71,0x02,0x91,0x02,0x90,0x02,0x71,0x02,0x91,0x02,0x71,0x0A,0x91,
+    0x02,0x71,0x0A,0x91,0x02,0x71,0x0A,0x92,0x02,0x91,0x02,0x2F,0x02,0x52,0x1B,0x5C,
+    0xFF,0xFF,0x00,0xFF,0xF7,0x7F,0x3D,0xFF,0xFF,0x00,0xBF,0xFF,0x7F,0x03,0xFF,0xFF,
+    0x05,0x1E,0xC7,0x12,0x13,0xF2,0x12,0x33,0x13,0x32,0x13,0x52,0x13,0x4A,0x32,0x13,
+    0x04,0x90,0x0A,0x17,0x6D,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xBF,0x08,0x00,0xFF,0xF7,
+    0x7F,0x39,0xFF,0xFF,0x00,0xFF,0xF7,0x83,0x00,0xFE,0xFF,0x8F,0x56,0xFF,0xFF,0x08,
+    0x95,0x44,0xF0,0x01,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x93,0x02,0x7F,0x15,0x92,0x02,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x42,0x72,0x02,
+    0x0C,0x52,0x02,0x32,0x02,0x11,0x02,0xF0,0x01,0xF0,0x01,0x11,0x02,0x71,0x02,0xF2,
+    0x0A,0x93,0x1B,0x98,0x44,0xBA,0x75,0xBB,0xB6,0xBE,0xF7,0x7F,0x28,0xFF,0xFF,0x07,
+    0x7B,0xA6,0xD0,0x01,0x33,0x02,0x30,0x02,0x52,0x02,0x32,0x02,0x32,0x02,0x51,0x02,
+    0x43,0x32,0x02,0x06,0x31,0x02,0x31,0x02,0x33,0x02,0x32,0x02,0x32,0x02,0xAF,0x01,
+    0x59,0x75,0x51,0xFF,0xFF,0x07,0xDF,0xFF,0xFF,0xFF,0x5D,0xE7,0xB4,0x02,0x11,0x02,
+    0x71,0x02,0x52,0x02,0x73,0x02,0x42,0x72,0x02,0x11,0x52,0x02,0x72,0x02,0x72,0x02,
+    0x53,0x02,0x12,0x02,0xB3,0x02,0x9F,0xD7,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xBE,0xF7,
+    0x5C,0xDF,0x7D,0xDF,0x7E,0xDF,0x5D,0xE7,0x7E,0xDF,0x5D,0xDF,0x5D,0xDF,0x43,0x7D,
+    0xDF,0x03,0x5D,0xDF,0x5D,0xDF,0x5C,0xE7,0xFF,0xF7,0x46,0xFF,0xFF,0x06,0xBC,0xAE,
+    0x12,0x02,0x52,0x02,0x72,0x02,0x72,0x02,0x52,0x02,0x53,0x02,0x46,0x72,0x02,0x05,
+    0x73,0x02,0x52,0x02,0xB1,0x01,0x59,0x2C,0xFF,0xFF,0xDF,0xFF,0x5B,0xFF,0xFF,0x06,
+    0x9E,0xE7,0x37,0x6D,0x59,0x5D,0x7B,0x5D,0x7A,0x5D,0x59,0x65,0x79,0x5D,0x7F,0x28,
+    0x79,0x65,0x47,0x7A,0x65,0x05,0x79,0x65,0x3A,0x65,0x7B,0x5D,0x5B,0x55,0x78,0x5D,
+    0x5D,0xD7,0x7F,0x04,0xFF,0xFF,0x03,0xDB,0xB6,0x31,0x02,0x10,0x02,0x51,0x02,0x4B,
+    0x32,0x02,0x02,0x52,0x02,0x90,0x01,0x98,0x44,0x81,0x00,0xDF,0xFF,0x7F,0x09,0xFF,
+    0xFF,0x05,0xB8,0x8D,0x77,0x3C,0xD8,0x44,0xF8,0x44,0xD8,0x44,0xF7,0x4C,0x7F,0x2B,
+    0xD8,0x44,0x07,0xB8,0x44,0xB8,0x44,0xD8,0x3C,0xB8,0x44,0xB8,0x44,0xF8,0x34,0x55,
+    0x3C,0x9C,0xBE,0x55,0xFF,0xFF,0x96,0x00,0x75,0x44,0x81,0x42,0x92,0x02,0x81,0xFF,
+    0x14,0x00,0x93,0x02,0x45,0x92,0x02,0x10,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0x92,0x02,0x72,0x02,0x93,0x02,0x72,0x02,0x11,0x02,0xEF,0x01,0x10,0x02,
+    0x50,0x02,0x12,0x13,0x37,0x2C,0x98,0x6D,0xBA,0xC6,0x89,0x00,0xDF,0xFF,0xBF,0x13,
+    0x02,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x83,0x19,0x57,0x3C,0xF0,0x01,0x93,0x02,0x93,
+    0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,
+    0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB1,0x02,0x30,0x02,0xF3,0x0A,0xBF,0xF7,0xFF,
+    0xFF,0x1D,0xCF,0x1A,0x55,0x59,0x65,0x79,0x65,0x59,0x65,0x59,0x65,0x42,0x79,0x65,
+    0x05,0x59,0x65,0x59,0x6D,0x58,0x6D,0x7A,0x65,0x17,0x55,0xBB,0xAE,0x43,0xFF,0xFF,
+    0x02,0x7D,0xE7,0xF3,0x0A,0x51,0x02,0x42,0xB2,0x02,0x09,0x92,0x02,0xB2,0x02,0x92,
+    0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x53,0x02,0xF2,0x02,0x9F,0xDF,0x42,
+    0xFF,0xFF,0x06,0x99,0x75,0x50,0x0A,0xD3,0x0A,0xF2,0x0A,0xD2,0x0A,0xF1,0x0A,0xF2,
+    0x0A,0x42,0xD2,0x0A,0x05,0xF2,0x0A,0xF2,0x0A,0xD2,0x0A,0x91,0x0A,0x52,0x1B,0xDF,
+    0xFF,0x86,0x02,0xBA,0x75,0x11,0x02,0x93,0x02,0x42,0xB2,0x02,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0x42,0x92,0x02,0x05,0xB2,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x0F,
+    0x02,0xB9,0x7D,0x5D,0xFF,0xFF,0x04,0x5C,0xCF,0xEE,0x01,0xF1,0x01,0x11,0x02,0x11,
+    0x02,0x7F,0x32,0x10,0x02,0x05,0x0F,0x02,0xF0,0x01,0x11,0x02,0xD0,0x01,0xEE,0x01,
+    0xBC,0xB6,0xBF,0x04,0x05,0xFC,0xCE,0x72,0x02,0x71,0x02,0x92,0x02,0x92,0x02,0x93,
+    0x02,0x49,0x92,0x02,0x02,0x93,0x02,0x11,0x02,0xF9,0x3C,0x81,0x00,0xFD,0xF7,0xBF,
+    0x09,0x05,0xB3,0x2B,0x8F,0x01,0x31,0x02,0x10,0x02,0x30,0x02,0xF0,0x01,0x7F,0x2D,
+    0x10,0x02,0x05,0xF0,0x01,0xF0,0x01,0x10,0x02,0x10,0x02,0x6D,0x01,0x98,0x75,0x95,
+    0x96,0x01,0x95,0x44,0xD0,0x01,0x42,0x93,0x02,0x82,0x7F,0x11,0xB2,0x02,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x44,0x92,0x02,0x45,0xB2,0x02,0x42,0x92,0x02,0x0D,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x51,0x02,0xF0,0x01,0xF0,
+    0x01,0x72,0x02,0x55,0x13,0x77,0x4C,0x3A,0x9E,0xFF,0xF7,0x83,0x04,0xDF,0xFF,0xDF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x7F,0x15,0xFF,0xFF,0x0A,0xDE,0xFF,0xFF,0xFF,
+    0xBE,0xE7,0xB1,0x0A,0x71,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x42,0x92,0x02,0x0A,0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x93,0x02,
+    0xEF,0x01,0x97,0x3C,0xFF,0xFF,0xFF,0xFF,0x78,0x85,0x8D,0x01,0x46,0xEF,0x01,0x00,
+    0xF0,0x01,0x42,0xEF,0x01,0x01,0x2D,0x01,0xB5,0x4C,0x83,0x0E,0x7D,0xDF,0xF2,0x0A,
+    0x72,0x02,0xB3,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0xB3,0x02,0xB1,0x02,0x92,0x02,0x52,0x02,0xD1,0x0A,0x83,0x07,0x18,0x5D,0xF1,0x01,
+    0x52,0x02,0x52,0x02,0x32,0x02,0x72,0x02,0x52,0x02,0x72,0x02,0x44,0x52,0x02,0x01,
+    0x11,0x02,0xD3,0x0A,0x47,0xFF,0xFF,0x01,0x76,0x44,0x10,0x02,0x83,0x00,0x93,0x02,
+    0x81,0x42,0x93,0x02,0x05,0x92,0x02,0x93,0x02,0x93,0x02,0x72,0x02,0x71,0x02,0x3D,
+    0xCF,0x9D,0x05,0x3D,0xD7,0x91,0x02,0x73,0x02,0x92,0x02,0x94,0x02,0x92,0x02,0x7F,
+    0x32,0x93,0x02,0x04,0xB2,0x02,0x93,0x02,0x73,0x02,0x71,0x02,0x9C,0xBE,0x90,0x00,
+    0xDF,0xFF,0xAE,0x00,0xDF,0xFF,0x81,0x03,0xDC,0xBE,0xB3,0x02,0x71,0x02,0xB2,0x02,
+    0x49,0x92,0x02,0x04,0x93,0x02,0x92,0x02,0xB2,0x02,0x10,0x02,0xB6,0x54,0x81,0x00,
+    0xFE,0xFF,0xBF,0x09,0x06,0x56,0x34,0x30,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB3,
+    0x02,0xB2,0x02,0x7F,0x28,0xB3,0x02,0x42,0x92,0x02,0x07,0x93,0x02,0x92,0x02,0x92,
+    0x02,0xB3,0x02,0x73,0x02,0x11,0x02,0xD9,0x7D,0xFE,0xFF,0x94,0x96,0x01,0x75,0x44,
+    0xF0,0x01,0x81,0x00,0x92,0x02,0x83,0x7F,0x10,0x92,0x02,0x01,0xB2,0x02,0x92,0x02,
+    0x82,0x00,0xB2,0x02,0x45,0x92,0x02,0x08,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x81,0x0A,0x92,0x02,0x93,0x02,
+    0x93,0x02,0x73,0x02,0x10,0x02,0xEF,0x01,0x32,0x02,0xF5,0x0A,0x76,0x3C,0x39,0xA6,
+    0xFF,0xEF,0x44,0xFF,0xFF,0xBF,0x16,0x03,0xFE,0xFF,0xFF,0xFF,0xBA,0x7D,0xF0,0x01,
+    0x45,0x92,0x02,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,
+    0x81,0x01,0x70,0x02,0xDC,0xB6,0x81,0x03,0x1B,0x86,0x72,0x02,0x92,0x02,0x93,0x02,
+    0x42,0xB3,0x02,0x07,0xB2,0x02,0x93,0x02,0xB3,0x02,0xB3,0x02,0xD2,0x02,0xB3,0x02,
+    0xEF,0x01,0xF7,0x5C,0x84,0x06,0xD3,0x0A,0x52,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0x81,0xC1,0x0F,0xB2,0x02,0x72,0x02,0xD2,0x0A,0x7F,0xDF,0xFF,
+    0xFF,0xFE,0xFF,0xFF,0xFF,0x59,0x65,0x11,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x42,0xB2,0x02,0x02,0x92,0x02,0x31,0x02,0x13,
+    0x0B,0x87,0x04,0xB5,0x1B,0xF1,0x01,0x92,0x02,0x93,0x02,0x93,0x02,0x43,0x92,0x02,
+    0x00,0xB2,0x02,0x44,0x92,0x02,0x01,0x12,0x02,0x54,0x13,0x5E,0xFF,0xFF,0x06,0x5D,
+    0xD7,0x90,0x02,0x72,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x7F,0x28,0xB2,
+    0x02,0x49,0x92,0x02,0x04,0xB2,0x02,0x72,0x02,0xD3,0x02,0x5E,0xCF,0xDF,0xFF,0x7F,
+    0x00,0xFF,0xFF,0x82,0x04,0xFC,0xC6,0x92,0x02,0x91,0x02,0xB1,0x02,0xB2,0x02,0x88,
+    0x04,0xB3,0x02,0x92,0x02,0x93,0x02,0x10,0x02,0xD8,0x4C,0x81,0x00,0xFF,0xF7,0xAD,
+    0x00,0xDF,0xFF,0x99,0x06,0x35,0x3C,0x11,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0x7F,0x29,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x06,
+    0x93,0x02,0x93,0x02,0x10,0x02,0xDA,0x85,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x92,0x96,
+    0x02,0x95,0x44,0xF0,0x01,0x92,0x02,0x81,0x01,0xB2,0x02,0x92,0x02,0xBF,0x12,0xD6,
+    0x0C,0x93,0x02,0x93,0x02,0xB2,0x02,0x91,0x02,0x92,0x02,0xB4,0x02,0x93,0x02,0x11,
+    0x02,0xEF,0x01,0x51,0x02,0x34,0x13,0xD6,0x54,0xFD,0xB6,0x82,0x00,0xFE,0xFF,0xBF,
+    0x13,0x01,0xDF,0xFF,0xDF,0xFF,0x81,0x04,0xB6,0x23,0x31,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x81,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x81,0x05,0x93,0x02,0x93,0x02,
+    0x92,0x02,0xB2,0x02,0x11,0x02,0x74,0x13,0x42,0xFF,0xFF,0x01,0xFA,0x85,0x51,0x02,
+    0x43,0x93,0x02,0x08,0x92,0x02,0x92,0x02,0x93,0x02,0x73,0x02,0x93,0x02,0xB3,0x02,
+    0x93,0x02,0xEF,0x01,0x16,0x5D,0x84,0x04,0xF3,0x0A,0x51,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0x81,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x81,0x02,0x52,0x02,0xD2,0x0A,
+    0x9F,0xDF,0x42,0xFF,0xFF,0x82,0x00,0x93,0x02,0x42,0x92,0x02,0x82,0x04,0x92,0x02,
+    0x92,0x02,0x93,0x02,0x31,0x02,0x14,0x0B,0x86,0x06,0xFE,0xE7,0x14,0x0B,0x12,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x43,0x92,0x02,0x02,0xB2,0x02,0x93,0x02,
+    0x73,0x02,0x81,0x01,0xF1,0x01,0x57,0x34,0x9E,0x03,0x3D,0xD7,0x90,0x0A,0x73,0x02,
+    0x92,0x02,0x81,0x00,0x93,0x02,0x69,0x92,0x02,0x81,0x54,0x92,0x02,0x03,0xB2,0x02,
+    0x92,0x02,0x92,0x02,0xB2,0x02,0x62,0x92,0x02,0x47,0xB2,0x02,0x05,0x93,0x02,0x93,
+    0x02,0x92,0x02,0x51,0x02,0xF4,0x02,0x7F,0xD7,0x7F,0x04,0xFF,0xFF,0x03,0xBE,0xF7,
+    0x91,0x02,0x73,0x02,0x93,0x02,0x49,0x92,0x02,0x04,0xB2,0x02,0x92,0x02,0xB3,0x02,
+    0xEF,0x01,0x59,0x55,0x7F,0x0C,0xFF,0xFF,0x00,0x35,0x34,0x81,0x01,0xB2,0x02,0xB2,
+    0x02,0x7F,0x2A,0x92,0x02,0x01,0xB2,0x02,0x92,0x02,0x84,0x02,0x92,0x02,0x10,0x02,
+    0xD9,0x85,0x55,0xFF,0xFF,0xBF,0x40,0x42,0xB2,0x02,0x44,0x92,0x02,0x13,0xB1,0x02,
+    0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x91,0x02,0xB2,0x02,0x93,0x02,0x73,0x02,
+    0x31,0x02,0xF0,0x01,0x71,0x02,0xD5,0x23,0xFB,0x85,0xFE,0xF7,0xFF,0xFF,0xDF,0xFF,
+    0xDE,0xFF,0xDF,0xFF,0xDF,0xFF,0xBF,0x0E,0x08,0xDE,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,
+    0xFF,0x1D,0xCF,0x72,0x02,0x72,0x02,0x92,0x02,0x92,0x02,0x82,0xC2,0x01,0x93,0x02,
+    0x93,0x02,0x43,0x92,0x02,0x13,0xD1,0x01,0x79,0x6D,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,
+    0xDB,0x85,0x31,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,
+    0xB2,0x02,0x91,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xCF,0x01,0x17,0x5D,0xA4,0x00,
+    0x13,0x13,0x81,0x00,0xFE,0xFF,0x81,0x04,0xFE,0xFF,0xFE,0xFF,0x1D,0xAF,0x72,0x02,
+    0x72,0x02,0x43,0x92,0x02,0x01,0xB2,0x02,0x93,0x02,0x42,0x92,0x02,0x05,0x93,0x02,
+    0xB2,0x02,0xB2,0x02,0xB3,0x02,0xF0,0x01,0xD9,0x75,0x9E,0x02,0x5D,0xD7,0x90,0x02,
+    0x72,0x02,0x82,0x00,0xB2,0x02,0xA8,0x05,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x93,0x02,0x93,0x01,0x93,0x02,0xB3,0x02,0x6B,0x92,0x02,0x04,0xB2,0x02,
+    0xB2,0x02,0x51,0x02,0xD3,0x0A,0x5F,0xD7,0x8F,0x08,0xBD,0xEF,0xD9,0x7D,0xDB,0x75,
+    0xFB,0x75,0xBA,0x7D,0xBA,0x85,0xDB,0x7D,0xDB,0x7D,0xDA,0x7D,0x60,0xDB,0x7D,0x47,
+    0xDA,0x7D,0x07,0xDA,0x75,0xD9,0x85,0x36,0x5D,0x92,0x02,0x93,0x02,0x93,0x02,0xB2,
+    0x02,0xB2,0x02,0x48,0x92,0x02,0x05,0xB2,0x02,0x92,0x02,0x52,0x02,0x17,0x24,0xBA,
+    0x85,0xFA,0x7D,0x48,0xDA,0x7D,0x5F,0xDB,0x7D,0x03,0xDA,0x7D,0xDA,0x7D,0xDB,0x7D,
+    0xDB,0x7D,0x43,0xDA,0x7D,0x02,0xFB,0x75,0x99,0x75,0x7A,0x9E,0xBF,0x65,0xBF,0x43,
+    0xC1,0x82,0x10,0x93,0x02,0xB3,0x02,0xB2,0x02,0xB1,0x02,0x92,0x02,0x73,0x02,0x93,
+    0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x91,0x02,0x71,0x02,0xF0,0x01,0x11,0x02,0x14,
+    0x13,0x19,0x65,0x9D,0xDF,0x7F,0x12,0xFF,0xFF,0x06,0xFE,0xF7,0xFF,0xFF,0xFF,0xFF,
+    0x19,0x5D,0xF0,0x01,0x92,0x02,0xB2,0x02,0x83,0x01,0xB2,0x02,0xB2,0x02,0x81,0x01,
+    0xB2,0x02,0xB2,0x02,0x81,0x02,0x53,0x02,0x92,0x02,0x7F,0xDF,0x82,0x03,0xDB,0x8D,
+    0x12,0x02,0x92,0x02,0xB2,0x02,0x43,0x92,0x02,0x03,0xB2,0x02,0xD2,0x02,0xB2,0x02,
+    0xB2,0x02,0x86,0x00,0x9E,0xDF,0x9D,0x02,0x92,0x02,0x31,0x02,0x14,0x0B,0x44,0xFF,
+    0xFF,0x06,0xFE,0xFF,0xFF,0xFF,0xDA,0x75,0x11,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,
+    0x43,0x92,0x02,0x08,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0x93,0x02,0x51,0x02,0xDA,0xBE,0x9E,0x02,0x5C,0xD7,0x90,0x02,0x73,0x02,0xAC,0x04,
+    0x92,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x42,0x92,0x02,0x00,0x93,0x02,0x9F,0x47,0xB2,0x02,0x05,0x93,0x02,0xB2,
+    0x02,0xB3,0x02,0x32,0x02,0xD3,0x0A,0x7F,0xD7,0x8F,0x07,0x1E,0xCF,0x10,0x02,0xD0,
+    0x01,0x11,0x02,0xF1,0x01,0xF0,0x01,0x10,0x02,0xF1,0x01,0x61,0xF0,0x01,0x45,0xF1,
+    0x01,0x09,0x11,0x02,0x11,0x02,0xF2,0x01,0xF1,0x01,0x11,0x02,0xB3,0x02,0x92,0x02,
+    0x91,0x02,0x92,0x02,0x93,0x02,0x49,0x92,0x02,0x08,0xB2,0x02,0xD3,0x02,0x51,0x02,
+    0xF0,0x01,0x10,0x02,0x12,0x02,0xF1,0x01,0x11,0x02,0x11,0x02,0x42,0xF1,0x01,0x01,
+    0xF0,0x01,0xF1,0x01,0x61,0xF0,0x01,0x42,0xF1,0x01,0x05,0x10,0x02,0xF1,0x01,0xF0,
+    0x01,0xF1,0x01,0x4E,0x01,0xB3,0x1B,0xBF,0x65,0xBF,0x44,0x43,0x92,0x02,0x12,0x93,
+    0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0xB2,0x02,0x92,
+    0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0xB1,0x02,0x91,0x02,0x12,0x02,0xF0,0x01,0xD2,
+    0x0A,0xD8,0x54,0x5D,0xD7,0xBF,0x10,0x00,0xFE,0xFF,0x81,0x04,0x34,0x0B,0x31,0x02,
+    0x92,0x02,0x92,0x02,0xB2,0x02,0x83,0x08,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x93,0x02,0x92,0x02,0xB2,0x02,0xF1,0x01,0x15,0x34,0x43,0xFF,0xFF,0x02,0xFA,0x85,
+    0x31,0x02,0x93,0x02,0x84,0x03,0x92,0x02,0x93,0x02,0x93,0x02,0xB3,0x02,0xAB,0x00,
+    0xDF,0xFF,0x42,0xFF,0xFF,0x09,0x95,0x44,0xCF,0x01,0xB2,0x02,0x93,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x43,0x92,0x02,0x03,0x93,0x02,
+    0x51,0x02,0x13,0x13,0xDF,0xFF,0x87,0x00,0xDF,0xFF,0x95,0x01,0x5D,0xD7,0x90,0x0A,
+    0xAC,0x00,0xB2,0x02,0x56,0x92,0x02,0x00,0x93,0x02,0x81,0x42,0x92,0x02,0x01,0x93,
+    0x02,0xB2,0x02,0x68,0x92,0x02,0x04,0xB2,0x02,0xB2,0x02,0x51,0x02,0xD3,0x02,0x7E,
+    0xD7,0x8F,0x09,0x3D,0xDF,0x94,0x02,0x72,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x5F,0x92,0x02,0x42,0xB2,0x02,0x45,0x92,0x02,
+    0x06,0xB3,0x02,0xB4,0x02,0x72,0x02,0x73,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x87,
+    0x00,0xB3,0x02,0x42,0x92,0x02,0x06,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,
+    0x02,0xB3,0x02,0x93,0x02,0x65,0x92,0x02,0x09,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xF1,0x01,0x17,0x2C,0xBF,0x65,0xBF,
+    0x40,0xC6,0x16,0x93,0x02,0x91,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xB3,0x02,0x92,0x02,0x73,0x02,0x92,
+    0x02,0xD1,0x02,0x93,0x02,0x53,0x02,0xEF,0x01,0xB1,0x0A,0xD8,0x44,0x5D,0xE7,0xDF,
+    0xFF,0x81,0x00,0xFE,0xFF,0x83,0x00,0xDF,0xFF,0xBF,0x04,0x15,0xDF,0xFF,0xFF,0xFF,
+    0xDF,0xFF,0x7C,0xA6,0x30,0x02,0x91,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xB0,0x02,0x92,0x02,0x92,0x02,
+    0xB3,0x02,0x93,0x02,0x0F,0x02,0x7B,0x96,0x83,0x00,0xF9,0x85,0x85,0x04,0xB2,0x02,
+    0x92,0x02,0x73,0x02,0x93,0x02,0xB2,0x02,0xA2,0x00,0x93,0x02,0x86,0x02,0xFF,0xF7,
+    0xFF,0xFF,0xFE,0xF7,0x81,0x02,0x93,0x13,0x10,0x02,0xB3,0x02,0x42,0x92,0x02,0x0A,
+    0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,
+    0x93,0x02,0x11,0x02,0xB7,0x44,0x5F,0xFF,0xFF,0x01,0x5C,0xD7,0x70,0x0A,0x82,0x00,
+    0x93,0x02,0x68,0x92,0x02,0x02,0x93,0x02,0xB2,0x02,0xB1,0x02,0x83,0x00,0xB3,0x02,
+    0x50,0x92,0x02,0x05,0x72,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,
+    0x68,0x92,0x02,0x05,0xB2,0x02,0x92,0x02,0x92,0x02,0x71,0x02,0xD4,0x0A,0x5D,0xD7,
+    0x8E,0x0A,0xFE,0xFF,0x5E,0xDF,0xB3,0x02,0x72,0x02,0x93,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x63,0xB2,0x02,0x84,0x05,0xB2,0x02,0x72,
+    0x02,0xB2,0x02,0xB2,0x02,0xB3,0x02,0x92,0x02,0x88,0x01,0x92,0x02,0xB2,0x02,0x81,
+    0x42,0x93,0x02,0x01,0x92,0x02,0xB2,0x02,0x46,0x92,0x02,0x60,0xB2,0x02,0x46,0x92,
+    0x02,0x00,0xB3,0x02,0xBF,0x67,0xBF,0x48,0x0B,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0x42,0x92,0x02,0x0D,0xB2,0x02,0xB2,0x02,0xB3,0x02,0x53,0x02,0xCF,0x01,0x91,
+    0x0A,0x18,0x55,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,
+    0xFF,0x7F,0x05,0xFF,0xFF,0x05,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0x36,0x3C,0xF0,0x01,
+    0xB3,0x02,0x44,0x92,0x02,0x82,0x09,0x93,0x02,0xB1,0x02,0x93,0x02,0x92,0x02,0x92,
+    0x02,0x31,0x02,0x33,0x0B,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x81,0x00,0xFA,0x85,0x81,
+    0x0A,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0x93,0x02,0xEF,0x01,0xA5,0x00,0x13,0x0B,0x81,0x0B,0xFE,0xF7,0xFE,
+    0xFF,0xDE,0xFF,0xFF,0xFF,0x1C,0xC7,0x71,0x02,0x73,0x02,0x73,0x02,0x92,0x02,0xB2,
+    0x02,0x93,0x02,0x92,0x02,0x81,0x01,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x11,0x93,
+    0x02,0x72,0x02,0xD5,0x1B,0xF7,0x44,0xB8,0x34,0x99,0x3C,0x77,0x44,0x78,0x44,0x98,
+    0x44,0x77,0x3C,0x97,0x44,0x98,0x3C,0x78,0x3C,0xB8,0x3C,0xB8,0x3C,0x98,0x3C,0x35,
+    0x34,0xF8,0x64,0x91,0x01,0x91,0x02,0x93,0x02,0x42,0x92,0x02,0x6A,0xB2,0x02,0x03,
+    0x92,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0x51,0x92,0x02,0x05,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x69,0xB2,0x02,0x42,0x92,0x02,0x91,0x03,
+    0xFF,0xFF,0x5E,0xDF,0xB1,0x02,0x52,0x02,0x82,0xE7,0x01,0xB2,0x02,0x92,0x02,0x42,
+    0xB2,0x02,0x01,0x92,0x02,0x93,0x02,0x43,0x92,0x02,0x89,0xC2,0x02,0x93,0x02,0x92,
+    0x02,0x92,0x02,0x42,0xB2,0x02,0x00,0x92,0x02,0x44,0xB2,0x02,0x5F,0x92,0x02,0x87,
+    0x02,0x92,0x02,0x10,0x02,0x36,0x2C,0xBF,0x65,0xBF,0x40,0x00,0xB2,0x02,0x86,0x43,
+    0x92,0x02,0x06,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,
+    0x02,0x82,0x09,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x30,
+    0x02,0xF0,0x01,0xF3,0x0A,0xB9,0x7D,0x44,0xFF,0xFF,0x01,0xFF,0xF7,0xDF,0xFF,0x7F,
+    0x05,0xFF,0xFF,0x03,0xBE,0xEF,0xD2,0x02,0x32,0x02,0x74,0x02,0x85,0x08,0xB2,0x02,
+    0x93,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0x91,0x02,0xEF,0x01,0xF9,0x4C,
+    0x44,0xFF,0xFF,0x01,0xDB,0x85,0x11,0x02,0x43,0x92,0x02,0x82,0xC1,0x02,0xB3,0x02,
+    0x93,0x02,0xCF,0x01,0x84,0x00,0x7E,0xDF,0xA0,0x00,0xDF,0xFF,0x44,0xFF,0xFF,0x01,
+    0xF7,0x4C,0xD1,0x01,0x42,0x93,0x02,0x04,0x92,0x02,0x73,0x02,0xB3,0x02,0xB2,0x02,
+    0x93,0x02,0x42,0x92,0x02,0x13,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x71,0x02,
+    0xEF,0x01,0x10,0x02,0x11,0x02,0xF0,0x01,0xEF,0x01,0x10,0x02,0xF0,0x01,0xF0,0x01,
+    0x10,0x02,0x0F,0x02,0xEF,0x01,0x0F,0x02,0x10,0x02,0x8E,0x01,0x13,0x13,0x90,0x00,
+    0x3D,0xD7,0x83,0x01,0x91,0x02,0xB2,0x02,0x68,0x92,0x02,0x06,0x93,0x02,0x93,0x02,
+    0xB3,0x02,0xB3,0x02,0x93,0x02,0xB3,0x02,0x91,0x02,0x50,0x92,0x02,0x02,0x93,0x02,
+    0xB3,0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x67,0x92,0x02,0x00,0x91,0x02,
+    0x81,0x02,0x73,0x02,0xF4,0x02,0x5E,0xCF,0x8F,0x02,0x7E,0xDF,0x92,0x02,0x72,0x02,
+    0x81,0x04,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB3,0x02,0xB3,0x02,0x5F,0xB2,0x02,0x47,
+    0x92,0x02,0x82,0x03,0xB2,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x88,0x05,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB3,0x02,0x81,0x47,0x92,0x02,0x5F,0xB2,
+    0x02,0x47,0x92,0x02,0x01,0xB3,0x02,0xF0,0x01,0xBF,0x66,0xBF,0x41,0xC2,0x44,0x92,
+    0x02,0x04,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x81,0x00,0x93,0x02,
+    0x42,0x92,0x02,0x00,0xB2,0x02,0x82,0xC1,0x07,0xB3,0x02,0x92,0x02,0xD3,0x02,0xB2,
+    0x02,0x11,0x02,0xD0,0x01,0xB4,0x13,0x7C,0xB6,0x7F,0x08,0xFF,0xFF,0x08,0xDF,0xFF,
+    0xFF,0xFF,0x98,0x65,0xEF,0x01,0x74,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0x42,0x92,0x02,0x08,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0x92,0x02,
+    0x91,0x02,0x71,0x02,0xDC,0xCE,0x82,0x00,0xDE,0xFF,0x81,0x00,0x32,0x02,0x82,0x00,
+    0xB2,0x02,0x42,0x92,0x02,0x03,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0xA4,0x03,
+    0x93,0x02,0x31,0x02,0x34,0x0B,0xFF,0xF7,0x83,0x05,0x9E,0xCF,0x72,0x02,0x52,0x02,
+    0xB3,0x02,0x92,0x02,0xB3,0x02,0x43,0x92,0x02,0x43,0xB2,0x02,0x13,0x92,0x02,0x93,
+    0x02,0x92,0x02,0x90,0x02,0xB2,0x02,0x94,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xD2,
+    0x02,0x93,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x91,0x02,0x93,
+    0x02,0x31,0x02,0x97,0x13,0x90,0x05,0x1D,0xDF,0x90,0x02,0x53,0x02,0x73,0x02,0x94,
+    0x02,0x73,0x02,0x6A,0x93,0x02,0x02,0x73,0x02,0x92,0x02,0x92,0x02,0x81,0x00,0xB1,
+    0x02,0x51,0x92,0x02,0x03,0x74,0x02,0x73,0x02,0x92,0x02,0x73,0x02,0x6A,0x93,0x02,
+    0x03,0x73,0x02,0x73,0x02,0x13,0x02,0xD2,0x02,0x90,0x02,0x5E,0xDF,0xB2,0x02,0x72,
+    0x02,0x66,0x92,0x02,0x43,0xB2,0x02,0x84,0x06,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,
+    0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x48,0x92,0x02,0x08,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x81,0x03,0xB2,
+    0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x5F,0x92,0x02,0x00,0x93,0x02,0x82,0x01,0xB2,
+    0x02,0xB2,0x02,0x81,0x01,0x93,0x02,0x11,0x02,0xBF,0x66,0xBF,0x41,0x01,0x92,0x02,
+    0x93,0x02,0x43,0x92,0x02,0x02,0xB3,0x02,0x92,0x02,0x73,0x02,0x42,0x92,0x02,0x00,
+    0xB2,0x02,0x81,0x05,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0x81,0x0B,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0xB3,0x02,0xD3,0x02,0x93,0x02,
+    0x73,0x02,0x10,0x02,0x51,0x02,0xB7,0x44,0xFF,0xE7,0x82,0x02,0xFF,0xF7,0xFF,0xF7,
+    0xFE,0xFF,0x7F,0x02,0xFF,0xFF,0x05,0x54,0x0B,0x11,0x02,0x92,0x02,0x73,0x02,0xB2,
+    0x02,0x93,0x02,0x43,0x92,0x02,0x01,0xB2,0x02,0x93,0x02,0x43,0x92,0x02,0x09,0x10,
+    0x02,0xB7,0x1B,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,
+    0x85,0x31,0x02,0x49,0x92,0x02,0x01,0xB2,0x02,0xD0,0x01,0x84,0x00,0x9E,0xDF,0x98,
+    0xC5,0x01,0x31,0x02,0x15,0x0B,0x43,0xFF,0xFF,0x0A,0x9F,0xDF,0x73,0x13,0xF1,0x01,
+    0xB1,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB1,0x02,0x92,0x02,0xB2,0x02,
+    0x44,0x92,0x02,0x12,0x93,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x75,0x02,0x93,0x02,
+    0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x73,0x02,
+    0xB2,0x02,0xB3,0x02,0xB2,0x02,0x50,0x02,0x95,0x1B,0x90,0x02,0x3C,0xD7,0x2D,0x02,
+    0x0F,0x02,0x42,0x31,0x02,0x68,0x30,0x02,0x09,0x31,0x02,0x2F,0x02,0x31,0x02,0x4F,
+    0x02,0x4F,0x02,0x31,0x02,0x30,0x02,0x73,0x02,0x93,0x02,0xB2,0x02,0x81,0x01,0xB2,
+    0x02,0xB2,0x02,0x82,0x00,0xB2,0x02,0x81,0x00,0xB2,0x02,0x81,0x06,0xB3,0x02,0x92,
+    0x02,0x4F,0x02,0x30,0x02,0x30,0x02,0x31,0x02,0x31,0x02,0x69,0x30,0x02,0x04,0x32,
+    0x02,0x30,0x02,0x50,0x02,0xCF,0x01,0x8F,0x02,0x93,0x04,0xB3,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x81,0x09,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x81,0x03,0xB2,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x57,0x92,0x02,0x07,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,
+    0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x8B,0x04,0xB3,0x02,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0x5B,0x92,0x02,0x42,0xB2,0x02,0x08,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x87,0x01,
+    0xF0,0x01,0x16,0x2C,0x8F,0x00,0xDF,0xFF,0x84,0x06,0x56,0x34,0x11,0x02,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0xBF,0x11,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0x82,0x01,0x93,0x02,0xB2,0x02,0x83,0x01,0xB2,0x02,0xB2,0x02,0x8A,0x02,0x93,
+    0x02,0x93,0x02,0x91,0x02,0x83,0x00,0xB9,0x85,0x95,0xBF,0x41,0xC1,0x0A,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0xB3,0x02,0x93,0x02,
+    0x51,0x02,0x70,0x02,0x42,0xB2,0x02,0x87,0x0B,0xB2,0x02,0x92,0x02,0x93,0x02,0x72,
+    0x02,0x91,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x71,0x02,0xEF,0x01,0x12,0x13,0x7B,
+    0x96,0x7F,0x06,0xFF,0xFF,0x04,0xFB,0x75,0xF0,0x01,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x48,0x92,0x02,0x04,0x93,0x02,0xB3,0x02,0x92,0x02,0x0F,0x02,0xDA,0x75,0xB8,0x0E,
+    0x71,0x02,0xD2,0x0A,0x3A,0x8E,0x5A,0x8E,0xFB,0x85,0xF8,0x5C,0xD1,0x0A,0x31,0x02,
+    0xB3,0x02,0x92,0x02,0xB2,0x02,0xB1,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x46,0x92,
+    0x02,0x82,0x03,0x92,0x02,0x93,0x02,0xB2,0x02,0xD1,0x02,0x43,0x92,0x02,0x00,0xB2,
+    0x02,0x42,0x92,0x02,0x03,0x93,0x02,0x93,0x02,0x11,0x02,0x74,0x1B,0x8F,0x07,0xFE,
+    0xFF,0xBF,0xEF,0x5B,0x9E,0x7B,0x8E,0x7B,0x96,0x7A,0x96,0x7A,0x96,0x3B,0x9E,0x69,
+    0x5B,0x96,0x07,0x7B,0x8E,0x5B,0x9E,0x3B,0x9E,0x7A,0x9E,0x7B,0xA6,0x53,0x13,0x31,
+    0x02,0x92,0x02,0x42,0xB2,0x02,0x03,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x82,
+    0x0B,0x92,0x02,0xB2,0x02,0xB2,0x02,0x31,0x02,0x55,0x13,0x9B,0x9E,0x9B,0x96,0x7B,
+    0x96,0x7B,0x8E,0x7B,0x96,0x5B,0x9E,0x5B,0x9E,0x68,0x5B,0x96,0x04,0x9B,0x96,0x5A,
+    0x96,0x3C,0x96,0x7C,0x96,0xDF,0xEF,0x99,0xC1,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,
+    0x81,0x01,0x92,0x02,0x93,0x02,0x84,0x01,0xB2,0x02,0x92,0x02,0x57,0xB2,0x02,0x06,
+    0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x88,0x01,
+    0xB2,0x02,0x92,0x02,0x43,0xB2,0x02,0x82,0xDD,0x01,0x92,0x02,0xB2,0x02,0x42,0x92,
+    0x02,0x44,0xB2,0x02,0x99,0xC5,0x04,0x55,0x34,0x11,0x02,0x92,0x02,0x93,0x02,0x93,
+    0x02,0x7F,0x0A,0xB2,0x02,0x81,0x43,0x93,0x02,0x83,0x04,0xB3,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0x93,0x02,0x45,0x92,0x02,0x8B,0x00,0x93,0x02,0x43,0x92,0x02,0x03,
+    0x93,0x02,0x93,0x02,0x11,0x02,0xD9,0x7D,0x95,0xBF,0x40,0x06,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x81,0x07,0xB3,0x02,0xB3,0x02,
+    0x71,0x02,0x50,0x02,0x15,0x03,0xB3,0x02,0x92,0x02,0x93,0x02,0x84,0x44,0x92,0x02,
+    0x0B,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xD2,0x02,0x92,0x02,0x93,0x02,0x92,
+    0x02,0x31,0x02,0x10,0x02,0x75,0x44,0xFF,0xE7,0xBF,0x03,0x05,0x9E,0xE7,0x92,0x0A,
+    0x32,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x81,0x00,0xB2,0x02,0x81,0x00,0xB2,0x02,
+    0x81,0x07,0x91,0x02,0xB2,0x02,0x73,0x02,0x51,0x02,0xD2,0x02,0xBE,0xEF,0xFF,0xFF,
+    0xDF,0xFF,0x43,0xFF,0xFF,0x82,0x00,0x93,0x02,0xA8,0x02,0xB2,0x02,0xB2,0x02,0x92,
+    0x02,0x42,0xB2,0x02,0x0F,0x92,0x02,0x91,0x02,0x32,0x02,0x51,0x02,0xEF,0x01,0x10,
+    0x02,0x52,0x02,0xB2,0x02,0x92,0x02,0x94,0x02,0x93,0x02,0xB2,0x02,0x72,0x02,0xB3,
+    0x02,0x92,0x02,0xB2,0x02,0x88,0x04,0xB1,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,
+    0x02,0x83,0xC2,0x03,0x93,0x02,0x92,0x02,0x11,0x02,0x95,0x13,0x7F,0x07,0xFF,0xFF,
+    0x04,0xD4,0x23,0x11,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x81,0x05,0x92,0x02,0xB2,
+    0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x82,0x01,0xF0,0x01,0xD6,0x2B,0x73,
+    0xFF,0xFF,0x01,0xFE,0xFF,0xDF,0xFF,0x98,0x42,0x93,0x02,0x81,0x02,0x93,0x02,0x92,
+    0x02,0xB2,0x02,0x45,0x92,0x02,0x81,0xD9,0x00,0x93,0x02,0x82,0x01,0x93,0x02,0x93,
+    0x02,0x49,0x92,0x02,0x02,0xB2,0x02,0xB3,0x02,0x92,0x02,0x82,0xDB,0x44,0xB2,0x02,
+    0x06,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xA0,
+    0x06,0x35,0x3C,0x11,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x7F,
+    0x0D,0x92,0x02,0x42,0xB2,0x02,0x00,0x93,0x02,0x42,0x92,0x02,0x42,0xB2,0x02,0x46,
+    0x92,0x02,0x89,0x00,0x92,0x02,0x42,0xB2,0x02,0x82,0x01,0x92,0x02,0x10,0x02,0x96,
+    0xBF,0x40,0x03,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x43,0x92,0x02,0x06,0x93,
+    0x02,0xD1,0x02,0x72,0x02,0xB0,0x01,0x99,0x6D,0xDC,0x5D,0x10,0x02,0x84,0x00,0x93,
+    0x02,0x82,0x00,0xB2,0x02,0x82,0x04,0xB3,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0xB3,
+    0x02,0x81,0x09,0x92,0x02,0x72,0x02,0xD1,0x01,0x32,0x0B,0x9B,0xAE,0xFF,0xFF,0xFE,
+    0xFF,0xFE,0xFF,0xFF,0xF7,0xDF,0xFF,0xB4,0x00,0xFF,0xF7,0x85,0x05,0xDC,0xAE,0x32,
+    0x13,0xF1,0x01,0xB4,0x02,0x92,0x02,0xB2,0x02,0x83,0xC2,0x06,0x92,0x02,0x93,0x02,
+    0x92,0x02,0xB2,0x02,0xB3,0x02,0xD0,0x01,0x77,0x3C,0x46,0xFF,0xFF,0xAF,0x0F,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x74,0x02,0x93,0x02,0x92,0x02,0x93,
+    0x02,0xB2,0x02,0x91,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x8B,
+    0x06,0xB2,0x02,0xB2,0x02,0x73,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x44,
+    0xB2,0x02,0x81,0x00,0x31,0x02,0x94,0x00,0xFE,0xFF,0xAC,0x00,0xDE,0xFF,0x83,0x0C,
+    0x95,0x23,0x31,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x93,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x81,0x02,0x92,0x02,0x10,0x02,
+    0xD6,0x1B,0x82,0x00,0xDF,0xFF,0xAC,0x02,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x50,0xFF,
+    0xFF,0x89,0x08,0x92,0x02,0xB2,0x02,0x92,0x02,0x91,0x02,0xB2,0x02,0x93,0x02,0xB1,
+    0x02,0xB1,0x02,0xB3,0x02,0x81,0x43,0x93,0x02,0x91,0x47,0x93,0x02,0x81,0x04,0x93,
+    0x02,0xB3,0x02,0x91,0x02,0xB2,0x02,0xB2,0x02,0x8B,0x03,0xB3,0x02,0x92,0x02,0x92,
+    0x02,0xB3,0x02,0x84,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x8F,0x01,0x93,0x02,0x93,
+    0x02,0x42,0x92,0x02,0x42,0x93,0x02,0x05,0xB1,0x02,0x92,0x02,0x93,0x02,0x92,0x02,
+    0x92,0x02,0xB1,0x02,0xA2,0x00,0x35,0x34,0x82,0x01,0xB2,0x02,0xB2,0x02,0x7F,0x11,
+    0x92,0x02,0x0A,0x93,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0xB3,0x02,0xB1,0x02,0xB3,
+    0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x8C,0x09,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x73,0x02,0xF1,0x01,0xB9,0x7D,0x95,
+    0xBF,0x43,0x0B,0x92,0x02,0xB2,0x02,0xB2,0x02,0x73,0x02,0xB3,0x02,0xB3,0x02,0x91,
+    0x02,0xEF,0x01,0x79,0x3C,0xFF,0xFF,0x79,0x65,0xF0,0x01,0x83,0x01,0x92,0x02,0x92,
+    0x02,0x83,0xC1,0x11,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0x93,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0x10,0x02,0x51,0x02,0x59,0x65,
+    0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0x75,0xFF,0xFF,0x0D,0x79,0x6D,0xB6,0x3C,
+    0xD9,0x4C,0xF8,0x54,0xF9,0x44,0x17,0x24,0x51,0x02,0xF0,0x01,0xB2,0x02,0xB2,0x02,
+    0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x46,0x92,0x02,0x04,0x93,0x02,0x92,0x02,
+    0xB1,0x02,0x31,0x02,0x9C,0xAE,0x89,0xC8,0xA0,0x00,0x92,0x02,0x85,0x0F,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,
+    0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x45,0x92,
+    0x02,0x82,0x03,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x82,0x42,0x92,0x02,0x04,
+    0xB2,0x02,0x92,0x02,0x92,0x02,0x11,0x02,0x94,0x13,0x8F,0x00,0xDF,0xFF,0x43,0xFF,
+    0xFF,0x00,0xDF,0xFF,0xAB,0x02,0xDF,0xFF,0xFF,0xF7,0xDF,0xFF,0x81,0x00,0x96,0x1B,
+    0x83,0x00,0xB2,0x02,0x84,0x00,0xB2,0x02,0x81,0x03,0x93,0x02,0x92,0x02,0xF1,0x01,
+    0xF5,0x1B,0xAE,0x00,0xDF,0xFF,0x54,0xFF,0xFF,0x8A,0x08,0x92,0x02,0x93,0x02,0xB1,
+    0x02,0xB3,0x02,0x94,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0xB3,0x02,0x44,0x92,0x02,
+    0x00,0x93,0x02,0x4F,0xB2,0x02,0x48,0x92,0x02,0x01,0x91,0x02,0x92,0x02,0x81,0x00,
+    0xB1,0x02,0x8A,0x03,0xB2,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x81,0x00,0x93,0x02,
+    0x82,0x04,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x4F,0xB2,0x02,0x42,
+    0x92,0x02,0x45,0xB2,0x02,0x06,0x73,0x02,0x73,0x02,0x92,0x02,0xB3,0x02,0xD2,0x02,
+    0x92,0x02,0xB2,0x02,0xA0,0x05,0x37,0x34,0xF1,0x01,0x93,0x02,0x92,0x02,0x93,0x02,
+    0x92,0x02,0x7F,0x0E,0x93,0x02,0x09,0x72,0x02,0x73,0x02,0x73,0x02,0x72,0x02,0x93,
+    0x02,0x93,0x02,0x72,0x02,0x94,0x02,0x92,0x02,0xB2,0x02,0x90,0xC1,0x07,0xB3,0x02,
+    0x92,0x02,0x91,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0xF0,0x01,0x78,0x7D,0x95,0xBF,
+    0x40,0x01,0x92,0x02,0xB2,0x02,0x44,0x92,0x02,0x09,0xB2,0x02,0x92,0x02,0xF0,0x01,
+    0x76,0x34,0xFF,0xFF,0xFF,0xFF,0xF8,0x4C,0x10,0x02,0x92,0x02,0xB3,0x02,0x83,0xC4,
+    0x00,0x93,0x02,0x83,0xC1,0x81,0x0B,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x72,
+    0x02,0xEF,0x01,0xF6,0x2B,0xDF,0xE7,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0xDF,0xFF,0xB3,
+    0x08,0xF2,0x0A,0x8F,0x01,0xF0,0x01,0x0F,0x02,0x10,0x02,0xF1,0x01,0x72,0x02,0x92,
+    0x02,0xB1,0x02,0x43,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0x83,0x05,0xB2,0x02,0xB1,
+    0x02,0x93,0x02,0x93,0x02,0x2F,0x02,0x75,0x13,0x45,0xFF,0xFF,0x00,0xFE,0xFF,0xB2,
+    0x0F,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0xB3,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,
+    0x02,0x87,0xC3,0x42,0xB2,0x02,0x00,0x92,0x02,0x83,0x00,0xB2,0x02,0x42,0x92,0x02,
+    0x01,0x11,0x02,0x95,0x1B,0x53,0xFF,0xFF,0x01,0xFE,0xFF,0xFE,0xFF,0x70,0xFF,0xFF,
+    0x05,0xD6,0x1B,0x11,0x02,0xB2,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x43,0x92,0x02,
+    0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x83,0x00,0xF5,0x23,0x73,0xFF,0xFF,0x00,0xFE,
+    0xFF,0x99,0x09,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0x73,0x02,0x92,
+    0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x5D,0x92,0x02,0x04,0xB3,0x02,0xD3,0x02,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0x42,0x93,0x02,0x88,0x05,0x93,0x02,0xB3,0x02,0x92,0x02,
+    0x71,0x0A,0x93,0x02,0x93,0x02,0x43,0x92,0x02,0x00,0x93,0x02,0x53,0x92,0x02,0x42,
+    0xB2,0x02,0x45,0x92,0x02,0x05,0x91,0x02,0xB1,0x02,0xB3,0x02,0x94,0x02,0x74,0x02,
+    0x73,0x02,0xA1,0x06,0xB4,0x2B,0x8E,0x01,0x10,0x02,0x10,0x02,0xEF,0x01,0x10,0x02,
+    0xF0,0x01,0x7F,0x10,0x10,0x02,0x08,0x0E,0x02,0x2F,0x02,0x0F,0x02,0x0F,0x02,0x10,
+    0x02,0x30,0x02,0x92,0x0A,0x92,0x02,0x93,0x02,0x45,0x92,0x02,0x00,0xB2,0x02,0x89,
+    0x08,0x93,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0xF0,0x01,0x91,0x02,0x3C,
+    0xCF,0xFE,0xFF,0x94,0xBF,0x43,0x06,0xB2,0x02,0x93,0x02,0x92,0x02,0xB1,0x02,0x71,
+    0x02,0xB0,0x01,0x76,0x2C,0x42,0xFF,0xFF,0x03,0x19,0x55,0x11,0x02,0x92,0x02,0x93,
+    0x02,0x45,0x92,0x02,0x14,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,
+    0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x73,0x02,0xB3,0x02,0x90,
+    0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0xF1,0x01,0xF3,0x0A,0xFD,0xB6,0x76,
+    0xFF,0xFF,0x0A,0xB5,0x13,0xF2,0x01,0xB2,0x02,0xD3,0x02,0x92,0x02,0xB0,0x02,0x91,
+    0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x42,0x93,0x02,0x45,0x92,0x02,0x00,
+    0x91,0x02,0x81,0x01,0xF0,0x01,0x39,0x55,0x47,0xFF,0xFF,0xAC,0x00,0xB2,0x02,0x82,
+    0x00,0x92,0x02,0x81,0x03,0x92,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x42,0x93,0x02,
+    0x05,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x81,0x00,0x93,
+    0x02,0x88,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x83,0x00,0xB3,0x02,0x83,0x02,0xB3,
+    0x02,0x10,0x02,0x75,0x1B,0x8F,0x04,0xFE,0xFF,0xFD,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,
+    0xFF,0x6A,0xFF,0xF7,0x01,0xFF,0xFF,0xFF,0xF7,0x81,0x00,0xFF,0xF7,0x81,0x02,0xB3,
+    0x23,0x11,0x02,0x92,0x02,0x42,0xB2,0x02,0x01,0x92,0x02,0xB2,0x02,0x82,0x42,0x93,
+    0x02,0x04,0x92,0x02,0x92,0x02,0x10,0x02,0xB5,0x23,0xFF,0xF7,0x81,0x6E,0xFF,0xF7,
+    0x03,0xFF,0xEF,0xFF,0xEF,0xFD,0xFF,0xDF,0xFF,0x9B,0x07,0xB2,0x02,0x92,0x02,0x91,
+    0x02,0xB1,0x02,0xB2,0x02,0x93,0x02,0xB3,0x02,0x92,0x02,0x5C,0x93,0x02,0x01,0x94,
+    0x02,0x94,0x02,0x42,0x92,0x02,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x49,0x92,0x02,
+    0x06,0xB3,0x02,0xB2,0x02,0x91,0x02,0x93,0x02,0xB3,0x02,0x91,0x02,0xB2,0x02,0x5F,
+    0x93,0x02,0x06,0xB2,0x02,0xB2,0x02,0x92,0x02,0x91,0x02,0xB2,0x02,0xB2,0x02,0x92,
+    0x02,0xA0,0x05,0x9B,0xA6,0x77,0x75,0xD8,0x7D,0xD9,0x7D,0xB9,0x85,0xB8,0x85,0x7F,
+    0x11,0xD8,0x85,0x08,0xB8,0x85,0xB8,0x7D,0xD9,0x7D,0x99,0x7D,0xD7,0x95,0x3B,0x86,
+    0x14,0x0B,0x51,0x02,0xB3,0x02,0x8E,0x08,0xB2,0x02,0xB2,0x02,0xB3,0x02,0x73,0x02,
+    0x73,0x02,0xB2,0x02,0x10,0x02,0x31,0x02,0x9E,0xA6,0x56,0xFF,0xFF,0xBF,0x45,0xC1,
+    0x01,0xF0,0x01,0xF5,0x33,0x43,0xFF,0xFF,0x05,0x19,0x55,0x10,0x02,0xB2,0x02,0xB3,
+    0x02,0x92,0x02,0xB2,0x02,0x85,0x05,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0x82,0x0A,0x93,0x02,0x93,0x02,0x72,0x0A,0xB2,0x02,0x94,0x02,0x73,
+    0x02,0x92,0x02,0xB1,0x02,0xF0,0x01,0x71,0x02,0x1A,0x8E,0xB5,0x07,0x76,0x1B,0x10,
+    0x02,0xB2,0x02,0x94,0x02,0x73,0x02,0x93,0x02,0xB3,0x02,0x93,0x02,0x47,0x92,0x02,
+    0x01,0xB2,0x02,0xB2,0x02,0x43,0x92,0x02,0x04,0x71,0x02,0x93,0x02,0x5E,0xDF,0xFF,
+    0xFF,0xDF,0xFF,0xB4,0x00,0xB2,0x02,0x83,0x01,0xB2,0x02,0x92,0x02,0x42,0xB2,0x02,
+    0x00,0x92,0x02,0x42,0xB2,0x02,0x06,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0x87,0x00,0xB2,0x02,0x43,0x92,0x02,0x00,0xB2,0x02,0x81,
+    0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x81,0x02,0x93,0x02,0x11,0x02,0x95,0x13,0x50,
+    0xFF,0xFF,0x03,0x7D,0xD7,0x53,0x1B,0x14,0x13,0x75,0x13,0x6A,0x54,0x13,0x0E,0x74,
+    0x13,0x74,0x13,0x73,0x13,0x73,0x13,0x75,0x13,0x75,0x13,0x74,0x13,0xB3,0x0A,0x73,
+    0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x43,0x92,0x02,
+    0x00,0xB2,0x02,0x82,0x07,0x72,0x02,0xD2,0x02,0x74,0x13,0x54,0x13,0x54,0x1B,0x54,
+    0x13,0x54,0x13,0x73,0x13,0x6A,0x54,0x13,0x03,0x55,0x13,0xD3,0x12,0xD4,0x2B,0xFF,
+    0xEF,0x4F,0xFF,0xFF,0x89,0xC1,0x00,0xB2,0x02,0x81,0x04,0x72,0x0A,0xB3,0x02,0x95,
+    0x02,0x30,0x02,0x30,0x02,0x5E,0x10,0x02,0x04,0x0F,0x02,0x2F,0x02,0xB2,0x02,0xB2,
+    0x02,0xB3,0x02,0x4C,0x92,0x02,0x04,0xB2,0x02,0x72,0x02,0x10,0x02,0x10,0x02,0x0F,
+    0x02,0x5E,0x10,0x02,0x06,0x30,0x02,0x30,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x92,
+    0x02,0xB1,0x02,0xA2,0xFF,0x1C,0x02,0x9B,0x6D,0x30,0x02,0xB2,0x02,0x83,0x00,0xB2,
+    0x02,0x8A,0xC2,0x04,0xB1,0x02,0x94,0x02,0x73,0x02,0x11,0x02,0xFA,0x8D,0x57,0xFF,
+    0xFF,0xBF,0x3B,0x43,0xB2,0x02,0x0B,0x92,0x02,0x93,0x02,0x92,0x02,0xB3,0x02,0x92,
+    0x02,0xB2,0x02,0x71,0x02,0xD0,0x01,0xF6,0x2B,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x81,
+    0x07,0x19,0x4D,0x10,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,
+    0x02,0x82,0x47,0x92,0x02,0x0D,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x74,0x02,
+    0x93,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x11,0x02,0x30,0x02,
+    0x17,0x65,0xB4,0x06,0x95,0x13,0x30,0x02,0xD3,0x02,0x93,0x02,0xB1,0x02,0x74,0x02,
+    0x93,0x02,0x82,0x42,0xB2,0x02,0x83,0x06,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,
+    0x93,0x02,0xF0,0x01,0xD5,0x2B,0x48,0xFF,0xFF,0x00,0x1A,0x86,0x82,0x00,0xB2,0x02,
+    0x82,0x01,0xB2,0x02,0xB2,0x02,0x88,0x05,0x7D,0xDF,0xF2,0x0A,0x51,0x02,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0x43,0x92,0x02,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,0x81,0x00,
+    0x7F,0xDF,0x84,0x00,0x93,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x47,0x92,0x02,0x06,
+    0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x81,0x01,
+    0x93,0x02,0x92,0x02,0x82,0x00,0x93,0x02,0x81,0x05,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0x93,0x02,0x92,0x02,0xB2,0x02,0x48,0x92,0x02,0x01,0xB2,0x02,0x93,0x02,0x81,0x02,
+    0xB3,0x02,0x11,0x02,0x95,0x1B,0x90,0x05,0x5D,0xCF,0xEF,0x01,0xF1,0x01,0x30,0x02,
+    0x50,0x02,0x30,0x02,0x68,0x10,0x02,0x08,0x30,0x02,0x11,0x02,0x30,0x02,0x10,0x02,
+    0xF1,0x01,0x12,0x02,0x30,0x02,0x72,0x02,0x93,0x02,0x4C,0x92,0x02,0x04,0x93,0x02,
+    0x93,0x02,0x73,0x02,0x12,0x02,0x11,0x02,0x42,0x30,0x02,0x01,0x11,0x02,0x11,0x02,
+    0x67,0x10,0x02,0x04,0x2F,0x02,0x30,0x02,0x31,0x02,0xB0,0x01,0x93,0x0A,0x9D,0x07,
+    0x93,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x51,0x02,0xD8,0x4C,0x3A,0x96,0x1A,0x86,
+    0x42,0xFA,0x85,0x01,0x1A,0x86,0x1A,0x86,0x4F,0xFA,0x85,0x00,0x1A,0x86,0x43,0xFA,
+    0x85,0x09,0x1A,0x86,0x1A,0x86,0xFA,0x85,0xFA,0x85,0x3B,0x96,0x58,0x5D,0xB2,0x02,
+    0x92,0x02,0xB4,0x02,0xB2,0x02,0x88,0x09,0x93,0x02,0xB2,0x02,0xB2,0x02,0x32,0x02,
+    0x16,0x24,0x5B,0x8E,0x1A,0x7E,0xFA,0x8D,0x1B,0x86,0x1A,0x86,0x43,0xFA,0x85,0x01,
+    0x1A,0x86,0x1A,0x86,0x50,0xFA,0x85,0x42,0x1A,0x86,0x0A,0xFA,0x85,0xFA,0x85,0x1A,
+    0x86,0x1A,0x86,0xDA,0x85,0xD2,0x02,0x72,0x02,0x93,0x02,0x93,0x02,0x94,0x02,0x92,
+    0x02,0xBF,0x3B,0x06,0xFE,0xFF,0xFF,0xFF,0xFA,0x7D,0xEF,0x01,0x51,0x02,0x92,0x02,
+    0x93,0x02,0x81,0x01,0xB2,0x02,0x93,0x02,0x83,0x0F,0xB3,0x02,0xB2,0x02,0xB2,0x02,
+    0x93,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xCF,0x02,
+    0x73,0x02,0xD1,0x01,0x58,0x4D,0xFF,0xFF,0xFD,0xFF,0x96,0xBF,0x3B,0xC1,0x83,0xC1,
+    0x03,0x92,0x02,0x91,0x02,0xF0,0x01,0xF5,0x23,0x42,0xFF,0xFF,0x82,0x00,0xF9,0x4C,
+    0x91,0x00,0x93,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x44,0x92,0x02,0x04,0x93,0x02,
+    0x92,0x02,0x72,0x02,0xF0,0x01,0x97,0x4C,0x82,0x00,0xDF,0xFF,0xAF,0x08,0x75,0x1B,
+    0x10,0x02,0x72,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,
+    0x42,0x93,0x02,0x02,0x72,0x02,0x72,0x02,0xB3,0x02,0x42,0xB2,0x02,0x81,0x06,0x92,
+    0x02,0x92,0x02,0x10,0x02,0x1A,0x8E,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x8A,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x44,0x92,0x02,0x00,0xF0,0x01,0x85,0x02,0xF3,0x0A,0x52,
+    0x02,0x92,0x02,0x85,0x02,0xB2,0x02,0x91,0x02,0x92,0x02,0x85,0x03,0x79,0x6D,0x11,
+    0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0x93,0x02,0x47,0x92,0x02,0x06,0x93,
+    0x02,0x93,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,0x82,0xC1,0x09,
+    0xB2,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x93,0x02,0x93,0x02,0x87,0x07,0xB3,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x73,0x02,
+    0x92,0x02,0x11,0x02,0x94,0x13,0x91,0x05,0x70,0x0A,0x53,0x02,0xB2,0x02,0x93,0x02,
+    0x93,0x02,0xB3,0x02,0x67,0x93,0x02,0x07,0xB2,0x02,0x93,0x02,0x92,0x02,0x93,0x02,
+    0x93,0x02,0xB2,0x02,0x91,0x02,0x92,0x02,0x8D,0x03,0x92,0x02,0x93,0x02,0x92,0x02,
+    0x92,0x02,0x42,0x93,0x02,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x67,0x93,0x02,0x04,
+    0x92,0x02,0x92,0x02,0xB3,0x02,0x31,0x02,0x14,0x13,0x9A,0x08,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0xB3,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x31,0x02,0x9D,0xAE,0x60,0xFF,
+    0xFF,0x04,0xBF,0xD7,0x92,0x02,0x52,0x02,0x93,0x02,0xB3,0x02,0x8B,0x01,0x10,0x02,
+    0x39,0x5D,0x63,0xFF,0xFF,0x06,0xF3,0x0A,0x31,0x02,0xB1,0x02,0x92,0x02,0x93,0x02,
+    0xB2,0x02,0x93,0x02,0xBF,0x37,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x0E,0xBC,0xAE,0x2F,
+    0x02,0x31,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x43,0x92,0x02,0x0A,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0xCF,0x01,0x56,0x34,0xFF,
+    0xFF,0xFF,0xFF,0xDF,0xFF,0x96,0xBF,0x3A,0x00,0xB2,0x02,0x81,0x00,0xB3,0x02,0x81,
+    0x05,0xB2,0x02,0xB2,0x02,0x72,0x02,0x93,0x02,0xB0,0x01,0xD5,0x23,0x46,0xFF,0xFF,
+    0x81,0x00,0x92,0x02,0x8F,0x00,0xB2,0x02,0x81,0x00,0xB3,0x02,0x81,0x09,0x72,0x0A,
+    0x92,0x02,0xB2,0x02,0xB3,0x02,0x94,0x02,0xB2,0x02,0x93,0x02,0x53,0x02,0x0F,0x02,
+    0x34,0x34,0x42,0xFF,0xFF,0x00,0xFE,0xF7,0x81,0x00,0xFE,0xFF,0xAB,0x04,0x95,0x1B,
+    0x10,0x02,0x92,0x02,0x92,0x02,0x72,0x02,0x42,0xB2,0x02,0x01,0x92,0x02,0x92,0x02,
+    0x81,0x0E,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x74,0x02,
+    0xB2,0x02,0xB1,0x02,0x10,0x02,0x33,0x13,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,
+    0x89,0xC1,0x00,0xB2,0x02,0x81,0x00,0x72,0x02,0x88,0x00,0x7E,0xDF,0x81,0x00,0x93,
+    0x02,0x84,0x05,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x51,0x02,0xD1,0x0A,0x83,
+    0x05,0x59,0x5D,0x13,0x02,0x92,0x02,0xB1,0x02,0xB3,0x02,0x93,0x02,0x49,0x92,0x02,
+    0x42,0xB2,0x02,0x82,0xC1,0x08,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,
+    0x92,0x02,0x93,0x02,0xB2,0x02,0xB1,0x02,0x52,0x92,0x02,0x01,0xF2,0x01,0x95,0x13,
+    0x90,0x04,0x3C,0xD7,0x90,0x0A,0x72,0x02,0x93,0x02,0x73,0x02,0x81,0x6A,0x92,0x02,
+    0x03,0xB3,0x02,0xB2,0x02,0xB2,0x02,0xB1,0x02,0x8F,0x06,0x92,0x02,0xB1,0x02,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0x73,0x02,0x92,0x02,0x81,0xE7,0x00,0x93,0x02,0x82,0x00,
+    0x34,0x13,0x9A,0x01,0x92,0x02,0xB2,0x02,0x44,0x92,0x02,0x01,0x51,0x02,0x3B,0x96,
+    0xA0,0x05,0xFC,0xC6,0xB2,0x02,0x72,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x49,0x92,
+    0x02,0x02,0x93,0x02,0x11,0x02,0xF8,0x44,0xA2,0x07,0xDE,0xEF,0xD4,0x0A,0x52,0x02,
+    0x92,0x02,0x72,0x0A,0xB1,0x02,0x92,0x02,0xB2,0x02,0xBF,0x31,0x00,0xFE,0xFF,0x83,
+    0x08,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0x9E,0xDF,0xB3,0x0A,0x12,0x02,0x92,
+    0x02,0xB2,0x02,0x89,0xC2,0x0B,0x93,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,
+    0x92,0x02,0xB3,0x02,0xF0,0x01,0x93,0x13,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0x57,0xFF,
+    0xFF,0xBF,0x3A,0xC4,0x06,0xB2,0x02,0x93,0x02,0x92,0x02,0x91,0x02,0xD0,0x01,0xB6,
+    0x23,0xFF,0xF7,0x86,0x00,0xF9,0x54,0x91,0xC6,0x0C,0xB2,0x02,0xB2,0x02,0x93,0x0A,
+    0x92,0x02,0xD2,0x02,0x71,0x02,0x73,0x0A,0xB4,0x02,0xEF,0x01,0xD4,0x23,0xFF,0xEF,
+    0xFF,0xFF,0xDE,0xFF,0xAE,0x16,0x95,0x13,0x11,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,
+    0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x94,0x02,
+    0xF1,0x01,0x3A,0x8E,0x49,0xFF,0xFF,0x88,0xC1,0x03,0xB2,0x02,0x92,0x02,0xD0,0x01,
+    0x36,0x5D,0x84,0x02,0xF2,0x0A,0x51,0x02,0x92,0x02,0x82,0x05,0x93,0x02,0x93,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x85,0x01,0x59,0x65,0xF1,0x01,0x42,0x92,
+    0x02,0x83,0x01,0xB2,0x02,0xB2,0x02,0x82,0x0A,0x93,0x02,0x74,0x02,0x73,0x02,0x92,
+    0x02,0xB1,0x02,0xB2,0x02,0x92,0x02,0x73,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x42,
+    0x93,0x02,0x03,0xB2,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x4F,0x31,0x02,0x05,0x30,
+    0x02,0x31,0x02,0x32,0x02,0x31,0x02,0xD1,0x01,0x14,0x13,0x90,0x05,0x5D,0xD7,0x90,
+    0x0A,0x73,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x68,0xB2,0x02,0x02,0x92,0x02,0xB2,
+    0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x53,0x92,0x02,0x42,0xB2,0x02,0x01,
+    0x93,0x02,0x92,0x02,0x5F,0xB2,0x02,0x4A,0x92,0x02,0xA4,0x00,0x3C,0x8E,0x9E,0x06,
+    0xDF,0xFF,0xFF,0xFF,0xFC,0xBE,0x92,0x02,0x72,0x02,0x93,0x02,0xB2,0x02,0x48,0x92,
+    0x02,0x00,0xB2,0x02,0x81,0x00,0xF1,0x01,0xA3,0x07,0xDF,0xF7,0xF3,0x02,0x31,0x02,
+    0xB3,0x02,0x92,0x02,0xB1,0x02,0x93,0x02,0xB3,0x02,0xBF,0x32,0x00,0xDF,0xFF,0x81,
+    0x00,0xDE,0xFF,0x43,0xFF,0xFF,0x10,0x54,0x13,0xEF,0x01,0xD4,0x02,0x93,0x02,0x92,
+    0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x81,0x09,0xB3,0x02,0x92,0x02,0x92,
+    0x02,0x93,0x02,0xB3,0x02,0x10,0x02,0xD1,0x0A,0xDF,0xEF,0xFF,0xFF,0xFF,0xF7,0x58,
+    0xFF,0xFF,0xBF,0x3A,0x00,0xB2,0x02,0x81,0x07,0x93,0x02,0xB2,0x02,0xB2,0x02,0xB4,
+    0x02,0x93,0x02,0xEF,0x01,0xB4,0x1B,0xFF,0xF7,0x47,0xFF,0xFF,0x81,0x00,0x93,0x02,
+    0x8F,0x01,0x93,0x02,0xB2,0x02,0x83,0x0F,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0xB1,0x02,0x92,0x02,0x73,0x02,0x94,0x02,0x0F,0x02,0xB4,0x23,
+    0xDE,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xF7,0x6C,0xFF,0xFF,0x00,0x95,0x1B,0x83,0x42,
+    0x92,0x02,0x83,0xC1,0x00,0xB3,0x02,0x81,0x08,0x93,0x02,0xB1,0x02,0xB3,0x02,0xD1,
+    0x01,0xB4,0x1B,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x8A,0x03,0xB2,0x02,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0x42,0xB2,0x02,0x03,0x92,0x02,0x73,0x02,0xD0,0x01,0x17,
+    0x5D,0x83,0x03,0x7E,0xE7,0xD3,0x0A,0x52,0x02,0x93,0x02,0x82,0x42,0xB2,0x02,0x04,
+    0x92,0x02,0x92,0x02,0x93,0x02,0x52,0x02,0xD2,0x0A,0x83,0x05,0x58,0x6D,0x30,0x02,
+    0x92,0x02,0x93,0x02,0xB2,0x02,0x91,0x02,0x47,0x92,0x02,0x01,0xB2,0x02,0xB3,0x02,
+    0x44,0x93,0x02,0x01,0x92,0x02,0x93,0x02,0x42,0x92,0x02,0x0B,0xB2,0x02,0xB1,0x02,
+    0x72,0x02,0x94,0x02,0xB3,0x02,0xF0,0x01,0xF3,0x12,0xDA,0x8D,0x3A,0x9E,0x1B,0x8E,
+    0xFA,0x8D,0x1B,0x86,0x48,0x1A,0x8E,0x06,0xFA,0x8D,0x3B,0x8E,0xFA,0x8D,0x1A,0x8E,
+    0x1A,0x8E,0xBA,0x85,0x7B,0x9E,0x91,0x00,0x90,0x02,0x83,0x00,0x92,0x02,0xA8,0xC4,
+    0x01,0x93,0x02,0x93,0x02,0x8F,0x01,0xB3,0x02,0x93,0x02,0x42,0x92,0x02,0x01,0xB2,
+    0x02,0x92,0x02,0x60,0xB2,0x02,0x87,0x05,0xB2,0x02,0x92,0x02,0x93,0x02,0x31,0x02,
+    0x54,0x0B,0xDF,0xF7,0x99,0x08,0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,
+    0xB3,0x02,0x92,0x02,0x31,0x02,0x5C,0x96,0x60,0xFF,0xFF,0x03,0x1C,0xBF,0x92,0x02,
+    0x73,0x02,0x93,0x02,0x49,0x92,0x02,0x81,0x02,0xB2,0x02,0x10,0x02,0xD8,0x4C,0xA2,
+    0x02,0xBF,0xEF,0xF3,0x0A,0x72,0x02,0x44,0x92,0x02,0xBF,0x30,0x10,0xBF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x35,
+    0x34,0xD0,0x01,0xB3,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x82,
+    0x00,0xB2,0x02,0x83,0x0E,0x92,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x93,
+    0x02,0x91,0x02,0xB2,0x02,0x11,0x02,0x71,0x02,0x1D,0xCF,0xFF,0xFF,0xFE,0xFF,0xFF,
+    0xFF,0xFF,0xF7,0x97,0xBF,0x3A,0xC2,0x42,0xB2,0x02,0x06,0x92,0x02,0xEF,0x01,0x95,
+    0x1B,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x87,0x00,0x92,0x02,0x8F,0xC5,0x0C,
+    0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x94,0x02,0x93,0x02,0xB3,0x02,0xB1,0x02,
+    0x92,0x02,0x74,0x02,0x93,0x02,0xEF,0x01,0x96,0x23,0x42,0xFF,0xFF,0x00,0xDF,0xFF,
+    0xAD,0x04,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x81,0x0C,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x72,0x02,0xB3,0x02,
+    0x92,0x02,0x52,0x02,0x31,0x02,0x1C,0xCF,0x43,0xFF,0xFF,0x00,0xFE,0xFF,0x8A,0x02,
+    0x92,0x02,0x92,0x02,0xB2,0x02,0x44,0x92,0x02,0x01,0xD0,0x01,0x16,0x5D,0x83,0x03,
+    0x7D,0xE7,0xF2,0x0A,0x51,0x02,0x92,0x02,0x83,0x43,0x92,0x02,0x0B,0x93,0x02,0x72,
+    0x02,0xF2,0x02,0x7F,0xD7,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0x59,0x6D,0x31,0x02,0x71,
+    0x02,0x93,0x02,0xD2,0x02,0x48,0x92,0x02,0x12,0x73,0x02,0xB2,0x02,0xB1,0x02,0x91,
+    0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0xD1,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,
+    0x02,0x92,0x02,0x91,0x02,0x91,0x02,0xB3,0x02,0xD1,0x01,0xD2,0x0A,0x5D,0xCF,0x65,
+    0xFF,0xFF,0x00,0x3C,0xD7,0xAD,0x01,0xB3,0x02,0xB2,0x02,0x82,0x02,0xB2,0x02,0x92,
+    0x02,0xB2,0x02,0x8F,0x01,0xB2,0x02,0x92,0x02,0x42,0xB2,0x02,0x00,0x92,0x02,0x6A,
+    0xB2,0x02,0x03,0xB3,0x02,0x92,0x02,0x31,0x02,0x33,0x13,0x9C,0x03,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0x93,0x02,0x81,0x00,0x3C,0x8E,0xA0,0x02,0xFC,0xBE,0x91,0x02,0x72,
+    0x02,0x81,0x00,0x93,0x02,0x87,0x01,0x93,0x02,0x93,0x02,0xA7,0x05,0x51,0x02,0x93,
+    0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xBF,0x30,0x00,0xFE,0xFF,0x43,0xFF,
+    0xFF,0x07,0xFF,0xEF,0xFF,0xFF,0xFF,0xFF,0x59,0x55,0xD0,0x01,0x72,0x02,0xB2,0x02,
+    0x93,0x02,0x43,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,
+    0x43,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0x81,0x0A,0xB2,0x02,0x52,0x02,0xF1,0x01,
+    0x9B,0x9E,0xFF,0xFF,0xFF,0xFF,0xDD,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDF,0xFF,
+    0x95,0xBF,0x3B,0x07,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0xF0,0x01,
+    0x73,0x13,0xDF,0xFF,0x49,0xFF,0xFF,0x94,0x43,0xB2,0x02,0x00,0x92,0x02,0x81,0x0A,
+    0x93,0x02,0x72,0x02,0x93,0x02,0x74,0x02,0x93,0x02,0xD2,0x02,0x91,0x02,0x92,0x02,
+    0x93,0x02,0xF0,0x01,0xF5,0x1B,0x82,0x00,0xFE,0xFF,0xAF,0x00,0x93,0x02,0x44,0x92,
+    0x02,0x82,0x09,0xB2,0x02,0x92,0x02,0x94,0x02,0x93,0x02,0xB2,0x02,0xD0,0x01,0x39,
+    0x4D,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x81,0x00,0xDF,0xFF,0x8E,0x04,0x72,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0xCF,0x01,0x84,0x01,0x7E,0xE7,0xF3,0x0A,0x83,0xC1,0x81,
+    0x0E,0xB2,0x02,0x91,0x02,0x92,0x02,0x52,0x02,0xD2,0x0A,0x9F,0xDF,0xFF,0xFF,0xDF,
+    0xFF,0xFF,0xFF,0x7A,0x6D,0x11,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x82,
+    0x01,0xB2,0x02,0xB2,0x02,0x82,0x08,0x93,0x02,0x92,0x02,0x93,0x02,0x72,0x02,0x92,
+    0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x42,0x93,0x02,0x05,0xB3,0x02,0x94,
+    0x02,0x33,0x02,0xF0,0x01,0xB4,0x2B,0x9E,0xEF,0x4F,0xFF,0xFF,0x01,0xDF,0xFF,0xDF,
+    0xFF,0x94,0x02,0x5C,0xD7,0x90,0x02,0x72,0x02,0x81,0x01,0xB2,0x02,0xB2,0x02,0x67,
+    0x92,0x02,0x04,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x81,0xCC,0x00,
+    0xB2,0x02,0x44,0x92,0x02,0x81,0x00,0x93,0x02,0x82,0x68,0x92,0x02,0x04,0xB2,0x02,
+    0xB2,0x02,0x30,0x02,0x33,0x13,0xFF,0xEF,0x9B,0x42,0x92,0x02,0x82,0x00,0x5C,0x96,
+    0xA0,0x00,0xFD,0xBE,0x82,0x01,0xB2,0x02,0xB2,0x02,0x87,0x04,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x11,0x02,0xD8,0x44,0xA5,0x04,0xB3,0x02,0x92,0x02,0x92,0x02,0x93,0x02,
+    0x92,0x02,0xBF,0x33,0x0C,0xDF,0xFF,0xFF,0xFF,0xFE,0xF7,0xFF,0xFF,0x3B,0x8E,0xF0,
+    0x01,0x72,0x02,0x92,0x0A,0x73,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x84,
+    0x00,0xB2,0x02,0x82,0x0F,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,
+    0x02,0x73,0x02,0xF0,0x01,0xD9,0x75,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0xFE,0xFF,0x96,0xBF,0x39,0x0B,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0xF1,0x01,0x34,0x13,0xDF,0xEF,0xFF,0xFF,0xFF,0xFF,0xFE,
+    0xFF,0x9B,0x01,0xB2,0x02,0xB2,0x02,0x43,0x92,0x02,0x81,0x0D,0x92,0x02,0xB1,0x02,
+    0xD1,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0xB4,0x02,0x93,0x02,0x91,0x02,
+    0xF1,0x01,0x15,0x2C,0xFF,0xFF,0xFF,0xFF,0xAD,0x05,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x81,0x01,0xB2,0x02,0x92,0x02,0x81,0x0C,0x93,0x02,
+    0x92,0x02,0xD1,0x02,0xB2,0x02,0xD1,0x01,0x73,0x1B,0xFE,0xFF,0xDF,0xFF,0xBF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x89,0x05,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x92,0x02,0x92,0x02,0x93,0x02,0x42,0xB2,0x02,0x01,0xCF,0x01,0x37,0x65,0x83,0x02,
+    0xBF,0xEF,0xF3,0x0A,0x52,0x02,0x84,0xC1,0x05,0xB3,0x02,0xB2,0x02,0xB2,0x02,0x31,
+    0x02,0xD1,0x0A,0xBF,0xE7,0x82,0x05,0xB5,0x44,0x0F,0x02,0xB4,0x02,0x73,0x02,0x92,
+    0x02,0xB2,0x02,0x81,0x19,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0x91,0x02,0x72,0x02,0x53,0x02,0x73,0x02,0x72,0x02,0x51,0x02,0x51,0x02,0x52,
+    0x02,0x72,0x02,0x32,0x02,0x31,0x02,0xF0,0x01,0xEF,0x01,0xEF,0x01,0xD3,0x12,0x59,
+    0x65,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0xDE,0xF7,0x8D,0x01,0xFE,0xFF,0xFE,0xFF,0x94,
+    0x02,0x5D,0xD7,0x91,0x0A,0x73,0x02,0x81,0x6A,0x92,0x02,0x00,0xB2,0x02,0x43,0x92,
+    0x02,0x01,0x93,0x02,0xB2,0x02,0x90,0x00,0xB2,0x02,0x43,0x92,0x02,0x00,0x93,0x02,
+    0x60,0x92,0x02,0x48,0xB2,0x02,0x04,0x92,0x02,0x93,0x02,0x31,0x02,0x33,0x13,0xDF,
+    0xEF,0x99,0x00,0x92,0x02,0x85,0x01,0x10,0x02,0x3C,0x96,0xA0,0x01,0xFC,0xBE,0x92,
+    0x02,0x81,0x00,0x92,0x02,0x8A,0x01,0x92,0x02,0x10,0x02,0xA3,0x07,0xFF,0xF7,0xD4,
+    0x0A,0x51,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0xBF,0x30,0x0B,
+    0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xFF,0xFF,0xFF,0xFD,0xC6,0x51,0x02,
+    0x51,0x02,0xB2,0x02,0x93,0x02,0xB1,0x02,0x81,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0x42,0x92,0x02,0x00,0xB2,0x02,0x43,0x92,0x02,0x81,0x0C,0xB2,0x02,0x91,0x02,0x92,
+    0x02,0x73,0x02,0xF0,0x01,0xB6,0x54,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0xDF,
+    0xFF,0xFE,0xFF,0xFE,0xFF,0x57,0xFF,0xFF,0xBF,0x34,0x43,0xB2,0x02,0x81,0x0A,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xF1,0x01,0x13,0x13,0xBE,0xE7,0xFF,0xFF,0xFF,
+    0xFF,0xDF,0xFF,0xDE,0xFF,0x9B,0xC7,0x0C,0x93,0x02,0x94,0x02,0xB2,0x02,0x91,0x02,
+    0x73,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xD1,0x02,0x72,0x02,0xF0,0x01,
+    0x56,0x34,0x6C,0xFF,0xFF,0x00,0x75,0x1B,0x81,0x03,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0x85,0x09,0xB2,0x02,0x92,0x02,0x53,0x02,0x30,0x02,0xCF,0x01,0x73,0x1B,
+    0x9E,0xE7,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,0x49,0xFF,0xFF,0x00,0xDB,0x8D,0x81,0x43,
+    0xB2,0x02,0x45,0x92,0x02,0x03,0xF1,0x01,0x38,0x55,0xFF,0xFF,0xFE,0xFF,0x81,0x07,
+    0x9D,0xE7,0x14,0x0B,0x71,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,
+    0x81,0x42,0x93,0x02,0x0B,0x52,0x02,0xD2,0x0A,0x9F,0xE7,0xFE,0xFF,0xDE,0xFF,0x3C,
+    0x96,0x91,0x02,0x71,0x02,0x94,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x83,0x06,0x93,
+    0x02,0xB3,0x02,0xB2,0x02,0xB3,0x02,0x91,0x02,0xD2,0x12,0xD1,0x12,0x42,0xF2,0x0A,
+    0x08,0xD3,0x12,0xD2,0x0A,0xF1,0x0A,0x33,0x13,0x94,0x1B,0xD4,0x2B,0xB8,0x3C,0xDA,
+    0x85,0x7D,0xF7,0x42,0xFF,0xFF,0x01,0xDE,0xFF,0xDF,0xFF,0x4F,0xFF,0xFF,0x00,0xDF,
+    0xFF,0x82,0x00,0xDF,0xFF,0x90,0x01,0x90,0x02,0x72,0x02,0x82,0x00,0xB2,0x02,0x84,
+    0x01,0xB2,0x02,0x93,0x02,0x81,0x00,0x93,0x02,0x82,0x03,0x93,0x02,0x93,0x02,0xB2,
+    0x02,0xB2,0x02,0x81,0x42,0xB2,0x02,0x03,0x92,0x02,0xB3,0x02,0x93,0x02,0xB2,0x02,
+    0x82,0x03,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x87,0x04,0x93,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x84,0x00,0xB2,0x02,
+    0x81,0x00,0x93,0x02,0x42,0xB2,0x02,0x09,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x81,0x42,0xB2,0x02,
+    0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x81,0x00,0xB3,0x02,0x4B,0xB2,0x02,0x06,0x93,
+    0x02,0x93,0x02,0x92,0x02,0xB1,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0x44,0x92,0x02,
+    0x81,0x43,0x92,0x02,0x04,0xB2,0x02,0x92,0x02,0x31,0x02,0x34,0x13,0xFF,0xF7,0xA0,
+    0x00,0x31,0x02,0xA5,0x00,0xB2,0x02,0x4A,0x92,0x02,0x02,0x93,0x02,0x10,0x02,0xD8,
+    0x4C,0xA2,0x01,0xBF,0xEF,0xD3,0x0A,0x81,0x03,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0xBF,0x30,0x00,0xDF,0xFF,0x82,0x12,0xFF,0xFF,0xDE,0xEF,0x13,0x0B,0xF0,0x01,
+    0x91,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,
+    0x92,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x81,0x06,
+    0xB3,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xD0,0x01,0x15,0x2C,0x47,0xFF,
+    0xFF,0x00,0xDF,0xFF,0x96,0xBF,0x32,0x01,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x42,
+    0xB2,0x02,0x06,0xB3,0x02,0x92,0x02,0x93,0x02,0xF0,0x01,0x14,0x13,0xBF,0xDF,0xFF,
+    0xF7,0x4B,0xFF,0xFF,0x9C,0x03,0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x42,0x92,
+    0x02,0x05,0x93,0x02,0x94,0x02,0xB1,0x02,0x72,0x02,0xD0,0x01,0xF7,0x4C,0x81,0x01,
+    0xDF,0xFF,0xFF,0xF7,0xA7,0x11,0x54,0x13,0xD1,0x01,0x72,0x02,0x51,0x02,0x51,0x02,
+    0x52,0x02,0x51,0x02,0x51,0x02,0x71,0x02,0x51,0x02,0x31,0x02,0x31,0x02,0x32,0x02,
+    0x11,0x02,0xF1,0x01,0xB1,0x0A,0xB5,0x33,0x9C,0x9E,0x4E,0xFF,0xFF,0x03,0x1B,0x8E,
+    0x12,0x02,0x92,0x02,0x93,0x02,0x81,0x45,0x92,0x02,0x08,0x93,0x02,0x73,0x02,0x12,
+    0x0B,0x73,0x23,0x73,0x1B,0x53,0x1B,0x52,0x23,0x52,0x1B,0xB3,0x02,0x42,0x92,0x02,
+    0x01,0xB2,0x02,0xB3,0x02,0x81,0x0D,0x93,0x02,0x92,0x02,0x91,0x02,0x92,0x02,0x93,
+    0x02,0xD4,0x02,0x53,0x1B,0x72,0x23,0x11,0x0B,0x72,0x02,0x73,0x02,0x91,0x02,0xB2,
+    0x02,0xB1,0x02,0x82,0x00,0x93,0x02,0x81,0x06,0x92,0x02,0xB2,0x02,0x92,0x02,0x72,
+    0x02,0x13,0x0B,0x9E,0xDF,0xBE,0xFF,0x42,0x9D,0xEF,0x03,0xBE,0xEF,0xBD,0xEF,0x9E,
+    0xE7,0xDE,0xFF,0x52,0xFF,0xFF,0x02,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x81,0x42,0xDF,
+    0xFF,0x81,0x00,0xFE,0xFF,0x50,0xFF,0xFF,0x86,0x00,0xB2,0x02,0x45,0x92,0x02,0x03,
+    0x93,0x02,0x92,0x02,0xB2,0x02,0xB1,0x02,0x44,0x92,0x02,0x08,0x93,0x02,0xB3,0x02,
+    0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x81,0x04,
+    0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x47,0x93,0x02,0x0C,0x92,0x02,
+    0xB2,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xD1,0x02,0x92,0x02,
+    0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x82,0x00,0xB2,0x02,0x81,0x01,0x92,0x02,
+    0x92,0x02,0x81,0x42,0xB2,0x02,0x43,0x92,0x02,0x04,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0x93,0x02,0x44,0x92,0x02,0x01,0x93,0x02,0x93,0x02,0x48,0x92,0x02,0x42,
+    0x93,0x02,0x0B,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x74,0x02,0xB3,0x02,0x91,
+    0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x46,0x92,0x02,0xBF,0xB7,
+    0x00,0xFE,0xF7,0x43,0xFF,0xFF,0x05,0xB4,0x1B,0xF1,0x01,0xD3,0x02,0x92,0x02,0x92,
+    0x02,0x93,0x02,0x45,0x92,0x02,0x00,0x93,0x02,0x42,0x92,0x02,0x09,0xB2,0x02,0xB2,
+    0x02,0x93,0x02,0xB2,0x02,0x91,0x02,0xB2,0x02,0x93,0x02,0xB3,0x02,0x0F,0x02,0x54,
+    0x1B,0x60,0xFF,0xFF,0xBF,0x30,0x01,0xB2,0x02,0xB2,0x02,0x45,0x92,0x02,0x06,0xB2,
+    0x02,0x93,0x02,0xD3,0x02,0xB2,0x02,0xF1,0x01,0x33,0x0B,0x9E,0xE7,0x4D,0xFF,0xFF,
+    0x9B,0x00,0x92,0x02,0x83,0x0C,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x74,0x02,
+    0xD1,0x02,0x92,0x0A,0x74,0x02,0x0F,0x02,0x78,0x7D,0xFE,0xFF,0xFF,0xFF,0xFE,0xF7,
+    0x81,0x00,0xFE,0xFF,0xA3,0x26,0xDF,0xFF,0xD5,0x1B,0x52,0x02,0xB2,0x0A,0xD2,0x0A,
+    0xD2,0x0A,0xD3,0x0A,0xB3,0x0A,0xD2,0x0A,0xF2,0x02,0xD2,0x02,0xF3,0x12,0x32,0x0B,
+    0x72,0x13,0x15,0x3C,0x59,0x65,0xF6,0x1B,0x36,0x3C,0x5A,0x65,0xB7,0x3C,0x57,0x3C,
+    0x99,0x3C,0x77,0x3C,0x78,0x3C,0x97,0x3C,0x97,0x3C,0x78,0x3C,0x97,0x3C,0x77,0x3C,
+    0x77,0x3C,0x57,0x3C,0x77,0x3C,0x77,0x34,0x97,0x4C,0x3A,0x65,0x73,0x02,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0x47,0x92,0x02,0x08,0x93,0x02,0x92,0x02,0x32,0x02,0x31,0x02,
+    0x32,0x02,0x51,0x02,0x32,0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0x93,0x02,
+    0x42,0x92,0x02,0x09,0xB2,0x02,0xB2,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0x51,0x02,
+    0x32,0x02,0x72,0x02,0x72,0x02,0xB2,0x02,0x42,0x92,0x02,0x01,0xB3,0x02,0xB2,0x02,
+    0x84,0xC1,0x04,0x51,0x02,0x15,0x13,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x51,0xFF,0xFF,
+    0x04,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x43,0xFF,0xFF,0x00,0xFE,
+    0xFF,0x42,0xFF,0xFF,0x03,0xDE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x51,0xFF,0xFF,
+    0x86,0x42,0x92,0x02,0x00,0xB2,0x02,0x82,0x0C,0xB3,0x02,0x92,0x02,0xB3,0x02,0x72,
+    0x02,0xF1,0x01,0x10,0x02,0x11,0x02,0x10,0x02,0xF0,0x01,0xF0,0x01,0xF1,0x01,0xF0,
+    0x01,0x10,0x02,0x46,0xF0,0x01,0x03,0xF1,0x01,0xF0,0x01,0xF1,0x01,0xF1,0x01,0x44,
+    0xF0,0x01,0x43,0xF1,0x01,0x08,0xF0,0x01,0xF0,0x01,0xF1,0x01,0xF0,0x01,0x10,0x02,
+    0xF1,0x01,0x11,0x02,0x73,0x02,0x93,0x02,0x43,0xB2,0x02,0x42,0x92,0x02,0x81,0x03,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x81,0x05,0x91,0x02,0x52,0x02,0x73,0x02,
+    0x92,0x02,0x72,0x02,0x92,0x02,0x43,0x72,0x02,0x00,0x92,0x02,0x43,0x72,0x02,0x0A,
+    0x92,0x02,0x71,0x02,0x72,0x02,0x73,0x02,0x73,0x02,0x72,0x02,0x92,0x02,0x72,0x02,
+    0x72,0x02,0x92,0x02,0x71,0x02,0x43,0x92,0x02,0x06,0x73,0x02,0x73,0x02,0x93,0x02,
+    0x73,0x02,0x92,0x02,0x90,0x02,0x92,0x02,0x42,0x93,0x02,0x43,0x92,0x02,0x00,0xB2,
+    0x02,0xBF,0xBB,0xC3,0x03,0x97,0x3C,0xD0,0x01,0xB2,0x02,0x91,0x02,0x43,0xB2,0x02,
+    0x00,0x93,0x02,0x43,0xB2,0x02,0x43,0x92,0x02,0x00,0xB2,0x02,0x42,0x93,0x02,0x05,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0x12,0x02,0x91,0x0A,0xDD,0xE7,0xA0,0xBF,0x38,0x07,
+    0x92,0x02,0xB3,0x02,0xB2,0x02,0xEF,0x01,0x12,0x13,0x9E,0xDF,0xFF,0xFF,0xDF,0xFF,
+    0xA9,0x42,0xB2,0x02,0x0E,0x92,0x02,0xB2,0x02,0xB2,0x02,0xB1,0x02,0x92,0x02,0x73,
+    0x02,0xB2,0x02,0x91,0x02,0x93,0x0A,0x72,0x02,0x50,0x02,0x9C,0xA6,0xFF,0xFF,0xFF,
+    0xFF,0xBF,0xFF,0x65,0xFF,0xFF,0x15,0xDF,0xFF,0x5F,0xD7,0x7D,0xC7,0x7E,0xC7,0x3F,
+    0xD7,0x5E,0xCF,0x7F,0xC7,0x5F,0xCF,0x5F,0xD7,0x5E,0xC7,0x7E,0xCF,0xDF,0xDF,0xFF,
+    0xEF,0xFE,0xFF,0xFF,0xFF,0xDD,0xEF,0x50,0x02,0xF3,0x01,0xD0,0x01,0xEF,0x01,0xF0,
+    0x01,0xF1,0x01,0x47,0xF0,0x01,0x05,0xD0,0x01,0xF0,0x01,0x6E,0x01,0x35,0x13,0x19,
+    0x7E,0x91,0x02,0x49,0x92,0x02,0x01,0xB1,0x02,0x93,0x02,0x42,0xB2,0x02,0x02,0x93,
+    0x02,0x92,0x02,0xB3,0x02,0x81,0x00,0xB2,0x02,0x81,0x00,0xB2,0x02,0x81,0x00,0x93,
+    0x02,0x46,0x92,0x02,0x02,0x91,0x02,0x93,0x02,0x92,0x02,0x42,0xB2,0x02,0x03,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x42,0x92,0x02,0x04,0xB2,0x02,0x92,0x02,0x52,
+    0x02,0x13,0x0B,0xDF,0xFF,0x5F,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x00,0xDF,
+    0xFF,0x9A,0x00,0xB2,0x02,0x81,0x12,0x93,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x73,
+    0x02,0xF3,0x12,0xB3,0x33,0xD4,0x2B,0xB3,0x2B,0xD3,0x2B,0xD4,0x2B,0xD3,0x2B,0xB3,
+    0x2B,0xB3,0x2B,0xD3,0x23,0xB3,0x2B,0xB3,0x2B,0xD3,0x2B,0xD3,0x2B,0x43,0xB3,0x2B,
+    0x15,0xD3,0x2B,0xD3,0x2B,0xB2,0x2B,0xD2,0x2B,0xB3,0x2B,0xB3,0x2B,0xD3,0x2B,0xD3,
+    0x2B,0xB3,0x2B,0xB3,0x2B,0xD3,0x2B,0xD3,0x2B,0xB3,0x2B,0xB2,0x2B,0xB3,0x2B,0xD3,
+    0x23,0xB3,0x23,0xD3,0x2B,0xB3,0x2B,0x75,0x0A,0x73,0x02,0x92,0x02,0x43,0xB2,0x02,
+    0x42,0x92,0x02,0x00,0x93,0x02,0x42,0xB2,0x02,0x0B,0x92,0x02,0x93,0x02,0x93,0x02,
+    0x92,0x02,0x52,0x02,0x52,0x02,0x72,0x02,0x72,0x02,0x71,0x02,0x52,0x02,0x72,0x02,
+    0x52,0x02,0x49,0x72,0x02,0x03,0x52,0x02,0x52,0x02,0x72,0x02,0x72,0x02,0x42,0x52,
+    0x02,0x0D,0x72,0x02,0x52,0x02,0x71,0x02,0x71,0x02,0x72,0x02,0x72,0x02,0x52,0x02,
+    0x72,0x02,0x71,0x02,0x91,0x02,0x95,0x02,0x91,0x02,0x72,0x0A,0xB2,0x02,0x82,0x43,
+    0xB2,0x02,0xBF,0xB9,0x00,0xFE,0xFF,0x81,0x08,0x99,0x75,0xD0,0x01,0x73,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x81,0x05,0x92,0x02,0xB2,
+    0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x42,0x92,0x02,0x08,0xB1,0x02,0x93,
+    0x02,0x93,0x02,0xB3,0x02,0x51,0x02,0x51,0x02,0xDD,0xCE,0xFF,0xFF,0xFE,0xFF,0x9F,
+    0xBF,0x30,0xC1,0x01,0xB2,0x02,0xB2,0x02,0x81,0x08,0xB2,0x02,0xB2,0x02,0x92,0x02,
+    0xD2,0x02,0xF0,0x01,0xF3,0x12,0x9D,0xD7,0xFF,0xFF,0xFF,0xF7,0x4D,0xFF,0xFF,0x9E,
+    0x0D,0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x73,0x02,0x93,
+    0x02,0xB1,0x02,0x91,0x02,0xB4,0x02,0x13,0x02,0xB1,0x02,0x5D,0xD7,0x43,0xFF,0xFF,
+    0x00,0xFE,0xFF,0x64,0xFF,0xFF,0x00,0xFE,0xFF,0x4B,0xFF,0xFF,0x16,0xB9,0x44,0xF1,
+    0x01,0x93,0x02,0x93,0x02,0x72,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,
+    0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x94,0x02,0xB3,0x02,0xEF,
+    0x01,0x7C,0x9E,0xFD,0xAE,0x31,0x02,0x93,0x02,0xB2,0x02,0x87,0x08,0xB2,0x02,0x93,
+    0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0x43,
+    0x92,0x02,0x04,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x81,0x00,0xB3,
+    0x02,0x81,0x02,0x93,0x02,0xB3,0x02,0x92,0x02,0x81,0x03,0x93,0x02,0x92,0x02,0x92,
+    0x02,0x93,0x02,0x44,0x92,0x02,0x06,0x93,0x02,0xB3,0x02,0x12,0x02,0x53,0x0B,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xF7,0x90,0x07,0xDF,0xFF,0xFF,0xFF,0x3D,0xCF,0xF7,0x4C,0x17,
+    0x4D,0x38,0x4D,0x18,0x55,0xF9,0x54,0x43,0x18,0x55,0x06,0x19,0x4D,0x18,0x55,0x37,
+    0x55,0x17,0x55,0x38,0x55,0xB7,0x44,0xFA,0x85,0x99,0xC1,0x06,0xB2,0x02,0x93,0x02,
+    0x92,0x02,0x91,0x02,0xB3,0x02,0xF0,0x01,0x95,0x3C,0x62,0xFF,0xFF,0x04,0xFE,0xFF,
+    0x32,0x13,0x31,0x02,0x92,0x02,0x93,0x02,0x45,0x92,0x02,0x01,0x93,0x02,0x92,0x02,
+    0x42,0xB2,0x02,0x09,0x93,0x02,0xF1,0x01,0xD3,0x23,0xFD,0xBE,0xFC,0xBE,0xFC,0xBE,
+    0xDC,0xC6,0xDE,0xBE,0xFD,0xBE,0x1C,0xBF,0x42,0xDC,0xBE,0x02,0xDD,0xBE,0xDC,0xBE,
+    0xDC,0xBE,0x43,0xDD,0xBE,0x01,0xFC,0xBE,0xDC,0xBE,0x42,0xDD,0xBE,0x42,0xFD,0xBE,
+    0x00,0xDC,0xBE,0x42,0xDD,0xBE,0x0C,0xDC,0xBE,0xFC,0xBE,0xDC,0xBE,0xFD,0xBE,0xFE,
+    0xBE,0xD8,0x54,0x31,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0xB2,
+    0x02,0x45,0x92,0x02,0xBF,0xB7,0x07,0xDF,0xFF,0xFF,0xFF,0xBC,0xA6,0x0F,0x02,0x72,
+    0x02,0xB3,0x02,0x91,0x02,0x93,0x02,0x81,0xC2,0x81,0x01,0x92,0x02,0xB2,0x02,0x81,
+    0x0C,0x92,0x02,0x93,0x02,0x93,0x02,0x91,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x51,
+    0x02,0x0F,0x02,0x3B,0x96,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x9F,0xBF,0x30,0x00,0xB2,
+    0x02,0x81,0x08,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x10,
+    0x02,0xD2,0x0A,0x7E,0xD7,0x50,0xFF,0xFF,0x9A,0x01,0xB2,0x02,0xB2,0x02,0x46,0x92,
+    0x02,0x08,0x94,0x02,0x92,0x02,0x73,0x02,0xB3,0x02,0xB2,0x02,0x91,0x02,0x94,0x02,
+    0x11,0x02,0x54,0x13,0x81,0x00,0xDE,0xFF,0x63,0xFF,0xFF,0x00,0xDF,0xFF,0x44,0xFF,
+    0xFF,0x00,0xDF,0xFF,0x81,0x02,0xDF,0xF7,0xFF,0xFF,0xDF,0xFF,0x82,0x07,0xDF,0xEF,
+    0xB2,0x0A,0x52,0x02,0xD0,0x02,0x94,0x02,0xB2,0x02,0xB1,0x02,0x90,0x02,0x46,0xB2,
+    0x02,0x06,0x92,0x02,0xB3,0x02,0x51,0x02,0xD3,0x02,0xFF,0xFF,0x5B,0xA6,0x11,0x02,
+    0x48,0x92,0x02,0x08,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0x92,0x02,0xB3,0x02,0x84,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x42,0x92,
+    0x02,0x0C,0xB3,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,
+    0x93,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x82,0x00,0xB2,0x02,
+    0x83,0x00,0xD5,0x1B,0x48,0xFF,0xFF,0x00,0xDF,0xFF,0x8B,0x01,0x58,0x6D,0x4C,0x01,
+    0x42,0xEF,0x01,0x03,0xF0,0x01,0xEF,0x01,0xEF,0x01,0xCF,0x01,0x42,0xEF,0x01,0x04,
+    0xCE,0x01,0xF0,0x01,0xD1,0x01,0x2C,0x01,0x75,0x54,0x9F,0x02,0x93,0x02,0x11,0x02,
+    0x75,0x3C,0x92,0x01,0xDF,0xFF,0xDF,0xFF,0x8A,0x00,0xFE,0xFF,0x81,0x02,0xFD,0xFF,
+    0x33,0x13,0x32,0x02,0x43,0x92,0x02,0x04,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x42,0x92,0x02,0x03,0xB2,0x02,0xB2,0x02,0xCF,0x01,0x34,0x3C,0x5E,0xFF,
+    0xFF,0x04,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x7D,0x10,0x02,0x81,0x01,0x92,0x02,
+    0x93,0x02,0x81,0xC2,0xBF,0xBA,0x05,0xFF,0xFF,0x3E,0xD7,0x92,0x02,0x31,0x02,0xD3,
+    0x02,0x71,0x02,0x42,0xB2,0x02,0x03,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x83,
+    0x0A,0x93,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB3,
+    0x02,0x92,0x02,0xEF,0x01,0x58,0x75,0x63,0xFF,0xFF,0xBF,0x32,0xC1,0x82,0x06,0x93,
+    0x0A,0x11,0x02,0xD1,0x0A,0x5E,0xD7,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xAA,0x46,0x92,
+    0x02,0x0A,0x93,0x02,0xB2,0x02,0xD1,0x02,0xB2,0x02,0x73,0x02,0xB3,0x02,0xB3,0x02,
+    0xB1,0x02,0x92,0x02,0xB2,0x01,0x97,0x34,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x62,0xFF,
+    0xFF,0x03,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0x44,0xFF,0xFF,0x0E,0xDF,0xFF,
+    0xFE,0xFF,0xFD,0xF7,0xFE,0xFF,0xFF,0xFF,0x1B,0x76,0xEF,0x01,0xB2,0x02,0x91,0x02,
+    0x93,0x02,0x74,0x02,0x94,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x43,0x92,0x02,0x81,
+    0x05,0x71,0x02,0xEF,0x01,0x97,0x3C,0xFF,0xFF,0xDA,0x8D,0x32,0x02,0x87,0x00,0xB2,
+    0x02,0x81,0x06,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB1,0x02,0x92,
+    0x02,0x82,0x0A,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0xB2,0x02,0xB3,
+    0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x81,0x09,0x92,0x02,0x92,0x02,0xB3,
+    0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0x82,
+    0x03,0xB2,0x02,0xB2,0x02,0xF1,0x01,0x36,0x34,0x81,0x00,0xFE,0xFF,0x50,0xFF,0xFF,
+    0x81,0x10,0x55,0x34,0xF1,0x01,0x94,0x02,0x93,0x02,0x91,0x02,0xB3,0x02,0xB3,0x02,
+    0xB2,0x02,0xB3,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0xB3,0x02,0xB3,0x02,0x92,0x02,
+    0x70,0x02,0x5B,0xA6,0x99,0x08,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,
+    0x92,0x02,0x73,0x02,0xF2,0x01,0x56,0x34,0x83,0x02,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,
+    0x4C,0xFF,0xFF,0x00,0xFF,0xF7,0x87,0x00,0xFE,0xFF,0x44,0xFF,0xFF,0x05,0xDE,0xFF,
+    0x14,0x13,0x32,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x42,0xB2,0x02,0x81,0x42,0x92,
+    0x02,0x42,0xB2,0x02,0x01,0x0F,0x02,0x15,0x2C,0x81,0x01,0xFE,0xF7,0xFE,0xFF,0x8A,
+    0x00,0xDF,0xFF,0x4F,0xFF,0xFF,0x06,0xDF,0xFF,0xFF,0xFF,0x99,0x6D,0xF0,0x01,0xB1,
+    0x02,0x92,0x02,0x93,0x02,0x42,0x92,0x02,0x81,0x43,0x92,0x02,0xBF,0xB7,0x0C,0xFE,
+    0xF7,0x32,0x13,0xCF,0x01,0xB3,0x02,0x92,0x02,0xB4,0x02,0xB3,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x0A,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB4,0x02,0x93,0x02,0xD0,
+    0x01,0xB7,0x44,0x64,0xFF,0xFF,0xBF,0x30,0xC2,0x06,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x0A,0x31,0x02,0x91,0x0A,0x3D,0xC7,0x52,0xFF,0xFF,0x9A,0xC2,0x00,0x93,0x02,
+    0x81,0x0D,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB1,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0x73,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x74,0x02,0x10,0x02,0xD9,0x85,0x81,0x00,
+    0xFE,0xFF,0xA2,0x02,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x47,0xFF,0xFF,0x00,0xFE,0xFF,
+    0x81,0x07,0xB5,0x23,0x11,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,
+    0x72,0x02,0x43,0x92,0x02,0x00,0x93,0x02,0x42,0x92,0x02,0x04,0x74,0x02,0x51,0x02,
+    0xFC,0xC6,0xFF,0xFF,0xFB,0x85,0x81,0x00,0xB2,0x02,0x84,0x42,0xB2,0x02,0x0B,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x92,
+    0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x81,0x01,0x93,0x02,0xB2,0x02,0x42,0x92,0x02,
+    0x09,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xB2,
+    0x02,0xB2,0x02,0x93,0x02,0x81,0xC1,0x00,0x93,0x02,0x82,0x03,0x92,0x02,0xB2,0x02,
+    0xD0,0x01,0xD7,0x4C,0x82,0x00,0xFE,0xFF,0x51,0xFF,0xFF,0x04,0x54,0x13,0x51,0x02,
+    0x74,0x02,0x94,0x02,0xB2,0x02,0x42,0x92,0x02,0x08,0xB2,0x02,0x92,0x02,0x93,0x02,
+    0xB1,0x02,0xB3,0x02,0x74,0x02,0x70,0x02,0xD3,0x0A,0x9F,0xEF,0x97,0x01,0xB2,0x02,
+    0x93,0x02,0x44,0x92,0x02,0x03,0xB3,0x02,0x92,0x02,0x11,0x02,0x76,0x3C,0x83,0x07,
+    0xFE,0xFF,0xDF,0xEF,0xDF,0xDF,0xDF,0xDF,0xBF,0xE7,0xDE,0xE7,0xDF,0xE7,0xDF,0xDF,
+    0x43,0xDF,0xE7,0x04,0xBF,0xDF,0xBE,0xDF,0xDE,0xEF,0xFE,0xF7,0xFE,0xFF,0x49,0xFF,
+    0xFF,0x00,0xFF,0xF7,0x82,0x03,0xFE,0xFF,0x12,0x13,0x52,0x02,0x92,0x02,0x81,0xC8,
+    0x03,0x93,0x02,0x92,0x02,0xF0,0x01,0x35,0x2C,0x43,0xFF,0xFF,0x00,0xFE,0xFF,0x88,
+    0x0F,0xFE,0xFF,0xDF,0xFF,0x3D,0xD7,0x5B,0xA6,0xBD,0x9E,0xBD,0xA6,0xBD,0xAE,0xBC,
+    0xAE,0xDC,0xA6,0xBD,0xAE,0xBD,0xAE,0xBC,0xAE,0xDD,0xA6,0xBE,0xA6,0x7C,0xA6,0x5D,
+    0xD7,0x43,0xFF,0xFF,0x05,0x98,0x6D,0xD0,0x01,0xB3,0x02,0xB2,0x02,0x93,0x02,0xB2,
+    0x02,0x47,0x92,0x02,0xBF,0xB7,0x06,0x15,0x24,0xD0,0x01,0xB3,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0x93,0x02,0x84,0x08,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,
+    0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x81,0x07,0xD3,0x02,0xCF,0x01,0xD4,
+    0x23,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,0xDF,0xFF,0xA0,0xBF,0x24,0x43,0xB2,
+    0x02,0x00,0x92,0x02,0x42,0xB2,0x02,0x84,0x0C,0x93,0x02,0xB2,0x02,0x91,0x02,0x92,
+    0x02,0x94,0x02,0x11,0x02,0xB1,0x0A,0x3C,0xC7,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,
+    0xFF,0xDF,0xFF,0x93,0x04,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,
+    0xC4,0x0C,0xB2,0x02,0x92,0x02,0x73,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0x93,0x02,0xB2,0x02,0x51,0x02,0x71,0x0A,0x5E,0xCF,0x43,0xFF,0xFF,0x05,
+    0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0x67,0xFF,0xFF,0x04,
+    0x3E,0xCF,0x30,0x02,0x92,0x02,0x93,0x02,0x91,0x02,0x43,0xB2,0x02,0x0C,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0xF0,0x01,
+    0x94,0x1B,0xFF,0xFF,0xFF,0xFF,0xDC,0x85,0x82,0xDF,0x00,0x93,0x02,0x43,0x92,0x02,
+    0x03,0x93,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x42,0x92,0x02,0x04,0x93,0x02,0x93,
+    0x02,0x92,0x02,0xF0,0x01,0xB9,0x7D,0x51,0xFF,0xFF,0x00,0xDF,0xFF,0x81,0x10,0x3D,
+    0xCF,0x92,0x02,0x72,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x93,
+    0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0x73,0x02,0x2F,0x02,0xB5,
+    0x1B,0x51,0xFF,0xFF,0x87,0xC1,0x82,0x01,0xB2,0x02,0x93,0x02,0x81,0x00,0x56,0x3C,
+    0x44,0xFF,0xFF,0x10,0xD8,0x7D,0x70,0x02,0x13,0x0B,0xF2,0x0A,0xF2,0x0A,0x12,0x0B,
+    0xF2,0x0A,0xF2,0x12,0x12,0x0B,0x12,0x0B,0x13,0x0B,0x14,0x0B,0x4F,0x0A,0x18,0x65,
+    0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x87,0x00,0xDF,0xFF,0x83,0x02,0xDE,0xF7,0x32,0x13,
+    0x32,0x02,0x42,0x92,0x02,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x82,0x03,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0x81,0x00,0x14,0x34,0x81,0x02,0xFF,0xF7,0xFF,0xFF,
+    0xDF,0xFF,0x86,0x08,0xFF,0xF7,0xFD,0xFF,0xFD,0xFF,0xFF,0xFF,0x94,0x44,0xAE,0x01,
+    0x53,0x02,0x71,0x02,0x72,0x02,0x44,0x71,0x02,0x03,0x72,0x02,0x73,0x02,0xD0,0x01,
+    0xD7,0x5C,0x83,0x04,0x9A,0x6D,0xF0,0x01,0x92,0x02,0x93,0x02,0x92,0x02,0xA7,0x00,
+    0xB2,0x02,0x42,0x92,0x02,0x00,0x93,0x02,0xA4,0x05,0xFC,0xC6,0x72,0x02,0x72,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x88,0x00,0xB2,0x02,0x81,0x00,0xF8,0x4C,0xA2,0x01,
+    0xBF,0xF7,0xF3,0x0A,0x84,0x00,0xB2,0x02,0xBF,0x2A,0x09,0xDF,0xFF,0xFF,0xFF,0xFF,
+    0xF7,0xFE,0xFF,0xFF,0xFF,0x17,0x55,0xD0,0x01,0x92,0x02,0xB3,0x02,0xB2,0x02,0x81,
+    0xC1,0x00,0x93,0x02,0x43,0x92,0x02,0x01,0x93,0x02,0x93,0x02,0x81,0xC4,0x05,0xD3,
+    0x02,0x0F,0x02,0x12,0x13,0xDF,0xFF,0xFF,0xFF,0xDE,0xFF,0x63,0xFF,0xFF,0x9F,0x00,
+    0xB2,0x02,0x7F,0x07,0x92,0x02,0x00,0xB2,0x02,0x46,0x92,0x02,0x08,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0xF1,0x01,0x92,0x0A,0xFD,0xC6,0xFF,0xF7,0x53,
+    0xFF,0xFF,0x88,0x00,0x92,0x02,0x9A,0xC1,0x00,0xB2,0x02,0x83,0x03,0xB3,0x02,0x73,
+    0x02,0x10,0x02,0x92,0x1B,0x81,0x04,0xFF,0xF7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,
+    0xFF,0x81,0xE3,0x02,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x81,0x09,0xF8,0x54,0xF1,0x01,
+    0xB2,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x42,0x92,0x02,0x05,0xB2,0x02,0x92,0x02,0x94,0x02,0xB3,0x02,0x0E,0x02,0xDA,0x7D,
+    0x81,0x03,0xDB,0x8D,0x31,0x02,0x92,0x02,0x93,0x02,0x63,0x92,0x02,0x01,0x93,0x02,
+    0x92,0x02,0x42,0x93,0x02,0x0E,0xD1,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x91,0x02,
+    0x72,0x02,0x93,0x02,0x7E,0xE7,0xFF,0xFF,0xFE,0xEF,0xDE,0xFF,0xFE,0xFF,0xFE,0xFF,
+    0xDE,0xFF,0xFD,0xFF,0x81,0x42,0xFE,0xFF,0x42,0xDE,0xFF,0x81,0x00,0xFE,0xFF,0x42,
+    0xFF,0xFF,0x10,0xFA,0x7D,0xF0,0x01,0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB4,
+    0x02,0xEF,0x01,0xB6,0x4C,0xA0,0x00,0xB2,0x02,0x86,0x0D,0x79,0x65,0xB0,0x01,0x32,
+    0x02,0x52,0x02,0x52,0x02,0x51,0x02,0x51,0x02,0x71,0x02,0x31,0x02,0x32,0x02,0x51,
+    0x02,0x31,0x02,0xD0,0x01,0xF9,0x44,0x81,0x00,0xDE,0xFF,0x87,0x02,0xFF,0xF7,0xFF,
+    0xFF,0xDF,0xFF,0x81,0x01,0xFE,0xF7,0x31,0x13,0x91,0x00,0xDF,0xFF,0x44,0xFF,0xFF,
+    0x00,0xFE,0xFF,0x47,0xFF,0xFF,0x0D,0xB6,0x4C,0xAF,0x01,0x93,0x02,0x72,0x02,0x91,
+    0x02,0x73,0x02,0x72,0x02,0x72,0x02,0x71,0x02,0x92,0x02,0x73,0x02,0x72,0x02,0xF0,
+    0x01,0xF8,0x54,0x86,0xCA,0x9E,0xC1,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x81,0x00,
+    0x30,0x02,0xA1,0x04,0xFC,0xBE,0x92,0x02,0x72,0x02,0x92,0x02,0xB2,0x02,0x48,0x92,
+    0x02,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xBF,0x25,0x00,0xFF,0xF7,0x83,0x00,0xDF,
+    0xFF,0x6F,0xFF,0xFF,0x04,0xDA,0x85,0xF0,0x01,0x72,0x02,0x92,0x02,0xB2,0x02,0x42,
+    0x92,0x02,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x81,0x00,0xB2,0x02,0x42,0x92,0x02,
+    0x00,0xD2,0x02,0x81,0x08,0xB2,0x02,0xB3,0x02,0x72,0x02,0xB3,0x02,0x33,0x02,0x91,
+    0x0A,0x7E,0xE7,0xFF,0xFF,0xFF,0xF7,0x64,0xFF,0xFF,0xA0,0x00,0xB2,0x02,0xBF,0x0B,
+    0x00,0xB2,0x02,0x81,0x00,0x93,0x02,0x81,0x03,0xB4,0x02,0x31,0x02,0x91,0x0A,0xBC,
+    0xBE,0x55,0xFF,0xFF,0xA3,0xC6,0x05,0x92,0x02,0x92,0x02,0x93,0x02,0x72,0x02,0xEF,
+    0x01,0x58,0x5D,0x42,0xFF,0xFF,0x01,0xFF,0xF7,0xFF,0xF7,0x65,0xFF,0xFF,0x0D,0xFF,
+    0xF7,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0x32,0x0B,0x32,0x02,0x92,
+    0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x42,0xB2,0x02,0x42,0x92,
+    0x02,0x04,0xB2,0x02,0x93,0x02,0x31,0x02,0x13,0x0B,0xFF,0xF7,0x81,0x02,0xF9,0x85,
+    0x11,0x02,0x92,0x02,0x64,0xB2,0x02,0x44,0x92,0x02,0x0F,0xB2,0x02,0xB1,0x02,0xB3,
+    0x02,0x94,0x02,0xB2,0x02,0xD0,0x01,0x17,0x34,0xFF,0xFF,0xFF,0xFF,0xD3,0x33,0xD2,
+    0x12,0x54,0x13,0x53,0x1B,0x54,0x1B,0x53,0x13,0x54,0x13,0x43,0x53,0x13,0x06,0x73,
+    0x13,0x73,0x13,0x32,0x13,0xF1,0x12,0xBC,0xA6,0xFF,0xFF,0xDF,0xFF,0x81,0x00,0xD7,
+    0x4C,0x81,0x00,0xB2,0x02,0x85,0x06,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x73,
+    0x02,0x30,0x02,0x1A,0x8E,0xA8,0x01,0x9A,0x75,0x11,0x02,0x43,0x93,0x02,0x42,0x92,
+    0x02,0x42,0xB2,0x02,0x06,0xF0,0x01,0x59,0x55,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,
+    0xFF,0xDF,0xFF,0x84,0x07,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFE,0xFF,0xFF,
+    0xFF,0xDE,0xFF,0x33,0x13,0x87,0x00,0xB2,0x02,0x84,0x00,0x93,0x02,0x82,0xC3,0x01,
+    0xFE,0xFF,0xFE,0xFF,0x44,0xFF,0xFF,0x11,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,
+    0xD7,0x4C,0xCF,0x01,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0x93,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x11,0x02,0x18,0x5D,0x86,0x00,0x93,0x02,
+    0xAB,0x04,0xB2,0x02,0x92,0x02,0x93,0x02,0x72,0x02,0x31,0x02,0xA1,0x00,0xFC,0xC6,
+    0x81,0x00,0x93,0x02,0x89,0xC2,0x01,0x10,0x02,0xD8,0x44,0xA5,0x00,0xB3,0x02,0xBB,
+    0x05,0xFF,0xFF,0x37,0x5D,0x98,0x3C,0xDA,0x44,0xF9,0x44,0xD9,0x44,0x69,0xD8,0x4C,
+    0x08,0xF8,0x4C,0xD9,0x44,0x18,0x4D,0xD8,0x4C,0x19,0x4D,0xB7,0x4C,0x52,0x02,0x53,
+    0x02,0xB2,0x02,0x83,0x00,0xB3,0x02,0x86,0x0A,0xB1,0x02,0xB1,0x02,0x72,0x0A,0x93,
+    0x02,0xD3,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x33,0x02,0x32,0x02,0xBC,0xBE,0x42,
+    0xFF,0xFF,0x00,0xDF,0xFF,0xA3,0xA1,0x00,0xB2,0x02,0xBC,0x42,0xB2,0x02,0x89,0xC1,
+    0x06,0xB2,0x02,0xB2,0x02,0x92,0x02,0xD3,0x02,0x10,0x02,0x32,0x02,0xDD,0xB6,0x56,
+    0xFF,0xFF,0x84,0x00,0x93,0x02,0x9C,0xC7,0x06,0xB1,0x02,0x92,0x02,0xB2,0x02,0xB4,
+    0x02,0x52,0x02,0x50,0x02,0x3D,0xBF,0x81,0x03,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,
+    0xFF,0xA3,0x06,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5B,0x9E,0x10,
+    0x02,0x42,0x92,0x02,0x05,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,
+    0x02,0x82,0x04,0xB2,0x02,0xB3,0x02,0x92,0x02,0xF0,0x01,0x98,0x4C,0x42,0xFF,0xFF,
+    0x01,0x1A,0x86,0x30,0x02,0x65,0x92,0x02,0x13,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,
+    0x02,0xB2,0x02,0x93,0x02,0x74,0x02,0x73,0x0A,0xB2,0x02,0x71,0x02,0x31,0x02,0xFD,
+    0xCE,0xFE,0xFF,0xFF,0xFF,0xD6,0x33,0xB0,0x01,0x73,0x02,0x31,0x02,0x11,0x02,0x12,
+    0x02,0x44,0x32,0x02,0x04,0x52,0x02,0x51,0x02,0x31,0x02,0xAE,0x01,0x3A,0x5D,0x43,
+    0xFF,0xFF,0x05,0xB5,0x1B,0x12,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x43,
+    0x92,0x02,0x00,0x93,0x02,0x81,0x03,0x93,0x02,0x52,0x02,0x92,0x02,0x5E,0xD7,0xA8,
+    0x09,0x99,0x6D,0x10,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,
+    0x02,0x92,0x02,0x92,0x02,0x81,0x01,0x11,0x02,0x16,0x34,0x49,0xFF,0xFF,0x02,0xFE,
+    0xFF,0xDE,0xFF,0xFF,0xFF,0x82,0x01,0xDD,0xFF,0x13,0x13,0x8C,0x00,0xB2,0x02,0x81,
+    0x00,0x15,0x34,0x4C,0xFF,0xFF,0x05,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x73,0x13,0x32,
+    0x02,0xB1,0x02,0x42,0xB2,0x02,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x81,0x02,0xB2,
+    0x02,0x10,0x02,0x19,0x5D,0x86,0xCA,0x9F,0x05,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0xB3,0x02,0x92,0x02,0xA2,0x00,0xFC,0xBE,0x81,0x00,0xB3,0x02,0x4A,0x92,0x02,
+    0x02,0xB2,0x02,0x92,0x02,0x11,0x02,0xA4,0x00,0xD3,0x02,0x82,0xC1,0xB8,0x06,0xDF,
+    0xFF,0x8F,0x0A,0xB0,0x01,0xF1,0x01,0xF1,0x01,0xF0,0x01,0x11,0x02,0x68,0x10,0x02,
+    0x08,0x11,0x02,0x11,0x02,0xD0,0x01,0x11,0x02,0xF2,0x01,0xF0,0x01,0x51,0x02,0xD1,
+    0x02,0x92,0x02,0x42,0xB2,0x02,0x42,0x92,0x02,0x13,0xB2,0x02,0x92,0x02,0x93,0x02,
+    0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x74,0x02,0x92,0x02,0x91,0x02,
+    0xB2,0x02,0xB3,0x02,0x52,0x02,0xF0,0x01,0x1A,0x86,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,
+    0xDF,0xFF,0xA4,0xA1,0x7D,0x92,0x02,0x4B,0xB2,0x02,0x0B,0x92,0x02,0xB2,0x02,0xB2,
+    0x02,0x92,0x02,0x93,0x02,0x94,0x02,0x10,0x02,0x71,0x02,0xDC,0xAE,0xFF,0xFF,0xDF,
+    0xFF,0xFE,0xFF,0x99,0x00,0xB2,0x02,0x9C,0x00,0xB2,0x02,0x83,0x09,0xB2,0x02,0x92,
+    0x02,0x93,0x02,0x92,0x02,0xB1,0x02,0xB3,0x02,0x92,0x02,0xB4,0x02,0xD0,0x01,0x93,
+    0x1B,0x83,0x00,0xFF,0xFF,0xA4,0x01,0xFF,0xFF,0xFF,0xF7,0x82,0x00,0x37,0x2C,0x81,
+    0x16,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x92,
+    0x02,0xB2,0x02,0x91,0x02,0xB3,0x02,0xB3,0x02,0x93,0x02,0x71,0x02,0x70,0x02,0x3D,
+    0xC7,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFB,0x85,0x11,0x02,0x92,0x02,0xB2,0x02,0xA0,
+    0x00,0x93,0x02,0x81,0x0B,0x93,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,
+    0x02,0x72,0x02,0xB2,0x02,0x72,0x02,0xCE,0x01,0x98,0x75,0xFF,0xFF,0x81,0x23,0xDB,
+    0x85,0x2F,0x02,0x91,0x02,0x73,0x02,0xB1,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0x93,0x02,0x73,0x02,0x93,0x02,0x94,0x02,0xF1,0x01,0x18,0x34,0xFF,
+    0xFF,0xFE,0xFF,0xFF,0xFF,0x9D,0xDF,0xF3,0x02,0x52,0x02,0x91,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,
+    0x02,0x92,0x02,0x32,0x02,0x74,0x13,0x52,0xFF,0xFF,0x96,0x02,0xBA,0x6D,0xF0,0x01,
+    0x72,0x02,0x45,0x92,0x02,0x05,0xB2,0x02,0x92,0x02,0xB1,0x02,0x73,0x02,0x11,0x02,
+    0x38,0x6D,0x4E,0xFF,0xFF,0x00,0xDF,0xFF,0x90,0x00,0x14,0x2C,0x4D,0xFF,0xFF,0x08,
+    0xFD,0xC6,0x35,0x2C,0xF1,0x01,0x94,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0x82,0x01,0x93,0x02,0x92,0x02,0xB7,0x00,0x93,0x02,0xA3,0x03,0x1C,0xBF,
+    0x72,0x02,0x72,0x02,0xB2,0x02,0x4B,0x92,0x02,0x02,0x93,0x02,0x10,0x02,0xF8,0x4C,
+    0xA3,0x02,0xF3,0x0A,0x51,0x02,0x93,0x02,0xBB,0x07,0xFE,0xFF,0x11,0x13,0x31,0x02,
+    0x72,0x02,0xB1,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0x67,0x93,0x02,0x12,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0xD2,0x02,0xB1,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0x93,0x02,0x93,0x02,0x42,0x92,0x02,0x0D,0x93,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,
+    0x93,0x02,0x74,0x02,0xF0,0x01,0x57,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xF7,0xA3,0x9F,0x7F,0x04,0x92,0x02,0x48,0xB2,0x02,0x42,0x92,0x02,
+    0x04,0xB3,0x02,0x32,0x02,0x51,0x02,0x7C,0xAE,0xFF,0xFF,0x82,0x00,0xFE,0xFF,0x9D,
+    0xD8,0x03,0xB2,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x42,0xB2,0x02,0x01,0x93,0x02,
+    0x93,0x02,0x82,0x03,0xB2,0x02,0x92,0x02,0xF0,0x01,0xB9,0x6D,0x42,0xFF,0xFF,0x00,
+    0xDE,0xFF,0x64,0xFF,0xFF,0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x02,0x9F,0xDF,0x92,0x0A,
+    0x51,0x02,0x83,0x0B,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xF0,0x01,0xD4,0x23,0x43,0xFF,0xFF,0x02,
+    0xFB,0x85,0x32,0x02,0xB2,0x02,0x60,0x92,0x02,0x00,0x93,0x02,0x81,0x00,0x93,0x02,
+    0x43,0x92,0x02,0x0E,0x73,0x02,0x93,0x02,0x92,0x02,0x11,0x02,0xF0,0x01,0x17,0x5D,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0x5E,0xCF,0xB1,0x02,0x31,0x02,0x94,0x02,
+    0xB2,0x02,0x46,0x92,0x02,0x0B,0xB2,0x02,0xB2,0x02,0x31,0x02,0x33,0x13,0xFE,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0x7B,0x96,0x11,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x45,0x92,
+    0x02,0x42,0xB2,0x02,0x02,0x93,0x02,0xF0,0x01,0x75,0x3C,0xA2,0x00,0x10,0x02,0x86,
+    0x02,0x11,0x02,0x93,0x02,0x93,0x02,0x81,0x42,0xB2,0x02,0x10,0x92,0x02,0xB3,0x02,
+    0xB3,0x02,0x93,0x02,0x72,0x02,0x0F,0x02,0x75,0x0B,0x55,0x3C,0xB6,0x5C,0x58,0x75,
+    0xFA,0x85,0xF9,0x85,0xB8,0x7D,0xF9,0x8D,0x7B,0xA6,0x7B,0x9E,0xBC,0xB6,0x83,0x01,
+    0xBE,0xF7,0x33,0x13,0x8C,0x00,0x92,0x02,0x81,0x00,0x14,0x34,0x83,0x01,0xDA,0x8D,
+    0x13,0x34,0x43,0x75,0x44,0x07,0x55,0x3C,0xF7,0x33,0xD7,0x23,0x54,0x13,0x73,0x02,
+    0x10,0x02,0xB1,0x02,0x73,0x02,0x42,0x93,0x02,0x01,0xB2,0x02,0x92,0x02,0x81,0x00,
+    0xB2,0x02,0x81,0x01,0x11,0x02,0x18,0x55,0xB1,0x03,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x93,0x02,0x81,0x00,0x51,0x02,0xA2,0x04,0x92,0x02,0x71,0x02,0x92,0x02,0x92,0x02,
+    0xB3,0x02,0x88,0x00,0xB3,0x02,0x81,0x00,0xD8,0x44,0xA4,0x00,0x72,0x02,0x81,0x00,
+    0xB2,0x02,0xB9,0x06,0xFF,0xFF,0x12,0x13,0x52,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,
+    0xB2,0x02,0x68,0x92,0x02,0x06,0x93,0x02,0x92,0x02,0x93,0x0A,0x92,0x02,0x92,0x02,
+    0xB3,0x02,0x93,0x02,0x81,0x00,0x92,0x02,0x83,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,
+    0x43,0x92,0x02,0x07,0xB1,0x02,0x92,0x02,0x92,0x02,0xB1,0x02,0xB2,0x02,0xB5,0x02,
+    0xB0,0x01,0x76,0x34,0x42,0xFF,0xFF,0x02,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x64,0xFF,
+    0xFF,0xA4,0x42,0xB2,0x02,0xB7,0x01,0x93,0x02,0x93,0x02,0x43,0x92,0x02,0x81,0x01,
+    0x92,0x02,0x92,0x02,0x84,0x03,0xB2,0x02,0x10,0x02,0x4F,0x02,0x7C,0xA6,0x42,0xFF,
+    0xFF,0x00,0xFE,0xFF,0x55,0xFF,0xFF,0x82,0xC1,0x9F,0xC2,0x0F,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x93,0x02,0x73,0x02,0xB2,0x02,0xB2,0x02,0x72,0x02,0xB2,0x02,0x53,0x02,
+    0x91,0x02,0x9E,0xDF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x64,0xFF,0xFF,0x00,
+    0xDF,0xFF,0x81,0x08,0xF8,0x54,0xEF,0x01,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0x93,0x02,0x92,0x02,0xB2,0x02,0x83,0x07,0xB3,0x02,0x92,0x02,0x92,0x02,0x93,0x02,
+    0xF0,0x01,0x1B,0x96,0xFF,0xFF,0xFF,0xF7,0x81,0x01,0x99,0x75,0x8F,0x01,0x61,0xF0,
+    0x01,0x0C,0xF1,0x01,0xF0,0x01,0xF1,0x01,0xF0,0x01,0xF0,0x01,0x10,0x02,0xEF,0x01,
+    0xF0,0x01,0x11,0x02,0x2F,0x02,0x70,0x02,0xB5,0x1B,0x5B,0x9E,0x42,0xFF,0xFF,0x08,
+    0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x53,0x13,0x11,0x02,0x93,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0x83,0x05,0xB2,0x02,0xB2,0x02,0x91,0x02,0x92,0x02,0xB2,0x02,0x3C,0xD7,
+    0x81,0x04,0x37,0x55,0x0F,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x81,0x04,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x42,0x93,0x02,0x02,0x30,0x02,0x98,0x7D,
+    0xDF,0xFF,0xA9,0x06,0xF1,0x01,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x93,0x02,0x43,0x92,0x02,0x13,0xD2,0x02,0xB4,0x02,0xB0,0x02,0x30,0x02,0xB1,0x01,
+    0xF0,0x01,0x10,0x02,0x31,0x02,0x31,0x02,0x11,0x02,0x31,0x02,0x51,0x02,0xAF,0x01,
+    0x73,0x23,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xF7,0x13,0x13,0x87,0xC1,
+    0x83,0x04,0x92,0x02,0xF0,0x01,0x34,0x34,0xFF,0xFF,0xFE,0xFF,0x81,0x15,0xF5,0x3B,
+    0x4E,0x01,0xCF,0x01,0xCF,0x01,0xAF,0x01,0xD0,0x01,0xF0,0x01,0xF0,0x01,0x11,0x02,
+    0x31,0x02,0x52,0x02,0x93,0x02,0xD2,0x02,0xB2,0x02,0x72,0x02,0x92,0x02,0xB1,0x02,
+    0x93,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x81,0x01,0x10,0x02,0xF8,0x54,
+    0xB3,0x01,0x92,0x02,0x92,0x02,0x81,0x00,0x31,0x02,0xA0,0x01,0xDF,0xFF,0xFC,0xC6,
+    0x81,0x01,0xB2,0x02,0xB2,0x02,0x49,0x92,0x02,0x03,0xB2,0x02,0x92,0x02,0x10,0x02,
+    0xF8,0x4C,0xA4,0x00,0x51,0x02,0x81,0xC1,0xB8,0x07,0xFE,0xFF,0x13,0x13,0x33,0x02,
+    0x92,0x02,0xD2,0x02,0xB3,0x02,0x92,0x02,0xB3,0x02,0x67,0xB2,0x02,0x08,0x93,0x02,
+    0xB2,0x02,0xB1,0x02,0x92,0x02,0xB2,0x02,0x73,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0x81,0x00,0xB2,0x02,0x81,0x14,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x93,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0xD3,0x02,0xB1,0x02,0x93,0x02,0xD0,0x01,
+    0xF3,0x1B,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0xA4,0xB7,0x00,0xB2,0x02,0x85,0x00,0xB2,0x02,0x9E,0x00,0xB2,0x02,0x42,0x93,0x02,
+    0x43,0x92,0x02,0x82,0x01,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x02,0x51,0x02,0xF3,
+    0x0A,0xFD,0xC6,0x44,0xFF,0xFF,0x00,0xFF,0xF7,0x9C,0xC2,0x00,0xB2,0x02,0x58,0x92,
+    0x02,0x81,0x10,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xF0,0x01,0x77,0x34,0xFF,0xFF,0xFE,
+    0xFF,0xFF,0xF7,0xDE,0xFF,0xA3,0x00,0xFE,0xFF,0x81,0x04,0x9F,0xF7,0x71,0x0A,0x51,
+    0x02,0xB3,0x02,0x92,0x02,0x42,0xB2,0x02,0x01,0x92,0x02,0x93,0x02,0x81,0x0D,0x93,
+    0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x31,0x02,0x13,0x0B,0xDF,0xF7,0xFF,
+    0xFF,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xBC,0xAE,0x15,0x2C,0x61,0x57,0x34,0x0A,0x56,
+    0x34,0x57,0x34,0x56,0x34,0x36,0x34,0x97,0x3C,0xF9,0x4C,0xD9,0x44,0x3A,0x55,0x7B,
+    0x65,0x19,0x86,0xDB,0xC6,0x43,0xFF,0xFF,0x00,0xDF,0xFF,0x82,0x03,0x97,0x44,0xEF,
+    0x01,0xB2,0x02,0x93,0x02,0x44,0x92,0x02,0x42,0x93,0x02,0x03,0x72,0x02,0x93,0x02,
+    0x30,0x02,0x3A,0x8E,0x81,0x01,0x16,0x2C,0xF1,0x01,0x81,0x00,0xB3,0x02,0x83,0x07,
+    0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x72,0x02,0x71,0x02,0xFD,0xBE,
+    0x52,0xFF,0xFF,0x90,0x00,0x55,0x3C,0x84,0x01,0x79,0x6D,0x10,0x02,0x42,0x92,0x02,
+    0x0E,0xB3,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0x93,0x02,0x91,0x02,0x92,
+    0x02,0x93,0x02,0xB2,0x02,0xB4,0x02,0x93,0x02,0x92,0x02,0x72,0x02,0x73,0x02,0x43,
+    0x92,0x02,0x01,0xEF,0x01,0xB5,0x13,0x81,0x03,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0x33,
+    0x13,0x8F,0x00,0x14,0x34,0x83,0x04,0xB8,0x44,0x10,0x02,0x93,0x02,0xB2,0x02,0xB3,
+    0x02,0x43,0xB2,0x02,0x09,0x93,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0x93,
+    0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x42,0x92,0x02,0x03,0x93,0x02,0x93,
+    0x02,0x10,0x02,0x38,0x5D,0xB0,0x08,0xB2,0x02,0x93,0x02,0x93,0x02,0x91,0x02,0xB2,
+    0x02,0xB3,0x02,0x92,0x02,0x0F,0x02,0xFE,0xB6,0x60,0xFF,0xFF,0x03,0xBF,0xF7,0x91,
+    0x02,0x92,0x02,0x93,0x02,0x89,0x00,0x93,0x02,0x82,0x00,0x7A,0x5D,0x63,0xFF,0xFF,
+    0x83,0x00,0xB2,0x02,0xBA,0x05,0x12,0x13,0x32,0x02,0x92,0x02,0x92,0x02,0x72,0x0A,
+    0xB2,0x02,0x68,0x93,0x02,0x0A,0x92,0x02,0xB2,0x02,0x93,0x02,0x94,0x02,0xB2,0x02,
+    0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x81,0x06,0x92,0x02,
+    0xB2,0x02,0x91,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x44,0x93,0x02,0x08,
+    0xF0,0x01,0x12,0x0B,0xDF,0xF7,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFE,0xF7,0xFF,0xFF,
+    0xDF,0xFF,0x65,0xFF,0xFF,0x98,0x42,0x93,0x02,0x09,0x92,0x02,0x92,0x02,0x93,0x02,
+    0xB2,0x02,0xB3,0x02,0xB1,0x02,0x91,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x52,0xB2,
+    0x02,0x82,0x00,0x93,0x02,0x81,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x86,0x04,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x81,0x47,0xB2,0x02,0x83,0x00,0x93,
+    0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x82,0x00,0xB2,0x02,0x42,0x92,0x02,0x0E,0x93,
+    0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x72,0x02,0x93,0x02,0xB3,0x02,0x30,0x02,0xB5,
+    0x1B,0xBB,0x6D,0xD6,0x4C,0xF7,0x44,0xF8,0x4C,0x76,0x3C,0x17,0x75,0x55,0xFF,0xFF,
+    0x82,0x0B,0xB3,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,
+    0x92,0x02,0xD1,0x02,0x93,0x02,0x92,0x02,0xB1,0x02,0x87,0x04,0xB3,0x02,0x92,0x02,
+    0x72,0x0A,0xB2,0x02,0xB2,0x02,0x81,0x02,0xB3,0x02,0x92,0x02,0x93,0x02,0x4A,0x92,
+    0x02,0x00,0xB2,0x02,0x44,0x92,0x02,0x05,0x72,0x02,0x32,0x02,0xBC,0xBE,0xFF,0xFF,
+    0xFE,0xFF,0xDF,0xFF,0x9C,0x00,0xFE,0xFF,0x82,0x0A,0xFE,0xFF,0xFF,0xFF,0xFF,0xF7,
+    0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x36,0x34,0xCF,0x01,0xB3,0x02,0x92,0x02,0x93,0x02,
+    0x46,0x92,0x02,0x02,0x93,0x02,0xB4,0x02,0x93,0x02,0x81,0x01,0xF0,0x01,0xD8,0x54,
+    0x74,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x82,0x13,0x3C,0x7E,0x10,0x02,0x72,
+    0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,
+    0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xF0,0x01,0xF9,0x54,0xFF,0xFF,0xBF,0xF7,0x14,
+    0x0B,0x32,0x02,0x42,0x92,0x02,0x00,0xB3,0x02,0x81,0x01,0xB2,0x02,0x92,0x02,0x81,
+    0xC1,0x02,0x31,0x02,0x33,0x0B,0xFF,0xF7,0x9B,0x44,0x92,0x02,0x82,0x00,0x56,0x3C,
+    0x84,0x01,0x98,0x6D,0x30,0x02,0x81,0x02,0xB3,0x02,0xB2,0x02,0x93,0x02,0x42,0x92,
+    0x02,0x43,0xB2,0x02,0x01,0x92,0x02,0x92,0x02,0x47,0xB2,0x02,0x01,0x11,0x02,0xB5,
+    0x23,0x43,0xFF,0xFF,0x03,0xDF,0xFF,0x53,0x0B,0x52,0x02,0xB2,0x02,0x43,0x92,0x02,
+    0x81,0x00,0xB2,0x02,0x86,0x00,0xF3,0x33,0x43,0xFF,0xFF,0x05,0xB7,0x44,0x10,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x4A,0x92,0x02,0x02,0x93,0x02,0xB2,0x02,
+    0xB2,0x02,0x81,0x03,0x72,0x02,0xB3,0x02,0x31,0x02,0xD8,0x75,0x85,0x02,0x93,0x02,
+    0x92,0x02,0xB2,0x02,0xA7,0x00,0x92,0x02,0x81,0x01,0x92,0x02,0x92,0x02,0x81,0x01,
+    0x31,0x02,0x76,0x34,0x42,0x59,0x5D,0x03,0x59,0x65,0x59,0x5D,0x59,0x5D,0x39,0x5D,
+    0x52,0x59,0x5D,0x00,0x59,0x65,0x42,0x59,0x5D,0x05,0x5A,0x5D,0x3A,0x5D,0x39,0x65,
+    0xB5,0x44,0xD2,0x02,0x94,0x02,0x4A,0x92,0x02,0x0E,0xB2,0x02,0xB3,0x02,0x93,0x02,
+    0x51,0x02,0xF7,0x1B,0x38,0x65,0x77,0x5D,0x59,0x55,0x19,0x65,0x58,0x5D,0x59,0x5D,
+    0x39,0x5D,0x59,0x5D,0x59,0x5D,0x39,0x65,0x58,0x59,0x5D,0x06,0x18,0x5D,0xD4,0x02,
+    0x52,0x02,0x92,0x02,0xB1,0x02,0x92,0x02,0x94,0x02,0xB8,0x01,0xFF,0xFF,0x11,0x13,
+    0x82,0xC2,0x5F,0xB2,0x02,0x04,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,
+    0x42,0xB2,0x02,0x47,0x92,0x02,0x00,0xB2,0x02,0x43,0x92,0x02,0x42,0xB2,0x02,0x01,
+    0x73,0x02,0xB3,0x02,0x81,0x08,0x92,0x02,0xB3,0x02,0x92,0x02,0xB1,0x02,0x12,0x02,
+    0x51,0x02,0x5D,0xCF,0xFF,0xFF,0xFE,0xFF,0x6A,0xFF,0xFF,0x9A,0x42,0x92,0x02,0x09,
+    0x73,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,
+    0xB2,0x02,0x93,0x02,0x4F,0x92,0x02,0x07,0x93,0x02,0x94,0x02,0x93,0x02,0x73,0x02,
+    0x92,0x02,0xD1,0x02,0xB3,0x02,0x94,0x02,0x87,0x00,0xB2,0x02,0x42,0x92,0x02,0x01,
+    0xB2,0x02,0xB3,0x02,0x49,0x92,0x02,0x0A,0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,
+    0xB1,0x02,0xB3,0x02,0x93,0x02,0x74,0x02,0xB2,0x02,0xD1,0x02,0xB2,0x02,0x45,0x92,
+    0x02,0x00,0xB2,0x02,0x81,0x00,0x92,0x02,0x81,0x07,0xB2,0x02,0x70,0x02,0xF1,0x01,
+    0x11,0x02,0x11,0x02,0xF1,0x01,0x8F,0x01,0x98,0x3C,0x99,0x00,0x93,0x02,0x81,0x08,
+    0x74,0x02,0xB3,0x02,0xD2,0x02,0x92,0x02,0x93,0x02,0x94,0x02,0x75,0x02,0x93,0x02,
+    0xB3,0x02,0x83,0x00,0xB2,0x02,0x81,0x0B,0x93,0x02,0x73,0x02,0x93,0x02,0xB2,0x02,
+    0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,
+    0x4D,0x92,0x02,0x05,0xB2,0x02,0x92,0x02,0x0F,0x02,0x75,0x23,0xFF,0xFF,0xFF,0xFF,
+    0x81,0x00,0xFE,0xFF,0x63,0xFF,0xFF,0x01,0xD9,0x75,0x11,0x02,0x42,0x92,0x02,0x00,
+    0xB2,0x02,0x81,0x00,0xB2,0x02,0x44,0x92,0x02,0x07,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0x72,0x02,0x51,0x02,0x5D,0xCF,0xFF,0xFF,0xDF,0xFF,0xAE,0x03,0xFE,0xFF,0xFE,0xFF,
+    0xFF,0xFF,0xFF,0xF7,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x05,0x5E,0xCF,
+    0xB1,0x02,0x72,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x81,0x00,0xB2,0x02,0x42,0x92,
+    0x02,0x06,0xB2,0x02,0x94,0x02,0x30,0x02,0xF6,0x2B,0xFF,0xFF,0xFC,0xBE,0x31,0x02,
+    0x43,0x92,0x02,0x85,0x04,0x93,0x02,0x92,0x02,0xB2,0x02,0xF1,0x01,0x35,0x2C,0x53,
+    0xFF,0xFF,0x96,0x07,0x5B,0x96,0x31,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,
+    0x92,0x02,0xB3,0x02,0x45,0xB2,0x02,0x01,0x93,0x02,0xB2,0x02,0x47,0x92,0x02,0x01,
+    0x10,0x02,0xD5,0x1B,0x83,0x01,0xDE,0xFF,0x13,0x13,0x8F,0x00,0x14,0x2C,0x83,0x02,
+    0x97,0x44,0x11,0x02,0x92,0x02,0x44,0xB2,0x02,0x03,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x92,0x02,0x42,0xB2,0x02,0x0A,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0x93,0x02,0x94,0x02,0x92,0x02,0x31,0x02,0x7C,0x96,0xB0,0x0F,0x93,0x02,
+    0x92,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0xD2,0x02,0x11,0x02,
+    0xF0,0x01,0xF0,0x01,0xF1,0x01,0xD0,0x01,0xF0,0x01,0xF0,0x01,0xD0,0x01,0x55,0xF0,
+    0x01,0x08,0xD0,0x01,0xD0,0x01,0xF0,0x01,0x0F,0x02,0x11,0x02,0x94,0x02,0x92,0x02,
+    0xB0,0x02,0xB2,0x02,0x89,0x07,0xB2,0x02,0xB3,0x02,0xB3,0x02,0x11,0x02,0x10,0x02,
+    0x11,0x02,0xF3,0x01,0xF1,0x01,0x42,0xF0,0x01,0x01,0xD0,0x01,0xF1,0x01,0x5A,0xF0,
+    0x01,0x05,0x72,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x73,0x0A,0x93,0x02,0xBF,0x24,
+    0x00,0xB2,0x02,0x42,0x92,0x02,0x88,0xC1,0x01,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,
+    0x0C,0x93,0x02,0x73,0x0A,0x92,0x02,0xD2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,
+    0x02,0x70,0x02,0x30,0x02,0x7D,0xA6,0xFF,0xFF,0xDE,0xFF,0x6B,0xFF,0xFF,0x98,0x00,
+    0x92,0x02,0x42,0xB2,0x02,0x06,0x93,0x02,0x93,0x02,0x92,0x02,0x52,0x0A,0x93,0x02,
+    0xB4,0x02,0x73,0x02,0x42,0x92,0x02,0x91,0x06,0xB2,0x02,0xB1,0x02,0xB4,0x02,0x74,
+    0x02,0x91,0x02,0xB0,0x02,0x93,0x02,0x87,0x03,0x91,0x02,0xB3,0x02,0x92,0x02,0xB2,
+    0x02,0x4C,0x92,0x02,0x00,0x93,0x02,0x42,0x92,0x02,0x09,0x91,0x02,0xD2,0x02,0x74,
+    0x02,0x72,0x02,0x91,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x82,
+    0x0C,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0xB3,0x02,0x91,
+    0x02,0x92,0x02,0x73,0x02,0x51,0x02,0x92,0x0A,0x9F,0xDF,0x97,0x0D,0xB2,0x02,0x93,
+    0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x91,0x02,0x73,0x02,0x93,
+    0x02,0xB1,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x81,0x02,0x93,0x02,0x92,0x02,0x93,
+    0x02,0x81,0x0A,0xB2,0x02,0xD1,0x02,0xB2,0x02,0x93,0x02,0x74,0x02,0x72,0x02,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0x4B,0x92,0x02,0x01,0xB2,0x02,0xB2,
+    0x02,0x81,0x06,0xB2,0x02,0x92,0x02,0xF1,0x01,0x1B,0x96,0xFF,0xFF,0xFF,0xFF,0xDF,
+    0xFF,0x63,0xFF,0xFF,0x07,0x3A,0x8E,0x31,0x02,0x32,0x02,0xB3,0x02,0x93,0x02,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0x42,0xB2,0x02,0x82,0x01,0x91,0x02,0x92,0x02,0x81,0x01,
+    0xF0,0x01,0x36,0x2C,0x72,0xFF,0xFF,0x04,0xDE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,
+    0xFE,0xF7,0x84,0x05,0xFF,0xFF,0x73,0x13,0x12,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,
+    0x82,0x01,0x93,0x02,0xB2,0x02,0x81,0x0A,0x93,0x02,0x52,0x02,0xF4,0x0A,0xFF,0xFF,
+    0x3B,0x7E,0xF1,0x01,0x91,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x81,0x01,
+    0x93,0x02,0x93,0x02,0x82,0x02,0x93,0x02,0x11,0x02,0x59,0x65,0xA2,0x00,0x92,0x02,
+    0x86,0x06,0x5D,0xDF,0x72,0x0A,0x52,0x02,0xB1,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,
+    0x44,0x92,0x02,0x03,0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x42,0xB2,0x02,0x85,
+    0x00,0xB5,0x1B,0x83,0x01,0xFE,0xFF,0x32,0x13,0x8F,0x00,0x14,0x34,0x83,0x03,0xB8,
+    0x44,0xF0,0x01,0xB2,0x02,0x92,0x02,0x81,0x42,0x92,0x02,0x00,0xB2,0x02,0x49,0x92,
+    0x02,0x05,0x93,0x02,0xB1,0x02,0xB2,0x02,0x51,0x02,0x91,0x0A,0x7F,0xE7,0xB0,0x0D,
+    0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB3,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x52,0xB2,0x02,0x02,
+    0x92,0x02,0x92,0x02,0xB2,0x02,0x43,0x92,0x02,0x04,0xB1,0x02,0x93,0x02,0x74,0x02,
+    0x72,0x02,0x91,0x02,0x42,0xB2,0x02,0x48,0x92,0x02,0x0E,0xB2,0x02,0x93,0x02,0x92,
+    0x02,0xD0,0x02,0x93,0x02,0x74,0x02,0x72,0x02,0xB1,0x02,0x92,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x52,0xB2,0x02,0x44,0x92,0x02,0x07,
+    0xB2,0x02,0xB0,0x02,0x93,0x02,0xB3,0x02,0x73,0x02,0xB1,0x02,0xB1,0x02,0xB3,0x02,
+    0xB8,0x00,0x12,0x13,0x85,0xE0,0x42,0xB2,0x02,0x8D,0xC3,0x01,0x93,0x02,0x93,0x02,
+    0x42,0xB2,0x02,0x08,0x92,0x02,0x72,0x02,0x92,0x02,0x71,0x02,0xF1,0x01,0xDA,0x7D,
+    0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x81,0x00,0xFE,0xFF,0xA8,0x98,0x0E,0x93,0x02,0x93,
+    0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0xD2,0x02,0xD2,0x02,0x73,0x02,0x93,0x02,0xB1,
+    0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x4F,0xB3,0x02,0x07,0x93,
+    0x02,0x92,0x02,0x90,0x02,0xB1,0x02,0x93,0x02,0x73,0x02,0x92,0x02,0xB3,0x02,0x87,
+    0x03,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x81,0x01,0xB2,0x02,0x93,0x02,0x47,
+    0xB3,0x02,0x81,0x0A,0xB2,0x02,0xB3,0x02,0x74,0x02,0x91,0x02,0xB1,0x02,0x93,0x02,
+    0x73,0x02,0x93,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x46,0x92,0x02,0x82,0x08,0x93,
+    0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x0F,0x02,0x75,0x3C,0xFF,0xFF,0xDF,
+    0xFF,0x96,0x00,0x92,0x02,0x81,0x1A,0xB2,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x93,
+    0x02,0xB3,0x02,0xB2,0x02,0xB0,0x02,0x72,0x0A,0x94,0x02,0x93,0x02,0x93,0x02,0xB3,
+    0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB1,0x02,0xB1,0x02,0x93,
+    0x02,0x94,0x02,0xB1,0x02,0xD2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x4E,0x92,0x02,
+    0x42,0xB2,0x02,0x03,0x92,0x02,0xB2,0x02,0x11,0x02,0x73,0x13,0x64,0xFF,0xFF,0x04,
+    0x9D,0xF7,0x16,0x5D,0x30,0x02,0x32,0x02,0x93,0x02,0x44,0x92,0x02,0x85,0x01,0x93,
+    0x02,0x94,0x02,0x81,0x01,0x11,0x02,0x5A,0x96,0x84,0x00,0xDF,0xFF,0x6F,0xFF,0xFF,
+    0x02,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x44,0xFF,0xFF,0x03,0xB7,0x44,0xF0,0x01,0x92,
+    0x02,0x92,0x02,0x81,0x00,0x92,0x02,0x83,0x06,0x92,0x02,0xB3,0x02,0x52,0x02,0x71,
+    0x02,0xFF,0xEF,0x18,0x45,0xF2,0x01,0x86,0x00,0xB2,0x02,0x42,0x92,0x02,0x03,0xB2,
+    0x02,0x93,0x02,0x51,0x02,0x9B,0xAE,0xA2,0x00,0xB2,0x02,0x86,0x05,0xFF,0xFF,0xD6,
+    0x1B,0xD1,0x01,0x92,0x02,0x92,0x02,0xB2,0x02,0x45,0x92,0x02,0x81,0xC9,0x85,0x01,
+    0xDE,0xFF,0x33,0x13,0x8F,0x02,0x34,0x2C,0xFF,0xFF,0xFE,0xFF,0x81,0x01,0xD8,0x3C,
+    0x10,0x02,0x81,0xC6,0x01,0x93,0x02,0x93,0x02,0x81,0x00,0x93,0x02,0x81,0x06,0x93,
+    0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x73,0x0A,0xF0,0x01,0x55,0x3C,0x44,0xFF,0xFF,
+    0xB0,0x03,0x92,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x42,0x93,0x02,0x03,0x92,0x02,
+    0xB2,0x02,0x93,0x02,0xB3,0x02,0x53,0xB2,0x02,0x0B,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0xB3,0x02,0xB3,0x02,0xD0,0x02,0x92,0x0A,0x73,0x02,0xB2,0x02,0xB3,0x02,0x94,0x02,
+    0x92,0x02,0x88,0x0E,0x93,0x02,0x93,0x02,0x92,0x02,0x91,0x02,0xB4,0x02,0x74,0x02,
+    0x92,0x02,0xAF,0x02,0x92,0x02,0x73,0x0A,0x93,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,
+    0x92,0x02,0x50,0xB2,0x02,0x01,0x92,0x02,0x92,0x02,0x45,0xB2,0x02,0x04,0x94,0x02,
+    0x92,0x02,0x72,0x02,0xB2,0x02,0x92,0x02,0x43,0xB2,0x02,0xB7,0x00,0x11,0x13,0x81,
+    0x00,0x93,0x02,0xA2,0x05,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,
+    0x02,0x49,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0x82,0x44,0xB2,0x02,0x05,0x92,0x02,
+    0x74,0x02,0xB3,0x02,0x93,0x02,0xCF,0x01,0xF7,0x54,0x42,0xFF,0xFF,0x82,0xE9,0x98,
+    0x0D,0xB3,0x02,0x93,0x02,0x93,0x02,0x73,0x02,0x92,0x02,0xB2,0x02,0x91,0x02,0x93,
+    0x02,0x12,0x02,0x10,0x02,0x10,0x02,0xF0,0x01,0x11,0x02,0x11,0x02,0x50,0x10,0x02,
+    0x07,0xF1,0x01,0x53,0x02,0xB3,0x02,0x90,0x02,0xD2,0x02,0x93,0x02,0x74,0x02,0x92,
+    0x02,0x87,0x02,0x93,0x02,0xB3,0x02,0xB3,0x02,0x81,0x00,0x50,0x02,0x49,0x10,0x02,
+    0x0F,0xF0,0x01,0x30,0x02,0xF0,0x01,0x11,0x02,0x52,0x02,0xD3,0x02,0x72,0x0A,0x92,
+    0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,
+    0x02,0x83,0x00,0x93,0x02,0x42,0x92,0x02,0x05,0x93,0x02,0xB4,0x02,0x53,0x02,0x91,
+    0x02,0x32,0x02,0xDB,0xB6,0x99,0x00,0xB3,0x02,0x83,0x0D,0x93,0x02,0x94,0x02,0xD2,
+    0x02,0xB0,0x02,0x93,0x02,0x73,0x02,0xF0,0x01,0xF0,0x01,0x11,0x02,0x10,0x02,0x10,
+    0x02,0xF0,0x01,0x10,0x02,0x10,0x02,0x42,0xF0,0x01,0x02,0x11,0x02,0x11,0x02,0x71,
+    0x02,0x42,0xB2,0x02,0x01,0x93,0x02,0xB3,0x02,0x51,0x92,0x02,0x03,0xB2,0x02,0x72,
+    0x02,0x10,0x02,0x1B,0x86,0x82,0x00,0xDF,0xFF,0x9A,0x0C,0xDC,0xBE,0x53,0x4C,0xD5,
+    0x5C,0x16,0x55,0x76,0x2C,0xF3,0x0A,0xF0,0x01,0x72,0x02,0x94,0x02,0x91,0x02,0xB1,
+    0x02,0xB2,0x02,0x73,0x02,0x87,0x04,0xB3,0x02,0xB4,0x02,0x92,0x02,0x10,0x02,0x54,
+    0x13,0x77,0xFF,0xFF,0x00,0xFE,0xFF,0x85,0x01,0x1A,0x8E,0x10,0x02,0x42,0x92,0x02,
+    0x03,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x81,0x07,0x93,0x02,0xD2,0x02,0x71,
+    0x02,0x51,0x02,0x19,0x7E,0x15,0x2C,0x32,0x02,0x92,0x02,0x82,0x02,0x93,0x02,0x92,
+    0x02,0x92,0x02,0x81,0x05,0xB2,0x02,0xB2,0x02,0x92,0x02,0x72,0x02,0xD2,0x0A,0x9E,
+    0xE7,0xA8,0x09,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xBC,0xA6,0xF1,0x01,0x53,0x02,0x93,
+    0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x43,0xB2,0x02,0x00,0x92,0x02,0x42,0xB2,0x02,
+    0x81,0x45,0xB2,0x02,0x01,0x11,0x02,0xD5,0x23,0x81,0x00,0xFF,0xF7,0x81,0x00,0x13,
+    0x13,0x8F,0x02,0x14,0x34,0xFF,0xFF,0xDF,0xFF,0x81,0x01,0xD8,0x44,0xF0,0x01,0x49,
+    0x92,0x02,0x04,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,
+    0x05,0xB2,0x02,0xB2,0x02,0x12,0x02,0x72,0x02,0x7D,0xDF,0xFE,0xFF,0x85,0x00,0xB2,
+    0x02,0xAE,0xC1,0x01,0xB2,0x02,0xB2,0x02,0x82,0xC3,0x8F,0x01,0x92,0x02,0xB2,0x02,
+    0x43,0x92,0x02,0x81,0x06,0xB1,0x02,0x72,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x93,
+    0x02,0xB2,0x02,0x49,0x92,0x02,0x0E,0xB2,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0x93,
+    0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0xB4,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0x97,0x07,0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,
+    0x02,0x93,0x02,0x93,0x02,0x92,0x02,0xB9,0x00,0x31,0x02,0xA5,0x42,0x92,0x02,0x81,
+    0x00,0x93,0x02,0x4A,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0x43,0x92,0x02,0x0A,0xB1,
+    0x02,0xB2,0x02,0x73,0x02,0x94,0x02,0xD1,0x02,0xEF,0x01,0xF6,0x3B,0xFF,0xFF,0xFF,
+    0xFF,0xDE,0xFF,0xFE,0xFF,0x6C,0xFF,0xFF,0x98,0x0E,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0x93,0x02,0x93,0x02,0x92,0x02,0x72,0x02,0xB1,0x02,0xD6,0x1B,0x37,0x34,0x36,0x24,
+    0x36,0x2C,0x16,0x24,0x17,0x2C,0x15,0x2C,0x4F,0x16,0x24,0x07,0x36,0x34,0x34,0x13,
+    0x73,0x02,0xB3,0x02,0x71,0x02,0xB2,0x02,0xB3,0x02,0x91,0x02,0x87,0x07,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0x91,0x02,0x51,0x02,0xF3,0x0A,0x57,0x2C,0x16,0x2C,0x48,0x16,
+    0x24,0x08,0x36,0x24,0x36,0x2C,0x56,0x2C,0x32,0x13,0x73,0x02,0x94,0x02,0x71,0x02,
+    0xD1,0x02,0x93,0x02,0x42,0x92,0x02,0x05,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0x42,0x93,0x02,0x06,0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,
+    0x92,0x02,0x10,0x02,0xB5,0x23,0x57,0xFF,0xFF,0x00,0xF9,0x4C,0x83,0x02,0x93,0x02,
+    0x93,0x02,0x92,0x02,0x81,0x18,0x91,0x02,0x93,0x02,0x53,0x02,0x12,0x0B,0x97,0x3C,
+    0x78,0x34,0x77,0x34,0x77,0x34,0x78,0x34,0x77,0x34,0x77,0x34,0x76,0x34,0x56,0x34,
+    0x58,0x34,0x78,0x34,0x76,0x34,0x57,0x3C,0x94,0x02,0x72,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x87,0x00,0xB2,0x02,0x86,0x03,0xB1,0x02,
+    0xB3,0x02,0x11,0x02,0x32,0x13,0x5E,0xFF,0xFF,0x0C,0x36,0x65,0x2C,0x01,0xF0,0x01,
+    0xCF,0x01,0x11,0x02,0x51,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0x93,0x02,0x94,0x02,0x87,0xC1,0x02,0x93,0x02,0xEF,0x01,0x58,0x65,0x87,0x02,0x9C,
+    0xAE,0x73,0x1B,0x15,0x2C,0x68,0xF5,0x2B,0x03,0x35,0x24,0x15,0x2C,0x74,0x13,0xFA,
+    0x85,0x46,0xFF,0xFF,0x03,0x7D,0xD7,0x91,0x02,0x72,0x02,0xB2,0x02,0x81,0x0F,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB1,0x02,0x92,0x02,0x52,
+    0x02,0xD5,0x1B,0x13,0x13,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x82,
+    0x00,0x93,0x02,0x81,0x03,0xB1,0x02,0x92,0x02,0x11,0x02,0xB4,0x23,0x54,0xFF,0xFF,
+    0x96,0x06,0xDF,0xFF,0xFF,0xFF,0xB8,0x6D,0xCE,0x01,0x11,0x02,0x93,0x02,0x93,0x02,
+    0x4E,0x92,0x02,0x81,0x07,0xF0,0x01,0x15,0x2C,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0x33,0x13,0x91,0xC2,0x02,0x56,0x34,0x11,0x02,0x93,0x02,0x4E,0x92,
+    0x02,0x08,0x93,0x02,0x93,0x02,0x73,0x02,0xAF,0x01,0x8F,0x0A,0xBC,0x9E,0xFF,0xFF,
+    0xFD,0xFF,0xFE,0xFF,0x84,0x00,0x92,0x02,0xAA,0xC1,0x0C,0xB2,0x02,0xB2,0x02,0xB3,
+    0x02,0x93,0x02,0x72,0x0A,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x93,
+    0x02,0x92,0x02,0x93,0x02,0x58,0x92,0x02,0x06,0x93,0x02,0x93,0x02,0x92,0x02,0x91,
+    0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x87,0x09,0xB2,0x02,0x93,0x02,0xB2,0x02,0x92,
+    0x02,0xB1,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB3,0x02,0x93,0x02,0x84,0x00,0x93,
+    0x02,0x4F,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0x45,0x92,0x02,0x01,0xB2,0x02,0x93,
+    0x02,0x81,0x01,0x92,0x02,0x93,0x02,0x42,0xB2,0x02,0xB8,0x00,0x32,0x02,0x42,0x92,
+    0x02,0x00,0xB2,0x02,0xA5,0x01,0x93,0x02,0xB2,0x02,0x4E,0x92,0x02,0x0D,0x93,0x02,
+    0x93,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xD3,0x02,0xEE,0x01,0x53,0x23,0xFF,0xFF,
+    0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xF7,0xAB,0x99,0x0A,0x93,0x02,0x92,
+    0x02,0x92,0x02,0xB1,0x02,0x93,0x02,0x93,0x02,0x10,0x02,0x79,0x65,0xFF,0xFF,0xFF,
+    0xFF,0xDF,0xFF,0x53,0xFF,0xFF,0x06,0x5B,0xA6,0x10,0x02,0x93,0x02,0x72,0x02,0x93,
+    0x02,0x93,0x02,0x92,0x02,0x87,0x05,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xEF,
+    0x01,0x59,0x55,0x4D,0xFF,0xFF,0x06,0x3B,0x9E,0x11,0x02,0x94,0x02,0x92,0x02,0xB2,
+    0x02,0x94,0x02,0x93,0x02,0x87,0x00,0x92,0x02,0x85,0x05,0x93,0x02,0x10,0x02,0xDC,
+    0x85,0xFF,0xFF,0xDE,0xFF,0xFE,0xFF,0x99,0x00,0x92,0x02,0x81,0x05,0x92,0x02,0x94,
+    0x02,0x92,0x02,0x93,0x02,0x31,0x02,0x78,0x7D,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x48,
+    0xFF,0xFF,0x07,0xF8,0x4C,0xF0,0x01,0xB2,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,
+    0x02,0x93,0x02,0x50,0x92,0x02,0x03,0xB4,0x02,0x73,0x02,0x0F,0x02,0xFA,0x8D,0x81,
+    0x00,0xFF,0xF7,0x9A,0x08,0x99,0x75,0x10,0x02,0xB3,0x02,0xB2,0x02,0x93,0x02,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x42,0x93,0x02,0x00,0xB2,0x02,0x42,0x92,0x02,
+    0x00,0xB2,0x02,0x42,0x92,0x02,0x05,0xB2,0x02,0xB2,0x02,0x93,0x02,0x51,0x02,0xD2,
+    0x02,0x9E,0xD7,0x84,0x00,0xDF,0xFF,0x81,0x01,0x9A,0x7D,0x6E,0x01,0x68,0xF0,0x01,
+    0x04,0xF1,0x01,0x0E,0x02,0xF0,0x01,0x2E,0x01,0xB7,0x44,0x82,0x00,0xDF,0xFF,0x43,
+    0xFF,0xFF,0x04,0xB4,0x1B,0x10,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x82,0xC2,0x04,
+    0xB2,0x02,0x92,0x02,0xB3,0x02,0x73,0x02,0x92,0x02,0x83,0x02,0x92,0x02,0x93,0x02,
+    0xB2,0x02,0x82,0x04,0x92,0x02,0xB2,0x02,0x92,0x02,0xF0,0x01,0xB8,0x54,0x81,0x01,
+    0xDF,0xFF,0xFE,0xFF,0xA5,0xC1,0x09,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0x1B,0x96,0xD3,
+    0x12,0x0E,0x02,0x0F,0x02,0xF0,0x01,0xF1,0x01,0xF1,0x01,0x42,0xF0,0x01,0x02,0xF1,
+    0x01,0xF0,0x01,0xF1,0x01,0x47,0xF0,0x01,0x06,0x4E,0x01,0x92,0x13,0xDF,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0xFF,0xFF,0xDE,0xF7,0x92,0x00,0xDF,0xFF,0x81,0x18,0x74,0x23,0x90,
+    0x01,0x0F,0x02,0x31,0x02,0x10,0x02,0x10,0x02,0x30,0x02,0x30,0x02,0x10,0x02,0x10,
+    0x02,0x11,0x02,0x10,0x02,0x0F,0x02,0x31,0x02,0x11,0x02,0x11,0x02,0x30,0x02,0x11,
+    0x02,0x31,0x02,0x0F,0x02,0x90,0x0A,0x37,0x2C,0x5D,0xD7,0xFF,0xFF,0xDF,0xFF,0x44,
+    0xFF,0xFF,0x81,0x00,0xB2,0x02,0xA9,0x01,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x03,
+    0xB2,0x02,0x93,0x02,0x92,0x02,0xB3,0x02,0x81,0x03,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0x58,0x92,0x02,0x06,0x93,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x73,0x02,
+    0x93,0x02,0xB2,0x02,0x48,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0x43,0x92,0x02,0x03,
+    0x93,0x02,0xB2,0x02,0xB2,0x02,0x91,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x51,0x92,
+    0x02,0x42,0xB2,0x02,0x49,0x92,0x02,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB7,0x01,
+    0xFE,0xFF,0x12,0x13,0x81,0x00,0xB2,0x02,0xA4,0x00,0x93,0x02,0x81,0x00,0xB3,0x02,
+    0x89,0x01,0xB2,0x02,0xB2,0x02,0x82,0x0B,0xB2,0x02,0xB3,0x02,0xB3,0x02,0x92,0x02,
+    0x93,0x02,0xD3,0x02,0x51,0x02,0xF3,0x12,0xBF,0xDF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,
+    0x81,0x01,0xDF,0xFF,0xDF,0xFF,0x81,0x00,0xFE,0xFF,0xA7,0x99,0x07,0x92,0x02,0x93,
+    0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x12,0x02,0x34,0x13,0x43,0xFF,0xFF,
+    0x00,0xFE,0xFF,0x91,0x05,0xBF,0xF7,0xF2,0x0A,0x72,0x02,0xB3,0x02,0x92,0x02,0xB2,
+    0x02,0x86,0x07,0x93,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x73,0x02,0x52,
+    0x02,0x1D,0xC7,0x8D,0x07,0xFF,0xF7,0x14,0x13,0x11,0x02,0xB3,0x02,0x93,0x02,0xB2,
+    0x02,0xB3,0x02,0x93,0x02,0x81,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x42,0x92,0x02,
+    0x0A,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x50,0x02,0x13,
+    0x0B,0xBF,0xF7,0xFF,0xFF,0xDF,0xFF,0x55,0xFF,0xFF,0x82,0xC1,0x08,0xB1,0x02,0xB2,
+    0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0x73,0x02,0x51,0x02,0xF2,0x02,0xDE,0xF7,0x4C,
+    0xFF,0xFF,0x08,0x9F,0xEF,0x93,0x0A,0x51,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x73,
+    0x02,0x92,0x02,0xB2,0x02,0x8A,0x42,0xB2,0x02,0x05,0x92,0x02,0x93,0x0A,0x92,0x02,
+    0xD3,0x02,0x11,0x02,0x74,0x1B,0x5D,0xFF,0xFF,0x03,0x98,0x7D,0xEF,0x01,0x93,0x02,
+    0xB1,0x02,0x43,0x92,0x02,0x03,0x93,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0x46,0x92,
+    0x02,0x05,0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x11,0x02,0xB5,0x1B,0x48,0xFF,
+    0xFF,0x02,0x1A,0x86,0x11,0x02,0x93,0x02,0x67,0x92,0x02,0x04,0x93,0x02,0xB2,0x02,
+    0xB3,0x02,0xF0,0x01,0x18,0x55,0x82,0x0D,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,
+    0xFF,0xFF,0xD9,0x44,0xF1,0x01,0x92,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0x93,0x02,
+    0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x42,0x92,0x02,0x02,0xB2,0x02,
+    0xB2,0x02,0x93,0x02,0x81,0x09,0x92,0x02,0xB3,0x02,0x93,0x02,0xB2,0x02,0x91,0x02,
+    0x92,0x02,0x94,0x02,0x91,0x02,0x10,0x02,0x1C,0x86,0x42,0xFF,0xFF,0x00,0xDF,0xFF,
+    0xA7,0xC1,0x04,0xDF,0xFF,0xFF,0xFF,0xDE,0xFF,0x3A,0x96,0x18,0x4D,0x42,0x78,0x3C,
+    0x05,0x77,0x3C,0x77,0x3C,0x97,0x3C,0x78,0x3C,0x77,0x3C,0x78,0x3C,0x47,0x97,0x3C,
+    0x03,0x16,0x3C,0x98,0x75,0xFF,0xFF,0xDF,0xFF,0x81,0x01,0xBF,0xFF,0x53,0x13,0x8F,
+    0x00,0x15,0x34,0x43,0xFF,0xFF,0x14,0x5C,0xA6,0x9B,0x6D,0x3B,0x7E,0x1B,0x7E,0xFB,
+    0x7D,0xFB,0x85,0x1B,0x7E,0x1B,0x7E,0xFB,0x7D,0xFB,0x85,0x1B,0x7E,0x1B,0x76,0x19,
+    0x7E,0xFB,0x85,0xBC,0x75,0xBA,0x75,0xBA,0x7D,0x9B,0x75,0xBB,0x6D,0x3B,0x8E,0x3C,
+    0xD7,0x43,0xFF,0xFF,0x00,0xDF,0xFF,0x85,0x00,0x93,0x02,0x4A,0x92,0x02,0x9E,0x00,
+    0x92,0x02,0x84,0x09,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x8F,0x01,0xB2,0x02,0xB2,0x02,0x83,0x03,
+    0xB2,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x42,0xB2,0x02,0x01,0x92,0x02,0x93,0x02,
+    0x4A,0x92,0x02,0x00,0xB2,0x02,0x83,0x08,0x92,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x52,0x92,0x02,0x43,0xB2,0x02,
+    0x01,0x92,0x02,0xB2,0x02,0x44,0x92,0x02,0xBB,0x05,0x33,0x02,0x92,0x02,0xB1,0x02,
+    0xB2,0x02,0xB2,0x02,0x93,0x02,0x9F,0x00,0x93,0x02,0x85,0x00,0xB2,0x02,0x4A,0x92,
+    0x02,0x00,0xB2,0x02,0x44,0x92,0x02,0x03,0x93,0x02,0x92,0x02,0xF0,0x01,0x39,0x65,
+    0x72,0xFF,0xFF,0x99,0xC1,0x0B,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x91,0x02,
+    0x50,0x02,0xBD,0xAE,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0x51,0xFF,
+    0xFF,0x05,0x77,0x3C,0xF0,0x01,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x43,0x92,
+    0x02,0x43,0xB2,0x02,0x04,0x91,0x02,0xB1,0x02,0x93,0x02,0x10,0x02,0xB4,0x1B,0x4F,
+    0xFF,0xFF,0x0E,0xF8,0x44,0xF0,0x01,0xB2,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0xB3,
+    0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0x43,0x92,0x02,0x06,0xB2,0x02,0x93,0x02,0xF0,0x01,0xD9,0x4C,0xFF,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0x8B,0x00,0xDF,0xFF,0x83,0x01,0x17,0x6D,0x17,0x4D,0x82,0x06,0xF9,
+    0x54,0xF1,0x01,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x43,0x92,0x02,
+    0x01,0xEF,0x01,0xF8,0x4C,0x4B,0xFF,0xFF,0x0B,0xFF,0xF7,0xFE,0xFF,0xFF,0xFF,0xF9,
+    0x4C,0xD1,0x01,0x92,0x02,0xB1,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,
+    0x02,0x87,0x01,0xB2,0x02,0xB2,0x02,0x43,0x92,0x02,0x07,0xB1,0x02,0x94,0x02,0x92,
+    0x02,0x51,0x02,0x30,0x02,0x9C,0xA6,0xFF,0xFF,0xFE,0xFF,0x9A,0x00,0x99,0x75,0x81,
+    0x00,0xB2,0x02,0x82,0x04,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x48,
+    0x92,0x02,0x03,0x93,0x02,0x93,0x02,0x11,0x02,0x95,0x13,0x88,0x01,0xFB,0x85,0x11,
+    0x02,0x68,0x92,0x02,0x03,0xB2,0x02,0xB2,0x02,0x93,0x02,0xD0,0x01,0x83,0x00,0xDF,
+    0xFF,0x43,0xFF,0xFF,0x03,0x5A,0x8E,0x10,0x02,0x93,0x02,0xB2,0x02,0x42,0x92,0x02,
+    0x00,0xB2,0x02,0x83,0xC6,0x82,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,
+    0x02,0x72,0x02,0xB2,0x02,0x7E,0xD7,0x81,0x01,0xFE,0xF7,0xBF,0xFF,0xA0,0x00,0x11,
+    0x02,0x87,0xD7,0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x02,0xDF,0xFF,0x33,0x13,0x32,0x02,
+    0x43,0x92,0x02,0x00,0xB2,0x02,0x89,0x00,0x14,0x2C,0x82,0x02,0xFF,0xF7,0xDF,0xFF,
+    0xFE,0xFF,0x5B,0xFF,0xFF,0x81,0x4B,0x92,0x02,0xA3,0xC2,0x00,0xB2,0x02,0x81,0x00,
+    0xB2,0x02,0x42,0x92,0x02,0x50,0xB2,0x02,0x47,0x92,0x02,0x07,0x93,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x87,0x07,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x47,0x92,
+    0x02,0x4F,0xB2,0x02,0x46,0x92,0x02,0x00,0x93,0x02,0x81,0x05,0x93,0x02,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB8,0x05,0x11,0x13,0x72,0x02,0xB2,0x02,
+    0x93,0x02,0x93,0x02,0x92,0x02,0xA2,0x06,0xB3,0x02,0x93,0x02,0x93,0x02,0x92,0x02,
+    0x72,0x0A,0x75,0x02,0x94,0x02,0x81,0x04,0x93,0x02,0xB2,0x02,0xB2,0x02,0xB3,0x02,
+    0xB2,0x02,0x48,0x92,0x02,0x81,0x01,0x10,0x02,0x19,0x5D,0xB2,0x98,0x00,0x92,0x02,
+    0x85,0x03,0xB1,0x02,0xF1,0x01,0xB9,0x4C,0xDF,0xFF,0x81,0xD3,0x06,0x3B,0x9E,0x30,
+    0x02,0x92,0x02,0x92,0x02,0x72,0x02,0x92,0x02,0xB2,0x02,0x43,0x92,0x02,0x82,0x06,
+    0x92,0x02,0xB2,0x02,0x94,0x02,0xEF,0x01,0x77,0x6D,0xFF,0xFF,0xFE,0xFF,0x8D,0x03,
+    0xFC,0xBE,0x72,0x02,0x72,0x02,0xB2,0x02,0x42,0x92,0x02,0x11,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0x52,0x02,0x72,0x02,0x3C,0xD7,0xFF,0xFF,0xDF,0xFF,
+    0x50,0xFF,0xFF,0x03,0xFF,0xF7,0xF3,0x0A,0xAD,0x01,0x19,0x86,0x81,0x01,0xFA,0x4C,
+    0x10,0x02,0x81,0x00,0x92,0x02,0x43,0xB2,0x02,0x07,0x93,0x02,0x72,0x02,0x92,0x02,
+    0x3F,0xE7,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0xDF,0xFF,0x4A,0xFF,0xFF,0x07,0xBE,0xE7,
+    0xB3,0x02,0x51,0x02,0x91,0x02,0x93,0x02,0xB1,0x02,0x74,0x02,0x93,0x02,0x4E,0x92,
+    0x02,0x05,0xB2,0x02,0x95,0x02,0x91,0x02,0x91,0x02,0xF0,0x01,0x16,0x2C,0x84,0x00,
+    0xDF,0xFF,0x96,0x00,0x99,0x7D,0x83,0x00,0xB2,0x02,0x45,0x92,0x02,0x00,0xB2,0x02,
+    0xBF,0x00,0x00,0x92,0x02,0x81,0x00,0xF0,0x01,0x83,0xC1,0x00,0xFE,0xFF,0x81,0x05,
+    0x7D,0xDF,0xD2,0x02,0x53,0x02,0x91,0x02,0xB2,0x02,0x93,0x02,0x81,0x01,0x92,0x02,
+    0xB2,0x02,0x4A,0x92,0x02,0x00,0xB2,0x02,0x81,0x08,0x92,0x02,0x93,0x02,0xB2,0x02,
+    0xB2,0x02,0x33,0x02,0x74,0x13,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x52,0xFF,0xFF,0x8E,
+    0x00,0x92,0x02,0x8B,0x03,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,0x82,0x15,0xBE,
+    0xF7,0x1C,0xBF,0xFC,0xCE,0xFC,0xCE,0x1C,0xC7,0xFC,0xC6,0xFB,0xCE,0x1B,0xCF,0x1C,
+    0xC7,0x1C,0xCF,0x1B,0xCF,0x1B,0xCF,0xFB,0xC6,0x3D,0xCF,0xFF,0xFF,0xDF,0xFF,0xDF,
+    0xFF,0xFF,0xFF,0xDE,0xFF,0x13,0x13,0x32,0x02,0xB2,0x02,0x43,0x92,0x02,0x89,0x02,
+    0x15,0x34,0xFF,0xFF,0xFE,0xFF,0x42,0xFF,0xFF,0x04,0x98,0x54,0xF3,0x12,0x53,0x1B,
+    0x53,0x1B,0x54,0x1B,0x42,0x53,0x1B,0x0C,0x54,0x13,0x54,0x1B,0x53,0x1B,0x35,0x1B,
+    0x13,0x13,0xDA,0xAE,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0xDF,0xFF,0x89,0x00,0x93,0x02,0xA9,0x00,0xB2,0x02,0x47,0x92,0x02,0x01,0xB2,0x02,
+    0x92,0x02,0x83,0x00,0x92,0x02,0x4F,0x93,0x02,0x48,0x92,0x02,0x05,0xB2,0x02,0x93,
+    0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x48,0x92,0x02,0x02,0x93,0x02,0x92,
+    0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0x93,0x02,0x48,0x92,0x02,0x4F,0x93,0x02,0x47,
+    0x92,0x02,0x42,0xB2,0x02,0x01,0x92,0x02,0x93,0x02,0x43,0xB2,0x02,0xB6,0x07,0xBE,
+    0xFF,0x32,0x13,0x32,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB1,0x02,0x62,
+    0xB2,0x02,0x0A,0x92,0x02,0x92,0x02,0x91,0x02,0x91,0x02,0xB3,0x02,0xB2,0x02,0xB2,
+    0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x4A,0x92,0x02,0xB6,0x9E,0x03,0x92,
+    0x02,0xB3,0x02,0x31,0x02,0x34,0x13,0x56,0xFF,0xFF,0x05,0xDF,0xEF,0x13,0x0B,0x51,
+    0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x48,0x92,0x02,0x03,0x93,0x02,0x53,0x02,0xB1,
+    0x02,0x5C,0xD7,0x4F,0xFF,0xFF,0x09,0xFE,0xFF,0x95,0x1B,0x31,0x02,0xB3,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x42,0x92,0x02,0x85,0x05,
+    0xB2,0x02,0xF1,0x01,0x16,0x2C,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x90,0x0A,0x7C,0x9E,
+    0x30,0x02,0x31,0x02,0x31,0x02,0x1B,0x96,0xFF,0xFF,0x19,0x4D,0xF0,0x01,0x72,0x02,
+    0x93,0x02,0x93,0x02,0x43,0x92,0x02,0x03,0xB3,0x02,0xF1,0x01,0x76,0x34,0xFF,0xFF,
+    0x81,0x49,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x05,0xF8,0x44,0xF0,0x01,0x94,
+    0x02,0xB2,0x02,0xB1,0x02,0xB3,0x02,0x4F,0x92,0x02,0x08,0x74,0x02,0x93,0x02,0xB2,
+    0x02,0xB3,0x02,0x52,0x02,0x72,0x02,0x5D,0xCF,0xFF,0xFF,0xDF,0xFF,0x99,0x00,0x98,
+    0x7D,0x85,0x00,0x93,0x02,0x83,0x00,0x93,0x02,0xBF,0x01,0x02,0x93,0x02,0x92,0x02,
+    0xD0,0x01,0x85,0xC3,0x05,0xB5,0x23,0x11,0x02,0x91,0x02,0xB3,0x02,0x73,0x02,0xB2,
+    0x02,0x82,0x00,0x93,0x02,0x88,0x0C,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,
+    0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xF1,0x01,0x77,0x3C,0xFF,0xFF,0xFE,0xFF,0xBF,
+    0xFF,0xAD,0x02,0xFE,0xF7,0xFF,0xFF,0xDF,0xFF,0x42,0xFF,0xFF,0x08,0xFE,0xFF,0xFF,
+    0xFF,0xFC,0xCE,0x50,0x02,0x70,0x02,0x91,0x0A,0xD1,0x02,0xB0,0x02,0x71,0x0A,0x44,
+    0x91,0x0A,0x06,0xEF,0x01,0xF5,0x23,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFE,
+    0xFF,0x90,0x00,0x14,0x2C,0x42,0xFF,0xFF,0x0F,0xFE,0xFF,0xFF,0xFF,0x97,0x23,0x90,
+    0x01,0x31,0x02,0x31,0x02,0x32,0x02,0x31,0x02,0x32,0x02,0x31,0x02,0x32,0x02,0x32,
+    0x02,0x50,0x02,0x32,0x02,0xCF,0x01,0x59,0x9E,0x4E,0xFF,0xFF,0xAC,0xC8,0x06,0xB2,
+    0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x57,0xB2,0x02,
+    0x43,0x92,0x02,0x03,0xB2,0x02,0xB2,0x02,0x72,0x02,0xB3,0x02,0x87,0x00,0xB2,0x02,
+    0x43,0x92,0x02,0x5C,0xB2,0x02,0x01,0x93,0x02,0x93,0x02,0x43,0xB2,0x02,0x01,0x92,
+    0x02,0x92,0x02,0x81,0x03,0xB3,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB7,0x07,0xFE,
+    0xFF,0x12,0x13,0x33,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x93,0x02,0x94,0x02,0x62,
+    0x93,0x02,0x08,0x94,0x02,0xB3,0x02,0x94,0x02,0xD4,0x02,0xD1,0x02,0x91,0x02,0x92,
+    0x02,0xB3,0x02,0x93,0x02,0x82,0x00,0xB2,0x02,0xBF,0x00,0x98,0x0D,0x93,0x02,0x93,
+    0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x94,0x02,0x71,0x02,0x50,
+    0x02,0xBE,0xAE,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,0x53,0xFF,0xFF,0x03,0x77,0x3C,0xF0,
+    0x01,0xB2,0x02,0xB3,0x02,0x88,0x03,0xB2,0x02,0x94,0x02,0xF0,0x01,0x15,0x1C,0x4E,
+    0xFF,0xFF,0x0A,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB9,0x75,0x10,0x02,0x93,0x02,0x93,
+    0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x82,0x03,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0x43,0x92,0x02,0x01,0x10,0x02,0x5B,0x9E,0x42,0xFF,0xFF,0x01,0xDF,
+    0xFF,0xDF,0xFF,0x8E,0x11,0x36,0x34,0xF0,0x01,0x94,0x02,0x32,0x02,0x30,0x02,0x3D,
+    0xBF,0x1B,0x76,0x11,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,
+    0x02,0x93,0x02,0x71,0x02,0x31,0x02,0xFC,0xAE,0x4B,0xFF,0xFF,0x00,0xDF,0xFF,0x83,
+    0x05,0x9D,0xDF,0x91,0x02,0x33,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x8F,0x09,0x93,
+    0x02,0xB1,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xF0,0x01,0x17,0x4D,0xFF,0xFF,0xFF,
+    0xFF,0xDF,0xF7,0x58,0xFF,0xFF,0x84,0xC4,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xBF,
+    0x01,0xC1,0x01,0xF0,0x01,0x19,0x55,0x88,0x08,0xF7,0x54,0xF0,0x01,0x92,0x02,0x92,
+    0x02,0x93,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x8F,0x06,0x91,0x02,0x92,
+    0x02,0xF0,0x01,0xBA,0x7D,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xA9,0x00,0xDF,0xFF,0x43,
+    0xFF,0xFF,0x00,0xFE,0xFF,0x45,0xFF,0xFF,0x12,0xDC,0xC6,0x73,0x02,0x32,0x02,0x53,
+    0x02,0x73,0x02,0x72,0x02,0x72,0x02,0x73,0x02,0x73,0x02,0x72,0x02,0x72,0x02,0x73,
+    0x02,0xF0,0x01,0x76,0x13,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0x81,
+    0x43,0x92,0x02,0x00,0xB2,0x02,0x89,0x13,0x14,0x34,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0x16,0x2C,0x11,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x92,0x02,
+    0x73,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x10,0x02,0x9B,0xB6,
+    0x82,0x02,0xDE,0xFF,0xFF,0xFF,0xFE,0xFF,0xB5,0x00,0x93,0x02,0x82,0x01,0xB2,0x02,
+    0xB2,0x02,0x61,0x92,0x02,0x42,0x93,0x02,0x43,0x92,0x02,0x00,0xB2,0x02,0x87,0x02,
+    0x91,0x02,0xB2,0x02,0x93,0x02,0x43,0xB2,0x02,0x60,0x92,0x02,0x00,0xB2,0x02,0x44,
+    0x92,0x02,0x01,0xB2,0x02,0x93,0x02,0xB7,0x06,0xFF,0xF7,0x6E,0x0A,0x6D,0x01,0xEE,
+    0x01,0xCF,0x01,0xCE,0x01,0xEE,0x01,0x61,0xCF,0x01,0x42,0xEF,0x01,0x06,0xCE,0x01,
+    0xD0,0x01,0xEE,0x01,0x30,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x42,0xB2,0x02,0x01,
+    0x92,0x02,0x93,0x02,0x89,0x00,0xB2,0x02,0xB4,0x9F,0xC1,0x01,0xEF,0x01,0xD8,0x44,
+    0x81,0x52,0xFF,0xFF,0x05,0xFE,0xFF,0xFF,0xFF,0x5B,0x96,0x10,0x02,0x91,0x02,0x93,
+    0x02,0x88,0x03,0x92,0x02,0x93,0x02,0x10,0x02,0xB8,0x85,0x51,0xFF,0xFF,0x05,0xBE,
+    0xE7,0x93,0x0A,0x51,0x02,0xB1,0x02,0x93,0x02,0xB3,0x02,0x42,0x92,0x02,0x00,0xB2,
+    0x02,0x85,0x03,0xB2,0x02,0x92,0x02,0x11,0x02,0x33,0x13,0x53,0xFF,0xFF,0x0A,0x5E,
+    0xD7,0x71,0x02,0x54,0x02,0xB3,0x02,0xB2,0x02,0x31,0x02,0xF2,0x0A,0x15,0x24,0x71,
+    0x02,0x92,0x02,0xB3,0x02,0x43,0x92,0x02,0x02,0x93,0x02,0xF1,0x01,0xD4,0x23,0x50,
+    0xFF,0xFF,0x06,0xDF,0xFF,0xFF,0xFF,0xB8,0x4C,0xF1,0x01,0x91,0x02,0xB3,0x02,0xB2,
+    0x02,0x8C,0x42,0xB2,0x02,0x07,0x92,0x02,0xB1,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,
+    0x11,0x02,0xF3,0x12,0xDF,0xFF,0x5A,0xFF,0xFF,0x82,0x02,0x92,0x02,0xB2,0x02,0x93,
+    0x02,0x81,0x01,0xB2,0x02,0x93,0x02,0x42,0xB2,0x02,0xBF,0x01,0x01,0xB2,0x02,0x93,
+    0x02,0x84,0x00,0xFE,0xFF,0x82,0x0B,0xFE,0xFF,0xDF,0xFF,0x7A,0x9E,0x11,0x02,0x93,
+    0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x87,
+    0x01,0xB2,0x02,0x92,0x02,0x42,0xB2,0x02,0x05,0x93,0x02,0x92,0x02,0x91,0x02,0x93,
+    0x02,0x71,0x02,0x1D,0xC7,0x55,0xFF,0xFF,0x8E,0x01,0xB2,0x02,0x10,0x02,0x85,0xCB,
+    0x0D,0xFC,0xBE,0x73,0x02,0x92,0x02,0x93,0x02,0x72,0x02,0x73,0x02,0xB2,0x02,0xB2,
+    0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x10,0x02,0xD5,0x23,0x43,0xFF,0xFF,
+    0x00,0xDE,0xF7,0x90,0x00,0x15,0x34,0x44,0xFF,0xFF,0x01,0x16,0x2C,0xF0,0x01,0x82,
+    0x02,0x93,0x02,0x72,0x02,0xB3,0x02,0x81,0x03,0x93,0x02,0x92,0x02,0xF0,0x01,0x3C,
+    0x86,0x45,0xFF,0xFF,0x00,0xDF,0xFF,0x89,0x4B,0x92,0x02,0x9E,0xC2,0x42,0xB2,0x02,
+    0x81,0x07,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB3,0x02,
+    0x92,0x02,0x57,0xB2,0x02,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x81,0x00,0xB2,0x02,
+    0x89,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x59,0xB2,0x02,0x87,0x01,
+    0x93,0x02,0xB3,0x02,0x82,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB6,0x08,0xDF,0xFF,
+    0xFF,0xEF,0x77,0x6D,0xB5,0x5C,0x16,0x5D,0xF6,0x64,0xF6,0x5C,0x16,0x5D,0x16,0x65,
+    0x61,0x16,0x5D,0x06,0xF6,0x64,0x16,0x5D,0xF6,0x6C,0xF6,0x5C,0xF5,0x7C,0x95,0x2B,
+    0x52,0x02,0x81,0x00,0x92,0x02,0x81,0x01,0x93,0x02,0xB2,0x02,0xBF,0x00,0x9E,0x05,
+    0x92,0x02,0x92,0x02,0xB3,0x02,0x31,0x02,0x72,0x13,0xFF,0xF7,0x55,0xFF,0xFF,0x04,
+    0xDF,0xEF,0xF4,0x0A,0x30,0x02,0xB2,0x02,0x72,0x02,0x42,0xB2,0x02,0x00,0x92,0x02,
+    0x43,0xB2,0x02,0x03,0x93,0x02,0x72,0x02,0xD2,0x02,0x9E,0xEF,0x52,0xFF,0xFF,0x12,
+    0x37,0x34,0xF0,0x01,0xB1,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,
+    0xB3,0x02,0xEF,0x01,0x59,0x65,0x81,0x00,0xDF,0xFF,0x90,0x09,0x37,0x4D,0xF0,0x01,
+    0xB3,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x53,0x02,0x30,0x02,0xB2,0x02,0xB2,0x02,
+    0x42,0x92,0x02,0x04,0xB3,0x02,0x92,0x02,0x92,0x02,0x11,0x02,0x7A,0x86,0x8F,0x07,
+    0xFE,0xFF,0xFF,0xF7,0xFF,0xFF,0x5E,0xDF,0xB1,0x02,0x52,0x02,0x93,0x02,0xD2,0x02,
+    0x8F,0x07,0xB2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x10,0x02,
+    0x3B,0x96,0x81,0x02,0xFE,0xFF,0xDE,0xFF,0xDF,0xFF,0x96,0x0B,0xF0,0x01,0xB3,0x02,
+    0xB2,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0xB1,0x02,0xB3,0x02,0xBF,0x00,0x01,0x93,0x02,0x94,0x02,0x81,0x00,0x18,0x55,0x45,
+    0xFF,0xFF,0x06,0xFE,0xF7,0xFE,0xFF,0xFF,0xFF,0xBE,0xE7,0xD3,0x0A,0x51,0x02,0xB2,
+    0x02,0x43,0x92,0x02,0x00,0xB2,0x02,0x48,0x92,0x02,0x81,0xC2,0x07,0xB3,0x02,0xB2,
+    0x02,0x71,0x0A,0x52,0x02,0x33,0x13,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xB6,0x04,0x78,
+    0x75,0xF0,0x01,0x93,0x02,0xB1,0x02,0x91,0x02,0x46,0x92,0x02,0x01,0x10,0x02,0xD4,
+    0x1B,0x83,0x03,0xDE,0xFF,0x32,0x13,0x32,0x02,0xB2,0x02,0x82,0x00,0x93,0x02,0x89,
+    0x00,0x14,0x34,0x84,0x0E,0xF7,0x2B,0x0F,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x94,0x02,0xB2,0x02,0x32,0x02,0xD2,
+    0x12,0xDD,0xBE,0x4D,0xFF,0xFF,0x81,0x00,0x93,0x02,0xAE,0x42,0x92,0x02,0x01,0xB2,
+    0x02,0x92,0x02,0x81,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x50,0xB2,0x02,0x47,0x92,
+    0x02,0x04,0xB3,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x4B,0x92,0x02,0x05,
+    0x93,0x02,0x93,0x02,0xB2,0x02,0xB1,0x02,0xB2,0x02,0x93,0x02,0x48,0x92,0x02,0x97,
+    0x03,0x92,0x02,0xB1,0x02,0x92,0x02,0x93,0x02,0x43,0x92,0x02,0xB7,0x6E,0xFF,0xFF,
+    0x03,0x9B,0x6D,0xD0,0x01,0x92,0x02,0xB2,0x02,0x81,0x01,0x92,0x02,0xB2,0x02,0xBF,
+    0x01,0x99,0x43,0x92,0x02,0x83,0x02,0x93,0x02,0x70,0x02,0xDC,0xAE,0x81,0x00,0xDF,
+    0xFF,0x53,0xFF,0xFF,0x03,0x58,0x44,0xF0,0x01,0xB2,0x02,0x73,0x02,0x44,0x92,0x02,
+    0x83,0x04,0xF0,0x01,0x55,0x2C,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x8B,0x00,0xDF,0xFF,
+    0x81,0x07,0xDF,0xF7,0xFF,0xFF,0x5B,0x9E,0xF1,0x01,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x88,0x03,0x92,0x02,0x52,0x02,0xD2,0x02,0x5E,0xEF,0x4D,0xFF,0xFF,0x00,
+    0xFF,0xF7,0x81,0x0E,0xFE,0xFF,0xDF,0xFF,0xBF,0xFF,0x33,0x0B,0x31,0x02,0x92,0x02,
+    0xD2,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,
+    0x93,0x02,0x42,0x92,0x02,0x04,0x30,0x02,0x33,0x13,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0x4F,0xFF,0xFF,0x06,0xFE,0xFF,0xFF,0xFF,0xB7,0x3C,0xD0,0x01,0x93,0x02,0x92,0x02,
+    0x93,0x02,0x86,0x01,0xB2,0x02,0xB2,0x02,0x86,0x00,0xB2,0x02,0x83,0x01,0x0F,0x02,
+    0x17,0x34,0x82,0x57,0xFF,0xFF,0x81,0x07,0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,
+    0xB1,0x02,0x93,0x02,0xB2,0x02,0xB1,0x02,0x81,0x00,0x93,0x02,0xBF,0x01,0x03,0xB3,
+    0x02,0xB2,0x02,0xF0,0x01,0x19,0x55,0x49,0xFF,0xFF,0x02,0xB5,0x23,0x10,0x02,0x93,
+    0x02,0x83,0x00,0x93,0x02,0x8B,0x00,0x93,0x02,0x81,0x03,0xB1,0x02,0x72,0x0A,0xF0,
+    0x01,0x37,0x2C,0x56,0xFF,0xFF,0x93,0x00,0xDF,0xFF,0x8B,0x08,0xDF,0xFF,0xF9,0x9D,
+    0xB1,0x02,0x74,0x02,0x73,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x42,0xB2,
+    0x02,0x03,0x92,0x02,0xB2,0x02,0xF0,0x01,0xB6,0x23,0x81,0x04,0xFF,0xF7,0xFF,0xFF,
+    0xBF,0xFF,0x53,0x13,0x31,0x02,0x94,0x03,0x35,0x2C,0x10,0x02,0x93,0x02,0xB3,0x02,
+    0x42,0x92,0x02,0x00,0xB2,0x02,0x42,0x92,0x02,0x0E,0x93,0x02,0xB2,0x02,0x10,0x02,
+    0x91,0x02,0xD4,0x2B,0x17,0x65,0xBA,0x7D,0x3A,0x8E,0x9D,0xAE,0xBB,0xA6,0x9C,0xA6,
+    0x9D,0xA6,0xFE,0xBE,0x3D,0xCF,0xFE,0xF7,0xB0,0x0D,0xB2,0x02,0x92,0x02,0x93,0x02,
+    0x93,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x10,0x02,0xF0,0x01,0xD0,0x01,0xF1,0x01,
+    0xF0,0x01,0xF0,0x01,0xD0,0x01,0x5A,0xF0,0x01,0x04,0x11,0x02,0xB3,0x02,0xB3,0x02,
+    0x93,0x02,0xB2,0x02,0x4A,0x92,0x02,0x05,0xB2,0x02,0xD2,0x02,0x31,0x02,0xF1,0x01,
+    0xF1,0x01,0x10,0x02,0x5E,0xF0,0x01,0x02,0xF1,0x01,0xF2,0x01,0x72,0x02,0x83,0x00,
+    0xB3,0x02,0xB7,0xEF,0x03,0x39,0x5D,0xF0,0x01,0x92,0x02,0x93,0x02,0x82,0xCA,0xB6,
+    0x97,0x00,0xEF,0x01,0x42,0x93,0x02,0x43,0x92,0x02,0x04,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0xEF,0x01,0xB6,0x4C,0x56,0xFF,0xFF,0x03,0x3C,0x96,0x30,0x02,0x92,0x02,0x93,
+    0x02,0x87,0x02,0x73,0x02,0x31,0x02,0x5B,0x86,0x53,0xFF,0xFF,0x03,0xFF,0xEF,0x34,
+    0x0B,0x12,0x02,0xB1,0x02,0x81,0x00,0x93,0x02,0x42,0x92,0x02,0x07,0xB2,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xF0,0x01,0x57,0x34,0x51,0xFF,0xFF,
+    0x09,0xFE,0xFF,0xFF,0xFF,0xFA,0x85,0xEF,0x01,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x06,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x92,
+    0x02,0x93,0x02,0x10,0x02,0x9A,0x6D,0x42,0xFF,0xFF,0x00,0xFE,0xFF,0x8E,0x04,0xFE,
+    0xF7,0xFF,0xFF,0x3D,0xCF,0x92,0x02,0x52,0x02,0x81,0x00,0x93,0x02,0x8A,0x00,0x92,
+    0x02,0x81,0x08,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x51,
+    0x02,0x91,0x0A,0x7D,0xE7,0x59,0xFF,0xFF,0x00,0x99,0x7D,0x82,0x08,0x94,0x02,0x93,
+    0x02,0xB1,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x73,0x02,0x92,0x02,0x72,0x02,0xBF,
+    0x00,0x04,0x92,0x02,0xB1,0x02,0xB1,0x02,0xF1,0x01,0x1A,0x55,0x89,0x08,0x38,0x5D,
+    0xF0,0x01,0x93,0x02,0xB1,0x02,0x72,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0x87,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x81,0x04,0xB2,0x02,0xB2,0x02,0x93,0x02,
+    0xF0,0x01,0x79,0x5D,0x82,0x00,0xDF,0xFF,0xA2,0x00,0xF0,0x01,0x82,0xC2,0x10,0xDD,
+    0xBE,0xF8,0x64,0x59,0x65,0x78,0x6D,0x7A,0x65,0x39,0x5D,0xD7,0x4C,0xD8,0x4C,0x76,
+    0x34,0x94,0x2B,0xD1,0x12,0x51,0x02,0x93,0x02,0xB3,0x02,0x91,0x02,0x93,0x02,0xB2,
+    0x02,0x81,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x81,0x01,0x11,0x02,0xB5,0x1B,0x43,
+    0xFF,0xFF,0x02,0xFE,0xFF,0x33,0x13,0x31,0x02,0x43,0x92,0x02,0x00,0xB3,0x02,0x87,
+    0x02,0x93,0x02,0xF0,0x01,0x15,0x2C,0x84,0x02,0xF7,0x2B,0x11,0x02,0x93,0x02,0x45,
+    0x92,0x02,0x10,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xD3,0x02,0x71,0x02,0xF1,
+    0x01,0x11,0x02,0x11,0x02,0x31,0x02,0x52,0x02,0x50,0x02,0x72,0x02,0x72,0x02,0x50,
+    0x02,0x51,0x13,0xBF,0xEF,0x84,0x00,0xB3,0x02,0xAA,0xC1,0x00,0x93,0x02,0x42,0x92,
+    0x02,0x04,0x72,0x02,0xF6,0x2B,0xD9,0x44,0xD8,0x4C,0xB7,0x44,0x53,0xD8,0x44,0x0F,
+    0xB8,0x44,0xD8,0x44,0xD8,0x44,0xD7,0x44,0xD8,0x44,0xD8,0x44,0xB8,0x44,0xB8,0x44,
+    0xF8,0x44,0xB7,0x4C,0x56,0x34,0x91,0x02,0x72,0x02,0x92,0x02,0x92,0x02,0x93,0x02,
+    0x88,0x06,0xB2,0x02,0x92,0x02,0x72,0x02,0x95,0x13,0xB8,0x4C,0x97,0x4C,0xB8,0x44,
+    0x57,0xD8,0x44,0x0D,0xB8,0x44,0xB8,0x44,0xD8,0x44,0xD7,0x44,0xD7,0x44,0xD8,0x44,
+    0xB8,0x44,0xB8,0x44,0x98,0x3C,0xB3,0x02,0x72,0x02,0x92,0x02,0x92,0x02,0x93,0x02,
+    0x42,0xB2,0x02,0xBF,0x22,0x00,0xDF,0xFF,0x82,0x02,0x38,0x5D,0xF1,0x01,0x92,0x02,
+    0x42,0xB2,0x02,0x01,0x93,0x02,0x93,0x02,0xBF,0x01,0x97,0x04,0xF0,0x01,0x92,0x02,
+    0x93,0x02,0x92,0x02,0xB2,0x02,0x81,0x00,0xB2,0x02,0x82,0x01,0x31,0x02,0x34,0x13,
+    0x92,0x00,0xDF,0xFF,0x43,0xFF,0xFF,0x01,0x13,0x0B,0x50,0x02,0x81,0x09,0xB3,0x02,
+    0xB2,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x72,0x02,0x31,0x02,0x13,0x0B,
+    0xDF,0xF7,0x54,0xFF,0xFF,0x07,0xF8,0x4C,0xF0,0x01,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0xB3,0x02,0x92,0x02,0xB2,0x02,0x43,0x92,0x02,0x04,0xD1,0x02,0x73,0x02,0x73,0x02,
+    0x51,0x02,0xBB,0xBE,0x53,0xFF,0xFF,0x05,0xB5,0x23,0x11,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x83,0x07,0xB2,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x92,0x02,
+    0x52,0x02,0xD3,0x0A,0xDE,0xEF,0x55,0xFF,0xFF,0x04,0xB7,0x3C,0xF0,0x01,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0x83,0x01,0x93,0x02,0xB1,0x02,0x49,0x92,0x02,0x01,0xB2,0x02,
+    0xB2,0x02,0x81,0x02,0x93,0x02,0x10,0x02,0xFA,0x75,0x81,0x00,0xFF,0xF7,0x96,0x0C,
+    0x98,0x7D,0xEE,0x01,0x93,0x02,0xB2,0x02,0xB3,0x02,0xB3,0x02,0x92,0x02,0xB3,0x02,
+    0x72,0x02,0x92,0x02,0x94,0x02,0xB3,0x02,0xB2,0x02,0x83,0x43,0xB2,0x02,0x8C,0x03,
+    0xBB,0x7D,0x70,0x01,0xF0,0x01,0x11,0x02,0x45,0xF1,0x01,0x61,0x11,0x02,0x05,0xF0,
+    0x01,0xF0,0x01,0x4F,0x01,0x97,0x44,0xFF,0xFF,0xDE,0xFF,0x87,0x01,0x7A,0xAE,0x32,
+    0x02,0x81,0x03,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x4B,0x92,0x02,0x81,0x04,
+    0x92,0x02,0x72,0x02,0xB2,0x02,0x31,0x02,0x5A,0xA6,0x56,0xFF,0xFF,0x81,0x00,0x73,
+    0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x44,0x92,0x02,0x00,0xB2,0x02,0x81,0x01,0x92,
+    0x02,0x11,0x02,0x82,0x00,0xFF,0xF7,0x81,0x19,0x59,0x5D,0x8F,0x01,0xEF,0x01,0xCF,
+    0x01,0x10,0x02,0xF0,0x01,0x11,0x02,0x11,0x02,0x10,0x02,0x11,0x02,0x72,0x02,0x93,
+    0x02,0xB2,0x02,0x90,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0x73,0x02,0xB3,0x02,0x92,
+    0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x10,0x02,0xD6,0x1B,0x83,0x03,0xDE,
+    0xF7,0x13,0x13,0x52,0x02,0xB2,0x02,0x4C,0x92,0x02,0x01,0xF0,0x01,0x14,0x34,0x84,
+    0x0C,0x18,0x2C,0xF1,0x01,0x92,0x02,0x94,0x02,0xB1,0x02,0x92,0x02,0x93,0x02,0x93,
+    0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x42,0x93,0x02,0x02,0x92,
+    0x02,0x92,0x02,0xB3,0x02,0x42,0x72,0x02,0x03,0x71,0x02,0x30,0x02,0x12,0x0B,0x7F,
+    0xF7,0x82,0x06,0x7A,0x6D,0xF0,0x01,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,
+    0x02,0x83,0x07,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x31,0x02,0x34,
+    0x0B,0xFF,0xEF,0x99,0x00,0x93,0x02,0x81,0x05,0xB1,0x02,0x91,0x02,0x93,0x02,0x94,
+    0x02,0x10,0x02,0xFE,0xAE,0x60,0xFF,0xFF,0x01,0x9F,0xF7,0x51,0x0A,0x81,0x01,0xB2,
+    0x02,0xB2,0x02,0x87,0x04,0xB2,0x02,0x92,0x02,0xB3,0x02,0xEF,0x01,0x58,0x65,0x63,
+    0xFF,0xFF,0x06,0xF2,0x0A,0x51,0x02,0xB4,0x02,0x93,0x02,0xB2,0x02,0xB1,0x02,0x93,
+    0x02,0xBF,0x23,0xC3,0x03,0x39,0x5D,0xF0,0x01,0xB2,0x02,0x92,0x02,0x82,0x02,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0x44,0xB2,0x02,0x44,0x92,0x02,0xB4,0x9F,0x42,0x92,0x02,
+    0x02,0x73,0x02,0x51,0x02,0x9B,0xAE,0x53,0xFF,0xFF,0x00,0xFE,0xFF,0x81,0x06,0x97,
+    0x3C,0xF0,0x01,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x81,0x03,0xB3,
+    0x02,0x93,0x02,0xF0,0x01,0x96,0x3C,0x55,0xFF,0xFF,0x02,0x1D,0xBF,0x72,0x02,0x72,
+    0x02,0x42,0x92,0x02,0x09,0xB3,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0xB3,0x02,0x92,
+    0x02,0xB1,0x02,0x93,0x02,0x11,0x02,0xB4,0x1B,0x53,0xFF,0xFF,0x0C,0xFD,0xB6,0x32,
+    0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0x72,0x02,0x81,0x02,0xB3,0x02,0xF0,0x01,0xB8,0x4C,0x56,
+    0xFF,0xFF,0x05,0x5D,0xD7,0x72,0x02,0x52,0x02,0xB2,0x02,0x93,0x02,0xB3,0x02,0x42,
+    0xB2,0x02,0x01,0x92,0x02,0xB2,0x02,0x4A,0x92,0x02,0x05,0xB2,0x02,0xB2,0x02,0x93,
+    0x02,0x73,0x02,0x30,0x02,0x35,0x2C,0x59,0xFF,0xFF,0x0B,0x98,0x75,0xCF,0x01,0x94,
+    0x02,0x72,0x02,0x93,0x02,0x93,0x02,0x73,0x02,0x72,0x02,0x91,0x02,0xB2,0x02,0xB3,
+    0x02,0x93,0x02,0x44,0x92,0x02,0x90,0x01,0xBC,0xAE,0x93,0x23,0x68,0x15,0x34,0x04,
+    0x35,0x34,0x15,0x34,0x15,0x34,0x72,0x23,0xF9,0x8D,0x49,0xFF,0xFF,0x08,0xDF,0xEF,
+    0xF3,0x0A,0x51,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x87,0x09,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,
+    0x52,0x02,0xF3,0x0A,0x9E,0xEF,0x96,0x00,0x5C,0xD7,0x82,0x02,0x93,0x02,0x92,0x02,
+    0x93,0x02,0x83,0x06,0x93,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x11,0x02,
+    0x55,0x3C,0x44,0xFF,0xFF,0x06,0xBB,0x6D,0x11,0x02,0xB2,0x02,0x73,0x02,0x93,0x02,
+    0x92,0x02,0x93,0x02,0x44,0x92,0x02,0x0D,0x91,0x02,0x91,0x02,0x93,0x02,0x93,0x02,
+    0x91,0x02,0xB1,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,
+    0x10,0x02,0xB4,0x1B,0x84,0x02,0x33,0x13,0x51,0x02,0x92,0x02,0x42,0xB2,0x02,0x00,
+    0x92,0x02,0x42,0xB2,0x02,0x00,0x93,0x02,0x81,0x03,0xB2,0x02,0x92,0x02,0x93,0x02,
+    0xF1,0x01,0x85,0x13,0x37,0x24,0x10,0x02,0xB3,0x02,0xB3,0x02,0x92,0x02,0x93,0x02,
+    0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x91,0x02,0xB2,0x02,0x42,0x92,0x02,0x03,
+    0x32,0x02,0x14,0x0B,0xBF,0xE7,0xFE,0xFF,0x81,0x06,0x99,0x6D,0xF0,0x01,0x93,0x02,
+    0x93,0x02,0x91,0x02,0x92,0x02,0x92,0x02,0x43,0xB2,0x02,0x44,0x92,0x02,0x01,0x31,
+    0x02,0x33,0x13,0x9A,0xC2,0x05,0xB2,0x02,0x93,0x02,0x72,0x0A,0x92,0x02,0x50,0x02,
+    0x3B,0x9E,0xA0,0x02,0xFC,0xC6,0x92,0x02,0x52,0x02,0x81,0x00,0x93,0x02,0x4A,0x92,
+    0x02,0x01,0x10,0x02,0xD9,0x4C,0xA2,0x05,0xBF,0xF7,0xD4,0x0A,0x52,0x02,0xB1,0x02,
+    0x92,0x02,0xB3,0x02,0x42,0xB2,0x02,0x9A,0x00,0xDF,0xFF,0xBF,0x0A,0x00,0x38,0x5D,
+    0x83,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x48,0x92,0x02,0x00,0xB2,0x02,0x82,0x00,
+    0xF9,0x5C,0xB2,0xA1,0x03,0xB2,0x02,0x93,0x02,0xD0,0x01,0xD6,0x4C,0x56,0xFF,0xFF,
+    0x03,0x5B,0x8E,0x31,0x02,0x72,0x02,0x92,0x02,0x81,0xC2,0x03,0xB2,0x02,0x93,0x02,
+    0x11,0x02,0x7B,0xA6,0x81,0x00,0xFE,0xFF,0x53,0xFF,0xFF,0x02,0xD5,0x1B,0x10,0x02,
+    0xB2,0x02,0x42,0x92,0x02,0x42,0xB2,0x02,0x05,0x93,0x02,0x74,0x02,0xB2,0x02,0xB3,
+    0x02,0x10,0x02,0xFA,0x85,0x85,0x00,0xDF,0xFF,0x89,0x07,0xFF,0xF7,0xFE,0xFF,0xDF,
+    0xFF,0xB9,0x3C,0x11,0x02,0x91,0x02,0x93,0x02,0xB2,0x02,0x83,0x00,0x92,0x02,0x81,
+    0x07,0x93,0x02,0x92,0x02,0xB3,0x02,0x51,0x02,0x71,0x02,0x5D,0xCF,0xDF,0xFF,0xDF,
+    0xFF,0x55,0xFF,0xFF,0x08,0x57,0x3C,0xF0,0x01,0xB2,0x02,0xB3,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x48,0x92,0x02,0x00,0xB2,0x02,0x82,0x07,0x92,
+    0x02,0x93,0x02,0x93,0x02,0x51,0x02,0xD2,0x02,0x9E,0xE7,0xFF,0xFF,0xDE,0xFF,0x96,
+    0x0B,0x57,0x75,0x8E,0x01,0x32,0x02,0x30,0x02,0x30,0x02,0x31,0x02,0x31,0x02,0x2F,
+    0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x72,0x02,0x95,0xF8,0x07,0xDF,0xFF,0xFF,0xFF,
+    0xD5,0x23,0xF0,0x01,0x93,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0x4B,0x92,0x02,0x06,
+    0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x10,0x02,0xD6,0x23,0x57,0xFF,
+    0xFF,0x01,0x5C,0xD7,0x90,0x0A,0x82,0x01,0xB2,0x02,0xB3,0x02,0x45,0x92,0x02,0x04,
+    0xB2,0x02,0x93,0x02,0x92,0x02,0x10,0x02,0x35,0x3C,0x84,0x00,0x9A,0x6D,0x81,0x00,
+    0x94,0x02,0x81,0x10,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x94,0x02,0xB4,0x02,
+    0xB2,0x02,0x92,0x02,0x74,0x02,0x92,0x02,0xD0,0x02,0x93,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0x93,0x02,0xB2,0x02,0x81,0x00,0x94,0x23,0x81,0x04,0xDF,0xFF,0xFF,0xFF,
+    0xFD,0xEF,0x13,0x13,0x31,0x02,0x44,0x92,0x02,0x00,0x93,0x02,0x42,0x92,0x02,0x00,
+    0xB2,0x02,0x42,0x92,0x02,0x81,0x02,0x14,0x2C,0xFF,0xFF,0xDF,0xFF,0x82,0x03,0x55,
+    0x34,0xEF,0x01,0x93,0x02,0xB2,0x02,0x82,0xC1,0x00,0x93,0x02,0x42,0x92,0x02,0x0C,
+    0xB2,0x02,0xB3,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x73,0x02,0x93,0x02,
+    0xB1,0x02,0x92,0x02,0xF2,0x01,0x35,0x13,0xFF,0xEF,0x42,0xFF,0xFF,0x00,0x9A,0x6D,
+    0x81,0x01,0x92,0x02,0xB2,0x02,0x48,0x92,0x02,0x02,0xB2,0x02,0xB3,0x02,0x30,0x02,
+    0x9C,0x01,0x93,0x02,0xB2,0x02,0x82,0x02,0x91,0x02,0x50,0x02,0x1B,0x96,0xA0,0x05,
+    0xFC,0xBE,0xB2,0x02,0x72,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x88,0x03,0xB2,0x02,
+    0xB2,0x02,0x10,0x02,0xB9,0x4C,0xA2,0x01,0xBE,0xF7,0xD5,0x0A,0x82,0x02,0x93,0x02,
+    0x92,0x02,0x92,0x02,0x9B,0xFF,0x0B,0x02,0x39,0x5D,0xF0,0x01,0x92,0x02,0x8D,0x06,
+    0xB3,0x02,0x92,0x02,0x93,0x02,0x11,0x02,0xF9,0x54,0xFF,0xFF,0xDF,0xFF,0xB0,0x9F,
+    0x00,0xB2,0x02,0x81,0x02,0x92,0x02,0x11,0x02,0x73,0x13,0x93,0x00,0xDF,0xFF,0x81,
+    0x0E,0xFF,0xF7,0x13,0x0B,0x51,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,
+    0x02,0x93,0x02,0x92,0x02,0x31,0x02,0x13,0x0B,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x94,
+    0x05,0x98,0x7D,0xD0,0x01,0x93,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0x82,0x05,0xB3,
+    0x02,0xB2,0x02,0x73,0x02,0x13,0x02,0xF3,0x0A,0xFF,0xEF,0x50,0xFF,0xFF,0x16,0xFF,
+    0xF7,0xFF,0xFF,0xBF,0xE7,0xD3,0x02,0x52,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,
+    0x02,0x92,0x02,0xEF,0x01,0x36,0x24,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0x91,0x0B,0xDE,
+    0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0x1D,0xC7,0x31,0x02,0x51,0x02,0x92,0x02,0xB2,
+    0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0x89,0xC2,0x06,0xB2,0x02,0xB2,0x02,0x92,0x02,
+    0xB3,0x02,0x92,0x02,0x11,0x02,0x1B,0x96,0x58,0xFF,0xFF,0x0B,0x1C,0xD7,0x97,0x7D,
+    0xF9,0x8D,0xF9,0x8D,0xDA,0x95,0xF8,0x85,0xF9,0x8D,0xFA,0x9D,0xD6,0x1B,0x31,0x02,
+    0x92,0x02,0xD3,0x02,0xBF,0x05,0x00,0xDF,0xFF,0x4A,0xFF,0xFF,0x02,0x17,0x5D,0xEF,
+    0x01,0x93,0x02,0x42,0xB2,0x02,0x89,0x08,0xB3,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0x93,0x02,0xB3,0x02,0xEF,0x01,0xF8,0x54,0x83,0x00,0xDF,0xFF,0x92,0x01,
+    0x3D,0xD7,0x90,0x02,0x83,0x44,0x92,0x02,0x00,0x93,0x02,0x83,0x01,0xF0,0x01,0x56,
+    0x3C,0x82,0x05,0xFF,0xF7,0xFF,0xFF,0x7A,0x6D,0xF0,0x01,0x93,0x02,0x93,0x02,0x42,
+    0x92,0x02,0x81,0x0B,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,
+    0xB2,0x02,0xD2,0x02,0x74,0x0A,0x93,0x02,0x92,0x02,0xB3,0x02,0x42,0x92,0x02,0x01,
+    0xF1,0x01,0xF5,0x3B,0x43,0xFF,0xFF,0x00,0xDE,0xFF,0x81,0x03,0x93,0x02,0x92,0x02,
+    0x93,0x02,0xB2,0x02,0x82,0x08,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0xF0,0x01,0x14,0x34,0x84,0x0D,0x78,0x6D,0xF0,0x01,0xB3,0x02,
+    0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x92,0x02,0x42,0x93,0x02,0x08,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0x93,0x02,0x11,0x02,0x74,0x1B,0xFF,0xF7,0x84,0x00,0xB2,0x02,
+    0x83,0x43,0xB2,0x02,0x81,0x05,0xB2,0x02,0x93,0x02,0x93,0x02,0x31,0x02,0x34,0x13,
+    0xDF,0xF7,0x99,0x00,0xB2,0x02,0x83,0x03,0x92,0x02,0xB1,0x02,0x11,0x02,0x3C,0x96,
+    0xA1,0x02,0x92,0x02,0x52,0x02,0x93,0x02,0x89,0x04,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0xF0,0x01,0xD7,0x4C,0xA2,0x04,0x9E,0xEF,0xD3,0x0A,0x52,0x02,0xB2,0x02,0x93,0x02,
+    0xBF,0x2C,0x00,0xB2,0x02,0x8B,0x05,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,
+    0x02,0x10,0x02,0xB3,0x9F,0x44,0x92,0x02,0x01,0x51,0x02,0x9C,0xB6,0x91,0x00,0xFE,
+    0xFF,0x43,0xFF,0xFF,0x0C,0x96,0x3C,0xF0,0x01,0xB3,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xF0,0x01,0xF8,0x44,0xFF,0xFF,0xFE,0xFF,0x55,
+    0xFF,0xFF,0x03,0x9E,0xE7,0xD3,0x02,0x51,0x02,0xB3,0x02,0x44,0x92,0x02,0x04,0x93,
+    0x02,0xB1,0x02,0x93,0x02,0xF1,0x01,0x37,0x4D,0x51,0xFF,0xFF,0x07,0xDF,0xFF,0xFF,
+    0xFF,0x7A,0x6D,0xF0,0x01,0xB2,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x86,0x04,0x92,
+    0x02,0xB2,0x02,0x72,0x02,0x10,0x02,0xFD,0x9E,0x56,0xFF,0xFF,0x09,0xBF,0xFF,0xFE,
+    0xFF,0xFF,0xFF,0x56,0x34,0xF1,0x01,0x93,0x02,0x93,0x02,0xB2,0x02,0x91,0x02,0xB2,
+    0x02,0x4B,0x92,0x02,0x03,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x81,0x02,0xF1,
+    0x01,0x77,0x3C,0xFE,0xFF,0x5D,0xFF,0xFF,0x06,0xDF,0xFF,0xFF,0xFF,0xB9,0x3C,0xF0,
+    0x01,0x92,0x02,0xD2,0x02,0xB3,0x02,0x95,0x00,0xDF,0xFF,0xA9,0x04,0xDF,0xFF,0xBF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0x89,0x07,0x9B,0xA6,0x51,0x02,0x73,0x02,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x87,0x00,0x93,0x02,0x82,0x04,0xB3,
+    0x02,0xB2,0x02,0x93,0x02,0x10,0x02,0x3A,0x8E,0x57,0xFF,0xFF,0x84,0x46,0x92,0x02,
+    0x00,0xB2,0x02,0x81,0x01,0xB2,0x02,0x10,0x02,0x83,0xC1,0x01,0xDB,0x7D,0x30,0x02,
+    0x42,0x92,0x02,0x00,0xB2,0x02,0x81,0x03,0xB2,0x02,0x92,0x02,0x91,0x02,0xB2,0x02,
+    0x82,0x0C,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,
+    0x92,0x02,0xB2,0x02,0x11,0x02,0xBA,0x6D,0xFF,0xFF,0xFE,0xF7,0x82,0x01,0x33,0x13,
+    0x31,0x02,0x42,0x92,0x02,0x81,0xC2,0x03,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0x81,0x00,0xF1,0x01,0x81,0xC3,0x08,0x5D,0xCF,0x52,0x02,0x73,0x02,0x91,0x0A,0xB4,
+    0x02,0x92,0x02,0x91,0x02,0x92,0x02,0xB3,0x02,0x42,0xB2,0x02,0x45,0x92,0x02,0x06,
+    0x93,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0x74,0x02,0x10,0x02,0x94,0x13,0x43,0xFF,
+    0xFF,0x81,0x03,0xB3,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x82,0x00,0x93,0x02,0x82,
+    0xC2,0x02,0x32,0x02,0x54,0x0B,0xFF,0xF7,0x9A,0x42,0x92,0x02,0x02,0x93,0x02,0xB2,
+    0x02,0x92,0x02,0xA0,0x07,0xDF,0xFF,0xFF,0xFF,0xFC,0xC6,0x71,0x0A,0x71,0x02,0xB3,
+    0x02,0x92,0x02,0x93,0x02,0x89,0x02,0x93,0x02,0x10,0x02,0xD8,0x44,0xA2,0x04,0xBF,
+    0xEF,0xF2,0x0A,0x51,0x02,0x92,0x02,0x92,0x02,0x81,0x00,0xB2,0x02,0xBF,0x27,0x00,
+    0x38,0x65,0x84,0x00,0x92,0x02,0x44,0xB2,0x02,0x81,0x42,0xB2,0x02,0x82,0x01,0x11,
+    0x02,0x19,0x5D,0x72,0xFF,0xFF,0xA4,0x01,0xF0,0x01,0xD8,0x4C,0x96,0x0A,0x5A,0x96,
+    0x11,0x02,0x92,0x02,0x93,0x02,0x73,0x02,0xB2,0x02,0x72,0x02,0x92,0x0A,0x91,0x02,
+    0x30,0x02,0xDD,0xAE,0x55,0xFF,0xFF,0x12,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0x58,0x34,
+    0xF0,0x01,0xB2,0x02,0xB2,0x02,0x92,0x02,0x74,0x02,0x91,0x02,0x93,0x02,0xB3,0x02,
+    0x92,0x02,0x52,0x02,0x71,0x02,0x5D,0xCF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x50,0xFF,
+    0xFF,0x07,0x73,0x13,0x10,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0x93,0x02,0x42,0x92,0x02,0x00,0x93,0x02,0x81,0x04,0xB3,0x02,0x11,0x02,0x94,0x1B,
+    0xFF,0xFF,0xDF,0xFF,0x94,0x0C,0xFE,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFD,0xCE,
+    0x32,0x02,0x73,0x02,0x93,0x02,0x92,0x02,0xB1,0x02,0x92,0x02,0x93,0x02,0x73,0x02,
+    0x88,0x00,0xB2,0x02,0x82,0x04,0xB2,0x02,0xB2,0x02,0x72,0x02,0x13,0x02,0x53,0x0B,
+    0x9E,0xC1,0x02,0x77,0x34,0x10,0x02,0x93,0x02,0x45,0x92,0x02,0x91,0xEA,0x05,0xDF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x88,0x02,0xDF,0xEF,0x13,
+    0x0B,0x12,0x02,0x81,0x01,0x93,0x02,0xB2,0x02,0x48,0x92,0x02,0x08,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0xB3,0x02,0xB3,0x02,0xB0,0x02,0x52,0x02,0xB3,0x02,0x7C,0xCF,0x97,
+    0x04,0x3C,0xDF,0x91,0x02,0x73,0x02,0x72,0x02,0xB2,0x02,0x85,0x42,0xB2,0x02,0x01,
+    0x93,0x02,0x92,0x02,0x86,0x00,0x3C,0x96,0x81,0x00,0x93,0x02,0x43,0x92,0x02,0x04,
+    0xB2,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x43,0x92,0x02,0x08,0xB2,0x02,
+    0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0xB3,0x02,0x51,0x02,0x90,0x02,0x9E,0xDF,
+    0x44,0xFF,0xFF,0x04,0x53,0x13,0x32,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,0x81,0x00,
+    0x93,0x02,0x43,0xB2,0x02,0x05,0x92,0x02,0x93,0x02,0xB3,0x02,0x92,0x02,0xF0,0x01,
+    0xF5,0x33,0x82,0x07,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x97,0x44,0xF0,0x01,0xB2,0x02,
+    0x93,0x02,0xB3,0x02,0x43,0xB2,0x02,0x43,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0x81,
+    0x06,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,0x73,0x02,0x11,0x02,0xB6,0x13,0x84,
+    0x00,0xF1,0x01,0x83,0x00,0xB2,0x02,0x43,0x92,0x02,0x07,0xB2,0x02,0xB2,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x11,0x02,0x35,0x13,0xDE,0xF7,0x99,0x07,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x31,0x02,0x9F,0xC1,0x02,
+    0xFD,0xC6,0x92,0x02,0x72,0x02,0x81,0xCA,0x81,0x00,0xF8,0x44,0xA2,0x03,0xDF,0xEF,
+    0xD3,0x0A,0x51,0x02,0xB2,0x02,0x81,0x01,0xB2,0x02,0x93,0x02,0x97,0x00,0xFE,0xFF,
+    0x83,0x02,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xBF,0x05,0x02,0xDE,0xFF,0xFF,0xFF,0x1A,
+    0x55,0x85,0xC1,0x81,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x04,0xB2,
+    0x02,0x72,0x02,0x92,0x02,0x12,0x02,0x38,0x55,0x81,0x00,0xDF,0xFF,0x96,0x02,0xDF,
+    0xFF,0xFF,0xFF,0xDF,0xFF,0x81,0x00,0xDF,0xFF,0x92,0x9F,0xC1,0x04,0x93,0x02,0xB2,
+    0x02,0xB3,0x02,0x10,0x02,0x54,0x13,0x91,0x00,0xDF,0xFF,0x83,0x09,0xDF,0xEF,0x13,
+    0x0B,0x31,0x02,0x72,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x11,0x02,0x74,
+    0x13,0x42,0xFF,0xFF,0x00,0xFE,0xFF,0x93,0x07,0xFD,0xF7,0xFF,0xFF,0x5C,0x96,0x11,
+    0x02,0x91,0x02,0x93,0x02,0x73,0x02,0xB2,0x02,0x81,0x05,0x93,0x02,0x92,0x02,0xF0,
+    0x01,0x16,0x24,0xFF,0xFF,0xFE,0xFF,0x4F,0xFF,0xFF,0x06,0xFF,0xF7,0xFF,0xFF,0x5C,
+    0x9E,0x2F,0x02,0x72,0x02,0x74,0x02,0xB2,0x02,0x82,0x00,0xB2,0x02,0x82,0x05,0xB3,
+    0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0xF0,0x01,0x1A,0x7E,0x57,0xFF,0xFF,0x00,0xDF,
+    0xFF,0x42,0xFF,0xFF,0x01,0x36,0x2C,0xF0,0x01,0x42,0x92,0x02,0x02,0x94,0x02,0xB3,
+    0x02,0xB2,0x02,0x49,0x92,0x02,0x83,0x04,0x92,0x02,0x72,0x02,0x72,0x02,0x71,0x02,
+    0xDC,0xC6,0x9F,0x00,0x77,0x3C,0x81,0x01,0xB2,0x02,0x93,0x02,0x95,0x00,0xFE,0xFF,
+    0x79,0xFF,0xFF,0x02,0xF5,0x2B,0xD1,0x01,0xB3,0x02,0x81,0x01,0x92,0x02,0xB2,0x02,
+    0x89,0x05,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x10,0x02,0x55,0x1B,0x58,0xFF,
+    0xFF,0x03,0x3C,0xD7,0x70,0x02,0x53,0x02,0x72,0x02,0x45,0x92,0x02,0x44,0x93,0x02,
+    0x01,0x92,0x02,0xF0,0x01,0x85,0x02,0x1C,0x96,0x11,0x02,0x73,0x02,0x82,0x1E,0x93,
+    0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x93,
+    0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x94,0x02,0x93,0x02,0x91,0x02,0x74,
+    0x02,0xD2,0x01,0x78,0x75,0xFF,0xFF,0xFE,0xFF,0xBF,0xFF,0xFF,0xF7,0xFF,0xFF,0xDE,
+    0xFF,0xF2,0x12,0x32,0x02,0x72,0x02,0x92,0x02,0x72,0x02,0x92,0x02,0x81,0x43,0x92,
+    0x02,0x00,0x72,0x02,0x42,0x92,0x02,0x03,0xCF,0x01,0xF3,0x33,0xFF,0xFF,0xFE,0xFF,
+    0x83,0x08,0xDF,0xEF,0x73,0x1B,0xCF,0x01,0x51,0x02,0x93,0x02,0xB1,0x02,0x93,0x02,
+    0x91,0x02,0x91,0x02,0x46,0xB2,0x02,0x07,0x92,0x02,0x92,0x02,0xB2,0x02,0x91,0x02,
+    0x92,0x02,0x92,0x02,0x4F,0x02,0xB5,0x13,0x83,0x04,0x5A,0x6D,0x11,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0x48,0x92,0x02,0x04,0xB2,0x02,0xB3,0x02,0x11,0x02,0x15,0x13,
+    0xFF,0xEF,0x9C,0x05,0x92,0x02,0x93,0x02,0xB2,0x02,0x72,0x02,0x31,0x02,0x3C,0x8E,
+    0xA0,0x00,0xFC,0xBE,0x81,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x88,0x03,0xB2,0x02,
+    0xB2,0x02,0x10,0x02,0xD8,0x4C,0xA2,0x03,0xBF,0xF7,0xD3,0x0A,0x52,0x02,0x93,0x02,
+    0x42,0x92,0x02,0x98,0xC1,0x00,0xFE,0xFF,0x7F,0x0C,0xFF,0xFF,0x00,0x7B,0x75,0x81,
+    0xC1,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x44,0x92,0x02,0x81,0x06,0x93,0x02,0x93,
+    0x02,0xB1,0x02,0x73,0x0A,0x93,0x02,0x10,0x02,0x98,0x6D,0x61,0xFF,0xFF,0x00,0xDF,
+    0xFF,0x8F,0x9F,0x07,0x93,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,0x92,0x02,0x73,0x02,
+    0x51,0x02,0xBC,0xAE,0x52,0xFF,0xFF,0x06,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0x96,0x3C,0xF0,0x01,0x92,0x02,0x81,0x03,0xD2,0x02,0x93,0x02,0xF1,0x01,0x38,0x55,
+    0x81,0x00,0xFE,0xFF,0x54,0xFF,0xFF,0x09,0xFF,0xF7,0xFF,0xFF,0xFF,0xF7,0x54,0x0B,
+    0x10,0x02,0x93,0x0A,0x92,0x02,0xD2,0x02,0x92,0x02,0x92,0x02,0x81,0x04,0x30,0x02,
+    0x5B,0x9E,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x50,0xFF,0xFF,0x07,0x17,0x2C,0xF0,0x01,
+    0xB2,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x44,0x92,0x02,0x04,
+    0xB3,0x02,0xB2,0x02,0x31,0x02,0x14,0x13,0xFE,0xF7,0x95,0x0B,0xFE,0xFF,0xDF,0xFF,
+    0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0xFF,0xFF,0x3D,0xBF,0x50,0x02,0x51,0x02,0xB4,0x02,
+    0x93,0x02,0x91,0x02,0x8B,0x08,0x92,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0xF1,0x01,0x9A,0x75,0x9F,0x00,0x77,0x34,0x81,0x00,0xB3,0x02,
+    0x44,0x92,0x02,0x91,0xF7,0x00,0xDF,0xFF,0x81,0x02,0x39,0x5D,0x11,0x02,0x93,0x02,
+    0x4D,0x92,0x02,0x05,0xB2,0x02,0x92,0x02,0x92,0x02,0x94,0x02,0xEF,0x01,0x98,0x3C,
+    0x98,0x04,0x5D,0xCF,0x2F,0x02,0x32,0x02,0x51,0x02,0x52,0x02,0x43,0x51,0x02,0x08,
+    0x71,0x02,0x51,0x02,0x51,0x02,0x71,0x02,0x51,0x02,0x52,0x02,0x72,0x02,0xD0,0x01,
+    0x35,0x2C,0x84,0x09,0x1B,0x96,0x30,0x02,0x73,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x42,0xB2,0x02,0x0A,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x91,0x02,0x30,0x02,0xD1,0x01,
+    0xD8,0x54,0x42,0xFF,0xFF,0x0C,0xFE,0xFF,0xFE,0xF7,0xFF,0xFF,0xDE,0xF7,0xD2,0x0A,
+    0xD0,0x01,0x11,0x02,0x30,0x02,0x31,0x02,0x30,0x02,0x30,0x02,0x31,0x02,0x30,0x02,
+    0x46,0x31,0x02,0x01,0x8F,0x01,0xB3,0x2B,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,
+    0xFF,0x03,0xDF,0xF7,0x54,0x34,0x10,0x02,0xF1,0x01,0x42,0x11,0x02,0x00,0x12,0x02,
+    0x46,0x11,0x02,0x07,0x12,0x02,0x11,0x02,0x32,0x02,0x12,0x02,0xF3,0x01,0x12,0x02,
+    0x8E,0x01,0x13,0x13,0x83,0x04,0x38,0x5D,0x6F,0x01,0xF1,0x01,0xF1,0x01,0x10,0x02,
+    0x47,0x11,0x02,0x05,0x10,0x02,0xF0,0x01,0x11,0x02,0xB0,0x01,0x92,0x02,0xFF,0xE7,
+    0x9B,0x06,0x93,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0x31,0x02,0x3C,0x96,
+    0xA0,0x00,0x1D,0xC7,0x82,0x00,0x92,0x02,0x88,0x04,0x93,0x02,0x92,0x02,0x92,0x02,
+    0x10,0x02,0xF8,0x44,0xA2,0x06,0xDF,0xF7,0xF3,0x0A,0x51,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0x9A,0x04,0xFF,0xEF,0x37,0x6D,0xF8,0x54,0x38,0x55,0x19,0x5D,
+    0x7F,0x02,0x39,0x5D,0x09,0x19,0x5D,0x39,0x5D,0x37,0x55,0x17,0x5D,0x3A,0x55,0x58,
+    0x5D,0xD4,0x1B,0x31,0x02,0x93,0x02,0x92,0x02,0x81,0x00,0x92,0x02,0x83,0x02,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0x81,0x07,0x73,0x02,0xB2,0x02,0xB3,0x02,0xB1,0x02,0x50,
+    0x02,0x96,0x23,0x39,0x5D,0x38,0x5D,0x51,0x39,0x5D,0x00,0x38,0x5D,0x43,0x39,0x5D,
+    0x03,0x39,0x55,0x39,0x5D,0xD7,0x54,0xBC,0xBE,0x55,0xFF,0xFF,0x9F,0x07,0x92,0x02,
+    0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x94,0x02,0xF0,0x01,0xD8,0x44,0x8F,0x00,
+    0xDF,0xFF,0x82,0x42,0xFF,0xFF,0x01,0x5B,0x9E,0x11,0x02,0x82,0x03,0xB2,0x02,0x73,
+    0x02,0x71,0x02,0xFD,0xC6,0x57,0xFF,0xFF,0x81,0x0A,0xFF,0xFF,0xF8,0x4C,0xF0,0x01,
+    0x92,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x11,0x02,0x34,0x13,
+    0x53,0xFF,0xFF,0x11,0x5D,0xD7,0x73,0x02,0x51,0x02,0xB3,0x02,0x93,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,
+    0x92,0x02,0xB3,0x02,0xF0,0x01,0x59,0x65,0x59,0xFF,0xFF,0x09,0xDF,0xFF,0xDF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0x16,0x2C,0xF1,0x01,0xB4,0x02,0x92,0x02,0xB1,0x02,0x93,0x02,
+    0x88,0x00,0xB2,0x02,0x82,0x00,0x92,0x02,0x82,0x03,0x92,0x02,0x11,0x02,0x76,0x34,
+    0xDF,0xFF,0xA1,0x00,0xB2,0x02,0x48,0x92,0x02,0xBC,0x00,0xDF,0xFF,0x4A,0xFF,0xFF,
+    0x01,0xBC,0xAE,0x51,0x02,0x83,0x00,0xB2,0x02,0x4A,0x92,0x02,0x04,0xB2,0x02,0x92,
+    0x02,0x93,0x02,0x10,0x02,0xB8,0x7D,0x98,0x05,0x3C,0xDF,0x90,0x0A,0x92,0x02,0xD3,
+    0x0A,0xF3,0x02,0xD2,0x0A,0x47,0xB3,0x0A,0x0C,0xD3,0x02,0xD3,0x02,0x30,0x02,0x56,
+    0x44,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0x1A,0x86,0xCE,0x01,0xF0,
+    0x01,0x30,0x02,0x4C,0x11,0x02,0x08,0xF1,0x01,0x12,0x02,0x11,0x02,0x51,0x02,0x32,
+    0x13,0x1B,0x8E,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x43,0xFF,0xFF,0x0A,0xDF,0xF7,0x7C,
+    0x9E,0x1B,0x86,0x3B,0x8E,0x5C,0x96,0x5B,0x8E,0x3B,0x8E,0x5B,0x8E,0x5B,0x96,0x5B,
+    0x96,0x5B,0x8E,0x42,0x5C,0x8E,0x04,0x5B,0x8E,0x5C,0x8E,0x3C,0x86,0xFB,0x7D,0xBB,
+    0xB6,0x44,0xFF,0xFF,0x08,0xDF,0xFF,0xDF,0xFF,0xFE,0xFF,0xFF,0xF7,0xDD,0xAE,0x38,
+    0x5D,0x15,0x2C,0xB4,0x2B,0xB4,0x2B,0x48,0xD4,0x2B,0x08,0xB4,0x2B,0xD4,0x2B,0xB4,
+    0x2B,0xF4,0x23,0xF4,0x2B,0x32,0x23,0x95,0x4C,0xFF,0xFF,0xFE,0xFF,0x81,0x04,0xBC,
+    0xB6,0xB6,0x4C,0x19,0x55,0xF8,0x5C,0x38,0x55,0x47,0x19,0x5D,0x05,0x18,0x55,0x17,
+    0x55,0x38,0x5D,0xD6,0x54,0x79,0x65,0xFF,0xEF,0x9B,0x42,0x92,0x02,0x01,0x93,0x02,
+    0x92,0x02,0xA2,0x00,0xFC,0xBE,0x82,0x00,0xB2,0x02,0x4A,0x92,0x02,0x02,0x93,0x02,
+    0x10,0x02,0xD8,0x4C,0xA2,0x01,0xBF,0xEF,0xD3,0x0A,0x83,0x01,0x92,0x02,0x92,0x02,
+    0x99,0x06,0xDF,0xE7,0x30,0x02,0x8F,0x01,0xF1,0x01,0xD1,0x01,0xF0,0x01,0x10,0x02,
+    0x43,0xF0,0x01,0x01,0xD0,0x01,0xD0,0x01,0x78,0xF0,0x01,0x08,0xD0,0x01,0xD1,0x01,
+    0xF0,0x01,0x10,0x02,0x10,0x02,0xF0,0x01,0xF1,0x01,0x30,0x02,0xB3,0x02,0x45,0x92,
+    0x02,0x01,0xB2,0x02,0xB2,0x02,0x46,0x92,0x02,0x07,0x93,0x02,0x93,0x02,0x91,0x02,
+    0xB2,0x02,0x52,0x02,0xF1,0x01,0xF0,0x01,0xD0,0x01,0x4F,0xF0,0x01,0x09,0xD0,0x01,
+    0xF1,0x01,0xF1,0x01,0x11,0x02,0xF0,0x01,0xF0,0x01,0xF1,0x01,0xF2,0x01,0x4F,0x01,
+    0x78,0x75,0x95,0x9F,0x07,0xB2,0x02,0x92,0x02,0x92,0x02,0x91,0x02,0xB2,0x02,0x93,
+    0x02,0x10,0x02,0x75,0x13,0x86,0x00,0xDF,0xFF,0x4E,0xFF,0xFF,0x07,0xDF,0xF7,0x14,
+    0x0B,0x71,0x02,0xB3,0x02,0x91,0x02,0x92,0x02,0xF2,0x01,0xB4,0x1B,0x58,0xFF,0xFF,
+    0x00,0xDF,0xFF,0x81,0x04,0x1D,0xC7,0x52,0x02,0x90,0x02,0x91,0x02,0x73,0x0A,0x81,
+    0x02,0xD2,0x02,0xEF,0x01,0x79,0x65,0x93,0x07,0x37,0x55,0xD0,0x01,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x81,0xC1,0x05,0x93,0x02,0x92,0x02,
+    0xB2,0x02,0x51,0x02,0xB3,0x02,0x7E,0xE7,0x5D,0xFF,0xFF,0x06,0xFD,0xB6,0x31,0x02,
+    0x72,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x90,0x02,0x52,0x02,0x54,0x13,
+    0xFF,0xF7,0xB9,0x09,0xBE,0xEF,0xBA,0x7D,0xB9,0x6D,0xB9,0x6D,0xBA,0x75,0xBA,0x75,
+    0xB9,0x75,0xDA,0x6D,0xBA,0x75,0xD9,0x75,0x57,0xBA,0x75,0x47,0xB9,0x75,0x04,0xDA,
+    0x6D,0xDA,0x6D,0x98,0x65,0xDC,0xB6,0xDF,0xFF,0x8B,0x04,0xBF,0xF7,0x12,0x0B,0x51,
+    0x02,0x92,0x02,0xB2,0x02,0x4D,0x92,0x02,0x03,0x93,0x02,0x72,0x02,0x71,0x02,0x1D,
+    0xC7,0x97,0x07,0xDF,0xFF,0xDF,0xFF,0x5E,0xCF,0x3D,0xCF,0x5D,0xCF,0x5E,0xCF,0x5F,
+    0xCF,0x5F,0xCF,0x45,0x5E,0xCF,0x42,0x7E,0xCF,0x03,0x3D,0xC7,0x7E,0xE7,0xFF,0xFF,
+    0xDF,0xFF,0x42,0xFF,0xFF,0x07,0x1D,0xC7,0xB7,0x54,0xD8,0x54,0x18,0x5D,0xF8,0x54,
+    0xF7,0x5C,0xF7,0x54,0xF8,0x54,0x47,0xF8,0x5C,0x0C,0xF8,0x54,0xD8,0x54,0xF6,0x54,
+    0x5A,0x75,0x9D,0xA6,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xDF,0xFF,0xDF,0xFF,0x53,0xFF,0xFF,0x07,0xDF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFE,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0x56,0xFF,0xFF,0x02,0xFF,0xF7,0xFF,0xF7,
+    0xFE,0xFF,0x52,0xFF,0xFF,0x00,0xDF,0xFF,0xBF,0x5B,0x03,0xDE,0xEF,0xD1,0x12,0x51,
+    0x02,0xB2,0x02,0x45,0x92,0x02,0x00,0xB2,0x02,0x7D,0x92,0x02,0x05,0x72,0x02,0x92,
+    0x02,0x92,0x02,0x73,0x0A,0x93,0x02,0x93,0x02,0x8A,0x01,0xB2,0x02,0xB2,0x02,0x81,
+    0x06,0xB2,0x02,0x92,0x02,0x72,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0x51,
+    0x92,0x02,0x00,0x93,0x02,0x42,0x92,0x02,0x04,0xB2,0x02,0x92,0x02,0x73,0x02,0x0F,
+    0x02,0xD9,0x7D,0x95,0x9F,0x08,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x73,0x02,0x72,0x02,0x51,0x02,0xDC,0xAE,0x56,0xFF,0xFF,0x06,0x96,0x44,0xF0,0x01,
+    0xB3,0x02,0xB2,0x02,0x93,0x02,0xF1,0x01,0x78,0x6D,0x5C,0xFF,0xFF,0x08,0xB4,0x1B,
+    0x0F,0x02,0xB2,0x02,0x74,0x02,0xB2,0x02,0xB2,0x02,0x31,0x02,0x92,0x0A,0x7F,0xDF,
+    0x92,0x0C,0xDF,0xF7,0x12,0x0B,0x11,0x02,0x72,0x02,0xB2,0x02,0xB3,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x82,0x01,0xEF,0x01,
+    0x96,0x44,0x5F,0xFF,0xFF,0x04,0xD5,0x2B,0xF0,0x01,0xB3,0x02,0x93,0x02,0x93,0x02,
+    0x48,0x92,0x02,0x84,0x00,0x92,0x02,0x81,0x03,0x93,0x02,0x72,0x02,0x92,0x02,0x3E,
+    0xCF,0xB9,0x06,0x7D,0xDF,0xED,0x01,0xEF,0x01,0x0F,0x02,0x0F,0x02,0x10,0x02,0x0F,
+    0x02,0x42,0x10,0x02,0x57,0x0F,0x02,0x47,0x10,0x02,0x03,0xF0,0x01,0x10,0x02,0x6D,
+    0x01,0x97,0x3C,0x4D,0xFF,0xFF,0x04,0x15,0x34,0xF0,0x01,0xB3,0x02,0xB3,0x02,0x93,
+    0x02,0x88,0x00,0xB2,0x02,0x81,0x03,0xB2,0x02,0xB2,0x02,0x50,0x02,0x34,0x0B,0x59,
+    0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x51,0xFF,0xFF,0x03,0xFE,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x50,0xFF,0xFF,0x82,0xC1,0x00,0xDF,0xFF,0x5E,
+    0xFF,0xFF,0x00,0xDF,0xFF,0x56,0xFF,0xFF,0x93,0xCF,0xBF,0x4C,0x04,0xDE,0xF7,0x11,
+    0x0B,0x52,0x02,0xB2,0x02,0xB2,0x02,0x81,0x01,0x93,0x02,0x93,0x02,0x7D,0xB2,0x02,
+    0x81,0x04,0xB1,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x94,0x02,0x42,0x92,0x02,0x01,
+    0xB2,0x02,0x93,0x02,0x45,0x92,0x02,0x42,0xB2,0x02,0x82,0x04,0xB2,0x02,0x93,0x02,
+    0xB2,0x02,0x91,0x02,0xB1,0x02,0x54,0xB2,0x02,0x08,0x92,0x02,0x93,0x02,0xB2,0x02,
+    0xB1,0x02,0x71,0x02,0x10,0x02,0xF9,0x7D,0xFF,0xFF,0xDF,0xFF,0x93,0x9F,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x02,0xB3,0x02,0xF0,0x01,0xD8,0x4C,0x82,
+    0x00,0xDF,0xFF,0x8F,0x00,0xFE,0xFF,0x81,0x06,0x7A,0x9E,0x31,0x02,0x73,0x02,0x92,
+    0x02,0x72,0x02,0x91,0x02,0x5E,0xCF,0x81,0x00,0xDF,0xFF,0x95,0x00,0xFE,0xFF,0x82,
+    0x09,0xB8,0x75,0x12,0x02,0x93,0x02,0x92,0x02,0x91,0x02,0xB3,0x02,0xF1,0x01,0x97,
+    0x3C,0xFF,0xFF,0xFE,0xFF,0x91,0x0B,0xDB,0x8D,0xF0,0x01,0xB3,0x02,0xB3,0x02,0x72,
+    0x02,0xB3,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x81,
+    0x05,0xB2,0x02,0x71,0x02,0x71,0x02,0x1C,0xC7,0xFF,0xFF,0xDF,0xFF,0x9D,0x05,0xDB,
+    0xAE,0x30,0x02,0x73,0x02,0xB2,0x02,0x72,0x02,0xB2,0x02,0x8D,0xC3,0x01,0x31,0x02,
+    0x1C,0x8E,0xBA,0x03,0xB1,0x02,0x72,0x02,0x92,0x02,0xB3,0x02,0x43,0x93,0x02,0x00,
+    0xB3,0x02,0x57,0x93,0x02,0x48,0xB3,0x02,0x04,0x92,0x02,0xF1,0x01,0xFA,0x4C,0xFF,
+    0xFF,0xFE,0xFF,0x8B,0x03,0x7A,0x6D,0x10,0x02,0x93,0x02,0x92,0x02,0x8A,0x05,0xB2,
+    0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x0F,0x02,0x36,0x34,0x99,0x00,0xFE,0xFF,0x6D,
+    0xFF,0xFF,0x00,0xDF,0xFF,0x7F,0x1D,0xFF,0xFF,0xBF,0x4C,0x07,0xBE,0xF7,0xD1,0x0A,
+    0x33,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x7F,0x00,0x92,0x02,
+    0x05,0x93,0x02,0x92,0x02,0x93,0x02,0xB4,0x02,0xB2,0x02,0xB1,0x02,0x81,0x00,0x93,
+    0x02,0x47,0x92,0x02,0x84,0x02,0x94,0x02,0xB3,0x02,0x92,0x02,0x42,0x93,0x02,0x01,
+    0x73,0x02,0x93,0x02,0x52,0x92,0x02,0x06,0x93,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,
+    0x91,0x02,0x11,0x02,0xBA,0x85,0x55,0xFF,0xFF,0xA3,0x05,0x93,0x02,0xD2,0x02,0xB3,
+    0x02,0x12,0x02,0x33,0x13,0xFE,0xFF,0x81,0x02,0xBF,0xFF,0xFE,0xFF,0xFE,0xF7,0x50,
+    0xFF,0xFF,0x06,0xFF,0xEF,0x13,0x0B,0x31,0x02,0x94,0x02,0x10,0x02,0xF5,0x23,0xFE,
+    0xFF,0x5C,0xFF,0xFF,0x07,0xBE,0xE7,0xB4,0x0A,0x51,0x02,0x91,0x02,0xB3,0x02,0x72,
+    0x02,0x31,0x02,0xBC,0xB6,0x42,0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,0x8E,0x05,0xD4,
+    0x1B,0x6F,0x01,0x5A,0x55,0x34,0x2C,0x30,0x02,0xB2,0x02,0x42,0x92,0x02,0x81,0x00,
+    0xB2,0x02,0x82,0x01,0x0F,0x02,0xF6,0x2B,0x5E,0xFF,0xFF,0x06,0xDF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xD5,0x2B,0x11,0x02,0xB4,0x02,0x92,0x02,0x88,0x01,0x92,0x02,0xB2,0x02,
+    0x47,0x92,0x02,0x01,0x11,0x02,0xF7,0x54,0xB3,0x00,0xDF,0xFF,0x85,0x04,0x91,0x0A,
+    0x73,0x02,0x92,0x02,0x92,0x02,0x73,0x02,0x64,0x92,0x02,0x05,0x93,0x02,0x11,0x02,
+    0xF8,0x54,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x8A,0x02,0xDD,0xBE,0x70,0x02,0x72,0x02,
+    0x4B,0x92,0x02,0x82,0x02,0xB1,0x02,0xF0,0x01,0x38,0x6D,0x5A,0xFF,0xFF,0x05,0xFE,
+    0xFF,0xD9,0x7D,0x94,0x1B,0xF5,0x2B,0xF4,0x2B,0xF5,0x23,0x43,0xD5,0x23,0x43,0xF5,
+    0x2B,0x0F,0xF5,0x23,0xD5,0x23,0xF5,0x2B,0x14,0x24,0xF5,0x23,0xD5,0x23,0xF5,0x23,
+    0xF5,0x2B,0xD5,0x23,0xF5,0x2B,0xD5,0x2B,0xD5,0x23,0xF5,0x2B,0xD6,0x2B,0xF5,0x23,
+    0xD5,0x23,0x47,0xF5,0x23,0x0F,0xF5,0x2B,0xD5,0x23,0xF5,0x2B,0xD5,0x23,0xF5,0x2B,
+    0xF4,0x23,0xD5,0x23,0xF5,0x23,0xF5,0x2B,0xF5,0x23,0xF5,0x23,0xD6,0x23,0xF5,0x2B,
+    0xD4,0x23,0xD5,0x23,0xD5,0x2B,0x47,0xF5,0x23,0x03,0xD5,0x23,0xD5,0x23,0xF5,0x2B,
+    0xF5,0x2B,0x43,0xD5,0x23,0x0F,0xD5,0x2B,0xD5,0x23,0xD5,0x2B,0xF5,0x2B,0xF5,0x23,
+    0xD5,0x23,0xF5,0x23,0xF5,0x2B,0xD5,0x2B,0xF5,0x2B,0xF5,0x2B,0x15,0x24,0xD5,0x2B,
+    0xD5,0x23,0xF5,0x2B,0xF5,0x2B,0x48,0xF5,0x23,0x0D,0xD5,0x23,0xF5,0x23,0xD5,0x2B,
+    0xF5,0x23,0xF5,0x23,0xD5,0x2B,0xF5,0x2B,0xF5,0x23,0x15,0x24,0xD5,0x2B,0xD5,0x2B,
+    0xF5,0x2B,0xF5,0x2B,0xD5,0x23,0x48,0xF5,0x23,0x04,0xD4,0x23,0xF5,0x2B,0xB5,0x1B,
+    0x35,0x2C,0x9E,0xE7,0xBF,0x5E,0x07,0xF2,0x0A,0x53,0x02,0x93,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xBC,0x00,0xB3,0x02,0x82,0x02,0xB2,0x02,0x92,
+    0x02,0xB2,0x02,0x42,0x92,0x02,0x85,0x00,0xB2,0x02,0x42,0x92,0x02,0x83,0x05,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x53,0x92,0x02,0x07,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x72,0x02,0x10,0x02,0xDA,0x85,0x95,
+    0x9F,0x00,0x92,0x02,0x82,0x05,0x92,0x02,0xB2,0x02,0x92,0x02,0x72,0x02,0x31,0x02,
+    0x9D,0xAE,0x81,0x01,0xDF,0xFF,0xFE,0xFF,0x52,0xFF,0xFF,0x05,0x97,0x34,0xEF,0x01,
+    0xD2,0x02,0xF1,0x01,0xBA,0x7D,0xDF,0xFF,0x5D,0xFF,0xFF,0x05,0x76,0x3C,0xF0,0x01,
+    0xB2,0x02,0x93,0x02,0x10,0x02,0x94,0x1B,0x50,0xFF,0xFF,0x00,0xFF,0xF7,0x81,0x0A,
+    0xDD,0xBE,0x30,0x02,0x71,0x02,0xFF,0xF7,0x5A,0x9E,0x30,0x02,0xB3,0x02,0x93,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0x83,0x02,0x71,0x02,0x11,0x02,0x7C,0x9E,0x61,0xFF,
+    0xFF,0x04,0xBC,0xAE,0x11,0x02,0x72,0x02,0xB1,0x02,0x93,0x02,0x89,0x00,0xB2,0x02,
+    0x83,0x00,0xB2,0x02,0x82,0x00,0x35,0x2C,0xB3,0xC5,0x05,0x7E,0xE7,0xB0,0x0A,0x53,
+    0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x81,0x00,0xB2,0x02,0x98,0x49,0xB2,0x02,0x01,
+    0xF1,0x01,0x18,0x55,0x4D,0xFF,0xFF,0x02,0xFF,0xF7,0x12,0x0B,0x51,0x02,0x81,0x00,
+    0xB2,0x02,0x49,0x92,0x02,0x04,0xB2,0x02,0xB3,0x02,0x71,0x02,0x32,0x02,0xBC,0xA6,
+    0x98,0x07,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xB7,0x44,0x6F,0x01,0x11,0x02,0xF1,0x01,
+    0xEF,0x01,0x46,0x10,0x02,0x0F,0xEF,0x01,0xF0,0x01,0xF0,0x01,0xEF,0x01,0x10,0x02,
+    0xF0,0x01,0xF0,0x01,0xEF,0x01,0x10,0x02,0xEF,0x01,0xF0,0x01,0xF0,0x01,0x10,0x02,
+    0xF0,0x01,0xF0,0x01,0xEF,0x01,0x48,0x10,0x02,0x0B,0xEF,0x01,0x0F,0x02,0xEF,0x01,
+    0x10,0x02,0xEF,0x01,0x0F,0x02,0x10,0x02,0xF0,0x01,0xF0,0x01,0xEF,0x01,0x0F,0x02,
+    0x10,0x02,0x42,0xEF,0x01,0x00,0x0F,0x02,0x43,0xF0,0x01,0x05,0xEF,0x01,0xEF,0x01,
+    0x10,0x02,0xEF,0x01,0xF0,0x01,0xEF,0x01,0x42,0x10,0x02,0x08,0xF0,0x01,0xEF,0x01,
+    0x10,0x02,0xEF,0x01,0x0F,0x02,0xF0,0x01,0xF0,0x01,0x10,0x02,0x0F,0x02,0x42,0xEF,
+    0x01,0x06,0xF0,0x01,0xEF,0x01,0x10,0x02,0xF0,0x01,0x10,0x02,0x10,0x02,0xEF,0x01,
+    0x47,0x10,0x02,0x0A,0xEF,0x01,0x10,0x02,0x0F,0x02,0x0F,0x02,0xF0,0x01,0x10,0x02,
+    0x0F,0x02,0xF0,0x01,0xF0,0x01,0xEF,0x01,0x0F,0x02,0x42,0x10,0x02,0x01,0xF0,0x01,
+    0xEF,0x01,0x47,0x10,0x02,0x05,0xF1,0x01,0xF0,0x01,0xB0,0x01,0x2F,0x02,0x5E,0xD7,
+    0xDF,0xFF,0xBF,0x5C,0x07,0xBE,0xEF,0xD2,0x0A,0x32,0x02,0xB2,0x02,0xB2,0x02,0xB3,
+    0x02,0x92,0x02,0x92,0x02,0x43,0xB2,0x02,0xB9,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,
+    0x86,0xC1,0x00,0x93,0x02,0x83,0x00,0xB2,0x02,0x47,0x92,0x02,0x43,0xB2,0x02,0x91,
+    0x03,0xB2,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x82,0x02,0x92,0x02,0x10,0x02,0xD9,
+    0x7D,0x95,0xA1,0x0C,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x73,0x02,0xB1,0x02,
+    0xF0,0x01,0x9A,0x4C,0xFF,0xFF,0xFE,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x91,0x04,
+    0x5B,0x8E,0x30,0x02,0x52,0x02,0xD4,0x02,0x9E,0xE7,0x5E,0xFF,0xFF,0x05,0x7B,0x9E,
+    0x30,0x02,0x73,0x02,0x93,0x02,0x0F,0x02,0xDA,0x7D,0x81,0x02,0xBF,0xFF,0xFE,0xFF,
+    0xDF,0xFF,0x89,0x00,0xFE,0xFF,0x83,0x09,0x97,0x3C,0x6E,0x01,0x16,0x2C,0xFF,0xFF,
+    0xDD,0xAE,0x31,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x81,0xC2,0x01,0x11,
+    0x02,0x74,0x1B,0x60,0xFF,0xFF,0x04,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xD6,0x1B,0xEF,
+    0x01,0x90,0x04,0x93,0x02,0x93,0x02,0xB2,0x02,0x10,0x02,0x75,0x13,0xB9,0x01,0x7D,
+    0xDF,0x91,0x0A,0x81,0xC1,0x00,0xB2,0x02,0x82,0x57,0xB2,0x02,0x49,0x92,0x02,0x01,
+    0x11,0x02,0xF9,0x54,0x4E,0xFF,0xFF,0x03,0x16,0x34,0xF1,0x01,0x93,0x02,0xB2,0x02,
+    0x49,0x92,0x02,0x05,0xB2,0x02,0x92,0x02,0x92,0x02,0x31,0x02,0xF4,0x0A,0xDF,0xEF,
+    0x5B,0xFF,0xFF,0x04,0x18,0x55,0xF0,0x01,0x72,0x02,0x92,0x02,0xB2,0x02,0x47,0x92,
+    0x02,0x0F,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0xB2,0x02,0x91,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,
+    0x93,0x02,0x48,0xB2,0x02,0x04,0x92,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,
+    0x42,0x92,0x02,0x05,0xB2,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,
+    0x44,0x92,0x02,0x01,0xB2,0x02,0x92,0x02,0x42,0xB2,0x02,0x03,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0x92,0x02,0x43,0xB2,0x02,0x0E,0x92,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x92,0x02,0x93,0x02,0x92,0x02,0x47,0xB2,0x02,0x02,0x92,0x02,0x93,0x02,0x93,0x02,
+    0x43,0x92,0x02,0x04,0xB3,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x42,0x92,
+    0x02,0x48,0xB2,0x02,0x04,0x92,0x02,0x92,0x02,0x72,0x02,0xB1,0x0A,0x5F,0xDF,0x50,
+    0xFF,0xFF,0xBF,0x4C,0x05,0xBF,0xEF,0xD2,0x0A,0x72,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0x42,0x92,0x02,0xBC,0xC2,0x00,0xB2,0x02,0x81,0x01,0xB3,0x02,0x93,0x02,0x82,
+    0x00,0xB2,0x02,0x8B,0x00,0xB2,0x02,0x43,0x92,0x02,0x02,0xB3,0x02,0x93,0x02,0x93,
+    0x02,0x52,0x92,0x02,0x83,0x02,0x72,0x02,0x11,0x02,0xB9,0x85,0x95,0xA1,0x00,0xB2,
+    0x02,0x82,0x04,0x93,0x02,0xB2,0x02,0x31,0x02,0x35,0x13,0xFE,0xFF,0x55,0xFF,0xFF,
+    0x03,0xDD,0xF7,0xF3,0x0A,0x90,0x01,0x37,0x34,0x5D,0xFF,0xFF,0x0D,0xFE,0xFF,0xFF,
+    0xFF,0xFF,0xF7,0x52,0x13,0x32,0x02,0x31,0x02,0x14,0x0B,0xFF,0xEF,0xDF,0xFF,0xFF,
+    0xFF,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x86,0x0D,0xFE,0xFF,0xFF,0xFF,0xDF,
+    0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0xE7,0xD2,0x02,0xD1,0x01,0xBB,0xAE,0xFF,
+    0xFF,0x56,0x2C,0xAF,0x01,0x71,0x02,0x82,0x42,0x92,0x02,0x06,0x93,0x02,0x91,0x02,
+    0x11,0x02,0xBA,0x75,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0x5E,0xFF,0xFF,0x04,0xFE,0xFF,
+    0xFF,0xFF,0x9C,0xA6,0x30,0x02,0x92,0x02,0x8C,0x00,0xB2,0x02,0x81,0x05,0xB3,0x02,
+    0x93,0x02,0x92,0x02,0x30,0x02,0xD4,0x02,0x9E,0xDF,0xB9,0x02,0x90,0x02,0x73,0x02,
+    0xB2,0x02,0x83,0xE1,0x03,0xB2,0x02,0x92,0x02,0x10,0x02,0x18,0x4D,0x81,0x00,0xDF,
+    0xFF,0x8B,0x01,0x9B,0x6D,0xF0,0x01,0x4A,0x92,0x02,0x05,0x93,0x02,0x93,0x02,0x92,
+    0x02,0xB2,0x02,0x11,0x02,0xD6,0x23,0x5C,0xFF,0xFF,0x03,0x38,0x55,0x10,0x02,0xB1,
+    0x02,0xB1,0x02,0x4B,0x93,0x02,0x43,0x92,0x02,0x42,0x93,0x02,0x05,0xB3,0x02,0x93,
+    0x02,0x93,0x02,0x94,0x02,0x92,0x02,0xB3,0x02,0x49,0x93,0x02,0x01,0xB3,0x02,0xB2,
+    0x02,0x42,0x93,0x02,0x04,0xB3,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x82,
+    0x00,0xB2,0x02,0x45,0x93,0x02,0x00,0xB3,0x02,0x47,0x93,0x02,0x06,0x92,0x02,0x93,
+    0x02,0x93,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,0x48,0x93,0x02,0x00,0x92,
+    0x02,0x47,0x93,0x02,0x01,0x92,0x02,0x92,0x02,0x43,0x93,0x02,0x00,0x92,0x02,0x45,
+    0x93,0x02,0x81,0x48,0x93,0x02,0x04,0xB2,0x02,0xB1,0x02,0x71,0x02,0xD2,0x0A,0x9E,
+    0xD7,0xBF,0x5D,0x07,0xDE,0xEF,0xD1,0x12,0x52,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0x43,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0xB7,0x02,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x06,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,
+    0x93,0x02,0xB2,0x02,0xB2,0x02,0x89,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x82,0x00,
+    0xB2,0x02,0x53,0x92,0x02,0x07,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0x10,0x02,0xF9,0x7D,0x81,0x00,0xDF,0xFF,0x92,0xA1,0x0A,0x93,0x02,0x93,
+    0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x94,0x02,0x72,0x02,0x50,0x02,0x9E,0xA6,0xFF,
+    0xFF,0xFE,0xFF,0x54,0xFF,0xFF,0x02,0x78,0x34,0x8E,0x01,0x1A,0x8E,0x60,0xFF,0xFF,
+    0x06,0x16,0x55,0xF0,0x01,0xF1,0x01,0xF8,0x4C,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,0x4A,
+    0xFF,0xFF,0x81,0x01,0xFF,0xFF,0xFF,0xF7,0x81,0x0B,0x99,0x65,0xAE,0x01,0x54,0x13,
+    0xFF,0xFF,0x9D,0xD7,0x71,0x02,0x95,0x13,0xD3,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x93,0x02,0x82,0x03,0x31,0x02,0xF2,0x0A,0xFF,0xF7,0xFF,0xFF,0x42,0xDF,0xFF,0x91,
+    0x00,0xDF,0xFF,0x8A,0x0A,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xB6,0x1B,0xF0,0x01,0xB2,
+    0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x42,0xB2,0x02,0x46,0x92,
+    0x02,0x05,0x93,0x02,0xB3,0x02,0x92,0x02,0x71,0x02,0x72,0x02,0xFE,0xB6,0xB9,0x00,
+    0xB0,0x0A,0x83,0x00,0x92,0x02,0x43,0xB2,0x02,0x01,0x92,0x02,0xB2,0x02,0x81,0x03,
+    0xB2,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,0x82,0x01,0xB2,0x02,0xB2,0x02,0x81,0x00,
+    0xB2,0x02,0x81,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x8A,0x02,0x93,0x02,0x10,0x02,
+    0xF8,0x54,0x4E,0xFF,0xFF,0x04,0x1C,0xBF,0x71,0x02,0x72,0x02,0x92,0x02,0xB2,0x02,
+    0x88,0x00,0xB1,0x02,0x82,0x02,0xD7,0x54,0xFF,0xFF,0xFE,0xFF,0x9A,0x04,0x19,0x55,
+    0x12,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x7F,0x22,0x92,0x02,0x05,0xB2,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x49,0x93,0x02,0x04,0x53,0x02,0xD2,
+    0x0A,0x7F,0xD7,0xFF,0xFF,0xFE,0xFF,0x9A,0x01,0x93,0x02,0xB2,0x02,0x82,0x01,0x30,
+    0x02,0x3C,0x8E,0xA0,0x00,0x1C,0xBF,0x81,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0x87,
+    0x00,0xB2,0x02,0x82,0x00,0xD9,0x44,0xA3,0x02,0xF3,0x0A,0x50,0x02,0x93,0x02,0x81,
+    0xC1,0x01,0x92,0x02,0xB2,0x02,0x82,0x01,0x92,0x02,0xB2,0x02,0x81,0x00,0xF1,0x01,
+    0x8F,0x08,0xBE,0xEF,0xD2,0x0A,0x52,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0x84,0xF7,0x43,0x92,0x02,0x00,0xB2,0x02,0x81,0x00,0xB2,0x02,
+    0x4F,0x92,0x02,0x00,0xB2,0x02,0x82,0x00,0xB2,0x02,0x82,0x4F,0xB2,0x02,0x09,0xB3,
+    0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x72,0x02,0x11,
+    0x02,0xD9,0x85,0x55,0xFF,0xFF,0xA1,0x00,0x92,0x02,0x81,0x08,0xB1,0x02,0x93,0x02,
+    0x93,0x02,0x92,0x02,0xEF,0x01,0xD8,0x44,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0x91,0x04,
+    0xDF,0xFF,0xFF,0xFF,0xD9,0x7D,0x70,0x02,0xBF,0xE7,0xA0,0x03,0x1D,0xCF,0x30,0x02,
+    0x51,0x02,0x3E,0xCF,0x81,0x4C,0xFF,0xFF,0x02,0xDF,0xFF,0xFF,0xFF,0xFE,0xF7,0x81,
+    0x08,0x74,0x13,0x8F,0x01,0x99,0x75,0xFF,0xFF,0x97,0x3C,0x70,0x02,0x9D,0xD7,0x75,
+    0x1B,0x51,0x02,0x42,0x92,0x02,0x04,0xB2,0x02,0x93,0x02,0x93,0x02,0xEF,0x01,0x17,
+    0x5D,0x65,0xFF,0xFF,0x04,0x5B,0xA6,0x10,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x81,
+    0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x88,0x04,0x92,0x02,0xB1,0x02,0x73,0x02,0x51,
+    0x02,0x1A,0x8E,0xBF,0x03,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x46,0x92,0x02,0x01,
+    0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x81,0x02,
+    0x93,0x02,0xB2,0x02,0xB2,0x02,0x9B,0x02,0xDF,0xFF,0x13,0x13,0x51,0x02,0x89,0x05,
+    0xB2,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x31,0x02,0x1B,0x9E,0x5C,0xFF,0xFF,0x03,
+    0x18,0x55,0xF1,0x01,0x92,0x02,0x93,0x02,0x7F,0x32,0x92,0x02,0x01,0x93,0x02,0x72,
+    0x02,0x82,0xCF,0x89,0x42,0xB2,0x02,0x00,0x92,0x02,0x82,0x01,0x31,0x02,0x3C,0x96,
+    0xA0,0x00,0xFC,0xC6,0x81,0x00,0xB2,0x02,0x4A,0x92,0x02,0x03,0x93,0x02,0x92,0x02,
+    0x10,0x02,0xF8,0x4C,0xA4,0x05,0x52,0x02,0xB3,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,
+    0x92,0x02,0x87,0x01,0x92,0x02,0x10,0x02,0x92,0x47,0x92,0x02,0x00,0xB2,0x02,0x79,
+    0x92,0x02,0x00,0xB2,0x02,0x43,0x92,0x02,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x8F,
+    0x00,0x93,0x02,0x42,0x92,0x02,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x50,0x92,0x02,
+    0x03,0x93,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x42,0x92,0x02,0x01,0x93,0x02,0x10,
+    0x02,0x96,0x9F,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x83,0x04,0x92,0x02,0xB3,0x02,
+    0x31,0x02,0x52,0x13,0xFF,0xF7,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x51,0xFF,0xFF,0x01,
+    0xDB,0xCE,0xF8,0x64,0x5E,0xFF,0xFF,0x05,0xDE,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,
+    0x13,0x0B,0x54,0x13,0x42,0xFF,0xFF,0x00,0xFE,0xFF,0x4C,0xFF,0xFF,0x14,0xFE,0xFF,
+    0xDF,0xFF,0xFF,0xFF,0x7C,0xA6,0xCF,0x01,0x92,0x0A,0xDF,0xF7,0xFF,0xFF,0x12,0x02,
+    0x36,0x34,0xFF,0xFF,0xD7,0x4C,0xF0,0x01,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,
+    0xB2,0x02,0x72,0x02,0x91,0x02,0x7E,0xD7,0x66,0xFF,0xFF,0x01,0x76,0x1B,0x10,0x02,
+    0x81,0x43,0xB2,0x02,0x00,0x93,0x02,0x47,0x92,0x02,0x81,0x03,0x92,0x02,0x94,0x02,
+    0x10,0x02,0x58,0x6D,0xBF,0x03,0x08,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x44,0x92,0x02,0x00,0x93,0x02,0x82,
+    0x03,0xB2,0x02,0xB3,0x02,0x92,0x02,0xB3,0x02,0x9A,0x05,0xDF,0xFF,0xDF,0xFF,0xFF,
+    0xFF,0x76,0x3C,0xF0,0x01,0x93,0x02,0x89,0x04,0xB2,0x02,0xB3,0x02,0x71,0x02,0xB3,
+    0x0A,0x3E,0xDF,0x9C,0x04,0x19,0x55,0x11,0x02,0x93,0x02,0xB3,0x02,0xB3,0x02,0xBF,
+    0x51,0x01,0x92,0x02,0x93,0x02,0xA6,0x04,0xDC,0xC6,0x92,0x02,0x91,0x02,0x93,0x02,
+    0xB2,0x02,0x89,0x00,0xB2,0x02,0x81,0x00,0xD8,0x44,0xA2,0x00,0xDE,0xF7,0x81,0x0A,
+    0x92,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0xF0,0x01,0x8F,0x01,0xDE,0xEF,
+    0xF1,0x0A,0x82,0x00,0xB2,0x02,0x82,0x01,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x77,
+    0xB2,0x02,0x06,0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB2,
+    0x02,0x50,0x92,0x02,0x42,0xB2,0x02,0x04,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x93,0x02,0x4F,0xB2,0x02,0x81,0x00,0xB2,0x02,0x43,0x92,0x02,0x02,0x72,0x02,0x10,
+    0x02,0xD9,0x7D,0x95,0xA0,0xC1,0x81,0xC2,0x03,0xB2,0x02,0x72,0x02,0x70,0x02,0xDC,
+    0xA6,0x81,0x00,0xDF,0xFF,0x61,0xFF,0xFF,0x00,0xDF,0xFF,0x51,0xFF,0xFF,0x04,0xFF,
+    0xF7,0xDF,0xFF,0xFF,0xFF,0x5A,0x5D,0x9A,0x6D,0x50,0xFF,0xFF,0x13,0xDF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0x17,0x2C,0x8E,0x01,0x97,0x44,0xFF,0xFF,0xDA,0x7D,0xAE,0x01,0x1D,
+    0xC7,0xFF,0xFF,0x17,0x24,0x11,0x02,0xB1,0x02,0xB2,0x02,0x73,0x02,0xB3,0x02,0x92,
+    0x02,0xF1,0x01,0x56,0x44,0x4E,0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,0x82,0x00,0xDF,
+    0xFF,0x82,0x00,0xFE,0xFF,0x8A,0x0B,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0x7B,
+    0x9E,0x11,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x8B,
+    0x02,0x92,0x02,0xF0,0x01,0xD7,0x4C,0xBF,0x03,0x04,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0x93,0x02,0x92,0x02,0x81,0xC1,0x82,0x01,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x04,
+    0x93,0x02,0xB3,0x02,0x73,0x02,0x91,0x02,0xB2,0x02,0x49,0x92,0x02,0x90,0xC2,0x02,
+    0x9A,0x65,0x10,0x02,0xB3,0x02,0x49,0x92,0x02,0x06,0xB2,0x02,0x92,0x02,0x10,0x02,
+    0xB5,0x1B,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x9A,0x00,0x18,0x55,0x81,0xC1,0xBF,0x25,
+    0x4A,0xB2,0x02,0x85,0x00,0xFE,0xFF,0x98,0xC2,0x04,0xB1,0x02,0x92,0x02,0x72,0x02,
+    0x92,0x02,0x32,0x02,0x85,0x00,0xDF,0xFF,0x9A,0x01,0xDC,0xBE,0x91,0x02,0x81,0x4B,
+    0x92,0x02,0x05,0x93,0x02,0x10,0x02,0xF8,0x44,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x9F,
+    0x00,0xBE,0xEF,0x81,0x03,0x93,0x02,0x73,0x02,0x92,0x02,0xB2,0x02,0x89,0x00,0x10,
+    0x02,0x8F,0x06,0xBE,0xF7,0xD1,0x0A,0x52,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x93,
+    0x02,0x45,0x92,0x02,0x00,0xB2,0x02,0x78,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0x82,
+    0x01,0x92,0x02,0x73,0x02,0x8F,0x01,0xD2,0x02,0x92,0x02,0x42,0x93,0x02,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x52,0x92,0x02,0x06,0xB2,0x02,0xB2,0x02,0x93,0x02,0x93,
+    0x02,0xB1,0x02,0x30,0x02,0xD9,0x85,0x95,0x9F,0x00,0x92,0x02,0x43,0xB2,0x02,0x08,
+    0x93,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x10,0x02,0xD6,0x4C,0xFF,0xFF,
+    0xDF,0xFF,0x57,0xFF,0xFF,0x00,0xDF,0xFF,0x9C,0xC1,0x01,0xFD,0xFF,0xFF,0xE7,0x51,
+    0xFF,0xFF,0x81,0x11,0x3E,0xD7,0x52,0x02,0x30,0x02,0x3E,0xCF,0xFF,0xFF,0xD2,0x0A,
+    0x54,0x13,0xFF,0xFF,0xFC,0xC6,0x50,0x02,0x31,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,
+    0xB1,0x02,0x92,0x02,0x31,0x02,0x1C,0xBF,0x50,0xFF,0xFF,0x00,0xDF,0xFF,0x81,0x04,
+    0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0x4B,0xFF,0xFF,0x00,0xFE,0xFF,
+    0x42,0xFF,0xFF,0x03,0x75,0x1B,0x11,0x02,0x91,0x02,0x93,0x02,0x4C,0x92,0x02,0x04,
+    0x93,0x02,0x93,0x02,0x91,0x02,0xF0,0x01,0x35,0x34,0xBF,0x06,0x46,0x92,0x02,0x02,
+    0x93,0x02,0x93,0x02,0xB3,0x02,0x43,0x93,0x02,0x05,0x92,0x02,0x92,0x0A,0x92,0x02,
+    0x93,0x02,0xB2,0x02,0x93,0x02,0x9C,0x02,0xB7,0x44,0xF0,0x01,0xB2,0x02,0x8B,0x02,
+    0x11,0x02,0x73,0x13,0xDE,0xEF,0x5C,0xFF,0xFF,0x04,0x37,0x4D,0x2F,0x02,0xB1,0x02,
+    0xB1,0x02,0xB2,0x02,0x7F,0x27,0x92,0x02,0x89,0x01,0x92,0x02,0x52,0x02,0x82,0xCF,
+    0x8A,0x06,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x72,0x02,0xB1,0x02,0x31,0x02,
+    0x85,0xDB,0x05,0xFC,0xBE,0x92,0x02,0x71,0x02,0xB3,0x02,0x92,0x02,0xB3,0x02,0x4A,
+    0x92,0x02,0x03,0x10,0x02,0xD8,0x54,0xFF,0xFF,0xFF,0xFF,0xA0,0x04,0x1E,0xCF,0x92,
+    0x02,0x71,0x02,0xB2,0x02,0x92,0x02,0x81,0x00,0x92,0x02,0x86,0x02,0xB2,0x02,0x92,
+    0x02,0xF0,0x01,0x8F,0x07,0xDE,0xF7,0xD1,0x12,0x32,0x02,0x73,0x02,0x92,0x02,0xB2,
+    0x02,0xD3,0x02,0xB2,0x02,0x7E,0x92,0x02,0x06,0xB2,0x02,0x92,0x02,0x92,0x02,0xB1,
+    0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x50,0x92,0x02,0x05,0x93,0x02,0x92,0x02,0x91,
+    0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x01,0x93,0x02,0x93,0x02,0x82,0x02,0x92,
+    0x02,0xF1,0x01,0xBA,0x8D,0x95,0xA0,0xC2,0x43,0xB2,0x02,0x07,0x92,0x02,0x92,0x02,
+    0x31,0x02,0x54,0x13,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x61,0xFF,0xFF,0x00,
+    0xFE,0xFF,0x90,0x04,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFD,0xFF,0x52,0xFF,
+    0xFF,0x10,0x18,0x55,0x6F,0x01,0xB5,0x23,0xFF,0xFF,0xFD,0xC6,0x8F,0x01,0xFB,0x8D,
+    0xFF,0xFF,0x56,0x2C,0x71,0x02,0x18,0x4D,0x51,0x02,0x93,0x02,0x91,0x02,0xB2,0x02,
+    0xF2,0x01,0xD5,0x23,0x4F,0xFF,0xFF,0x00,0xFF,0xF7,0x81,0x05,0xFE,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xBF,0xFF,0x4A,0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,
+    0x83,0x00,0x3B,0x96,0x81,0x05,0xB3,0x02,0x72,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x88,0x03,0x92,0x02,0x92,0x02,0xF0,0x01,0xD5,0x23,0xBF,0x03,0x00,0xB2,
+    0x02,0x42,0x92,0x02,0x03,0xB2,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0x81,0x42,0xB2,
+    0x02,0x09,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xD1,0x02,0xB2,0x02,
+    0x95,0x02,0x72,0x02,0xB2,0x02,0x9C,0x01,0x53,0x13,0x31,0x02,0x8A,0x04,0xB3,0x02,
+    0x92,0x02,0x93,0x02,0x51,0x02,0x9C,0xAE,0x9C,0x04,0x19,0x55,0x10,0x02,0x73,0x02,
+    0xB3,0x02,0x93,0x02,0xBF,0x20,0x42,0xB2,0x02,0x4E,0x92,0x02,0x9D,0x02,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0x81,0x03,0x92,0x02,0x92,0x02,0x31,0x02,0x1B,0x96,0xA1,0x04,
+    0x93,0x02,0x32,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x87,0x42,0xB2,0x02,0x03,0xF1,
+    0x01,0xBA,0x4C,0xFF,0xFF,0xFF,0xF7,0x60,0xFF,0xFF,0x05,0x5B,0x9E,0x10,0x02,0x92,
+    0x02,0x91,0x02,0x92,0x02,0x93,0x02,0x84,0xC1,0x81,0xC1,0x90,0x01,0xDF,0xEF,0xF1,
+    0x0A,0x83,0xC1,0x00,0x92,0x02,0x42,0xB2,0x02,0xBA,0x05,0x73,0x02,0xB3,0x02,0x93,
+    0x02,0x94,0x02,0xB2,0x02,0xB1,0x02,0x88,0x00,0x93,0x02,0x83,0x42,0x93,0x02,0x06,
+    0xB1,0x02,0x93,0x02,0x93,0x02,0x72,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x90,0x00,
+    0xB2,0x02,0x82,0x05,0x92,0x02,0xB1,0x02,0x93,0x02,0x74,0x02,0x11,0x02,0xDA,0x7D,
+    0x95,0xA1,0x00,0xB2,0x02,0x84,0xC1,0x04,0x93,0x02,0x31,0x02,0xBB,0xAE,0xFF,0xFF,
+    0xFE,0xFF,0x56,0xFF,0xFF,0x00,0xDF,0xFF,0x89,0x00,0xFF,0xF7,0x51,0xFF,0xFF,0x01,
+    0xFF,0xF7,0xDF,0xFF,0x51,0xFF,0xFF,0x14,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,
+    0x12,0x0B,0x8F,0x01,0x1C,0x96,0xFF,0xFF,0xD5,0x23,0x51,0x02,0xFF,0xFF,0xDF,0xF7,
+    0x31,0x02,0x16,0x24,0xFF,0xFF,0x53,0x13,0x31,0x02,0x92,0x02,0x93,0x02,0x11,0x02,
+    0x5B,0x8E,0x81,0x00,0xFE,0xFF,0x8E,0x00,0xFF,0xFF,0x82,0x02,0xFE,0xFF,0xFF,0xFF,
+    0xDF,0xFF,0x4C,0xFF,0xFF,0x81,0x0A,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0x73,0x13,0xF1,
+    0x01,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,0x92,0x02,0x93,0x02,0x85,0x06,0x93,
+    0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x11,0x02,0x95,0x1B,0xBF,0x03,0x44,
+    0x92,0x02,0x44,0x93,0x02,0x83,0x42,0xB2,0x02,0x04,0x93,0x02,0x73,0x02,0xB3,0x02,
+    0xB2,0x02,0xB2,0x02,0x49,0x92,0x02,0x92,0x04,0x5E,0xCF,0xB2,0x02,0x92,0x02,0x72,
+    0x02,0xB2,0x02,0x87,0x05,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x10,0x02,0x18,
+    0x65,0x9D,0x03,0x11,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x7F,0x22,0x92,0x02,0x03,
+    0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xA9,0xC1,0x06,0xB2,0x02,0x92,0x02,0xB3,
+    0x02,0xB3,0x02,0x92,0x02,0x30,0x02,0x1C,0x96,0xA0,0x04,0x1C,0xC7,0x93,0x02,0x52,
+    0x02,0x92,0x02,0xB2,0x02,0x48,0x92,0x02,0x81,0x02,0x92,0x02,0x11,0x02,0xFA,0x44,
+    0x5C,0xFF,0xFF,0x01,0xFE,0xFF,0xFE,0xFF,0x83,0x02,0x95,0x44,0xF0,0x01,0xB3,0x02,
+    0x42,0x93,0x02,0x00,0x92,0x02,0x42,0xB2,0x02,0x81,0x01,0xB2,0x02,0x92,0x02,0x42,
+    0x93,0x02,0x90,0x0B,0xDF,0xF7,0xF1,0x0A,0x71,0x02,0xB2,0x02,0x92,0x02,0x73,0x02,
+    0x72,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x7A,0xB2,0x02,0x06,
+    0x93,0x02,0x92,0x02,0x92,0x02,0xB4,0x02,0xB1,0x02,0x92,0x02,0x76,0x02,0x4E,0x92,
+    0x02,0x08,0x93,0x02,0xD1,0x02,0x73,0x02,0x93,0x02,0xD2,0x02,0xD1,0x02,0xB2,0x02,
+    0xB3,0x02,0x92,0x02,0x51,0xB2,0x02,0x81,0x05,0xB2,0x02,0x91,0x02,0x72,0x02,0x73,
+    0x02,0x30,0x02,0xF8,0x7D,0x95,0x9F,0xC1,0x45,0x92,0x02,0x04,0x93,0x02,0xB3,0x02,
+    0x93,0x02,0xF1,0x01,0xD6,0x44,0x81,0x00,0xDF,0xFF,0x5E,0xFF,0xFF,0x04,0xDF,0xFF,
+    0xFF,0xF7,0xFF,0xF7,0x7F,0xF7,0x5E,0xDF,0x51,0xFF,0xFF,0x02,0xFE,0xFF,0xDF,0xFF,
+    0xFF,0xF7,0x4F,0xFF,0xFF,0x81,0x10,0xF9,0x8D,0xB0,0x01,0x13,0x0B,0xFF,0xFF,0xBF,
+    0xEF,0xF0,0x01,0xD8,0x4C,0xFF,0xFF,0x39,0x65,0x6F,0x01,0x9B,0x9E,0xFF,0xFF,0x97,
+    0x2C,0x30,0x02,0x93,0x02,0x11,0x02,0x53,0x13,0x50,0xFF,0xFF,0x00,0xDF,0xFF,0x42,
+    0xFF,0xFF,0x06,0x57,0x75,0x1A,0x9E,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFE,
+    0xFF,0x4B,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x06,0x1B,0x96,0xF2,0x01,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x46,0x92,0x02,0x82,0x03,0x93,0x02,
+    0xB2,0x02,0x31,0x02,0x75,0x0B,0xBF,0x05,0x05,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0xD3,0x02,0x92,0x02,0x43,0x11,0x02,0x00,0xF1,0x01,0x44,0x11,0x02,0x05,0x31,
+    0x02,0x92,0x02,0x91,0x02,0x93,0x02,0x72,0x02,0xB2,0x02,0x9A,0x03,0x1B,0x86,0x11,
+    0x02,0x72,0x02,0x93,0x02,0x4B,0x92,0x02,0x02,0xD3,0x02,0xF1,0x01,0x15,0x2C,0x9C,
+    0x03,0xD8,0x4C,0xB0,0x01,0x32,0x02,0x30,0x02,0x7F,0x21,0x51,0x02,0x02,0x31,0x02,
+    0x51,0x02,0x92,0x02,0x82,0xC9,0x9F,0x08,0xB2,0x02,0xB2,0x02,0x92,0x02,0x72,0x02,
+    0x92,0x02,0xB3,0x02,0xB3,0x02,0x0F,0x02,0xBD,0xAE,0xA0,0x04,0x7E,0xE7,0x92,0x02,
+    0x72,0x02,0xB2,0x02,0x93,0x02,0x4B,0x92,0x02,0x01,0xEF,0x01,0x37,0x5D,0x61,0xFF,
+    0xFF,0x08,0x98,0x7D,0x31,0x02,0x73,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,
+    0x93,0x02,0x92,0x02,0x88,0x00,0x10,0x02,0x8F,0x07,0xBF,0xF7,0xB1,0x12,0x30,0x02,
+    0xB2,0x02,0xB2,0x02,0x53,0x02,0x73,0x02,0x93,0x02,0x7D,0x92,0x02,0x07,0x72,0x02,
+    0x92,0x02,0x72,0x02,0x91,0x02,0xB1,0x02,0x52,0x02,0x74,0x02,0x91,0x02,0x4F,0x92,
+    0x02,0x06,0x73,0x02,0xB3,0x02,0xB1,0x02,0x90,0x02,0x72,0x02,0x73,0x02,0x72,0x02,
+    0x54,0x92,0x02,0x05,0xB2,0x02,0x73,0x02,0x73,0x02,0xB2,0x02,0xEF,0x01,0xB9,0x8D,
+    0x95,0x96,0x00,0x75,0x44,0x81,0x01,0x92,0x02,0x93,0x02,0x4C,0x92,0x02,0x03,0xB2,
+    0x02,0x93,0x02,0x32,0x02,0x53,0x13,0x64,0xFF,0xFF,0x01,0x1A,0x9E,0xF4,0x33,0x63,
+    0xFF,0xFF,0x13,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xD5,0x1B,0x4F,0x01,0x38,0x65,0xFF,
+    0xFF,0xD8,0x54,0xD0,0x01,0xBE,0xE7,0xFF,0xFF,0x93,0x0A,0xD3,0x0A,0xFF,0xFF,0xBE,
+    0xE7,0xD2,0x0A,0x71,0x02,0x94,0x02,0xF0,0x01,0x98,0x75,0x8F,0x01,0xDF,0xFF,0xDE,
+    0xFF,0x81,0x02,0xFF,0xF7,0x91,0x02,0x93,0x1B,0x81,0x00,0xFE,0xF7,0x52,0xFF,0xFF,
+    0x04,0x54,0x13,0x0F,0x02,0xB2,0x02,0xB2,0x02,0x94,0x02,0x49,0x92,0x02,0x00,0xB1,
+    0x02,0x81,0x02,0x50,0x02,0x14,0x0B,0xDF,0xEF,0xBF,0x03,0x08,0xB2,0x02,0xB2,0x02,
+    0x92,0x02,0x93,0x02,0xB2,0x02,0x52,0x02,0xD4,0x23,0xBA,0x7D,0x79,0x75,0x46,0x79,
+    0x6D,0x02,0xDA,0x7D,0xD7,0x4C,0x72,0x02,0x81,0x00,0x92,0x02,0x98,0x00,0xDF,0xFF,
+    0x81,0x03,0xD9,0x44,0xF0,0x01,0x92,0x02,0xB2,0x02,0x88,0x00,0xB2,0x02,0x42,0x92,
+    0x02,0x02,0x11,0x02,0x13,0x0B,0xFF,0xEF,0x9B,0x04,0x59,0x65,0x90,0x02,0x13,0x0B,
+    0xF3,0x0A,0xF4,0x12,0x7F,0x20,0xF3,0x0A,0x06,0x14,0x13,0xF3,0x0A,0xB2,0x02,0x92,
+    0x02,0x91,0x02,0x93,0x02,0xB2,0x02,0x4A,0x92,0x02,0x02,0x72,0x02,0xD2,0x0A,0x7F,
+    0xDF,0x9A,0xC1,0x0A,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x73,0x02,
+    0x17,0x24,0xD9,0x3C,0xB8,0x44,0xB8,0x44,0x98,0x44,0x54,0xB8,0x44,0x09,0x98,0x44,
+    0x98,0x44,0xB8,0x44,0x98,0x44,0xB8,0x44,0x99,0x44,0xB8,0x3C,0xB8,0x4C,0x57,0x34,
+    0x71,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x88,0x06,0xB2,0x02,0x92,0x02,0x51,0x02,
+    0x94,0x13,0xD9,0x44,0x97,0x44,0x97,0x44,0x58,0xB8,0x44,0x0C,0xD9,0x44,0xB8,0x44,
+    0xB9,0x44,0xF9,0x3C,0x76,0x34,0x72,0x1B,0x30,0x02,0x73,0x02,0x93,0x02,0xB2,0x02,
+    0xB1,0x02,0x92,0x02,0x92,0x02,0x42,0xB2,0x02,0x09,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x0F,0x02,0x98,0x3C,0x8E,0x05,
+    0xFF,0xE7,0x92,0x0A,0xD0,0x01,0x71,0x02,0x72,0x02,0x52,0x02,0x7F,0x03,0x51,0x02,
+    0x07,0x72,0x02,0x32,0x02,0x73,0x02,0x70,0x02,0x71,0x02,0x93,0x02,0xB3,0x02,0x93,
+    0x02,0x81,0x00,0xB2,0x02,0x89,0x07,0x94,0x02,0xB2,0x02,0x91,0x02,0x94,0x02,0x74,
+    0x02,0x52,0x02,0x51,0x02,0x52,0x02,0x4F,0x51,0x02,0x09,0x52,0x02,0x51,0x02,0x51,
+    0x02,0x71,0x02,0x32,0x02,0x52,0x02,0x71,0x02,0x51,0x02,0xB0,0x01,0x7A,0x7D,0x95,
+    0x96,0x00,0x95,0x44,0x8F,0x05,0xB3,0x02,0xB3,0x02,0x92,0x02,0x72,0x02,0x30,0x02,
+    0xBC,0xB6,0xA1,0x04,0xFE,0xFF,0xFF,0xFF,0x18,0x55,0x10,0x02,0x5D,0xDF,0x64,0xFF,
+    0xFF,0x11,0xDD,0xBE,0x11,0x02,0x51,0x02,0x7D,0xEF,0xFF,0xFF,0x91,0x02,0x74,0x23,
+    0xFF,0xFF,0x5B,0xA6,0x6F,0x01,0x98,0x55,0xFF,0xFF,0x3A,0x5D,0xB0,0x01,0x72,0x02,
+    0x52,0x02,0xD4,0x0A,0xBE,0xF7,0x8F,0x0B,0xFF,0xF7,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,
+    0x7A,0x9E,0xF1,0x01,0x11,0x02,0x1C,0xBF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,
+    0x90,0x06,0x1A,0x86,0xF0,0x01,0x72,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x93,0x02,
+    0x88,0x00,0x73,0x02,0x81,0x01,0xF4,0x0A,0xBF,0xE7,0xBF,0x03,0x06,0x92,0x02,0x93,
+    0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x11,0x02,0xF6,0x64,0x49,0xFF,0xFF,0x01,0x7D,
+    0xDF,0x52,0x02,0x82,0xC8,0x8F,0x00,0xBF,0xFF,0x81,0x04,0x94,0x1B,0x11,0x02,0xB2,
+    0x02,0x92,0x02,0x93,0x02,0x88,0x00,0x93,0x02,0x81,0x02,0x71,0x02,0x51,0x02,0xBC,
+    0xAE,0x99,0x04,0xFF,0xF7,0xDE,0xFF,0xDE,0xF7,0xBF,0xDF,0xBF,0xDF,0x7F,0x22,0xBF,
+    0xE7,0x07,0xDF,0xE7,0x7B,0x9E,0x72,0x02,0x73,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0xA8,0x01,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x09,0xB3,0x02,0xB3,0x02,
+    0x30,0x02,0x10,0x02,0xF0,0x01,0x11,0x02,0xF0,0x01,0x10,0x02,0xF0,0x01,0xF0,0x01,
+    0x55,0x10,0x02,0x08,0x11,0x02,0x11,0x02,0xEF,0x01,0x10,0x02,0x31,0x02,0x92,0x02,
+    0xB3,0x02,0x93,0x02,0xB3,0x02,0x49,0x92,0x02,0x05,0x93,0x02,0xB2,0x02,0xB3,0x02,
+    0x52,0x02,0x12,0x02,0xF0,0x01,0x5B,0x10,0x02,0x0A,0xF0,0x01,0x11,0x02,0xF1,0x01,
+    0x11,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x93,0x02,
+    0x81,0x42,0x92,0x02,0x00,0xB2,0x02,0x42,0x92,0x02,0x03,0xB3,0x02,0x73,0x02,0x2F,
+    0x02,0x3A,0x55,0x8E,0x04,0xFE,0xF7,0xDB,0xB6,0x7D,0xA6,0x7C,0xB6,0xBB,0xA6,0x7F,
+    0x01,0xBC,0xAE,0x08,0xDD,0xAE,0x9D,0xAE,0xBC,0xAE,0xDB,0xAE,0x9D,0xAE,0xBC,0xA6,
+    0xBB,0xB6,0x78,0x3C,0x31,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x8A,0x05,0xB3,0x02,
+    0x72,0x02,0x93,0x02,0x72,0x02,0x95,0x3C,0xDC,0xAE,0x51,0xBC,0xAE,0x03,0xBD,0xB6,
+    0xBD,0xAE,0xBC,0xAE,0xBC,0xB6,0x42,0x9C,0xAE,0x03,0x7B,0xAE,0x5C,0xA6,0x9D,0xDF,
+    0xFE,0xFF,0x94,0x96,0x02,0x75,0x44,0xF0,0x01,0x93,0x02,0x81,0x01,0xB2,0x02,0xB2,
+    0x02,0x4A,0x92,0x02,0x81,0x02,0x92,0x02,0xF0,0x01,0xD8,0x4C,0x62,0xFF,0xFF,0x03,
+    0xFE,0xFF,0x94,0x13,0x70,0x01,0x7A,0x6D,0x9D,0x01,0xDF,0xFF,0xDF,0xFF,0x84,0x13,
+    0x96,0x3C,0x4D,0x01,0x77,0x2C,0xFF,0xFF,0x3C,0x8E,0xCF,0x01,0xDC,0xAE,0xFF,0xFF,
+    0x95,0x13,0x10,0x02,0xDD,0xE7,0xFF,0xFF,0xB3,0x0A,0xD3,0x02,0x77,0x34,0xAD,0x01,
+    0xF7,0x4C,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x8D,0x0A,0xDF,0xFF,0xFF,0xF7,0xFF,0xFF,
+    0xFF,0xFF,0x16,0x24,0xF1,0x01,0xF0,0x01,0x55,0x34,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,
+    0x52,0xFF,0xFF,0x04,0x53,0x13,0xF1,0x01,0x93,0x02,0x93,0x02,0xB2,0x02,0x48,0x92,
+    0x02,0x05,0xB2,0x02,0x93,0x02,0xB2,0x02,0x51,0x02,0xD3,0x02,0x7E,0xDF,0xBF,0x02,
+    0xC3,0x82,0x00,0xD7,0x4C,0x89,0x05,0xBC,0xBE,0x72,0x02,0x72,0x02,0xB2,0x02,0x92,
+    0x02,0xB2,0x02,0x97,0xC1,0x02,0x7E,0xE7,0xB3,0x02,0x72,0x02,0x81,0xCA,0x04,0xB2,
+    0x02,0x72,0x02,0xB2,0x02,0xF0,0x01,0x38,0x65,0x7F,0x42,0xFF,0xFF,0x05,0xFD,0xCE,
+    0x71,0x02,0x72,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x4A,0x92,0x02,0x9D,0x00,0xB2,
+    0x02,0x48,0x92,0x02,0x43,0x93,0x02,0x00,0x92,0x02,0x55,0x93,0x02,0x00,0xB2,0x02,
+    0x42,0xB3,0x02,0x06,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x92,0x02,
+    0x93,0x02,0x87,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x44,0x92,0x02,0x58,0x93,0x02,
+    0x07,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0x91,0x02,0xB2,
+    0x02,0x45,0x92,0x02,0x00,0x93,0x02,0x86,0x03,0x92,0x02,0xB4,0x02,0xEF,0x01,0xDA,
+    0x7D,0x7F,0x16,0xFF,0xFF,0x00,0xDF,0xFF,0x44,0xFF,0xFF,0x01,0x9A,0x6D,0xF0,0x01,
+    0x81,0x01,0xB2,0x02,0xB2,0x02,0x4C,0x92,0x02,0x02,0x93,0x02,0x10,0x02,0x5A,0x6D,
+    0x72,0xFF,0xFF,0xA7,0x05,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x30,0x02,0x74,
+    0x13,0xA2,0x03,0x1B,0xB7,0x72,0x02,0xF0,0x01,0x94,0x1B,0x81,0x02,0xFF,0xF7,0xFF,
+    0xFF,0xDF,0xFF,0x59,0xFF,0xFF,0x81,0x00,0xFF,0xF7,0x81,0x13,0x9D,0xE7,0xB1,0x02,
+    0xD0,0x01,0xDD,0xAE,0xFF,0xFF,0x33,0x13,0xD2,0x0A,0xFF,0xFF,0x5D,0xCF,0xCF,0x01,
+    0x17,0x2C,0xFF,0xFF,0x3A,0x96,0x6F,0x01,0xB9,0x44,0xBF,0xEF,0x50,0x02,0xFC,0xBE,
+    0xFF,0xFF,0xDF,0xFF,0x51,0xFF,0xFF,0x05,0x1C,0xC7,0x51,0x02,0x73,0x02,0x71,0x02,
+    0x51,0x02,0x1E,0xCF,0x94,0x05,0xD9,0x7D,0xF0,0x01,0x92,0x02,0x92,0x02,0xB3,0x02,
+    0x93,0x02,0x48,0x92,0x02,0x81,0x02,0x72,0x02,0xB3,0x02,0x5E,0xD7,0xBF,0x04,0x05,
+    0x92,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x11,0x02,0xB8,0x4C,0x89,0x00,0xDD,0xB6,
+    0x83,0x00,0xB3,0x02,0x99,0x01,0x7C,0x9E,0x32,0x02,0x42,0xB2,0x02,0x4C,0x92,0x02,
+    0x02,0xB2,0x02,0x10,0x02,0x16,0x2C,0xBF,0x42,0x04,0xBD,0xB6,0x71,0x02,0x93,0x02,
+    0x92,0x02,0xB2,0x02,0xA9,0xC2,0x42,0xB2,0x02,0x81,0x00,0x93,0x02,0x43,0xB2,0x02,
+    0x01,0x92,0x02,0xB2,0x02,0x59,0x92,0x02,0x04,0xB2,0x02,0x93,0x02,0x93,0x02,0xB3,
+    0x02,0xB2,0x02,0x49,0x92,0x02,0x07,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x58,0x92,0x02,0x02,0xB2,0x02,0xB3,0x02,0x93,
+    0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x81,0x00,0x93,0x02,0x83,0x00,0xB2,0x02,0x81,
+    0x42,0xB2,0x02,0x82,0x02,0xB3,0x02,0x11,0x02,0x7A,0xA6,0x7F,0x1C,0xFF,0xFF,0x00,
+    0x18,0x65,0x83,0x03,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x4A,0x92,0x02,0x01,
+    0x10,0x02,0xFA,0x5C,0xB2,0xA7,0x06,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x72,
+    0x02,0x51,0x02,0xDB,0xAE,0x9E,0x07,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xF7,0x54,0x11,
+    0x02,0x91,0x02,0x71,0x02,0xDD,0xBE,0x9D,0xC1,0x82,0x11,0x98,0x6D,0x6E,0x01,0x75,
+    0x13,0xFF,0xFF,0x5D,0xD7,0xCD,0x01,0xB9,0x6D,0xFF,0xFF,0x98,0x44,0xAE,0x01,0xFD,
+    0xC6,0xFF,0xFF,0xB3,0x13,0xB0,0x01,0xDE,0xBE,0xFF,0xFF,0x5C,0x86,0xBF,0xFF,0x53,
+    0xFF,0xFF,0x05,0xB6,0x3C,0xF0,0x01,0x93,0x02,0xB2,0x02,0xF0,0x01,0x57,0x34,0x55,
+    0xFF,0xFF,0x04,0x13,0x13,0x31,0x02,0x91,0x0A,0xB2,0x02,0xB3,0x02,0x49,0x92,0x02,
+    0x02,0xB2,0x02,0x52,0x02,0x92,0x02,0xBF,0x03,0x07,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x31,0x02,0xB7,0x4C,0x89,0x01,0xDC,0xBE,0x52,0x02,
+    0x81,0x00,0xB3,0x02,0x48,0x92,0x02,0x91,0x05,0x39,0x5D,0xF2,0x01,0xB1,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x89,0x04,0x93,0x02,0x92,0x02,0x92,0x02,0x72,0x02,0x13,
+    0x0B,0xBF,0x43,0x01,0x51,0x02,0x72,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0xA9,0x42,
+    0xB2,0x02,0x06,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,
+    0x02,0x56,0x92,0x02,0x00,0xB2,0x02,0x46,0x92,0x02,0x03,0xB2,0x02,0xB2,0x02,0x92,
+    0x02,0xB2,0x02,0x49,0x92,0x02,0x06,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB3,
+    0x02,0xB2,0x02,0x93,0x02,0x47,0xB2,0x02,0x8F,0x04,0x93,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0x82,0x49,0x92,0x02,0x84,0x03,0xB2,0x02,0x72,0x02,0xD3,0x02,
+    0x7E,0xDF,0xBF,0x1A,0x02,0xDF,0xFF,0xFF,0xFF,0x59,0x5D,0x81,0x00,0xB2,0x02,0x81,
+    0xC1,0x89,0x03,0x93,0x02,0x93,0x02,0x30,0x02,0x19,0x55,0xB2,0x9D,0x00,0xB2,0x02,
+    0x88,0x06,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x94,0x02,0xF0,0x01,0xF8,0x4C,
+    0x61,0xFF,0xFF,0x06,0x34,0x13,0x12,0x02,0xB2,0x02,0xF1,0x01,0xD8,0x4C,0xFF,0xFF,
+    0xFE,0xFF,0x60,0xFF,0xFF,0x0D,0x77,0x13,0x8F,0x01,0xD9,0x75,0xFF,0xFF,0x57,0x2C,
+    0x11,0x02,0xFF,0xEF,0xFE,0xFF,0x50,0x02,0x33,0x0B,0xFF,0xFF,0x3E,0xCF,0xCF,0x01,
+    0x74,0x1B,0x43,0xFF,0xFF,0x00,0xFE,0xFF,0x8F,0x09,0xDF,0xFF,0xFF,0xFF,0x5E,0xE7,
+    0xD2,0x02,0x71,0x02,0x93,0x02,0x92,0x02,0x73,0x02,0x72,0x02,0x3D,0xCF,0x94,0x04,
+    0xD9,0x75,0xF1,0x01,0x93,0x02,0xB3,0x02,0xB2,0x02,0x4A,0x92,0x02,0x00,0x72,0x02,
+    0xBF,0x05,0x01,0xB2,0x02,0x92,0x02,0x81,0x02,0x92,0x02,0x11,0x02,0xB8,0x4C,0x89,
+    0x01,0xDC,0xB6,0x71,0x02,0x81,0x49,0x92,0x02,0x91,0x04,0xF6,0x23,0x12,0x02,0xB1,
+    0x02,0x92,0x02,0x93,0x02,0x49,0x92,0x02,0x06,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,
+    0x02,0x93,0x02,0x31,0x02,0xBB,0xB6,0xBF,0x41,0x05,0xBC,0xB6,0x72,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x4A,0x92,0x02,0x9E,0x00,0xB2,0x02,0x43,0x92,0x02,
+    0x01,0xB2,0x02,0xB2,0x02,0x44,0x92,0x02,0x00,0xB2,0x02,0x91,0x47,0xB2,0x02,0x07,
+    0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,
+    0x49,0x92,0x02,0x05,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x57,0x92,0x02,0x08,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0x93,0x02,0x92,0x02,0xB2,0x02,0x86,0x00,0xB2,0x02,0x84,0x03,0x93,0x02,0xB2,0x02,
+    0x31,0x02,0xB5,0x13,0x4F,0xFF,0xFF,0x00,0xDF,0xFF,0x7F,0x0C,0xFF,0xFF,0x03,0x39,
+    0x5D,0xF0,0x01,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x89,0xC1,0x00,
+    0x10,0x02,0xB3,0x96,0x00,0x95,0x44,0x86,0x00,0xB2,0x02,0x48,0x92,0x02,0x05,0xB2,
+    0x02,0x91,0x02,0xB2,0x02,0x93,0x02,0x30,0x02,0x55,0x13,0xA0,0x06,0xBB,0x9E,0x51,
+    0x02,0x92,0x02,0x93,0x02,0x31,0x02,0x32,0x0B,0xBF,0xF7,0x60,0xFF,0xFF,0x14,0xBB,
+    0x9E,0xF0,0x01,0xB4,0x0A,0xFE,0xFF,0xFF,0xF7,0x11,0x02,0x57,0x34,0xFF,0xFF,0xBA,
+    0x7D,0x8C,0x01,0x1B,0x86,0xFF,0xFF,0x97,0x3C,0x6F,0x01,0x1C,0x8E,0xFF,0xFF,0xDE,
+    0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x8E,0x0B,0xFF,0xF7,0xFF,0xFF,0x39,
+    0x5D,0x10,0x02,0x92,0x02,0x93,0x02,0x91,0x02,0x92,0x02,0x11,0x02,0x57,0x34,0xFF,
+    0xFF,0xDE,0xFF,0x90,0x06,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x14,0x0B,0x11,0x02,0xB2,
+    0x02,0x93,0x02,0x87,0x00,0xB2,0x02,0x81,0x00,0x52,0x02,0xBF,0x05,0xC2,0x03,0xB3,
+    0x02,0xB2,0x02,0x11,0x02,0xB7,0x4C,0x89,0x02,0xDD,0xB6,0x52,0x02,0x92,0x02,0x81,
+    0x00,0x93,0x02,0x98,0x02,0xFF,0xEF,0xF4,0x0A,0x52,0x02,0x4C,0x92,0x02,0x81,0x04,
+    0x92,0x02,0xB2,0x02,0xB3,0x02,0xD0,0x01,0x57,0x65,0xBF,0x41,0x03,0xBD,0xB6,0x52,
+    0x02,0x92,0x02,0x92,0x02,0x42,0xB2,0x02,0xA7,0x00,0xB2,0x02,0x83,0x0A,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0x56,0x92,0x02,0x00,0x93,0x02,0x42,0x92,0x02,0x03,0xB3,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x48,0x92,0x02,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,
+    0x42,0x92,0x02,0x00,0xB2,0x02,0x58,0x92,0x02,0x81,0x03,0x93,0x02,0x92,0x02,0xB2,
+    0x02,0xB2,0x02,0x81,0xC5,0x42,0xB2,0x02,0x08,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,0xEF,0x01,0xB6,0x44,0x53,0xFF,0xFF,0x00,0xFE,
+    0xFF,0xBF,0x0E,0x01,0xB2,0x02,0xB2,0x02,0x4A,0x92,0x02,0x01,0x93,0x02,0x11,0x02,
+    0xB3,0x96,0x00,0xB6,0x4C,0x83,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x89,0x06,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x52,0x02,0x52,0x02,0xDB,0xA6,0x9F,0x01,0xD7,
+    0x3C,0xF0,0x01,0x81,0x04,0x92,0x02,0x30,0x02,0x1C,0x8E,0xFF,0xFF,0xFE,0xFF,0x9B,
+    0x00,0xDF,0xFF,0x81,0x15,0x56,0x24,0x6C,0x01,0xD8,0x44,0xFF,0xFF,0x9A,0x65,0xCF,
+    0x01,0x3D,0xD7,0xFF,0xFF,0x14,0x0B,0x72,0x02,0xFF,0xFF,0xFF,0xF7,0x51,0x02,0xF2,
+    0x02,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,
+    0xF7,0x4E,0xFF,0xFF,0x09,0xFF,0xF7,0x34,0x0B,0x11,0x02,0x93,0x02,0xB2,0x02,0x92,
+    0x02,0x93,0x02,0x71,0x02,0x51,0x02,0x3D,0xC7,0x51,0xFF,0xFF,0x82,0x03,0x9A,0x75,
+    0xEF,0x01,0x93,0x02,0xB2,0x02,0x8A,0x02,0x72,0x02,0xB2,0x02,0x3E,0xD7,0xBF,0x02,
+    0xC1,0x82,0x02,0x92,0x02,0x11,0x02,0xD8,0x44,0x81,0x00,0xDF,0xFF,0x87,0x01,0x51,
+    0x02,0x72,0x02,0x81,0x00,0xB2,0x02,0x98,0x03,0xBD,0xA6,0x32,0x02,0x91,0x02,0xB2,
+    0x02,0x81,0x00,0x93,0x02,0x87,0x00,0xB2,0x02,0x42,0x92,0x02,0x03,0x93,0x02,0x93,
+    0x02,0xF0,0x01,0x36,0x24,0xBF,0x41,0x04,0xDD,0xB6,0x71,0x02,0x92,0x02,0x93,0x02,
+    0x92,0x02,0xA9,0xC7,0x01,0xB2,0x02,0xB2,0x02,0x44,0x92,0x02,0x52,0xB2,0x02,0x82,
+    0x43,0xB2,0x02,0x42,0x92,0x02,0x81,0x01,0x92,0x02,0xB2,0x02,0x87,0x00,0x93,0x02,
+    0x42,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0x49,0x92,0x02,0x4F,0xB2,0x02,0x00,0x93,
+    0x02,0x45,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0x85,0x46,0x92,0x02,0x03,0xB2,0x02,
+    0x93,0x02,0x0F,0x02,0x5A,0x9E,0x81,0x00,0xFE,0xFF,0x7F,0x1A,0xFF,0xFF,0x81,0x00,
+    0x92,0x02,0x81,0x42,0xB2,0x02,0x8B,0x01,0x10,0x02,0x19,0x5D,0xB2,0x96,0x00,0xD6,
+    0x4C,0x82,0xC1,0x81,0xC8,0x07,0x93,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,
+    0x93,0x02,0xF0,0x01,0xD7,0x4C,0x84,0x00,0xDF,0xFF,0x98,0x0A,0xDE,0xF7,0x12,0x0B,
+    0x53,0x02,0xB2,0x02,0x92,0x02,0x72,0x02,0xF1,0x01,0x37,0x2C,0xFF,0xFF,0xFF,0xFF,
+    0xDF,0xFF,0x98,0x12,0xFF,0xF7,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0x5C,0xD7,0x30,0x02,
+    0x31,0x02,0x5D,0xD7,0xFF,0xFF,0xD2,0x0A,0x33,0x13,0xFF,0xFF,0xBC,0xB6,0x8E,0x01,
+    0xB9,0x44,0xFF,0xFF,0x99,0x75,0x6F,0x01,0x9A,0x65,0x82,0xD3,0x09,0xFB,0x85,0x0F,
+    0x02,0x93,0x02,0x93,0x02,0xB3,0x02,0x94,0x02,0x92,0x02,0x92,0x02,0xF0,0x01,0x57,
+    0x3C,0x90,0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x08,0xDE,0xFF,0x32,0x13,0x11,0x02,0xB2,
+    0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x81,0x00,0x93,0x02,0x81,
+    0x03,0xB2,0x02,0x72,0x02,0x92,0x02,0x5E,0xD7,0xBF,0x02,0x04,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0x81,0x00,0xD7,0x4C,0x49,0xFF,0xFF,0x83,0x00,0xB2,
+    0x02,0x48,0x92,0x02,0x8E,0x08,0xDF,0xFF,0xFF,0xFF,0x79,0x65,0xF1,0x01,0x90,0x02,
+    0x93,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x87,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,
+    0x81,0x03,0x72,0x02,0x71,0x02,0xF3,0x0A,0xBE,0xF7,0xBF,0x40,0x05,0x3E,0xCF,0x51,
+    0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x72,0x02,0xA1,0x04,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0x93,0x02,0x92,0x02,0x61,0xB2,0x02,0x46,0x92,0x02,0x82,0x04,0xB3,0x02,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x4B,0x92,0x02,0x01,0x93,0x02,0x92,0x02,0x81,
+    0x00,0x93,0x02,0x81,0x01,0xB2,0x02,0xB2,0x02,0x93,0xC7,0x45,0x92,0x02,0x0D,0xB2,
+    0x02,0x93,0x02,0xB3,0x02,0x93,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0x11,0x02,0x14,0x0B,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0x7F,0x1B,0xFF,0xFF,0x81,
+    0x42,0xB2,0x02,0x01,0x92,0x02,0x92,0x02,0x8B,0x02,0xB2,0x02,0x10,0x02,0x19,0x55,
+    0xB2,0x96,0x02,0x17,0x55,0xF0,0x01,0x73,0x02,0x81,0x00,0x93,0x02,0x81,0x00,0xB2,
+    0x02,0x87,0x08,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB1,0x02,0xB3,0x02,0x12,
+    0x02,0x34,0x13,0xFF,0xF7,0x81,0x02,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0x98,0x0D,0x5B,
+    0x96,0x11,0x02,0x91,0x02,0x91,0x02,0xB3,0x02,0x72,0x02,0x53,0x02,0x91,0x02,0x7D,
+    0xDF,0xFF,0xFF,0xFF,0xF7,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x94,0x13,0xDF,0xFF,0xFF,
+    0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x18,0x4D,0x6F,0x01,0xF6,0x23,0xFF,0xFF,0x7D,
+    0xAE,0xAF,0x01,0x5C,0x96,0xFF,0xFF,0xF5,0x23,0xCF,0x01,0x7D,0xDF,0xFF,0xFF,0x12,
+    0x0B,0x31,0x02,0xBF,0xE7,0x92,0x00,0xFE,0xFF,0x82,0x03,0x95,0x1B,0x12,0x02,0xB2,
+    0x02,0xB2,0x02,0x42,0x92,0x02,0x05,0xB2,0x02,0x53,0x02,0x71,0x02,0x5C,0xC7,0xFF,
+    0xFF,0xDF,0xFF,0x82,0x02,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0x8B,0x05,0xFF,0xFF,0x79,
+    0x6D,0xF1,0x01,0x93,0x02,0xB2,0x02,0xB3,0x02,0x42,0x92,0x02,0x02,0x93,0x02,0x93,
+    0x02,0xB2,0x02,0xBF,0x39,0x03,0x36,0x34,0xF0,0x01,0x91,0x02,0x93,0x02,0x42,0xB2,
+    0x02,0x87,0x09,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x92,
+    0x02,0x30,0x02,0x9B,0xA6,0xDF,0xFF,0x9D,0x07,0xF8,0x4C,0x58,0x2C,0x77,0x3C,0x97,
+    0x3C,0x78,0x3C,0x77,0x3C,0x97,0x34,0x77,0x3C,0x7F,0x18,0x97,0x3C,0x01,0xB8,0x3C,
+    0x16,0x2C,0x42,0x92,0x02,0x01,0x93,0x02,0xB2,0x02,0x4A,0x92,0x02,0x93,0x02,0x5E,
+    0xD7,0xB2,0x02,0x52,0x02,0x42,0x93,0x02,0x03,0xB2,0x02,0x93,0x02,0x93,0x02,0x92,
+    0x02,0x5F,0x93,0x02,0x0F,0xB2,0x02,0xB3,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0xB3,
+    0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,0x74,0x0A,0xB2,0x02,0x91,
+    0x02,0x93,0x02,0x93,0x02,0x87,0x0E,0xB2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x93,
+    0x02,0xB1,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x93,
+    0x02,0x93,0x02,0x92,0x02,0x5C,0x93,0x02,0x05,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0x72,0x02,0x42,0x93,0x02,0x03,0x92,0x02,0xB3,0x02,0xAF,0x01,0x78,
+    0x3C,0x7F,0x1E,0xFF,0xFF,0xBF,0x09,0x96,0x08,0x78,0x65,0x11,0x02,0x93,0x02,0xB2,
+    0x02,0x92,0x02,0x73,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x88,0x09,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0x94,0x02,0x72,0x02,0x30,0x02,0x9C,0xAE,0xFF,0xFF,0xFF,
+    0xF7,0x81,0xC1,0x00,0xDF,0xFF,0x96,0x0B,0x55,0x3C,0xF1,0x01,0xB2,0x02,0x92,0x02,
+    0x93,0x02,0x92,0x02,0x93,0x02,0xEF,0x01,0x59,0x75,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0x56,0xFF,0xFF,0x12,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0xD4,0x0A,
+    0xD0,0x01,0x5A,0x9E,0xFF,0xFF,0xB5,0x13,0x71,0x02,0xFF,0xFF,0xBE,0xE7,0xCE,0x01,
+    0xB6,0x1B,0xFF,0xFF,0x9B,0xAE,0x8F,0x01,0x76,0x3C,0x53,0xFF,0xFF,0x81,0x05,0xDF,
+    0xFF,0xBC,0xAE,0x51,0x02,0x73,0x02,0xB2,0x02,0xB3,0x02,0x81,0x0A,0xB3,0x02,0x92,
+    0x02,0x92,0x02,0xD0,0x01,0x96,0x3C,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xFE,
+    0xFF,0xDF,0xFF,0x89,0xC1,0x0D,0xFE,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xEF,0xD2,0x0A,
+    0x31,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x94,0x02,0x73,0x02,0x93,0x02,0x92,0x02,
+    0x93,0x02,0xBF,0x37,0xC1,0x05,0x34,0x13,0x31,0x02,0x93,0x02,0x93,0x02,0x92,0x02,
+    0x92,0x02,0x88,0x08,0x92,0x02,0xB2,0x02,0x93,0x02,0xB1,0x02,0x92,0x02,0x94,0x02,
+    0xB3,0x02,0xEF,0x01,0x78,0x65,0x5E,0xFF,0xFF,0x03,0xB1,0x0A,0x8F,0x01,0xF0,0x01,
+    0xEF,0x01,0x7F,0x1C,0xF0,0x01,0x05,0x0F,0x02,0x11,0x02,0x92,0x02,0xB2,0x02,0xB2,
+    0x02,0x92,0x02,0x9F,0x09,0x3D,0xDF,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xB3,
+    0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x5F,0xB2,0x02,0x46,0x92,0x02,0x06,
+    0x93,0x02,0x93,0x02,0x91,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x49,0x92,
+    0x02,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x81,0x04,0x92,0x02,0x93,0x02,0xB3,0x02,
+    0x93,0x02,0xB2,0x02,0x43,0x92,0x02,0x01,0xB2,0x02,0x92,0x02,0x57,0xB2,0x02,0x49,
+    0x92,0x02,0x06,0xB2,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x13,0x02,0x71,0x02,0x7D,
+    0xCF,0xBF,0x67,0x96,0x01,0xB9,0x7D,0x31,0x02,0x90,0xC1,0x04,0x93,0x02,0x73,0x02,
+    0xB1,0x02,0x10,0x02,0xD9,0x4C,0x81,0x03,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,
+    0x56,0xFF,0xFF,0x09,0x9F,0xEF,0xF1,0x0A,0x33,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0xB3,0x02,0x92,0x02,0x31,0x02,0x75,0x1B,0x58,0xFF,0xFF,0x01,0xFF,0xF7,0xFF,0xFF,
+    0x82,0x10,0xDA,0x8D,0x8F,0x01,0x54,0x13,0xFF,0xFF,0x7D,0xE7,0x0F,0x02,0xD9,0x5C,
+    0xFF,0xFF,0x18,0x4D,0x8F,0x01,0x9C,0xAE,0xFF,0xFF,0xB5,0x1B,0xD0,0x01,0x3D,0xC7,
+    0xFF,0xFF,0xFE,0xFF,0x91,0x0F,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0x36,0x2C,0xF0,0x01,
+    0xB1,0x02,0x72,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x91,0x02,
+    0x71,0x02,0x71,0x02,0x5D,0xD7,0x81,0x01,0xFF,0xFF,0x9F,0xFF,0x4D,0xFF,0xFF,0x09,
+    0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0x79,0x6D,0xF0,0x01,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x94,0x02,0x93,0x02,0x42,0x92,0x02,0xBF,0x38,0x03,0x1D,0xCF,0x72,0x02,0x72,0x02,
+    0x93,0x02,0x4C,0x92,0x02,0x42,0xB2,0x02,0x04,0x92,0x02,0x93,0x02,0xB2,0x02,0xF0,
+    0x01,0x15,0x2C,0x9E,0x07,0x32,0x13,0x32,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,0x93,
+    0x02,0xB2,0x02,0xB2,0x02,0x7F,0x1A,0x92,0x02,0x05,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0xB3,0x02,0x92,0x02,0xB2,0x02,0x9D,0x03,0x5E,0xDF,0x93,0x02,0x72,0x02,0xB1,0x02,
+    0x81,0x63,0x92,0x02,0x03,0x93,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x81,0x09,0x93,
+    0x02,0x93,0x02,0xD3,0x02,0xB3,0x02,0x71,0x02,0x91,0x02,0xB2,0x02,0x93,0x02,0x92,
+    0x02,0xB2,0x02,0x88,0x09,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x95,0x02,0x92,
+    0x02,0xB1,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x61,0x92,0x02,0x42,0x93,0x02,0x0B,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x10,0x02,0x10,0x02,0x3A,0x96,
+    0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xBF,0x64,0x96,0x01,0xFA,0x8D,0x30,0x02,
+    0x42,0x92,0x02,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x88,0x01,0x93,0x02,0x92,0x02,
+    0x81,0x04,0x92,0x02,0x92,0x02,0xB2,0x02,0x32,0x02,0x35,0x13,0x42,0xFF,0xFF,0x81,
+    0xD3,0x00,0xFF,0xF7,0x82,0x02,0xDA,0x85,0x2F,0x02,0x94,0x02,0x82,0x07,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x71,0x02,0xDD,0xBE,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0x94,0x00,
+    0xFE,0xFF,0x43,0xFF,0xFF,0x0E,0xB5,0x1B,0x8F,0x01,0x39,0x6D,0xFF,0xFF,0xD7,0x3C,
+    0xEF,0x01,0x9F,0xEF,0xFF,0xFF,0x72,0x02,0xF3,0x0A,0xFF,0xFF,0x7E,0xE7,0xD0,0x01,
+    0xB5,0x1B,0xFF,0xFF,0x92,0x10,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7D,0xCF,0x71,0x02,
+    0x73,0x02,0xD1,0x02,0x93,0x02,0x91,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0xB1,0x02,
+    0x93,0x02,0xB3,0x02,0xD1,0x01,0x97,0x3C,0x4E,0xFF,0xFF,0x02,0xDF,0xFF,0xFF,0xEF,
+    0xFE,0xFF,0x81,0x06,0xFE,0xFF,0xBF,0xF7,0xD3,0x0A,0x52,0x02,0xB2,0x02,0x91,0x02,
+    0x91,0x02,0x42,0xB2,0x02,0xBF,0x39,0x07,0xB9,0x7D,0x31,0x02,0x73,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x49,0x92,0x02,0x07,0xB2,0x02,0xB3,0x02,
+    0x93,0x02,0x91,0x02,0x92,0x02,0x52,0x02,0xF3,0x0A,0x9E,0xF7,0x9D,0x06,0x52,0x13,
+    0x31,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x7F,0x19,0xB2,0x02,
+    0x02,0xB3,0x02,0x92,0x02,0x93,0x02,0x42,0x92,0x02,0x01,0x93,0x02,0x93,0x02,0x9D,
+    0x08,0x7D,0xD7,0x95,0x02,0x53,0x02,0x92,0x0A,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,
+    0x02,0xB3,0x02,0x61,0x93,0x02,0x00,0xB3,0x02,0x42,0x93,0x02,0x09,0xB3,0x02,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x91,0x02,0xB3,0x02,0x93,0x02,0xB3,
+    0x02,0x48,0x92,0x02,0x04,0xB2,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x72,0x02,0x81,
+    0x07,0xB2,0x02,0x93,0x02,0x92,0x02,0x94,0x02,0x93,0x02,0x93,0x02,0xB3,0x02,0xB3,
+    0x02,0x58,0x93,0x02,0x0F,0xB3,0x02,0x93,0x02,0x93,0x02,0xB3,0x02,0xB3,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x91,0x02,0x11,0x02,0xD0,0x01,0xD3,
+    0x12,0x7B,0xA6,0xFF,0xFF,0x81,0x00,0xDE,0xFF,0x7F,0x1C,0xFF,0xFF,0xBF,0x09,0x96,
+    0x01,0x5B,0xAE,0x51,0x02,0x82,0x03,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x87,
+    0x09,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x72,
+    0x02,0x30,0x02,0xBD,0xAE,0x57,0xFF,0xFF,0x01,0xDF,0xFF,0xBF,0xFF,0x81,0x0C,0x15,
+    0x2C,0xF1,0x01,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0xB3,
+    0x02,0xF0,0x01,0xD9,0x44,0xFF,0xFF,0xFF,0xFF,0x99,0x10,0xFC,0xC6,0x51,0x02,0xF0,
+    0x01,0x18,0x4D,0xDF,0xFF,0x51,0x02,0xD6,0x23,0xFF,0xFF,0x39,0x8E,0x6F,0x01,0x99,
+    0x6D,0xFF,0xFF,0xF7,0x44,0x8D,0x01,0x9C,0x9E,0xFF,0xFF,0xDF,0xFF,0x51,0xFF,0xFF,
+    0x82,0x14,0xF7,0x4C,0xF0,0x01,0x92,0x02,0x94,0x02,0x93,0x02,0xB1,0x02,0xB2,0x02,
+    0x93,0x02,0x91,0x02,0xB3,0x02,0x94,0x02,0x92,0x0A,0x51,0x02,0x93,0x02,0x5D,0xCF,
+    0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,0xFF,0xFF,0xDE,0xFF,0xFE,0xFF,0x88,0x45,0xFF,0xFF,
+    0x06,0x58,0x6D,0x10,0x02,0xB3,0x02,0x94,0x02,0xB1,0x02,0xB1,0x02,0x93,0x02,0xBF,
+    0x3A,0x07,0x97,0x3C,0xF0,0x01,0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,
+    0x93,0x02,0x4A,0x92,0x02,0x00,0xB2,0x02,0x81,0x03,0x72,0x02,0xB4,0x02,0x10,0x02,
+    0x9C,0xAE,0x9E,0x02,0x32,0x02,0xB3,0x02,0xB3,0x02,0x43,0x93,0x02,0x7F,0x18,0x92,
+    0x02,0x07,0x93,0x02,0x72,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,
+    0xB2,0x02,0x9D,0x04,0x3D,0xD7,0x52,0x02,0xF1,0x01,0x11,0x02,0x11,0x02,0x6C,0x31,
+    0x02,0x07,0x12,0x02,0x11,0x02,0x52,0x02,0xB3,0x02,0x72,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x48,0x92,0x02,0x0A,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x51,0x02,0x31,0x02,
+    0x52,0x02,0x12,0x02,0x11,0x02,0x31,0x02,0x31,0x02,0x11,0x02,0x61,0x31,0x02,0x0A,
+    0x11,0x02,0x11,0x02,0xF0,0x01,0xF1,0x01,0x91,0x02,0x11,0x23,0x59,0x6D,0xDE,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0x7F,0x1E,0xFF,0xFF,0xBF,0x09,0x96,0x02,0xFD,0xCE,
+    0x92,0x02,0x71,0x02,0x83,0x00,0xB2,0x02,0x88,0xC1,0x00,0x94,0x02,0x42,0x92,0x02,
+    0x03,0x93,0x02,0x92,0x02,0xEF,0x01,0xD9,0x44,0x81,0x00,0xFF,0xF7,0x55,0xFF,0xFF,
+    0x0E,0xDF,0xFF,0xFF,0xFF,0x5E,0xD7,0x92,0x02,0x72,0x02,0xB2,0x02,0x93,0x02,0x93,
+    0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x30,0x02,0x14,0x0B,0xFF,0xEF,0x5A,
+    0xFF,0xFF,0x0E,0x97,0x3C,0xD0,0x01,0x31,0x02,0x95,0x13,0x78,0x5D,0xEF,0x01,0xDD,
+    0xBE,0xFF,0xFF,0x33,0x13,0x30,0x02,0xFF,0xF7,0xFF,0xFF,0x71,0x02,0x13,0x13,0xFF,
+    0xFF,0x93,0xC1,0x13,0xDE,0xEF,0xB3,0x0A,0x71,0x02,0xB1,0x02,0x73,0x02,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0xD1,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0xB3,0x02,
+    0xCF,0x01,0xB8,0x3C,0xFF,0xFF,0xDE,0xFF,0xFF,0xF7,0xFF,0xF7,0x4E,0xFF,0xFF,0x0A,
+    0xDF,0xFF,0xFF,0xFF,0xDF,0xEF,0xF1,0x0A,0x51,0x02,0x95,0x02,0x93,0x02,0xB2,0x02,
+    0x73,0x02,0x92,0x02,0x93,0x02,0xBF,0x38,0x01,0x75,0x13,0x31,0x02,0x81,0x02,0x92,
+    0x02,0x93,0x02,0xB2,0x02,0x49,0x92,0x02,0x08,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,
+    0x02,0xB2,0x02,0x93,0x02,0xB3,0x02,0xF0,0x01,0x7A,0x5D,0x9E,0x04,0x31,0x02,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0x91,0x02,0xBF,0x1A,0xC1,0x81,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0x9E,0x07,0x9D,0xE7,0xB2,0x1B,0x72,0x1B,0x93,0x1B,0x94,0x23,0x93,0x23,
+    0x93,0x1B,0x93,0x1B,0x62,0x93,0x23,0x00,0x73,0x23,0x42,0x93,0x23,0x07,0x73,0x23,
+    0x93,0x23,0x94,0x1B,0x74,0x23,0x93,0x2B,0x73,0x1B,0x94,0x02,0x73,0x02,0x81,0x00,
+    0x93,0x02,0x4B,0x92,0x02,0x05,0x13,0x0B,0x72,0x2B,0xB3,0x1B,0x74,0x1B,0x73,0x23,
+    0x93,0x1B,0x5D,0x93,0x23,0x00,0x73,0x23,0x42,0x93,0x23,0x0F,0x94,0x23,0x73,0x1B,
+    0xB4,0x23,0x36,0x34,0xF9,0x54,0xFC,0x7D,0x3C,0xBF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xDE,0xFF,0xFE,0xFF,0xDF,0xFF,0xBF,0xFF,0xFF,0xFF,0xFE,0xFF,0xBF,0x64,0x96,0x06,
+    0x9F,0xE7,0xF4,0x0A,0x51,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x4A,0x92,
+    0x02,0x03,0xB2,0x02,0x93,0x02,0xB2,0x02,0xB1,0x02,0x42,0x93,0x02,0x06,0x31,0x02,
+    0x52,0x13,0xFF,0xF7,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x92,0x00,0xFE,0xFF,
+    0x81,0x03,0x59,0x7D,0xF0,0x01,0x92,0x02,0xB1,0x02,0x81,0x06,0x92,0x02,0xB3,0x02,
+    0xB2,0x02,0x92,0x02,0x92,0x02,0x30,0x02,0xFB,0x8D,0x96,0x00,0xFE,0xFF,0x81,0x12,
+    0xBE,0xEF,0xB3,0x02,0x71,0x02,0xB3,0x02,0x94,0x02,0xF0,0x01,0x94,0x1B,0xFF,0xFF,
+    0x1D,0xC7,0x90,0x01,0x77,0x34,0xFF,0xFF,0x1A,0x7E,0x6E,0x01,0xBB,0x85,0xFF,0xFF,
+    0xFE,0xFF,0xFE,0xFF,0xFF,0xF7,0x8E,0x00,0xDF,0xFF,0x82,0x12,0x7A,0x75,0x10,0x02,
+    0x94,0x02,0xB3,0x02,0x91,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,
+    0x71,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x72,0x02,0x72,0x02,0xDB,0xB6,0xFF,0xFF,
+    0xFF,0xFF,0x8A,0x01,0xFF,0xF7,0xDF,0xFF,0x81,0x0B,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0x5C,0x96,0x50,0x02,0x71,0x02,0x73,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,
+    0x92,0x02,0xBF,0x37,0x06,0x5D,0xDF,0x72,0x02,0x51,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0x89,0x00,0x93,0x02,0x81,0x06,0x93,0x02,0x92,0x02,0xB2,0x02,0x94,
+    0x02,0x91,0x02,0x11,0x02,0xF7,0x2B,0x9D,0x03,0x32,0x13,0x32,0x02,0x93,0x02,0x92,
+    0x02,0x42,0xB2,0x02,0x7F,0x19,0x92,0x02,0x06,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0x4A,0x92,0x02,0x93,0xC3,0x00,0xFE,0xFF,0x6E,
+    0xFF,0xFF,0x04,0x3C,0xC7,0x92,0x02,0x93,0x02,0x91,0x02,0xB2,0x02,0x49,0x92,0x02,
+    0x03,0xB2,0x02,0x92,0x02,0x10,0x02,0x19,0x4D,0x6F,0xFF,0xFF,0x00,0xDF,0xFF,0x42,
+    0xFF,0xFF,0x01,0xFE,0xFF,0xFE,0xFF,0x7F,0x1C,0xFF,0xFF,0xBF,0x09,0x96,0x04,0xDF,
+    0xFF,0x54,0x13,0x10,0x02,0x93,0x02,0xB2,0x02,0x81,0x01,0x93,0x02,0xB2,0x02,0x4F,
+    0x92,0x02,0x02,0x72,0x02,0x51,0x02,0xDC,0xA6,0x56,0xFF,0xFF,0x06,0xDF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xD5,0x1B,0x10,0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x05,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x10,0x02,0xF8,0x2B,0x97,0x13,0xDF,0xFF,0xFF,
+    0xFF,0x79,0x65,0xF1,0x01,0x93,0x02,0xB1,0x02,0x73,0x02,0xF2,0x01,0x3B,0x8E,0xFF,
+    0xFF,0x56,0x34,0xB1,0x01,0x5E,0xC7,0xFF,0xFF,0x32,0x0B,0x52,0x02,0xDF,0xF7,0xFF,
+    0xFF,0xFD,0xFF,0xFF,0xF7,0x4D,0xFF,0xFF,0x01,0xFE,0xFF,0xDF,0xFF,0x42,0xFF,0xFF,
+    0x05,0xFF,0xF7,0x54,0x13,0x12,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x81,0x00,0xB3,
+    0x02,0x81,0x08,0x92,0x02,0x92,0x02,0xB1,0x02,0x93,0x02,0xB3,0x02,0xCF,0x01,0x58,
+    0x65,0xFF,0xFF,0xFE,0xFF,0x8A,0x04,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,
+    0xF7,0x81,0x08,0x96,0x13,0x0F,0x02,0x92,0x0A,0x93,0x02,0x93,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0x93,0x02,0xBD,0x02,0x5D,0xE7,0xB0,0x0A,0x53,0x02,0x84,0x00,0x92,
+    0x02,0xA0,0x02,0x92,0x02,0xB3,0x02,0x11,0x02,0x8B,0x05,0xFA,0x85,0xEF,0x01,0x73,
+    0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0x42,0xB2,0x02,0x81,0x01,0xB2,0x02,0xB2,0x02,
+    0x82,0x0B,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,
+    0x92,0x02,0x92,0x02,0x52,0x02,0xD1,0x0A,0xDE,0xF7,0x81,0x00,0xDF,0xFF,0x98,0x08,
+    0xFE,0xFF,0x33,0x13,0x32,0x02,0xB2,0x02,0x73,0x02,0x93,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0xBF,0x19,0x06,0x93,0x02,0xB2,0x02,0xB1,0x02,0x93,0x02,0xB2,0x02,0x92,
+    0x02,0xB2,0x02,0x87,0x04,0xB2,0x02,0xB2,0x02,0x52,0x02,0xD2,0x0A,0x7F,0xD7,0x7F,
+    0x05,0xFF,0xFF,0x05,0x1D,0xC7,0x92,0x02,0x72,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0x4A,0x92,0x02,0x01,0x10,0x02,0xF8,0x4C,0x7F,0x4E,0xFF,0xFF,0x06,0xDF,0xFF,0xFF,
+    0xFF,0xDF,0xFF,0xFF,0xFF,0x19,0x5D,0xD0,0x01,0x92,0x02,0x42,0xB2,0x02,0x02,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0x89,0x00,0x93,0x02,0xB4,0x57,0xFF,0xFF,0x03,0xD4,0x1B,
+    0xF0,0x01,0x93,0x02,0xB1,0x02,0x81,0x00,0xB2,0x02,0x50,0x92,0x02,0x02,0xB2,0x02,
+    0xF0,0x01,0xD7,0x4C,0x81,0x00,0xDF,0xFF,0x55,0xFF,0xFF,0x05,0x1E,0xCF,0x91,0x02,
+    0x72,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x81,0x00,0xB3,0x02,0x82,0x02,0x72,0x02,
+    0x72,0x02,0x5E,0xDF,0x58,0xFF,0xFF,0x0D,0x53,0x1B,0x32,0x02,0x93,0x02,0x92,0x02,
+    0x71,0x02,0x92,0x02,0x9F,0xEF,0xFF,0xFF,0x30,0x02,0x93,0x13,0xFF,0xFF,0xBC,0xBE,
+    0x8E,0x01,0x18,0x45,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x52,0xFF,0xFF,0x0B,0x5A,0x8E,
+    0x2F,0x02,0x72,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,
+    0x91,0x02,0x92,0x02,0xB3,0x02,0x42,0x92,0x02,0x02,0x51,0x02,0xB3,0x0A,0x7E,0xC7,
+    0x42,0xFF,0xFF,0x01,0xFE,0xFF,0xFE,0xFF,0x49,0xFF,0xFF,0x0C,0xFE,0xFF,0xDF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0x5B,0x8E,0xF0,0x01,0x71,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,
+    0xB2,0x02,0x92,0x02,0x92,0x02,0xBE,0x00,0x7E,0xDF,0xA9,0x01,0x93,0x02,0x10,0x02,
+    0x8B,0x02,0xD7,0x4C,0xEF,0x01,0xB3,0x02,0x82,0x01,0x92,0x02,0x92,0x02,0x83,0x43,
+    0x92,0x02,0x42,0xB2,0x02,0x43,0x92,0x02,0x09,0xB2,0x02,0x92,0x02,0x93,0x02,0x30,
+    0x02,0x9B,0xB6,0xFF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x57,0xFF,0xFF,
+    0x05,0x33,0x13,0x31,0x02,0x91,0x02,0x92,0x02,0x93,0x02,0x91,0x02,0x7F,0x1B,0x92,
+    0x02,0x06,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x93,0x02,
+    0x88,0x00,0x92,0x02,0xBF,0x08,0x00,0xFC,0xC6,0x81,0x00,0x93,0x02,0x8D,0x00,0xD8,
+    0x4C,0xBF,0x4C,0x00,0xFE,0xFF,0x82,0x08,0xFF,0xFF,0xDF,0xFF,0x39,0x5D,0xF1,0x01,
+    0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0xBF,0x02,0x97,0x04,0x96,0x3C,
+    0xF1,0x01,0xB2,0x02,0xB2,0x02,0x93,0x02,0x52,0x92,0x02,0x02,0xB2,0x02,0x31,0x02,
+    0x33,0x13,0x58,0xFF,0xFF,0x02,0x38,0x5D,0xEF,0x01,0x92,0x02,0x81,0x09,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x10,0x02,
+    0x58,0x6D,0x97,0x0F,0x7B,0x9E,0x11,0x02,0x92,0x02,0x72,0x02,0x93,0x02,0x93,0x02,
+    0x0E,0x02,0x1A,0x7E,0x5B,0x86,0x6E,0x01,0x3B,0x8E,0xFF,0xFF,0xF6,0x23,0xF0,0x01,
+    0x7E,0xD7,0xFE,0xFF,0x55,0xFF,0xFF,0x07,0xD3,0x23,0xF0,0x01,0x93,0x02,0x93,0x02,
+    0x92,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x42,0x92,0x02,0x05,0x93,0x02,0xB2,0x02,
+    0x93,0x02,0xB1,0x02,0xF0,0x01,0x58,0x3C,0x4E,0xFF,0xFF,0x00,0xFE,0xFF,0x43,0xFF,
+    0xFF,0x03,0x74,0x1B,0xEF,0x01,0xB2,0x02,0xB2,0x02,0x81,0x03,0x93,0x02,0x93,0x02,
+    0x92,0x02,0x92,0x02,0xBD,0x02,0x7D,0xDF,0xB0,0x0A,0x52,0x02,0xB5,0x01,0xB4,0x1B,
+    0x31,0x02,0x82,0x00,0x93,0x02,0x89,0xC1,0x01,0x93,0x02,0xB2,0x02,0x81,0x05,0x93,
+    0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x10,0x02,0x38,0x6D,0x5C,0xFF,0xFF,0x07,0x32,
+    0x13,0x11,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0xB1,0x02,0x93,0x02,0xB2,0x02,0xBF,
+    0x18,0x00,0x93,0x02,0x42,0x92,0x02,0x43,0xB2,0x02,0xBF,0x12,0x00,0xFC,0xBE,0x83,
+    0xCB,0xBF,0x4E,0x06,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,
+    0x59,0x5D,0x83,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x4A,0x92,0x02,0xB5,0x97,0x03,
+    0x18,0x5D,0x11,0x02,0xB1,0x02,0x93,0x02,0x82,0x00,0xB2,0x02,0x50,0x92,0x02,0x02,
+    0x73,0x02,0x52,0x02,0x9C,0xAE,0x97,0x01,0x75,0x13,0x11,0x02,0x45,0x92,0x02,0x81,
+    0x00,0xB2,0x02,0x81,0x01,0x30,0x02,0x93,0x1B,0x81,0x02,0xFE,0xFF,0xFF,0xFF,0xDF,
+    0xFF,0x92,0x10,0x37,0x2C,0xF1,0x01,0xB1,0x02,0x93,0x02,0x93,0x02,0x73,0x0A,0x71,
+    0x02,0x75,0x13,0xD3,0x0A,0xD3,0x0A,0xDF,0xFF,0xBF,0xEF,0xF1,0x01,0x16,0x24,0xFF,
+    0xFF,0xDE,0xFF,0xFF,0xF7,0x93,0x07,0xFC,0xBE,0x51,0x02,0x73,0x02,0x93,0x02,0xB3,
+    0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x81,0x01,0xB3,0x02,0x73,0x02,0x82,0x04,0x93,
+    0x02,0x51,0x02,0x9B,0xA6,0xFF,0xFF,0xFE,0xFF,0x4E,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,
+    0xFF,0x7B,0x96,0x10,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x44,0x92,0x02,
+    0xBF,0x29,0x02,0xB3,0x02,0x11,0x02,0x18,0x55,0x89,0x0A,0x9D,0xEF,0xD3,0x0A,0x72,
+    0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0x48,0x92,0x02,0x03,0xB2,0x02,0xB1,0x02,0x92,0x02,0x94,0x02,0x81,0x02,0x92,
+    0x02,0xF1,0x01,0x35,0x2C,0x81,0x00,0xFF,0xF7,0x99,0x06,0x52,0x13,0x32,0x02,0x92,
+    0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x7F,0x1A,0x93,0x02,0x05,0x92,0x02,
+    0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x88,0xC1,0xBF,0x08,0x00,0xFC,
+    0xC6,0x8C,0x00,0xB2,0x02,0xBF,0x53,0x00,0xFE,0xF7,0x81,0x04,0x38,0x5D,0xD1,0x01,
+    0x92,0x02,0xB3,0x02,0xB2,0x02,0x81,0x4B,0x92,0x02,0xB5,0x97,0x00,0xFA,0x8D,0x85,
+    0x00,0xB3,0x02,0x90,0x02,0x93,0x02,0xF1,0x01,0xD6,0x4C,0x93,0x00,0xFF,0xF7,0x81,
+    0x02,0xFD,0xB6,0x31,0x02,0x52,0x02,0x81,0x00,0xB2,0x02,0x81,0x08,0xB2,0x02,0x92,
+    0x02,0x93,0x02,0x93,0x02,0x92,0x02,0xB3,0x02,0x72,0x02,0x31,0x02,0xDD,0xB6,0x55,
+    0xFF,0xFF,0x0E,0x5E,0xD7,0x72,0x02,0x50,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,
+    0x02,0xB3,0x02,0x52,0x02,0xB0,0x01,0x58,0x4D,0xFF,0xFF,0x39,0x55,0xAF,0x01,0xDD,
+    0xB6,0x42,0xFF,0xFF,0x00,0xFE,0xFF,0x92,0x08,0x76,0x3C,0x10,0x02,0x94,0x02,0x93,
+    0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x81,0x09,0x92,0x02,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0x12,0x02,0x75,0x13,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,
+    0xFF,0x8A,0x00,0xFE,0xFF,0x43,0xFF,0xFF,0x04,0x96,0x1B,0x11,0x02,0xB3,0x02,0xB2,
+    0x02,0xB2,0x02,0x45,0x92,0x02,0xBD,0x01,0x7E,0xDF,0xB0,0x02,0xA8,0x02,0x93,0x02,
+    0x10,0x02,0xF8,0x54,0x89,0x02,0x5A,0xA6,0x31,0x02,0x93,0x02,0x83,0x02,0x92,0x02,
+    0xB2,0x02,0x93,0x02,0x81,0x00,0x93,0x02,0x81,0x00,0xB2,0x02,0x44,0x92,0x02,0x07,
+    0xB1,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x72,0x02,0x33,0x02,0x12,0x0B,
+    0x5C,0xFF,0xFF,0x07,0xD1,0x0A,0xD1,0x01,0x12,0x02,0x11,0x02,0x32,0x02,0x31,0x02,
+    0x32,0x02,0x31,0x02,0x7F,0x19,0x32,0x02,0x01,0x52,0x02,0xB2,0x02,0x4E,0x92,0x02,
+    0xBF,0x17,0xC1,0xBF,0x4E,0x03,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0x81,0x03,
+    0x56,0x34,0xF1,0x01,0x92,0x02,0x93,0x02,0x82,0x00,0xB2,0x02,0xBF,0x01,0x97,0x05,
+    0x1E,0xBF,0x52,0x02,0x71,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x51,0x92,0x02,0x04,
+    0xB2,0x02,0x93,0x02,0x31,0x02,0x52,0x13,0xFF,0xF7,0x55,0xFF,0xFF,0x04,0xD8,0x54,
+    0xF0,0x01,0x92,0x02,0x92,0x02,0x93,0x02,0x84,0xC2,0x03,0x93,0x02,0x92,0x02,0xF0,
+    0x01,0x98,0x44,0x95,0x10,0xF9,0x54,0xF0,0x01,0x92,0x02,0x92,0x02,0xD3,0x02,0x72,
+    0x02,0xD1,0x02,0xB2,0x02,0x53,0x02,0x93,0x0A,0xBE,0xF7,0xFF,0xFF,0x8F,0x02,0x53,
+    0x13,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x51,0xFF,0xFF,0x16,0xDF,0xFF,0xFF,0xFF,0x7E,
+    0xD7,0x92,0x02,0x51,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xEF,
+    0x01,0x79,0x65,0xFF,0xFF,0xDF,0xF7,0xDF,0xFF,0x42,0xFF,0xFF,0x00,0xFE,0xFF,0x8B,
+    0x04,0x9C,0x9E,0x31,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x44,0x92,0x02,0x42,0xB2,
+    0x02,0xBC,0x01,0x7D,0xE7,0x90,0x0A,0xA9,0x01,0x11,0x02,0x18,0x55,0x85,0x00,0xDF,
+    0xFF,0x82,0x01,0x38,0x5D,0xF0,0x01,0x81,0x01,0xB2,0x02,0xB2,0x02,0x85,0xC1,0x00,
+    0xB2,0x02,0x82,0x0E,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,
+    0x92,0x02,0x93,0x02,0xB2,0x02,0x72,0x02,0x31,0x02,0xBC,0xA6,0xFF,0xFF,0xDF,0xFF,
+    0xFE,0xFF,0x98,0x07,0xF2,0x33,0xD1,0x0A,0x33,0x13,0x32,0x1B,0x52,0x13,0x72,0x13,
+    0x32,0x1B,0x53,0x1B,0x7F,0x18,0x32,0x1B,0x07,0x52,0x1B,0x12,0x13,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xBF,0xB1,0xC4,0x03,0xFF,0xF7,0x13,
+    0x0B,0x52,0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0xBF,0x02,0x97,0x03,0xDF,
+    0xE7,0xF4,0x0A,0x31,0x02,0xB2,0x02,0x54,0x92,0x02,0x03,0x93,0x02,0x73,0x02,0x51,
+    0x02,0x9C,0xB6,0x95,0x02,0x33,0x13,0x31,0x02,0xB3,0x02,0x42,0x92,0x02,0x42,0xB2,
+    0x02,0x81,0x00,0xB3,0x02,0x42,0x92,0x02,0x02,0x33,0x02,0xF2,0x0A,0xBD,0xFF,0x93,
+    0x0E,0xFF,0xF7,0x13,0x0B,0x32,0x02,0x93,0x02,0x91,0x02,0x92,0x02,0x93,0x02,0x73,
+    0x02,0x93,0x02,0x71,0x02,0xB0,0x0A,0xFF,0xFF,0xDD,0xA6,0xAE,0x01,0x1B,0x86,0x53,
+    0xFF,0xFF,0x1B,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0x19,0x5D,0xF1,0x01,0xB2,0x02,0x92,
+    0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x91,0x02,0x92,0x02,0x72,
+    0x0A,0x92,0x02,0xB3,0x02,0x94,0x02,0x32,0x02,0xB1,0x02,0x7D,0xDF,0xFF,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0xF7,0x4B,0xFF,0xFF,0x07,0xD4,
+    0x1B,0xF0,0x01,0x93,0x0A,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x81,
+    0x00,0x93,0x02,0xBE,0x02,0x5D,0xE7,0xB1,0x0A,0x53,0x02,0xA7,0x01,0xB2,0x02,0x10,
+    0x02,0x86,0xC3,0x05,0xB6,0x2B,0x30,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x81,0x00,0x92,0x02,0x84,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x81,0x0A,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0xD2,0x02,0xB2,0x02,
+    0xF0,0x01,0x18,0x5D,0x82,0x00,0xFF,0xF7,0x97,0x05,0xDE,0xFF,0xFE,0xF7,0xFE,0xFF,
+    0xDF,0xF7,0xDF,0xFF,0xFE,0xFF,0x7F,0x1A,0xFF,0xFF,0x07,0xFE,0xFF,0xBC,0xAE,0x51,
+    0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0xBF,0x15,0x02,0xB3,0x02,
+    0x92,0x02,0xB2,0x02,0x4A,0x92,0x02,0x01,0x10,0x02,0xF8,0x4C,0xBF,0x4E,0x00,0xDF,
+    0xFF,0x81,0x02,0xFA,0x85,0xEF,0x01,0x93,0x02,0x83,0xC1,0x00,0xB2,0x02,0xBF,0x00,
+    0x58,0xFF,0xFF,0x01,0xB5,0x23,0x11,0x02,0x81,0x42,0xB2,0x02,0x8F,0x04,0x93,0x02,
+    0x72,0x02,0x92,0x02,0xF0,0x01,0xD7,0x4C,0x81,0x00,0xDF,0xFF,0x90,0x02,0xDF,0xFF,
+    0x7B,0xA6,0x30,0x02,0x42,0x93,0x02,0x82,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x82,
+    0x04,0xB2,0x02,0xB3,0x02,0x92,0x02,0xF0,0x01,0xFA,0x8D,0x93,0x04,0x1A,0x86,0xEF,
+    0x01,0xB3,0x02,0x94,0x02,0x72,0x02,0x81,0x06,0x74,0x02,0x93,0x02,0xD2,0x02,0x31,
+    0x02,0x9B,0x6D,0xF6,0x23,0x92,0x02,0x54,0xFF,0xFF,0x81,0x02,0xDF,0xF7,0xF3,0x0A,
+    0x31,0x02,0x42,0x92,0x02,0x0B,0xB2,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0xD1,0x01,0x76,0x34,0x43,0xFF,
+    0xFF,0x82,0x48,0xFF,0xFF,0x08,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0x9C,0xA6,0x10,0x02,
+    0x72,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0x82,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0xBE,0x01,0x3D,0xCF,0xD1,0x02,0xA7,0x03,0x74,0x02,0xB1,0x02,0x0F,0x02,0xF9,0x54,
+    0x81,0x01,0xDF,0xFF,0xFE,0xFF,0x82,0x0A,0xFE,0xFF,0xFF,0xFF,0x5D,0xE7,0xB2,0x02,
+    0x71,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0x81,0x00,
+    0x93,0x02,0x84,0x05,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,
+    0x81,0x05,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x31,0x02,0xD3,0x1B,0x42,0xFF,
+    0xFF,0x00,0xFE,0xFF,0x7F,0x39,0xFF,0xFF,0x02,0xFE,0xC6,0x52,0x02,0x72,0x02,0x4D,
+    0x92,0x02,0xBF,0x08,0x00,0xFC,0xBE,0x81,0x00,0x93,0x02,0x8D,0x00,0xD8,0x4C,0x81,
+    0x00,0xDF,0xFF,0x7F,0x4D,0xFF,0xFF,0x02,0x1D,0xC7,0xCE,0x0A,0x32,0x02,0x82,0x00,
+    0xB2,0x02,0xBF,0x04,0x98,0x05,0xD9,0x4C,0xEF,0x01,0x93,0x02,0x93,0x02,0x92,0x02,
+    0x92,0x02,0x43,0xB2,0x02,0x8C,0x04,0xB2,0x02,0x93,0x02,0x92,0x02,0x30,0x02,0x53,
+    0x13,0x81,0x00,0xDE,0xFF,0x51,0xFF,0xFF,0x05,0x97,0x44,0xF1,0x01,0xB2,0x02,0x93,
+    0x02,0xB3,0x02,0xB2,0x02,0x47,0x92,0x02,0x04,0xB3,0x02,0xB2,0x02,0xB2,0x02,0x10,
+    0x02,0x15,0x2C,0x81,0x00,0xDF,0xFF,0x8A,0x03,0xDF,0xFF,0xDF,0xFF,0xFE,0xF7,0xDF,
+    0xFF,0x81,0x0D,0xB5,0x23,0xEF,0x01,0xD3,0x02,0x93,0x02,0x73,0x02,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x72,0x02,0xD3,0x0A,0x10,0x02,0x78,0x65,0x92,
+    0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x0B,0xD9,0x7D,0xEF,0x01,0xB3,0x02,0xB3,0x02,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x81,
+    0x03,0xB1,0x02,0x92,0x02,0x11,0x02,0x7C,0xA6,0x50,0xFF,0xFF,0x81,0x04,0xF4,0x23,
+    0xF1,0x01,0x93,0x02,0x92,0x02,0xB2,0x02,0x47,0x92,0x02,0xAF,0x03,0x92,0x02,0x93,
+    0x02,0x31,0x02,0x95,0x1B,0x85,0x00,0xBF,0xFF,0x82,0x06,0x1D,0xB7,0x92,0x02,0x52,
+    0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x86,0x03,0xB3,0x02,0x93,0x02,0x10,
+    0x02,0xB7,0x4C,0x8A,0x02,0x52,0x02,0x72,0x02,0x92,0x02,0x89,0x0F,0x92,0x02,0x93,
+    0x02,0xF0,0x01,0x37,0x3C,0xFF,0xFF,0xDE,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,
+    0xF7,0xFE,0xF7,0xDF,0xFF,0xFF,0xFF,0xFB,0x6D,0x10,0x02,0xB2,0x02,0x81,0x02,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0x82,0x42,0x92,0x02,0x03,0xB3,0x02,0x93,0x02,0x92,0x02,
+    0x72,0x02,0x82,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x81,0x05,0x92,0x02,0x93,0x02,
+    0x93,0x02,0x51,0x02,0x92,0x02,0x7F,0xD7,0x81,0x01,0xDE,0xFF,0xFF,0xEF,0x8E,0x00,
+    0xDF,0xFF,0x83,0x00,0xFE,0xFF,0xBF,0x21,0x05,0xFE,0xFF,0xFF,0xFF,0x9C,0xB6,0x71,
+    0x02,0x72,0x02,0xB2,0x02,0x81,0x00,0x93,0x02,0x87,0x04,0x93,0x02,0x92,0x02,0x72,
+    0x02,0xD2,0x02,0x9E,0xD7,0xBF,0x05,0x00,0xFC,0xC6,0x82,0x00,0xB2,0x02,0x48,0x92,
+    0x02,0x04,0xB2,0x02,0xB2,0x02,0x92,0x02,0x11,0x02,0x17,0x2C,0x81,0x00,0xFF,0xF7,
+    0xAE,0x03,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x96,0x00,0xFE,0xFF,0x81,0x02,
+    0xDE,0xFF,0x3A,0x9E,0xF9,0x8D,0x42,0x19,0x96,0x04,0x39,0x96,0x39,0x96,0x3A,0x96,
+    0x3A,0x96,0x1A,0x96,0x6F,0x19,0x96,0x07,0x3A,0x96,0x1A,0x96,0x39,0x96,0x98,0x85,
+    0xB7,0x3C,0xB2,0x02,0x51,0x02,0xB3,0x02,0x47,0x92,0x02,0x44,0xB2,0x02,0x82,0x04,
+    0x93,0x02,0x92,0x02,0x92,0x02,0x10,0x02,0xF9,0x54,0xB2,0x98,0x06,0x1C,0x8E,0x11,
+    0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x81,0x4D,0x92,0x02,0x05,
+    0x93,0x02,0xB2,0x02,0xB2,0x02,0x72,0x02,0x32,0x02,0xBC,0xAE,0x52,0xFF,0xFF,0x05,
+    0xFE,0xEF,0x13,0x0B,0x31,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x48,0x92,0x02,0x05,
+    0x93,0x02,0xB2,0x02,0x93,0x02,0x71,0x02,0xB2,0x0A,0x3E,0xD7,0x4B,0xFF,0xFF,0x0E,
+    0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDD,0xBE,0x50,0x02,
+    0x92,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0xD2,0x02,0x93,0x02,0x72,0x0A,0x81,0x03,
+    0xD1,0x02,0xF2,0x01,0xF3,0x0A,0xBE,0xF7,0x56,0xFF,0xFF,0x10,0x74,0x1B,0xF0,0x01,
+    0x92,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x11,0x02,0x74,0x13,0x50,0xFF,
+    0xFF,0x06,0xDF,0xFF,0xFF,0xFF,0x7C,0xB6,0x2F,0x02,0x93,0x02,0x94,0x02,0xB2,0x02,
+    0x48,0x92,0x02,0xAF,0x03,0x93,0x02,0x93,0x02,0x11,0x02,0x95,0x13,0x83,0x03,0xFE,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x81,0x05,0xBC,0xAE,0x52,0x02,0x72,0x02,0xB2,
+    0x02,0x92,0x02,0x72,0x02,0x42,0x92,0x02,0x85,0x02,0x92,0x02,0x11,0x02,0xD7,0x4C,
+    0x8A,0x04,0x71,0x02,0x72,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x88,0x09,0x73,0x02,
+    0x11,0x02,0xD4,0x1B,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFE,0xFF,0xDF,0xFF,
+    0xFF,0xFF,0x81,0x02,0x54,0x1B,0x11,0x02,0xB3,0x02,0x84,0xC1,0x83,0x06,0x72,0x02,
+    0x92,0x02,0x91,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0xB3,0x02,0x43,0x92,0x02,0x06,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xD1,0x01,0x79,0x65,0x42,0xFF,
+    0xFF,0x01,0xFE,0xFF,0xFE,0xFF,0x8F,0x00,0xFE,0xFF,0x81,0x00,0xDF,0xFF,0x7F,0x22,
+    0xFF,0xFF,0x05,0xFE,0xFF,0xBD,0xB6,0x51,0x02,0x72,0x02,0x93,0x02,0xB2,0x02,0x49,
+    0x92,0x02,0x82,0x00,0xD2,0x0A,0xBF,0x0A,0x01,0x92,0x02,0xB2,0x02,0x48,0x92,0x02,
+    0x04,0xB2,0x02,0xB2,0x02,0x52,0x02,0xD2,0x02,0xBE,0xE7,0x43,0xFF,0xFF,0x00,0xFE,
+    0xFF,0x6D,0xFF,0xFF,0x00,0xFF,0xF7,0x97,0x05,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0x7D,
+    0xE7,0x6F,0x02,0xEF,0x01,0x77,0x10,0x02,0x07,0x30,0x02,0x2F,0x02,0x30,0x02,0xEE,
+    0x01,0x2F,0x02,0x72,0x02,0x94,0x02,0x91,0x02,0x88,0x01,0x92,0x02,0x92,0x02,0x84,
+    0x04,0xB3,0x02,0xB2,0x02,0x93,0x02,0x10,0x02,0x19,0x55,0xB2,0x98,0x02,0x3D,0xD7,
+    0x93,0x02,0x72,0x02,0x42,0x92,0x02,0x01,0xB3,0x02,0xB2,0x02,0x50,0x92,0x02,0x03,
+    0x93,0x02,0x93,0x02,0xF0,0x01,0xD7,0x44,0x90,0x08,0xFF,0xF7,0xFF,0xFF,0x3B,0x8E,
+    0x30,0x02,0x93,0x02,0xB3,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x87,0x05,0xB2,0x02,
+    0x92,0x02,0x93,0x02,0xB2,0x02,0x31,0x02,0x3A,0x65,0x81,0x01,0xDF,0xFF,0xDF,0xFF,
+    0x87,0x01,0xDF,0xFF,0xFE,0xFF,0x43,0xFF,0xFF,0x0D,0x97,0x44,0xF0,0x01,0xB3,0x02,
+    0x92,0x02,0xB2,0x02,0xB1,0x02,0xB2,0x02,0x73,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,
+    0xB2,0x02,0x10,0x02,0x15,0x24,0x56,0xFF,0xFF,0x02,0x7B,0x96,0x11,0x02,0x93,0x02,
+    0x81,0x00,0x93,0x02,0x81,0x09,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0xF1,0x01,0x98,0x5D,0x52,0xFF,0xFF,0x05,0xB5,0x2B,
+    0x12,0x02,0xB2,0x02,0x73,0x02,0xB3,0x02,0xB2,0x02,0xB7,0x00,0xB3,0x02,0x86,0x00,
+    0xDF,0xFF,0x43,0xFF,0xFF,0x03,0xDF,0xFF,0xFB,0x7D,0x11,0x02,0x92,0x02,0x81,0x00,
+    0x93,0x02,0x87,0x03,0x93,0x02,0xB2,0x02,0x11,0x02,0xB8,0x4C,0x97,0x04,0x72,0x02,
+    0x92,0x02,0x93,0x02,0x70,0x02,0x7F,0xE7,0x46,0xFF,0xFF,0x05,0xD9,0x6D,0x0F,0x02,
+    0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x44,0x92,0x02,0x09,0xB2,0x02,0x93,0x02,
+    0x92,0x02,0x93,0x02,0xD3,0x02,0xB6,0x3C,0xB2,0x0A,0x93,0x02,0x91,0x02,0xB3,0x02,
+    0x88,0x02,0x93,0x02,0x32,0x02,0x32,0x0B,0x43,0xFF,0xFF,0x00,0xDF,0xFF,0x8D,0x00,
+    0xFE,0xFF,0x7F,0x28,0xFF,0xFF,0x06,0xBD,0xB6,0x52,0x02,0x72,0x02,0x92,0x02,0x93,
+    0x02,0x92,0x02,0xB2,0x02,0x88,0x03,0xB2,0x02,0x52,0x02,0xD2,0x02,0x7F,0xDF,0xBF,
+    0x07,0x02,0x71,0x02,0xB2,0x02,0x93,0x02,0x88,0x06,0x93,0x02,0x92,0x02,0xB2,0x02,
+    0x93,0x02,0x30,0x02,0x16,0x2C,0xFF,0xF7,0x6E,0xFF,0xFF,0x00,0xFE,0xFF,0x5A,0xFF,
+    0xFF,0x00,0xFF,0xF7,0x81,0x04,0x7D,0xEF,0xD3,0x02,0x52,0x02,0x92,0x02,0x92,0x02,
+    0x75,0x93,0x02,0x07,0x94,0x02,0x73,0x02,0x72,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,
+    0x93,0x02,0xB3,0x02,0x4A,0x92,0x02,0x84,0x04,0x93,0x02,0x92,0x02,0x92,0x02,0x10,
+    0x02,0x9A,0x65,0xB2,0x59,0xFF,0xFF,0x03,0x74,0x13,0x51,0x02,0x92,0x02,0xB3,0x02,
+    0x51,0x92,0x02,0x06,0x93,0x02,0xB1,0x02,0xB1,0x02,0x94,0x02,0x30,0x02,0x54,0x13,
+    0xDF,0xFF,0x51,0xFF,0xFF,0x05,0x57,0x2C,0xCF,0x01,0xB3,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0x88,0x05,0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x10,0x02,0x75,0x1B,
+    0x4B,0xFF,0xFF,0x02,0xDF,0xFF,0xFE,0xF7,0xFF,0xF7,0x81,0x0F,0xBE,0xEF,0xD2,0x0A,
+    0x73,0x02,0x93,0x02,0x72,0x0A,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0x73,0x02,0x92,0x02,0xB0,0x02,0x1E,0xD7,0x95,0x04,0x16,0x2C,
+    0xF1,0x01,0xB2,0x02,0x92,0x02,0x93,0x02,0x47,0x92,0x02,0x04,0xB2,0x02,0x93,0x02,
+    0x52,0x02,0x93,0x0A,0x9D,0xD7,0x91,0x05,0xFD,0xB6,0x31,0x02,0x73,0x02,0xB2,0x02,
+    0xD2,0x02,0x92,0x02,0xBF,0x01,0xC1,0x00,0xFE,0xFF,0x81,0x06,0x9E,0xDF,0x75,0x1B,
+    0x32,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x42,0xB2,0x02,0x42,0x92,0x02,
+    0x91,0x00,0x92,0x02,0x81,0xC8,0x05,0x93,0x02,0xB1,0x02,0xB2,0x02,0x11,0x02,0x17,
+    0x2C,0xDF,0xEF,0x84,0x03,0x19,0x7E,0x50,0x02,0x52,0x02,0x93,0x02,0x83,0x01,0xB2,
+    0x02,0xB2,0x02,0x83,0x15,0xB2,0x02,0x52,0x02,0x33,0x0B,0x9D,0xDF,0x15,0x13,0x72,
+    0x02,0xB1,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x94,0x02,0x92,0x02,0x2F,0x02,0x55,0x3C,0xFF,
+    0xEF,0x51,0xFF,0xFF,0x00,0xFF,0xF7,0x81,0x00,0xDF,0xFF,0xBF,0x1E,0x00,0xDF,0xFF,
+    0x81,0x08,0xFF,0xF7,0xFE,0xF7,0xFF,0xFF,0x1A,0x86,0x10,0x02,0x92,0x02,0xB3,0x02,
+    0x93,0x02,0x93,0x02,0x88,0x06,0x92,0x02,0x93,0x02,0x52,0x02,0xD2,0x0A,0x7F,0xD7,
+    0xFF,0xFF,0xFE,0xFF,0xBF,0x03,0x03,0xDC,0xBE,0x71,0x02,0x72,0x02,0x93,0x02,0x89,
+    0x0C,0x92,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x53,0x02,0x31,0x02,0x74,0x1B,0x37,
+    0x6D,0x7B,0x9E,0x1D,0xB7,0x9F,0xDF,0xFF,0xEF,0xFF,0xF7,0x81,0x00,0xDF,0xFF,0x68,
+    0xFF,0xFF,0x02,0xFE,0xF7,0xFF,0xF7,0xFE,0xFF,0x56,0xFF,0xFF,0x05,0xDF,0xFF,0xFF,
+    0xFF,0x7E,0xE7,0xF5,0x02,0x52,0x02,0xB2,0x02,0xB6,0x06,0x92,0x02,0x94,0x02,0x93,
+    0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0x72,0x0A,0x4B,0x92,0x02,0x84,0x04,0xB2,0x02,
+    0x92,0x02,0xB3,0x02,0xF0,0x01,0xB9,0x85,0xB2,0x99,0x01,0x97,0x4C,0xF0,0x01,0x82,
+    0x00,0xB2,0x02,0x8F,0x06,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x71,0x02,0x52,
+    0x02,0xBC,0xAE,0x90,0x06,0xBE,0xDF,0xD3,0x02,0x51,0x02,0x92,0x02,0x93,0x02,0x92,
+    0x02,0xB2,0x02,0x89,0xC2,0x02,0x73,0x02,0x51,0x02,0xDC,0xAE,0x4C,0xFF,0xFF,0x00,
+    0xFD,0xF7,0x81,0x0F,0x9A,0x5D,0xF0,0x01,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0xD1,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x95,0x02,
+    0xF1,0x01,0x37,0x5D,0x94,0x0B,0x3D,0xC7,0x51,0x02,0x73,0x02,0x92,0x02,0x93,0x02,
+    0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x42,0x92,
+    0x02,0x02,0xB2,0x02,0xF0,0x01,0x35,0x3C,0x52,0xFF,0xFF,0x02,0x16,0x2C,0x10,0x02,
+    0x93,0x0A,0x4B,0x92,0x02,0xAF,0x03,0x93,0x02,0x93,0x02,0x10,0x02,0x95,0x1B,0x83,
+    0x07,0x5A,0xAE,0x14,0x3C,0x55,0x3C,0x77,0x44,0xF5,0x33,0xEF,0x0A,0x70,0x02,0x94,
+    0x02,0x42,0x92,0x02,0x02,0x93,0x02,0x91,0x02,0xB2,0x02,0x43,0x92,0x02,0x81,0x02,
+    0xB3,0x02,0x92,0x02,0x10,0x02,0x8B,0x00,0x52,0x02,0x8B,0x10,0x92,0x02,0xB2,0x02,
+    0x72,0x02,0x93,0x02,0x31,0x02,0x14,0x13,0x36,0x44,0x75,0x44,0x76,0x3C,0x56,0x4C,
+    0x74,0x23,0x11,0x02,0x71,0x02,0xB3,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x81,0xC1,
+    0x02,0xB2,0x02,0xB2,0x02,0x91,0x02,0x81,0x05,0x10,0x02,0xD4,0x2B,0xFF,0xFF,0x58,
+    0x34,0x10,0x02,0x91,0x02,0x86,0xC3,0x06,0x92,0x0A,0xB1,0x02,0xF3,0x01,0x13,0x13,
+    0x54,0x3C,0x15,0x3C,0x3B,0x9E,0x8D,0x00,0xDF,0xFF,0x7F,0x27,0xFF,0xFF,0x05,0xBE,
+    0xEF,0x35,0x13,0x11,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x49,0x92,0x02,0x04,0xB2,
+    0x02,0x92,0x02,0x31,0x02,0xD2,0x0A,0x7E,0xCF,0x7F,0x05,0xFF,0xFF,0x03,0x1C,0xC7,
+    0x92,0x0A,0x72,0x02,0xB3,0x02,0x8A,0xC1,0x0C,0xB3,0x02,0xB3,0x02,0xB1,0x02,0x30,
+    0x02,0xF2,0x01,0x31,0x02,0xD1,0x02,0xF2,0x0A,0x12,0x13,0x32,0x13,0x32,0x1B,0x32,
+    0x13,0x32,0x13,0x42,0x32,0x1B,0x43,0x52,0x13,0x00,0x32,0x1B,0x57,0x31,0x1B,0x0C,
+    0x51,0x1B,0x51,0x1B,0x32,0x1B,0x31,0x1B,0x51,0x13,0x32,0x1B,0x12,0x1B,0x32,0x13,
+    0x71,0x13,0xAF,0x0A,0x95,0x4C,0xFF,0xFF,0xDF,0xFF,0x94,0x05,0xFE,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xBE,0xDF,0xF4,0x02,0x32,0x02,0x77,0x92,0x02,0x07,0x72,0x02,0xB3,0x02,
+    0xB3,0x02,0x92,0x02,0x91,0x02,0xB1,0x02,0x91,0x02,0xB1,0x02,0x91,0x02,0x93,0x02,
+    0x10,0x02,0x39,0xA6,0xB2,0x99,0x03,0xFB,0x8D,0x11,0x02,0x72,0x02,0xB2,0x02,0x88,
+    0x00,0xB2,0x02,0x49,0x92,0x02,0x04,0x93,0x02,0x93,0x02,0xB3,0x02,0xEF,0x01,0xF7,
+    0x4C,0x8E,0x09,0xDF,0xFF,0xFF,0xFF,0xFA,0x7D,0xF0,0x01,0x93,0x02,0xB1,0x02,0x93,
+    0x02,0x74,0x02,0x92,0x02,0x93,0x02,0x89,0x42,0x93,0x02,0x01,0x0F,0x02,0xD8,0x3C,
+    0x8C,0x00,0xFE,0xFF,0x81,0x0F,0x73,0x13,0x11,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0x72,0x0A,0xB2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB3,0x02,
+    0x92,0x02,0x31,0x02,0x75,0x0B,0x94,0x09,0xB6,0x4C,0xF0,0x01,0x91,0x02,0xB2,0x02,
+    0x92,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB3,0x02,0xB3,0x02,0x81,0x05,0x93,0x02,
+    0xB2,0x02,0x91,0x02,0x72,0x02,0x50,0x02,0x9B,0xA6,0x91,0x07,0xDC,0xBE,0x52,0x02,
+    0x73,0x02,0xB2,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0xBF,0x00,0x07,0x39,
+    0x55,0xB0,0x01,0x11,0x02,0xF3,0x01,0x11,0x02,0x51,0x02,0x94,0x02,0xB0,0x02,0x81,
+    0x04,0xB3,0x02,0x93,0x02,0x72,0x02,0xB2,0x02,0xB2,0x02,0x84,0x01,0x93,0x02,0xB2,
+    0x02,0x8D,0x02,0x72,0x02,0x92,0x02,0x93,0x02,0x88,0x0F,0xB2,0x02,0x92,0x02,0x93,
+    0x02,0x92,0x02,0xB2,0x02,0x32,0x02,0x11,0x02,0x11,0x02,0x31,0x02,0x10,0x02,0x11,
+    0x02,0x73,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x85,0x01,0xB3,0x02,0x92,
+    0x02,0x81,0x09,0x0F,0x02,0x59,0x65,0xFF,0xFF,0xB9,0x75,0xF0,0x01,0x93,0x02,0x92,
+    0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x83,0x0B,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB2,
+    0x02,0xB2,0x02,0x93,0x02,0x11,0x02,0x11,0x02,0x6F,0x01,0xB9,0x4C,0xFF,0xFF,0xDF,
+    0xFF,0x4D,0xFF,0xFF,0x04,0xBC,0xDF,0xB9,0x7D,0x9B,0x5D,0x9B,0x65,0x99,0x6D,0x7F,
+    0x1B,0x9A,0x6D,0x0C,0xBA,0x6D,0x9A,0x6D,0x7A,0x6D,0xBA,0x75,0x9A,0x75,0x3A,0x5D,
+    0x13,0x13,0x11,0x02,0xD2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x89,0x03,
+    0x93,0x02,0x51,0x02,0xD2,0x0A,0xBE,0xDF,0xBF,0x05,0x05,0x9F,0xDF,0xF4,0x0A,0x51,
+    0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x8A,0x0B,0x93,0x02,0x92,0x02,0x92,0x02,0x93,
+    0x02,0x93,0x02,0x72,0x02,0x71,0x02,0x31,0x02,0x11,0x02,0x31,0x02,0x32,0x02,0x11,
+    0x02,0x43,0x12,0x02,0x42,0x31,0x02,0x59,0x32,0x02,0x45,0x31,0x02,0x06,0x12,0x02,
+    0x31,0x02,0x31,0x02,0x90,0x01,0xD5,0x1B,0xFF,0xFF,0xFF,0xF7,0x55,0xFF,0xFF,0x04,
+    0xFE,0xFF,0xFF,0xFF,0x7E,0xEF,0xD3,0x0A,0x31,0x02,0x81,0x01,0x93,0x02,0xB2,0x02,
+    0x81,0x01,0x93,0x02,0x93,0x02,0x6F,0xB2,0x02,0x07,0x93,0x02,0xB1,0x02,0x91,0x02,
+    0x93,0x0A,0x72,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0x91,0x03,0x72,0x02,0xB1,0x02,
+    0xFC,0xBE,0xDF,0xFF,0xB1,0x99,0x04,0x9F,0xDF,0xB2,0x02,0x52,0x02,0xB2,0x02,0x93,
+    0x02,0x46,0x92,0x02,0x00,0xB2,0x02,0x88,0x07,0xB2,0x02,0x93,0x02,0x73,0x02,0xB2,
+    0x02,0xB3,0x02,0x11,0x02,0x33,0x13,0xFF,0xF7,0x4E,0xFF,0xFF,0x07,0xFF,0xF7,0xF6,
+    0x23,0xF2,0x01,0xB3,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x48,0x92,0x02,
+    0x07,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x51,0x02,0xD2,0x0A,0xBF,
+    0xF7,0x81,0x00,0xDF,0xFF,0x87,0x05,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x7B,0xA6,0x10,
+    0x02,0x92,0x02,0x42,0xB2,0x02,0x03,0xB3,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x81,
+    0x05,0xB3,0x02,0x92,0x02,0xB1,0x02,0x91,0x02,0x52,0x02,0xBC,0xA6,0x8F,0x05,0xDF,
+    0xFF,0xDF,0xFF,0xFF,0xFF,0xBE,0xE7,0x92,0x02,0x52,0x02,0x82,0x00,0xB2,0x02,0x82,
+    0x0A,0xB2,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x12,0x02,0x73,
+    0x13,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x8A,0x00,0xDF,0xFF,0x83,0x07,0x36,0x2C,0xCE,
+    0x01,0xB2,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0xB3,0x02,0xBF,0x00,0x03,
+    0x9A,0x65,0x31,0x02,0x92,0x02,0x94,0x02,0x42,0x93,0x02,0x00,0xB1,0x02,0x42,0xB2,
+    0x02,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x86,0x01,0x92,0x02,0xF0,0x01,0x8A,0x02,
+    0x1E,0xC7,0x92,0x02,0x71,0x02,0x8A,0x0D,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x91,0x02,
+    0xB2,0x02,0x92,0x02,0x82,0xC1,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x82,0x06,0x71,
+    0x02,0x50,0x02,0xDD,0xB6,0xFF,0xFF,0x3C,0xD7,0x91,0x02,0x74,0x02,0x85,0x00,0xB2,
+    0x02,0x42,0x92,0x02,0x07,0x93,0x02,0x92,0x02,0x92,0x02,0xB1,0x02,0x92,0x02,0x93,
+    0x02,0x0F,0x02,0x39,0x5D,0x4F,0xFF,0xFF,0x05,0x1D,0xC7,0xEE,0x01,0xF1,0x01,0x11,
+    0x02,0xF1,0x01,0x11,0x02,0x47,0x10,0x02,0x7F,0x10,0x11,0x02,0x0F,0x10,0x02,0x11,
+    0x02,0x10,0x02,0x10,0x02,0x11,0x02,0x11,0x02,0x10,0x02,0xF1,0x01,0x51,0x02,0x92,
+    0x0A,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x49,0x92,0x02,
+    0x02,0x51,0x02,0xF2,0x0A,0xFF,0xF7,0xBF,0x05,0x01,0xDF,0xEF,0x13,0x0B,0x81,0x01,
+    0x92,0x02,0xB2,0x02,0x8B,0x07,0x91,0x02,0xB3,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0x93,0x02,0x92,0x02,0x43,0xB2,0x02,0x01,0x92,0x02,0xB2,0x02,0x45,0x92,
+    0x02,0x58,0x93,0x02,0x43,0x92,0x02,0x05,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0xF1,0x01,0x37,0x24,0x55,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x02,0x7E,0xE7,
+    0xD2,0x0A,0x71,0x02,0x78,0x92,0x02,0x00,0xB3,0x02,0x42,0x92,0x02,0x01,0xB2,0x02,
+    0x92,0x02,0x88,0x00,0xB2,0x02,0x86,0x04,0x92,0x02,0xB3,0x02,0x32,0x02,0x14,0x0B,
+    0xBF,0xF7,0x72,0xFF,0xFF,0x97,0x07,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xF5,0x23,0x10,
+    0x02,0x92,0x02,0x93,0x02,0xB1,0x02,0x84,0x42,0xB2,0x02,0x88,0x06,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x73,0x02,0x31,0x02,0xBB,0xAE,0x8E,0x03,0x7D,0xDF,0x91,
+    0x02,0x74,0x02,0xB2,0x02,0x81,0x00,0xB2,0x02,0x89,0x00,0x92,0x02,0x82,0x03,0x93,
+    0x02,0x74,0x02,0x10,0x02,0x1A,0x86,0x4D,0xFF,0xFF,0x03,0x56,0x2C,0xF2,0x01,0xB2,
+    0x02,0x92,0x02,0x81,0x0B,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x10,0x02,0x77,0x3C,0x52,0xFF,0xFF,
+    0x08,0x59,0x65,0xF1,0x01,0xB2,0x02,0xB3,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0x93,0x02,0x42,0x92,0x02,0x05,0xB3,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xEF,
+    0x01,0x99,0x65,0x4D,0xFF,0xFF,0x83,0x08,0xFC,0xBE,0x50,0x02,0x50,0x02,0xB2,0x02,
+    0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0xB9,0x00,0x30,0x02,0x84,0x08,
+    0x79,0x6D,0x10,0x02,0x73,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,
+    0xB2,0x02,0x42,0x92,0x02,0x05,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x81,0x03,0xB3,0x02,0x92,0x02,0x10,0x02,0x39,0x5D,0x89,0x04,0x5F,0xCF,
+    0xF3,0x02,0x70,0x02,0x93,0x02,0x94,0x02,0x4B,0x92,0x02,0x04,0x93,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0x42,0x92,0x02,0x00,0x93,0x02,0x81,0x02,0x92,0x02,
+    0x93,0x02,0xB2,0x02,0x81,0x10,0xB3,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,
+    0xB2,0x02,0x51,0x02,0x14,0x13,0xFE,0xF7,0xFF,0xFF,0xFF,0xFF,0xB3,0x23,0x12,0x02,
+    0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x81,0x07,0x92,0x02,0xB3,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x72,0x02,0x93,0x02,0xB2,0x02,0x81,0x00,0xF0,0x01,0x90,0x05,
+    0x1D,0xD7,0x93,0x02,0x51,0x02,0x91,0x02,0x92,0x02,0xB2,0x02,0x7F,0x1C,0x92,0x02,
+    0x09,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB3,
+    0x02,0x92,0x02,0xB3,0x02,0x4B,0x92,0x02,0x01,0x30,0x02,0x34,0x1B,0x7F,0x06,0xFF,
+    0xFF,0x02,0xDF,0xFF,0x94,0x13,0x30,0x02,0x4A,0x92,0x02,0x07,0x93,0x02,0xB2,0x02,
+    0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x81,0x04,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x42,0x92,0x02,0x43,0xB2,0x02,0x81,0x57,
+    0xB2,0x02,0x44,0x92,0x02,0x42,0xB2,0x02,0x02,0x93,0x02,0x10,0x02,0x15,0x2C,0x59,
+    0xFF,0xFF,0x02,0x7E,0xEF,0xD3,0x0A,0x51,0x02,0x81,0x01,0xB2,0x02,0xB2,0x02,0x83,
+    0x6F,0xB2,0x02,0x00,0x93,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x4A,0x92,0x02,0x44,
+    0xB2,0x02,0x82,0x03,0xB2,0x02,0x93,0x02,0x11,0x02,0xD7,0x23,0x73,0xFF,0xFF,0x5A,
+    0xFF,0xFF,0x04,0x79,0x65,0xF0,0x01,0x72,0x02,0x92,0x02,0xB3,0x02,0x42,0x93,0x02,
+    0x42,0x92,0x02,0x00,0x93,0x02,0x88,0x07,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,
+    0x93,0x02,0xB2,0x02,0xEF,0x01,0xD9,0x4C,0x8E,0x04,0x99,0x6D,0xF1,0x01,0x91,0x02,
+    0x92,0x02,0x93,0x02,0x42,0xB2,0x02,0x8B,0x04,0x93,0x02,0x92,0x02,0xB3,0x02,0x12,
+    0x02,0x34,0x2C,0x81,0x00,0xDE,0xFF,0x86,0x07,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0x5E,
+    0xD7,0xB1,0x02,0x53,0x02,0x93,0x02,0x93,0x02,0x42,0x92,0x02,0x00,0x93,0x02,0x81,
+    0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x02,0x51,0x02,0xF3,0x0A,0xBF,
+    0xF7,0x82,0x00,0xDE,0xFF,0x8C,0x07,0xDF,0xFF,0x14,0x13,0x32,0x02,0xB2,0x02,0xB2,
+    0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x42,0x92,0x02,0x09,0xB2,0x02,0x94,0x02,0x93,
+    0x02,0x92,0x02,0x93,0x02,0x51,0x02,0xB2,0x02,0x9F,0xD7,0xFF,0xFF,0xFF,0xF7,0x8A,
+    0x00,0xFF,0xF7,0x43,0xFF,0xFF,0x02,0x36,0x34,0xCF,0x01,0x92,0x0A,0x4D,0x92,0x02,
+    0xA5,0x01,0x93,0x02,0xB2,0x02,0x82,0x00,0xB2,0x02,0x82,0x04,0xB2,0x02,0xB2,0x02,
+    0x93,0x02,0x31,0x02,0xB5,0x13,0x83,0x02,0x7A,0x65,0x11,0x02,0x92,0x02,0x82,0xCA,
+    0x06,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x12,0x02,0x9A,0x6D,0x89,
+    0x05,0x9F,0xE7,0x13,0x0B,0x50,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x81,0x00,0x93,
+    0x02,0x84,0x42,0xB2,0x02,0x00,0x92,0x02,0x81,0xC1,0x82,0x44,0xB2,0x02,0x0A,0xB3,
+    0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0x10,0x02,0x58,0x34,0x42,0xFF,0xFF,0x02,0x18,0x55,0xF1,0x01,0xB2,0x02,0x82,
+    0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x44,0x92,0x02,0x83,0x00,0x10,0x02,0x90,0x02,
+    0x1D,0xCF,0xB2,0x0A,0x52,0x02,0x7F,0x25,0x92,0x02,0x47,0xB2,0x02,0x81,0x43,0xB2,
+    0x02,0x81,0x01,0x12,0x02,0x17,0x24,0x7F,0x07,0xFF,0xFF,0x02,0x37,0x2C,0xEF,0x01,
+    0x93,0x02,0x83,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x82,0x42,0xB2,0x02,0x00,0x92,
+    0x02,0x43,0xB2,0x02,0x47,0x92,0x02,0x5F,0xB2,0x02,0x01,0x92,0x02,0xB2,0x02,0x82,
+    0x05,0xB3,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xF0,0x01,0x16,0x2C,0x99,0x03,0x7E,
+    0xE7,0xF3,0x0A,0x51,0x02,0xB2,0x02,0x7F,0x08,0x92,0x02,0x05,0x93,0x02,0x92,0x02,
+    0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x82,0x01,0xCF,0x01,0x37,0x65,0xB3,0x9A,
+    0x01,0x3D,0xC7,0x72,0x02,0x84,0x42,0x92,0x02,0x01,0x93,0x02,0xB2,0x02,0x48,0x92,
+    0x02,0x03,0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x81,0x02,0x31,0x02,0x34,0x13,
+    0xFE,0xFF,0x84,0x00,0xDF,0xFF,0x82,0x02,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x81,0x06,
+    0xB5,0x1B,0x31,0x02,0x91,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x89,0x42,
+    0xB2,0x02,0x07,0x92,0x02,0x91,0x02,0xB2,0x02,0x53,0x02,0x91,0x02,0x5E,0xCF,0xFF,
+    0xFF,0xDF,0xFF,0x47,0xFF,0xFF,0x81,0x02,0x18,0x5D,0xEE,0x01,0x92,0x02,0x82,0x43,
+    0xB2,0x02,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x09,0xB2,0x02,0x92,
+    0x02,0x10,0x02,0xDA,0x7D,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,
+    0xFF,0x8A,0x13,0x3A,0x86,0x11,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x32,0x02,0x93,0x02,0x93,0x02,0xB0,0x02,0x93,
+    0x02,0xB2,0x02,0x0F,0x02,0x76,0x34,0xFF,0xFF,0xFE,0xFF,0x4F,0xFF,0xFF,0x06,0x3D,
+    0xBF,0x51,0x02,0x72,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x72,0x02,0xB0,0x01,0x92,
+    0x02,0x92,0x02,0x44,0xB2,0x02,0x06,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x93,
+    0x02,0x11,0x02,0x95,0x1B,0x83,0x03,0x7A,0x6D,0x10,0x02,0x93,0x02,0x93,0x02,0x42,
+    0x92,0x02,0x00,0xB2,0x02,0x87,0x03,0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x81,
+    0x01,0xF1,0x01,0xDB,0x85,0x4A,0xFF,0xFF,0x01,0x54,0x13,0x30,0x02,0x81,0x47,0x92,
+    0x02,0x01,0xB2,0x02,0xB2,0x02,0x46,0x92,0x02,0x43,0xB2,0x02,0x43,0x92,0x02,0x0A,
+    0x91,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB1,0x02,
+    0x93,0x02,0xF1,0x01,0xFA,0x6D,0x82,0x05,0x7C,0xB6,0x71,0x02,0x91,0x02,0x92,0x02,
+    0x93,0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0x93,0x02,0x83,0x02,0xB3,0x02,0xB2,0x02,
+    0x72,0x02,0x92,0x01,0x1D,0xD7,0x92,0x0A,0x81,0x00,0x93,0x02,0x7F,0x2C,0x92,0x02,
+    0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x83,0x01,0xF1,0x01,0xD8,0x44,0xBF,0x07,0x03,
+    0xF7,0x54,0xF0,0x01,0x93,0x02,0x93,0x02,0x81,0x00,0x93,0x02,0x42,0x92,0x02,0x01,
+    0x93,0x02,0xB2,0x02,0x84,0xC3,0x47,0xB2,0x02,0x5F,0x92,0x02,0x43,0x93,0x02,0x02,
+    0x92,0x02,0x93,0x02,0x92,0x02,0x9E,0x01,0xD3,0x0A,0x51,0x02,0x7F,0x08,0x92,0x02,
+    0x04,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB3,0x02,0x42,0xB2,0x02,0x05,0x93,
+    0x02,0x72,0x02,0x52,0x02,0x3B,0xBF,0xFF,0xFF,0xDF,0xFF,0xB1,0x98,0x0B,0xDF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0x95,0x1B,0x31,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0xB3,0x02,0x8A,0xC3,0x04,0x93,0x02,0x93,0x02,0x92,0x02,0x30,
+    0x02,0xBC,0xAE,0x4C,0xFF,0xFF,0x03,0x3E,0xCF,0x72,0x02,0x71,0x02,0x93,0x02,0x81,
+    0x00,0xB2,0x02,0x8B,0x00,0x92,0x02,0x43,0xB2,0x02,0x02,0x92,0x02,0xF1,0x01,0x79,
+    0x5D,0x4B,0xFF,0xFF,0x01,0x13,0x0B,0x51,0x02,0x81,0x47,0xB2,0x02,0x07,0x92,0x02,
+    0xB3,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xF0,0x01,0xD6,0x23,0x50,0xFF,
+    0xFF,0x14,0x95,0x23,0xF0,0x01,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,
+    0xB2,0x02,0x51,0x02,0x35,0x24,0xB7,0x44,0xF2,0x01,0x72,0x02,0x91,0x02,0xB3,0x02,
+    0x93,0x02,0x31,0x02,0x7C,0xAE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x8B,0x00,0xFF,0xF7,
+    0x81,0x03,0x75,0x34,0xF0,0x01,0xD4,0x02,0xB3,0x02,0x81,0xC1,0x01,0x93,0x02,0xB2,
+    0x02,0xAA,0x00,0x78,0x34,0x83,0x00,0x92,0x02,0x86,0x03,0x92,0x02,0x93,0x02,0x31,
+    0x02,0x95,0x13,0x83,0x01,0x9A,0x65,0x31,0x02,0x42,0x93,0x02,0x42,0x92,0x02,0x47,
+    0xB2,0x02,0x07,0xB3,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0x32,
+    0x02,0x3C,0x9E,0x8A,0x05,0x94,0x2B,0xF0,0x01,0x93,0x02,0x92,0x02,0x92,0x02,0x93,
+    0x02,0x83,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x87,0xC1,0x85,0x03,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0x93,0x02,0x81,0x04,0xB2,0x02,0x91,0x02,0x73,0x02,0x72,0x02,0x3C,
+    0xCF,0x43,0xFF,0xFF,0x02,0xF4,0x0A,0x30,0x02,0xB2,0x02,0x81,0x04,0x93,0x02,0x92,
+    0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x81,0x01,0x93,0x02,0xB2,0x02,0x81,0x00,0xB3,
+    0x02,0x91,0x00,0x3D,0xCF,0xBF,0x25,0x00,0xB2,0x02,0x88,0x43,0xB2,0x02,0x43,0x92,
+    0x02,0x01,0x11,0x02,0xBA,0x75,0x81,0x00,0xDF,0xFF,0xBF,0x01,0x00,0xFE,0xFF,0x81,
+    0x02,0xF9,0x8D,0x51,0x02,0x91,0x02,0x81,0x05,0x93,0x02,0xB2,0x02,0xB2,0x02,0x93,
+    0x02,0x92,0x02,0xB2,0x02,0x43,0x92,0x02,0x01,0xB2,0x02,0xB2,0x02,0xAB,0x03,0x92,
+    0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x9A,0x00,0xFE,
+    0xFF,0x81,0x00,0xF3,0x0A,0xBF,0x09,0x0B,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB4,0x02,0xD0,0x01,0xF5,0x1B,0xFF,0xFF,
+    0xB3,0x9B,0x04,0x59,0x6D,0x10,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x82,0x42,0x92,
+    0x02,0x00,0xB2,0x02,0x88,0x08,0xB3,0x02,0x92,0x02,0x91,0x02,0xB3,0x02,0x74,0x02,
+    0x92,0x02,0xEF,0x01,0x98,0x3C,0xDF,0xEF,0x42,0xBE,0xE7,0x02,0xBF,0xDF,0x9F,0xE7,
+    0xDF,0xDF,0x42,0xBF,0xDF,0x05,0xBE,0xDF,0xBF,0xDF,0xFF,0xEF,0xD7,0x54,0x10,0x02,
+    0x91,0x02,0x83,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x8A,0x13,0x92,0x02,0x94,0x02,
+    0xB3,0x02,0xB2,0x02,0x32,0x02,0x74,0x13,0xBE,0xDF,0xDF,0xE7,0xBF,0xE7,0xBE,0xDF,
+    0xDF,0xE7,0xBF,0xE7,0xBE,0xE7,0xDF,0xDF,0xBF,0xE7,0x7F,0xE7,0xFF,0xE7,0xD9,0x75,
+    0x12,0x02,0x94,0x02,0x48,0xB2,0x02,0x0B,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0x51,0x02,0x73,0x02,0x1D,0xBF,0xFF,0xF7,0xDE,0xF7,
+    0x42,0xFF,0xEF,0x47,0xFF,0xF7,0x13,0xFF,0xEF,0xFF,0xFF,0x7C,0xA6,0x31,0x02,0x72,
+    0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x11,0x02,0x55,
+    0x2C,0xFF,0xFF,0x74,0x44,0xD0,0x01,0x73,0x02,0xD1,0x02,0x31,0x02,0x35,0x1B,0x42,
+    0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,0x4C,0xFF,0xFF,0x05,0x5C,0xBF,0x51,0x02,0x72,
+    0x02,0xB3,0x02,0x92,0x02,0x93,0x02,0x82,0x00,0xB2,0x02,0xAB,0x04,0x77,0x3C,0x10,
+    0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x46,0x92,0x02,0x01,0xB2,0x02,0x93,0x02,0x81,
+    0x00,0xB5,0x13,0x83,0x01,0x7A,0x65,0x31,0x02,0x44,0x92,0x02,0x00,0x93,0x02,0x81,
+    0x01,0x93,0x02,0x93,0x02,0x44,0xB2,0x02,0x81,0x04,0x92,0x02,0xB2,0x02,0x73,0x02,
+    0x91,0x02,0x1D,0xCF,0x8A,0x02,0x55,0x4C,0xF0,0x01,0xB2,0x02,0x42,0x92,0x02,0x00,
+    0x93,0x02,0x45,0x92,0x02,0x43,0xB2,0x02,0x46,0x92,0x02,0x01,0x93,0x02,0x93,0x02,
+    0x84,0xC1,0x08,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x10,0x02,0x95,0x23,0xDF,
+    0xFF,0xFF,0xFF,0xFF,0xF7,0x81,0x09,0x56,0x3C,0xB0,0x01,0xB3,0x02,0x93,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x81,0x04,0x72,0x02,0xB3,
+    0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0x94,0x42,0xB2,0x02,0x7F,0x22,0x92,0x02,0x46,
+    0xB2,0x02,0x43,0x92,0x02,0x43,0xB2,0x02,0x04,0x73,0x02,0x51,0x02,0xFB,0xB6,0xFF,
+    0xFF,0xDF,0xFF,0x7F,0x02,0xFF,0xFF,0x06,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xBE,0xE7,
+    0xB1,0x02,0x51,0x02,0xB2,0x02,0x47,0x92,0x02,0x00,0xB2,0x02,0x42,0x92,0x02,0x01,
+    0xB2,0x02,0xB2,0x02,0x8A,0xDF,0x01,0x92,0x02,0x92,0x02,0x84,0x00,0x92,0x02,0x9E,
+    0x00,0x31,0x02,0x83,0x00,0xB2,0x02,0x7F,0x05,0x92,0x02,0x02,0xB2,0x02,0xB2,0x02,
+    0x93,0x02,0x42,0x92,0x02,0x02,0x91,0x02,0xF0,0x01,0x7C,0xAE,0x74,0xFF,0xFF,0x97,
+    0x0A,0xFE,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xFF,0x5D,0xD7,0x73,0x02,0x52,0x02,0xB1,
+    0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x42,0x92,0x02,0x00,0x93,0x02,0x89,0x1A,0x93,
+    0x02,0x92,0x02,0xB1,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x91,0x02,0x91,0x02,0xF2,
+    0x12,0x12,0x0B,0xD2,0x0A,0xF3,0x0A,0xF2,0x0A,0x12,0x0B,0xF2,0x0A,0xF2,0x12,0xF2,
+    0x0A,0xD2,0x0A,0xF2,0x12,0xD2,0x0A,0x13,0x0B,0x92,0x02,0x73,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0x93,0x02,0x81,0x00,0x92,0x02,0x88,0x0D,0x92,0x02,0xB2,0x02,0xB2,
+    0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0x72,0x02,0x10,0x0B,0xF2,
+    0x0A,0xF3,0x0A,0xF2,0x0A,0xD2,0x0A,0x42,0xF2,0x0A,0x06,0xF3,0x0A,0xF2,0x0A,0x52,
+    0x0B,0x92,0x02,0x73,0x02,0x92,0x02,0x91,0x02,0x82,0x43,0x92,0x02,0x01,0xB2,0x02,
+    0xB2,0x02,0x83,0x0B,0x93,0x02,0xB3,0x02,0xB2,0x02,0x73,0x02,0xD3,0x0A,0x73,0x13,
+    0x33,0x13,0x33,0x13,0x53,0x13,0x32,0x13,0x53,0x13,0x33,0x13,0x46,0x53,0x13,0x12,
+    0x52,0x1B,0xF1,0x02,0x52,0x02,0x93,0x02,0x91,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,
+    0x92,0x02,0xB2,0x02,0x11,0x02,0xD4,0x23,0xFF,0xFF,0xFF,0xFF,0xB6,0x44,0xD0,0x01,
+    0x73,0x02,0xEF,0x01,0x59,0x65,0x51,0xFF,0xFF,0x03,0x76,0x3C,0xF1,0x01,0xB3,0x02,
+    0x92,0x02,0x81,0xC1,0x81,0x48,0x92,0x02,0xA2,0x03,0x77,0x34,0x10,0x02,0x93,0x02,
+    0x93,0x02,0x48,0x92,0x02,0x03,0xB3,0x02,0x93,0x02,0x11,0x02,0x95,0x1B,0x83,0x03,
+    0x7A,0x6D,0x10,0x02,0x73,0x02,0x93,0x02,0x81,0x01,0xB2,0x02,0xB2,0x02,0x44,0x92,
+    0x02,0x09,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x93,0x02,
+    0xB4,0x02,0x31,0x02,0x10,0x13,0x4B,0xFF,0xFF,0x05,0x9B,0x75,0xF1,0x01,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x84,0x4D,0x92,0x02,
+    0x0B,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xD2,
+    0x02,0xEF,0x01,0xDA,0x85,0xFF,0xFF,0xDF,0xF7,0x42,0xFF,0xFF,0x07,0x7C,0xAE,0x11,
+    0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x43,0xB2,0x02,
+    0x03,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x94,0x02,0x72,0x02,0x92,0x02,0x92,
+    0x02,0xBF,0x24,0x46,0x92,0x02,0x01,0xB2,0x02,0x92,0x02,0x42,0xB2,0x02,0x04,0x92,
+    0x02,0xB2,0x02,0x71,0x02,0xB3,0x0A,0xBE,0xEF,0xBF,0x04,0x06,0xFF,0xFF,0xFE,0xFF,
+    0xFE,0xFF,0xFF,0xFF,0x16,0x2C,0xD0,0x01,0x92,0x02,0x42,0xB2,0x02,0x04,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x85,0x00,0xB2,0x02,0x49,0x92,0x02,0xA1,
+    0xC2,0x04,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xF1,0x01,0x98,0xC1,0x02,0x7E,
+    0xE7,0xF2,0x0A,0x52,0x02,0x82,0x42,0xB2,0x02,0xBF,0x02,0x09,0xB3,0x02,0x93,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,0xB1,0x02,0x73,0x02,0x90,0x01,0x55,0x34,
+    0x43,0xFF,0xFF,0x00,0xFE,0xFF,0xB0,0x5C,0xFF,0xFF,0x04,0xD7,0x2B,0xF0,0x01,0xB3,
+    0x02,0xB2,0x02,0x93,0x02,0x83,0x01,0x92,0x02,0x93,0x02,0x87,0x02,0xB2,0x02,0xB2,
+    0x02,0x93,0x02,0x42,0x92,0x02,0x0C,0x93,0x02,0xB3,0x02,0x72,0x02,0x32,0x02,0x51,
+    0x02,0x52,0x02,0x52,0x02,0x51,0x02,0x52,0x02,0x51,0x02,0x72,0x02,0x52,0x02,0x51,
+    0x02,0x42,0x52,0x02,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0x85,0xC8,0x17,0xB2,0x02,
+    0xB3,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x91,0x02,0x92,0x02,0x92,0x02,0x93,0x02,
+    0x51,0x02,0x33,0x02,0x52,0x02,0x31,0x02,0x51,0x02,0x52,0x02,0x52,0x02,0x51,0x02,
+    0x52,0x02,0x52,0x02,0x32,0x02,0x72,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x81,0x45,
+    0x92,0x02,0x81,0x07,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,
+    0x92,0x02,0x53,0x02,0x43,0x32,0x02,0x49,0x31,0x02,0x0B,0x11,0x02,0x72,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0x32,
+    0x02,0xD5,0x23,0x42,0xFF,0xFF,0x03,0x18,0x55,0xB1,0x01,0x51,0x02,0x7E,0xDF,0x82,
+    0x01,0xFE,0xFF,0xFF,0xF7,0x89,0x05,0xFF,0xF7,0xFF,0xFF,0x1C,0xD7,0x90,0x02,0x73,
+    0x02,0xB2,0x02,0x81,0x03,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x49,0x92,0x02,
+    0xA2,0x01,0x78,0x34,0x11,0x02,0x4C,0x92,0x02,0x01,0x10,0x02,0x94,0x13,0x83,0x05,
+    0x79,0x6D,0x30,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0x72,0x0A,0x42,0x92,0x02,0x01,
+    0x93,0x02,0x92,0x02,0x42,0x93,0x02,0x81,0x06,0x93,0x02,0x94,0x02,0x93,0x02,0xB2,
+    0x02,0x93,0x02,0xD0,0x01,0xF6,0x44,0x8B,0x0C,0x3E,0xBF,0x72,0x02,0x53,0x02,0xB1,
+    0x02,0x73,0x02,0x92,0x02,0xB1,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x91,
+    0x02,0xB1,0x02,0x53,0x92,0x02,0x19,0xB3,0x02,0x92,0x02,0xB2,0x02,0xEF,0x01,0x74,
+    0x0B,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFD,0xFF,0xFF,0xFF,0x75,
+    0x13,0xEE,0x01,0xB2,0x02,0x92,0x02,0x92,0x02,0x94,0x02,0xB2,0x02,0x91,0x02,0x91,
+    0x02,0x93,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x01,0x3D,0xD7,0x92,
+    0x02,0x81,0x01,0x93,0x02,0x93,0x02,0x7F,0x29,0x92,0x02,0x00,0xB3,0x02,0x81,0xC1,
+    0x08,0xB2,0x02,0xB3,0x02,0xB2,0x02,0xD0,0x01,0x57,0x34,0xFF,0xFF,0xFF,0xFF,0xFE,
+    0xFF,0xFE,0xF7,0xBF,0x03,0x06,0xFF,0xFF,0xDF,0xFF,0xDC,0xB6,0x30,0x02,0x71,0x02,
+    0xB2,0x02,0x92,0x02,0x81,0x03,0x93,0x02,0x93,0x02,0x72,0x02,0x92,0x02,0x42,0xB3,
+    0x02,0x00,0x93,0x02,0x43,0x92,0x02,0x00,0xB2,0x02,0x67,0x92,0x02,0x42,0xB2,0x02,
+    0x82,0x01,0x92,0x02,0x91,0x02,0x9C,0x02,0x7E,0xEF,0xF2,0x0A,0x72,0x02,0x85,0x00,
+    0xB2,0x02,0xBF,0x01,0x09,0x91,0x02,0xB2,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0x92,
+    0x02,0xD3,0x02,0xF1,0x01,0x32,0x0B,0xDF,0xEF,0x81,0x00,0xFE,0xFF,0x72,0xFF,0xFF,
+    0x9C,0x06,0x1B,0x8E,0xF0,0x01,0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,
+    0x81,0x00,0xB2,0x02,0x48,0x92,0x02,0x00,0xB2,0x02,0x42,0x92,0x02,0x09,0x93,0x02,
+    0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0x45,0x92,0x02,0x07,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,
+    0x93,0x02,0x92,0x02,0xB2,0x02,0x81,0x00,0xB2,0x02,0x49,0x92,0x02,0x14,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0xB3,0x02,0xB2,0x02,0x45,0x92,0x02,0x00,0xB2,0x02,0x43,0x92,
+    0x02,0x03,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x43,0x92,0x02,0x00,0xB1,0x02,
+    0x42,0xB2,0x02,0x01,0x92,0x02,0x93,0x02,0x46,0xB2,0x02,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0x45,0x92,0x02,0x00,0xB2,0x02,0x81,0x00,0x11,0x02,0x83,0x02,0xFF,0xFF,
+    0x96,0x34,0x15,0x2C,0x4E,0xFF,0xFF,0x00,0xDF,0xFF,0x81,0x04,0x76,0x44,0xEF,0x01,
+    0xB3,0x02,0x92,0x02,0xB2,0x02,0x81,0x00,0x92,0x02,0x82,0x00,0xB2,0x02,0xAA,0x06,
+    0x57,0x3C,0xF0,0x01,0x92,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0x83,0x05,
+    0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x11,0x02,0x95,0x13,0x81,0x09,0xDF,0xFF,
+    0xFF,0xFF,0x7A,0x6D,0xF2,0x01,0x92,0x02,0x92,0x02,0xB2,0x02,0xB1,0x02,0xB2,0x02,
+    0x93,0x02,0x43,0x92,0x02,0x03,0x93,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x43,0x92,
+    0x02,0x02,0x32,0x02,0x51,0x02,0x5D,0xDF,0x4C,0xFF,0xFF,0x0A,0xB5,0x23,0xF2,0x01,
+    0x92,0x02,0xB1,0x02,0x93,0x02,0x93,0x02,0x73,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,
+    0x93,0x02,0x4B,0x92,0x02,0x01,0x93,0x02,0x93,0x02,0x82,0x08,0x93,0x02,0xB3,0x02,
+    0x93,0x02,0x72,0x02,0xB2,0x02,0xD2,0x02,0x52,0x02,0x10,0x02,0xBC,0xB6,0x44,0xFF,
+    0xFF,0x08,0xFE,0xFF,0xFF,0xFF,0x5A,0x96,0xF0,0x01,0x73,0x02,0xB2,0x02,0x93,0x02,
+    0x92,0x02,0xB3,0x02,0x42,0x92,0x02,0x00,0x93,0x02,0x81,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x91,0x02,0x1C,0xD7,0xB2,0x02,0x91,0x02,0xBF,0x2C,0x09,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x52,0x02,0x11,0x02,0xDC,
+    0xB6,0x82,0x7F,0x03,0xFF,0xFF,0x0D,0xDF,0xFF,0xFF,0xF7,0xFD,0xFF,0xFF,0xFF,0x39,
+    0x4D,0xAF,0x01,0x71,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0x43,0xB2,0x02,0x71,0x92,0x02,0x03,0xB2,0x02,0xB3,0x02,0xB3,0x02,
+    0x93,0x02,0x9C,0x00,0xF3,0x0A,0xBF,0x07,0x0F,0x93,0x02,0x93,0x02,0xB3,0x02,0x93,
+    0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0xD0,0x01,0xF2,0x12,0x7D,0xDF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xBF,0xFF,0xB1,0x9C,0x03,0xDE,0xF7,0x13,0x0B,
+    0x12,0x02,0xB2,0x02,0x43,0x92,0x02,0x00,0xB2,0x02,0x8A,0x03,0xB2,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x81,0xC1,0x0D,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x93,
+    0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB3,
+    0x02,0x92,0x02,0x84,0x03,0xB3,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x87,0x0A,0x93,
+    0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB3,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0x93,
+    0x02,0x92,0x02,0x92,0x02,0x42,0x93,0x02,0x01,0x92,0x02,0xB2,0x02,0x81,0x04,0x93,
+    0x02,0xB2,0x02,0x91,0x02,0x93,0x02,0xB3,0x02,0x45,0x92,0x02,0x03,0xB2,0x02,0xB2,
+    0x02,0x92,0x02,0x93,0x02,0x81,0x0B,0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,
+    0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x85,
+    0x43,0x92,0x02,0x03,0xB2,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0x42,0x92,0x02,0x00,
+    0x93,0x02,0x84,0x03,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xE7,0x50,0xFF,0xFF,0x0A,
+    0x5D,0xDF,0x91,0x02,0x32,0x02,0x73,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0x92,0x02,0xAC,0x04,0x78,0x34,0x10,0x02,0x93,0x02,0xB2,0x02,
+    0x92,0x02,0x82,0x01,0xB2,0x02,0x92,0x02,0x42,0xB2,0x02,0x02,0xB1,0x02,0x93,0x02,
+    0x30,0x02,0x82,0xC1,0x09,0x9A,0x65,0x11,0x02,0x92,0x02,0x93,0x02,0xB3,0x02,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x43,0x92,0x02,0x42,0x93,0x02,0x04,
+    0xB2,0x02,0xB2,0x02,0x31,0x02,0xCF,0x01,0xB8,0x75,0x4B,0xFF,0xFF,0x07,0xDE,0xFF,
+    0xFF,0xFF,0xDC,0xB6,0x2E,0x02,0x31,0x02,0xD3,0x02,0x93,0x02,0x92,0x02,0x42,0xB2,
+    0x02,0x02,0xB1,0x02,0xB2,0x02,0x93,0x02,0x81,0x46,0xB2,0x02,0x00,0x92,0x02,0x43,
+    0x93,0x02,0x81,0x1F,0x91,0x02,0x91,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0xEF,0x01,
+    0xF2,0x01,0xBA,0x7D,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0x77,0x34,0xCF,0x01,0xB3,0x02,0xB3,0x02,0x92,0x02,
+    0x92,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x72,0x02,
+    0x92,0x02,0x92,0x02,0x91,0x05,0x1D,0xD7,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0xBF,0x25,0x43,0xB2,0x02,0x43,0x92,0x02,0x07,0xB3,0x02,0x92,0x02,0x11,
+    0x02,0xD0,0x01,0x58,0x5D,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x7F,0x05,0xFF,0xFF,0x13,
+    0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xB6,0x4C,0xEE,0x01,0x12,0x02,0x92,0x02,
+    0xD2,0x02,0x71,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x72,0x02,0x72,0x02,
+    0x92,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0xAC,0x06,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0x93,0x02,0x93,0x02,0xB2,0x02,0x10,0x02,0x9A,0x02,0x9E,0xE7,0xF4,0x0A,0x52,0x02,
+    0x86,0x00,0x93,0x02,0xB7,0x47,0x93,0x02,0x0B,0xB2,0x02,0xB2,0x02,0x93,0x02,0x72,
+    0x02,0x2F,0x02,0xF0,0x01,0x94,0x23,0x9E,0xE7,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xDF,
+    0xFF,0x73,0xFF,0xFF,0x5D,0xFF,0xFF,0x05,0xF7,0x54,0xF1,0x01,0xB3,0x02,0x92,0x02,
+    0xB2,0x02,0xB3,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x81,0x01,0xB2,0x02,0xB2,0x02,
+    0x82,0x00,0xB2,0x02,0x7F,0x28,0x92,0x02,0x00,0xB2,0x02,0x84,0xD4,0x02,0xD7,0x3C,
+    0x10,0x02,0x94,0x02,0x51,0x92,0x02,0xA2,0x03,0x97,0x34,0x10,0x02,0x73,0x02,0x93,
+    0x02,0x46,0x92,0x02,0x05,0x93,0x02,0x93,0x02,0x74,0x02,0xD2,0x02,0x30,0x02,0x94,
+    0x13,0x83,0x04,0x99,0x5D,0x30,0x02,0x93,0x02,0x92,0x02,0x93,0x0A,0x42,0xB2,0x02,
+    0x0E,0x92,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0x72,0x02,0x93,
+    0x02,0x94,0x02,0x52,0x02,0xCF,0x01,0x51,0x02,0x99,0x75,0xFF,0xFF,0xFF,0xF7,0x8A,
+    0x0E,0xBF,0xFF,0xFF,0xFF,0xFF,0xFF,0x79,0x96,0x73,0x02,0xB1,0x01,0x30,0x02,0xD2,
+    0x02,0xD2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x45,
+    0x92,0x02,0x0F,0x93,0x02,0xB3,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0x92,0x02,0x72,0x02,0x73,0x02,0x94,0x02,0x72,0x02,0x0F,0x02,0xCF,0x01,0xF3,
+    0x0A,0x5A,0x9E,0x49,0xFF,0xFF,0x04,0xDF,0xFF,0x94,0x23,0xAF,0x01,0x93,0x02,0xB2,
+    0x02,0x42,0x92,0x02,0x82,0x05,0xB3,0x02,0x92,0x02,0x92,0x02,0xB3,0x02,0x0F,0x02,
+    0x59,0x55,0x8F,0x04,0x3D,0xD7,0x93,0x0A,0x73,0x02,0xB3,0x02,0x92,0x02,0x7F,0x25,
+    0x93,0x02,0x11,0x94,0x02,0x93,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0x73,0x02,0x73,
+    0x02,0x72,0x02,0x31,0x02,0xEF,0x01,0xEF,0x01,0x91,0x0A,0x99,0x75,0xFF,0xFF,0xFF,
+    0xFF,0xDF,0xFF,0xFF,0xF7,0xFF,0xF7,0xBF,0x03,0x11,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xD9,0x85,0x12,0x0B,0xEE,0x01,0xF0,0x01,0x53,0x02,
+    0x94,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0x42,0x92,
+    0x02,0x00,0xB2,0x02,0xA9,0x03,0xB2,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x42,0x92,
+    0x02,0x01,0x91,0x02,0x11,0x02,0x9A,0x03,0x9D,0xDF,0x14,0x03,0x32,0x02,0xB2,0x02,
+    0x81,0x00,0x93,0x02,0x81,0x01,0x92,0x02,0x92,0x02,0x6F,0x93,0x02,0x03,0x92,0x02,
+    0xB2,0x02,0xB2,0x02,0x92,0x02,0x42,0xB2,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x42,
+    0xB3,0x02,0x0C,0x93,0x02,0x73,0x02,0x50,0x02,0x0F,0x02,0xAF,0x01,0x31,0x02,0x52,
+    0x13,0xD9,0x85,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xFF,0xFE,0xFF,0xB4,0x9B,0x0E,
+    0xDF,0xFF,0xFF,0xFF,0x5E,0xD7,0x93,0x02,0x52,0x02,0xB1,0x02,0x92,0x02,0x93,0x02,
+    0x93,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x82,0x00,
+    0xB2,0x02,0xBF,0x29,0x00,0x93,0x02,0x86,0x00,0xDF,0xFF,0x90,0x04,0x5E,0xDF,0x92,
+    0x02,0x53,0x02,0x92,0x02,0xB1,0x02,0xB3,0x02,0x96,0x2C,0x10,0x02,0xB2,0x02,0x81,
+    0x48,0x93,0x02,0x03,0x91,0x02,0x30,0x02,0x77,0x1B,0xDF,0xFF,0x82,0x05,0x78,0x5D,
+    0xAF,0x01,0x13,0x02,0x52,0x02,0x52,0x02,0x72,0x02,0x42,0x52,0x02,0x0F,0x53,0x02,
+    0x52,0x02,0x52,0x02,0x53,0x02,0x31,0x02,0xEF,0x01,0xEF,0x01,0x51,0x02,0x14,0x13,
+    0x56,0x4C,0x5E,0xD7,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0x88,0x0D,
+    0xFE,0xF7,0xFF,0xF7,0xFE,0xFF,0xFF,0xFF,0x5E,0xDF,0x96,0x44,0xF3,0x0A,0x0F,0x02,
+    0xEF,0x01,0xF1,0x01,0x33,0x02,0x73,0x02,0x93,0x02,0x92,0x02,0x42,0x73,0x02,0x02,
+    0x93,0x02,0x93,0x02,0x92,0x02,0x42,0x72,0x02,0x42,0x52,0x02,0x0A,0x31,0x02,0x31,
+    0x02,0x30,0x02,0x0F,0x02,0xF0,0x01,0x10,0x02,0xF2,0x0A,0xF4,0x1B,0x78,0x7D,0xFF,
+    0xF7,0xFE,0xFF,0x88,0x11,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0x58,0x3C,0xEF,0x01,0xCF,
+    0x01,0xF1,0x01,0x30,0x02,0x31,0x02,0x52,0x02,0x52,0x02,0x31,0x02,0x51,0x02,0x32,
+    0x02,0x32,0x02,0x51,0x02,0xB0,0x01,0xF9,0x4C,0x8D,0x06,0xFE,0xFF,0xFF,0xFF,0xFC,
+    0xC6,0xEE,0x01,0xAF,0x01,0xEF,0x01,0x10,0x02,0x7F,0x21,0xF0,0x01,0x00,0x10,0x02,
+    0x43,0x0F,0x02,0x11,0xEF,0x01,0x0F,0x02,0xEF,0x01,0x2F,0x02,0x4F,0x02,0xB2,0x0A,
+    0x14,0x0B,0x96,0x13,0x56,0x3C,0x57,0x75,0xBF,0xE7,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDE,0xFF,0xBF,0x05,0x10,0xFF,0xFF,0xFF,0xF7,0xFF,
+    0xFF,0xFF,0xFF,0xFE,0xF7,0x78,0x7D,0xB6,0x23,0xD2,0x0A,0x2F,0x02,0xF0,0x01,0x10,
+    0x02,0x10,0x02,0x31,0x02,0x71,0x02,0x72,0x02,0x93,0x02,0x73,0x02,0x6F,0x93,0x02,
+    0x05,0x94,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0xD3,0x01,0xF7,0x23,0x96,0x00,0xFF,
+    0xF7,0x81,0x02,0x7F,0xE7,0x71,0x02,0xB2,0x01,0x42,0xF0,0x01,0x04,0x11,0x02,0x11,
+    0x02,0x10,0x02,0x11,0x02,0xF0,0x01,0x6F,0x10,0x02,0x07,0xF1,0x01,0x10,0x02,0x11,
+    0x02,0x11,0x02,0x10,0x02,0xF0,0x01,0xF0,0x01,0xF1,0x01,0x42,0xF0,0x01,0x08,0x10,
+    0x02,0x0F,0x02,0xEF,0x01,0x30,0x02,0x92,0x0A,0x14,0x13,0xD6,0x23,0x17,0x4D,0x5A,
+    0xA6,0x42,0xFF,0xFF,0x00,0xFF,0xF7,0x77,0xFF,0xFF,0x9D,0x05,0xFF,0xFF,0x16,0x34,
+    0xF0,0x01,0xB2,0x02,0x92,0x02,0xB3,0x02,0x43,0x92,0x02,0x83,0xC2,0x7F,0x29,0x92,
+    0x02,0x00,0xB2,0x02,0x86,0x01,0xFF,0xFF,0xFE,0xFF,0x8F,0x05,0xD7,0x44,0xF1,0x01,
+    0x93,0x02,0x91,0x02,0xB2,0x02,0x93,0x02,0xB2,0x04,0xF5,0x2B,0x4E,0x01,0x11,0x02,
+    0x10,0x02,0x0F,0x02,0x45,0x10,0x02,0x1B,0x0F,0x02,0x0F,0x02,0xF0,0x01,0xF0,0x01,
+    0x8F,0x01,0x14,0x0B,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xB9,0x7D,0x70,0x0A,
+    0xF4,0x0A,0x12,0x0B,0x32,0x0B,0x13,0x0B,0xF3,0x12,0x13,0x0B,0xF3,0x0A,0x12,0x0B,
+    0x13,0x13,0xF3,0x0A,0x12,0x0B,0x94,0x1B,0x58,0x2C,0x58,0x65,0x59,0xB6,0xDE,0xFF,
+    0x42,0xFF,0xFF,0x02,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0x4C,0xFF,0xFF,0x22,0xFE,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0x9E,0xF7,0xF9,0x8D,0x76,0x3C,0x95,0x1B,0x13,0x0B,0x71,0x02,
+    0x2F,0x02,0x2F,0x02,0x30,0x02,0x50,0x02,0x30,0x02,0x30,0x02,0x2F,0x02,0x70,0x02,
+    0xB1,0x0A,0xB1,0x02,0x90,0x0A,0xD1,0x0A,0x12,0x13,0xF2,0x0A,0x54,0x1B,0x96,0x1B,
+    0x17,0x24,0xB9,0x3C,0x79,0x6D,0x19,0x9E,0x5D,0xE7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFE,0xFF,0xFE,0xFF,0x48,0xFF,0xFF,0x10,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x7A,0xA6,
+    0x58,0x3C,0xB7,0x1B,0x75,0x13,0x12,0x13,0x12,0x0B,0xF2,0x0A,0xF2,0x0A,0x12,0x0B,
+    0x13,0x13,0xF2,0x12,0xF2,0x0A,0x71,0x0A,0x7A,0x6D,0x4F,0xFF,0xFF,0x05,0x9E,0xEF,
+    0x99,0x6D,0x79,0x65,0xB9,0x6D,0x99,0x6D,0x99,0x75,0x7F,0x20,0x99,0x6D,0x0B,0x9A,
+    0x75,0x99,0x6D,0x99,0x6D,0xB9,0x6D,0xB9,0x6D,0x98,0x6D,0xB8,0x7D,0xD8,0x85,0x19,
+    0x96,0x9B,0xB6,0x1C,0xD7,0xBE,0xF7,0x47,0xFF,0xFF,0x01,0xDE,0xFF,0xFF,0xF7,0xBF,
+    0x02,0x07,0xDF,0xFF,0xFF,0xFF,0xFE,0xF7,0xFF,0xFF,0xBF,0xFF,0xDF,0xFF,0xFE,0xFF,
+    0xFD,0xFF,0x42,0xFF,0xFF,0x0B,0x5C,0xEF,0x39,0x96,0x39,0x65,0x76,0x3C,0xD4,0x23,
+    0x74,0x13,0x12,0x13,0xB1,0x0A,0x71,0x0A,0x2F,0x02,0x2F,0x02,0x30,0x02,0x6D,0x2F,
+    0x02,0x07,0x30,0x02,0x2F,0x02,0x2E,0x02,0x2F,0x02,0x8E,0x01,0x93,0x2B,0xFF,0xFF,
+    0xFE,0xFF,0x57,0xFF,0xFF,0x05,0xBE,0xEF,0x14,0x2C,0xB6,0x23,0xF6,0x23,0xF6,0x23,
+    0xD6,0x23,0x74,0xF6,0x23,0x00,0xD6,0x23,0x43,0xF6,0x23,0x0A,0xD5,0x23,0xD5,0x23,
+    0x58,0x34,0x79,0x34,0x98,0x34,0xD9,0x4C,0x19,0x5D,0x79,0x6D,0xD9,0x85,0x59,0xA6,
+    0xFC,0xC6,0x46,0xFF,0xFF,0x00,0xDF,0xFF,0xB7,0x5C,0xFF,0xFF,0x0A,0xDE,0xFF,0xFF,
+    0xFF,0xDC,0xAE,0x31,0x02,0x72,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0x92,
+    0x02,0x93,0x02,0x43,0x92,0x02,0x81,0x7F,0x2A,0x92,0x02,0x87,0x01,0xFE,0xFF,0xDE,
+    0xFF,0x8E,0x06,0x7F,0xE7,0x91,0x02,0x51,0x02,0xB2,0x02,0x74,0x02,0xB3,0x02,0xB2,
+    0x02,0xB0,0x06,0xFE,0xFF,0xFE,0xFF,0xFA,0x8D,0x78,0x44,0x39,0x45,0xFA,0x4C,0xF9,
+    0x4C,0x48,0x18,0x4D,0x03,0xF9,0x4C,0xB6,0x44,0x9A,0x65,0xDF,0xFF,0x81,0x05,0xDE,
+    0xFF,0xBE,0xF7,0x7E,0xDF,0x9D,0xDF,0x7C,0xEF,0x9D,0xEF,0x44,0x9D,0xE7,0x02,0x9E,
+    0xE7,0x7D,0xDF,0xBE,0xEF,0x45,0xFF,0xFF,0x00,0xDF,0xFF,0x82,0xCD,0x02,0xDF,0xF7,
+    0xFE,0xFF,0xFE,0xFF,0x43,0xFF,0xFF,0x0F,0x5D,0xE7,0xDB,0xBE,0x7A,0xAE,0x7B,0xA6,
+    0x59,0x96,0x7A,0xA6,0x9A,0xAE,0x7A,0xAE,0x79,0xB6,0xDB,0xC6,0x1C,0xCF,0x1C,0xC7,
+    0x1C,0xC7,0x5D,0xDF,0x9E,0xEF,0x9D,0xEF,0x45,0xFF,0xFF,0x00,0xFE,0xFF,0x42,0xFF,
+    0xFF,0x01,0xFE,0xFF,0xDF,0xFF,0x88,0x01,0xDF,0xFF,0xFE,0xFF,0x44,0xFF,0xFF,0x09,
+    0xBE,0xEF,0x7D,0xE7,0x9D,0xE7,0x9E,0xE7,0x9E,0xE7,0x9D,0xE7,0x9D,0xE7,0x9D,0xDF,
+    0x9D,0xE7,0x9F,0xF7,0x8F,0x03,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x7F,0x2B,
+    0xFF,0xFF,0x00,0xDF,0xFF,0x45,0xFF,0xFF,0x04,0xFF,0xF7,0xBF,0xFF,0xDF,0xFF,0xFF,
+    0xF7,0xFE,0xFF,0x7F,0x05,0xFF,0xFF,0x81,0x05,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,
+    0xF7,0xDF,0xFF,0xDF,0xFF,0x45,0xFF,0xFF,0x07,0xDF,0xFF,0x7D,0xEF,0x3C,0xD7,0x1C,
+    0xC7,0x9A,0xAE,0x7A,0xA6,0x9A,0xAE,0x99,0xAE,0x67,0x7A,0xAE,0x47,0x9A,0xAE,0x03,
+    0x7A,0xAE,0x59,0x96,0xFC,0xC6,0xFE,0xFF,0x58,0xFF,0xFF,0x00,0xFE,0xFF,0x7F,0x0C,
+    0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,0x43,0xFF,0xFF,0x03,0xDE,0xFF,0xDF,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0xB3,0x5D,0xFF,0xFF,0x0E,0xDF,0xFF,0xFF,0xFF,0xD5,0x23,0x10,0x02,
+    0x93,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x93,0x02,0x92,0x02,0x81,0x00,0xB2,0x02,0xBF,0x30,0xD0,0x05,0xB7,0x5C,
+    0xD0,0x01,0xB2,0x02,0xB0,0x02,0xD3,0x02,0x93,0x02,0x50,0x92,0x02,0xA0,0x01,0xFF,
+    0xFF,0xFE,0xFF,0x64,0xFF,0xFF,0x00,0xDF,0xFF,0x43,0xFF,0xFF,0x8F,0x04,0xFF,0xFF,
+    0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x54,0xFF,0xFF,0x00,0xFE,0xFF,0x43,0xFF,
+    0xFF,0x00,0xDF,0xFF,0x4E,0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,0x50,0xFF,0xFF,0x00,
+    0xFF,0xF7,0x4D,0xFF,0xFF,0x00,0xFE,0xFF,0x7F,0x2D,0xFF,0xFF,0x00,0xDF,0xFF,0x46,
+    0xFF,0xFF,0x01,0xFF,0xF7,0xFE,0xFF,0x7F,0x08,0xFF,0xFF,0x05,0xDF,0xFF,0xBF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0x7E,0xFF,0xFF,0x00,0xDF,0xFF,0x81,0x00,
+    0xDF,0xFF,0x92,0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x7F,0x10,0xFF,0xFF,
+    0x00,0xFF,0xF7,0x77,0xFF,0xFF,0x5F,0xFF,0xFF,0x08,0x9B,0xA6,0x2F,0x02,0x73,0x02,
+    0xD3,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x72,0x02,0x81,0x00,0x92,0x02,
+    0xBF,0x44,0x07,0xDD,0xBE,0x2F,0x02,0x31,0x02,0x72,0x02,0x93,0x02,0xB2,0x02,0x92,
+    0x02,0x93,0x02,0xB1,0xF5,0x00,0xFF,0xF7,0x74,0xFF,0xFF,0x00,0xFE,0xFF,0x7F,0xFF,
+    0x8A,0xFF,0xFF,0x9E,0x08,0xFE,0xFF,0xFF,0xFF,0xB5,0x23,0xF0,0x01,0x92,0x02,0x92,
+    0x0A,0x93,0x02,0xB2,0x02,0xD2,0x02,0x42,0x93,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,
+    0xBF,0x29,0x00,0x93,0x02,0x96,0x05,0xF8,0xAD,0xD3,0x0A,0x72,0x02,0xEF,0x01,0xF1,
+    0x01,0x51,0x02,0xB8,0x00,0xFE,0xFF,0x8D,0x00,0xDF,0xFF,0x90,0x00,0xDF,0xFF,0x7F,
+    0x04,0xFF,0xFF,0x00,0xDF,0xFF,0x7F,0xFF,0x43,0xFF,0xFF,0x00,0xDF,0xFF,0xBF,0x07,
+    0x9B,0x00,0xDF,0xFF,0x43,0xFF,0xFF,0x03,0xBD,0xA6,0x31,0x02,0x73,0x02,0x93,0x02,
+    0x42,0x92,0x02,0x03,0xB3,0x02,0x73,0x02,0x93,0x02,0xB2,0x02,0xBF,0x2C,0xC1,0x95,
+    0xC1,0x05,0xDE,0xB6,0x37,0x65,0xB5,0x2B,0x54,0x0B,0xD1,0x02,0x73,0x02,0xB6,0xF3,
+    0x00,0xDF,0xFF,0x7F,0xFF,0x7F,0xFF,0xFF,0x00,0xDF,0xFF,0xBC,0x61,0xFF,0xFF,0x06,
+    0x15,0x24,0xF1,0x01,0xD3,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xB1,0x02,0x43,0xB2,
+    0x02,0x00,0x93,0x02,0x7F,0x2B,0x92,0x02,0x00,0xB2,0x02,0x96,0x00,0xFE,0xFF,0x42,
+    0xFF,0xFF,0x02,0xDD,0xA6,0xB1,0x02,0x72,0x02,0xBF,0x2B,0xFF,0xFF,0xBE,0xA1,0x05,
+    0x3D,0xBF,0x51,0x02,0x71,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0x44,0xB2,0x02,0x02,
+    0x92,0x02,0x92,0x02,0xB2,0x02,0xBF,0x40,0x07,0xDF,0xFF,0xBE,0xFF,0xDF,0xFF,0xFF,
+    0xFF,0x9C,0xAE,0xF2,0x12,0x51,0x02,0xB3,0x02,0xBF,0xFF,0xFF,0x2A,0x9F,0x0A,0xDF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0x97,0x3C,0xEE,0x01,0xB3,0x02,0x93,0x02,0x72,0x02,0x92,
+    0x02,0x92,0x02,0x93,0x02,0x82,0x00,0x93,0x02,0xBF,0x41,0xC2,0x03,0xFA,0x8D,0x30,
+    0x02,0x10,0x02,0x93,0x02,0x50,0x92,0x02,0xBF,0xFF,0xFF,0x1A,0x62,0xFF,0xFF,0x08,
+    0xBF,0xDF,0xB1,0x0A,0x31,0x02,0xB3,0x02,0xB3,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,
+    0x92,0x02,0xBF,0x3D,0x00,0xDF,0xFF,0x81,0x01,0xFF,0xF7,0xFE,0xFF,0x83,0x05,0x98,
+    0x75,0x10,0x02,0x31,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xBF,0xFF,0xFF,0x2A,0x63,
+    0xFF,0xFF,0x05,0xDB,0x6D,0xF1,0x01,0x91,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x44,
+    0x92,0x02,0x00,0x93,0x02,0xBF,0x39,0x03,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0x43,0xFF,0xFF,0x05,0xF6,0x5C,0x0F,0x02,0x72,0x02,0x74,0x02,0xB2,0x02,0x91,0x02,
+    0x50,0x92,0x02,0xBF,0xFF,0xFF,0x1A,0x64,0xFF,0xFF,0x03,0x95,0x1B,0xEF,0x01,0xB1,
+    0x02,0xB3,0x02,0x82,0x00,0x93,0x02,0x7F,0x2C,0x92,0x02,0x90,0xC1,0x00,0xFE,0xFF,
+    0x82,0x06,0x75,0x3C,0xF0,0x01,0x73,0x02,0xD3,0x02,0x92,0x02,0x92,0x02,0x93,0x02,
+    0xBF,0xFF,0xFF,0x2B,0xA2,0x05,0xDF,0xFF,0xFF,0xFF,0x1D,0xB7,0x31,0x02,0x51,0x02,
+    0x93,0x02,0x7F,0x30,0x92,0x02,0x92,0xC2,0x08,0x14,0x1C,0xD0,0x01,0x74,0x02,0x93,
+    0x02,0x90,0x02,0x92,0x02,0x94,0x02,0x92,0x02,0xB1,0x02,0xBF,0xFF,0xFF,0x2A,0x63,
+    0xFF,0xFF,0x04,0xFE,0xFF,0xFF,0xFF,0x19,0x55,0xF0,0x01,0xB3,0x02,0x82,0x43,0xB2,
+    0x02,0xBF,0x3D,0x09,0xBE,0xDF,0x53,0x1B,0xD1,0x01,0x73,0x02,0x91,0x02,0x91,0x02,
+    0x93,0x02,0xD3,0x02,0x93,0x02,0x72,0x0A,0x50,0x92,0x02,0xBF,0xFF,0xFF,0x1A,0xA2,
+    0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x05,0x74,0x13,0x11,0x02,0xB2,0x02,0x93,0x02,0x92,
+    0x02,0x93,0x02,0x43,0x92,0x02,0x00,0xB2,0x02,0x81,0x02,0xB2,0x02,0x92,0x02,0xB2,
+    0x02,0xBF,0x35,0x0B,0x1D,0xCF,0x13,0x13,0xD0,0x01,0x93,0x02,0x92,0x02,0x93,0x02,
+    0xB3,0x02,0x94,0x02,0x93,0x02,0x91,0x02,0x92,0x02,0xB3,0x02,0xBF,0x04,0x00,0xDF,
+    0xFF,0xBF,0x1B,0x00,0xDF,0xFF,0xBF,0xFF,0x88,0xA2,0x0C,0xDE,0xFF,0xFE,0xFF,0xDF,
+    0xFF,0xFF,0xFF,0x3D,0xB7,0x31,0x02,0x32,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0xB2,0x02,0xBF,0x3B,0x0C,0xBC,0xAE,0x92,0x0A,0xF0,0x01,0xB3,0x02,
+    0x91,0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x74,0x02,0xB2,0x02,0xB1,0x02,
+    0x93,0x02,0xBF,0x04,0xFF,0x34,0x00,0xDF,0xFF,0xBF,0xFF,0x70,0x63,0xFF,0xFF,0x08,
+    0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0x79,0x75,0xD0,0x01,0x92,0x02,0x92,0x02,
+    0xB3,0x02,0x81,0x00,0x73,0x02,0xBF,0x34,0x00,0xDF,0xFF,0x81,0x00,0xFE,0xFF,0x81,
+    0x0A,0x3B,0x8E,0x70,0x02,0x11,0x02,0x94,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x92,
+    0x02,0xB1,0x02,0x92,0x02,0x93,0x02,0x81,0x50,0x92,0x02,0xAA,0x00,0xDF,0xFF,0x86,
+    0x00,0xDF,0xFF,0x90,0x00,0xFF,0xF7,0xB7,0x00,0xDF,0xFF,0x69,0xFF,0xFF,0x02,0xDF,
+    0xFF,0xFF,0xFF,0xFF,0xF7,0x83,0x00,0xDF,0xFF,0xBF,0x2A,0x00,0xDF,0xFF,0x81,0x00,
+    0xFE,0xFF,0xA6,0x00,0xFE,0xFF,0x87,0x00,0xFE,0xFF,0x8C,0x01,0xDF,0xFF,0xDF,0xFF,
+    0xAC,0x00,0xFE,0xFF,0xBF,0x33,0x03,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0x84,
+    0x00,0xDF,0xFF,0x82,0x00,0xFE,0xFF,0xBF,0x0A,0xA5,0xC2,0x06,0x15,0x24,0xD0,0x01,
+    0xB2,0x02,0x93,0x02,0xB3,0x02,0x92,0x02,0x93,0x02,0x83,0xFF,0x25,0x89,0x00,0xDE,
+    0xFF,0x42,0xFF,0xFF,0x81,0x02,0xBB,0x7D,0x10,0x02,0x0F,0x02,0x42,0x93,0x02,0x08,
+    0x92,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,
+    0xB2,0x02,0xAC,0x03,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x88,0x00,0xDE,0xFF,
+    0x84,0x00,0xDF,0xFF,0x43,0xFF,0xFF,0x00,0xFF,0xF7,0x8D,0x02,0xFF,0xF7,0xFF,0xF7,
+    0xDF,0xFF,0x89,0x00,0xDF,0xFF,0x81,0x00,0xDF,0xFF,0x82,0x00,0xFE,0xFF,0x87,0x00,
+    0xFE,0xFF,0x81,0x00,0xFF,0xF7,0x81,0x00,0xFE,0xFF,0x83,0x00,0xFE,0xFF,0xAD,0x00,
+    0xDF,0xFF,0x84,0x00,0xFE,0xFF,0x88,0x00,0xFE,0xFF,0x81,0x01,0xFE,0xFF,0xFE,0xFF,
+    0x81,0x00,0xFE,0xF7,0x83,0x00,0xFE,0xF7,0x8D,0x00,0xDF,0xFF,0x86,0x00,0xFF,0xF7,
+    0x8A,0x00,0xFE,0xFF,0x82,0x00,0xDE,0xFF,0x82,0x03,0xFF,0xF7,0xFF,0xFF,0xFE,0xFF,
+    0xFE,0xFF,0x88,0x05,0xDF,0xFF,0xDE,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,
+    0x95,0x00,0xDF,0xFF,0x82,0x00,0xFE,0xFF,0x87,0x00,0xDF,0xFF,0x82,0x03,0xDF,0xFF,
+    0xFF,0xFF,0xDE,0xF7,0xDF,0xFF,0x90,0x02,0xFE,0xFF,0xDF,0xFF,0xDF,0xFF,0x8B,0x02,
+    0xDF,0xFF,0xFE,0xF7,0xDF,0xF7,0x43,0xFF,0xFF,0x06,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,
+    0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xF7,0x81,0x00,0xDF,0xFF,0x4C,0xFF,0xFF,0x8A,
+    0x02,0xFE,0xFF,0xDF,0xFF,0xFE,0xFF,0x92,0x00,0xFE,0xFF,0x84,0x05,0xDF,0xFF,0xFF,
+    0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x81,0x01,0xDF,0xFF,0xDF,0xFF,0x90,
+    0x06,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xF7,0x82,
+    0x00,0xFE,0xFF,0x98,0x00,0xFF,0xF7,0x8C,0x00,0xFF,0xF7,0x93,0x04,0xDF,0xF7,0xFF,
+    0xFF,0xFE,0xFF,0xFF,0xFF,0xDE,0xFF,0x96,0x00,0xDF,0xF7,0x83,0x00,0xDE,0xF7,0x8F,
+    0x01,0xFE,0xFF,0xFE,0xFF,0x81,0x02,0xDF,0xF7,0xFF,0xFF,0xFE,0xFF,0x83,0x42,0xFE,
+    0xFF,0x01,0xFF,0xFF,0xDF,0xFF,0x8B,0x00,0xDF,0xFF,0x81,0x00,0xFE,0xFF,0x82,0x01,
+    0xDF,0xFF,0xDE,0xFF,0x99,0x68,0xFF,0xFF,0x06,0xBE,0xEF,0xB3,0x12,0x11,0x02,0xB2,
+    0x02,0x72,0x02,0x93,0x02,0xB2,0x02,0x83,0x00,0xB2,0x02,0xBF,0x2D,0x0B,0xFE,0xFF,
+    0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0x19,0x5D,0xEF,0x01,0x2F,0x02,
+    0xD3,0x02,0xB3,0x02,0xB3,0x02,0x82,0x05,0xB3,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0xB2,0x02,0xAC,0x00,0xFE,0xFF,0x54,0xFF,0xFF,0x00,0xDF,0xFF,0x4C,0xFF,
+    0xFF,0x00,0xFF,0xF7,0x82,0x01,0xDF,0xFF,0xDF,0xFF,0x4B,0xFF,0xFF,0x00,0xFF,0xF7,
+    0x84,0xCB,0x03,0xDE,0xFF,0xFF,0xFF,0xFF,0xF7,0xDE,0xFF,0x4E,0xFF,0xFF,0x01,0xDF,
+    0xFF,0xDF,0xFF,0x82,0x00,0xFF,0xF7,0x6D,0xFF,0xFF,0x82,0xC3,0x01,0xFE,0xFF,0xDE,
+    0xFF,0x82,0x00,0xFE,0xFF,0x63,0xFF,0xFF,0x04,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,
+    0xFF,0xDF,0xFF,0x4D,0xFF,0xFF,0x00,0xDF,0xFF,0x6C,0xFF,0xFF,0x00,0xFF,0xF7,0x52,
+    0xFF,0xFF,0x00,0xFE,0xFF,0x4D,0xFF,0xFF,0x00,0xDF,0xFF,0x45,0xFF,0xFF,0x00,0xFE,
+    0xFF,0x42,0xFF,0xFF,0x04,0xDE,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x57,
+    0xFF,0xFF,0x00,0xFF,0xF7,0x4E,0xFF,0xFF,0x00,0xFF,0xF7,0x48,0xFF,0xFF,0x00,0xDF,
+    0xFF,0x81,0x00,0xFF,0xF7,0x42,0xFE,0xFF,0x01,0xDF,0xFF,0xFE,0xFF,0x42,0xFF,0xFF,
+    0x91,0x01,0xFF,0xFF,0xFE,0xFF,0x54,0xFF,0xFF,0x00,0xDF,0xFF,0x4D,0xFF,0xFF,0x00,
+    0xDF,0xFF,0x83,0x01,0xDE,0xFF,0xFE,0xFF,0x47,0xFF,0xFF,0x00,0xDE,0xFF,0x81,0x00,
+    0xDF,0xFF,0x8C,0x01,0xFF,0xF7,0xFF,0xF7,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x92,0x01,
+    0xFF,0xF7,0xDF,0xFF,0x43,0xFF,0xFF,0x00,0xFE,0xFF,0x44,0xFF,0xFF,0x00,0xDF,0xFF,
+    0x50,0xFF,0xFF,0x00,0xDF,0xFF,0x43,0xFF,0xFF,0x00,0xFE,0xFF,0x43,0xFF,0xFF,0x01,
+    0xFF,0xF7,0xDF,0xF7,0x82,0x00,0xDF,0xFF,0x83,0x01,0xFE,0xFF,0xFE,0xFF,0x45,0xFF,
+    0xFF,0x02,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x42,0xFF,0xFF,0x00,0xFF,0xF7,0x97,0xA1,
+    0x00,0xDF,0xFF,0x81,0x0C,0xFF,0xF7,0xFF,0xF7,0xDF,0xFF,0xDE,0xFF,0xFF,0xFF,0xBD,
+    0xBE,0x52,0x02,0x30,0x02,0xB2,0x02,0xB2,0x02,0x73,0x02,0x93,0x02,0xB3,0x02,0x82,
+    0x00,0xB2,0x02,0xBF,0x2C,0x15,0xFF,0xFF,0xFF,0xF7,0xFE,0xF7,0xFF,0xFF,0xFF,0xFF,
+    0x57,0x44,0xEF,0x01,0x71,0x02,0xD3,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0x93,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0xB2,0x02,0xB1,0x02,
+    0x93,0x02,0xA9,0x01,0xDF,0xFF,0xFE,0xFF,0x8E,0x00,0xFF,0xF7,0x83,0x01,0xFF,0xF7,
+    0xFE,0xF7,0x4D,0xFF,0xFF,0x08,0xFF,0xF7,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xDE,0xFF,
+    0xDE,0xF7,0xFF,0xF7,0xFF,0xFF,0xFE,0xFF,0x86,0x00,0xDF,0xFF,0x45,0xFF,0xFF,0x00,
+    0xBF,0xFF,0x89,0x05,0xDE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0x57,0xFF,0xFF,0x42,0xDF,0xFF,0x91,0x01,0xFF,0xF7,0xFE,0xFF,0x81,0x07,0xDF,0xFF,
+    0xDF,0xFF,0xFE,0xFF,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDE,0xFF,0x88,0x03,
+    0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x44,0xFF,0xFF,0x42,0xDF,0xFF,0x04,0xFF,
+    0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x8E,0x02,0xDF,0xFF,0xFE,0xFF,0xFF,
+    0xF7,0x8D,0x00,0xDF,0xFF,0x45,0xFF,0xFF,0x00,0xDF,0xFF,0x4C,0xFF,0xFF,0x00,0xFF,
+    0xF7,0x9B,0x00,0xDE,0xFF,0x8B,0x01,0xDF,0xFF,0xFE,0xFF,0x42,0xFF,0xFF,0x00,0xFE,
+    0xFF,0x8F,0x00,0xDF,0xFF,0x4F,0xFF,0xFF,0x00,0xDF,0xF7,0x83,0x02,0xDF,0xFF,0xFE,
+    0xFF,0xFE,0xFF,0x52,0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,0x4D,0xFF,0xFF,0x00,0xDF,
+    0xFF,0x89,0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x00,0xFE,0xFF,0x81,0x42,0xDF,0xFF,0x45,
+    0xFF,0xFF,0x02,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x43,0xFF,0xFF,0x93,0x00,0xFE,0xFF,
+    0x85,0x42,0xDF,0xFF,0x4B,0xFF,0xFF,0x00,0xFE,0xFF,0x51,0xFF,0xFF,0x00,0xFE,0xFF,
+    0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x84,0x00,0xFE,0xFF,0x44,0xFF,0xFF,0x02,0xDF,0xFF,
+    0xFF,0xFF,0xFF,0xF7,0x4C,0xFF,0xFF,0x93,0xC1,0x00,0xFE,0xFF,0x4C,0xFF,0xFF,0x00,
+    0xFE,0xFF,0x8C,0x01,0xFE,0xFF,0xFE,0xFF,0x47,0xFF,0xFF,0x06,0xFE,0xFF,0xFE,0xFF,
+    0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x44,0xFF,0xFF,0x42,0xFE,0xFF,
+    0x49,0xFF,0xFF,0x00,0xFE,0xFF,0x96,0x63,0xFF,0xFF,0x0D,0xDF,0xFF,0xFE,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xD9,0x6D,0xF0,0x01,0x93,0x02,0xB3,
+    0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x83,0x00,0xB2,0x02,0xBF,0x2C,0xC2,0x04,0xF6,
+    0x33,0xD0,0x01,0x92,0x02,0xB2,0x02,0xB3,0x02,0x43,0x92,0x02,0x02,0xB2,0x02,0xB3,
+    0x02,0xB2,0x02,0x42,0x92,0x02,0x01,0x93,0x02,0xB2,0x02,0xAA,0xD0,0x81,0x00,0xDF,
+    0xFF,0x46,0xFF,0xFF,0x00,0xDF,0xFF,0x4A,0xFF,0xFF,0x00,0xDF,0xFF,0x43,0xFF,0xFF,
+    0x00,0xDF,0xFF,0x81,0x00,0xFE,0xFF,0x46,0xFF,0xFF,0x00,0xFE,0xFF,0x84,0x00,0xDF,
+    0xFF,0x89,0x00,0xFE,0xFF,0x72,0xFF,0xFF,0x84,0x00,0xFF,0xFF,0x82,0xCB,0x03,0xDF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x81,0x00,0xFE,0xF7,0x51,0xFF,0xFF,0x00,0xFE,
+    0xFF,0x49,0xFF,0xFF,0x00,0xFE,0xFF,0x89,0x00,0xDF,0xF7,0x86,0xDD,0x01,0xFE,0xFF,
+    0xFE,0xFF,0x5B,0xFF,0xFF,0x00,0xDF,0xFF,0x62,0xFF,0xFF,0x00,0xDF,0xFF,0x55,0xFF,
+    0xFF,0x00,0xFE,0xFF,0x60,0xFF,0xFF,0x00,0xDF,0xFF,0x4C,0xFF,0xFF,0x82,0x00,0xFE,
+    0xFF,0x75,0xFF,0xFF,0x02,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x81,0x02,0xFF,0xF7,0xFE,
+    0xFF,0xFE,0xFF,0x4A,0xFF,0xFF,0x04,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,
+    0xF7,0x43,0xFF,0xFF,0x00,0xFE,0xFF,0x58,0xFF,0xFF,0x00,0xDF,0xFF,0x5D,0xFF,0xFF,
+    0x42,0xFE,0xFF,0x01,0xFF,0xFF,0xDF,0xFF,0x4C,0xFF,0xFF,0x82,0xC1,0x01,0xFE,0xFF,
+    0xDF,0xFF,0x42,0xFF,0xFF,0x00,0xDE,0xFF,0x62,0xFF,0xFF,0x64,0xFF,0xFF,0x82,0xC3,
+    0x04,0xD8,0x4C,0xD1,0x01,0xB2,0x02,0x92,0x02,0x92,0x02,0x82,0xFF,0x25,0x88,0x15,
+    0xFE,0xFF,0xFF,0xFF,0xBF,0xEF,0x94,0x23,0xCF,0x01,0xB2,0x02,0x94,0x02,0x94,0x02,
+    0x93,0x02,0x92,0x02,0x72,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x93,0x02,
+    0x93,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0xAA,0x04,0x9E,0xE7,
+    0x5D,0xDF,0x9E,0xE7,0x5E,0xDF,0x5D,0xDF,0x4E,0xFF,0xFF,0x00,0x9E,0xDF,0x42,0x7E,
+    0xDF,0x01,0xFF,0xFF,0xFE,0xF7,0x49,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x9F,0xE7,
+    0x7E,0xDF,0x9E,0xDF,0x5E,0xD7,0x7E,0xE7,0xFE,0xFF,0x47,0xFF,0xFF,0x07,0xDF,0xFF,
+    0xFF,0xF7,0xFE,0xFF,0xDF,0xF7,0x3E,0xDF,0x9D,0xD7,0x7E,0xDF,0x9F,0xDF,0x49,0xFF,
+    0xFF,0x0A,0xDF,0xFF,0xFE,0xFF,0x9E,0xEF,0x3E,0xDF,0x7E,0xE7,0x7D,0xE7,0x5D,0xDF,
+    0xFE,0xEF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0x8A,0x08,0xDF,0xFF,0xDF,0xFF,0xFF,0xF7,
+    0xFF,0xFF,0xBE,0xDF,0x3D,0xDF,0x7D,0xDF,0x3D,0xE7,0x5D,0xE7,0x82,0x04,0xDF,0xFF,
+    0x7E,0xE7,0x7E,0xDF,0x9E,0xDF,0x7E,0xE7,0x47,0x9E,0xDF,0x08,0x7E,0xE7,0x9E,0xDF,
+    0x7D,0xDF,0x7D,0xDF,0xBE,0xEF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x46,0xFF,
+    0xFF,0x0A,0x9F,0xDF,0x3A,0xA6,0x16,0x6D,0xD6,0x4C,0xB7,0x3C,0xB6,0x3C,0xD6,0x4C,
+    0xD6,0x5C,0x99,0x7D,0x9B,0xB6,0xFF,0xF7,0x47,0xFF,0xFF,0x05,0x9E,0xE7,0x7D,0xDF,
+    0x7D,0xE7,0x5D,0xDF,0xBE,0xE7,0xFE,0xFF,0x8C,0x06,0xFE,0xFF,0x9E,0xF7,0x7D,0xDF,
+    0x9E,0xDF,0x7E,0xDF,0x9E,0xE7,0xDF,0xFF,0x82,0x00,0xDF,0xFF,0x87,0x07,0xDF,0xFF,
+    0xFF,0xF7,0xFF,0xFF,0xDF,0xE7,0x5D,0xE7,0x9E,0xDF,0x5E,0xDF,0xBE,0xEF,0x8E,0x0C,
+    0xDF,0xFF,0x7E,0xEF,0x7E,0xDF,0x7E,0xDF,0x9E,0xE7,0x7E,0xE7,0x7E,0xE7,0x9E,0xE7,
+    0x7E,0xE7,0x7E,0xE7,0x7E,0xDF,0x5E,0xDF,0x9E,0xEF,0x4E,0xFF,0xFF,0x03,0xBE,0xEF,
+    0x7D,0xDF,0x5D,0xDF,0x7E,0xDF,0x42,0x9E,0xDF,0x0B,0x7E,0xDF,0x9E,0xDF,0x9E,0xDF,
+    0x7E,0xDF,0x9E,0xDF,0x7F,0xE7,0x7E,0xDF,0x7E,0xDF,0x9E,0xE7,0x5D,0xE7,0xBD,0xF7,
+    0xFE,0xFF,0x8F,0x12,0xDE,0xFF,0xBF,0xE7,0x7E,0xDF,0x7D,0xE7,0x7E,0xDF,0x7E,0xDF,
+    0x7E,0xE7,0x9E,0xDF,0x7E,0xE7,0x9E,0xE7,0x9E,0xDF,0x9E,0xDF,0x7E,0xE7,0x5E,0xDF,
+    0x7E,0xDF,0x7E,0xDF,0x5E,0xDF,0x7D,0xEF,0xFE,0xFF,0x42,0xFF,0xFF,0x06,0xFE,0xFF,
+    0xFE,0xFF,0x7E,0xEF,0x5E,0xDF,0x7D,0xDF,0x7E,0xDF,0x9E,0xEF,0x4F,0xFF,0xFF,0x03,
+    0xFE,0xF7,0x7D,0xDF,0x5C,0xDF,0x7E,0xE7,0x47,0x9E,0xDF,0x05,0x5E,0xE7,0x7E,0xE7,
+    0x9D,0xE7,0x5E,0xDF,0x5D,0xDF,0xBD,0xF7,0x8A,0x00,0xFF,0xF7,0x42,0xFF,0xFF,0x14,
+    0xBF,0xE7,0x7B,0xAE,0x57,0x6D,0xF6,0x54,0xB6,0x44,0x97,0x3C,0xB7,0x4C,0xF6,0x5C,
+    0x56,0x75,0x7A,0xA6,0x9F,0xD7,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0xBD,0xF7,
+    0x5E,0xE7,0x7E,0xDF,0x7E,0xE7,0x7E,0xDF,0x9E,0xDF,0x43,0x7E,0xDF,0x01,0x9E,0xDF,
+    0x9E,0xDF,0x42,0x7E,0xE7,0x00,0x7E,0xDF,0x43,0x9E,0xDF,0x04,0x7E,0xDF,0x7E,0xDF,
+    0x5E,0xDF,0xDF,0xF7,0xFE,0xFF,0x82,0x03,0x5E,0xE7,0x7E,0xDF,0x9D,0xDF,0x9E,0xDF,
+    0x42,0x7E,0xDF,0x04,0x7E,0xE7,0x7E,0xDF,0x7E,0xDF,0x5E,0xDF,0x9F,0xEF,0x85,0x00,
+    0xDF,0xFF,0x87,0x01,0xDF,0xFF,0xBF,0xFF,0x81,0x01,0xFE,0xF7,0xDE,0xFF,0x42,0xFF,
+    0xFF,0x0D,0x5D,0xD7,0x1A,0x96,0x17,0x65,0xD5,0x4C,0x97,0x44,0xB6,0x44,0xF6,0x4C,
+    0x57,0x6D,0x9B,0xAE,0xBF,0xE7,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xF7,0x81,0x00,
+    0xDF,0xFF,0x87,0x05,0xBF,0xEF,0x7E,0xE7,0x7E,0xDF,0x7F,0xDF,0x5E,0xD7,0x7D,0xE7,
+    0x4F,0xFF,0xFF,0x14,0xBE,0xF7,0x5D,0xDF,0x7D,0xD7,0x7E,0xDF,0x7E,0xE7,0xDF,0xFF,
+    0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xDD,0xF7,0x7D,0xDF,0x5F,0xDF,0x9E,0xDF,0x5F,0xDF,
+    0x7E,0xE7,0x7E,0xDF,0x7F,0xDF,0x7D,0xDF,0x7D,0xE7,0x7E,0xDF,0xDE,0xEF,0x88,0x00,
+    0xDF,0xFF,0x42,0xFF,0xFF,0x0A,0xDF,0xF7,0xBC,0xBE,0x98,0x85,0xF6,0x5C,0xD6,0x44,
+    0xB7,0x34,0xB6,0x44,0xF6,0x5C,0x56,0x6D,0x39,0x96,0x7E,0xCF,0x42,0xFF,0xFF,0x14,
+    0xDF,0xF7,0xDF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xDF,0xEF,0x9B,0xAE,0x57,0x75,0xB6,0x54,0xB7,0x44,0xB7,0x3C,
+    0xD6,0x4C,0xF5,0x5C,0x77,0x6D,0x5A,0xA6,0x7E,0xE7,0x97,0x6C,0xFF,0xFF,0x06,0xD5,
+    0x2B,0xCE,0x01,0xB1,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x81,0x00,0x93,
+    0x02,0x42,0xB2,0x02,0x84,0x00,0xB2,0x02,0xBF,0x18,0x02,0xB2,0x02,0x92,0x02,0x12,
+    0x02,0x86,0x04,0xFF,0xFF,0x5E,0xD7,0x14,0x13,0xF1,0x01,0xB2,0x02,0x4C,0x92,0x02,
+    0x43,0xB2,0x02,0xA9,0x06,0xDF,0xFF,0x1D,0xBF,0x93,0x02,0x92,0x02,0xB1,0x02,0x11,
+    0x02,0x3A,0x55,0x88,0x01,0xDF,0xFF,0xFE,0xFF,0x81,0x08,0xBD,0xB6,0x91,0x02,0x72,
+    0x02,0x94,0x02,0x91,0x02,0x9B,0xAE,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x85,0x0E,0xFF,
+    0xF7,0xFE,0xFF,0xFF,0xFF,0xFD,0xAE,0x91,0x0A,0x72,0x02,0xD3,0x02,0x11,0x02,0xDA,
+    0x65,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0xDD,0xFF,0xFF,0xFF,0xFE,0xFF,0x83,0x07,0xFF,
+    0xFF,0xFF,0xFF,0x17,0x34,0x10,0x02,0xF2,0x02,0x93,0x02,0x91,0x02,0xDC,0xB6,0x4A,
+    0xFF,0xFF,0x06,0x7E,0xD7,0xF1,0x02,0x73,0x02,0xB3,0x02,0x30,0x02,0x56,0x34,0xFF,
+    0xFF,0x81,0x01,0xDF,0xFF,0xFF,0xF7,0x4B,0xFF,0xFF,0x05,0x7E,0xCF,0xD1,0x0A,0x73,
+    0x02,0xB5,0x02,0x10,0x02,0x37,0x65,0x82,0x04,0x5D,0xD7,0x90,0x0A,0x92,0x02,0xB3,
+    0x02,0xB3,0x02,0x42,0xB2,0x02,0x00,0xD2,0x02,0x44,0xB2,0x02,0x07,0xD3,0x02,0xB3,
+    0x02,0x32,0x02,0x9B,0x7D,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0xFF,0xF7,0x82,0x14,0xDF,
+    0xFF,0xFF,0xFF,0x1A,0x96,0xF4,0x23,0xB4,0x02,0x32,0x02,0xEF,0x01,0xCF,0x01,0xEF,
+    0x01,0xCF,0x01,0xEF,0x01,0xEF,0x01,0x10,0x02,0x31,0x02,0xD2,0x0A,0x57,0x5D,0xFF,
+    0xFF,0xDF,0xFF,0xDF,0xF7,0xFF,0xFF,0xFF,0xF7,0x81,0x04,0xD5,0x23,0x2F,0x02,0xB3,
+    0x02,0x12,0x02,0x19,0x4D,0x4E,0xFF,0xFF,0x08,0xD8,0x54,0x11,0x02,0xD2,0x02,0x10,
+    0x02,0x56,0x44,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,0xFE,0xFF,0x48,0xFF,0xFF,0x08,0xDF,
+    0xFF,0xFF,0xFF,0xBF,0xF7,0x32,0x13,0x72,0x02,0xD2,0x02,0x51,0x02,0x34,0x13,0xDF,
+    0xFF,0x81,0x00,0xFE,0xFF,0x4B,0xFF,0xFF,0x0F,0x57,0x3C,0x31,0x02,0xD2,0x02,0xD3,
+    0x02,0xB2,0x02,0xB3,0x02,0xD3,0x02,0xB3,0x02,0xB3,0x02,0xB2,0x02,0xB2,0x02,0xF3,
+    0x0A,0x76,0x13,0x14,0x2C,0x58,0x7D,0xDF,0xE7,0x81,0x00,0xDF,0xFF,0x87,0x13,0x5C,
+    0x96,0x53,0x02,0x93,0x02,0xD3,0x02,0xB3,0x02,0x91,0x0A,0xB3,0x02,0xB3,0x02,0xB2,
+    0x02,0xD2,0x02,0xB3,0x02,0xD2,0x02,0xB3,0x02,0xD3,0x02,0xB3,0x02,0xB1,0x02,0x72,
+    0x02,0x9B,0xAE,0xFF,0xFF,0xFE,0xFF,0x4F,0xFF,0xFF,0x13,0xD5,0x23,0x31,0x02,0xB3,
+    0x02,0xB3,0x0A,0xB2,0x02,0xD2,0x02,0xB3,0x02,0xD2,0x0A,0xD3,0x02,0xB3,0x02,0xD3,
+    0x02,0xB3,0x02,0xB3,0x02,0xD3,0x02,0xB3,0x02,0x31,0x02,0x55,0x2C,0xFF,0xFF,0xFE,
+    0xFF,0xDE,0xFF,0x42,0xFF,0xFF,0x04,0xD3,0x33,0x12,0x02,0xD3,0x02,0x2F,0x02,0x19,
+    0x55,0x81,0x01,0xDF,0xFF,0xFE,0xFF,0x8B,0x11,0xFD,0xBE,0x92,0x02,0x71,0x02,0xD3,
+    0x02,0xD2,0x02,0xB3,0x02,0xB3,0x02,0xB2,0x02,0xB3,0x02,0xB3,0x02,0xD2,0x02,0xD2,
+    0x02,0xB3,0x02,0xB3,0x02,0xB2,0x0A,0xD4,0x02,0x30,0x02,0xFA,0x8D,0x4C,0xFF,0xFF,
+    0x21,0xDA,0x8D,0x15,0x2C,0xD2,0x0A,0x51,0x02,0xF0,0x01,0xB0,0x01,0xEF,0x01,0xEE,
+    0x01,0xEF,0x01,0xCF,0x01,0xEF,0x01,0x51,0x02,0xD3,0x0A,0x93,0x23,0xD9,0x85,0xFF,
+    0xFF,0xFF,0xFF,0x9C,0xAE,0x91,0x02,0xB2,0x02,0xB2,0x02,0xB3,0x02,0xB3,0x02,0xD2,
+    0x02,0xB3,0x02,0xB3,0x02,0xB2,0x02,0xB3,0x02,0xD2,0x02,0xB2,0x02,0xD3,0x02,0xD2,
+    0x02,0xD3,0x02,0xB2,0x02,0x42,0xB3,0x02,0x03,0xD2,0x02,0xB2,0x02,0x30,0x02,0x1B,
+    0x86,0x42,0xFF,0xFF,0x10,0xFE,0xFF,0x35,0x13,0x72,0x02,0xD3,0x02,0xB4,0x02,0xB2,
+    0x0A,0xB2,0x02,0xB3,0x02,0xD3,0x02,0xD3,0x02,0xB2,0x02,0xB1,0x02,0x14,0x03,0x76,
+    0x13,0x55,0x3C,0xF9,0x8D,0xFF,0xF7,0x81,0x00,0xFE,0xFF,0x49,0xFF,0xFF,0x19,0xFF,
+    0xF7,0xDE,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xEF,0x37,0x75,0x93,0x1B,0xB2,0x02,0x31,
+    0x02,0xD0,0x01,0xAF,0x01,0xEF,0x01,0xEF,0x01,0xCF,0x01,0xF0,0x01,0x72,0x02,0xF3,
+    0x02,0x34,0x34,0x7B,0xA6,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,
+    0xFF,0xDF,0xFF,0x43,0xFF,0xFF,0x08,0xDE,0xFF,0xFF,0xFF,0x1B,0xAE,0x31,0x02,0xD2,
+    0x02,0xB3,0x02,0x94,0x02,0x31,0x02,0x19,0x8E,0x8E,0x14,0x98,0x7D,0x0F,0x02,0xB3,
+    0x0A,0x32,0x02,0x74,0x1B,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xBB,0xAE,0x91,
+    0x02,0x93,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0xB4,0x02,0xB4,0x02,0xB1,0x02,0xB3,
+    0x02,0x71,0x02,0xBC,0xB6,0x49,0xFF,0xFF,0x10,0xFE,0xFF,0x9D,0xB6,0x74,0x44,0x33,
+    0x0B,0x52,0x02,0x11,0x02,0xEF,0x01,0xEF,0x01,0xF0,0x01,0xEF,0x01,0xCF,0x01,0xF1,
+    0x01,0x50,0x02,0x92,0x02,0x36,0x1B,0x18,0x5D,0xDE,0xF7,0x42,0xFF,0xFF,0x13,0xBF,
+    0xFF,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFD,0xBE,0x55,0x44,0xF2,0x0A,0x52,
+    0x02,0xF0,0x01,0xCF,0x01,0xD0,0x01,0xEF,0x01,0xEE,0x01,0xCF,0x01,0x10,0x02,0x30,
+    0x02,0x74,0x02,0x55,0x34,0x7D,0xEF,0x95,0xAC,0x09,0xFE,0xF7,0x74,0x13,0xF0,0x01,
+    0xB2,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x43,0x92,
+    0x02,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x7F,0x1A,0x92,0x02,0x02,0x93,0x02,0x92,
+    0x02,0x10,0x02,0x86,0x03,0xFD,0xB6,0xB0,0x0A,0xD1,0x01,0x94,0x02,0x47,0x92,0x02,
+    0x01,0x93,0x02,0x93,0x02,0x86,0x50,0x92,0x02,0x99,0xC1,0x04,0x13,0x13,0xF0,0x01,
+    0x52,0x02,0x10,0x02,0x74,0x1B,0x87,0x00,0xDF,0xFF,0x43,0xFF,0xFF,0x05,0x19,0x5D,
+    0xD1,0x01,0x51,0x02,0x52,0x02,0xAF,0x01,0xF6,0x54,0x48,0xFF,0xFF,0x10,0xDF,0xFF,
+    0xDE,0xFF,0xFF,0xFF,0xBA,0x65,0xCF,0x01,0x72,0x02,0x31,0x02,0x51,0x02,0xDB,0xC6,
+    0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,
+    0x82,0x06,0x5D,0xDF,0x53,0x02,0x31,0x02,0x30,0x02,0x33,0x02,0xD0,0x01,0xB6,0x44,
+    0x88,0x09,0xFF,0xF7,0xFE,0xFF,0xFF,0xFF,0xD5,0x2B,0xB0,0x01,0x52,0x02,0x10,0x02,
+    0x93,0x02,0x7F,0xEF,0xFE,0xFF,0x4E,0xFF,0xFF,0x0E,0x38,0x75,0xCF,0x01,0x72,0x02,
+    0x11,0x02,0x51,0x02,0x5D,0xBF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0x1D,0xD7,0x50,0x02,
+    0x52,0x02,0x51,0x02,0x51,0x02,0x52,0x02,0x43,0x72,0x02,0x02,0x51,0x02,0x71,0x02,
+    0x71,0x02,0x42,0x51,0x02,0x1B,0xF1,0x01,0x79,0x75,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,
+    0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0x9F,0xD7,0xB5,0x23,0xEF,0x01,0xD0,0x01,
+    0x50,0x02,0x92,0x02,0x93,0x02,0x73,0x02,0x72,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,
+    0x92,0x02,0x73,0x02,0xAF,0x01,0xD1,0x12,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,0x43,0xFF,
+    0xFF,0x04,0xB5,0x13,0xCF,0x01,0x52,0x02,0xB0,0x01,0xD8,0x3C,0x8E,0x04,0x97,0x4C,
+    0xB1,0x01,0x92,0x02,0xAF,0x01,0x57,0x2C,0x81,0x01,0xDE,0xFF,0xBF,0xFF,0x8A,0x08,
+    0xD9,0x7D,0xEF,0x01,0x53,0x02,0x51,0x02,0x51,0x02,0xF2,0x01,0x1C,0x96,0xFF,0xFF,
+    0xDF,0xFF,0x4C,0xFF,0xFF,0x06,0x16,0x2C,0xF0,0x01,0x71,0x02,0x72,0x02,0x52,0x02,
+    0x72,0x02,0x51,0x02,0x42,0x71,0x02,0x08,0x72,0x02,0x71,0x02,0x2F,0x02,0xEF,0x01,
+    0xF1,0x01,0xB2,0x0A,0x79,0x65,0xFF,0xFF,0xFE,0xFF,0x87,0x05,0x5B,0x8E,0x10,0x02,
+    0x31,0x02,0x71,0x02,0x73,0x02,0x72,0x02,0x42,0x51,0x02,0x08,0x72,0x02,0x51,0x02,
+    0x51,0x02,0x71,0x02,0x51,0x02,0x51,0x02,0x52,0x02,0x32,0x02,0x7C,0xA6,0x91,0x10,
+    0x74,0x13,0xF0,0x01,0x51,0x02,0x51,0x02,0x93,0x02,0x72,0x02,0x71,0x02,0x51,0x02,
+    0x72,0x02,0x72,0x02,0x51,0x02,0x71,0x02,0x72,0x02,0x51,0x02,0x52,0x02,0xD0,0x01,
+    0x16,0x24,0x81,0x43,0xFF,0xFF,0x04,0xB3,0x23,0xD1,0x01,0x72,0x02,0xCF,0x01,0xF9,
+    0x54,0x4F,0xFF,0xFF,0x11,0xDC,0xB6,0x52,0x02,0x11,0x02,0x52,0x02,0x71,0x02,0x51,
+    0x02,0x72,0x02,0x52,0x02,0x71,0x02,0x51,0x02,0x71,0x02,0x72,0x02,0x71,0x02,0x51,
+    0x02,0x31,0x02,0x73,0x02,0xEE,0x01,0xB9,0x95,0x83,0x00,0xFE,0xFF,0x85,0x10,0x3B,
+    0x8E,0x33,0x13,0x11,0x02,0xEF,0x01,0x31,0x02,0x72,0x02,0x92,0x02,0xB2,0x02,0x93,
+    0x02,0x94,0x02,0x92,0x02,0x72,0x02,0x93,0x02,0x73,0x02,0x72,0x02,0x6D,0x01,0x14,
+    0x13,0x81,0x19,0x5C,0xA6,0x33,0x02,0x52,0x02,0x51,0x02,0x71,0x02,0x51,0x02,0x52,
+    0x02,0x32,0x02,0x52,0x02,0x72,0x02,0x51,0x02,0x51,0x02,0x50,0x02,0x71,0x02,0x72,
+    0x02,0x51,0x02,0x31,0x02,0x51,0x02,0x70,0x02,0x31,0x02,0x50,0x02,0x72,0x02,0xF1,
+    0x01,0xFB,0x7D,0xDF,0xFF,0xDF,0xFF,0x81,0x13,0xF3,0x0A,0xF1,0x01,0x51,0x02,0x52,
+    0x02,0x73,0x02,0x52,0x02,0x71,0x02,0x72,0x02,0x51,0x02,0x72,0x02,0x52,0x02,0x31,
+    0x02,0xF0,0x01,0xD0,0x01,0x2F,0x02,0x31,0x13,0x1A,0x96,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xF7,0x87,0x17,0xDF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0x59,0x6D,0xB1,0x0A,0xF0,
+    0x01,0x0F,0x02,0x72,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0x91,0x02,0x72,0x02,0x91,
+    0x02,0xB3,0x02,0x93,0x02,0x50,0x02,0xCF,0x01,0x10,0x02,0xF4,0x2B,0x7E,0xCF,0xFF,
+    0xFF,0xFE,0xFF,0x48,0xFF,0xFF,0x07,0x3B,0x9E,0x12,0x02,0x51,0x02,0x70,0x02,0x52,
+    0x02,0xF1,0x01,0xD1,0x0A,0xDF,0xEF,0x8D,0x06,0x98,0x75,0xAF,0x01,0x92,0x02,0xF0,
+    0x01,0x53,0x13,0xFF,0xFF,0xFF,0xFF,0x81,0x0B,0x7A,0xB6,0x50,0x02,0x12,0x02,0x32,
+    0x02,0x71,0x02,0x52,0x02,0x72,0x02,0x71,0x02,0x71,0x02,0x12,0x02,0x12,0x02,0xBD,
+    0xAE,0x83,0x02,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x81,0x07,0x1E,0xBF,0x95,0x2B,0x11,
+    0x02,0xF2,0x01,0x30,0x02,0x71,0x02,0x93,0x02,0x93,0x02,0x42,0x92,0x02,0x06,0x73,
+    0x02,0x93,0x02,0x52,0x02,0x71,0x02,0xF1,0x01,0x30,0x02,0x5E,0xE7,0x43,0xFF,0xFF,
+    0x12,0xFE,0xFF,0xFF,0xFF,0xFF,0xF7,0xB7,0x3C,0x51,0x02,0xB1,0x01,0x30,0x02,0x90,
+    0x02,0x92,0x02,0x93,0x02,0x73,0x02,0x72,0x02,0x53,0x02,0x93,0x02,0xB2,0x02,0x91,
+    0x02,0x13,0x02,0xF0,0x01,0xFC,0xBE,0x95,0x6D,0xFF,0xFF,0x03,0x9F,0xDF,0xF2,0x12,
+    0x10,0x02,0x93,0x02,0x42,0x92,0x02,0x01,0xB4,0x02,0xB1,0x02,0xBF,0x21,0x03,0x92,
+    0x02,0xB2,0x02,0x11,0x02,0xB4,0x23,0x81,0x00,0xFE,0xFF,0x81,0x03,0x7A,0xA6,0x72,
+    0x02,0x11,0x02,0xD2,0x02,0x62,0x92,0x02,0x9B,0x07,0xB6,0x44,0xD0,0x01,0x94,0x02,
+    0x72,0x02,0x91,0x02,0x5E,0xDF,0xFF,0xFF,0xFF,0xF7,0x82,0x02,0xFE,0xFF,0xFF,0xFF,
+    0xFF,0xF7,0x83,0x05,0x95,0x23,0xF2,0x01,0xB2,0x02,0xB2,0x02,0xF0,0x01,0xB5,0x1B,
+    0x49,0xFF,0xFF,0x09,0xFE,0xFF,0xFF,0xFF,0x18,0x34,0xF1,0x01,0xB2,0x02,0x31,0x02,
+    0x53,0x1B,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x83,0xC2,0x81,0x07,0x37,0x5D,0xF1,0x01,
+    0xB3,0x02,0xD1,0x02,0x74,0x02,0x51,0x02,0xF3,0x0A,0xBF,0xF7,0x4A,0xFF,0xFF,0x0A,
+    0x3B,0x8E,0x10,0x02,0x94,0x02,0x93,0x02,0xF1,0x01,0xF9,0x7D,0xFF,0xFF,0xFF,0xFF,
+    0xFE,0xFF,0xDF,0xFF,0xDE,0xFF,0x86,0x00,0xDF,0xFF,0x82,0x12,0x95,0x23,0x11,0x02,
+    0xB1,0x02,0xF0,0x01,0xF6,0x23,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x3C,0xD7,
+    0x91,0x02,0x92,0x02,0xB1,0x02,0x93,0x02,0x32,0x02,0x30,0x02,0x31,0x02,0x12,0x02,
+    0xF1,0x01,0x44,0x11,0x02,0x02,0x12,0x02,0xB2,0x01,0x78,0x65,0x45,0xFF,0xFF,0x10,
+    0xDD,0xB6,0x91,0x0A,0xF0,0x01,0x92,0x02,0xB2,0x02,0x72,0x02,0xF1,0x01,0x11,0x02,
+    0x71,0x02,0x90,0x02,0x71,0x02,0x31,0x02,0xF0,0x01,0xF2,0x01,0x72,0x02,0x0F,0x02,
+    0x95,0x1B,0x46,0xFF,0xFF,0x04,0xB6,0x23,0x11,0x02,0x93,0x02,0xF1,0x01,0xD8,0x54,
+    0x8E,0x04,0xB8,0x4C,0x11,0x02,0x92,0x02,0xEF,0x01,0x77,0x34,0x4E,0xFF,0xFF,0x06,
+    0xB4,0x23,0xF1,0x01,0xB2,0x02,0x92,0x02,0x92,0x02,0xF0,0x01,0x35,0x2C,0x8E,0x07,
+    0x56,0x34,0x10,0x02,0x92,0x02,0xB3,0x02,0x52,0x02,0x11,0x02,0x11,0x02,0xF1,0x01,
+    0x42,0x11,0x02,0x08,0x33,0x02,0x52,0x02,0xD2,0x02,0x93,0x02,0x12,0x02,0xF0,0x01,
+    0x77,0x3C,0xFF,0xFF,0xFE,0xFF,0x42,0xFF,0xF7,0x83,0x0C,0x3C,0x96,0x30,0x02,0x53,
+    0x02,0xB3,0x02,0xB2,0x02,0x10,0x02,0x11,0x02,0x11,0x02,0x31,0x02,0x12,0x02,0x12,
+    0x02,0x11,0x02,0x12,0x02,0x42,0x11,0x02,0x01,0xF0,0x01,0x5C,0xA6,0x51,0xFF,0xFF,
+    0x07,0xB4,0x1B,0x10,0x02,0xB3,0x02,0xB2,0x02,0x30,0x02,0x11,0x02,0x11,0x02,0x31,
+    0x02,0x46,0x11,0x02,0x01,0x8F,0x01,0xF6,0x1B,0x85,0x04,0xD4,0x2B,0xF0,0x01,0xB2,
+    0x02,0x11,0x02,0x18,0x55,0x8F,0x11,0xDC,0xBE,0x72,0x02,0x72,0x02,0xB2,0x02,0x93,
+    0x02,0x30,0x02,0x31,0x02,0x32,0x02,0x32,0x02,0x12,0x02,0x11,0x02,0x31,0x02,0x11,
+    0x02,0x12,0x02,0x11,0x02,0x13,0x02,0x8D,0x01,0xB9,0x7D,0x88,0x12,0xFF,0xF7,0x74,
+    0x34,0xEF,0x01,0x12,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x32,0x02,0xF0,0x01,0x11,
+    0x02,0x52,0x02,0x31,0x02,0x30,0x02,0x31,0x02,0xB1,0x01,0x31,0x02,0x92,0x02,0x10,
+    0x02,0x95,0x1B,0x82,0x17,0xF1,0x01,0xF1,0x01,0x11,0x02,0x11,0x02,0x32,0x02,0x11,
+    0x02,0x31,0x02,0x30,0x02,0x50,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x93,0x02,0x51,
+    0x02,0x30,0x02,0x11,0x02,0x11,0x02,0x31,0x02,0x31,0x02,0x32,0x02,0x11,0x02,0xB0,
+    0x01,0xDA,0x75,0xFF,0xFF,0x81,0x12,0xFF,0xFF,0x13,0x13,0x12,0x02,0xB3,0x02,0xB3,
+    0x02,0x51,0x02,0x10,0x02,0x32,0x02,0x31,0x02,0x31,0x02,0x10,0x02,0x10,0x02,0x72,
+    0x02,0x93,0x02,0x93,0x02,0x73,0x02,0x2F,0x02,0xF0,0x01,0x58,0x6D,0x88,0x1B,0xFE,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xEF,0xD4,0x2B,0xF0,0x01,0x11,0x02,0x92,0x02,0x94,
+    0x02,0x73,0x02,0x11,0x02,0x10,0x02,0x31,0x02,0x30,0x02,0x50,0x02,0x31,0x02,0xD1,
+    0x01,0x33,0x02,0x93,0x02,0xB3,0x02,0x72,0x02,0xD0,0x01,0x90,0x02,0x5B,0x9E,0xFF,
+    0xFF,0xFF,0xFF,0xDE,0xFF,0xDF,0xFF,0x85,0x07,0x5A,0x9E,0x32,0x02,0x73,0x02,0xB2,
+    0x02,0x92,0x02,0xB2,0x02,0xB0,0x01,0x97,0x3C,0x81,0x01,0xDE,0xFF,0xFF,0xF7,0x89,
+    0x04,0x98,0x7D,0xEF,0x01,0xB3,0x02,0x31,0x02,0x74,0x1B,0x43,0xFF,0xFF,0x0B,0x5C,
+    0xA6,0xAF,0x01,0xD0,0x01,0x10,0x02,0xB1,0x02,0x93,0x02,0x73,0x0A,0xB1,0x02,0x10,
+    0x02,0xB0,0x01,0xD1,0x01,0x9C,0xA6,0x83,0x00,0xFF,0xF7,0x42,0xFF,0xFF,0x12,0x59,
+    0x6D,0x71,0x02,0xEF,0x01,0x72,0x02,0xB4,0x02,0x93,0x02,0x50,0x02,0xF0,0x01,0x10,
+    0x02,0x30,0x02,0x31,0x02,0x51,0x02,0x10,0x02,0xD0,0x01,0xF3,0x01,0x71,0x02,0x70,
+    0x02,0x93,0x02,0x7F,0xE7,0x81,0x14,0xDF,0xFF,0xDF,0xF7,0xFF,0xFF,0xDE,0xF7,0x93,
+    0x1B,0xB0,0x01,0x51,0x02,0x93,0x02,0x73,0x02,0x31,0x02,0xF0,0x01,0x50,0x02,0x90,
+    0x02,0x71,0x02,0x51,0x02,0xF1,0x01,0xF0,0x01,0x52,0x02,0x71,0x02,0x92,0x02,0xFD,
+    0xC6,0x95,0xAB,0x0D,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xD7,0xD2,0x0A,0x10,0x02,
+    0x93,0x02,0x74,0x02,0xB3,0x02,0xD1,0x02,0x92,0x02,0xB3,0x02,0xB2,0x02,0xB2,0x02,
+    0x44,0x92,0x02,0x00,0xB2,0x02,0xBF,0x18,0x03,0xB2,0x02,0x93,0x02,0x30,0x02,0xD6,
+    0x23,0x43,0xFF,0xFF,0x04,0xF8,0x85,0x2F,0x02,0x31,0x02,0xB3,0x02,0xB2,0x02,0xBA,
+    0x10,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0x3A,0x9E,0x10,0x02,0x92,0x02,0x93,
+    0x02,0xF1,0x01,0xFB,0x85,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDE,
+    0xFF,0xDF,0xFF,0x83,0x07,0x7E,0xDF,0x91,0x02,0x71,0x02,0x92,0x02,0x92,0x02,0x52,
+    0x02,0xD1,0x02,0x9E,0xE7,0x49,0xFF,0xFF,0x05,0xBF,0xF7,0xF2,0x12,0x51,0x02,0xB4,
+    0x02,0xEF,0x01,0xD9,0x4C,0x48,0xFF,0xFF,0x0A,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x34,
+    0x13,0x11,0x02,0x93,0x02,0x72,0x02,0x92,0x02,0x92,0x02,0x10,0x02,0xFB,0x8D,0x82,
+    0x00,0xFE,0xFF,0x82,0x01,0xDF,0xFF,0xFE,0xFF,0x81,0x02,0xFF,0xEF,0xF4,0x0A,0x11,
+    0x02,0x81,0x06,0x15,0x2C,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,
+    0xF7,0x48,0xFF,0xFF,0x05,0x3C,0xCF,0x91,0x02,0x54,0x02,0x90,0x02,0x30,0x02,0xDB,
+    0x85,0x43,0xFF,0xFF,0x0A,0x5C,0xD7,0x71,0x0A,0x72,0x02,0xB2,0x02,0x92,0x02,0xB3,
+    0x1B,0x13,0x34,0xF4,0x2B,0xD5,0x2B,0xD4,0x2B,0xD4,0x2B,0x42,0xD5,0x2B,0x05,0x15,
+    0x2C,0xD5,0x2B,0x74,0x23,0x3B,0x9E,0xFF,0xFF,0xDF,0xFF,0x82,0x14,0x9D,0xE7,0xB3,
+    0x02,0x0F,0x02,0xB3,0x02,0x73,0x02,0xF2,0x01,0x91,0x0A,0x95,0x3C,0xBA,0x75,0xBC,
+    0xA6,0xFB,0xC6,0xBD,0xAE,0x5D,0x86,0x7A,0x5D,0x15,0x34,0x92,0x0A,0xAF,0x01,0x75,
+    0x0B,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,0x85,0x02,0x92,0x02,0x11,0x02,0xD9,0x54,0x8E,
+    0x03,0xD8,0x4C,0x10,0x02,0x92,0x02,0xF0,0x01,0x8E,0x08,0x3D,0xCF,0x70,0x02,0x72,
+    0x02,0x92,0x02,0x71,0x02,0x94,0x02,0x52,0x02,0x91,0x02,0x7E,0xE7,0x4D,0xFF,0xFF,
+    0x00,0x17,0x34,0x81,0x0F,0x73,0x02,0x53,0x13,0x15,0x3C,0xF5,0x2B,0xD5,0x2B,0xF4,
+    0x2B,0xF4,0x2B,0xB4,0x2B,0x11,0x1B,0x90,0x02,0x12,0x02,0x70,0x02,0x91,0x02,0x93,
+    0x02,0xCE,0x01,0x18,0x4D,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x81,0x00,0xDF,0xFF,0x81,
+    0x07,0x50,0x02,0x72,0x02,0x72,0x02,0xD3,0x02,0xD3,0x2B,0xF4,0x33,0xD5,0x2B,0xD5,
+    0x2B,0x42,0xF5,0x2B,0x06,0xD5,0x2B,0xF5,0x2B,0xF4,0x2B,0xD4,0x23,0xB4,0x2B,0xFD,
+    0xC6,0xFE,0xFF,0x92,0x10,0x93,0x02,0x73,0x02,0x53,0x1B,0xF4,0x33,0xF4,0x2B,0xD5,
+    0x2B,0xD5,0x2B,0xF5,0x2B,0xF4,0x2B,0xD4,0x2B,0xF4,0x2B,0x15,0x2C,0xD4,0x2B,0x73,
+    0x23,0x57,0x5D,0xFF,0xFF,0xDF,0xFF,0x84,0x00,0x10,0x02,0x90,0x02,0xFE,0xFF,0xFF,
+    0xFF,0xDD,0xBE,0x81,0x0E,0x92,0x02,0xB3,0x02,0xB5,0x23,0xF4,0x33,0xD3,0x33,0xF5,
+    0x2B,0xF7,0x2B,0xF5,0x2B,0xF4,0x2B,0xD5,0x2B,0x14,0x2C,0xD4,0x2B,0xF6,0x2B,0x73,
+    0x23,0x9B,0xB6,0x82,0x02,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x81,0x13,0xBE,0xE7,0x73,
+    0x1B,0xEE,0x01,0x71,0x02,0xD4,0x02,0x72,0x02,0xF1,0x01,0x51,0x02,0xB4,0x23,0x19,
+    0x55,0x1B,0x76,0x7C,0x8E,0x3B,0x96,0x3C,0x96,0xBA,0x6D,0xB6,0x4C,0x33,0x23,0x71,
+    0x02,0x8D,0x01,0x53,0x13,0x81,0x17,0xFD,0xC6,0xB4,0x23,0xF4,0x23,0xF4,0x2B,0xD5,
+    0x2B,0xF5,0x23,0xF4,0x2B,0xF4,0x2B,0xF5,0x33,0xD4,0x23,0x91,0x02,0x92,0x02,0x93,
+    0x02,0x74,0x02,0x94,0x23,0x34,0x2C,0x15,0x2C,0xF6,0x2B,0xD5,0x2B,0xF5,0x2B,0x15,
+    0x24,0xD4,0x2B,0x92,0x23,0x9C,0xA6,0x43,0xFF,0xFF,0x12,0x33,0x0B,0x31,0x02,0x92,
+    0x02,0x91,0x02,0x93,0x1B,0xF3,0x3B,0xD5,0x2B,0xD5,0x2B,0xF5,0x2B,0x15,0x2C,0xF5,
+    0x23,0x10,0x13,0x2E,0x02,0x12,0x02,0x76,0x02,0xB2,0x02,0x71,0x02,0xF0,0x01,0xFB,
+    0x95,0x46,0xFF,0xFF,0x00,0xFE,0xFF,0x81,0x18,0x9F,0xEF,0xF4,0x1A,0xEF,0x01,0xB0,
+    0x02,0xB2,0x02,0x73,0x02,0x11,0x02,0x72,0x0A,0xD6,0x2B,0x7B,0x65,0x3C,0x8E,0x3C,
+    0x9E,0x7C,0x8E,0xDC,0x75,0xD9,0x4C,0x12,0x1B,0x11,0x02,0x13,0x02,0xB2,0x02,0xB1,
+    0x02,0x11,0x02,0x30,0x02,0x5A,0x8E,0xFF,0xFF,0xDF,0xFF,0x86,0x0A,0x5B,0x9E,0x51,
+    0x02,0x72,0x02,0xB0,0x02,0x92,0x02,0x92,0x02,0x33,0x02,0x10,0x02,0xBB,0x9E,0xFF,
+    0xFF,0xDF,0xFF,0x4A,0xFF,0xFF,0x81,0x00,0x93,0x02,0x84,0x0C,0xFE,0xFF,0x3E,0xDF,
+    0xD8,0x4C,0x18,0x55,0xD7,0x3C,0x91,0x02,0x92,0x02,0x72,0x02,0x92,0x02,0xB9,0x44,
+    0x19,0x4D,0xF8,0x54,0x5F,0xD7,0x81,0x02,0xFE,0xFF,0xFF,0xFF,0x9F,0xFF,0x81,0x13,
+    0x77,0x44,0xEE,0x01,0x51,0x02,0xD3,0x02,0xB1,0x02,0x2F,0x02,0x2F,0x02,0xF2,0x1A,
+    0xB7,0x4C,0xBA,0x75,0x5C,0x96,0x3C,0x96,0x5D,0x8E,0xDB,0x7D,0x39,0x4D,0xB4,0x2B,
+    0x90,0x02,0xB0,0x01,0x54,0x02,0x7D,0xDF,0x82,0x13,0xFF,0xFF,0xFF,0xFF,0xD5,0x23,
+    0xAF,0x01,0x73,0x02,0xB1,0x02,0x30,0x02,0x51,0x02,0xB6,0x33,0x5A,0x6D,0x7C,0x9E,
+    0xFD,0xBE,0x1C,0xAF,0x7D,0x96,0x7B,0x6D,0x75,0x3C,0xF2,0x12,0xD2,0x01,0x12,0x02,
+    0xFD,0xCE,0x81,0x00,0xDF,0xFF,0x92,0xA9,0x0D,0xDF,0xFF,0xFE,0xFF,0xFF,0xF7,0xDF,
+    0xFF,0xFE,0xFF,0xFF,0xFF,0x3D,0xC7,0xD3,0x02,0xF0,0x01,0x92,0x02,0x92,0x02,0x91,
+    0x02,0x93,0x02,0x93,0x02,0xBF,0x20,0x03,0x92,0x02,0xB3,0x02,0x11,0x02,0xF5,0x23,
+    0x82,0x06,0x58,0x5D,0x0F,0x02,0x33,0x02,0xB3,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,
+    0x89,0x00,0xB2,0x02,0xAE,0xC1,0x81,0x05,0xDF,0xF7,0xF3,0x0A,0x50,0x02,0x92,0x02,
+    0xF2,0x01,0x97,0x34,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x46,0xFF,0xFF,0x07,0x9B,0x85,
+    0x10,0x02,0xB2,0x02,0x72,0x02,0xB3,0x02,0x93,0x02,0x10,0x02,0xF9,0x8D,0x89,0x05,
+    0xBC,0xB6,0x50,0x02,0x92,0x02,0x93,0x02,0x30,0x02,0x7B,0xA6,0x4A,0xFF,0xFF,0x08,
+    0x9B,0xA6,0x11,0x02,0x73,0x02,0x73,0x02,0xF3,0x0A,0xB2,0x02,0x94,0x02,0xF1,0x01,
+    0xF5,0x23,0x48,0xFF,0xFF,0x08,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xB8,0x44,0xF0,0x01,
+    0x93,0x02,0x32,0x02,0x92,0x02,0x5E,0xD7,0x81,0x00,0xFF,0xF7,0x4A,0xFF,0xFF,0x05,
+    0x37,0x55,0xF0,0x01,0xB4,0x02,0x31,0x02,0xD2,0x0A,0xBF,0xEF,0x81,0x07,0xDF,0xFF,
+    0xFF,0xFF,0x3C,0xD7,0x72,0x02,0x73,0x02,0x72,0x02,0x71,0x0A,0x3D,0xD7,0x4E,0xFF,
+    0xFF,0x09,0xFE,0xFF,0xFF,0xFF,0x57,0x3C,0xD0,0x01,0xB2,0x02,0xB2,0x02,0x10,0x02,
+    0x15,0x34,0x7C,0xD7,0xDF,0xFF,0x46,0xFF,0xFF,0x05,0x7F,0xDF,0xB8,0x4C,0xD3,0x23,
+    0xBF,0xEF,0xFF,0xFF,0xFE,0xF7,0x83,0x00,0xD5,0x1B,0x81,0x01,0x10,0x02,0xD9,0x4C,
+    0x8F,0x02,0xF1,0x01,0x92,0x02,0xEF,0x01,0x8E,0x08,0x18,0x4D,0xF0,0x01,0xB3,0x02,
+    0xB2,0x0A,0x14,0x0B,0x73,0x02,0x92,0x02,0xF1,0x01,0x38,0x5D,0x8D,0x06,0x37,0x34,
+    0x10,0x02,0xB2,0x02,0xD0,0x01,0x38,0x55,0xFF,0xFF,0xDF,0xFF,0x43,0xFF,0xFF,0x0A,
+    0xFE,0xF7,0xDC,0x9E,0xD5,0x2B,0xF1,0x01,0x72,0x02,0x93,0x02,0x52,0x02,0x31,0x02,
+    0xFD,0xCE,0xFF,0xFF,0xDF,0xFF,0x42,0xFF,0xFF,0x81,0x04,0x5C,0x96,0x71,0x02,0x92,
+    0x02,0x31,0x02,0xF4,0x12,0x43,0xFF,0xFF,0x00,0xDF,0xFF,0x46,0xFF,0xFF,0x01,0xDF,
+    0xFF,0xDF,0xFF,0x90,0x04,0x96,0x1B,0x10,0x02,0x73,0x02,0xF1,0x01,0x1C,0x76,0x49,
+    0xFF,0xFF,0x04,0xDF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xF7,0xFF,0xF7,0x82,0x02,0xD3,
+    0x2B,0xF1,0x01,0x93,0x02,0x8F,0xC1,0x00,0xBD,0xBE,0x81,0x02,0x52,0x02,0xD3,0x02,
+    0xFF,0xDF,0x4A,0xFF,0xFF,0x00,0xFE,0xFF,0x81,0x0D,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xFE,0xFF,0xFF,0xFF,0xFF,0xE7,0x34,0x13,0xD0,0x01,0x94,0x02,0xB4,0x02,0x11,0x02,
+    0x2F,0x02,0x75,0x44,0x1D,0xB7,0x47,0xFF,0xFF,0x06,0xFD,0xFF,0xDD,0xAE,0x15,0x3C,
+    0xB4,0x23,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x47,0xFF,0xFF,0x05,0xDF,0xEF,0xAF,0x0A,
+    0x53,0x02,0x93,0x02,0x91,0x02,0x3D,0xC7,0x48,0xFF,0xFF,0x00,0xDF,0xFF,0x82,0x06,
+    0x34,0x0B,0x71,0x02,0x91,0x02,0x11,0x02,0x7D,0xA6,0xFF,0xFF,0xFE,0xFF,0x43,0xFF,
+    0xFF,0x08,0xDE,0xEF,0x59,0x96,0x53,0x13,0xF0,0x01,0xB3,0x02,0xB2,0x02,0x12,0x02,
+    0xD3,0x0A,0xBF,0xF7,0x82,0x00,0xDF,0xFF,0x43,0xFF,0xFF,0x08,0xFF,0xF7,0x54,0x1B,
+    0xD1,0x01,0xB3,0x02,0xB3,0x02,0x32,0x02,0x30,0x02,0x75,0x44,0x3D,0xCF,0x46,0xFF,
+    0xFF,0x09,0xFE,0xFF,0x7A,0x8E,0x33,0x1B,0xF0,0x01,0x93,0x02,0x94,0x02,0x32,0x02,
+    0x2F,0x02,0xBA,0xAE,0xFF,0xFF,0x87,0x07,0x52,0x02,0x91,0x02,0xB3,0x02,0x92,0x02,
+    0x73,0x02,0xB3,0x02,0x11,0x02,0xF1,0x12,0x4C,0xFF,0xFF,0x81,0x00,0xB3,0x02,0x84,
+    0x00,0xDE,0xFF,0x43,0xFF,0xFF,0x03,0x92,0x02,0x73,0x02,0x71,0x02,0x94,0x02,0x46,
+    0xFF,0xFF,0x0A,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0x96,0x44,0xCF,0x01,0x53,0x02,0xD3,
+    0x02,0x31,0x02,0x10,0x02,0xB4,0x23,0x5C,0x9E,0x48,0xFF,0xFF,0x0E,0x7E,0xD7,0xF9,
+    0x5C,0x33,0x13,0x3D,0xD7,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDA,0x75,0xF0,
+    0x01,0x94,0x02,0xD2,0x02,0x11,0x02,0xF2,0x12,0xFD,0xA6,0x42,0xFF,0xFF,0x00,0xFE,
+    0xFF,0x43,0xFF,0xFF,0x03,0xFE,0xEF,0xDC,0x75,0x32,0x13,0xBB,0xB6,0x55,0xFF,0xFF,
+    0x6B,0xFF,0xFF,0x0B,0xFE,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x1D,0xBF,
+    0x91,0x0A,0x30,0x02,0xB2,0x02,0x94,0x02,0x94,0x02,0x93,0x02,0x42,0x92,0x02,0x02,
+    0xB2,0x02,0x92,0x02,0xB2,0x02,0x7F,0x1C,0x92,0x02,0x01,0x11,0x02,0xB5,0x23,0x81,
+    0x0B,0xD7,0x4C,0xF1,0x01,0x73,0x02,0x91,0x02,0xB1,0x02,0x93,0x02,0x93,0x02,0x92,
+    0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0x83,0x43,0xB2,0x02,0x84,0x00,0xB2,
+    0x02,0xA9,0x07,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0x16,0x2C,0xEF,0x01,0xB2,0x02,0x32,
+    0x02,0x73,0x13,0x81,0x00,0xFF,0xF7,0x87,0x01,0x17,0x34,0xF0,0x01,0x81,0x03,0x92,
+    0x02,0xD4,0x02,0xB2,0x01,0xB7,0x44,0x89,0x05,0x5A,0x65,0x10,0x02,0x92,0x02,0x31,
+    0x02,0xD3,0x0A,0xBE,0xEF,0x8A,0x0B,0x57,0x3C,0xF1,0x01,0xD3,0x02,0x71,0x02,0xD8,
+    0x3C,0x33,0x13,0x52,0x02,0x72,0x02,0x93,0x02,0x5D,0xD7,0xFF,0xFF,0xFE,0xFF,0x48,
+    0xFF,0xFF,0x07,0xBB,0xAE,0x31,0x02,0x93,0x02,0xB3,0x02,0xEF,0x01,0xBA,0x6D,0xFF,
+    0xFF,0xFE,0xFF,0x4B,0xFF,0xFF,0x0F,0x74,0x13,0xF2,0x01,0xD2,0x02,0x11,0x02,0x57,
+    0x3C,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0x5C,0xCF,0x71,0x02,0x91,
+    0x02,0x72,0x02,0x92,0x02,0xFC,0xC6,0x8D,0x07,0xDE,0xFF,0xFF,0xFF,0x9E,0xD7,0xB2,
+    0x02,0x72,0x02,0xB2,0x02,0x0F,0x02,0xD3,0x23,0x44,0xFF,0xFF,0x00,0xDF,0xFF,0x81,
+    0x00,0xFF,0xF7,0x42,0xFF,0xFF,0x03,0xBE,0xEF,0xDF,0xF7,0xFF,0xFF,0xDE,0xFF,0x83,
+    0x04,0xB5,0x1B,0x11,0x02,0xB2,0x02,0x11,0x02,0xD8,0x4C,0x90,0x02,0xB2,0x02,0x10,
+    0x02,0x57,0x34,0x8D,0x08,0x34,0x13,0x11,0x02,0x93,0x02,0xF1,0x12,0xF7,0x4C,0x72,
+    0x02,0x93,0x02,0x11,0x02,0x54,0x1B,0x82,0x00,0xDF,0xFF,0x89,0x01,0x56,0x2C,0xF0,
+    0x01,0x81,0x01,0x19,0x55,0xDF,0xFF,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x43,0xFF,0xFF,
+    0x05,0x56,0x34,0x10,0x02,0x93,0x02,0xD3,0x02,0xEF,0x01,0xB8,0x4C,0x46,0xFF,0xFF,
+    0x04,0x3C,0x96,0x32,0x02,0x92,0x02,0x32,0x02,0x33,0x0B,0x82,0x00,0xFE,0xFF,0x48,
+    0xFF,0xFF,0x01,0xFF,0xF7,0xFE,0xFF,0x91,0x02,0x93,0x02,0x31,0x02,0xB9,0x7D,0x4A,
+    0xFF,0xFF,0x01,0xFE,0xFF,0xDE,0xF7,0x44,0xFF,0xFF,0x04,0xD3,0x2B,0x10,0x02,0x92,
+    0x02,0x11,0x02,0x17,0x55,0x8F,0x00,0xBC,0xBE,0x81,0x04,0x51,0x02,0xB1,0x0A,0xBD,
+    0xDF,0xFF,0xFF,0xDF,0xFF,0x4B,0xFF,0xFF,0x10,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xF4,0x23,0xF0,0x01,0xB3,0x02,0x93,0x02,0x11,0x02,0xF1,0x0A,0x7C,
+    0xAE,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x47,0xFF,0xFF,0x02,0xBF,
+    0xE7,0xDE,0xF7,0xFF,0xF7,0x88,0x05,0x9D,0xDF,0xCF,0x02,0x72,0x02,0x72,0x02,0x90,
+    0x02,0xDB,0xC6,0x88,0x01,0xFF,0xF7,0xDD,0xFF,0x81,0x04,0x14,0x13,0x31,0x02,0x92,
+    0x02,0x51,0x02,0x7B,0x8E,0x45,0xFF,0xFF,0x0A,0xDF,0xFF,0xFF,0xFF,0xFE,0xF7,0x53,
+    0x1B,0xF1,0x01,0xB2,0x02,0x92,0x02,0xF0,0x01,0x19,0x86,0xFF,0xFF,0xFE,0xFF,0x45,
+    0xFF,0xFF,0x06,0xD8,0x44,0xD1,0x01,0xB2,0x02,0x92,0x02,0x11,0x02,0x71,0x02,0x5A,
+    0x9E,0x42,0xFF,0xFF,0x04,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xBF,0xFF,0x42,
+    0xFF,0xFF,0x07,0xFF,0xF7,0x36,0x34,0xF0,0x01,0x73,0x02,0xB3,0x02,0xF1,0x01,0xF2,
+    0x0A,0xDE,0xEF,0x46,0xFF,0xFF,0x09,0x3B,0xA6,0x32,0x02,0x91,0x02,0x74,0x02,0x15,
+    0x13,0xD2,0x02,0x93,0x02,0x92,0x02,0xCF,0x01,0xF8,0x54,0x8C,0x01,0xF0,0x01,0x93,
+    0x02,0x83,0x0A,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xDF,0xFF,0x5D,0xC7,0x92,
+    0x02,0x72,0x02,0x71,0x02,0x73,0x02,0x1E,0xD7,0x82,0x00,0xFE,0xFF,0x42,0xFF,0xFF,
+    0x07,0xFE,0xFF,0x58,0x65,0xEE,0x01,0x92,0x02,0xB4,0x02,0x10,0x02,0x31,0x02,0x99,
+    0x75,0x4C,0xFF,0xFF,0x03,0xFE,0xEF,0xBF,0xF7,0xFF,0xFF,0xDF,0xFF,0x81,0x05,0x76,
+    0x1B,0xF1,0x01,0xB1,0x02,0x70,0x02,0xB5,0x12,0x9E,0xE7,0x42,0xFF,0xFF,0x01,0xDF,
+    0xFF,0xDF,0xF7,0x81,0x00,0xFF,0xF7,0x42,0xFF,0xFF,0x01,0xFF,0xF7,0x9E,0xE7,0x95,
+    0x71,0xFF,0xFF,0x04,0xFD,0xBE,0xB2,0x02,0x12,0x02,0x94,0x02,0xB3,0x02,0x43,0x92,
+    0x02,0xBF,0x1D,0x0C,0xB2,0x02,0xB3,0x02,0x10,0x02,0x57,0x34,0xFF,0xFF,0x55,0x3C,
+    0xD0,0x01,0x51,0x02,0x91,0x02,0xB3,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0x42,0x92,
+    0x02,0x8D,0x00,0xB2,0x02,0xAA,0x0B,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x98,0x65,0x10,
+    0x02,0x93,0x02,0x71,0x02,0x90,0x02,0xFE,0xBE,0xFF,0xFF,0xFE,0xF7,0xFE,0xFF,0x85,
+    0x08,0xFF,0xF7,0xF4,0x0A,0x51,0x02,0x92,0x02,0xD3,0x0A,0xB1,0x02,0x93,0x02,0x13,
+    0x02,0x73,0x13,0x89,0x04,0xD6,0x2B,0x10,0x02,0xB3,0x02,0xEF,0x01,0x36,0x24,0x47,
+    0xFF,0xFF,0x0D,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xDF,0xD2,0x0A,0x51,0x02,0x93,
+    0x02,0x91,0x0A,0x9C,0xDF,0xD5,0x23,0x11,0x02,0x92,0x02,0xD0,0x01,0x38,0x65,0x47,
+    0xFF,0xFF,0x0B,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x53,0x13,0x11,0x02,0x93,
+    0x02,0x11,0x02,0xD6,0x2B,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x89,0x05,0xDC,0xB6,0x51,
+    0x02,0x71,0x02,0x90,0x02,0x12,0x02,0x9D,0xA6,0x81,0x00,0xFF,0xF7,0x81,0x02,0x3C,
+    0xD7,0x71,0x02,0x71,0x02,0x81,0x03,0xFB,0xBE,0xFF,0xFF,0xFE,0xF7,0xFE,0xFF,0x85,
+    0x02,0xFE,0xFF,0xDE,0xFF,0xFF,0xFF,0x42,0xFE,0xFF,0x09,0xFF,0xFF,0x5C,0x8E,0x11,
+    0x02,0x91,0x02,0x72,0x02,0x13,0x02,0xDC,0xBE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0x43,
+    0xFE,0xFF,0x42,0xFF,0xFF,0x00,0xFE,0xFF,0x48,0xFF,0xFF,0x03,0xB6,0x23,0x11,0x02,
+    0x92,0x02,0x10,0x02,0x90,0x02,0xF0,0x01,0x92,0x02,0xF0,0x01,0x8D,0x0C,0x5B,0x9E,
+    0x10,0x02,0x92,0x02,0x12,0x02,0xD6,0x23,0x7C,0xE7,0xB2,0x0A,0x73,0x02,0x92,0x02,
+    0x30,0x02,0xDB,0xAE,0xFF,0xFF,0xDF,0xFF,0x8A,0x00,0x37,0x34,0x81,0x01,0xF1,0x01,
+    0x18,0x4D,0x45,0xFF,0xFF,0x08,0xFE,0xFF,0xFF,0xF7,0xFF,0xFF,0xDE,0xFF,0x13,0x0B,
+    0x34,0x02,0x72,0x02,0x10,0x02,0xB5,0x1B,0x86,0x04,0x3B,0x96,0x11,0x02,0x52,0x02,
+    0x51,0x02,0x53,0x0B,0x48,0xFF,0xFF,0x05,0xFF,0xF7,0xFE,0xF7,0xFF,0xFF,0xDF,0xF7,
+    0xFF,0xFF,0xDF,0xFF,0x8F,0x04,0xB5,0x1B,0x10,0x02,0xB2,0x02,0x31,0x02,0xB9,0x75,
+    0x8A,0x02,0xFE,0xF7,0xFF,0xFF,0xDF,0xFF,0x83,0x04,0xD4,0x2B,0xF0,0x01,0xB2,0x02,
+    0x11,0x02,0x18,0x55,0x8F,0x00,0xDC,0xBE,0x42,0x72,0x02,0x01,0xD3,0x0A,0x7E,0xD7,
+    0x43,0xFF,0xFF,0x00,0xFE,0xFF,0x83,0x00,0xFE,0xFF,0x81,0x00,0xDF,0xFF,0x82,0x08,
+    0xFE,0xFF,0xFF,0xFF,0x79,0x6D,0xAF,0x01,0x71,0x02,0xD3,0x02,0x12,0x02,0x12,0x13,
+    0x7E,0xDF,0x43,0xFF,0xFF,0x00,0xDF,0xF7,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x82,0x00,
+    0xFF,0xF7,0x42,0xFF,0xFF,0x04,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,
+    0x82,0x0F,0xFF,0xF7,0xFF,0xFF,0x7D,0xDF,0x91,0x02,0x53,0x02,0x52,0x02,0x92,0x02,
+    0x9C,0xBE,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFE,0xF7,0xFF,0xFF,
+    0xFE,0xFF,0x44,0xFF,0xFF,0x08,0x34,0x0B,0x33,0x02,0x73,0x02,0x52,0x02,0x5C,0x96,
+    0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0x43,0xFF,0xFF,0x06,0xDF,0xFF,0x1D,0xC7,
+    0x51,0x02,0x91,0x02,0xB2,0x02,0xF0,0x01,0x98,0x3C,0x46,0xFF,0xFF,0x1A,0xFC,0xAE,
+    0xF2,0x01,0x73,0x02,0x92,0x02,0x4F,0x02,0x70,0x02,0x9C,0xB6,0xFF,0xFF,0xFF,0xFF,
+    0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,
+    0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x34,0x34,0x0E,0x02,0xB3,0x02,0x94,0x02,
+    0xB0,0x01,0xD6,0x4C,0x88,0x08,0xB1,0x02,0x31,0x02,0x16,0x3C,0x17,0x4D,0xF1,0x01,
+    0xB3,0x02,0x72,0x02,0x52,0x02,0xFD,0xB6,0x8B,0x00,0xEF,0x01,0x84,0xC1,0x08,0xFE,
+    0xF7,0xFF,0xFF,0xFF,0xFF,0xFE,0xBE,0x72,0x0A,0x72,0x02,0x51,0x02,0xB2,0x02,0x1D,
+    0xCF,0x81,0x0F,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDE,0xFF,0xFF,0xFF,0xFD,0xC6,0x31,
+    0x02,0x32,0x02,0x93,0x02,0x30,0x02,0x70,0x02,0x9C,0xA6,0xFF,0xFF,0xFE,0xFF,0xFF,
+    0xF7,0xDF,0xFF,0x81,0x03,0xBE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0x81,0x10,0xDF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xDF,0x6F,
+    0x02,0x73,0x02,0xB2,0x02,0xF0,0x01,0x5A,0x6D,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,
+    0xFF,0x44,0xFF,0xFF,0x00,0xDF,0xFF,0x59,0xFF,0xFF,0xAC,0x00,0xFE,0xFF,0x44,0xFF,
+    0xFF,0x06,0x3E,0xC7,0xF3,0x0A,0xEF,0x01,0xB1,0x02,0xB3,0x02,0xB2,0x02,0xB2,0x02,
+    0x44,0x92,0x02,0x00,0xB2,0x02,0xBF,0x19,0x0C,0x92,0x02,0x51,0x02,0xF5,0x23,0x56,
+    0x34,0xB1,0x01,0x72,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0x92,
+    0x02,0x92,0x02,0x43,0xB2,0x02,0x8A,0x42,0xB2,0x02,0xA9,0x00,0xFE,0xFF,0x81,0x05,
+    0x7E,0xC7,0x92,0x02,0x52,0x02,0xB2,0x02,0x10,0x02,0x9A,0x65,0x43,0xFF,0xFF,0x00,
+    0xFE,0xFF,0x83,0x09,0x7C,0xA6,0x51,0x02,0x92,0x02,0x52,0x02,0x37,0x2C,0x74,0x13,
+    0x51,0x02,0x72,0x02,0xB1,0x02,0xFC,0xC6,0x83,0x00,0xDF,0xFF,0x82,0x05,0xBE,0xF7,
+    0xD2,0x0A,0x52,0x02,0x93,0x02,0xEF,0x01,0x79,0x75,0x87,0x0D,0xDE,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xB9,0x75,0xF0,0x01,0x93,0x02,0x10,0x02,0xD5,0x2B,0xFF,0xFF,0x7B,0x65,
+    0xF1,0x01,0x92,0x02,0xF0,0x01,0x54,0x13,0x4B,0xFF,0xFF,0x05,0x18,0x5D,0xF0,0x01,
+    0xD2,0x02,0x73,0x02,0x71,0x02,0x5D,0xCF,0x4B,0xFF,0xFF,0x04,0xD8,0x4C,0xF0,0x01,
+    0x93,0x02,0x11,0x02,0x33,0x13,0x43,0xFF,0xFF,0x06,0xDF,0xFF,0xFF,0xFF,0x3D,0xCF,
+    0x71,0x02,0x73,0x02,0x52,0x02,0x91,0x02,0x81,0xC2,0x00,0xDF,0xFF,0x45,0xFF,0xFF,
+    0x00,0xDF,0xFF,0x43,0xFF,0xFF,0x05,0x9A,0x6D,0x10,0x02,0x90,0x02,0x52,0x02,0xD5,
+    0x0A,0xDF,0xFF,0x44,0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,0x81,0x02,0xFE,0xFF,0xDF,
+    0xFF,0xFF,0xF7,0x87,0x00,0xB6,0x1B,0x81,0x01,0xF0,0x01,0xF8,0x4C,0x8E,0x04,0xD9,
+    0x4C,0xF1,0x01,0xB1,0x02,0xEF,0x01,0x77,0x34,0x8C,0x0D,0x57,0x34,0xF0,0x01,0xD2,
+    0x02,0xF0,0x01,0x7A,0x65,0xFF,0xFF,0xD4,0x2B,0xF1,0x01,0xB3,0x02,0xD0,0x01,0x96,
+    0x3C,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x89,0x04,0x56,0x34,0x11,0x02,0x93,0x02,0xF0,
+    0x01,0xF8,0x4C,0x46,0xFF,0xFF,0x0C,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xB7,0x44,0xF0,
+    0x01,0x93,0x02,0x51,0x02,0xF2,0x0A,0xDF,0xEF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,
+    0xFF,0x81,0x05,0x9B,0x8E,0x51,0x02,0x93,0x02,0x51,0x02,0x13,0x0B,0xBF,0xFF,0x49,
+    0xFF,0xFF,0x00,0xDF,0xFF,0x52,0xFF,0xFF,0x05,0x94,0x23,0x10,0x02,0xB1,0x02,0x30,
+    0x02,0x9A,0x7D,0xDF,0xFF,0x50,0xFF,0xFF,0x94,0x05,0xDD,0xBE,0x71,0x02,0x71,0x02,
+    0x52,0x02,0xD2,0x0A,0x9E,0xD7,0x81,0x1A,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0xFF,0xFF,0xDE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0xFF,0xF7,0xFF,0xF7,
+    0xFE,0xFF,0xFF,0xF7,0xFF,0xFF,0x9E,0xE7,0x92,0x0A,0x32,0x02,0xB2,0x02,0x32,0x02,
+    0x92,0x0A,0x7E,0xDF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x46,0xFF,
+    0xFF,0x05,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xBF,0xFF,0xDF,0xFF,0xFE,0xFF,0x44,0xFF,
+    0xFF,0x00,0xFF,0xF7,0x42,0xFF,0xFF,0x0A,0x5D,0xDF,0x71,0x0A,0x72,0x02,0x71,0x02,
+    0x72,0x02,0xBC,0xB6,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0xFF,0xFF,0xDF,0xFF,0x42,0xFF,
+    0xFF,0x01,0xDF,0xFF,0xFE,0xFF,0x82,0x04,0x34,0x13,0x32,0x02,0xB2,0x02,0x31,0x02,
+    0x1C,0x96,0x43,0xFF,0xFF,0x00,0xFE,0xFF,0x83,0x05,0xFF,0xFF,0xD7,0x1B,0x31,0x02,
+    0x93,0x02,0x12,0x02,0xD4,0x23,0x85,0x09,0xDF,0xFF,0xD5,0x23,0xF1,0x01,0xB3,0x02,
+    0x73,0x02,0x10,0x02,0x5B,0x8E,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x42,0xFF,0xFF,0x02,
+    0xFE,0xFF,0xFF,0xFF,0xDE,0xFF,0x46,0xFF,0xFF,0x05,0x51,0x0B,0x11,0x02,0x74,0x02,
+    0x51,0x02,0x72,0x02,0x5D,0xDF,0x85,0x0A,0x5B,0x9E,0x51,0x02,0x92,0x02,0x32,0x02,
+    0xB2,0x1B,0xDE,0xF7,0x13,0x13,0x12,0x02,0xB4,0x02,0xF0,0x01,0x54,0x13,0x8C,0x00,
+    0xB3,0x02,0x84,0x01,0xFE,0xFF,0xFE,0xFF,0x81,0x05,0x1E,0xBF,0x91,0x02,0x71,0x02,
+    0x73,0x02,0xD1,0x02,0x5C,0xCF,0x42,0xFF,0xFF,0x01,0xFF,0xF7,0xFF,0xFF,0x81,0x06,
+    0x93,0x1B,0xD2,0x01,0xB3,0x02,0x72,0x02,0x31,0x02,0x5B,0x96,0xFF,0xFF,0x81,0x19,
+    0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,
+    0xDF,0xFF,0xFD,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,
+    0xFF,0xFF,0xDB,0xC6,0x4E,0x02,0x94,0x02,0x93,0x02,0x10,0x02,0x3A,0xA6,0xFF,0xFF,
+    0xFE,0xF7,0xDF,0xFF,0x48,0xFF,0xFF,0x00,0xDF,0xFF,0x96,0x6F,0xFF,0xFF,0x00,0xFE,
+    0xFF,0x42,0xFF,0xFF,0x0A,0x7E,0xD7,0x32,0x13,0xF0,0x01,0x93,0x02,0x93,0x02,0xB2,
+    0x02,0xB2,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0xBF,0x1B,0x06,0xB2,0x02,
+    0x72,0x02,0x51,0x02,0x92,0x02,0xB3,0x02,0x93,0x02,0xB2,0x02,0x43,0x92,0x02,0x01,
+    0xB2,0x02,0xB2,0x02,0x60,0x92,0x02,0x99,0xC3,0x0A,0x94,0x1B,0xF0,0x01,0x93,0x02,
+    0xF2,0x01,0x35,0x2C,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDE,0xFF,0xFE,0xFF,0xDF,0xFF,
+    0x82,0x09,0xF7,0x54,0xEF,0x01,0x92,0x02,0x11,0x02,0x5C,0x8E,0x76,0x3C,0x11,0x02,
+    0x93,0x02,0x2F,0x02,0x7A,0x75,0x47,0xFF,0xFF,0x05,0xBD,0xA6,0x51,0x02,0x92,0x02,
+    0x72,0x02,0x53,0x02,0xFC,0xC6,0x4A,0xFF,0xFF,0x0B,0xB5,0x1B,0x11,0x02,0x92,0x02,
+    0x10,0x02,0xD9,0x7D,0xFF,0xFF,0x5D,0xD7,0x71,0x02,0x71,0x02,0x94,0x02,0x30,0x02,
+    0x9B,0xB6,0x82,0x00,0xFE,0xFF,0x81,0x00,0xFE,0xFF,0x83,0x05,0xFD,0xCE,0x70,0x02,
+    0x92,0x02,0x73,0x02,0xEF,0x01,0x59,0x6D,0x8B,0x04,0x53,0x13,0x12,0x02,0xB3,0x02,
+    0xF0,0x01,0x17,0x55,0x45,0xFF,0xFF,0x05,0x3C,0xD7,0x91,0x02,0x72,0x02,0x52,0x02,
+    0x92,0x02,0xDC,0xBE,0x49,0xFF,0xFF,0x03,0xFF,0xF7,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,
+    0x81,0x05,0x7A,0x6D,0xF0,0x01,0x92,0x02,0x72,0x02,0xD3,0x02,0xBF,0xDF,0x81,0x00,
+    0xFE,0xFF,0x42,0xFF,0xFF,0x82,0xCA,0x00,0x96,0x23,0x82,0x00,0xD8,0x54,0x8E,0x03,
+    0xB8,0x4C,0xF0,0x01,0x92,0x02,0xF0,0x01,0x85,0x00,0xFE,0xFF,0x82,0x00,0xDF,0xFF,
+    0x81,0x0E,0x7C,0xEF,0x92,0x0A,0x72,0x02,0x72,0x02,0x92,0x02,0x5C,0xC7,0xFF,0xFF,
+    0xFB,0x85,0xF0,0x01,0x93,0x02,0x70,0x02,0xD2,0x0A,0xBE,0xF7,0xFF,0xFF,0xDF,0xFF,
+    0x89,0x04,0x36,0x34,0x10,0x02,0xB2,0x02,0xF0,0x01,0xF9,0x54,0x86,0x08,0xBF,0xFF,
+    0xDE,0xFF,0xFF,0xFF,0x97,0x75,0xCF,0x01,0xB3,0x02,0x71,0x02,0x90,0x0A,0x7D,0xDF,
+    0x81,0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x04,0x5B,0x96,0x30,0x02,0x72,0x02,0x50,0x02,
+    0x33,0x0B,0x47,0xFF,0xFF,0x00,0xFE,0xFF,0x82,0x01,0xFE,0xFF,0xFD,0xFF,0x90,0x04,
+    0xB4,0x1B,0xF1,0x01,0x92,0x02,0x11,0x02,0x9B,0x75,0x44,0xFF,0xFF,0x00,0xDF,0xFF,
+    0x81,0x00,0xDF,0xFF,0x82,0x00,0xDE,0xFF,0x85,0x01,0x10,0x02,0x93,0x02,0x91,0x01,
+    0xDC,0xBE,0x91,0x02,0x81,0x01,0xB3,0x0A,0x5E,0xDF,0x45,0xFF,0xFF,0x03,0xFF,0xF7,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x46,0xFF,0xFF,0x09,0xF7,0x4C,0xD0,0x01,0xB4,0x02,
+    0x93,0x02,0xF0,0x01,0x5A,0x96,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0xFE,0xFF,0x4A,0xFF,
+    0xFF,0x04,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x81,0x00,0xFE,0xFF,
+    0x44,0xFF,0xFF,0x05,0x7D,0xDF,0xB0,0x0A,0x72,0x02,0x72,0x02,0x92,0x02,0xDC,0xB6,
+    0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x44,0xFF,0xFF,0x01,0xFE,0xFF,0xFE,0xFF,0x83,0x02,
+    0x91,0x02,0x31,0x02,0x3D,0x96,0x83,0x00,0xDF,0xFF,0x81,0x0A,0xFF,0xF7,0xFF,0xFF,
+    0xFF,0xFF,0x98,0x34,0x10,0x02,0x91,0x02,0x12,0x02,0xB3,0x23,0xDF,0xFF,0xFF,0xFF,
+    0xDF,0xFF,0x82,0x05,0xDD,0xB6,0x30,0x02,0xB2,0x02,0xD2,0x02,0xD0,0x01,0x37,0x2C,
+    0x50,0xFF,0xFF,0x05,0x7C,0x9E,0xEF,0x01,0xB3,0x02,0xB3,0x02,0xCF,0x01,0xF8,0x54,
+    0x86,0x0A,0x71,0x02,0x73,0x02,0x33,0x02,0xD1,0x0A,0xFF,0xFF,0xBC,0xB6,0xEF,0x01,
+    0x92,0x02,0xB3,0x02,0xAE,0x01,0x78,0x65,0x8D,0x00,0x94,0x1B,0x82,0x01,0xFF,0xF7,
+    0xDF,0xFF,0x81,0x05,0x1E,0xC7,0x91,0x02,0x72,0x02,0x52,0x02,0xB2,0x02,0x3D,0xCF,
+    0x43,0xFF,0xFF,0x07,0xDF,0xFF,0xFF,0xFF,0x5B,0x9E,0x10,0x02,0x91,0x02,0xB3,0x02,
+    0xF0,0x01,0x78,0x44,0x43,0xFF,0xFF,0x00,0xDF,0xFF,0x4B,0xFF,0xFF,0x0B,0xDF,0xFF,
+    0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDC,0xBE,0x70,0x02,0x94,0x02,0x73,0x02,0xEF,0x01,
+    0x1A,0x8E,0xFF,0xFF,0xFF,0xFF,0x81,0x02,0xFE,0xFF,0xFF,0xF7,0xDF,0xFF,0x5C,0xFF,
+    0xFF,0x71,0xFF,0xFF,0x09,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,0xE7,0x73,0x1B,0xF0,
+    0x01,0x73,0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x81,0x00,0x91,0x02,0x7F,0x19,0x92,
+    0x02,0x81,0xC2,0x02,0xB2,0x02,0x92,0x02,0xB3,0x02,0xBF,0x06,0x08,0xD7,0x4C,0xF0,
+    0x01,0x92,0x02,0x31,0x02,0xF2,0x0A,0xBF,0xF7,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0x44,
+    0xFF,0xFF,0x09,0x95,0x1B,0xF1,0x01,0x53,0x02,0x72,0x02,0xFF,0xFF,0x99,0x65,0xF0,
+    0x01,0xB2,0x02,0x0F,0x02,0x17,0x34,0x81,0x00,0xFE,0xFF,0x84,0x04,0x39,0x55,0xF1,
+    0x01,0x92,0x02,0x30,0x02,0x75,0x13,0x4A,0xFF,0xFF,0x0F,0x3D,0xBF,0x71,0x02,0x54,
+    0x02,0x51,0x02,0xD2,0x0A,0xBF,0xEF,0xFF,0xFF,0xFF,0xFF,0xD4,0x23,0xF1,0x01,0x93,
+    0x02,0xEF,0x01,0x56,0x3C,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x82,0x0A,0xFF,0xFF,0xDF,
+    0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xB4,0x1B,0x11,0x02,0x93,0x02,0x11,
+    0x02,0xB3,0x1B,0x83,0x03,0xFE,0xFF,0xDF,0xFF,0xDF,0xFF,0xFE,0xF7,0x81,0x06,0xDF,
+    0xFF,0x9A,0xA6,0x10,0x02,0x74,0x02,0x92,0x02,0x4F,0x02,0x1E,0xC7,0x87,0x05,0x92,
+    0x02,0x52,0x02,0x72,0x02,0xFC,0xBE,0xFF,0xFF,0xFF,0xF7,0x48,0xFF,0xFF,0x01,0xFE,
+    0xFF,0xFF,0xFF,0x82,0x09,0x1B,0x86,0x12,0x02,0x92,0x02,0xB2,0x02,0x10,0x02,0xD9,
+    0x85,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFE,0xF7,0x4F,0xFF,0xFF,0x00,0xD6,0x1B,0x81,
+    0x01,0x10,0x02,0xDA,0x54,0x83,0x00,0xDF,0xFF,0x86,0x00,0xFE,0xFF,0x81,0x00,0xD8,
+    0x4C,0x88,0xC6,0x0C,0x9A,0x75,0xEF,0x01,0xB3,0x02,0xF1,0x01,0xD6,0x23,0xFF,0xFF,
+    0xFF,0xFF,0x9E,0xF7,0xD3,0x02,0x32,0x02,0x91,0x02,0xF1,0x01,0xFA,0x75,0x8B,0x04,
+    0x37,0x34,0x10,0x02,0x92,0x02,0xF0,0x01,0x19,0x4D,0x49,0xFF,0xFF,0x05,0x78,0x6D,
+    0xEF,0x01,0xB2,0x02,0x52,0x02,0xF1,0x0A,0x9E,0xEF,0x45,0xFF,0xFF,0x04,0x3B,0x96,
+    0x51,0x02,0x93,0x02,0x50,0x02,0x33,0x13,0x49,0xFF,0xFF,0x00,0xFF,0xF7,0x81,0x01,
+    0xFF,0xFF,0xDF,0xFF,0x8F,0x02,0x94,0x23,0xF1,0x01,0xB2,0x02,0x86,0xCC,0x94,0x05,
+    0xDD,0xBE,0x91,0x02,0x72,0x02,0x52,0x02,0xD2,0x02,0x9E,0xD7,0x83,0x02,0xDF,0xFF,
+    0xDF,0xFF,0xFE,0xFF,0x84,0x00,0xFE,0xFF,0x82,0x08,0xDF,0xF7,0x13,0x0B,0x10,0x02,
+    0xB3,0x02,0xF2,0x01,0xB4,0x23,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0x59,0xFF,0xFF,0x00,
+    0x5D,0xDF,0x82,0x01,0x71,0x02,0xBC,0xB6,0x4C,0xFF,0xFF,0x05,0x54,0x0B,0x52,0x02,
+    0x73,0x02,0x51,0x02,0x1C,0x8E,0xFE,0xFF,0x43,0xFF,0xFF,0x00,0xDF,0xFF,0x43,0xFF,
+    0xFF,0x04,0x77,0x2C,0xF0,0x01,0x94,0x02,0x11,0x02,0xF4,0x23,0x42,0xFF,0xFF,0x08,
+    0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0x97,0x4C,0xF1,0x01,0xD1,0x02,0x72,0x02,0x52,0x02,
+    0x3D,0xCF,0x51,0xFF,0xFF,0x04,0x53,0x1B,0x12,0x02,0x93,0x02,0x30,0x02,0x56,0x13,
+    0x81,0x01,0xDF,0xFF,0xDF,0xFF,0x81,0x0C,0x3B,0x9E,0x51,0x02,0x72,0x02,0x52,0x02,
+    0xB3,0x0A,0xDD,0xF7,0xFF,0xFF,0x56,0x3C,0xEF,0x01,0xB3,0x02,0x51,0x02,0x51,0x02,
+    0x9D,0xD7,0x82,0x00,0xFF,0xF7,0x81,0x01,0xDF,0xFF,0xDF,0xFF,0x88,0xC3,0x00,0x3E,
+    0xCF,0x87,0x0A,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x17,0x2C,0xEF,0x01,0xB2,0x02,0x51,
+    0x02,0xB3,0x02,0xDF,0xE7,0xFE,0xFF,0xFF,0xF7,0x52,0xFF,0xFF,0x05,0x3C,0xD7,0xAF,
+    0x02,0x73,0x02,0x73,0x0A,0x11,0x02,0xB7,0x34,0x82,0x02,0xFE,0xF7,0xFF,0xFF,0xFE,
+    0xFF,0x84,0x00,0xDF,0xFF,0x97,0x72,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x03,
+    0x35,0x34,0xF2,0x01,0x51,0x02,0xB1,0x02,0x82,0x01,0x94,0x02,0x93,0x02,0x45,0xB2,
+    0x02,0xBF,0x13,0x00,0xB2,0x02,0x44,0x92,0x02,0x00,0xB2,0x02,0xBF,0x06,0x05,0x9C,
+    0x9E,0x32,0x02,0x92,0x02,0x92,0x02,0x30,0x02,0x5C,0xAE,0x46,0xFF,0xFF,0x0B,0x3D,
+    0xDF,0x91,0x02,0x72,0x02,0x11,0x02,0x54,0x1B,0xFF,0xFF,0x7B,0xAE,0x31,0x02,0x92,
+    0x02,0x31,0x02,0xF3,0x12,0xDE,0xF7,0x46,0xFF,0xFF,0x06,0xD4,0x23,0x11,0x02,0x93,
+    0x02,0xEF,0x01,0x97,0x3C,0xFF,0xFF,0xDF,0xFF,0x88,0x04,0xF7,0x54,0xEF,0x01,0xB4,
+    0x02,0xEF,0x01,0x55,0x34,0x42,0xFF,0xFF,0x09,0x1A,0x76,0xF0,0x01,0x92,0x02,0x51,
+    0x02,0xD2,0x0A,0x9E,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x46,0xFF,0xFF,
+    0x07,0x79,0x75,0xD0,0x01,0xB2,0x02,0x52,0x02,0x91,0x02,0x3D,0xC7,0xFF,0xFF,0xFE,
+    0xFF,0x81,0x45,0xFF,0xFF,0x04,0x76,0x3C,0xEF,0x01,0x92,0x02,0x11,0x02,0x95,0x23,
+    0x46,0xFF,0xFF,0x81,0x02,0x72,0x02,0x72,0x02,0xB2,0x02,0x88,0x00,0xDF,0xFF,0x43,
+    0xFF,0xFF,0x0F,0xDF,0xFF,0xFF,0xF7,0xFF,0xFF,0x7E,0xD7,0x71,0x02,0x32,0x02,0xB2,
+    0x02,0x50,0x02,0x93,0x0A,0x7D,0xCF,0xFF,0xFF,0xFF,0xFF,0xDE,0xF7,0xFE,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0x8C,0x05,0xD5,0x1B,0x11,0x02,0xB2,0x02,0x10,0x02,0xF9,0x44,0xFF,
+    0xFF,0x43,0xFE,0xFF,0x86,0x00,0xFF,0xF7,0x82,0x03,0x11,0x02,0x92,0x02,0x10,0x02,
+    0x77,0x3C,0x8B,0x04,0x93,0x1B,0x12,0x02,0x93,0x02,0xEF,0x01,0xBA,0x75,0x42,0xFF,
+    0xFF,0x04,0x78,0x34,0xCF,0x01,0x93,0x02,0x10,0x02,0xF5,0x23,0x4B,0xFF,0xFF,0x01,
+    0x36,0x34,0x11,0x02,0x81,0x00,0xF8,0x4C,0x87,0x07,0xFE,0xFF,0xFF,0xFF,0x77,0x34,
+    0xEF,0x01,0xB1,0x02,0x33,0x02,0x96,0x1B,0xFE,0xFF,0x85,0x05,0x5C,0x96,0x51,0x02,
+    0x72,0x02,0x31,0x02,0x13,0x0B,0xDF,0xFF,0x88,0x00,0xFE,0xF7,0x53,0xFF,0xFF,0x05,
+    0x95,0x1B,0x10,0x02,0xB2,0x02,0xF1,0x01,0x9A,0x7D,0xDF,0xFF,0x84,0x05,0xDF,0xFF,
+    0xFF,0xF7,0xFE,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0x9B,0x00,0x72,0x02,0x81,0x07,
+    0xD3,0x02,0x9F,0xD7,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFE,0xF7,0xFF,0xFF,0xFF,0xF7,
+    0x81,0x01,0xDF,0xFF,0xDF,0xFF,0x85,0x07,0x1A,0x9E,0x0F,0x02,0x93,0x02,0x92,0x02,
+    0xF1,0x01,0x5C,0x8E,0xFF,0xFF,0xFE,0xFF,0x5A,0xFF,0xFF,0x01,0x5D,0xDF,0x90,0x02,
+    0x82,0x00,0xBC,0xBE,0x8C,0x07,0x14,0x13,0x52,0x02,0x91,0x02,0x4E,0x02,0x5A,0x9E,
+    0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x82,0x04,0xD5,0x13,
+    0x11,0x02,0x93,0x02,0xD1,0x01,0x77,0x3C,0x83,0x06,0xFF,0xFF,0xFF,0xFF,0x33,0x1B,
+    0x12,0x02,0xB2,0x02,0xF0,0x01,0xB5,0x23,0x50,0xFF,0xFF,0x07,0xBE,0xFF,0xFF,0xFF,
+    0x39,0x55,0xF0,0x01,0x93,0x02,0x72,0x02,0x50,0x02,0xDB,0xC6,0x85,0x0B,0x31,0x02,
+    0x91,0x02,0x71,0x02,0xD3,0x0A,0xDE,0xE7,0xFF,0xFF,0xDF,0xE7,0x92,0x0A,0x32,0x02,
+    0xB3,0x02,0xD1,0x01,0xB5,0x23,0x81,0x05,0xDF,0xFF,0xDF,0xFF,0xFE,0xFF,0xFE,0xF7,
+    0xDF,0xFF,0xFF,0xFF,0x84,0x00,0x74,0x1B,0x86,0x01,0x3E,0xC7,0x72,0x02,0x86,0xC1,
+    0x05,0x7E,0xEF,0xB2,0x02,0x72,0x02,0x92,0x02,0xD0,0x01,0xF8,0x3C,0x43,0xFF,0xFF,
+    0x00,0xFE,0xFF,0x8B,0x00,0xDF,0xFF,0x44,0xFF,0xFF,0x0C,0x75,0x1B,0x11,0x02,0xD3,
+    0x02,0x54,0x02,0x50,0x02,0x5A,0x96,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xDE,0xFF,0xFF,0xF7,0x82,0x02,0xFE,0xFF,0xDF,0xFF,0xDF,0xFF,0x95,0xB2,0x00,
+    0xFE,0xFF,0x43,0xFF,0xFF,0x05,0x37,0x5D,0x2F,0x02,0x31,0x02,0xB3,0x02,0x93,0x02,
+    0x92,0x02,0x43,0xB2,0x02,0x00,0x92,0x02,0x44,0xB2,0x02,0x7F,0x11,0x92,0x02,0x45,
+    0xB2,0x02,0x00,0x92,0x02,0x85,0x61,0x92,0x02,0x99,0x00,0xDF,0xFF,0x82,0x05,0xFF,
+    0xF7,0xF4,0x12,0x51,0x02,0xB2,0x02,0xF0,0x01,0x17,0x55,0x85,0x0C,0xDF,0xFF,0x99,
+    0x7D,0x10,0x02,0x93,0x02,0xEF,0x01,0x19,0x4D,0xFF,0xFF,0x9E,0xF7,0xF4,0x0A,0x71,
+    0x02,0x73,0x02,0x31,0x02,0xBC,0xA6,0x85,0x05,0xBF,0xEF,0xB2,0x0A,0x51,0x02,0x93,
+    0x02,0x11,0x02,0xFA,0x8D,0x49,0xFF,0xFF,0x0E,0xDF,0xFF,0x13,0x0B,0x31,0x02,0x72,
+    0x02,0x10,0x02,0x5A,0x96,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0x9E,0xE7,0xB2,0x02,0x51,
+    0x02,0x92,0x02,0x2F,0x02,0xDA,0x75,0x42,0xFF,0xFF,0x05,0xFF,0xF7,0xDF,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0xFF,0xFF,0xDE,0xFF,0x81,0x05,0x7F,0xE7,0x92,0x02,0x70,0x02,0x93,
+    0x02,0xF1,0x01,0x37,0x5D,0x44,0xFF,0xFF,0x01,0xDE,0xFF,0xDF,0xFF,0x81,0x05,0xFE,
+    0xEF,0xD3,0x0A,0x51,0x02,0xB1,0x02,0xD0,0x01,0x5A,0x7D,0x87,0x00,0x71,0x02,0x81,
+    0x01,0xB1,0x02,0xDC,0xBE,0x48,0xFF,0xFF,0x01,0xDE,0xFF,0xFE,0xFF,0x45,0xFF,0xFF,
+    0x06,0x54,0x2C,0xD1,0x01,0xB3,0x02,0xB3,0x02,0x70,0x02,0xD1,0x0A,0x3C,0x96,0x42,
+    0xFF,0xFF,0x03,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x8A,0x04,0xB5,0x1B,0x11,
+    0x02,0xB3,0x02,0x11,0x02,0xD9,0x4C,0x4C,0xFF,0xFF,0x02,0xDF,0xFF,0xFF,0xFF,0xF7,
+    0x4C,0x81,0x01,0x0F,0x02,0x77,0x34,0x85,0x01,0xDF,0xFF,0xFF,0xF7,0x82,0x05,0xFD,
+    0xBE,0x50,0x02,0x73,0x02,0x52,0x02,0xB3,0x02,0x7D,0xF7,0x82,0x06,0x7A,0x9E,0x31,
+    0x02,0x92,0x02,0x92,0x02,0x72,0x02,0x3C,0xCF,0xDF,0xFF,0x8A,0x03,0xF0,0x01,0xB1,
+    0x02,0xF0,0x01,0x18,0x55,0x48,0xFF,0xFF,0x05,0xBE,0xEF,0xB3,0x0A,0x73,0x02,0x93,
+    0x02,0xD2,0x01,0xB9,0x44,0x46,0xFF,0xFF,0x00,0x3C,0x96,0x81,0x02,0x32,0x02,0x34,
+    0x0B,0xFE,0xFF,0x4A,0xFF,0xFF,0x00,0xFE,0xFF,0x91,0x04,0xB5,0x1B,0x10,0x02,0x93,
+    0x02,0x12,0x02,0x99,0x7D,0x43,0xFF,0xFF,0x00,0xDF,0xFF,0x81,0x03,0xFF,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0xDF,0xFF,0x46,0xFF,0xFF,0x92,0x07,0xFE,0xFF,0xFF,0xFF,0xDC,0xBE,
+    0x92,0x02,0x72,0x02,0x51,0x02,0x93,0x0A,0x7E,0xD7,0x45,0xFF,0xFF,0x03,0xDF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x45,0xFF,0xFF,0x08,0xB8,0x44,0xEF,0x01,0xD3,0x02,
+    0x51,0x02,0xD3,0x0A,0xFE,0xF7,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xAC,0x04,0x54,0x0B,
+    0x51,0x02,0x92,0x02,0x31,0x02,0x5C,0x8E,0x48,0xFF,0xFF,0x07,0xDB,0xBE,0x31,0x02,
+    0xB2,0x02,0xB2,0x02,0xF0,0x01,0xFA,0x7D,0xFF,0xFF,0xDE,0xFF,0x42,0xFF,0xFF,0x05,
+    0x5E,0xCF,0x93,0x02,0x51,0x02,0x92,0x02,0xF1,0x01,0x59,0x6D,0x52,0xFF,0xFF,0x05,
+    0xDD,0xAE,0x30,0x02,0xB2,0x02,0x93,0x02,0x0F,0x02,0xB9,0x7D,0x81,0x42,0xFF,0xFF,
+    0x12,0x3B,0x9E,0x32,0x02,0x92,0x02,0x51,0x02,0xD2,0x12,0xDF,0xE7,0xFF,0xFF,0xFF,
+    0xFF,0x39,0x86,0xF1,0x01,0x93,0x02,0xB2,0x02,0xF0,0x01,0xFA,0x8D,0xDF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0x42,0xFF,0xFF,0x8C,0x00,0x92,0x02,0x88,0x07,
+    0xFA,0x9D,0x0F,0x02,0x94,0x02,0x73,0x02,0x51,0x02,0xDB,0xA6,0xFF,0xFF,0xFF,0xF7,
+    0x8E,0xC3,0x0E,0xFF,0xF7,0xFF,0xFF,0x59,0x75,0xB1,0x01,0xD1,0x02,0xD2,0x02,0x12,
+    0x02,0x50,0x02,0x58,0x65,0xFE,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFE,0xF7,0xFE,
+    0xFF,0x81,0x01,0xFE,0xFF,0xFE,0xFF,0x57,0xFF,0xFF,0xB5,0x0A,0xDF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0x1A,0x8E,0x52,0x02,0xF1,0x01,0xB1,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,
+    0xB2,0x02,0x7F,0x19,0x92,0x02,0x83,0x69,0x92,0x02,0x99,0xC4,0x04,0x36,0x34,0x10,
+    0x02,0xB1,0x02,0xF1,0x01,0xB5,0x23,0x46,0xFF,0xFF,0x17,0x57,0x2C,0xCF,0x01,0x74,
+    0x02,0x30,0x02,0x9B,0x9E,0xFF,0xFF,0xFF,0xFF,0x37,0x2C,0x0F,0x02,0x92,0x02,0xF1,
+    0x01,0xF8,0x5C,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0x3C,
+    0x9E,0x31,0x02,0x92,0x02,0x72,0x02,0xB3,0x02,0xBE,0xE7,0x89,0x05,0x5C,0x9E,0xF0,
+    0x01,0x93,0x02,0x50,0x02,0x14,0x0B,0xDF,0xFF,0x43,0xFF,0xFF,0x04,0x76,0x34,0xD1,
+    0x01,0x93,0x02,0x11,0x02,0xB5,0x23,0x45,0xFF,0xFF,0x0A,0xFE,0xFF,0xFF,0xF7,0xFF,
+    0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x35,0x24,0x10,0x02,0x93,0x02,0xF2,0x01,0x93,
+    0x1B,0x48,0xFF,0xFF,0x05,0x3A,0x8E,0x10,0x02,0xB4,0x02,0x92,0x02,0x92,0x02,0x7E,
+    0xE7,0x8A,0x01,0x71,0x02,0x9E,0xDF,0x4A,0xFF,0xFF,0x00,0xDF,0xFF,0x81,0x00,0xFF,
+    0xF7,0x81,0x08,0x3D,0xD7,0x71,0x02,0xF1,0x01,0x94,0x02,0xB2,0x02,0x30,0x02,0xF0,
+    0x01,0x16,0x34,0x3C,0xCF,0x42,0xFF,0xFF,0x01,0xDF,0xFF,0xFF,0xF7,0x8A,0x04,0xB6,
+    0x23,0x11,0x02,0x92,0x02,0xF0,0x01,0x59,0x55,0x8A,0x00,0xDF,0xFF,0x42,0xFF,0xFF,
+    0x03,0x38,0x5D,0xF1,0x01,0x93,0x02,0x10,0x02,0x87,0x43,0xFF,0xFF,0x04,0xB7,0x4C,
+    0x11,0x02,0xB4,0x02,0xF1,0x01,0x56,0x2C,0x43,0xFF,0xFF,0x05,0xFE,0xFF,0x34,0x0B,
+    0x32,0x02,0x92,0x02,0xD0,0x01,0x39,0x55,0x4A,0xFF,0xFF,0x04,0x37,0x34,0xF1,0x01,
+    0x92,0x02,0xD0,0x01,0xF9,0x4C,0x83,0x02,0xFF,0xF7,0xFF,0xFF,0xFE,0xFF,0x81,0x05,
+    0x34,0x34,0xF1,0x01,0x93,0x02,0x72,0x02,0x30,0x02,0x1B,0xC7,0x83,0x00,0xFE,0xFF,
+    0x84,0x03,0x31,0x02,0x34,0x0B,0xFF,0xFF,0xDF,0xFF,0x85,0x01,0xDF,0xFF,0xFE,0xFF,
+    0x81,0x00,0xDF,0xFF,0x91,0x01,0x95,0x1B,0x0F,0x02,0x81,0x00,0x3B,0x7E,0x51,0xFF,
+    0xFF,0x91,0x00,0xFE,0xFF,0x81,0x00,0xBC,0xBE,0x82,0x01,0xD1,0x0A,0xFF,0xEF,0x4F,
+    0xFF,0xFF,0x08,0xB6,0x1B,0x31,0x02,0xB2,0x02,0xF0,0x01,0x36,0x2C,0xFF,0xFF,0xFF,
+    0xFF,0xDF,0xFF,0xDF,0xFF,0x9A,0x00,0xB1,0x0A,0x90,0x04,0x33,0x0B,0x31,0x02,0x73,
+    0x02,0x33,0x02,0x3B,0x8E,0x84,0x01,0xFE,0xFF,0xFE,0xFF,0x81,0x08,0x53,0x13,0xF1,
+    0x01,0x92,0x02,0x30,0x02,0xD1,0x0A,0xBE,0xEF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0x81,
+    0x05,0x5C,0x9E,0x32,0x02,0xB2,0x02,0x72,0x02,0x51,0x02,0xDC,0xAE,0x90,0x07,0xFE,
+    0xFF,0xFF,0xFF,0x7D,0xEF,0xD1,0x0A,0x72,0x02,0xB3,0x02,0xF1,0x01,0x19,0x4D,0x44,
+    0xFF,0xFF,0x05,0x5B,0x9E,0x32,0x02,0x73,0x02,0x51,0x02,0xD1,0x12,0xDE,0xF7,0x81,
+    0x0A,0xDF,0xFF,0xF7,0x2B,0xF1,0x01,0xD1,0x02,0x11,0x02,0x92,0x02,0x9E,0xE7,0xFF,
+    0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x99,0x05,0x58,0x4D,0xEF,0x01,0x94,0x02,0x72,
+    0x02,0xF3,0x0A,0xDE,0xFF,0x83,0xD2,0x08,0xFF,0xF7,0x34,0x1B,0xD1,0x01,0xB1,0x02,
+    0xB2,0x02,0x52,0x02,0xF0,0x01,0x75,0x1B,0x7B,0xA6,0x45,0xFF,0xFF,0x00,0xDE,0xFF,
+    0x58,0xFF,0xFF,0x74,0xFF,0xFF,0x0A,0xFE,0xFF,0xFF,0xF7,0xDF,0xF7,0xFF,0xFF,0xFF,
+    0xFF,0xDC,0xBE,0x54,0x13,0xF0,0x01,0x72,0x02,0x93,0x02,0xB2,0x02,0x7F,0x1B,0x92,
+    0x02,0x81,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x81,0x01,0xB2,0x02,0xB2,0x02,0xBF,
+    0x03,0x05,0xDB,0x85,0xF0,0x01,0xB2,0x02,0x52,0x02,0xB3,0x02,0x9E,0xD7,0x81,0x00,
+    0xDF,0xFF,0x81,0x05,0xDF,0xFF,0xF5,0x0A,0x50,0x02,0x32,0x02,0xD3,0x0A,0xDD,0xF7,
+    0x81,0x06,0x78,0x6D,0xF0,0x01,0xB2,0x02,0x11,0x02,0xB5,0x23,0xFF,0xFF,0xFF,0xFF,
+    0x83,0x04,0xF8,0x54,0xEF,0x01,0xB3,0x02,0xF1,0x01,0xD4,0x23,0x4A,0xFF,0xFF,0x06,
+    0x37,0x34,0xF1,0x01,0xB2,0x02,0xEF,0x01,0xB8,0x44,0xFF,0xFF,0xFE,0xFF,0x82,0x07,
+    0x5A,0x9E,0x11,0x02,0x93,0x02,0x72,0x02,0x70,0x02,0xFC,0xCE,0xFF,0xFF,0xFE,0xFF,
+    0x48,0xFF,0xFF,0x05,0x1A,0x8E,0xF1,0x01,0x72,0x02,0x92,0x02,0x71,0x02,0x1D,0xC7,
+    0x84,0x00,0xFE,0xF7,0x81,0x04,0x56,0x2C,0xF1,0x01,0xB4,0x02,0xF0,0x01,0x37,0x2C,
+    0x47,0xFF,0xFF,0x12,0x5C,0xD7,0x71,0x02,0x73,0x02,0x72,0x02,0x72,0x02,0xB9,0x75,
+    0x7A,0xAE,0x5A,0xA6,0x5B,0xA6,0x7A,0x9E,0x5A,0x9E,0x7A,0xA6,0x5A,0x9E,0x59,0x9E,
+    0x7A,0x9E,0x39,0x8E,0x1D,0xCF,0xDF,0xFF,0xDF,0xFF,0x81,0x0C,0xFF,0xF7,0xFF,0xFF,
+    0xFF,0xFF,0x5B,0x8E,0x0E,0x02,0x11,0x02,0x74,0x02,0x92,0x02,0x91,0x02,0xCF,0x01,
+    0x72,0x0A,0xF7,0x44,0x5D,0xDF,0x4D,0xFF,0xFF,0x18,0x95,0x1B,0x31,0x02,0x92,0x02,
+    0x31,0x02,0x55,0x2C,0x5A,0xB6,0x7A,0x9E,0x5A,0x9E,0x39,0xA6,0x59,0x9E,0x7A,0x9E,
+    0x7A,0x9E,0x5A,0xA6,0x7A,0xA6,0x59,0x9E,0x7A,0xA6,0x5A,0xA6,0x59,0x9E,0x5A,0xA6,
+    0x5B,0xB6,0x56,0x2C,0x32,0x02,0x73,0x02,0xF0,0x01,0x57,0x34,0x46,0xFF,0xFF,0x00,
+    0xFE,0xFF,0x81,0x05,0xFF,0xF7,0x13,0x0B,0x32,0x02,0x92,0x02,0x11,0x02,0x3A,0x96,
+    0x82,0x06,0xFE,0xFF,0xFF,0xFF,0xD8,0x4C,0xD0,0x01,0x92,0x02,0x32,0x02,0x14,0x13,
+    0x8A,0x04,0x57,0x34,0xF0,0x01,0xB2,0x02,0xB0,0x01,0x59,0x5D,0x46,0xFF,0xFF,0x06,
+    0x7E,0xF7,0x76,0x3C,0xF0,0x01,0x53,0x02,0x92,0x02,0xCE,0x01,0xB7,0x44,0x44,0xFF,
+    0xFF,0x82,0x10,0x3C,0x9E,0x31,0x02,0x92,0x02,0x52,0x02,0xF4,0x02,0x5A,0x96,0x7A,
+    0xAE,0x59,0x9E,0x5A,0x9E,0x3A,0xA6,0x7A,0x9E,0x7A,0x9E,0x59,0xA6,0x5A,0xA6,0x5A,
+    0xA6,0x1A,0x96,0x7D,0xDF,0x52,0xFF,0xFF,0x10,0x96,0x1B,0x10,0x02,0x93,0x02,0x32,
+    0x02,0x18,0x45,0x5A,0xB6,0x5A,0xA6,0x59,0xA6,0x5A,0xA6,0x5A,0xA6,0x7A,0x9E,0x7A,
+    0xA6,0x59,0xA6,0x5A,0x9E,0x39,0x8E,0xBC,0xB6,0xDF,0xFF,0x98,0x00,0xFF,0xFF,0x83,
+    0x0D,0x72,0x02,0xD2,0x0A,0x1A,0x7E,0x5A,0xA6,0x5A,0xA6,0x5A,0x96,0x7A,0x9E,0x99,
+    0x9E,0x59,0xA6,0x5B,0x9E,0x5A,0xA6,0x5A,0x9E,0x19,0x8E,0x5D,0xD7,0x83,0x01,0xDF,
+    0xFF,0x35,0x13,0x82,0x01,0x18,0x55,0xFF,0xF7,0x5C,0xFF,0xFF,0x92,0x04,0x13,0x13,
+    0x13,0x02,0x73,0x02,0x51,0x02,0x9C,0xAE,0x46,0xFF,0xFF,0x0E,0x3C,0xD7,0x94,0x1B,
+    0x10,0x02,0xB3,0x02,0x53,0x02,0x8F,0x01,0x9B,0x7D,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,
+    0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0x9A,0x75,0x11,0x02,0x81,0x01,0xF3,0x02,0x7E,0xDF,
+    0x52,0xFF,0xFF,0x05,0xFE,0xFF,0x34,0x1B,0x31,0x02,0xB1,0x02,0xF1,0x01,0x57,0x34,
+    0x85,0x04,0x51,0x02,0x73,0x02,0x72,0x02,0xF1,0x0A,0xBE,0xFF,0x42,0xFF,0xFF,0x0B,
+    0x7D,0xE7,0x90,0x02,0x32,0x02,0x94,0x02,0xCF,0x01,0x56,0x2C,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xF7,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x82,0x02,0x93,0x02,0x31,0x02,0x93,0x1B,
+    0x89,0x01,0x72,0x02,0x92,0x02,0x85,0x04,0x57,0x2C,0x11,0x02,0x73,0x02,0x10,0x02,
+    0xD4,0x23,0x42,0xFF,0xFF,0x00,0xFE,0xFF,0x91,0x0C,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0x7D,0xCF,0xD3,0x0A,0xB0,0x01,0x94,0x02,0xD1,0x02,0x93,0x02,0x12,0x02,0x31,0x02,
+    0xD6,0x33,0x9B,0xBE,0x82,0x02,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0x97,0xB1,0x00,0xDF,
+    0xFF,0x47,0xFF,0xFF,0x07,0xFF,0xF7,0x58,0x3C,0xF0,0x01,0x2F,0x02,0xB3,0x02,0x92,
+    0x02,0xB2,0x02,0x92,0x02,0x44,0xB2,0x02,0xBF,0x12,0x01,0xB2,0x02,0xB2,0x02,0x45,
+    0x92,0x02,0xBF,0x05,0x05,0x7D,0xDF,0x91,0x02,0x72,0x02,0x92,0x02,0x11,0x02,0x1A,
+    0x8E,0x44,0xFF,0xFF,0x04,0x7B,0xB6,0x11,0x02,0xB2,0x02,0xF0,0x01,0xF7,0x33,0x42,
+    0xFF,0xFF,0x05,0xFB,0xC6,0x92,0x02,0x73,0x02,0x73,0x02,0x92,0x02,0x9E,0xE7,0x44,
+    0xFF,0xFF,0x06,0xB4,0x1B,0x31,0x02,0x73,0x02,0xF0,0x01,0x37,0x65,0xFF,0xFF,0xDF,
+    0xFF,0x87,0x05,0x9E,0xDF,0xB2,0x02,0x92,0x02,0x91,0x02,0x31,0x02,0xBC,0xB6,0x42,
+    0xFF,0xFF,0x0A,0xFE,0xF7,0xFF,0xFF,0xBF,0xFF,0x33,0x13,0x32,0x02,0x93,0x02,0xF0,
+    0x01,0xF7,0x4C,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x84,0x00,0xFF,0xF7,0x81,0x05,0xBF,
+    0xF7,0xD3,0x0A,0x31,0x02,0xD2,0x02,0xF1,0x01,0xF7,0x54,0x82,0x01,0xFE,0xFF,0xFF,
+    0xF7,0x81,0x09,0x9E,0xDF,0xB2,0x0A,0x33,0x02,0xB2,0x02,0xF0,0x01,0x1A,0x96,0xFF,
+    0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0x83,0x10,0x5C,0xCF,0x70,0x0A,0x71,0x02,0x92,
+    0x02,0x94,0x02,0x31,0x02,0x2F,0x02,0x31,0x02,0x11,0x02,0x50,0x02,0x50,0x02,0x30,
+    0x02,0x50,0x02,0x50,0x02,0x30,0x02,0x8D,0x01,0x96,0x5C,0x43,0xFF,0xFF,0x00,0xDF,
+    0xFF,0x42,0xFF,0xFF,0x0A,0x9B,0xA6,0xD1,0x02,0xD1,0x01,0x72,0x02,0xD2,0x02,0xB2,
+    0x02,0x52,0x02,0xCF,0x01,0xB3,0x02,0xB7,0x4C,0x5E,0xE7,0x8B,0x09,0xB6,0x23,0x10,
+    0x02,0x92,0x02,0x94,0x02,0x52,0x02,0x2F,0x02,0x50,0x02,0x50,0x02,0x31,0x02,0x51,
+    0x02,0x44,0x30,0x02,0x09,0x50,0x02,0x30,0x02,0x50,0x02,0x31,0x02,0x10,0x02,0x72,
+    0x02,0xD3,0x02,0x93,0x02,0xCF,0x01,0x56,0x34,0x49,0xFF,0xFF,0x05,0x5A,0x8E,0x10,
+    0x02,0x93,0x02,0x31,0x02,0x12,0x0B,0xDF,0xFF,0x84,0x05,0xDD,0xC6,0x31,0x02,0x91,
+    0x02,0xB3,0x02,0x31,0x02,0x7B,0xA6,0x88,0x16,0xFE,0xFF,0x37,0x34,0x10,0x02,0x92,
+    0x02,0x32,0x02,0x35,0x2C,0x9A,0xBE,0x7A,0x9E,0x7A,0x9E,0x5A,0xA6,0x7B,0x9E,0xD8,
+    0x95,0xB6,0x4C,0xF2,0x0A,0xF0,0x01,0x94,0x02,0x54,0x02,0xD0,0x01,0xB5,0x2B,0xDE,
+    0xFF,0xFF,0xFF,0xFF,0xF7,0xFE,0xFF,0x44,0xFF,0xFF,0x10,0x3C,0x9E,0x30,0x02,0x92,
+    0x02,0x93,0x02,0x92,0x02,0x2E,0x02,0x4F,0x02,0x30,0x02,0x30,0x02,0x4F,0x02,0x4F,
+    0x02,0x10,0x02,0x30,0x02,0x51,0x02,0x10,0x02,0xAF,0x01,0xDB,0x7D,0x81,0x00,0xFE,
+    0xFF,0x8F,0x0F,0xB4,0x1B,0x10,0x02,0x94,0x02,0xB2,0x02,0x30,0x02,0x4F,0x02,0x30,
+    0x02,0x50,0x02,0x30,0x02,0x50,0x02,0x30,0x02,0x31,0x02,0x51,0x02,0x31,0x02,0xAF,
+    0x01,0x53,0x1B,0x46,0xFF,0xFF,0x91,0xC2,0x82,0x0D,0x92,0x02,0x74,0x02,0x31,0x02,
+    0x50,0x02,0x4F,0x02,0x51,0x02,0x31,0x02,0x2F,0x02,0x31,0x02,0x51,0x02,0x50,0x02,
+    0x50,0x02,0x8D,0x01,0x17,0x6D,0x83,0x05,0x7E,0xD7,0xB3,0x0A,0x71,0x02,0xB3,0x02,
+    0x12,0x02,0xB9,0x75,0x5D,0xFF,0xFF,0x01,0x5D,0xDF,0x90,0x02,0x8F,0x15,0xFE,0xFF,
+    0x32,0x0B,0x33,0x02,0x92,0x02,0x50,0x02,0x39,0x5D,0x7B,0xB6,0x5A,0x9E,0x5A,0x9E,
+    0x5A,0xAE,0x5A,0xAE,0x79,0x85,0x76,0x34,0xB2,0x02,0x0F,0x02,0xD2,0x02,0x51,0x02,
+    0xEF,0x01,0xF9,0x54,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x81,0xC1,0x00,0xF7,0x5C,0x81,
+    0x02,0x31,0x02,0x55,0x13,0xDF,0xF7,0x90,0x07,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB7,
+    0x23,0x10,0x02,0xD2,0x02,0xF1,0x01,0x17,0x34,0x86,0x03,0x92,0x02,0x53,0x02,0xF2,
+    0x0A,0xFD,0xF7,0x43,0xFF,0xFF,0x08,0x99,0x7D,0xD0,0x01,0xB3,0x02,0x72,0x02,0xF0,
+    0x01,0x7C,0x96,0xFF,0xFF,0xFE,0xF7,0xFF,0xF7,0x42,0xFF,0xFF,0x81,0x02,0xB3,0x02,
+    0x32,0x02,0x94,0x1B,0x89,0x02,0x51,0x02,0x92,0x02,0x3E,0xCF,0x84,0x04,0x96,0x23,
+    0x10,0x02,0x92,0x02,0x10,0x02,0x36,0x3C,0x81,0x00,0xFE,0xFF,0x81,0x00,0xDF,0xFF,
+    0x8E,0x12,0xFE,0xFF,0xFE,0xF7,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0x7E,0xDF,0x93,0x1B,
+    0xAF,0x01,0x52,0x02,0xD4,0x02,0xB1,0x02,0x71,0x02,0xF0,0x01,0x31,0x02,0xF3,0x33,
+    0xDA,0xBE,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x58,0xFF,0xFF,0xB0,0x02,0xFE,0xFF,0xFF,
+    0xFF,0xFF,0xF7,0x48,0xFF,0xFF,0x02,0xDB,0x7D,0x92,0x02,0xF0,0x01,0x81,0xC1,0x00,
+    0xB3,0x02,0xBF,0x13,0x01,0xB2,0x02,0xB2,0x02,0x42,0x92,0x02,0x02,0xB2,0x02,0x92,
+    0x02,0xB2,0x02,0xBF,0x02,0x0A,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0xFF,0xFF,
+    0xFF,0xFF,0x95,0x23,0x11,0x02,0xD3,0x02,0xEF,0x01,0x97,0x44,0x84,0x04,0x37,0x55,
+    0xEF,0x01,0x94,0x02,0x10,0x02,0xBA,0x6D,0x43,0xFF,0xFF,0x04,0x55,0x13,0x31,0x02,
+    0x92,0x02,0x10,0x02,0x3C,0x8E,0x83,0x05,0x9F,0xDF,0xD2,0x02,0x71,0x02,0x73,0x02,
+    0x52,0x02,0xFC,0xAE,0x89,0x04,0x59,0x7D,0xF1,0x01,0xB2,0x02,0x12,0x02,0x74,0x13,
+    0x43,0xFF,0xFF,0x07,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xD7,0x4C,0xF0,0x01,0xB3,0x02,
+    0x32,0x02,0x12,0x13,0x81,0x00,0xDF,0xFF,0x84,0x08,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0x95,0x34,0xF0,0x01,0xB2,0x02,0x12,0x02,0x34,0x1B,0x81,0x0D,0xFE,0xF7,
+    0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFA,0x75,0x10,0x02,0x93,0x02,0x51,0x02,
+    0x12,0x0B,0xBE,0xF7,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x44,0xFF,0xFF,0x10,0x5C,0xCF,
+    0x71,0x0A,0x72,0x02,0xB1,0x02,0x93,0x02,0x92,0x02,0x72,0x02,0x91,0x02,0x73,0x02,
+    0x93,0x02,0x92,0x02,0x73,0x02,0x93,0x02,0x73,0x02,0x93,0x02,0xF2,0x01,0xFA,0x4C,
+    0x82,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x0C,0xDF,0xFF,0xFF,0xFF,0x9E,0xEF,0x36,0x34,
+    0x30,0x02,0xF0,0x01,0x94,0x02,0xB2,0x02,0x93,0x02,0x52,0x02,0xCE,0x01,0xB0,0x0A,
+    0x38,0x65,0x8A,0x08,0xB7,0x23,0x11,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0x93,0x02,
+    0x93,0x02,0x52,0x02,0x73,0x02,0x42,0x93,0x02,0x0C,0x73,0x02,0x93,0x02,0x72,0x02,
+    0x92,0x02,0x93,0x02,0x72,0x02,0x92,0x02,0x72,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,
+    0xF0,0x01,0x77,0x34,0x86,0x00,0xDF,0xFF,0x81,0x10,0x15,0x2C,0xEF,0x01,0xB3,0x02,
+    0xD0,0x01,0xB7,0x3C,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xF7,0xFF,0xFF,
+    0xFF,0xFF,0xB5,0x13,0x10,0x02,0x92,0x02,0xF0,0x01,0x55,0x34,0x49,0xFF,0xFF,0x10,
+    0x36,0x2C,0xF1,0x01,0xB2,0x02,0xB3,0x02,0x91,0x02,0x50,0x02,0x31,0x02,0x51,0x02,
+    0x51,0x02,0x52,0x02,0x11,0x02,0xF0,0x01,0x91,0x02,0x32,0x02,0xD0,0x01,0x4F,0x02,
+    0xD6,0x4C,0x42,0xFF,0xFF,0x81,0x00,0xDF,0xFF,0x83,0x04,0x3C,0x96,0x30,0x02,0x93,
+    0x02,0xB2,0x02,0x73,0x02,0x42,0x93,0x02,0x08,0x73,0x02,0x93,0x02,0x92,0x02,0x93,
+    0x02,0x73,0x02,0x92,0x02,0x71,0x02,0x11,0x02,0x3B,0x86,0x52,0xFF,0xFF,0x81,0x02,
+    0x92,0x02,0x92,0x02,0x74,0x02,0x43,0x93,0x02,0x06,0x73,0x02,0x93,0x02,0x93,0x02,
+    0x92,0x02,0x92,0x02,0xF1,0x01,0xB6,0x1B,0x82,0x00,0xDF,0xFF,0x97,0x00,0xDC,0xBE,
+    0x82,0x04,0x92,0x02,0x93,0x02,0x73,0x02,0x72,0x02,0x92,0x02,0x42,0x73,0x02,0x04,
+    0x93,0x02,0x52,0x02,0x93,0x02,0xF0,0x01,0x57,0x65,0x83,0x05,0x3E,0xCF,0xB1,0x0A,
+    0x71,0x02,0x94,0x02,0x11,0x02,0xFA,0x85,0x9E,0x00,0xB1,0x0A,0x90,0x15,0x33,0x0B,
+    0x52,0x02,0xB1,0x02,0x72,0x02,0x72,0x02,0x51,0x02,0x31,0x02,0x50,0x02,0x51,0x02,
+    0x12,0x02,0xF1,0x01,0xEE,0x01,0x72,0x02,0x33,0x02,0xCF,0x01,0x72,0x0A,0x99,0x6D,
+    0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x82,0x04,0x37,0x55,0x10,0x02,
+    0x92,0x02,0x12,0x02,0x33,0x13,0x91,0x07,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0x16,0x24,
+    0xF2,0x01,0x93,0x02,0x30,0x02,0x37,0x34,0x81,0x00,0xDF,0xFF,0x81,0x11,0x3C,0xA6,
+    0x51,0x02,0xB0,0x02,0x33,0x02,0xD2,0x0A,0xDD,0xEF,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xB5,0x23,0xEF,0x01,0xD3,0x02,0xF1,0x01,0x12,0x0B,0xBE,0xF7,
+    0xFE,0xFF,0x43,0xFF,0xFF,0x00,0xB8,0x7D,0x82,0x00,0x74,0x1B,0x90,0x05,0xDF,0xFF,
+    0x55,0x1B,0x11,0x02,0xB2,0x02,0xF1,0x01,0xB8,0x44,0x43,0xFF,0xFF,0x02,0xDF,0xFF,
+    0xFF,0xFF,0xFF,0xF7,0x4F,0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,0x42,0xFF,0xFF,0x0A,
+    0x38,0x5D,0x71,0x02,0xEF,0x01,0x72,0x02,0x91,0x02,0xB3,0x02,0x93,0x02,0xEF,0x01,
+    0x51,0x02,0x55,0x44,0xBF,0xDF,0x59,0xFF,0xFF,0x7A,0xFF,0xFF,0x0D,0xFE,0xFF,0xFD,
+    0xFF,0xFF,0xFF,0x5E,0xCF,0xF5,0x23,0xF0,0x01,0x10,0x02,0xB3,0x02,0xB2,0x02,0x92,
+    0x02,0xB3,0x02,0x93,0x02,0x92,0x02,0xB1,0x02,0x81,0x03,0xB3,0x02,0xB3,0x02,0x92,
+    0x02,0x93,0x02,0x82,0x43,0xB2,0x02,0x83,0x43,0xB2,0x02,0x7F,0x2A,0x92,0x02,0x99,
+    0xC5,0x04,0x38,0x55,0xF1,0x01,0x91,0x02,0x11,0x02,0x75,0x13,0x84,0x04,0xB3,0x1B,
+    0x11,0x02,0x74,0x02,0x70,0x02,0x1D,0xCF,0x83,0x04,0x96,0x44,0xEF,0x01,0xB2,0x02,
+    0xF1,0x01,0x98,0x44,0x83,0x05,0x1B,0x8E,0x30,0x02,0xB2,0x02,0x11,0x02,0x52,0x0B,
+    0xFF,0xF7,0x83,0x00,0xFE,0xFF,0x81,0x0C,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0x55,0x1B,
+    0x12,0x02,0x92,0x02,0xF0,0x01,0x38,0x5D,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0xFF,0xF7,0x81,0x05,0xDB,0xBE,0x31,0x02,0x92,0x02,0x92,0x02,0xEF,0x01,0x5B,0x96,
+    0x4A,0xFF,0xFF,0x05,0x9C,0xA6,0x30,0x02,0x91,0x02,0x72,0x02,0x52,0x02,0xFD,0xB6,
+    0x45,0xFF,0xFF,0x04,0x17,0x2C,0xF1,0x01,0xB2,0x02,0xD0,0x01,0xD7,0x44,0x46,0xFF,
+    0xFF,0x00,0xDF,0xFF,0x81,0x0F,0x71,0x02,0x93,0x02,0x91,0x02,0x93,0x02,0x11,0x02,
+    0xEF,0x01,0x0F,0x02,0xF0,0x01,0xF0,0x01,0x10,0x02,0xF0,0x01,0xF0,0x01,0xF1,0x01,
+    0x10,0x02,0x6E,0x01,0xB8,0x44,0x81,0x04,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,
+    0xFE,0xFF,0x43,0xFF,0xFF,0x0C,0x9B,0xA6,0xD5,0x23,0xEF,0x01,0xF0,0x01,0x93,0x02,
+    0x92,0x02,0xD2,0x02,0x31,0x02,0xB1,0x01,0x33,0x13,0x1B,0xBF,0xFF,0xFF,0xDF,0xFF,
+    0x83,0x00,0xDF,0xFF,0x81,0x15,0xB6,0x23,0x11,0x02,0xB1,0x02,0xD2,0x02,0x32,0x02,
+    0x11,0x02,0x10,0x02,0x11,0x02,0x10,0x02,0xF1,0x01,0x10,0x02,0xF0,0x01,0xF0,0x01,
+    0x10,0x02,0xF0,0x01,0x11,0x02,0x10,0x02,0xF0,0x01,0xEF,0x01,0xF1,0x01,0x52,0x02,
+    0xD2,0x02,0x81,0x00,0x57,0x34,0x84,0x16,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0x7E,0xCF,0x91,0x02,0x72,0x02,0x93,0x02,0x31,0x02,0xBB,0xB6,0xDF,0xFF,0xFF,0xF7,
+    0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0x79,0x65,0xF1,0x01,0xB1,0x02,
+    0x51,0x02,0xB3,0x02,0x9E,0xE7,0x81,0x01,0xFF,0xF7,0xFE,0xFF,0x84,0x0F,0x57,0x34,
+    0x10,0x02,0xB2,0x02,0x92,0x02,0x92,0x02,0x72,0x02,0x73,0x02,0x92,0x02,0x72,0x02,
+    0x73,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x55,0x1B,0xD7,0x3C,0xFB,0xBE,0x4A,0xFF,
+    0xFF,0x05,0x5C,0x96,0x31,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x11,0x02,0x45,0xF0,
+    0x01,0x04,0x10,0x02,0xF1,0x01,0xEF,0x01,0xAF,0x01,0xDB,0x7D,0x92,0x05,0x95,0x1B,
+    0x0F,0x02,0x92,0x02,0xD2,0x02,0x12,0x02,0xF1,0x01,0x42,0xF0,0x01,0x06,0xF1,0x01,
+    0xF0,0x01,0xF0,0x01,0xF1,0x01,0xF1,0x01,0x8E,0x01,0x34,0x13,0x46,0xFF,0xFF,0x02,
+    0xD4,0x2B,0xF0,0x01,0xB2,0x02,0x8F,0x14,0xFE,0xFF,0xFF,0xFF,0xBC,0xBE,0x72,0x02,
+    0x91,0x02,0xB3,0x02,0xB2,0x02,0xEF,0x01,0x11,0x02,0x11,0x02,0xEF,0x01,0x10,0x02,
+    0xF1,0x01,0x10,0x02,0x30,0x02,0xF0,0x01,0xF2,0x01,0x4D,0x01,0x16,0x5D,0xFF,0xFF,
+    0xFE,0xFF,0x81,0x05,0x3E,0xD7,0xD1,0x0A,0x50,0x02,0x93,0x02,0x31,0x02,0x3A,0x86,
+    0xAF,0x10,0xFF,0xFF,0x34,0x0B,0x51,0x02,0x92,0x02,0x91,0x02,0x73,0x02,0x73,0x02,
+    0x92,0x02,0x73,0x02,0x52,0x02,0x72,0x02,0x95,0x02,0xB2,0x02,0x91,0x02,0xB5,0x23,
+    0x19,0x55,0x3D,0xDF,0x42,0xFF,0xFF,0x0B,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,
+    0xFE,0xFF,0xFF,0xFF,0x17,0x55,0x10,0x02,0xB2,0x02,0x11,0x02,0x73,0x13,0xFE,0xEF,
+    0x90,0x07,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x23,0x10,0x02,0x93,0x02,0x10,0x02,
+    0x56,0x2C,0x44,0xFF,0xFF,0x05,0x5B,0x9E,0x52,0x02,0x72,0x02,0x52,0x02,0xD1,0x0A,
+    0xDE,0xEF,0x44,0xFF,0xFF,0x05,0x5E,0xD7,0x50,0x02,0x52,0x02,0xB3,0x02,0xEF,0x01,
+    0xB6,0x44,0x44,0xFF,0xFF,0x00,0x97,0x7D,0x8A,0x00,0x3D,0xC7,0x81,0x02,0x72,0x02,
+    0xB2,0x02,0x1E,0xD7,0x44,0xFF,0xFF,0x03,0x74,0x13,0x12,0x02,0x92,0x02,0xD0,0x01,
+    0x84,0xD8,0x0A,0x1D,0xDF,0x54,0x3C,0x51,0x02,0xF1,0x01,0x72,0x02,0xB3,0x02,0xD4,
+    0x02,0x51,0x02,0xCF,0x01,0xD1,0x02,0xFA,0x95,0x81,0x00,0xFF,0xF7,0x81,0x02,0xDF,
+    0xFF,0xFE,0xF7,0xFF,0xF7,0x90,0xB9,0x02,0xDF,0xFF,0xFF,0xFF,0xFE,0xF7,0x42,0xFF,
+    0xFF,0x0B,0x79,0x75,0x71,0x0A,0xF0,0x01,0x72,0x02,0x93,0x02,0x93,0x02,0x91,0x02,
+    0x92,0x02,0x94,0x02,0x94,0x02,0x93,0x02,0x72,0x02,0x42,0x92,0x02,0x00,0xB3,0x02,
+    0x7F,0x38,0x92,0x02,0x9F,0x05,0xBC,0xA6,0x11,0x02,0x92,0x02,0x71,0x02,0x92,0x02,
+    0x1D,0xCF,0x82,0x05,0x3D,0xD7,0x90,0x02,0x53,0x02,0x11,0x02,0x94,0x13,0xFF,0xF7,
+    0x83,0x04,0x3B,0x96,0x11,0x02,0x92,0x02,0x11,0x02,0x54,0x1B,0x82,0x05,0xFE,0xFF,
+    0xB7,0x4C,0xF0,0x01,0xB2,0x02,0xF1,0x01,0x76,0x34,0x46,0xFF,0xFF,0x0A,0xFE,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFE,0xAE,0x71,0x02,0x70,0x02,0x74,0x02,0x53,0x02,0x3D,0xCF,
+    0xFF,0xFF,0xDF,0xFF,0x42,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x73,0x1B,
+    0x11,0x02,0x93,0x02,0xF0,0x01,0x35,0x34,0x4B,0xFF,0xFF,0x07,0x34,0x0B,0x31,0x02,
+    0x72,0x02,0xEF,0x01,0xD7,0x4C,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0x81,0x05,0x9D,0xDF,
+    0x71,0x02,0x72,0x02,0x93,0x02,0x32,0x02,0x9C,0xB6,0x48,0xFF,0xFF,0x10,0x3C,0xD7,
+    0x70,0x0A,0x92,0x02,0x72,0x02,0x92,0x02,0x77,0x34,0xF9,0x54,0x19,0x4D,0xD9,0x4C,
+    0xF9,0x54,0xF8,0x4C,0xF8,0x4C,0xF9,0x54,0xF8,0x4C,0xF8,0x54,0x76,0x3C,0x5A,0x9E,
+    0x42,0xFF,0xFF,0x00,0xFF,0xF7,0x81,0x01,0xFF,0xFF,0xDF,0xFF,0x81,0x10,0xDF,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xF9,0x95,0x73,0x1B,0x0F,0x02,0xF1,0x01,0x93,0x02,0xB3,0x02,
+    0x72,0x02,0xF0,0x01,0x71,0x02,0x1C,0x96,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xF7,
+    0x43,0xFF,0xFF,0x81,0x16,0x93,0x02,0x32,0x02,0x74,0x23,0xF8,0x54,0x18,0x4D,0x19,
+    0x4D,0xD9,0x4C,0xD9,0x4C,0xD9,0x54,0xF9,0x54,0xF8,0x4C,0xF9,0x4C,0xF9,0x4C,0xF8,
+    0x4C,0xF9,0x4C,0xDA,0x4C,0xF9,0x4C,0xF8,0x54,0xB5,0x1B,0x52,0x02,0x94,0x02,0xEF,
+    0x01,0x76,0x3C,0x83,0x02,0xFF,0xF7,0xFF,0xFF,0xDE,0xFF,0x81,0x05,0x38,0x6D,0xF0,
+    0x01,0xB2,0x02,0x12,0x02,0x54,0x13,0xFF,0xF7,0x43,0xFF,0xFF,0x00,0xFF,0xF7,0x81,
+    0x0A,0x5E,0xDF,0x94,0x02,0x73,0x02,0xB2,0x02,0xF1,0x01,0xBB,0x75,0xFF,0xFF,0xFE,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x83,0x0F,0x36,0x2C,0x11,0x02,0x92,0x02,0xB3,
+    0x02,0x52,0x02,0xD1,0x01,0xEF,0x01,0xF0,0x01,0x11,0x02,0x32,0x02,0x73,0x02,0xD2,
+    0x02,0x51,0x02,0x17,0x3C,0xFF,0xFF,0xDF,0xFF,0x81,0x00,0xFE,0xFF,0x88,0x07,0x50,
+    0x02,0x72,0x02,0x73,0x02,0xF2,0x02,0xD7,0x54,0xF8,0x54,0xF9,0x54,0x18,0x4D,0x42,
+    0xF8,0x4C,0x04,0xD9,0x4C,0xD9,0x44,0xD8,0x44,0x97,0x3C,0xFE,0xB6,0x92,0x0F,0xB4,
+    0x1B,0x11,0x02,0x94,0x02,0x71,0x02,0xF5,0x2B,0xF8,0x54,0xF8,0x4C,0xD9,0x4C,0xF8,
+    0x54,0xF8,0x4C,0xF8,0x4C,0xF8,0x54,0xF9,0x4C,0xFA,0x44,0xB7,0x3C,0x7A,0x75,0x81,
+    0x00,0xFE,0xFF,0x83,0x00,0xD3,0x2B,0x82,0x00,0x18,0x5D,0x8F,0x1A,0xDD,0xBE,0x92,
+    0x02,0x72,0x02,0x72,0x02,0x94,0x02,0x97,0x44,0xF9,0x4C,0xF9,0x44,0x18,0x4D,0xF8,
+    0x4C,0xF8,0x4C,0xF8,0x44,0x19,0x45,0xF8,0x4C,0xD9,0x4C,0x75,0x3C,0x7C,0xB6,0xFF,
+    0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0x3E,0xCF,0xD3,0x0A,0x72,0x02,0x72,0x02,0x32,
+    0x02,0xDA,0x7D,0x83,0x00,0xDF,0xFF,0xAB,0x0D,0x34,0x13,0x51,0x02,0x91,0x02,0xB3,
+    0x02,0x12,0x02,0xCF,0x01,0x11,0x02,0xF2,0x01,0xEF,0x01,0x91,0x02,0xB2,0x02,0x73,
+    0x02,0x32,0x02,0x18,0x55,0x43,0xFF,0xFF,0x00,0xDE,0xFF,0x45,0xFF,0xFF,0x05,0xF7,
+    0x54,0x31,0x02,0x92,0x02,0x11,0x02,0x54,0x0B,0xDE,0xEF,0x53,0xFF,0xFF,0x04,0xD7,
+    0x23,0x10,0x02,0xB2,0x02,0xF0,0x01,0x37,0x34,0x85,0x00,0x51,0x02,0x81,0x00,0xF2,
+    0x0A,0x85,0x0D,0xFF,0xFF,0x39,0x5D,0xF0,0x01,0x92,0x02,0x72,0x02,0x30,0x02,0xBC,
+    0xBE,0xFF,0xFF,0xDE,0xFF,0xFE,0xFF,0xFF,0xFF,0xB8,0x75,0xEF,0x01,0x93,0x02,0x8B,
+    0x02,0x71,0x02,0xB2,0x02,0x3D,0xD7,0x84,0x04,0x75,0x13,0x11,0x02,0xB2,0x02,0xF0,
+    0x01,0x98,0x3C,0x84,0x00,0xDF,0xFF,0x58,0xFF,0xFF,0x0F,0xDC,0xC6,0x17,0x34,0x6F,
+    0x02,0x10,0x02,0x72,0x02,0x92,0x02,0x75,0x02,0x32,0x02,0xEF,0x01,0x18,0x65,0xFF,
+    0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x51,0xFF,0xFF,0xBB,0x11,
+    0xDF,0xFF,0xFF,0xF7,0xFE,0xF7,0xFE,0xFF,0xFF,0xFF,0x5D,0xD7,0x17,0x34,0x12,0x02,
+    0x11,0x02,0xB2,0x02,0xB2,0x02,0x91,0x02,0x94,0x02,0xB2,0x02,0xB1,0x02,0x93,0x02,
+    0xB2,0x02,0xB1,0x02,0x7F,0x3A,0x92,0x02,0x9C,0x00,0xFE,0xFF,0x81,0x05,0xDE,0xF7,
+    0x14,0x13,0x32,0x02,0xB2,0x02,0xF0,0x01,0xB8,0x7D,0x82,0x06,0xFA,0x75,0x11,0x02,
+    0xB4,0x02,0xEF,0x01,0xF7,0x44,0xFF,0xFF,0xDF,0xFF,0x82,0x05,0xBF,0xE7,0xB3,0x02,
+    0x31,0x02,0x71,0x02,0x71,0x02,0x5E,0xC7,0x42,0xFF,0xFF,0x04,0x75,0x1B,0x10,0x02,
+    0x72,0x02,0x11,0x02,0x3B,0x86,0x83,0x0A,0xFE,0xFF,0xDF,0xFF,0xDF,0xFF,0xFE,0xFF,
+    0xDE,0xFF,0xFF,0xFF,0xB7,0x44,0xEE,0x01,0xD1,0x02,0xF1,0x01,0x37,0x34,0x48,0xFF,
+    0xFF,0x05,0x3A,0x8E,0x10,0x02,0x92,0x02,0x53,0x02,0x72,0x02,0x9D,0xE7,0x88,0x06,
+    0xDF,0xFF,0xFF,0xFF,0xD8,0x54,0xF1,0x01,0xD2,0x02,0x11,0x02,0x53,0x0B,0x44,0xFF,
+    0xFF,0x04,0xB9,0x6D,0xF0,0x01,0x92,0x02,0x30,0x02,0x75,0x13,0x49,0xFF,0xFF,0x05,
+    0x3D,0xD7,0x71,0x0A,0x72,0x02,0x52,0x02,0x71,0x02,0x9E,0xE7,0x4A,0xFF,0xFF,0x02,
+    0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0x81,0xC1,0x00,0xFE,0xFF,0x81,0x10,0xFF,0xF7,0xDE,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x1B,0x86,0x54,0x1B,0xEF,0x01,0x51,0x02,0xB3,
+    0x02,0xD3,0x02,0xF2,0x01,0x11,0x02,0x7A,0x9E,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x81,
+    0x02,0xDF,0xFF,0xFF,0xFF,0xB5,0x23,0x81,0x01,0x11,0x02,0x5A,0x5D,0x4E,0xFF,0xFF,
+    0x04,0x37,0x5D,0xF0,0x01,0x93,0x02,0xEF,0x01,0x57,0x34,0x45,0xFF,0xFF,0x00,0xDF,
+    0xFF,0x81,0x04,0x34,0x13,0xF2,0x01,0x92,0x02,0xF0,0x01,0xDB,0x85,0x48,0xFF,0xFF,
+    0x04,0x96,0x3C,0xF0,0x01,0xD2,0x02,0x30,0x02,0x94,0x23,0x42,0xFF,0xFF,0x00,0xDF,
+    0xFF,0x84,0x12,0x36,0x34,0xF1,0x01,0xB2,0x02,0x52,0x02,0xB5,0x1B,0xF9,0x54,0xF8,
+    0x4C,0xF9,0x4C,0xB8,0x4C,0x12,0x13,0xF0,0x01,0x72,0x02,0xB3,0x02,0xF1,0x01,0x13,
+    0x1B,0x7E,0xE7,0xFF,0xFF,0xFD,0xF7,0xDF,0xFF,0x87,0x04,0x3C,0x96,0x50,0x02,0x92,
+    0x02,0x33,0x02,0x33,0x0B,0x44,0xFF,0xFF,0x00,0xDF,0xFF,0x45,0xFF,0xFF,0x00,0xDF,
+    0xFF,0x91,0x04,0xD5,0x1B,0xF1,0x01,0x74,0x02,0x31,0x02,0x1A,0x8E,0x47,0xFF,0xFF,
+    0x00,0xDF,0xFF,0x48,0xFF,0xFF,0x83,0x00,0x38,0x55,0x91,0x02,0x71,0x02,0x52,0x02,
+    0xD3,0x0A,0x4B,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x05,0x5D,0xD7,0xD4,0x02,
+    0x52,0x02,0x92,0x02,0xF0,0x01,0x7A,0x65,0x5D,0xFF,0xFF,0x92,0x0E,0x14,0x13,0x11,
+    0x02,0x73,0x02,0x93,0x02,0x75,0x24,0x18,0x55,0xD8,0x54,0x38,0x4D,0x77,0x44,0x11,
+    0x0B,0x11,0x02,0x72,0x02,0x72,0x02,0xF1,0x01,0x15,0x24,0x81,0x02,0xDF,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0x84,0x05,0x18,0x6D,0x32,0x02,0x92,0x02,0x71,0x02,0xD3,0x0A,0x7E,
+    0xDF,0x93,0x04,0x55,0x1B,0x51,0x02,0xB1,0x02,0xF1,0x01,0xD9,0x4C,0x88,0x00,0xD1,
+    0x0A,0x86,0x0E,0xFF,0xFF,0x54,0x13,0xF1,0x01,0xD3,0x02,0xF0,0x01,0x52,0x13,0xFF,
+    0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xB8,0x7D,0xEF,0x01,0xB2,0x02,0x12,0x02,0x94,
+    0x1B,0x89,0x00,0x72,0x02,0x86,0x04,0xF6,0x1B,0x31,0x02,0x72,0x02,0x11,0x02,0x16,
+    0x2C,0x5B,0xFF,0xFF,0x0D,0xFE,0xFF,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xBC,
+    0xBE,0xB5,0x33,0x10,0x02,0x11,0x02,0x93,0x02,0xF2,0x02,0x52,0x02,0xEF,0x01,0x58,
+    0x5D,0x82,0x00,0xFF,0xF7,0x52,0xFF,0xFF,0xB9,0x03,0xFD,0xF7,0xFE,0xFF,0xFF,0xFF,
+    0xFF,0xF7,0x44,0xFF,0xFF,0x0E,0x7B,0x96,0x53,0x13,0x0F,0x02,0x31,0x02,0x93,0x02,
+    0xB1,0x02,0xB1,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x93,0x02,
+    0xB2,0x02,0xB2,0x02,0x83,0x43,0xB2,0x02,0x83,0x01,0xB2,0x02,0xB2,0x02,0xBF,0x48,
+    0x0D,0xFF,0xFF,0x97,0x3C,0xF1,0x01,0xB2,0x02,0x11,0x02,0x37,0x34,0xFF,0xFF,0xFE,
+    0xFF,0xFF,0xFF,0x57,0x34,0xF1,0x01,0x93,0x02,0x10,0x02,0x5A,0x96,0x45,0xFF,0xFF,
+    0x04,0xD5,0x23,0xF1,0x01,0x92,0x02,0x11,0x02,0xBA,0x75,0x81,0x05,0x5E,0xDF,0x93,
+    0x02,0x71,0x02,0x52,0x02,0xD3,0x02,0x9E,0xD7,0x82,0x02,0xDF,0xFF,0xFF,0xF7,0xDF,
+    0xFF,0x42,0xFF,0xFF,0x14,0xFF,0xF7,0xD1,0x0A,0x32,0x02,0x93,0x02,0x51,0x02,0xB5,
+    0x1B,0xB8,0x3C,0xB8,0x34,0xB6,0x3C,0x98,0x3C,0x98,0x44,0xB7,0x3C,0xB8,0x3C,0x97,
+    0x3C,0x98,0x44,0x57,0x2C,0x92,0x02,0x93,0x02,0x93,0x02,0xF1,0x01,0x79,0x6D,0x8A,
+    0x05,0xFD,0xBE,0x51,0x02,0x92,0x02,0x92,0x02,0x31,0x02,0xBC,0xB6,0x83,0x08,0x94,
+    0x1B,0x11,0x02,0xB3,0x02,0xD0,0x01,0x38,0x65,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,
+    0xF7,0x83,0x07,0xDF,0xFF,0xFF,0xFF,0x3C,0xD7,0x71,0x02,0x72,0x02,0x92,0x02,0xB2,
+    0x02,0xFC,0xC6,0x4B,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x04,0xDF,0xFF,0xDF,
+    0xFF,0xFE,0xF7,0xFE,0xFF,0xDF,0xFF,0x46,0xFF,0xFF,0x08,0x98,0x75,0x92,0x0A,0x10,
+    0x02,0xB2,0x02,0x93,0x02,0x0F,0x02,0xD2,0x02,0x7E,0xE7,0xFE,0xFF,0x44,0xFF,0xFF,
+    0x04,0xB6,0x1B,0xF1,0x01,0xB2,0x02,0x30,0x02,0xF8,0x44,0x82,0x01,0xDF,0xFF,0xFE,
+    0xFF,0x89,0x04,0xF7,0x4C,0x11,0x02,0x92,0x02,0x0F,0x02,0x56,0x34,0x87,0x17,0x9C,
+    0xAE,0x32,0x02,0x73,0x02,0xB2,0x02,0x91,0x02,0x16,0x2C,0x98,0x3C,0x98,0x3C,0x97,
+    0x3C,0xB6,0x3C,0x99,0x3C,0x77,0x44,0xB6,0x3C,0xB7,0x3C,0xB9,0x34,0xB4,0x1B,0x31,
+    0x02,0xB3,0x02,0x94,0x02,0x30,0x02,0xFC,0xC6,0xFF,0xFF,0xFE,0xF7,0xDF,0xFF,0x44,
+    0xFF,0xFF,0x04,0x56,0x34,0x10,0x02,0x92,0x02,0xD0,0x01,0x99,0x65,0x43,0xFF,0xFF,
+    0x09,0xFE,0xF7,0x39,0x5D,0xEF,0x01,0x51,0x02,0xD3,0x02,0xD0,0x01,0x33,0x13,0xFF,
+    0xFF,0xFE,0xFF,0xFE,0xF7,0x87,0x00,0x3B,0x96,0x81,0x01,0x31,0x02,0x14,0x0B,0x5E,
+    0xFF,0xFF,0x04,0xB6,0x1B,0x10,0x02,0x72,0x02,0x12,0x02,0x99,0x75,0x49,0xFF,0xFF,
+    0x00,0xFE,0xFF,0x9D,0x03,0x72,0x02,0x72,0x02,0xD2,0x0A,0x7F,0xD7,0x83,0x01,0xFE,
+    0xFF,0xFE,0xFF,0x81,0x00,0xDE,0xFF,0x45,0xFF,0xFF,0x02,0xBF,0xFF,0x35,0x0B,0x32,
+    0x02,0x81,0x00,0x98,0x3C,0xB0,0x04,0x33,0x0B,0x11,0x02,0x93,0x02,0x31,0x02,0xDC,
+    0xC6,0x43,0xFF,0xFF,0x09,0x9E,0xDF,0x58,0x34,0xEE,0x01,0x73,0x02,0xD1,0x02,0xCE,
+    0x01,0x77,0x34,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x45,0xFF,0xFF,0x05,0xFB,0x8D,0x12,
+    0x02,0x92,0x02,0x92,0x02,0x51,0x02,0x7C,0xB6,0x92,0x05,0x7D,0xE7,0xD2,0x02,0x72,
+    0x02,0xB2,0x02,0xF1,0x01,0x79,0x6D,0x86,0x02,0x92,0x02,0x52,0x02,0xF2,0x12,0x87,
+    0x09,0xFC,0xCE,0x2F,0x02,0x71,0x02,0xB2,0x02,0xF0,0x01,0x39,0x5D,0xFF,0xFF,0xFF,
+    0xFF,0xDF,0xFF,0xB9,0x7D,0x81,0x01,0x31,0x02,0x74,0x1B,0x8D,0x00,0xFE,0xFF,0x82,
+    0x05,0x76,0x2C,0xF0,0x01,0x93,0x02,0x51,0x02,0x33,0x13,0xFE,0xFF,0x5B,0xFF,0xFF,
+    0x0E,0xDF,0xFF,0xDF,0xFF,0xFF,0xF7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x9B,0x9E,0x33,
+    0x13,0xEF,0x01,0xB1,0x02,0xB3,0x02,0x53,0x02,0xF0,0x01,0x7C,0xA6,0xFF,0xFF,0x82,
+    0x01,0xDE,0xFF,0xFE,0xF7,0x8F,0xB9,0x00,0xFF,0xF7,0x42,0xFF,0xFF,0x00,0xDF,0xFF,
+    0x81,0x0C,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x38,0x65,0xB3,0x0A,0xF1,0x01,
+    0x30,0x02,0x72,0x02,0x73,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x51,0xB2,0x02,0xBF,
+    0x45,0xC3,0x0C,0xFA,0x85,0x11,0x02,0xB3,0x02,0x11,0x02,0x14,0x13,0xDF,0xF7,0xDF,
+    0xFF,0xDF,0xF7,0xF2,0x0A,0x52,0x02,0x31,0x02,0xD2,0x0A,0xBD,0xE7,0x85,0x04,0x39,
+    0x65,0x10,0x02,0xB2,0x02,0x11,0x02,0x35,0x34,0x81,0x04,0xDA,0x85,0x10,0x02,0xB2,
+    0x02,0x31,0x02,0xB4,0x1B,0x42,0xFF,0xFF,0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x12,0xDF,
+    0xFF,0xFE,0xFF,0xFF,0xFF,0xFA,0x8D,0x10,0x02,0x74,0x02,0xB3,0x02,0xB3,0x02,0x71,
+    0x02,0xF1,0x01,0xF1,0x01,0xD0,0x01,0xF1,0x01,0xD0,0x01,0x10,0x02,0xF1,0x01,0xD1,
+    0x01,0xF0,0x01,0x11,0x02,0x81,0x02,0xB1,0x02,0x11,0x02,0x93,0x1B,0x4B,0xFF,0xFF,
+    0x04,0x74,0x1B,0xF1,0x01,0x92,0x02,0xF0,0x01,0x97,0x44,0x82,0x05,0x3E,0xD7,0x91,
+    0x02,0x92,0x02,0x71,0x02,0x72,0x02,0x3D,0xD7,0x49,0xFF,0xFF,0x82,0x02,0x71,0x02,
+    0x92,0x02,0xFC,0xBE,0x84,0x00,0xDF,0xFF,0x81,0x06,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0xDE,0xFF,0xFE,0xFF,0xFE,0xFF,0xDF,0xFF,0x82,0x45,0xFF,0xFF,0x0B,0xFE,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x5E,0xCF,0x13,0x1B,0x11,0x02,0xD2,0x02,0xB1,
+    0x02,0xB0,0x01,0xD7,0x4C,0x45,0xFF,0xFF,0x04,0xD5,0x1B,0x11,0x02,0x92,0x02,0x11,
+    0x02,0x19,0x45,0x83,0x47,0xFF,0xFF,0x00,0xDF,0xFF,0x84,0x01,0xF0,0x01,0x77,0x34,
+    0x87,0x16,0x76,0x34,0xF1,0x01,0xB1,0x02,0x93,0x02,0xB1,0x02,0x30,0x02,0x10,0x02,
+    0xF1,0x01,0xF0,0x01,0xF1,0x01,0xF0,0x01,0xF0,0x01,0x0F,0x02,0xF0,0x01,0xF2,0x01,
+    0x32,0x02,0xD1,0x02,0x92,0x02,0x74,0x02,0x0F,0x02,0xF7,0x4C,0xFF,0xFF,0xFE,0xFF,
+    0x42,0xFF,0xFF,0x00,0xDE,0xFF,0x81,0x05,0x37,0x2C,0xF0,0x01,0xB2,0x02,0xD0,0x01,
+    0xD9,0x4C,0xFF,0xF7,0x81,0x08,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xB9,0x6D,0x0F,0x02,
+    0x72,0x02,0xB4,0x02,0xCF,0x01,0xB6,0x4C,0x49,0xFF,0xFF,0x05,0x3C,0x96,0x31,0x02,
+    0x92,0x02,0x50,0x02,0xF4,0x12,0xDF,0xFF,0x85,0x00,0xDF,0xFF,0x84,0x00,0xFE,0xFF,
+    0x91,0x03,0x0F,0x02,0x71,0x02,0x12,0x02,0xBA,0x6D,0x4D,0xFF,0xFF,0x00,0xDF,0xFF,
+    0x86,0x00,0x18,0x55,0x8F,0x0C,0xDC,0xBE,0x72,0x02,0x71,0x02,0x51,0x02,0xB2,0x0A,
+    0x7F,0xD7,0xDF,0xFF,0xFF,0xF7,0xBF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFD,0xFF,
+    0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x44,0xFF,0xFF,0x04,0xB5,0x1B,0x11,0x02,0x92,0x02,
+    0x32,0x02,0x55,0x1B,0xB0,0x04,0x14,0x0B,0x70,0x02,0x92,0x02,0x51,0x02,0x3A,0x8E,
+    0x81,0x00,0xFE,0xF7,0x42,0xFF,0xFF,0x05,0x97,0x34,0xF0,0x01,0xB3,0x02,0x71,0x02,
+    0xB1,0x01,0x1A,0x86,0x43,0xFF,0xFF,0x01,0xFE,0xFF,0xDF,0xFF,0x81,0x05,0xDD,0xBE,
+    0x52,0x02,0x71,0x02,0xB2,0x02,0xF0,0x01,0x39,0x65,0x92,0x05,0x9C,0x9E,0x51,0x02,
+    0x72,0x02,0x92,0x02,0x11,0x02,0x7B,0xA6,0x88,0x00,0xD1,0x0A,0x86,0x0A,0xDF,0xFF,
+    0xFF,0xFF,0xF6,0x54,0xF1,0x01,0x94,0x02,0x51,0x02,0x72,0x02,0x3E,0xCF,0xFF,0xFF,
+    0xFF,0xFF,0x98,0x7D,0x82,0x00,0x95,0x1B,0x91,0x0B,0x17,0x5D,0xCF,0x01,0xB3,0x02,
+    0x72,0x02,0x91,0x02,0x5D,0xCF,0xFF,0xFF,0xBF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,
+    0xFF,0xF7,0x56,0xFF,0xFF,0x81,0x0A,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xF7,0xF6,0x2B,0xF1,0x01,0xB2,0x02,0x93,0x02,0xF0,0x01,0x75,0x13,0x42,0xFF,0xFF,
+    0x02,0xDF,0xFF,0xDF,0xFF,0xFF,0xF7,0x8F,0x7D,0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,
+    0x45,0xFF,0xFF,0x06,0xBF,0xDF,0xB6,0x54,0x92,0x02,0xEF,0x01,0x50,0x02,0xB2,0x02,
+    0xB3,0x02,0x81,0x42,0x92,0x02,0x83,0x43,0x92,0x02,0x83,0x7F,0x2A,0x92,0x02,0xA0,
+    0x0B,0x9D,0xDF,0x91,0x02,0x72,0x02,0xB2,0x02,0x51,0x02,0xBC,0xA6,0xFF,0xFF,0xBC,
+    0xA6,0x30,0x02,0x93,0x02,0x10,0x02,0xF5,0x2B,0x44,0xFF,0xFF,0x0D,0xFE,0xFF,0xFF,
+    0xFF,0xBD,0xBE,0x51,0x02,0x92,0x02,0x31,0x02,0x13,0x13,0xFF,0xF7,0xFF,0xFF,0x97,
+    0x3C,0xEF,0x01,0xB2,0x02,0xF0,0x01,0x38,0x5D,0x44,0xFF,0xFF,0x00,0xDF,0xFF,0x43,
+    0xFF,0xFF,0x0D,0xF6,0x23,0x10,0x02,0xB2,0x02,0xB1,0x02,0x92,0x02,0x72,0x02,0x52,
+    0x02,0x53,0x02,0x53,0x02,0x72,0x02,0x72,0x02,0x73,0x02,0x72,0x02,0x93,0x02,0x42,
+    0x72,0x02,0x04,0x92,0x02,0x91,0x02,0x73,0x02,0x51,0x02,0xFC,0xBE,0x87,0x00,0xDF,
+    0xFF,0x81,0x04,0x59,0x6D,0xF0,0x01,0x92,0x02,0x12,0x02,0x14,0x0B,0x82,0x04,0x39,
+    0x65,0xF0,0x01,0xB2,0x02,0xEF,0x01,0xD4,0x23,0x4A,0xFF,0xFF,0x05,0x3C,0xCF,0x92,
+    0x02,0x92,0x02,0x72,0x02,0x92,0x02,0xDC,0xBE,0x49,0xFF,0xFF,0x01,0xDF,0xF7,0xDF,
+    0xFF,0x44,0xFF,0xFF,0x00,0xFE,0xFF,0x47,0xFF,0xFF,0x81,0x08,0xDF,0xFF,0xFF,0xFF,
+    0x7E,0xE7,0x91,0x0A,0x53,0x02,0xB3,0x02,0x10,0x02,0xF5,0x0A,0xFF,0xF7,0x84,0x05,
+    0xB5,0x23,0x11,0x02,0xB2,0x02,0xF1,0x01,0xD9,0x4C,0xFF,0xFF,0x42,0xDF,0xFF,0x85,
+    0x02,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0x81,0x03,0xD8,0x4C,0x11,0x02,0x93,0x02,0xEF,
+    0x01,0x86,0x17,0xFF,0xFF,0xDF,0xEF,0xF3,0x0A,0x51,0x02,0xB2,0x02,0x93,0x02,0x73,
+    0x02,0x72,0x02,0x73,0x02,0x72,0x02,0x72,0x02,0x94,0x02,0x72,0x02,0x72,0x02,0x73,
+    0x02,0x72,0x02,0x71,0x02,0x72,0x02,0x72,0x02,0x92,0x02,0xB1,0x02,0x51,0x02,0x13,
+    0x0B,0xFF,0xF7,0x83,0xC2,0x04,0x57,0x34,0x10,0x02,0xB2,0x02,0xF0,0x01,0xD8,0x54,
+    0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x09,0x77,0x34,0xD0,0x01,0x93,0x02,
+    0x72,0x02,0x11,0x02,0xBC,0xB6,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x84,0x05,
+    0x3C,0x8E,0x31,0x02,0x72,0x02,0x51,0x02,0x14,0x0B,0xDF,0xF7,0x81,0x02,0xFE,0xFF,
+    0xFF,0xFF,0xFE,0xFF,0x45,0xFF,0xFF,0x02,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x8F,0x04,
+    0xD4,0x1B,0x10,0x02,0x92,0x02,0x31,0x02,0xBB,0x6D,0x88,0x01,0xFF,0xF7,0xFF,0xF7,
+    0x86,0x00,0xD4,0x2B,0x82,0x00,0x18,0x5D,0x91,0x08,0x72,0x02,0x51,0x02,0xD1,0x0A,
+    0x7F,0xDF,0xFF,0xFF,0xFE,0xFF,0xBF,0xFF,0xDF,0xFF,0xFF,0xFF,0x42,0xDF,0xFF,0x81,
+    0x01,0xFE,0xFF,0xFE,0xFF,0x83,0x05,0xD7,0x4C,0xD0,0x01,0xB2,0x02,0x91,0x02,0x51,
+    0x02,0x3E,0xBF,0xAF,0x04,0x34,0x0B,0x71,0x02,0x71,0x02,0x31,0x02,0x5C,0x86,0x81,
+    0x01,0xDE,0xFF,0xDF,0xFF,0x42,0xFF,0xFF,0x07,0x74,0x13,0x10,0x02,0xD3,0x02,0x10,
+    0x02,0xB1,0x0A,0xBF,0xEF,0xFF,0xFF,0xDF,0xFF,0x44,0xFF,0xFF,0x05,0xBE,0xF7,0xF2,
+    0x12,0x52,0x02,0xB1,0x02,0x10,0x02,0xF6,0x1B,0x92,0x05,0x1A,0x55,0xF0,0x01,0x92,
+    0x02,0x51,0x02,0xD3,0x0A,0xDF,0xF7,0x84,0x00,0x3B,0x9E,0x8A,0x07,0xDE,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0x12,0x13,0xF2,0x01,0xD2,0x02,0xF0,0x01,0x95,0x1B,0x81,0x04,0x99,
+    0x75,0xCF,0x01,0xD3,0x02,0x31,0x02,0x75,0x1B,0x86,0x00,0x3E,0xC7,0x82,0x00,0x92,
+    0x02,0x85,0x07,0x18,0x96,0x11,0x02,0x93,0x02,0x93,0x02,0xF0,0x01,0x9A,0x6D,0xFF,
+    0xFF,0xFF,0xFF,0x81,0x01,0xFF,0xFF,0xDF,0xFF,0x92,0x14,0xFF,0xF7,0xFF,0xFF,0xDE,
+    0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0x74,0x1B,0x30,0x02,0x92,0x02,0x72,0x02,0x72,0x02,0xFB,0xB6,0xDF,
+    0xFF,0xFE,0xFF,0xFF,0xF7,0x51,0xFF,0xFF,0xB8,0x04,0xFE,0xFF,0xFF,0xFF,0xFF,0xF7,
+    0xFF,0xFF,0xFE,0xFF,0x43,0xFF,0xFF,0x02,0xDF,0xFF,0xFE,0xFF,0xFF,0xF7,0x42,0xFF,
+    0xFF,0x04,0x3D,0xD7,0x76,0x44,0x73,0x02,0xD1,0x01,0x51,0x02,0x82,0x02,0x93,0x02,
+    0x92,0x02,0x92,0x02,0x81,0x45,0x92,0x02,0x81,0x42,0x92,0x02,0x42,0x93,0x02,0xBF,
+    0x46,0x0D,0xFF,0xFF,0xB6,0x23,0xF1,0x01,0xB2,0x02,0xF0,0x01,0x3A,0x5D,0xFF,0xFF,
+    0x19,0x55,0xF0,0x01,0x93,0x02,0xF0,0x01,0x59,0x6D,0xFF,0xFF,0xFE,0xFF,0x44,0xFF,
+    0xFF,0x0B,0xDF,0xF7,0x33,0x13,0x31,0x02,0x72,0x02,0x52,0x02,0xDD,0xC6,0xFF,0xFF,
+    0x75,0x13,0x30,0x02,0x72,0x02,0x31,0x02,0x9D,0xAE,0x82,0x00,0xDF,0xFF,0x84,0x16,
+    0x5D,0xCF,0x93,0x02,0x72,0x02,0xB2,0x02,0x72,0x02,0x52,0x02,0x51,0x02,0x71,0x02,
+    0x91,0x02,0x71,0x02,0x50,0x02,0x71,0x02,0x51,0x02,0x71,0x02,0x70,0x02,0x72,0x02,
+    0x51,0x02,0x72,0x02,0x71,0x02,0x93,0x02,0xD1,0x02,0xD1,0x01,0x97,0x44,0x4A,0xFF,
+    0xFF,0x05,0x5C,0xCF,0x91,0x02,0x72,0x02,0x92,0x02,0x30,0x02,0xBB,0x9E,0x81,0x04,
+    0x93,0x1B,0x11,0x02,0x93,0x02,0xF0,0x01,0xDA,0x7D,0x8A,0x01,0x3C,0xD7,0x71,0x02,
+    0x81,0x03,0x72,0x02,0xDC,0xC6,0xFF,0xFF,0xFE,0xFF,0x81,0x00,0xDF,0xFF,0x81,0x04,
+    0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x81,0x00,0xDE,0xFF,0x8A,0xC2,
+    0x09,0xFE,0xFF,0xFF,0xFF,0x59,0x5D,0xF1,0x01,0xB2,0x02,0x72,0x02,0x72,0x02,0xFD,
+    0xBE,0xFF,0xFF,0xFE,0xFF,0x85,0x00,0xF0,0x01,0x81,0x03,0xFF,0xFF,0xFF,0xF7,0xFE,
+    0xFF,0xFE,0xFF,0x82,0x00,0xFE,0xFF,0x45,0xFF,0xFF,0x81,0x02,0xB3,0x02,0xEF,0x01,
+    0x57,0x34,0x86,0x09,0xDA,0x7D,0xF1,0x01,0x92,0x02,0x92,0x02,0x72,0x02,0x91,0x02,
+    0x72,0x02,0x71,0x02,0x70,0x02,0x72,0x02,0x42,0x71,0x02,0x0B,0x52,0x02,0x71,0x02,
+    0x91,0x02,0x91,0x02,0x52,0x02,0x72,0x02,0x93,0x02,0x92,0x02,0x11,0x02,0x3B,0x96,
+    0xFF,0xFF,0xDE,0xFF,0x84,0x11,0x37,0x34,0x11,0x02,0xB2,0x02,0xF1,0x01,0x17,0x4D,
+    0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0xD1,0x0A,0x31,0x02,0xB3,0x02,0xF1,0x01,0x73,0x13,0x48,0xFF,0xFF,0x05,0x5C,0x96,
+    0x31,0x02,0x73,0x02,0x52,0x02,0x33,0x0B,0xDF,0xFF,0x47,0xFF,0xFF,0x01,0xDE,0xFF,
+    0xDF,0xFF,0x53,0xFF,0xFF,0x06,0xB4,0x1B,0x11,0x02,0x92,0x02,0x30,0x02,0x99,0x7D,
+    0xFF,0xFF,0xDF,0xFF,0x86,0x00,0xDE,0xFF,0x47,0xFF,0xFF,0x97,0x06,0x72,0x02,0xB4,
+    0x02,0x7E,0xDF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0x44,0xFF,0xFF,0x01,0xFE,
+    0xFF,0xFE,0xF7,0x44,0xFF,0xFF,0x05,0x7B,0x9E,0x11,0x02,0x93,0x02,0xB2,0x02,0xF0,
+    0x01,0x98,0x44,0x81,0x00,0xFF,0xF7,0xAC,0x04,0x13,0x13,0x12,0x02,0x92,0x02,0x71,
+    0x02,0x5A,0x86,0x43,0xFF,0xFF,0x0B,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0x1D,0xC7,0x31,
+    0x02,0x53,0x02,0xB3,0x02,0x10,0x02,0x77,0x34,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x44,
+    0xFF,0xFF,0x05,0x77,0x34,0xF0,0x01,0xB1,0x02,0x52,0x02,0x51,0x02,0x3C,0xCF,0x90,
+    0x05,0xFE,0xFF,0x13,0x13,0x32,0x02,0x91,0x02,0xF1,0x01,0x37,0x24,0x45,0xFF,0xFF,
+    0x00,0x5B,0x9E,0x8A,0x0E,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xBB,0xAE,0x10,0x02,0x73,
+    0x02,0x92,0x02,0xF1,0x01,0xDB,0x75,0xFF,0xFF,0x78,0x7D,0xF0,0x01,0x93,0x02,0x31,
+    0x02,0x93,0x1B,0x8A,0x01,0xB1,0x02,0x3D,0xCF,0x42,0xFF,0xFF,0x07,0xBF,0xFF,0xFF,
+    0xFF,0xDF,0xEF,0xB3,0x02,0x72,0x02,0x92,0x02,0x31,0x02,0x32,0x1B,0x43,0xFF,0xFF,
+    0x00,0xFE,0xFF,0x56,0xFF,0xFF,0x0F,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,
+    0xF7,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xDC,0xAE,0x32,0x02,0x73,0x02,0xD1,
+    0x02,0xF0,0x01,0x98,0x7D,0xFF,0xFF,0x81,0x00,0xDF,0xFF,0x90,0x7F,0x07,0xFF,0xFF,
+    0x08,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x3D,0xD7,0xB6,0x44,0xB2,0x0A,0xEF,0x01,0x30,
+    0x02,0x93,0x02,0x92,0x00,0x93,0x02,0xBF,0x46,0x0A,0x39,0x65,0xEF,0x01,0xB3,0x02,
+    0xEF,0x01,0xF6,0x2B,0xFF,0xFF,0xB3,0x1B,0x11,0x02,0x71,0x02,0x71,0x02,0x1D,0xBF,
+    0x81,0x00,0xFE,0xFF,0x44,0xFF,0xFF,0x0A,0x76,0x3C,0xF1,0x01,0x92,0x02,0xF1,0x01,
+    0xB8,0x75,0xDF,0xFF,0x72,0x02,0x71,0x02,0x31,0x02,0xF2,0x0A,0xFF,0xF7,0x81,0x1E,
+    0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0xDF,0xF7,0xFF,0xFF,0x18,0x65,
+    0xF0,0x01,0x93,0x02,0x52,0x02,0xD2,0x0A,0x7B,0xAE,0xDB,0xBE,0xBC,0xAE,0xBB,0xB6,
+    0xBB,0xB6,0x9B,0xB6,0x9C,0xB6,0xBB,0xB6,0xBB,0xBE,0xDB,0xB6,0xBB,0xB6,0xBB,0xBE,
+    0xBC,0xCE,0xD5,0x23,0x10,0x02,0x92,0x02,0x31,0x02,0xF4,0x0A,0xDF,0xF7,0x4A,0xFF,
+    0xFF,0x0B,0xB5,0x23,0x12,0x02,0xB2,0x02,0xEE,0x01,0x58,0x3C,0xFF,0xFF,0xFC,0xC6,
+    0x51,0x02,0x73,0x02,0x31,0x02,0xD3,0x02,0xBF,0xE7,0x81,0x02,0xDF,0xFF,0xFF,0xFF,
+    0xFE,0xFF,0x85,0x01,0x3D,0xD7,0x51,0x02,0x81,0x01,0x92,0x02,0xDC,0xBE,0x83,0xC4,
+    0x0D,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0xFF,
+    0xFF,0xDF,0xFF,0xFF,0xF7,0xFF,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xF7,0x83,0x09,0xFF,
+    0xF7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x9B,0x9E,0x52,0x02,0x73,0x02,0x72,0x02,0x91,
+    0x02,0xDC,0xB6,0x44,0xFF,0xFF,0x04,0xD5,0x1B,0x11,0x02,0x93,0x02,0x10,0x02,0xD8,
+    0x4C,0x4E,0xFF,0xFF,0x02,0xD9,0x4C,0xF1,0x01,0x93,0x02,0x84,0x01,0xFE,0xFF,0xDF,
+    0xF7,0x81,0x19,0xD4,0x23,0xF2,0x01,0xB3,0x02,0x10,0x02,0xD5,0x1B,0xBA,0xCE,0xBC,
+    0xC6,0xBB,0xAE,0xBA,0xB6,0xBB,0xB6,0xBB,0xB6,0xBC,0xBE,0x9B,0xBE,0x9C,0xBE,0xDB,
+    0xB6,0xBB,0xAE,0xDB,0xBE,0xBB,0xB6,0x12,0x0B,0x52,0x02,0x92,0x02,0xF0,0x01,0xF4,
+    0x2B,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x83,0x05,0x56,0x34,0x11,0x02,0x92,0x02,0xF1,
+    0x01,0x18,0x4D,0xFE,0xFF,0x46,0xFF,0xFF,0x0A,0x3A,0x8E,0xEF,0x01,0x72,0x02,0xB4,
+    0x02,0xEF,0x01,0x57,0x65,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0x83,
+    0x03,0x11,0x02,0x52,0x02,0x71,0x02,0x32,0x0B,0x47,0xFF,0xFF,0x01,0xDF,0xFF,0xFF,
+    0xF7,0x81,0x00,0xFE,0xFF,0x91,0x04,0x95,0x23,0xF0,0x01,0xD2,0x02,0x10,0x02,0x7A,
+    0x7D,0x48,0xFF,0xFF,0x04,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x87,
+    0x00,0x18,0x55,0x81,0x01,0xFE,0xFF,0xFF,0xF7,0x8F,0x01,0xD3,0x0A,0x3E,0xDF,0x50,
+    0xFF,0xFF,0x05,0x14,0x0B,0x10,0x02,0xB2,0x02,0x72,0x02,0x4F,0x02,0x3D,0xD7,0x81,
+    0x00,0xDF,0xFF,0x88,0x00,0xDF,0xFF,0xA1,0x04,0x14,0x13,0x31,0x02,0x73,0x02,0x50,
+    0x02,0x5C,0x8E,0x47,0xFF,0xFF,0x05,0x18,0x4D,0xCF,0x01,0x93,0x02,0x71,0x02,0x30,
+    0x02,0x7C,0x9E,0x81,0x01,0xFE,0xFF,0xFF,0xF7,0x82,0x05,0x7D,0xA6,0x10,0x02,0x92,
+    0x02,0xB3,0x02,0xF0,0x01,0x34,0x2C,0x81,0x00,0xDF,0xFF,0x8D,0x05,0xF9,0x75,0xF0,
+    0x01,0x93,0x02,0x91,0x02,0x10,0x02,0x3B,0x8E,0x87,0x00,0x72,0x02,0x88,0xC3,0x0A,
+    0x97,0x44,0xD0,0x01,0xB2,0x02,0x12,0x02,0x71,0x02,0xFF,0xF7,0x59,0x9E,0xEF,0x01,
+    0x93,0x02,0x32,0x02,0x95,0x1B,0x83,0x00,0xDF,0xFF,0x81,0x05,0x3D,0xC7,0x91,0x02,
+    0x71,0x02,0x72,0x02,0x91,0x02,0x3E,0xCF,0x82,0x08,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0x55,0x3C,0xEE,0x01,0xB3,0x02,0x73,0x02,0xF0,0x01,0xF9,0x7D,0x84,0x00,0xDF,0xFF,
+    0x8F,0x01,0xFE,0xFF,0xFE,0xFF,0x81,0x00,0xDF,0xFF,0x48,0xFF,0xFF,0x05,0xDE,0xEF,
+    0xF3,0x0A,0x71,0x02,0xB2,0x02,0xD1,0x01,0x1A,0x5D,0x43,0xFF,0xFF,0x00,0xFE,0xFF,
+    0x8F,0x7F,0x09,0xFF,0xFF,0x12,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x5D,0xE7,0x39,0x5D,
+    0x15,0x13,0x10,0x02,0x11,0x02,0x73,0x02,0x92,0x02,0x93,0x02,0x92,0x02,0x93,0x02,
+    0x92,0x02,0xB2,0x02,0xB3,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0x81,0x09,0x93,0x02,
+    0x73,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,
+    0x93,0x02,0x44,0xB2,0x02,0x7F,0x1E,0x92,0x02,0x01,0x72,0x02,0xB2,0x02,0x9C,0x10,
+    0xDC,0xB6,0x32,0x02,0x92,0x02,0x72,0x02,0xF2,0x1A,0xBB,0xBE,0xF1,0x0A,0x73,0x02,
+    0x32,0x02,0x54,0x13,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0xDF,0xFF,0xFF,0xF7,
+    0xFE,0xFF,0x81,0x09,0xFA,0x85,0x10,0x02,0xB2,0x02,0xF0,0x01,0xD7,0x3C,0x59,0x96,
+    0xEF,0x01,0xB2,0x02,0xF0,0x01,0x56,0x2C,0x42,0xFF,0xFF,0x00,0xFE,0xFF,0x42,0xFF,
+    0xFF,0x08,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x53,0x13,0x30,0x02,0x93,0x02,0xEF,0x01,
+    0x77,0x3C,0xDF,0xFF,0x4B,0xFF,0xFF,0x05,0x3B,0x9E,0x10,0x02,0xB3,0x02,0x73,0x02,
+    0x0F,0x02,0x19,0x8E,0x81,0x03,0xDF,0xFF,0xFF,0xF7,0xFF,0xFF,0xDE,0xFF,0x84,0x0C,
+    0xDC,0x75,0xF1,0x01,0x92,0x02,0x50,0x02,0xF3,0x0A,0xFF,0xFF,0x38,0x65,0xEF,0x01,
+    0xD2,0x02,0xF1,0x01,0x37,0x34,0xFF,0xFF,0xFE,0xFF,0x49,0xFF,0xFF,0x01,0x3C,0xD7,
+    0x91,0x02,0x42,0x72,0x02,0x00,0xFB,0xBE,0x88,0x02,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,
+    0x46,0xFF,0xFF,0x04,0xDF,0xFF,0xFE,0xFF,0xFE,0xFF,0xDF,0xFF,0xFE,0xFF,0x82,0x09,
+    0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0x9C,0x9E,0x30,0x02,0x72,0x02,0x93,0x02,
+    0x90,0x02,0xDD,0xBE,0x84,0x01,0xB6,0x23,0x10,0x02,0x81,0x00,0xD8,0x54,0x8E,0x03,
+    0xB9,0x4C,0x11,0x02,0x92,0x02,0xF0,0x01,0x84,0x07,0xFE,0xFF,0xFF,0xFF,0x1C,0xD7,
+    0x70,0x02,0x52,0x02,0xB4,0x02,0x0F,0x02,0x1B,0x86,0x4C,0xFF,0xFF,0x05,0xD7,0x44,
+    0xEF,0x01,0x93,0x02,0x71,0x02,0x91,0x02,0x9E,0xDF,0x45,0xFF,0xFF,0x04,0x37,0x34,
+    0x10,0x02,0xB2,0x02,0xF0,0x01,0x19,0x4D,0x46,0xFF,0xFF,0x0A,0xFE,0xFF,0xFF,0xFF,
+    0xD5,0x23,0xF0,0x01,0x92,0x02,0x32,0x02,0x90,0x02,0x5E,0xDF,0xFF,0xFF,0xFE,0xF7,
+    0xFF,0xFF,0x83,0x04,0x7B,0x8E,0x51,0x02,0x93,0x02,0x32,0x02,0x14,0x0B,0x87,0x03,
+    0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x52,0xFF,0xFF,0x06,0xB5,0x1B,0xF1,0x01,
+    0x92,0x02,0x11,0x02,0x9A,0x75,0xFF,0xFF,0xFE,0xFF,0x85,0x01,0xFE,0xFF,0xFF,0xFF,
+    0x81,0xC5,0x04,0xF4,0x2B,0x10,0x02,0x92,0x02,0x11,0x02,0x38,0x55,0x81,0x02,0xDF,
+    0xFF,0xFF,0xFF,0xFE,0xFF,0x82,0x00,0xDF,0xFF,0x46,0xFF,0xFF,0x82,0x02,0x52,0x02,
+    0xD2,0x0A,0x7E,0xDF,0x83,0x00,0xFE,0xFF,0x8B,0x05,0x38,0x6D,0xEF,0x01,0x93,0x02,
+    0xB1,0x02,0x0F,0x02,0x75,0x1B,0x46,0xFF,0xFF,0x00,0xFE,0xFF,0x82,0x04,0xFE,0xFF,
+    0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xF7,0x8C,0x00,0x90,0x02,0x81,0x00,0x92,0x02,
+    0x8D,0x04,0x33,0x0B,0x32,0x02,0x73,0x02,0x31,0x02,0x5B,0x8E,0x86,0x09,0xFE,0xFF,
+    0xBF,0xF7,0xD3,0x0A,0x50,0x02,0x92,0x02,0xF1,0x01,0x34,0x0B,0xFF,0xFF,0xFF,0xFF,
+    0xFE,0xFF,0x44,0xFF,0xFF,0x08,0x95,0x1B,0xF2,0x01,0xB2,0x02,0x73,0x02,0x10,0x02,
+    0x3A,0x86,0xFF,0xFF,0xFE,0xF7,0xDF,0xF7,0x83,0x0D,0xFE,0xF7,0xFE,0xFF,0xFF,0xFF,
+    0xFE,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xF7,0xFF,0xFF,0x7E,0xE7,0xB1,0x0A,0x71,0x02,
+    0xB3,0x02,0xD2,0x01,0x34,0x13,0x46,0xFF,0xFF,0x05,0x5B,0x9E,0x31,0x02,0x72,0x02,
+    0x51,0x02,0xD1,0x0A,0xDE,0xF7,0x89,0x0A,0xDF,0xF7,0xD3,0x0A,0x11,0x02,0xB4,0x02,
+    0xCF,0x01,0x38,0x4D,0x7A,0x8E,0xEE,0x01,0xB3,0x02,0x31,0x02,0x94,0x1B,0x44,0xFF,
+    0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0x1E,0xBF,0xB1,0x02,0x91,0x02,0x73,0x02,0xB3,0x02,
+    0x3C,0xCF,0x43,0xFF,0xFF,0x08,0xFF,0xF7,0xFF,0xFF,0xDC,0xBE,0x12,0x02,0x52,0x02,
+    0xB1,0x02,0x52,0x02,0x71,0x02,0x5D,0xCF,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x43,0xFF,
+    0xFF,0x00,0xFE,0xFF,0x81,0x00,0xFF,0xF7,0x84,0x06,0xDF,0xFF,0xFF,0xF7,0xDF,0xF7,
+    0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x42,0xFF,0xFF,0x0D,0xDF,0xFF,0xFF,0xFF,
+    0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0x9E,0xF7,0xD3,0x0A,
+    0x31,0x02,0xB3,0x02,0xF0,0x01,0x39,0x6D,0x81,0x00,0xDF,0xFF,0x91,0xBF,0x09,0x17,
+    0xDF,0xFF,0xDF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xBF,0xFF,0xFA,0x85,0xF5,0x23,
+    0x91,0x02,0x10,0x02,0x11,0x02,0x93,0x02,0x93,0x0A,0x93,0x02,0xB2,0x02,0x91,0x02,
+    0x91,0x02,0x93,0x02,0x93,0x02,0xB2,0x02,0xB2,0x02,0xB3,0x02,0xD3,0x02,0xB2,0x02,
+    0x42,0x92,0x02,0x03,0xB2,0x02,0x92,0x02,0x92,0x02,0xB2,0x02,0x42,0x92,0x02,0x44,
+    0xB2,0x02,0x00,0x92,0x02,0x7F,0x18,0xB2,0x02,0x82,0x00,0x92,0x02,0x9C,0x09,0xFF,
+    0xFF,0x34,0x13,0x31,0x02,0x94,0x02,0xD1,0x0A,0xD7,0x44,0x71,0x02,0x93,0x02,0x11,
+    0x02,0x77,0x44,0x82,0x0F,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFF,
+    0xFF,0x7F,0xD7,0x92,0x02,0x72,0x02,0x52,0x02,0xB6,0x1B,0x58,0x2C,0x0F,0x02,0x93,
+    0x02,0x11,0x02,0xFA,0x6D,0x81,0x00,0xDF,0xFF,0x43,0xFF,0xFF,0x81,0x09,0x7C,0xAE,
+    0x31,0x02,0x91,0x02,0x93,0x02,0x30,0x02,0x3C,0x9E,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,
+    0xDF,0xFF,0x88,0x05,0xDF,0xFF,0xF2,0x12,0x71,0x02,0x94,0x02,0xEE,0x01,0xF5,0x23,
+    0x82,0x03,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0x81,0x0C,0xDF,0xFF,0xFE,0xFF,
+    0x7E,0xE7,0xD2,0x0A,0x32,0x02,0x92,0x02,0x2F,0x02,0x7B,0xA6,0xF7,0x2B,0x31,0x02,
+    0x72,0x02,0x31,0x02,0x5C,0x9E,0x4B,0xFF,0xFF,0x06,0x5C,0xCF,0x71,0x02,0x72,0x02,
+    0x52,0x02,0x93,0x02,0xFC,0xC6,0xFF,0xFF,0x43,0xDF,0xFF,0x46,0xFF,0xFF,0x00,0xDF,
+    0xFF,0x82,0x00,0x9D,0xE7,0x82,0x01,0xFF,0xFF,0xFF,0xF7,0x43,0xFF,0xFF,0x0A,0xFE,
+    0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xF7,0xFF,0xFF,0x9A,0x75,0xF0,0x01,0xB4,0x02,0x51,
+    0x02,0xB3,0x02,0x7E,0xDF,0x81,0x00,0xDF,0xFF,0x81,0x04,0xB6,0x1B,0x10,0x02,0xB2,
+    0x02,0x11,0x02,0xF8,0x4C,0x8E,0x04,0xD8,0x4C,0xF1,0x01,0x91,0x02,0xEF,0x01,0x77,
+    0x34,0x43,0xFF,0xFF,0x81,0x05,0x39,0x55,0xEF,0x01,0x92,0x02,0x72,0x02,0xD1,0x0A,
+    0x9D,0xEF,0x8A,0x07,0xDF,0xFF,0xFF,0xFF,0xFD,0xB6,0x30,0x02,0x74,0x02,0xB2,0x02,
+    0xF0,0x01,0x79,0x6D,0x85,0x04,0x36,0x34,0x10,0x02,0x92,0x02,0xD1,0x01,0xF8,0x4C,
+    0x86,0x09,0xDE,0xFF,0xFF,0xFF,0x1D,0xCF,0x51,0x02,0x8F,0x02,0x94,0x02,0xF1,0x01,
+    0xF5,0x23,0xFF,0xFF,0xFE,0xFF,0x44,0xFF,0xFF,0x05,0x5B,0x96,0x31,0x02,0x91,0x02,
+    0x31,0x02,0x14,0x0B,0xFF,0xF7,0x47,0xFF,0xFF,0x00,0xDF,0xFF,0x43,0xFF,0xFF,0x00,
+    0xDE,0xFF,0x8F,0x04,0x95,0x1B,0xF1,0x01,0x72,0x02,0x32,0x02,0xD9,0x75,0x4C,0xFF,
+    0xFF,0x00,0xFF,0xF7,0x83,0x06,0xD4,0x33,0xF1,0x01,0xB3,0x02,0xF1,0x01,0xF8,0x5C,
+    0xFF,0xFF,0xFF,0xF7,0x49,0xFF,0xFF,0x00,0xFF,0xF7,0x82,0x05,0xDD,0xBE,0x91,0x02,
+    0x72,0x02,0x51,0x02,0x92,0x0A,0x9E,0xDF,0x82,0x01,0xDF,0xFF,0xDF,0xFF,0x88,0x09,
+    0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDE,0xF7,0xD2,0x0A,0x11,0x02,0xB2,0x02,0xD3,0x02,
+    0xF1,0x01,0x36,0x3C,0x88,0x00,0xDF,0xFF,0x50,0xFF,0xFF,0x01,0x7E,0xDF,0x91,0x02,
+    0x81,0x01,0x71,0x02,0xBC,0xB6,0x81,0x00,0xDF,0xFF,0x89,0x04,0x34,0x0B,0x52,0x02,
+    0x92,0x02,0x51,0x02,0x5B,0x96,0x48,0xFF,0xFF,0x07,0x3A,0x8E,0xF1,0x01,0x93,0x02,
+    0x93,0x02,0xEF,0x01,0x57,0x55,0xFF,0xFF,0xDF,0xFF,0x84,0x1A,0x9B,0xAE,0xF1,0x01,
+    0x92,0x02,0xB2,0x02,0x32,0x02,0x71,0x02,0xDB,0xBE,0xFF,0xFF,0xFF,0xF7,0xFE,0xFF,
+    0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x74,0x1B,0x0E,0x02,0xD2,0x02,0x52,0x02,0xF1,0x01,
+    0x3A,0x96,0x86,0x05,0x3B,0x9E,0x51,0x02,0x92,0x02,0x52,0x02,0xF1,0x0A,0xDE,0xEF,
+    0x88,0x0B,0xDF,0xFF,0xFF,0xFF,0x5B,0x9E,0xF1,0x01,0x91,0x02,0xB2,0x02,0x92,0x02,
+    0x56,0x24,0xB3,0x02,0x73,0x02,0x32,0x02,0x74,0x1B,0x82,0x00,0xFF,0xF7,0x82,0x05,
+    0xFE,0xC6,0x52,0x0A,0x52,0x02,0x71,0x02,0xB2,0x02,0x1D,0xCF,0x81,0x0B,0xDF,0xFF,
+    0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0x36,0x2C,0xD1,0x01,0xB0,0x02,0x93,0x02,
+    0x12,0x02,0xF3,0x12,0x7E,0xDF,0x81,0x01,0xFE,0xF7,0xDF,0xFF,0x81,0x00,0xDF,0xFF,
+    0x4B,0xFF,0xFF,0x00,0x7D,0xE7,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x46,0xFF,0xFF,0x08,
+    0xFE,0xFF,0xFE,0xF7,0xFF,0xFF,0xFC,0xB6,0x52,0x02,0x53,0x02,0x93,0x02,0x10,0x02,
+    0xF8,0x95,0x54,0xFF,0xFF,0x7F,0x0B,0xFF,0xFF,0x02,0xDF,0xF7,0xFF,0xFF,0xFE,0xFF,
+    0x42,0xFF,0xFF,0x12,0xFC,0xC6,0x18,0x5D,0x33,0x13,0x11,0x02,0x10,0x02,0x30,0x02,
+    0x70,0x02,0x92,0x02,0x93,0x02,0xB2,0x02,0x92,0x02,0x72,0x0A,0x92,0x02,0xB2,0x02,
+    0xB2,0x02,0x93,0x02,0x73,0x02,0x93,0x02,0x93,0x02,0x83,0xC1,0x03,0x92,0x02,0x92,
+    0x02,0xB2,0x02,0x93,0x02,0x7F,0x1D,0x92,0x02,0x9F,0x0D,0x96,0x3C,0xF0,0x01,0x93,
+    0x02,0xD1,0x0A,0x35,0x0B,0x72,0x02,0x92,0x02,0x11,0x02,0x19,0x8E,0xFF,0xFF,0xFE,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x44,0xFF,0xFF,0x0A,0x74,0x2B,0x11,0x02,0xB3,
+    0x02,0xB3,0x0A,0xF4,0x0A,0x91,0x02,0x73,0x02,0x73,0x02,0x5B,0xCF,0xFF,0xFF,0xFF,
+    0xF7,0x43,0xFF,0xFF,0x08,0xDF,0xFF,0xFF,0xF7,0xFF,0xFF,0x57,0x3C,0xF0,0x01,0xB3,
+    0x02,0x31,0x02,0xF3,0x12,0xDF,0xFF,0x42,0xFF,0xFF,0x89,0x06,0xFF,0xFF,0x98,0x54,
+    0xEE,0x01,0xD2,0x02,0x72,0x02,0x93,0x02,0x5E,0xD7,0x4A,0xFF,0xFF,0x09,0x56,0x34,
+    0xF1,0x01,0xB4,0x02,0x30,0x02,0x16,0x24,0x34,0x0B,0x92,0x02,0x11,0x02,0x13,0x13,
+    0xFF,0xF7,0x8A,0x06,0xDF,0xFF,0x3C,0xD7,0x71,0x02,0x92,0x02,0x72,0x02,0x92,0x02,
+    0x1C,0xC7,0x45,0xFF,0xFF,0x00,0xDF,0xFF,0x83,0x02,0xFE,0xFF,0xFF,0xFF,0xFF,0xF7,
+    0x81,0x06,0x38,0x65,0x55,0x23,0x7D,0xDF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,
+    0x82,0x00,0xFF,0xF7,0x42,0xFF,0xFF,0x05,0xDE,0xEF,0xD2,0x0A,0x72,0x02,0xD2,0x02,
+    0xCF,0x01,0x75,0x1B,0x42,0xFF,0xFF,0x00,0xFE,0xFF,0x81,0x03,0xD6,0x1B,0x11,0x02,
+    0x92,0x02,0xF0,0x01,0x91,0x01,0xB2,0x02,0xF0,0x01,0x81,0x00,0xFE,0xFF,0x83,0x04,
+    0x54,0x13,0x32,0x02,0x93,0x02,0xD0,0x01,0x38,0x3C,0x49,0xFF,0xFF,0x00,0xDF,0xFF,
+    0x43,0xFF,0xFF,0x04,0x54,0x1B,0x11,0x02,0xB3,0x02,0x11,0x02,0x75,0x13,0x82,0x00,
+    0xDF,0xFF,0x81,0x00,0x37,0x34,0x81,0x01,0xF1,0x01,0xF8,0x54,0x49,0xFF,0xFF,0x10,
+    0xF8,0x4C,0xEE,0x01,0x93,0x02,0x73,0x02,0xF0,0x01,0x1B,0x8E,0xFF,0xFF,0xFE,0xFF,
+    0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0x3B,0x96,0x51,0x02,0x72,0x02,0x31,0x02,
+    0x35,0x0B,0x46,0xFF,0xFF,0x00,0xDF,0xFF,0x44,0xFF,0xFF,0x00,0xFE,0xFF,0x50,0xFF,
+    0xFF,0x04,0x96,0x1B,0x10,0x02,0x93,0x02,0x31,0x02,0xB9,0x7D,0x50,0xFF,0xFF,0x05,
+    0xFF,0xF7,0xD5,0x2B,0xF0,0x01,0x92,0x02,0x11,0x02,0xF8,0x64,0x4F,0xFF,0xFF,0x00,
+    0xDC,0xBE,0x82,0x01,0xB2,0x0A,0x9F,0xE7,0x48,0xFF,0xFF,0x00,0xDF,0xFF,0x82,0x0C,
+    0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x5C,0xA6,0xF0,0x01,0x73,0x02,
+    0xB2,0x02,0xB1,0x02,0xF0,0x01,0xB4,0x23,0x5D,0xDF,0x86,0x01,0xFF,0xFF,0xFF,0xF7,
+    0x82,0x02,0xDF,0xEF,0x3B,0x8E,0xDF,0xF7,0x86,0x00,0xFE,0xFF,0x81,0x00,0x5D,0xDF,
+    0x82,0x01,0x72,0x02,0xDC,0xB6,0x4C,0xFF,0xFF,0x81,0x02,0x72,0x02,0x52,0x02,0x3B,
+    0x8E,0x49,0xFF,0xFF,0x13,0xB5,0x1B,0xF2,0x01,0xB1,0x02,0x51,0x02,0x30,0x02,0x3D,
+    0xCF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xB6,
+    0x34,0xD0,0x01,0x93,0x02,0x94,0x02,0x31,0x02,0x72,0x02,0x1B,0x96,0x43,0xFF,0xFF,
+    0x02,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x43,0xFF,0xFF,0x06,0x1C,0xCF,0x56,0x13,0xF1,
+    0x01,0x93,0x02,0x72,0x0A,0xD1,0x01,0x75,0x2C,0x47,0xFF,0xFF,0x05,0x5B,0x9E,0x51,
+    0x02,0x71,0x02,0x52,0x02,0xD2,0x0A,0xBE,0xF7,0x49,0xFF,0xFF,0x0A,0xFE,0xFF,0xFF,
+    0xFF,0x75,0x34,0xF0,0x01,0xB3,0x02,0x93,0x02,0x91,0x02,0xB3,0x02,0x93,0x02,0x30,
+    0x02,0x73,0x1B,0x82,0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x02,0x3E,0xC7,0x91,0x02,0x71,
+    0x02,0x81,0x01,0x3E,0xD7,0xFE,0xFF,0x43,0xFF,0xFF,0x81,0x07,0x9D,0xDF,0xB1,0x02,
+    0x12,0x02,0x92,0x02,0xD2,0x02,0xD1,0x01,0xF3,0x0A,0xBA,0xA6,0x47,0xFF,0xFF,0x00,
+    0xDF,0xFF,0x83,0x07,0x3B,0x96,0x5E,0xDF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0x3B,0x8E,
+    0x13,0x1B,0x9C,0x9E,0x45,0xFF,0xFF,0x02,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0x42,0xFF,
+    0xFF,0x05,0xF6,0x23,0x2F,0x02,0xB3,0x02,0x33,0x02,0xD0,0x02,0x7E,0xDF,0x94,0xBF,
+    0x08,0x00,0xFE,0xFF,0x81,0x04,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xF7,
+    0x43,0xFF,0xFF,0x0F,0xBD,0x9E,0x96,0x4C,0x32,0x13,0x51,0x02,0x10,0x02,0xF0,0x01,
+    0x70,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x92,0x02,0x71,0x02,0x92,0x02,
+    0xB2,0x02,0x92,0x02,0x82,0xC1,0x00,0xB2,0x02,0x42,0x93,0x02,0x42,0xB2,0x02,0xBF,
+    0x3B,0x08,0x1A,0x96,0x11,0x02,0x72,0x02,0x92,0x02,0xB3,0x02,0x92,0x02,0x71,0x02,
+    0xB2,0x02,0xBE,0xE7,0x43,0xFF,0xFF,0x85,0x0C,0x17,0x5D,0xF1,0x01,0xB2,0x02,0x91,
+    0x02,0x91,0x02,0xB2,0x02,0x11,0x02,0x74,0x1B,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDE,
+    0xFF,0xDF,0xFF,0x82,0x09,0xFF,0xFF,0xBE,0xEF,0xD3,0x02,0x51,0x02,0x94,0x02,0xEE,
+    0x01,0xD7,0x44,0xFF,0xFF,0xFF,0xF7,0xFE,0xFF,0x4B,0xFF,0xFF,0x05,0xDD,0xBE,0x51,
+    0x02,0x71,0x02,0x94,0x02,0xF0,0x01,0x38,0x5D,0x82,0x00,0xFE,0xFF,0x86,0x08,0x5A,
+    0x96,0x0F,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0x92,0x02,0x92,0x0A,0xF1,0x01,0xD8,
+    0x54,0x4C,0xFF,0xFF,0x00,0x5D,0xD7,0x82,0x01,0x71,0x02,0x1C,0xBF,0x49,0xFF,0xFF,
+    0x03,0xFE,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xF7,0x81,0x05,0x7A,0x6D,0x6E,0x01,0xB0,
+    0x0A,0xB8,0x44,0xBB,0xB6,0xFE,0xFF,0x42,0xFF,0xFF,0x0A,0xFE,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0x9C,0xB6,0x33,0x13,0x32,0x02,0xB2,0x02,0x72,0x02,0xB0,0x01,0x98,
+    0x7D,0x45,0xFF,0xFF,0x04,0xB6,0x23,0x11,0x02,0xB2,0x02,0x11,0x02,0xD8,0x4C,0x8E,
+    0x01,0xB8,0x4C,0xF0,0x01,0x83,0x09,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x7B,
+    0x9E,0x11,0x02,0x94,0x02,0x92,0x02,0xEF,0x01,0x3C,0x8E,0x88,0x03,0xFE,0xFF,0xFF,
+    0xFF,0xDF,0xFF,0xFF,0xF7,0x81,0x08,0xB9,0x6D,0xEE,0x01,0x93,0x02,0x73,0x02,0x32,
+    0x02,0xDC,0xAE,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x82,0x03,0x11,0x02,0x92,0x02,0xF0,
+    0x01,0xF8,0x4C,0x86,0x14,0xFE,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xF7,0xD3,0x0A,0x13,
+    0x02,0xB1,0x02,0x11,0x02,0xF3,0x0A,0xDF,0xEF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,
+    0xFF,0xFF,0xFF,0x3C,0x8E,0x51,0x02,0x93,0x02,0x70,0x02,0xF3,0x12,0xDF,0xFF,0x82,
+    0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x02,0xFF,0xF7,0xFE,0xFF,0xFD,0xFF,0x81,0x01,0xDE,
+    0xFF,0xFF,0xF7,0x8F,0x06,0xB5,0x1B,0x2F,0x02,0xB2,0x02,0xF0,0x01,0x9A,0x75,0xFF,
+    0xFF,0xFE,0xFF,0x87,0x03,0xFE,0xFF,0xFD,0xFF,0xFF,0xFF,0xDF,0xFF,0x43,0xFF,0xFF,
+    0x04,0xD4,0x2B,0x11,0x02,0x92,0x02,0x10,0x02,0x39,0x55,0x81,0x02,0xDE,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0x81,0x00,0xFF,0xF7,0x83,0x00,0xDF,0xFF,0x83,0x06,0x92,0x02,0x72,
+    0x02,0x71,0x02,0xD2,0x0A,0x9F,0xD7,0xFF,0xFF,0xFE,0xFF,0x83,0x00,0xFE,0xFF,0x81,
+    0x00,0xFE,0xFF,0x81,0x03,0xDF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0x42,0xFF,0xFF,
+    0x08,0x38,0x5D,0xF0,0x01,0x71,0x02,0xB2,0x02,0xB2,0x02,0xF0,0x01,0xB1,0x0A,0x59,
+    0x5D,0x1C,0xDF,0x47,0xFF,0xFF,0x04,0xBB,0xCE,0x3A,0x55,0x90,0x0A,0x31,0x0B,0xFF,
+    0xF7,0x86,0x00,0xDE,0xFF,0x81,0x01,0x7C,0xDF,0xB0,0x0A,0x81,0x01,0x71,0x02,0xBC,
+    0xB6,0x8F,0x01,0x32,0x02,0x5C,0x8E,0x84,0x00,0xDF,0xFF,0x81,0x17,0xFF,0xF7,0xFF,
+    0xFF,0xFC,0xCE,0x32,0x02,0x72,0x02,0xB2,0x02,0xF1,0x01,0xB3,0x1B,0xFF,0xFF,0xFE,
+    0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xBF,0xFF,0xDF,0xFF,0xFE,0xF7,0x73,0x1B,0xD0,
+    0x01,0xD3,0x02,0xB4,0x02,0x32,0x02,0x30,0x02,0x57,0x34,0xDB,0xB6,0x46,0xFF,0xFF,
+    0x0A,0xFC,0xD6,0x38,0x55,0x71,0x02,0xF1,0x01,0x93,0x02,0x93,0x02,0xD0,0x01,0x72,
+    0x13,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0x83,0x07,0xFE,0xFF,0xFF,0xFF,0x3B,0x9E,0x32,
+    0x02,0x92,0x02,0x51,0x02,0xF1,0x0A,0xDE,0xEF,0x4B,0xFF,0xFF,0x08,0xBE,0xEF,0xB1,
+    0x0A,0x32,0x02,0x93,0x02,0x72,0x02,0xB2,0x02,0xB2,0x02,0x11,0x02,0x93,0x1B,0x86,
+    0x05,0x9E,0xDF,0x92,0x02,0x93,0x02,0x52,0x02,0x94,0x02,0xBF,0xE7,0x42,0xFF,0xFF,
+    0x00,0xDF,0xFF,0x43,0xFF,0xFF,0x08,0x9A,0xA6,0x11,0x02,0x31,0x02,0xB1,0x02,0x94,
+    0x02,0x31,0x02,0x30,0x02,0x57,0x3C,0xBB,0xBE,0x47,0xFF,0xFF,0x0D,0x3B,0xDF,0xDA,
+    0x75,0x56,0x1B,0x10,0x02,0x1D,0xD7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0x9D,0x9E,0xD0,
+    0x01,0x11,0x02,0x15,0x2C,0x5A,0x96,0x9D,0xF7,0x46,0xFF,0xFF,0x06,0x3D,0xDF,0x17,
+    0x34,0xF0,0x01,0xB1,0x02,0xB2,0x02,0xCF,0x01,0x76,0x2C,0x42,0xFF,0xFF,0x00,0xFE,
+    0xFF,0x91,0x7F,0x0A,0xFF,0xFF,0x07,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x43,0xFF,0xFF,0x0A,0xFF,0xF7,0xBD,0xA6,0xD6,
+    0x54,0x94,0x23,0x93,0x02,0x11,0x02,0x0F,0x02,0x0F,0x02,0x72,0x02,0x93,0x02,0x73,
+    0x02,0x81,0x00,0xB2,0x02,0x42,0x92,0x02,0x00,0xB2,0x02,0x45,0x92,0x02,0x01,0xB2,
+    0x02,0x92,0x02,0x47,0xB2,0x02,0xBF,0x10,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0x9F,
+    0x07,0xBF,0xE7,0x93,0x0A,0x70,0x02,0x93,0x02,0x93,0x02,0xB1,0x02,0xF0,0x01,0xB5,
+    0x23,0x44,0xFF,0xFF,0x00,0xDE,0xFF,0x81,0x00,0xFE,0xFF,0x81,0x09,0xBC,0xAE,0x31,
+    0x02,0x93,0x02,0x92,0x02,0xB2,0x02,0x93,0x02,0xD0,0x01,0xF7,0x4C,0xFF,0xFF,0xFF,
+    0xF7,0x43,0xFF,0xFF,0x0C,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x75,0xEF,0x01,0x92,
+    0x02,0x73,0x02,0x4F,0x02,0xBB,0xAE,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0x4B,
+    0xFF,0xFF,0x04,0x75,0x1B,0x12,0x02,0x91,0x02,0x10,0x02,0x73,0x13,0x81,0x00,0xFF,
+    0xF7,0x84,0x0B,0xFF,0xF7,0xFE,0xFF,0xFF,0xFF,0xDE,0xFF,0xF2,0x12,0x32,0x02,0x93,
+    0x02,0x92,0x02,0x72,0x02,0x71,0x02,0x50,0x02,0x1D,0xBF,0x8C,0x09,0x3C,0xD7,0x71,
+    0x02,0x72,0x02,0xB2,0x02,0xB2,0x02,0x34,0x13,0x73,0x23,0x53,0x1B,0x54,0x13,0x74,
+    0x1B,0x43,0x74,0x13,0x04,0x74,0x1B,0x75,0x13,0x73,0x13,0x33,0x13,0xDD,0xCE,0x42,
+    0xFF,0xFF,0x14,0xBA,0x6D,0xF2,0x01,0x53,0x02,0xF0,0x01,0x30,0x02,0x55,0x1B,0x78,
+    0x34,0x79,0x65,0xD8,0x8D,0xD9,0x95,0xB9,0x7D,0x19,0x4D,0xD7,0x23,0x51,0x02,0xF2,
+    0x01,0xB3,0x02,0xB1,0x02,0xCF,0x01,0x96,0x1B,0xFF,0xFF,0xFE,0xFF,0x84,0x00,0xD6,
+    0x1B,0x81,0x01,0xF1,0x01,0xD8,0x54,0x8E,0x00,0xD8,0x4C,0x85,0xC2,0x05,0x56,0x34,
+    0xD0,0x01,0xB2,0x02,0x52,0x02,0x11,0x0B,0xDE,0xF7,0x4B,0xFF,0xFF,0x00,0xDF,0xFF,
+    0x81,0x05,0x9F,0xD7,0xB0,0x02,0x52,0x02,0x93,0x02,0xCF,0x01,0xB7,0x3C,0x44,0xFF,
+    0xFF,0x04,0x37,0x34,0xF1,0x01,0xB2,0x02,0xD0,0x01,0xF8,0x54,0x89,0x06,0xFF,0xFF,
+    0x1B,0x86,0xF0,0x01,0x91,0x02,0x92,0x02,0xF0,0x01,0xB7,0x44,0x42,0xFF,0xFF,0x13,
+    0xDF,0xFF,0xFF,0xFF,0x3D,0x96,0x30,0x02,0x53,0x02,0x93,0x02,0xD2,0x02,0x52,0x1B,
+    0x74,0x13,0x74,0x13,0x74,0x1B,0x75,0x13,0x74,0x1B,0x74,0x13,0x74,0x13,0x55,0x1B,
+    0x75,0x13,0x73,0x1B,0xF4,0x12,0x37,0x34,0x51,0xFF,0xFF,0x00,0x95,0x23,0x81,0x02,
+    0x92,0x02,0x12,0x13,0x94,0x1B,0x43,0x74,0x13,0x07,0x54,0x13,0x54,0x1B,0x74,0x1B,
+    0x75,0x1B,0x55,0x13,0x74,0x13,0xD3,0x12,0xDA,0x7D,0x44,0xFF,0xFF,0x0A,0xD4,0x2B,
+    0xF0,0x01,0x93,0x0A,0x92,0x02,0x13,0x0B,0x74,0x1B,0x92,0x13,0xB3,0x13,0x74,0x13,
+    0x94,0x13,0x75,0x13,0x42,0x74,0x13,0x03,0x74,0x1B,0x75,0x0B,0x33,0x13,0xFD,0xB6,
+    0x82,0x12,0xBC,0xBE,0x72,0x02,0x72,0x02,0x92,0x02,0xB4,0x02,0x54,0x13,0x74,0x13,
+    0x73,0x13,0x74,0x13,0x56,0x13,0x75,0x13,0x74,0x1B,0x74,0x13,0x74,0x13,0x73,0x13,
+    0x74,0x13,0x35,0x13,0x73,0x1B,0x5D,0xD7,0x83,0x16,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,
+    0xF7,0x4C,0xB0,0x01,0x52,0x02,0xB2,0x02,0xB2,0x02,0x53,0x02,0xF0,0x01,0x92,0x0A,
+    0x16,0x24,0xF8,0x4C,0xB9,0x6D,0xD9,0x6D,0xB9,0x6D,0x1A,0x5D,0x78,0x34,0x54,0x1B,
+    0x31,0x0A,0xF1,0x01,0xCF,0x01,0xB6,0x13,0x4A,0xFF,0xFF,0x01,0x7D,0xE7,0xB1,0x02,
+    0x42,0x72,0x02,0x01,0xBC,0xBE,0xDF,0xFF,0x8B,0x04,0x33,0x13,0x32,0x02,0x72,0x02,
+    0x51,0x02,0x5B,0x96,0x46,0xFF,0xFF,0x0A,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,
+    0xD7,0x4C,0xCF,0x01,0xB2,0x02,0x73,0x02,0xF1,0x01,0xFB,0x7D,0xFF,0xFF,0x81,0x1D,
+    0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xBF,0xEF,0x32,0x1B,0xCE,0x01,0x72,0x02,
+    0xB2,0x02,0x71,0x02,0x10,0x02,0x91,0x02,0xB5,0x1B,0xFA,0x44,0xB9,0x6D,0xBA,0x6D,
+    0xB9,0x6D,0xF9,0x44,0xD5,0x23,0x90,0x0A,0xF0,0x01,0x52,0x02,0xD1,0x02,0x70,0x02,
+    0xAF,0x01,0x73,0x13,0xBE,0xEF,0xFF,0xFF,0xFF,0xFF,0xFF,0xF7,0x44,0xFF,0xFF,0x06,
+    0xDF,0xFF,0x5B,0x9E,0x51,0x02,0x71,0x02,0x52,0x02,0xF2,0x0A,0xDF,0xEF,0x87,0x0C,
+    0xDF,0xFF,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xFA,0x85,0xD0,0x01,0x93,0x02,
+    0x93,0x02,0x92,0x0A,0xB3,0x02,0x31,0x02,0x94,0x1B,0x83,0x0E,0xDE,0xC6,0x94,0x1B,
+    0xB5,0x1B,0xB4,0x1B,0x91,0x02,0x92,0x02,0x72,0x02,0xB1,0x02,0x95,0x1B,0xD5,0x1B,
+    0x97,0x1B,0x1D,0xBF,0xFE,0xFF,0xDF,0xFF,0xFF,0xF7,0x42,0xFF,0xFF,0x2B,0x19,0x86,
+    0x11,0x02,0xD1,0x01,0xB3,0x02,0x92,0x02,0x75,0x02,0x10,0x02,0x4E,0x02,0x96,0x1B,
+    0x98,0x3C,0x99,0x65,0x99,0x75,0xB8,0x75,0x79,0x65,0x99,0x3C,0xD6,0x23,0xD1,0x0A,
+    0x0E,0x02,0xD0,0x01,0x95,0x02,0x7E,0xE7,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0x9C,0xA6,
+    0x92,0x02,0x53,0x02,0xF0,0x01,0x2F,0x02,0x12,0x13,0xF8,0x2B,0x59,0x5D,0xD8,0x85,
+    0xD8,0x95,0xF8,0x85,0x3A,0x5D,0x37,0x2C,0xD0,0x0A,0xEF,0x01,0x93,0x02,0xB5,0x02,
+    0xF0,0x01,0x72,0x02,0x7E,0xDF,0x81,0x00,0xDF,0xFF,0x52,0xFF,0xFF,0x7F,0x1A,0xFF,
+    0xFF,0x15,0x5E,0xCF,0xD9,0x85,0x95,0x44,0x74,0x1B,0xD3,0x02,0x51,0x02,0xD0,0x01,
+    0xF0,0x01,0x31,0x02,0x51,0x02,0x72,0x02,0xB3,0x02,0x93,0x02,0x93,0x02,0x92,0x02,
+    0x93,0x02,0xB2,0x02,0xB2,0x02,0x92,0x02,0xB2,0x02,0xB2,0x02,0x93,0x02,0x47,0x92,
+    0x02,0x7F,0x10,0xB2,0x02,0x00,0x93,0x02,0xA1,0x07,0xFF,0xFF,0xD5,0x2B,0xEF,0x01,
+    0x93,0x02,0xB3,0x02,0x92,0x02,0xD1,0x01,0x38,0x65,0x81,0x01,0xBF,0xFF,0xDE,0xFF,
+    0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x07,0xDF,0xEF,0xF2,0x0A,0x12,0x02,
+    0x93,0x02,0x92,0x02,0x73,0x02,0x30,0x02,0x7B,0x96,0x42,0xFF,0xFF,0x01,0xDF,0xFF,
+    0xFE,0xF7,0x83,0x05,0x95,0x23,0x0F,0x02,0xB2,0x02,0x11,0x02,0x75,0x13,0xDF,0xFF,
+    0x81,0x00,0xFF,0xF7,0x4C,0xFF,0xFF,0x0A,0x5A,0x6D,0xF0,0x01,0x92,0x02,0x92,0x02,
+    0x10,0x02,0xBC,0xAE,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xDE,0xFF,0x81,0x0E,
+    0xFE,0xFF,0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xB8,0x44,0xEF,0x01,0xB2,0x02,0x92,0x02,
+    0x92,0x02,0x11,0x02,0xB4,0x1B,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFE,0xFF,0x89,0x12,
+    0x3C,0xCF,0x71,0x02,0x92,0x02,0x72,0x0A,0xB3,0x02,0x53,0x02,0x10,0x02,0x31,0x02,
+    0x32,0x02,0x31,0x02,0x31,0x02,0x11,0x02,0x32,0x02,0x11,0x02,0x31,0x02,0x14,0x02,
+    0x11,0x02,0x10,0x02,0x9C,0xAE,0x82,0x14,0x38,0x65,0xAF,0x01,0xD3,0x02,0xB2,0x02,
+    0x92,0x02,0x30,0x02,0x11,0x02,0xF0,0x01,0x0F,0x02,0x0F,0x02,0xEF,0x01,0xF0,0x01,
+    0x11,0x02,0xB2,0x02,0xB3,0x02,0x72,0x02,0xD0,0x01,0x34,0x13,0x7E,0xE7,0xFF,0xFF,
+    0xFF,0xF7,0x84,0x04,0xB6,0x1B,0x10,0x02,0x93,0x02,0x11,0x02,0xD8,0x4C,0x8E,0x03,
+    0xD9,0x4C,0x11,0x02,0xB1,0x02,0x10,0x02,0x84,0x05,0x9D,0xE7,0xB2,0x0A,0x71,0x02,
+    0xB2,0x02,0xF2,0x01,0x98,0x3C,0x4A,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,0xF7,0x43,0xFF,
+    0xFF,0x05,0x16,0x2C,0xF1,0x01,0xB3,0x02,0x31,0x02,0xD2,0x0A,0xBF,0xF7,0x82,0x05,
+    0xFE,0xFF,0x37,0x2C,0xF1,0x01,0x92,0x02,0xF0,0x01,0x18,0x4D,0x48,0xFF,0xFF,0x08,
+    0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xB3,0x1B,0xF1,0x01,0xB3,0x02,0x71,0x02,0x2F,0x02,
+    0xBD,0xBE,0x43,0xFF,0xFF,0x05,0x3D,0x96,0x50,0x02,0x92,0x02,0x73,0x02,0x93,0x02,
+    0x32,0x02,0x42,0x31,0x02,0x00,0x32,0x02,0x42,0x31,0x02,0x04,0x11,0x02,0x32,0x02,
+    0x11,0x02,0xAF,0x01,0xF3,0x0A,0x91,0x07,0xB4,0x1B,0x10,0x02,0x93,0x02,0x92,0x02,
+    0x72,0x02,0x32,0x02,0x32,0x02,0x10,0x02,0x42,0x31,0x02,0x06,0x11,0x02,0x30,0x02,
+    0x31,0x02,0x32,0x02,0x30,0x02,0x90,0x01,0x39,0x55,0x85,0x10,0x11,0x02,0x92,0x02,
+    0x92,0x0A,0x52,0x02,0x12,0x02,0x31,0x02,0x12,0x02,0x12,0x02,0x31,0x02,0x31,0x02,
+    0x11,0x02,0x32,0x02,0x11,0x02,0x12,0x02,0x11,0x02,0xEF,0x01,0x9D,0x9E,0x82,0x01,
+    0xBD,0xBE,0x92,0x02,0x81,0x06,0x93,0x02,0x31,0x02,0x32,0x02,0x31,0x02,0x31,0x02,
+    0x11,0x02,0x50,0x02,0x42,0x31,0x02,0x06,0x11,0x02,0x32,0x02,0x11,0x02,0x30,0x02,
+    0x1C,0xBF,0xFF,0xFF,0xFE,0xFF,0x43,0xFF,0xFF,0x14,0xDF,0xFF,0xFF,0xFF,0x59,0x6D,
+    0x30,0x02,0xF0,0x01,0x74,0x02,0xB4,0x02,0xB2,0x02,0x72,0x02,0xF1,0x01,0xF0,0x01,
+    0xEF,0x01,0xEF,0x01,0x0F,0x02,0x0F,0x02,0x10,0x02,0x11,0x02,0x92,0x02,0xD3,0x02,
+    0xEF,0x01,0x14,0x13,0x8A,0x05,0x5D,0xDF,0x91,0x0A,0x72,0x02,0x71,0x02,0x71,0x02,
+    0xBB,0xB6,0x4C,0xFF,0xFF,0x04,0x34,0x13,0x31,0x02,0x92,0x02,0x51,0x02,0x3C,0x8E,
+    0x47,0xFF,0xFF,0x29,0xDF,0xFF,0xFF,0xF7,0xFF,0xFF,0xDE,0xEF,0xD1,0x0A,0x11,0x02,
+    0x93,0x02,0x32,0x02,0xB2,0x02,0xBE,0xE7,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFF,0xFF,
+    0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xF4,0x2B,0x0E,0x02,0x11,0x02,0x94,0x02,
+    0x92,0x02,0x72,0x02,0x11,0x02,0x0E,0x02,0x10,0x02,0x10,0x02,0x0F,0x02,0x10,0x02,
+    0x11,0x02,0x53,0x02,0xB3,0x02,0x93,0x02,0x11,0x02,0xCF,0x01,0xF5,0x2B,0xFF,0xEF,
+    0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0x81,0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x05,
+    0x3B,0x9E,0x51,0x02,0x73,0x02,0x52,0x02,0xD1,0x0A,0xDE,0xEF,0x49,0xFF,0xFF,0x0A,
+    0xFF,0xF7,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xD5,0x2B,0xF0,0x01,0xB4,0x02,0x91,0x02,
+    0x92,0x02,0x32,0x02,0x75,0x1B,0x43,0xFF,0xFF,0x1E,0x7C,0xA6,0xEF,0x01,0xF0,0x01,
+    0x11,0x02,0x92,0x02,0x93,0x02,0x93,0x02,0xD1,0x02,0x31,0x02,0xF0,0x01,0xD2,0x01,
+    0xDD,0x9E,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,
+    0x9B,0xA6,0xD3,0x0A,0xCF,0x01,0x71,0x02,0xB4,0x02,0x92,0x02,0x73,0x02,0x31,0x02,
+    0x10,0x02,0xF0,0x01,0xF0,0x01,0xEF,0x01,0x42,0x10,0x02,0x1C,0x53,0x02,0xB3,0x02,
+    0x50,0x02,0x31,0x02,0x5E,0xD7,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0x5B,0x9E,0xF0,0x01,
+    0x93,0x02,0xB2,0x02,0x93,0x02,0x33,0x02,0x11,0x02,0x10,0x02,0x0E,0x02,0xEE,0x01,
+    0xEF,0x01,0x10,0x02,0x10,0x02,0x72,0x02,0x94,0x0A,0x92,0x02,0xCE,0x01,0x91,0x02,
+    0xBD,0xB6,0xFE,0xFF,0xFE,0xFF,0x94,0x7F,0x1E,0xFF,0xFF,0x10,0x5D,0xD7,0xF9,0x9D,
+    0x37,0x55,0x56,0x34,0x74,0x1B,0xD2,0x0A,0x50,0x02,0x0F,0x02,0xEF,0x01,0x10,0x02,
+    0x11,0x02,0x11,0x02,0x32,0x02,0x52,0x02,0x72,0x02,0x73,0x02,0x73,0x02,0x7F,0x19,
+    0x93,0x02,0x04,0x94,0x02,0x93,0x02,0x93,0x02,0x72,0x02,0x72,0x02,0x9B,0x00,0xDF,
+    0xFF,0x81,0x06,0x37,0x75,0x8E,0x01,0x12,0x02,0x11,0x02,0xD0,0x01,0xF1,0x01,0xDD,
+    0xB6,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x47,0xFF,0xFF,0x06,0x35,0x2C,0x6F,0x01,0x10,
+    0x02,0x30,0x02,0xB1,0x01,0x92,0x02,0xBD,0xEF,0x44,0xFF,0xFF,0x08,0xDF,0xFF,0xFF,
+    0xFF,0xFF,0xFF,0x7B,0xA6,0xB0,0x01,0x11,0x02,0x11,0x02,0x6E,0x01,0xF8,0x54,0x4E,
+    0xFF,0xFF,0x07,0xDF,0xFF,0xFF,0xFF,0x9E,0xDF,0x50,0x02,0xD1,0x01,0x31,0x02,0x6E,
+    0x01,0xF6,0x1B,0x81,0x01,0xFE,0xFF,0xFE,0xFF,0x42,0xFF,0xFF,0x01,0xFE,0xFF,0xFF,
+    0xFF,0x81,0x06,0xBB,0xB6,0xEE,0x01,0xF2,0x01,0xF1,0x01,0xF0,0x01,0xB0,0x01,0x79,
+    0x6D,0x49,0xFF,0xFF,0x06,0xFE,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0x1D,0xCF,0x0F,
+    0x02,0xF1,0x01,0x44,0x11,0x02,0x00,0x10,0x02,0x43,0x11,0x02,0x04,0xF1,0x01,0x31,
+    0x02,0xF3,0x01,0xF0,0x01,0xEF,0x01,0x82,0x08,0xDF,0xFF,0x7C,0x9E,0x51,0x02,0xCE,
+    0x01,0xF0,0x01,0x52,0x02,0x72,0x02,0x93,0x02,0xB3,0x02,0x42,0x93,0x02,0x08,0xB2,
+    0x02,0x72,0x02,0x10,0x02,0xCF,0x01,0x31,0x02,0x56,0x44,0xFF,0xFF,0xFF,0xFF,0xDF,
+    0xFF,0x45,0xFF,0xFF,0x04,0x54,0x13,0xAE,0x01,0x12,0x02,0x8F,0x01,0xB8,0x34,0x8B,
+    0x00,0xDF,0xFF,0x81,0x04,0x56,0x44,0x70,0x01,0x30,0x02,0x6F,0x01,0x16,0x24,0x81,
+    0x0A,0xDE,0xFF,0xFF,0xFF,0x18,0x4D,0x6E,0x01,0x10,0x02,0xF1,0x01,0x0E,0x02,0x7B,
+    0xA6,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x4D,0xFF,0xFF,0x05,0x1B,0x86,0x8E,0x01,0x10,
+    0x02,0x32,0x02,0x8F,0x01,0x57,0x5D,0x43,0xFF,0xFF,0x04,0xD6,0x23,0x8E,0x01,0x30,
+    0x02,0x4F,0x01,0x97,0x44,0x4A,0xFF,0xFF,0x07,0xFE,0xFF,0x1D,0xC7,0x11,0x02,0xEF,
+    0x01,0x30,0x02,0x90,0x01,0x71,0x0A,0x7E,0xE7,0x82,0x07,0x3C,0x86,0xB0,0x01,0xEF,
+    0x01,0x31,0x02,0x12,0x02,0xF1,0x01,0x11,0x02,0x31,0x02,0x42,0x11,0x02,0x06,0x12,
+    0x02,0x10,0x02,0x30,0x02,0xF2,0x01,0x11,0x02,0x8F,0x01,0x13,0x0B,0x91,0x06,0x53,
+    0x0B,0xAF,0x01,0xF1,0x01,0xF2,0x01,0x11,0x02,0x10,0x02,0x10,0x02,0x44,0x11,0x02,
+    0x05,0x10,0x02,0x11,0x02,0x12,0x02,0x10,0x02,0x70,0x01,0x58,0x55,0x84,0x11,0x71,
+    0x1B,0x70,0x01,0x11,0x02,0x0F,0x02,0x11,0x02,0x31,0x02,0xF1,0x01,0x11,0x02,0x11,
+    0x02,0x10,0x02,0x11,0x02,0x11,0x02,0x31,0x02,0x11,0x02,0xF2,0x01,0x10,0x02,0xEE,
+    0x01,0x5E,0xA6,0x82,0x0A,0xBC,0xAE,0xF0,0x01,0x11,0x02,0x11,0x02,0x10,0x02,0x31,
+    0x02,0x11,0x02,0xF1,0x01,0x11,0x02,0x11,0x02,0x10,0x02,0x44,0x11,0x02,0x06,0xF1,
+    0x01,0x2F,0x02,0x1B,0xBF,0xFF,0xFF,0xDF,0xFF,0xFF,0xF7,0xDF,0xFF,0x42,0xFF,0xFF,
+    0x07,0xFE,0xFF,0xFF,0xFF,0xDC,0xC6,0xD4,0x23,0x50,0x02,0xCF,0x01,0x11,0x02,0x72,
+    0x02,0x45,0x93,0x02,0x05,0x72,0x02,0x31,0x02,0x11,0x02,0xEF,0x01,0xEE,0x01,0xD8,
+    0x44,0x84,0x00,0xFE,0xFF,0x84,0x09,0x7D,0xCF,0x2F,0x02,0xF1,0x01,0xF1,0x01,0xEF,
+    0x01,0x9B,0xB6,0xFF,0xFF,0xDE,0xF7,0xFF,0xFF,0xFF,0xF7,0x88,0x04,0xB4,0x02,0xD0,
+    0x01,0xF0,0x01,0xB0,0x01,0xFB,0x7D,0x87,0x1A,0xFE,0xFF,0xBF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0x38,0x86,0xAE,0x01,0x12,0x02,0x31,0x02,0x4E,0x01,0x74,0x1B,0xDF,0xFF,0xDE,
+    0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFE,0xF7,0xFE,0xFF,0xFF,0xFF,0xD9,
+    0x75,0xF3,0x0A,0xF0,0x01,0xF0,0x01,0x31,0x02,0x93,0x02,0xB3,0x02,0xB3,0x02,0x42,
+    0x93,0x02,0x0A,0x94,0x02,0x51,0x02,0xEF,0x01,0xEF,0x01,0x12,0x13,0xD9,0x7D,0xFF,
+    0xFF,0xFF,0xFF,0xBF,0xFF,0xFF,0xF7,0xFF,0xFF,0x82,0xC1,0x07,0xDE,0xFF,0xFF,0xFF,
+    0xF9,0x95,0xCF,0x01,0xF1,0x01,0xB0,0x01,0x6F,0x02,0xDF,0xEF,0x85,0x00,0xFE,0xFF,
+    0x46,0xFF,0xFF,0x06,0x9D,0xDF,0x51,0x02,0xD2,0x01,0x2F,0x02,0x11,0x02,0x90,0x01,
+    0x14,0x0B,0x83,0x0B,0x7A,0xA6,0xEF,0x01,0xF1,0x01,0x11,0x02,0x2F,0x02,0x30,0x02,
+    0x12,0x02,0x11,0x02,0x10,0x02,0xF1,0x01,0xD0,0x01,0xBC,0xAE,0x47,0xFF,0xFF,0x29,
+    0xDF,0xEF,0x96,0x44,0x91,0x02,0xEF,0x01,0x31,0x02,0x53,0x02,0x92,0x02,0xB3,0x02,
+    0x93,0x02,0x94,0x02,0x93,0x02,0xB4,0x02,0x92,0x02,0x91,0x02,0x30,0x02,0xB1,0x01,
+    0x10,0x02,0xF4,0x23,0xBE,0xF7,0xFF,0xFF,0xFE,0xF7,0xFF,0xFF,0x3E,0xC7,0x12,0x13,
+    0xD0,0x01,0x11,0x02,0x12,0x02,0x73,0x02,0xB3,0x02,0x94,0x02,0x93,0x02,0x94,0x02,
+    0xB3,0x02,0xB3,0x02,0x72,0x02,0x30,0x02,0xF1,0x01,0x11,0x02,0xD3,0x23,0x3C,0xD7,
+    0xFF,0xFF,0xDF,0xFF,0x55,0xFF,0xFF,0x7F,0x23,0xFF,0xFF,0x0C,0x5E,0xDF,0x9A,0xB6,
+    0xF8,0x8D,0x38,0x65,0xB8,0x3C,0x36,0x2C,0x94,0x1B,0x33,0x13,0xF3,0x0A,0xB2,0x0A,
+    0x91,0x02,0x70,0x02,0x4F,0x02,0x7F,0x18,0x2F,0x02,0x43,0x0F,0x02,0x01,0x30,0x02,
+    0x3D,0xD7,0x5D,0xFF,0xFF,0x06,0x3D,0xCF,0xD5,0x13,0x96,0x13,0xB5,0x1B,0x54,0x1B,
+    0x77,0x24,0xFF,0xE7,0x4B,0xFF,0xFF,0x05,0x3D,0x96,0x35,0x1B,0xB4,0x1B,0xD4,0x1B,
+    0x35,0x1B,0xD9,0x4C,0x48,0xFF,0xFF,0x05,0xB9,0x75,0x14,0x13,0xB6,0x1B,0x95,0x1B,
+    0x74,0x1B,0x1D,0xCF,0x8E,0x0B,0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xF7,0x4C,0x34,0x13,
+    0xB6,0x1B,0x75,0x1B,0xD4,0x23,0xBD,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x81,0x0B,
+    0xDF,0xFF,0xFF,0xFF,0xFF,0xF7,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0x57,0x3C,0x55,0x13,
+    0xD6,0x1B,0x74,0x1B,0xB5,0x1B,0x9F,0xD7,0x8D,0x02,0x5D,0xDF,0x94,0x1B,0x95,0x1B,
+    0x45,0xB5,0x1B,0x09,0xB6,0x1B,0xB6,0x1B,0xD5,0x1B,0xD4,0x1B,0xD5,0x1B,0xB5,0x1B,
+    0xB6,0x1B,0xB4,0x1B,0x74,0x1B,0x1E,0xC7,0x43,0xFF,0xFF,0x11,0x5D,0xDF,0x58,0x75,
+    0xF6,0x2B,0x14,0x13,0x92,0x02,0x2F,0x02,0x2F,0x02,0x0F,0x02,0xF1,0x01,0x11,0x02,
+    0x30,0x02,0x92,0x0A,0x74,0x1B,0xD8,0x4C,0xFB,0xC6,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,
+    0x46,0xFF,0xFF,0x04,0x78,0x44,0x53,0x13,0xB6,0x1B,0x14,0x1B,0xBA,0x65,0x4D,0xFF,
+    0xFF,0x05,0xFE,0xFF,0x79,0x75,0x53,0x13,0xD5,0x1B,0x14,0x13,0x19,0x5D,0x43,0xFF,
+    0xFF,0x07,0x96,0x44,0x15,0x13,0xB5,0x1B,0x75,0x1B,0x55,0x2C,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xF7,0x4E,0xFF,0xFF,0x05,0xDF,0xF7,0x16,0x24,0x75,0x1B,0xB4,0x1B,0x14,0x1B,
+    0xF7,0x4C,0x82,0x05,0xDF,0xFF,0xF8,0x5C,0x33,0x1B,0xB4,0x1B,0x14,0x1B,0x9A,0x75,
+    0x89,0x14,0xFF,0xF7,0xFE,0xFF,0xFF,0xFF,0x5A,0x5D,0x33,0x13,0xB6,0x1B,0xB8,0x1B,
+    0xF2,0x12,0x19,0x9E,0xFF,0xFF,0xFE,0xFF,0xDF,0xFF,0x9C,0xAE,0x56,0x1B,0x76,0x1B,
+    0xD5,0x1B,0x96,0x1B,0x95,0x23,0xD5,0x1B,0xB5,0x1B,0xD5,0x23,0x42,0xD5,0x1B,0x05,
+    0xB5,0x1B,0xB4,0x1B,0xB6,0x1B,0xB5,0x1B,0x74,0x13,0x77,0x3C,0x91,0x04,0x78,0x3C,
+    0x34,0x1B,0xB5,0x1B,0x96,0x23,0xB4,0x1B,0x43,0xB5,0x1B,0x0B,0xD5,0x1B,0xB5,0x1B,
+    0xD5,0x1B,0xB5,0x1B,0xB6,0x1B,0x97,0x1B,0x95,0x1B,0x15,0x1B,0xFA,0x7D,0xFF,0xFF,
+    0xDF,0xFF,0xFE,0xFF,0x81,0x11,0xB6,0x54,0xF4,0x1A,0xB5,0x1B,0xB4,0x1B,0xD5,0x1B,
+    0xB5,0x1B,0xD5,0x1B,0xB5,0x1B,0xB5,0x1B,0xD6,0x1B,0xB5,0x1B,0xD5,0x1B,0xD4,0x1B,
+    0xB5,0x1B,0x96,0x23,0xB5,0x13,0x72,0x13,0xFD,0xB6,0x82,0x06,0x1D,0xCF,0x75,0x1B,
+    0x93,0x1B,0xB5,0x1B,0xD5,0x1B,0xB6,0x23,0xD6,0x1B,0x42,0xD5,0x1B,0x08,0xB5,0x1B,
+    0xD5,0x1B,0xD5,0x1B,0xB6,0x1B,0xD4,0x1B,0xB5,0x1B,0x95,0x1B,0xD4,0x23,0x3D,0xD7,
+    0x81,0x00,0xFE,0xF7,0x43,0xFF,0xFF,0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x0F,0x7B,0xBE,
+    0xB7,0x34,0x54,0x13,0x71,0x0A,0x2F,0x02,0x30,0x02,0x31,0x02,0x30,0x02,0x10,0x02,
+    0x10,0x02,0x51,0x02,0xF3,0x0A,0xB6,0x1B,0x38,0x5D,0xFC,0xC6,0xDF,0xFF,0x46,0xFF,
+    0xFF,0x0D,0xFF,0xF7,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0x7D,0xE7,0xB5,0x23,0x74,0x1B,
+    0x76,0x1B,0x75,0x1B,0x1C,0xC7,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xEF,0x88,0x04,
+    0x37,0x2C,0x73,0x1B,0x95,0x1B,0x32,0x1B,0x9C,0xAE,0x88,0x0E,0xFF,0xFF,0xDE,0xFF,
+    0xFE,0xFF,0xFF,0xFF,0xD6,0x34,0x34,0x1B,0xB5,0x23,0xB5,0x13,0x52,0x13,0xFB,0xC6,
+    0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xBF,0xFF,0x44,0xFF,0xFF,0x0C,0xD8,0x85,
+    0xF5,0x2B,0x13,0x0B,0x51,0x02,0x0F,0x02,0x10,0x02,0x10,0x02,0x2F,0x02,0x0F,0x02,
+    0x30,0x02,0x14,0x0B,0x16,0x2C,0xF8,0x95,0x42,0xFF,0xFF,0x03,0xDE,0xFF,0xFE,0xFF,
+    0xFE,0xFF,0xFF,0xF7,0x43,0xFF,0xFF,0x08,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xBB,0xB6,
+    0x74,0x1B,0xB5,0x1B,0x34,0x1B,0xF4,0x2B,0xDE,0xEF,0x4A,0xFF,0xFF,0x09,0xFE,0xFF,
+    0xFF,0xF7,0xFF,0xFF,0xFF,0xFF,0xFB,0x7D,0x14,0x13,0xB5,0x1B,0xD5,0x1B,0x33,0x1B,
+    0x97,0x34,0x81,0x0D,0xDF,0xFF,0xDF,0xFF,0x1B,0xBF,0x94,0x1B,0x76,0x1B,0xD5,0x1B,
+    0xB6,0x1B,0xB5,0x1B,0xB7,0x1B,0xB7,0x1B,0xD5,0x1B,0xB5,0x1B,0x73,0x1B,0xFD,0xC6,
+    0x49,0xFF,0xFF,0x27,0x1C,0xDF,0x17,0x5D,0xB5,0x13,0xB1,0x0A,0x2F,0x02,0x10,0x02,
+    0x0F,0x02,0x30,0x02,0x10,0x02,0x0F,0x02,0x30,0x02,0xD1,0x0A,0xB4,0x13,0x99,0x3C,
+    0x5A,0xAE,0xFF,0xFF,0xFF,0xFF,0xDF,0xF7,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,
+    0xD8,0x8D,0x36,0x34,0x74,0x13,0xD1,0x0A,0x0F,0x02,0xEF,0x01,0x30,0x02,0x30,0x02,
+    0x10,0x02,0x0F,0x02,0x50,0x02,0x34,0x13,0x78,0x34,0x7A,0xB6,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xF7,0xFE,0xFF,0x95,0x7F,0x2A,0xFF,0xFF,0x05,0xDF,0xFF,0x7E,0xEF,0x1C,0xD7,
+    0xDC,0xC6,0xBB,0xB6,0x9A,0xAE,0x7F,0x1B,0x5A,0xA6,0x02,0x5A,0x9E,0x59,0xA6,0xDF,
+    0xEF,0x9C,0x00,0xDE,0xFF,0x45,0xFF,0xFF,0x03,0xFE,0xFF,0xFE,0xFF,0xFF,0xFF,0xDF,
+    0xFF,0x6C,0xFF,0xFF,0x00,0xDF,0xFF,0x46,0xFF,0xFF,0x00,0xDE,0xFF,0x73,0xFF,0xFF,
+    0x00,0xDE,0xFF,0x43,0xFF,0xFF,0x08,0xDF,0xFF,0xFC,0xC6,0x39,0x96,0x1A,0x7E,0xFA,
+    0x7D,0xDA,0x7D,0xFA,0x85,0x5A,0x9E,0x1C,0xD7,0x51,0xFF,0xFF,0x00,0xFE,0xFF,0x52,
+    0xFF,0xFF,0x04,0xFE,0xFF,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x45,0xFF,0xFF,
+    0x01,0xDF,0xFF,0xDF,0xFF,0x53,0xFF,0xFF,0x03,0xFE,0xFF,0xFF,0xF7,0xFF,0xFF,0xDE,
+    0xFF,0x4B,0xFF,0xFF,0x00,0xFE,0xFF,0x81,0x02,0xDF,0xF7,0xFF,0xFF,0xFE,0xFF,0x44,
+    0xFF,0xFF,0x03,0xFE,0xF7,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x4E,0xFF,0xFF,0x03,0xFE,
+    0xFF,0xFF,0xFF,0xFF,0xFF,0xDE,0xFF,0x8E,0x04,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xFE,0xFF,0x51,0xFF,0xFF,0x01,0xFE,0xFF,0xFE,0xFF,0x50,0xFF,0xFF,0x00,0xFE,
+    0xFF,0x81,0x01,0xFE,0xFF,0xFE,0xFF,0x57,0xFF,0xFF,0x03,0xDF,0xFF,0xFF,0xFF,0xFF,
+    0xFF,0xDF,0xF7,0x43,0xFF,0xFF,0x08,0xFB,0xCE,0x39,0x9E,0xFA,0x75,0x1B,0x76,0xFA,
+    0x7D,0xFA,0x85,0xF9,0x8D,0xBA,0xB6,0x9D,0xE7,0x60,0xFF,0xFF,0x00,0xDF,0xFF,0x4D,
+    0xFF,0xFF,0x00,0xFF,0xF7,0x47,0xFF,0xFF,0x06,0xDE,0xFF,0xFF,0xFF,0xFF,0xF7,0xFF,
+    0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0x81,0x00,0xFE,0xFF,0x42,0xFF,0xFF,0x08,0xBE,
+    0xF7,0x7A,0xB6,0xF9,0x8D,0xFA,0x75,0xFA,0x7D,0x1A,0x86,0x1A,0x8E,0x9B,0xB6,0xBE,
+    0xE7,0x42,0xFF,0xFF,0x04,0xBE,0xFF,0xDE,0xFF,0xFE,0xF7,0xFF,0xFF,0xDF,0xFF,0x45,
+    0xFF,0xFF,0x00,0xDF,0xFF,0x45,0xFF,0xFF,0x42,0xFE,0xFF,0x89,0x01,0xDF,0xFF,0xDF,
+    0xFF,0x46,0xFF,0xFF,0x04,0xFE,0xFF,0xFF,0xFF,0xFF,0xF7,0xDE,0xFF,0xFE,0xFF,0x57,
+    0xFF,0xFF,0x08,0x5D,0xD7,0x5A,0xA6,0x1A,0x86,0x1A,0x7E,0x3A,0x76,0x19,0x76,0x39,
+    0x86,0x7A,0xA6,0x3D,0xD7,0x44,0xFF,0xFF,0x03,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,
+    0xFF,0x43,0xFF,0xFF,0x08,0x5C,0xCF,0x7A,0xA6,0x19,0x86,0x1A,0x76,0x3B,0x76,0x1A,
+    0x7E,0x5A,0x96,0xBB,0xC6,0xFF,0xF7,0x42,0xFF,0xFF,0x01,0xDF,0xF7,0xDF,0xFF,0x56,
+    0xFF,0xFF,0x7F,0xAB,0xFF,0xFF,0x00,0xFE,0xFF,0x7F,0x0F,0xFF,0xFF,0x01,0xFE,0xFF,
+    0xFE,0xFF,0xA1,0x00,0xFE,0xFF,0x7F,0x10,0xFF,0xFF,0x00,0xFE,0xFF,0x56,0xFF,0xFF,
+    0x00,0xDF,0xFF,0x81,0x00,0xFE,0xFF,0x7F,0x31,0xFF,0xFF,0x02,0xFE,0xFF,0xFF,0xFF,
+    0xDF,0xFF,0x42,0xFF,0xFF,0x00,0xDF,0xFF,0x7C,0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,
+    0x83,0x08,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,
+    0xDF,0xFF,0xDF,0xFF,0x4E,0xFF,0xFF,0x04,0xFF,0xF7,0xFF,0xF7,0xFE,0xFF,0xFE,0xFF,
+    0xDF,0xFF,0x86,0xF4,0x00,0xFE,0xFF,0x52,0xFF,0xFF,0x00,0xDF,0xFF,0x51,0xFF,0xFF,
+    0x00,0xDF,0xFF,0x57,0xFF,0xFF,0xBF,0x2F,0x00,0xFE,0xFF,0x7F,0x3D,0xFF,0xFF,0x01,
+    0xFE,0xF7,0xFE,0xFF,0x82,0x03,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0x97,0x00,
+    0xFF,0xF7,0x96,0x00,0xFE,0xFF,0x82,0x00,0xDF,0xFF,0x81,0x01,0xFE,0xFF,0xFE,0xFF,
+    0x87,0x00,0xFE,0xFF,0xA6,0xE2,0x00,0xFE,0xFF,0x92,0x02,0xFE,0xFF,0xFF,0xFF,0xDF,
+    0xFF,0x96,0x43,0xDF,0xFF,0x02,0xFF,0xFF,0xFF,0xF7,0xFE,0xFF,0x82,0x00,0xFE,0xFF,
+    0x50,0xFF,0xFF,0x03,0xDF,0xFF,0xFF,0xFF,0xFE,0xFF,0xFE,0xFF,0xBC,0x00,0xDF,0xFF,
+    0x91,0x00,0xDF,0xFF,0x94,0x00,0xDF,0xFF,0x84,0x42,0xFE,0xFF,0x01,0xDF,0xFF,0xDF,
+    0xFF,0x4D,0xFF,0xFF,0x00,0xDF,0xFF,0x9E,0x00,0xFE,0xFF,0x8E,0x01,0xDF,0xFF,0xFF,
+    0xF7,0x42,0xFF,0xFF,0x04,0xFE,0xFF,0xFE,0xFF,0xFE,0xF7,0xDF,0xFF,0xFF,0xFF,0x83,
+    0x00,0xDF,0xFF,0x42,0xFF,0xFF,0x00,0xDE,0xFF,0x86,0x00,0xFE,0xFF,0x82,0x42,0xFE,
+    0xFF,0x00,0xFF,0xF7,0x4E,0xFF,0xFF,0x00,0xFE,0xFF,0x8E,0x00,0xFE,0xFF,0x91,0x01,
+    0xFE,0xFF,0xFE,0xFF,0x4B,0xFF,0xFF,0x01,0xFE,0xFF,0xFE,0xFF,0x85,0x02,0xDF,0xFF,
+    0xFF,0xFF,0xDF,0xFF,0x81,0x00,0xDF,0xFF,0x84,0x01,0xFE,0xFF,0xDE,0xFF,0x81,0x02,
+    0xDE,0xFF,0xFF,0xFF,0xFF,0xF7,0x87,0x00,0xFF,0xF7,0x5B,0xFF,0xFF,0x7F,0x30,0xFF,
+    0xFF,0x47,0xFE,0xFF,0xBF,0x14,0x00,0xFE,0xFF,0x64,0xFF,0xFF,0x83,0x00,0xDE,0xFF,
+    0x95,0x00,0xDF,0xFF,0x82,0x00,0xDF,0xFF,0x57,0xFF,0xFF,0x06,0xFE,0xFF,0xFF,0xFF,
+    0xDF,0xFF,0xFE,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x83,0x00,0xFF,0xF7,0x52,0xFF,
+    0xFF,0x00,0xFE,0xFF,0x91,0x00,0xDF,0xFF,0x89,0x02,0xFF,0xF7,0xDF,0xFF,0xDF,0xFF,
+    0x94,0x00,0xFE,0xFF,0x57,0xFF,0xFF,0x02,0xDF,0xFF,0xFE,0xFF,0xFE,0xFF,0x95,0x42,
+    0xFF,0xFF,0x03,0xFE,0xFF,0xFF,0xFF,0xDF,0xFF,0xDF,0xFF,0x4D,0xFF,0xFF,0x04,0xFE,
+    0xFF,0xFF,0xFF,0xFE,0xF7,0xDF,0xFF,0xDF,0xFF,0x43,0xFF,0xFF,0xBD,0xFF,0x22,0x8F,
+    0x07,0xFF,0xFF,0xFE,0xF7,0xFF,0xF7,0xFE,0xFF,0xDE,0xFF,0xFF,0xFF,0xFF,0xFF,0xBF,
+    0xFF,0x82,0x00,0xFE,0xFF,0x43,0xFF,0xFF,0x00,0xFE,0xFF,0x47,0xFF,0xFF,0x00,0xDE,
+    0xFF,0x43,0xFF,0xFF,0x81,0x01,0xFF,0xFF,0xDF,0xFF,0x5E,0xFF,0xFF,0x83,0x00,0xFE,
+    0xFF,0x8D,0x01,0xDF,0xFF,0xDF,0xFF,0x4C,0xFF,0xFF,0x00,0xDF,0xFF,0x82,0x00,0xDF,
+    0xFF,0x45,0xFF,0xFF,0x00,0xFF,0xF7,0x49,0xFF,0xFF,0x00,0xDF,0xFF,0x89,0x02,0xDF,
+    0xFF,0xFF,0xFF,0xFE,0xFF,0x99,0x7F,0xA9,0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,0x4A,
+    0xFF,0xFF,0x96,0xD8,0x00,0xDF,0xFF,0x44,0xFF,0xFF,0x00,0xDF,0xFF,0x43,0xFF,0xFF,
+    0x06,0xFF,0xF7,0xFF,0xF7,0xDF,0xFF,0xDF,0xFF,0xFF,0xFF,0xFF,0xFF,0xDF,0xFF,0x8E,
+    0x00,0xDF,0xFF,0x53,0xFF,0xFF,0x82,0x02,0xDF,0xFF,0xFE,0xFF,0xFE,0xFF,0x55,0xFF,
+    0xFF,0x05,0xDF,0xFF,0xDF,0xFF,0xFE,0xFF,0xFE,0xFF,0xDF,0xFF,0xDF,0xFF,0x84,0x01,
+    0xDF,0xFF,0xFE,0xFF,0x53,0xFF,0xFF,0x82,0x00,0xDF,0xFF,0x58,0xFF,0xFF,0x01,0xDF,
+    0xFF,0xDE,0xFF,0x82,0x00,0xFE,0xFF,0x56,0xFF,0xFF,0x00,0xDF,0xFF,0x82,0x00,0xFE,
+    0xFF,0x8A,0x00,0xDF,0xFF,0x95,0x00,0xDF,0xFF,0x8E,0x00,0xFE,0xFF,0x83,0x00,0xDF,
+    0xFF,0xA9,0x01,0xDF,0xFF,0xDF,0xFF,0x83,0x00,0xDF,0xFF,0x81,0x01,0xFE,0xFF,0xFE,
+    0xFF,0x84,0x00,0xDF,0xFF,0x81,0x00,0xDF,0xFF,0x8D,0x00,0xFE,0xFF,0x81,0x01,0xDF,
+    0xFF,0xDF,0xFF,0x81,0x00,0xFE,0xFF,0x4C,0xFF,0xFF,0x00,0xDF,0xFF,0x4E,0xFF,0xFF,
+    0x02,0xDF,0xFF,0xFE,0xFF,0xFE,0xFF,0x81,0x00,0xFF,0xF7,0x4B,0xFF,0xFF,0x42,0xDF,
+    0xFF,0x81,0x00,0xDF,0xFF,0x63,0xFF,0xFF,0x00,0xFE,0xFF,0x45,0xFF,0xFF,0x82,0x00,
+    0xFE,0xFF,0x87,0x01,0xDF,0xFF,0xDF,0xFF,0x82,0x00,0xFE,0xFF,0x4C,0xFF,0xFF,0x00,
+    0xDF,0xFF,0x47,0xFF,0xFF,0x01,0xDF,0xFF,0xDF,0xFF,0x87,0x00,0xFF,0xF7,0x82,0xE5,
+    0x7F,0xFF,0xFF,0x92,0xFF,0xFF,0x82,0xFF,0x0D,0x7F,0xFF,0xFF,0xE2,0xFF,0xFF,0xBF,
+    0xFF,0x96,0x00,0xDF,0xFF,0xBF,0xFF,0x0B,0x7F,0xFF,0xFF,0xE2,0xFF,0xFF,0xBF,0xFF,
+    0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,
+    0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,
+    0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,0xBF,0xFF,0xFF,0xE2,
+};
@@ -0,0 +1,228 @@
+/*
+ * asset_store.c
+ * Read-only store of images, fonts and string tables, resolved by name
+ *
+ * Target independent part, also built into the host tools. The QUADSPI
+ * mount and the DMA2D draw are in asset_store_qspi.c.
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stddef.h>
+#include <string.h>
+#include "asset_store.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+#define STORE_FNV_OFFSET              (2166136261U)
+#define STORE_FNV_PRIME               (16777619U)
+#define STORE_FONT_HEADER_BYTES       (8U)
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+static struct
+{
+    const uint8_t               *base;    /* NULL: not mounted */
+    const ASSET_Store_Header_t  *header;
+    const ASSET_Entry_t         *index;
+    ASSET_Store_Stats_t         stats;
+} Store;
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static uint32_t Fnv(uint32_t hash, const uint8_t *p, uint32_t len);
+static uint16_t Read16(const uint8_t *p);
+static uint32_t Read32(const uint8_t *p);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+ASSET_Store_Status_t ASSET_Store_Mount(const void *base, uint32_t size)
+{
+    const ASSET_Store_Header_t *h = (const ASSET_Store_Header_t*)base;
+    const ASSET_Entry_t *index = (const ASSET_Entry_t*)(h + 1);
+    uint32_t index_end;
+
+    Store.base = NULL;
+    if ((size < sizeof(*h)) || (h->magic != ASSET_STORE_MAGIC) ||
+        (h->version != ASSET_STORE_VERSION) || (h->size > size))
+    {
+        return ASSET_STORE_ERR_HEADER;
+    }
+    index_end = (uint32_t)sizeof(*h) + (uint32_t)h->count * sizeof(ASSET_Entry_t);
+    if ((index_end > h->size) ||
+        (Fnv(STORE_FNV_OFFSET, (const uint8_t*)index, index_end - sizeof(*h)) != h->check))
+    {
+        return ASSET_STORE_ERR_INDEX;
+    }
+    for (uint32_t i = 0U; i < h->count; i++)
+    {
+        const ASSET_Entry_t *e = &index[i];
+
+        /* Sorted, inside the blob, names ended before the blob does */
+        if (((i != 0U) && (e->hash < index[i - 1U].hash)) ||
+            (e->offset > h->size) || (e->size > (h->size - e->offset)) ||
+            (e->name >= h->size) ||
+            (memchr((const uint8_t*)base + e->name, '\0', h->size - e->name) == NULL))
+        {
+            return ASSET_STORE_ERR_INDEX;
+        }
+    }
+
+    Store.header = h;
+    Store.index = index;
+    Store.base = (const uint8_t*)base;
+    return ASSET_STORE_OK;
+}
+
+uint8_t ASSET_Store_isMounted(void)
+{
+    return (Store.base != NULL) ? 1U : 0U;
+}
+
+uint16_t ASSET_Store_Count(void)
+{
+    return (Store.base != NULL) ? Store.header->count : 0U;
+}
+
+const ASSET_Entry_t* ASSET_Store_Find(const char *name)
+{
+    uint32_t hash = ASSET_Store_Hash(name);
+    uint32_t lo = 0U, hi;
+
+    if (Store.base == NULL)
+    {
+        return NULL;
+    }
+    Store.stats.finds++;
+
+    /* First entry of the hash, then the names that share it */
+    hi = Store.header->count;
+    while (lo < hi)
+    {
+        uint32_t mid = (lo + hi) / 2U;
+
+        if (Store.index[mid].hash < hash)
+        {
+            lo = mid + 1U;
+        }
+        else
+        {
+            hi = mid;
+        }
+    }
+    for (; (lo < Store.header->count) && (Store.index[lo].hash == hash); lo++)
+    {
+        if (strcmp((const char*)Store.base + Store.index[lo].name, name) == 0)
+        {
+            return &Store.index[lo];
+        }
+        Store.stats.collisions++;
+    }
+    Store.stats.misses++;
+    return NULL;
+}
+
+const ASSET_Entry_t* ASSET_Store_Entry(uint16_t i)
+{
+    return (i < ASSET_Store_Count()) ? &Store.index[i] : NULL;
+}
+
+const char* ASSET_Store_Name(const ASSET_Entry_t *entry)
+{
+    return (const char*)Store.base + entry->name;
+}
+
+const void* ASSET_Store_Data(const ASSET_Entry_t *entry)
+{
+    return Store.base + entry->offset;
+}
+
+uint8_t ASSET_Store_FontPK(const ASSET_Entry_t *entry, pFONT *font)
+{
+    const uint8_t *p = Store.base + entry->offset;
+    uint32_t count, codes, tables;
+
+    if ((entry->type != ASSET_TYPE_FONT_PK) || (entry->size < STORE_FONT_HEADER_BYTES))
+    {
+        return 0U;
+    }
+    count = Read16(p);
+    codes = (count * 2U + 3U) & ~3U;
+    tables = STORE_FONT_HEADER_BYTES + codes + (count + 1U) * 4U;
+    if ((tables > entry->size) ||
+        (Read32(p + STORE_FONT_HEADER_BYTES + codes + count * 4U) > (entry->size - tables)))
+    {
+        return 0U;
+    }
+    font->count = (uint16_t)count;
+    font->width = p[2];
+    font->ascii_width = p[3];
+    font->height = p[4];
+    font->run0_bits = p[5];
+    font->run1_bits = p[6];
+    font->code = (const uint16_t*)(p + STORE_FONT_HEADER_BYTES);
+    font->offset = (const uint32_t*)(p + STORE_FONT_HEADER_BYTES + codes);
+    font->data = p + tables;
+    return 1U;
+}
+
+const char* ASSET_Store_String(const ASSET_Entry_t *entry, uint32_t index)
+{
+    const uint8_t *p = Store.base + entry->offset;
+    uint32_t off;
+
+    if ((entry->type != ASSET_TYPE_STRINGS) || (entry->size < 4U) ||
+        (index >= Read32(p)) || (((index + 2U) * 4U) > entry->size))
+    {
+        return NULL;
+    }
+    off = Read32(p + 4U + index * 4U);
+    if ((off >= entry->size) || (memchr(p + off, '\0', entry->size - off) == NULL))
+    {
+        return NULL;
+    }
+    return (const char*)p + off;
+}
+
+uint32_t ASSET_Store_Hash(const char *name)
+{
+    return Fnv(STORE_FNV_OFFSET, (const uint8_t*)name, (uint32_t)strlen(name));
+}
+
+const ASSET_Store_Stats_t* ASSET_Store_GetStats(void)
+{
+    return &Store.stats;
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+static uint32_t Fnv(uint32_t hash, const uint8_t *p, uint32_t len)
+{
+    for (uint32_t i = 0U; i < len; i++)
+    {
+        hash = (hash ^ p[i]) * STORE_FNV_PRIME;
+    }
+    return hash;
+}
+
+static uint16_t Read16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | ((uint32_t)p[1] << 8));
+}
+
+static uint32_t Read32(const uint8_t *p)
+{
+    return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
@@ -0,0 +1,129 @@
+/*
+ * asset_store.h
+ * Read-only store of images, fonts and string tables, resolved by name
+ *
+ * A store is one blob built by Tools/asset_pack: a header, an index sorted
+ * by name hash, the names, then the assets, each on a 32 byte boundary so
+ * the DMA2D and the cache work on them in place. Lookup is a binary search
+ * on the FNV-1a hash of the name, then a name compare. Assets are never
+ * copied: ASSET_Store_Data() points into the blob.
+ *
+ * On the target the blob is programmed at the QUADSPI origin (0x90000000,
+ * with the board's external loader) and read through the memory mapped
+ * window; ASSET_Store_MountQSPI() only mounts once the QUADSPI is in memory
+ * mapped mode. On the host the same code runs over a file read in memory
+ * (Tools/asset_pack/asset_file.h).
+ *
+ * Asset types, all little endian:
+ *  - BLOB: bytes as they are.
+ *  - IMAGE: an image_asset.h asset; format is its compression.
+ *  - FONT_PK: a pFONT (fonts_pk.h) without pointers: count (16 bits),
+ *    width, ascii_width, height, run0_bits, run1_bits, a pad byte, the
+ *    codes (16 bits, padded to 4 bytes), the count + 1 offsets (32 bits),
+ *    then the glyph records.
+ *  - STRINGS: count (32 bits), count offsets from the asset start (32 bits)
+ *    and the NUL terminated UTF-8 strings.
+ */
+
+#ifndef ASSET_STORE_H_
+#define ASSET_STORE_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "fonts_pk.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+#define ASSET_STORE_MAGIC                        (0x53545341U)   /* "ASTS" */
+#define ASSET_STORE_VERSION                      (1U)
+#define ASSET_STORE_ALIGN                        (32U)
+
+/* Memory mapped QUADSPI window (linker script region QUADSPI) */
+#define ASSET_STORE_QSPI_BASE                    (0x90000000U)
+#define ASSET_STORE_QSPI_SIZE                    (126U * 1024U * 1024U)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef enum
+{
+    ASSET_STORE_OK = 0,
+    ASSET_STORE_ERR_UNMAPPED,     /* QUADSPI not in memory mapped mode */
+    ASSET_STORE_ERR_HEADER,       /* no store, or another version */
+    ASSET_STORE_ERR_INDEX,        /* index outside the blob, or check failed */
+} ASSET_Store_Status_t;
+
+typedef enum
+{
+    ASSET_TYPE_BLOB = 0,
+    ASSET_TYPE_IMAGE,
+    ASSET_TYPE_FONT_PK,
+    ASSET_TYPE_STRINGS,
+} ASSET_Type_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;               /* index entries */
+    uint32_t size;                /* whole blob */
+    uint32_t check;               /* FNV-1a of the index */
+} ASSET_Store_Header_t;
+
+typedef struct
+{
+    uint32_t hash;                /* FNV-1a of the name, index sorted on it */
+    uint32_t offset;              /* of the asset in the blob */
+    uint32_t size;
+    uint32_t name;                /* offset of the NUL terminated name */
+    uint8_t  type;                /* ASSET_Type_t */
+    uint8_t  format;
+    uint16_t reserved;
+} ASSET_Entry_t;
+
+typedef struct
+{
+    uint32_t finds;
+    uint32_t misses;
+    uint32_t collisions;          /* same hash, other name */
+} ASSET_Store_Stats_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Mounts the blob at base (size bytes readable); the index is checked */
+extern ASSET_Store_Status_t ASSET_Store_Mount(const void *base, uint32_t size);
+/* Mounts the blob at the QUADSPI origin */
+extern ASSET_Store_Status_t ASSET_Store_MountQSPI(void);
+extern uint8_t ASSET_Store_isMounted(void);
+extern uint16_t ASSET_Store_Count(void);
+
+/* Entry of a name, NULL if the store has none */
+extern const ASSET_Entry_t* ASSET_Store_Find(const char *name);
+/* i-th entry in index order, NULL past the end */
+extern const ASSET_Entry_t* ASSET_Store_Entry(uint16_t i);
+extern const char* ASSET_Store_Name(const ASSET_Entry_t *entry);
+extern const void* ASSET_Store_Data(const ASSET_Entry_t *entry);
+
+/* Fills font with pointers into a FONT_PK asset; 0 if it isn't one */
+extern uint8_t ASSET_Store_FontPK(const ASSET_Entry_t *entry, pFONT *font);
+/* String of a STRINGS asset, NULL past the end */
+extern const char* ASSET_Store_String(const ASSET_Entry_t *entry, uint32_t index);
+
+/* Draws an IMAGE asset on an RGB565 surface (stride in pixels), clipped.
+ * Raw images are one DMA2D copy from the store, RLE ones are decoded
+ * line by line (image_asset.h). Returns an IMAGE_Asset_Status_t. */
+extern int32_t ASSET_Store_DrawImage(const ASSET_Entry_t *entry, uint16_t *surface,
+        uint32_t stride, uint16_t width, uint16_t height, int16_t x, int16_t y);
+
+extern uint32_t ASSET_Store_Hash(const char *name);
+extern const ASSET_Store_Stats_t* ASSET_Store_GetStats(void);
+
+#endif /* ASSET_STORE_H_ */
@@ -0,0 +1,72 @@
+/*
+ * asset_store_qspi.c
+ * Asset store on the memory mapped QUADSPI flash, images drawn by DMA2D
+ *
+ * The QUADSPI itself (pins, flash commands, memory mapped mode) is brought
+ * up by the board code or the boot loader; reading the window before that
+ * faults, so the mount checks the peripheral state first.
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include "main.h"
+#include "asset_store.h"
+#include "image_asset.h"
+#include "BSP_DMA2D.h"
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+ASSET_Store_Status_t ASSET_Store_MountQSPI(void)
+{
+    if (!(RCC->AHB3ENR & RCC_AHB3ENR_QSPIEN) ||
+        ((QUADSPI->CCR & QUADSPI_CCR_FMODE) != QUADSPI_CCR_FMODE))
+    {
+        return ASSET_STORE_ERR_UNMAPPED;
+    }
+    return ASSET_Store_Mount((const void*)ASSET_STORE_QSPI_BASE, ASSET_STORE_QSPI_SIZE);
+}
+
+int32_t ASSET_Store_DrawImage(const ASSET_Entry_t *entry, uint16_t *surface,
+        uint32_t stride, uint16_t width, uint16_t height, int16_t x, int16_t y)
+{
+    const IMAGE_Asset_Header_t *h = (const IMAGE_Asset_Header_t*)ASSET_Store_Data(entry);
+    int32_t x0, y0, x1, y1;
+    BSP_DMA2D_Pfc_t pfc;
+
+    if ((entry->type != ASSET_TYPE_IMAGE) || (h->magic != IMAGE_ASSET_MAGIC))
+    {
+        return IMAGE_ASSET_ERR_HEADER;
+    }
+    if (h->compression != IMAGE_ASSET_RAW)
+    {
+        return IMAGE_Asset_Draw(h, surface, stride, width, height, x, y);
+    }
+
+    /* Raw: the visible rectangle in one job, QUADSPI to the surface */
+    x0 = (x < 0) ? -x : 0;
+    y0 = (y < 0) ? -y : 0;
+    x1 = ((x + h->width) > width) ? (width - x) : h->width;
+    y1 = ((y + h->height) > height) ? (height - y) : h->height;
+    if ((x0 >= x1) || (y0 >= y1))
+    {
+        return IMAGE_ASSET_OK;
+    }
+    pfc.src = (const uint16_t*)(h + 1) + (uint32_t)y0 * h->width + (uint32_t)x0;
+    pfc.dst = surface + (uint32_t)(y + y0) * stride + (uint32_t)(x + x0);
+    pfc.src_stride = h->width * 2U;
+    pfc.dst_stride = stride * 2U;
+    pfc.width = (uint32_t)(x1 - x0);
+    pfc.lines = (uint32_t)(y1 - y0);
+    pfc.in_mode = DMA2D_INPUT_RGB565;
+    pfc.out_mode = DMA2D_OUTPUT_RGB565;
+    pfc.swap = 0U;
+    if (BSP_DMA2D_Convert(&pfc) != HAL_OK)
+    {
+        return IMAGE_Asset_Draw(h, surface, stride, width, height, x, y);
+    }
+    return IMAGE_ASSET_OK;
+}
@@ -4,4 +4,7 @@
 extern const unsigned char gImage_800X221[];
 extern const unsigned char gImage_wu[];
 
+/* Compressed assets (image_asset.h) */
+extern const unsigned char gAsset_800X221[];
+
 #endif
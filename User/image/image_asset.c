@@ -0,0 +1,206 @@
+/*
+ * image_asset.c
+ * Compressed RGB565 image assets, and streaming decoder
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "image_asset.h"
+
+/******************************************************************************
+ *                         LOCAL DATA PROTOTYPES                              *
+ ******************************************************************************/
+
+/* Clipped draws: the line above and the line being decoded */
+static uint16_t Asset_Line[2][IMAGE_ASSET_MAX_WIDTH];
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static IMAGE_Asset_Status_t DecodeRLE(IMAGE_Asset_Decoder_t *dec, uint16_t *dst);
+static uint16_t Pixel(const uint8_t *p);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+IMAGE_Asset_Status_t IMAGE_Asset_Open(IMAGE_Asset_Decoder_t *dec, const void *asset)
+{
+    const IMAGE_Asset_Header_t *h = (const IMAGE_Asset_Header_t*)asset;
+
+    if ((h->magic != IMAGE_ASSET_MAGIC) || (h->format != IMAGE_ASSET_RGB565) ||
+        (h->compression > IMAGE_ASSET_RLE) || (h->width == 0U) ||
+        ((h->compression == IMAGE_ASSET_RAW) &&
+         (h->size != (uint32_t)h->width * h->height * 2U)))
+    {
+        return IMAGE_ASSET_ERR_HEADER;
+    }
+    dec->header = h;
+    dec->src = (const uint8_t*)asset + IMAGE_ASSET_HEADER_BYTES;
+    dec->end = dec->src + h->size;
+    dec->prev = NULL;
+    dec->line = 0U;
+    return IMAGE_ASSET_OK;
+}
+
+IMAGE_Asset_Status_t IMAGE_Asset_NextLine(IMAGE_Asset_Decoder_t *dec, uint16_t *dst)
+{
+    IMAGE_Asset_Status_t ret = IMAGE_ASSET_OK;
+
+    if (dec->line >= dec->header->height)
+    {
+        return IMAGE_ASSET_ERR_END;
+    }
+    if (dec->header->compression == IMAGE_ASSET_RAW)
+    {
+        memcpy(dst, dec->src, dec->header->width * 2U);
+        dec->src += dec->header->width * 2U;
+    }
+    else
+    {
+        ret = DecodeRLE(dec, dst);
+    }
+    dec->prev = dst;
+    dec->line++;
+    return ret;
+}
+
+IMAGE_Asset_Status_t IMAGE_Asset_Draw(const void *asset, uint16_t *surface,
+        uint32_t stride, uint16_t width, uint16_t height, int16_t x, int16_t y)
+{
+    IMAGE_Asset_Decoder_t dec;
+    IMAGE_Asset_Status_t ret = IMAGE_Asset_Open(&dec, asset);
+    int32_t w, x0, x1, y1;
+    uint8_t direct;
+
+    if (ret != IMAGE_ASSET_OK)
+    {
+        return ret;
+    }
+    w = dec.header->width;
+    x0 = (x < 0) ? -x : 0;
+    x1 = ((x + w) > width) ? (width - x) : w;
+    y1 = ((y + dec.header->height) > height) ? (height - y) : dec.header->height;
+    direct = ((x0 == 0) && (x1 == w)) ? 1U : 0U;
+    if ((!direct || (y < 0)) && (w > (int32_t)IMAGE_ASSET_MAX_WIDTH))
+    {
+        return IMAGE_ASSET_ERR_HEADER;
+    }
+
+    for (int32_t l = 0; (l < y1) && (ret == IMAGE_ASSET_OK); l++)
+    {
+        int32_t sy = y + l;
+
+        if (direct && (sy >= 0))
+        {
+            /* The line above is the surface line above */
+            ret = IMAGE_Asset_NextLine(&dec, surface + (uint32_t)sy * stride + (uint32_t)x);
+            continue;
+        }
+        ret = IMAGE_Asset_NextLine(&dec, Asset_Line[l & 1]);
+        if ((ret == IMAGE_ASSET_OK) && (sy >= 0) && (x0 < x1))
+        {
+            memcpy(surface + (uint32_t)sy * stride + (uint32_t)(x + x0), &Asset_Line[l & 1][x0],
+                    (uint32_t)(x1 - x0) * 2U);
+        }
+    }
+    return ret;
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+static IMAGE_Asset_Status_t DecodeRLE(IMAGE_Asset_Decoder_t *dec, uint16_t *dst)
+{
+    const uint8_t *p = dec->src;
+    uint32_t x = 0U, w = dec->header->width;
+    uint16_t last;
+
+    while (x < w)
+    {
+        uint32_t op, n;
+
+        if (p >= dec->end)
+        {
+            return IMAGE_ASSET_ERR_DATA;
+        }
+        op = *p & IMAGE_ASSET_OP_MASK;
+        n = *p++ & IMAGE_ASSET_COUNT_MASK;
+        if (n == IMAGE_ASSET_COUNT_MASK)
+        {
+            uint8_t more;
+
+            do
+            {
+                if (p >= dec->end)
+                {
+                    return IMAGE_ASSET_ERR_DATA;
+                }
+                more = *p++;
+                n += more;
+            } while (more == 255U);
+        }
+        n++;
+        if ((x + n) > w)
+        {
+            return IMAGE_ASSET_ERR_DATA;
+        }
+
+        switch (op)
+        {
+            case IMAGE_ASSET_OP_LITERAL:
+                if ((uint32_t)(dec->end - p) < (n * 2U))
+                {
+                    return IMAGE_ASSET_ERR_DATA;
+                }
+                memcpy(&dst[x], p, n * 2U);
+                p += n * 2U;
+                x += n;
+                break;
+            case IMAGE_ASSET_OP_FILL:
+                if ((dec->end - p) < 2)
+                {
+                    return IMAGE_ASSET_ERR_DATA;
+                }
+                last = Pixel(p);
+                p += 2;
+                for (; n != 0U; n--)
+                {
+                    dst[x++] = last;
+                }
+                break;
+            case IMAGE_ASSET_OP_UP:
+                if (dec->prev == NULL)
+                {
+                    return IMAGE_ASSET_ERR_DATA;
+                }
+                memcpy(&dst[x], &dec->prev[x], n * 2U);
+                x += n;
+                break;
+            default:
+                if (x == 0U)
+                {
+                    return IMAGE_ASSET_ERR_DATA;
+                }
+                last = dst[x - 1U];
+                for (; n != 0U; n--)
+                {
+                    dst[x++] = last;
+                }
+                break;
+        }
+    }
+    dec->src = p;
+    return IMAGE_ASSET_OK;
+}
+
+/* Little endian pixel at any address */
+static uint16_t Pixel(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | ((uint32_t)p[1] << 8));
+}
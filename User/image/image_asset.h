@@ -0,0 +1,104 @@
+/*
+ * image_asset.h
+ * Compressed RGB565 image assets, and streaming decoder
+ *
+ * An asset is a 16 byte header followed by the pixels, line after line.
+ * Assets are generated by Tools/img_pack from the gImage_* tables, raw
+ * RGB565 files or PPM pictures, as const arrays aligned on 4 bytes.
+ *
+ * Compression IMAGE_ASSET_RLE codes every line as tokens that never cross
+ * the line end. A token is one byte, op in the two high bits and count - 1
+ * in the low six; count - 1 of 63 goes on in the next bytes, each added,
+ * up to the first one below 255. Pixels are native (little endian) RGB565.
+ *  - LITERAL: count pixels follow
+ *  - FILL:    one pixel follows, repeated count times
+ *  - UP:      count pixels of the line above, same columns
+ *  - REPEAT:  the pixel before, count more times
+ * UP is what takes flat areas, gradients along x and dithering with a
+ * vertical period away; nothing is needed but the line above, so lines are
+ * decoded straight into the destination.
+ */
+
+#ifndef IMAGE_ASSET_H_
+#define IMAGE_ASSET_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+#define IMAGE_ASSET_MAGIC                        (0x41474D49U)   /* "IMGA" */
+#define IMAGE_ASSET_HEADER_BYTES                 (16U)
+/* Widest line of a clipped draw (line buffers) */
+#define IMAGE_ASSET_MAX_WIDTH                    (800U)
+
+/* Formats */
+#define IMAGE_ASSET_RGB565                       (0U)
+
+/* Compressions */
+#define IMAGE_ASSET_RAW                          (0U)
+#define IMAGE_ASSET_RLE                          (1U)
+
+/* Token ops */
+#define IMAGE_ASSET_OP_LITERAL                   (0x00U)
+#define IMAGE_ASSET_OP_FILL                      (0x40U)
+#define IMAGE_ASSET_OP_UP                        (0x80U)
+#define IMAGE_ASSET_OP_REPEAT                    (0xC0U)
+#define IMAGE_ASSET_OP_MASK                      (0xC0U)
+#define IMAGE_ASSET_COUNT_MASK                   (0x3FU)
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef enum
+{
+    IMAGE_ASSET_OK = 0,
+    IMAGE_ASSET_ERR_HEADER,       /* not an asset, or unknown format */
+    IMAGE_ASSET_ERR_DATA,         /* token past the line or the data */
+    IMAGE_ASSET_ERR_END,          /* all lines decoded */
+} IMAGE_Asset_Status_t;
+
+typedef struct
+{
+    uint32_t magic;
+    uint16_t width;
+    uint16_t height;
+    uint8_t  format;
+    uint8_t  compression;
+    uint16_t reserved;
+    uint32_t size;                /* bytes after the header */
+} IMAGE_Asset_Header_t;
+
+typedef struct
+{
+    const IMAGE_Asset_Header_t *header;
+    const uint8_t  *src;          /* next token */
+    const uint8_t  *end;
+    const uint16_t *prev;         /* line above, where it was decoded */
+    uint16_t line;                /* next line */
+} IMAGE_Asset_Decoder_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Checks the header and rewinds to the first line */
+extern IMAGE_Asset_Status_t IMAGE_Asset_Open(IMAGE_Asset_Decoder_t *dec, const void *asset);
+
+/* Decodes the next line (width pixels) into dst. The line before must stay
+ * where it was decoded until this returns. */
+extern IMAGE_Asset_Status_t IMAGE_Asset_NextLine(IMAGE_Asset_Decoder_t *dec, uint16_t *dst);
+
+/* Decodes the whole asset with its top left at (x, y) of an RGB565
+ * surface (stride in pixels), clipped to width x height. Lines go straight
+ * to the surface when the asset isn't cut on the left or right. */
+extern IMAGE_Asset_Status_t IMAGE_Asset_Draw(const void *asset, uint16_t *surface,
+        uint32_t stride, uint16_t width, uint16_t height, int16_t x, int16_t y);
+
+#endif /* IMAGE_ASSET_H_ */
@@ -0,0 +1,608 @@
+/*
+ * image_dec.c
+ * Streaming QOI and BMP decoders, straight into an RGB565 surface
+ */
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <string.h>
+#include "image_dec.h"
+
+/******************************************************************************
+ *                               LOCAL MACRO                                  *
+ ******************************************************************************/
+
+/* States */
+#define DEC_MAGIC                     (0U)
+#define DEC_QOI_HEADER                (1U)
+#define DEC_QOI_DATA                  (2U)
+#define DEC_BMP_HEADER                (3U)
+#define DEC_BMP_SKIP                  (4U)
+#define DEC_BMP_ROWS                  (5U)
+#define DEC_END                       (6U)
+
+#define DEC_MAGIC_BYTES               (4U)
+#define DEC_QOI_HEADER_BYTES          (14U)
+#define DEC_BMP_FILE_BYTES            (14U)
+#define DEC_BMP_MASKS                 (54U)      /* after a 40 byte DIB header */
+#define DEC_BMP_DIB_MIN               (40U)
+#define DEC_BMP_DIB_MAX               (124U)
+#define DEC_BMP_RGB                   (0U)
+#define DEC_BMP_BITFIELDS             (3U)
+
+/* BMP X1R5G5B5, converted here (no VISION_Color format) */
+#define DEC_FMT_555                   ((uint8_t)VISION_COLOR_FORMATS)
+
+/* QOI ops */
+#define QOI_OP_INDEX                  (0x00U)
+#define QOI_OP_DIFF                   (0x40U)
+#define QOI_OP_LUMA                   (0x80U)
+#define QOI_OP_RUN                    (0xC0U)
+#define QOI_OP_RGB                    (0xFEU)
+#define QOI_OP_RGBA                   (0xFFU)
+#define QOI_OP_MASK                   (0xC0U)
+
+/******************************************************************************
+ *                       LOCAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+static uint8_t Collect(IMAGE_Dec_t *dec, const uint8_t **p, uint32_t *n, uint32_t want);
+static IMAGE_Dec_Status_t Finish(IMAGE_Dec_t *dec, IMAGE_Dec_Status_t status);
+static void Clip(IMAGE_Dec_t *dec);
+static IMAGE_Dec_Status_t QoiHeader(IMAGE_Dec_t *dec);
+static IMAGE_Dec_Status_t QoiData(IMAGE_Dec_t *dec, const uint8_t *p, uint32_t n);
+static void QoiRow(IMAGE_Dec_t *dec);
+static IMAGE_Dec_Status_t BmpHeader(IMAGE_Dec_t *dec);
+static IMAGE_Dec_Status_t BmpRows(IMAGE_Dec_t *dec, const uint8_t *p, uint32_t n);
+static void BmpConvert(IMAGE_Dec_t *dec, const uint8_t *src, uint32_t src_stride,
+        uint32_t lines);
+static uint16_t Le16(const uint8_t *p);
+static uint32_t Le32(const uint8_t *p);
+static uint32_t Be32(const uint8_t *p);
+
+/******************************************************************************
+ *                              GLOBAL FUNCTIONS                              *
+ ******************************************************************************/
+
+void IMAGE_Dec_Begin(IMAGE_Dec_t *dec, IMAGE_Dec_Type_t type, uint16_t *surface,
+        uint32_t stride, uint16_t width, uint16_t height, int16_t x, int16_t y)
+{
+    dec->surface = surface;
+    dec->stride = stride;
+    dec->surface_width = width;
+    dec->surface_height = height;
+    dec->x = x;
+    dec->y = y;
+    dec->engine = VISION_COLOR_AUTO;
+    dec->type = (uint8_t)type;
+    dec->state = DEC_MAGIC;
+    dec->status = (uint8_t)IMAGE_DEC_NEED_MORE;
+    dec->held = 0U;
+    dec->width = 0U;
+    dec->height = 0U;
+    dec->pos = 0U;
+}
+
+IMAGE_Dec_Status_t IMAGE_Dec_Feed(IMAGE_Dec_t *dec, const void *data, uint32_t len)
+{
+    const uint8_t *p = (const uint8_t*)data;
+    uint32_t n = len;
+    IMAGE_Dec_Status_t ret;
+
+    if (dec->state == DEC_MAGIC)
+    {
+        if (!Collect(dec, &p, &n, DEC_MAGIC_BYTES))
+        {
+            return IMAGE_DEC_NEED_MORE;
+        }
+        if ((dec->type != IMAGE_DEC_BMP) && (Be32(dec->hold) == IMAGE_DEC_QOI_MAGIC))
+        {
+            dec->type = IMAGE_DEC_QOI;
+            dec->state = DEC_QOI_HEADER;
+        }
+        else if ((dec->type != IMAGE_DEC_QOI) && (Le16(dec->hold) == IMAGE_DEC_BMP_MAGIC))
+        {
+            dec->type = IMAGE_DEC_BMP;
+            dec->state = DEC_BMP_HEADER;
+        }
+        else
+        {
+            return Finish(dec, IMAGE_DEC_ERR_HEADER);
+        }
+    }
+
+    if (dec->state == DEC_QOI_HEADER)
+    {
+        if (!Collect(dec, &p, &n, DEC_QOI_HEADER_BYTES))
+        {
+            return IMAGE_DEC_NEED_MORE;
+        }
+        ret = QoiHeader(dec);
+        if (ret != IMAGE_DEC_NEED_MORE)
+        {
+            return Finish(dec, ret);
+        }
+    }
+    if (dec->state == DEC_QOI_DATA)
+    {
+        return QoiData(dec, p, n);
+    }
+
+    if (dec->state == DEC_BMP_HEADER)
+    {
+        /* File header and DIB size, the DIB header, bit fields after a short one */
+        if (!Collect(dec, &p, &n, DEC_BMP_FILE_BYTES + 4U) ||
+            (Le32(&dec->hold[DEC_BMP_FILE_BYTES]) < DEC_BMP_DIB_MIN) ||
+            (Le32(&dec->hold[DEC_BMP_FILE_BYTES]) > DEC_BMP_DIB_MAX))
+        {
+            return (dec->held < (DEC_BMP_FILE_BYTES + 4U)) ? IMAGE_DEC_NEED_MORE :
+                    Finish(dec, IMAGE_DEC_ERR_FORMAT);
+        }
+        if (!Collect(dec, &p, &n, DEC_BMP_FILE_BYTES + Le32(&dec->hold[DEC_BMP_FILE_BYTES])) ||
+            ((Le32(&dec->hold[30]) == DEC_BMP_BITFIELDS) &&
+             !Collect(dec, &p, &n, DEC_BMP_MASKS + 12U)))
+        {
+            return IMAGE_DEC_NEED_MORE;
+        }
+        ret = BmpHeader(dec);
+        if (ret != IMAGE_DEC_NEED_MORE)
+        {
+            return Finish(dec, ret);
+        }
+    }
+    if (dec->state == DEC_BMP_SKIP)
+    {
+        uint32_t skip = dec->data - dec->pos;
+
+        if (skip > n)
+        {
+            dec->pos += n;
+            return IMAGE_DEC_NEED_MORE;
+        }
+        p += skip;
+        n -= skip;
+        dec->pos += skip;
+        dec->state = DEC_BMP_ROWS;
+    }
+    if (dec->state == DEC_BMP_ROWS)
+    {
+        return BmpRows(dec, p, n);
+    }
+    return (IMAGE_Dec_Status_t)dec->status;
+}
+
+uint8_t IMAGE_Dec_GetInfo(const IMAGE_Dec_t *dec, IMAGE_Dec_Info_t *info)
+{
+    if (dec->width == 0U)
+    {
+        return 0U;
+    }
+    info->width = dec->width;
+    info->height = dec->height;
+    info->type = dec->type;
+    info->bits = (uint8_t)((dec->type == IMAGE_DEC_QOI) ? (dec->alpha ? 32U : 24U) :
+            (dec->bpp * 8U));
+    return 1U;
+}
+
+IMAGE_Dec_Status_t IMAGE_Dec_Decode(IMAGE_Dec_t *dec, const void *data, uint32_t len,
+        uint16_t *surface, uint32_t stride, uint16_t width, uint16_t height,
+        int16_t x, int16_t y)
+{
+    IMAGE_Dec_Status_t ret;
+
+    IMAGE_Dec_Begin(dec, IMAGE_DEC_AUTO, surface, stride, width, height, x, y);
+    ret = IMAGE_Dec_Feed(dec, data, len);
+    return (ret == IMAGE_DEC_NEED_MORE) ? IMAGE_DEC_ERR_TRUNCATED : ret;
+}
+
+/******************************************************************************
+ *                              LOCAL FUNCTIONS                               *
+ ******************************************************************************/
+
+/* Header bytes into hold[] up to want; 1 once they are all in */
+static uint8_t Collect(IMAGE_Dec_t *dec, const uint8_t **p, uint32_t *n, uint32_t want)
+{
+    uint32_t take;
+
+    if (dec->held >= want)
+    {
+        return 1U;
+    }
+    take = want - dec->held;
+    take = (take > *n) ? *n : take;
+    memcpy(&dec->hold[dec->held], *p, take);
+    dec->held = (uint16_t)(dec->held + take);
+    dec->pos += take;
+    *p += take;
+    *n -= take;
+    return (dec->held >= want) ? 1U : 0U;
+}
+
+static IMAGE_Dec_Status_t Finish(IMAGE_Dec_t *dec, IMAGE_Dec_Status_t status)
+{
+    dec->state = DEC_END;
+    dec->status = (uint8_t)status;
+    return status;
+}
+
+/* Visible columns and rows (file order), none at all if either is empty */
+static void Clip(IMAGE_Dec_t *dec)
+{
+    int32_t x0 = (dec->x < 0) ? -dec->x : 0;
+    int32_t y0 = (dec->y < 0) ? -dec->y : 0;
+    int32_t x1 = (int32_t)dec->surface_width - dec->x;
+    int32_t y1 = (int32_t)dec->surface_height - dec->y;
+
+    x1 = (x1 > (int32_t)dec->width) ? (int32_t)dec->width : x1;
+    y1 = (y1 > (int32_t)dec->height) ? (int32_t)dec->height : y1;
+    if ((x0 >= x1) || (y0 >= y1))
+    {
+        x0 = x1 = y0 = y1 = 0;
+    }
+    dec->x0 = (uint32_t)x0;
+    dec->x1 = (uint32_t)x1;
+    if ((dec->type == IMAGE_DEC_BMP) && !dec->top_down && (y1 > y0))
+    {
+        dec->y0 = dec->height - (uint32_t)y1;
+        dec->y1 = dec->height - (uint32_t)y0;
+    }
+    else
+    {
+        dec->y0 = (uint32_t)y0;
+        dec->y1 = (uint32_t)y1;
+    }
+}
+
+static IMAGE_Dec_Status_t QoiHeader(IMAGE_Dec_t *dec)
+{
+    uint8_t channels = dec->hold[12];
+
+    dec->width = Be32(&dec->hold[4]);
+    dec->height = Be32(&dec->hold[8]);
+    if ((dec->width == 0U) || (dec->height == 0U) || (channels < 3U) || (channels > 4U) ||
+        (dec->hold[13] > 1U))
+    {
+        dec->width = 0U;
+        return IMAGE_DEC_ERR_HEADER;
+    }
+    if ((dec->width > IMAGE_DEC_MAX_SIDE) || (dec->height > IMAGE_DEC_MAX_SIDE))
+    {
+        return IMAGE_DEC_ERR_SIZE;
+    }
+    dec->alpha = (channels == 4U) ? 1U : 0U;
+    dec->top_down = 1U;
+    Clip(dec);
+    if (dec->y1 == 0U)
+    {
+        return IMAGE_DEC_DONE;
+    }
+    dec->px = 0xFF000000U;
+    memset(dec->index, 0, sizeof(dec->index));
+    dec->row = 0U;
+    dec->col = 0U;
+    dec->held = 0U;
+    QoiRow(dec);
+    dec->state = DEC_QOI_DATA;
+    return IMAGE_DEC_NEED_MORE;
+}
+
+static IMAGE_Dec_Status_t QoiData(IMAGE_Dec_t *dec, const uint8_t *p, uint32_t n)
+{
+    uint32_t r = dec->px & 0xFFU, g = (dec->px >> 8) & 0xFFU;
+    uint32_t b = (dec->px >> 16) & 0xFFU, a = dec->px >> 24;
+    uint32_t row = dec->row, col = dec->col, width = dec->width;
+    uint32_t x0 = dec->x0, x1 = dec->x1;
+    uint16_t *dst = dec->dst;
+
+    while (n != 0U)
+    {
+        const uint8_t *op;
+        uint32_t size, count = 1U;
+        uint8_t skip;
+        uint16_t c;
+
+        /* The op, from the chunk or completed in hold[] */
+        size = (dec->held != 0U) ? dec->hold[0] : p[0];
+        size = (size == QOI_OP_RGBA) ? 5U : ((size == QOI_OP_RGB) ? 4U :
+                (((size & QOI_OP_MASK) == QOI_OP_LUMA) ? 2U : 1U));
+        if ((dec->held != 0U) || (size > n))
+        {
+            uint32_t take = size - dec->held;
+
+            take = (take > n) ? n : take;
+            memcpy(&dec->hold[dec->held], p, take);
+            dec->held = (uint16_t)(dec->held + take);
+            p += take;
+            n -= take;
+            if (dec->held < size)
+            {
+                break;
+            }
+            op = dec->hold;
+            dec->held = 0U;
+        }
+        else
+        {
+            op = p;
+            p += size;
+            n -= size;
+        }
+
+        if (op[0] == QOI_OP_RGB)
+        {
+            r = op[1];
+            g = op[2];
+            b = op[3];
+        }
+        else if (op[0] == QOI_OP_RGBA)
+        {
+            r = op[1];
+            g = op[2];
+            b = op[3];
+            a = op[4];
+        }
+        else if ((op[0] & QOI_OP_MASK) == QOI_OP_INDEX)
+        {
+            uint32_t v = dec->index[op[0]];
+
+            r = v & 0xFFU;
+            g = (v >> 8) & 0xFFU;
+            b = (v >> 16) & 0xFFU;
+            a = v >> 24;
+        }
+        else if ((op[0] & QOI_OP_MASK) == QOI_OP_DIFF)
+        {
+            r = (r + ((op[0] >> 4) & 3U) - 2U) & 0xFFU;
+            g = (g + ((op[0] >> 2) & 3U) - 2U) & 0xFFU;
+            b = (b + (op[0] & 3U) - 2U) & 0xFFU;
+        }
+        else if ((op[0] & QOI_OP_MASK) == QOI_OP_LUMA)
+        {
+            uint32_t dg = (op[0] & 0x3FU) - 32U;
+
+            r = (r + dg + (op[1] >> 4) - 8U) & 0xFFU;
+            g = (g + dg) & 0xFFU;
+            b = (b + dg + (op[1] & 0x0FU) - 8U) & 0xFFU;
+        }
+        else
+        {
+            count = (op[0] & 0x3FU) + 1U;
+        }
+        dec->index[(r * 3U + g * 5U + b * 7U + a * 11U) & 63U] =
+                r | (g << 8) | (b << 16) | (a << 24);
+
+        /* count pixels, row after row, the visible columns written */
+        c = (uint16_t)(((r & 0xF8U) << 8) | ((g & 0xFCU) << 3) | (b >> 3));
+        skip = (dec->alpha && (a == 0U)) ? 1U : 0U;
+        while (count != 0U)
+        {
+            uint32_t span = width - col;
+            uint32_t from = (col > x0) ? col : x0;
+            uint32_t to;
+
+            span = (span > count) ? count : span;
+            to = ((col + span) < x1) ? (col + span) : x1;
+            if ((dst != NULL) && !skip)
+            {
+                for (; from < to; from++)
+                {
+                    dst[from - x0] = c;
+                }
+            }
+            col += span;
+            count -= span;
+            if (col == width)
+            {
+                col = 0U;
+                row++;
+                if (row >= dec->y1)
+                {
+                    /* A run may go on below the surface, not past the image */
+                    return Finish(dec, ((count != 0U) && (row == dec->height)) ?
+                            IMAGE_DEC_ERR_DATA : IMAGE_DEC_DONE);
+                }
+                dec->row = row;
+                QoiRow(dec);
+                dst = dec->dst;
+            }
+        }
+    }
+    dec->px = r | (g << 8) | (b << 16) | (a << 24);
+    dec->row = row;
+    dec->col = col;
+    return IMAGE_DEC_NEED_MORE;
+}
+
+/* Destination of the row, first visible column; NULL if the row is hidden */
+static void QoiRow(IMAGE_Dec_t *dec)
+{
+    dec->dst = NULL;
+    if ((dec->row >= dec->y0) && (dec->row < dec->y1))
+    {
+        dec->dst = dec->surface + (uint32_t)((int32_t)dec->row + dec->y) * dec->stride +
+                (uint32_t)((int32_t)dec->x0 + dec->x);
+    }
+}
+
+static IMAGE_Dec_Status_t BmpHeader(IMAGE_Dec_t *dec)
+{
+    const uint8_t *h = dec->hold;
+    int32_t height = (int32_t)Le32(&h[22]);
+    uint32_t bits = Le16(&h[28]);
+    uint32_t compression = Le32(&h[30]);
+    uint32_t mr = Le32(&h[DEC_BMP_MASKS]);
+    uint32_t mg = Le32(&h[DEC_BMP_MASKS + 4U]);
+    uint32_t mb = Le32(&h[DEC_BMP_MASKS + 8U]);
+
+    if (((int32_t)Le32(&h[18]) <= 0) || (height == 0) || (height == INT32_MIN) ||
+        (Le16(&h[26]) != 1U) || (Le32(&h[10]) < dec->pos))
+    {
+        return IMAGE_DEC_ERR_HEADER;
+    }
+    dec->width = Le32(&h[18]);
+    dec->height = (height < 0) ? (uint32_t)-height : (uint32_t)height;
+    dec->top_down = (height < 0) ? 1U : 0U;
+    dec->data = Le32(&h[10]);
+    dec->bpp = (uint8_t)(bits / 8U);
+
+    if ((bits == 24U) && (compression == DEC_BMP_RGB))
+    {
+        dec->format = (uint8_t)VISION_COLOR_RGB888;
+    }
+    else if ((bits == 32U) && ((compression == DEC_BMP_RGB) ||
+             ((compression == DEC_BMP_BITFIELDS) && (mr == 0x00FF0000U) &&
+              (mg == 0x0000FF00U) && (mb == 0x000000FFU))))
+    {
+        dec->format = (uint8_t)VISION_COLOR_ARGB8888;
+    }
+    else if ((bits == 16U) && (compression == DEC_BMP_BITFIELDS) && (mr == 0xF800U) &&
+             (mg == 0x07E0U) && (mb == 0x001FU))
+    {
+        dec->format = (uint8_t)VISION_COLOR_RGB565;
+    }
+    else if ((bits == 16U) && ((compression == DEC_BMP_RGB) ||
+             ((compression == DEC_BMP_BITFIELDS) && (mr == 0x7C00U) &&
+              (mg == 0x03E0U) && (mb == 0x001FU))))
+    {
+        dec->format = DEC_FMT_555;
+    }
+    else
+    {
+        return IMAGE_DEC_ERR_FORMAT;
+    }
+    if ((dec->width > IMAGE_DEC_MAX_SIDE) || (dec->height > IMAGE_DEC_MAX_SIDE))
+    {
+        return IMAGE_DEC_ERR_SIZE;
+    }
+    Clip(dec);
+    if ((dec->x1 - dec->x0) > IMAGE_DEC_MAX_WIDTH)
+    {
+        return IMAGE_DEC_ERR_SIZE;
+    }
+    if (dec->y1 == 0U)
+    {
+        return IMAGE_DEC_DONE;
+    }
+    dec->row_bytes = (dec->width * bits + 31U) / 32U * 4U;
+    dec->row = 0U;
+    dec->col = 0U;
+    dec->held = 0U;
+    dec->state = DEC_BMP_SKIP;
+    return IMAGE_DEC_NEED_MORE;
+}
+
+static IMAGE_Dec_Status_t BmpRows(IMAGE_Dec_t *dec, const uint8_t *p, uint32_t n)
+{
+    uint32_t vb0 = dec->x0 * dec->bpp, vb1 = dec->x1 * dec->bpp;
+
+    while (n != 0U)
+    {
+        uint32_t take;
+
+        if (dec->row < dec->y0)
+        {
+            /* Rows above (bottom up: below) the surface, skipped whole */
+            take = (dec->y0 - dec->row) * dec->row_bytes - dec->col;
+            take = (take > n) ? n : take;
+            dec->col += take;
+            dec->row += dec->col / dec->row_bytes;
+            dec->col %= dec->row_bytes;
+            p += take;
+            n -= take;
+            continue;
+        }
+
+        if ((dec->col == 0U) && (n >= dec->row_bytes))
+        {
+            /* Whole rows in the chunk, converted from there */
+            take = n / dec->row_bytes;
+            take = (take > (dec->y1 - dec->row)) ? (dec->y1 - dec->row) : take;
+            BmpConvert(dec, p + vb0, dec->row_bytes, take);
+            dec->row += take;
+            p += take * dec->row_bytes;
+            n -= take * dec->row_bytes;
+        }
+        else
+        {
+            /* A cut row: its visible span gathered in hold[] */
+            uint32_t from, to;
+
+            take = dec->row_bytes - dec->col;
+            take = (take > n) ? n : take;
+            from = (dec->col > vb0) ? dec->col : vb0;
+            to = ((dec->col + take) < vb1) ? (dec->col + take) : vb1;
+            if (from < to)
+            {
+                memcpy(&dec->hold[from - vb0], p + (from - dec->col), to - from);
+            }
+            dec->col += take;
+            p += take;
+            n -= take;
+            if (dec->col == dec->row_bytes)
+            {
+                BmpConvert(dec, dec->hold, 0U, 1U);
+                dec->col = 0U;
+                dec->row++;
+            }
+        }
+        if (dec->row >= dec->y1)
+        {
+            return Finish(dec, IMAGE_DEC_DONE);
+        }
+    }
+    return IMAGE_DEC_NEED_MORE;
+}
+
+/* Visible span of lines rows from dec->row (file order) to the surface */
+static void BmpConvert(IMAGE_Dec_t *dec, const uint8_t *src, uint32_t src_stride,
+        uint32_t lines)
+{
+    uint32_t width = dec->x1 - dec->x0;
+
+    for (uint32_t i = 0U; i < lines; )
+    {
+        uint32_t row = dec->row + i;
+        uint32_t y = dec->top_down ? row : (dec->height - 1U - row);
+        uint16_t *dst = dec->surface + (uint32_t)((int32_t)y + dec->y) * dec->stride +
+                (uint32_t)((int32_t)dec->x0 + dec->x);
+        /* Top down: the rest in one job, bottom up: rows go up the surface */
+        uint32_t block = (dec->top_down && (dec->format != DEC_FMT_555)) ? (lines - i) : 1U;
+
+        if (dec->format == DEC_FMT_555)
+        {
+            for (uint32_t k = 0U; k < width; k++)
+            {
+                uint32_t px = Le16(&src[k * 2U]);
+
+                dst[k] = (uint16_t)(((px & 0x7FE0U) << 1) | ((px >> 4) & 0x20U) | (px & 0x1FU));
+            }
+        }
+        else
+        {
+            VISION_Color_Convert(src, (VISION_ColorFormat_t)dec->format,
+                    (src_stride != 0U) ? src_stride : (width * dec->bpp), dst,
+                    VISION_COLOR_RGB565, dec->stride * 2U, (uint16_t)width, (uint16_t)block,
+                    dec->engine);
+        }
+        src += block * src_stride;
+        i += block;
+    }
+}
+
+static uint16_t Le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | ((uint32_t)p[1] << 8));
+}
+
+static uint32_t Le32(const uint8_t *p)
+{
+    return p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint32_t Be32(const uint8_t *p)
+{
+    return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
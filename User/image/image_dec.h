@@ -0,0 +1,137 @@
+/*
+ * image_dec.h
+ * Streaming QOI and BMP decoders, straight into an RGB565 surface
+ *
+ * The file is pushed in chunks of any size as it arrives (UART, USB, a
+ * file system read); rows are written to the surface as soon as their bytes
+ * are in, there is no copy of the whole picture. Only what a chunk cuts in
+ * two is held in the decoder: a QOI op (5 bytes at most) or the visible
+ * span of a BMP row.
+ *
+ *  - QOI (qoiformat.org): RGB and RGBA, pixels are reduced to RGB565 as
+ *    they are decoded; a pixel of alpha 0 leaves the surface as it is.
+ *  - BMP: uncompressed 16 bit (555, or 565 bit fields), 24 bit and 32 bit
+ *    (XRGB), bottom up or top down. Rows go through the VISION_Color
+ *    converters: whole top down blocks in one job (DMA2D from
+ *    VISION_COLOR_DMA2D_MIN_PIXELS on), bottom up rows one by one (CPU).
+ *    Palettes and RLE compression are refused.
+ *
+ * The image is placed with its top left at (x, y), clipped to the surface.
+ */
+
+#ifndef IMAGE_DEC_H_
+#define IMAGE_DEC_H_
+
+/******************************************************************************
+ *                                 INCLUDES                                   *
+ ******************************************************************************/
+
+#include <stdint.h>
+#include "vision_color.h"
+
+/******************************************************************************
+ *                            CONFIGURATION MACRO                             *
+ ******************************************************************************/
+
+/* Widest visible span of a BMP row cut by a chunk end (pixels) */
+#define IMAGE_DEC_MAX_WIDTH                      (800U)
+/* Largest image accepted, either side */
+#define IMAGE_DEC_MAX_SIDE                       (8192U)
+
+#define IMAGE_DEC_QOI_MAGIC                      (0x716F6966U)   /* "qoif" */
+#define IMAGE_DEC_BMP_MAGIC                      (0x4D42U)       /* "BM" */
+
+/******************************************************************************
+ *                           GLOBAL DATA TYPES                                *
+ ******************************************************************************/
+
+typedef enum
+{
+    IMAGE_DEC_DONE = 0,           /* every visible pixel written */
+    IMAGE_DEC_NEED_MORE,          /* chunk used up, feed the next one */
+    IMAGE_DEC_ERR_HEADER,         /* not a QOI or a BMP, or bad geometry */
+    IMAGE_DEC_ERR_FORMAT,         /* BMP flavour not supported */
+    IMAGE_DEC_ERR_SIZE,           /* larger than the limits above */
+    IMAGE_DEC_ERR_DATA,           /* QOI op out of the image */
+    IMAGE_DEC_ERR_TRUNCATED,      /* IMAGE_Dec_Decode(): data ended first */
+} IMAGE_Dec_Status_t;
+
+typedef enum
+{
+    IMAGE_DEC_AUTO = 0,           /* from the first bytes */
+    IMAGE_DEC_QOI,
+    IMAGE_DEC_BMP,
+} IMAGE_Dec_Type_t;
+
+typedef struct
+{
+    /* Destination */
+    uint16_t *surface;
+    uint32_t stride;              /* pixels */
+    uint16_t surface_width;
+    uint16_t surface_height;
+    int16_t  x;
+    int16_t  y;
+    VISION_ColorEngine_t engine;  /* BMP rows, IMAGE_Dec_Begin() sets AUTO */
+
+    /* Image */
+    uint8_t  type;                /* IMAGE_Dec_Type_t */
+    uint8_t  state;
+    uint8_t  bpp;                 /* BMP bytes per pixel */
+    uint8_t  format;              /* BMP VISION_ColorFormat_t, or 555 */
+    uint8_t  top_down;
+    uint8_t  alpha;               /* QOI: 4 channels */
+    uint8_t  status;              /* IMAGE_Dec_Status_t once finished */
+    uint16_t held;                /* bytes in hold[] */
+    uint32_t width;
+    uint32_t height;
+    uint32_t x0, x1;              /* visible columns of the image */
+    uint32_t y0, y1;              /* visible rows, in file order */
+
+    /* Position */
+    uint32_t pos;                 /* bytes consumed */
+    uint32_t data;                /* BMP: offset of the pixels */
+    uint32_t row_bytes;           /* BMP: row with its padding */
+    uint32_t row;                 /* rows done (BMP: in file order) */
+    uint32_t col;                 /* QOI: pixel in the row, BMP: byte */
+    uint16_t *dst;                /* QOI: row being written, NULL if hidden */
+
+    /* QOI */
+    uint32_t px;                  /* previous pixel, 0xAABBGGRR */
+    uint32_t index[64];
+
+    /* Headers, a cut QOI op, the visible span of a cut BMP row */
+    uint8_t  hold[IMAGE_DEC_MAX_WIDTH * 4U] __attribute__((aligned(4)));
+} IMAGE_Dec_t;
+
+typedef struct
+{
+    uint32_t width;
+    uint32_t height;
+    uint8_t  type;                /* IMAGE_Dec_Type_t */
+    uint8_t  bits;                /* BMP bits per pixel, QOI channels * 8 */
+} IMAGE_Dec_Info_t;
+
+/******************************************************************************
+ *                      GLOBAL FUNCTIONS PROTOTYPES                           *
+ ******************************************************************************/
+
+/* Starts a decode into an RGB565 surface (stride in pixels) of width x
+ * height, image top left at (x, y) */
+extern void IMAGE_Dec_Begin(IMAGE_Dec_t *dec, IMAGE_Dec_Type_t type, uint16_t *surface,
+        uint32_t stride, uint16_t width, uint16_t height, int16_t x, int16_t y);
+
+/* Pushes the next len bytes of the file; NEED_MORE until the last pixel.
+ * Decoding stops after the last visible row: what follows is ignored, as
+ * are errors in it. Errors are final. */
+extern IMAGE_Dec_Status_t IMAGE_Dec_Feed(IMAGE_Dec_t *dec, const void *data, uint32_t len);
+
+/* Size of the image once the header is in, 0 before */
+extern uint8_t IMAGE_Dec_GetInfo(const IMAGE_Dec_t *dec, IMAGE_Dec_Info_t *info);
+
+/* Whole file in memory (dec is the work area) */
+extern IMAGE_Dec_Status_t IMAGE_Dec_Decode(IMAGE_Dec_t *dec, const void *data, uint32_t len,
+        uint16_t *surface, uint32_t stride, uint16_t width, uint16_t height,
+        int16_t x, int16_t y);
+
+#endif /* IMAGE_DEC_H_ */